@@ -0,0 +1,252 @@
+#include <furi.h>
+#include <furi_hal_cortex.h>
+#include <gui/gui.h>
+#include <gui/icon_animation.h>
+#include <input/input.h>
+#include <assets_icons.h>
+
+#define TAG "GuiBench"
+
+/** Each workload is redrawn as fast as gui allows for this long */
+#define GUI_BENCH_WORKLOAD_TIME 3000
+
+typedef enum {
+    GuiBenchWorkloadText,
+    GuiBenchWorkloadIcons,
+    GuiBenchWorkloadShapes,
+    GuiBenchWorkloadAnimation,
+    GuiBenchWorkloadMAX,
+} GuiBenchWorkload;
+
+typedef struct {
+    uint32_t fps_x10;
+    uint32_t draw_time_avg; // ViewPort draw callback, us
+    uint32_t frame_time_max; // Draw and commit of whole frame, us
+    uint32_t dropped;
+} GuiBenchResult;
+
+typedef struct {
+    Gui* gui;
+    ViewPort* view_port;
+    FuriMessageQueue* input_queue;
+    IconAnimation* animation;
+
+    FuriMutex* mutex;
+    bool running;
+    GuiBenchWorkload workload;
+    uint32_t frame;
+    uint32_t draw_cycles;
+    uint32_t draw_count;
+    GuiBenchResult results[GuiBenchWorkloadMAX];
+} GuiBench;
+
+static const char* const gui_bench_workload_names[GuiBenchWorkloadMAX] = {
+    [GuiBenchWorkloadText] = "Text",
+    [GuiBenchWorkloadIcons] = "Icons",
+    [GuiBenchWorkloadShapes] = "Shapes",
+    [GuiBenchWorkloadAnimation] = "Anim",
+};
+
+static void gui_bench_draw_text(Canvas* canvas, uint32_t frame) {
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str(canvas, frame % 32, 10, "Primary font text");
+    canvas_set_font(canvas, FontSecondary);
+    for(uint8_t y = 20; y < 56; y += 9) {
+        canvas_draw_str(canvas, (frame + y) % 16, y, "Secondary font, long line of text");
+    }
+    canvas_set_font(canvas, FontKeyboard);
+    canvas_draw_str_aligned(canvas, 64, 63, AlignCenter, AlignBottom, "keyboard font 0123456789");
+}
+
+static void gui_bench_draw_icons(Canvas* canvas, uint32_t frame) {
+    canvas_draw_icon(canvas, 0, frame % 14, &I_DFU_128x50);
+    for(uint8_t x = 0; x < 128; x += 32) {
+        canvas_draw_icon(canvas, (x + frame) % 128, 40, &I_Warning_30x23);
+    }
+    for(uint8_t x = 0; x < 128; x += 8) {
+        canvas_draw_icon(canvas, x, (x + frame) % 57, &I_ButtonCenter_7x7);
+    }
+}
+
+static void gui_bench_draw_shapes(Canvas* canvas, uint32_t frame) {
+    canvas_set_color(canvas, ColorXOR);
+    for(uint8_t i = 1; i < 6; i++) {
+        uint8_t size = 16 + (frame * i) % 16;
+        canvas_draw_box(canvas, (frame * i) % (128 - size), (frame * i) % (64 - size), size, size);
+        canvas_draw_circle(canvas, 64, 32, (frame + i * 6) % 32);
+        canvas_draw_line(canvas, 0, (frame * i) % 64, 127, 63 - (frame * i) % 64);
+    }
+    canvas_set_color(canvas, ColorBlack);
+}
+
+static void gui_bench_draw_row(Canvas* canvas, uint8_t y, const char* const columns[]) {
+    static const uint8_t column_x[] = {50, 78, 104, 127};
+    canvas_draw_str(canvas, 0, y, columns[0]);
+    for(size_t i = 0; i < COUNT_OF(column_x); i++) {
+        canvas_draw_str_aligned(canvas, column_x[i], y, AlignRight, AlignBottom, columns[i + 1]);
+    }
+}
+
+static void gui_bench_draw_results(Canvas* canvas, GuiBench* instance) {
+    static const char* const header[] = {"Test", "FPS", "Draw", "Max", "Drop"};
+    char fps[8], draw[8], max[8], dropped[8];
+
+    canvas_set_font(canvas, FontSecondary);
+    gui_bench_draw_row(canvas, 8, header);
+    for(size_t i = 0; i < GuiBenchWorkloadMAX; i++) {
+        const GuiBenchResult* result = &instance->results[i];
+        snprintf(fps, sizeof(fps), "%lu.%lu", result->fps_x10 / 10, result->fps_x10 % 10);
+        snprintf(draw, sizeof(draw), "%lu", result->draw_time_avg);
+        snprintf(max, sizeof(max), "%lu", result->frame_time_max);
+        snprintf(dropped, sizeof(dropped), "%lu", result->dropped);
+        const char* const row[] = {gui_bench_workload_names[i], fps, draw, max, dropped};
+        gui_bench_draw_row(canvas, 19 + i * 10, row);
+    }
+    canvas_draw_str_aligned(canvas, 64, 63, AlignCenter, AlignBottom, "OK: restart, times in us");
+}
+
+static void gui_bench_draw_callback(Canvas* canvas, void* context) {
+    GuiBench* instance = context;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+
+    uint32_t start = DWT->CYCCNT;
+    canvas_clear(canvas);
+
+    if(!instance->running) {
+        gui_bench_draw_results(canvas, instance);
+    } else {
+        switch(instance->workload) {
+        case GuiBenchWorkloadText:
+            gui_bench_draw_text(canvas, instance->frame);
+            break;
+        case GuiBenchWorkloadIcons:
+            gui_bench_draw_icons(canvas, instance->frame);
+            break;
+        case GuiBenchWorkloadShapes:
+            gui_bench_draw_shapes(canvas, instance->frame);
+            break;
+        default:
+            canvas_draw_icon_animation(canvas, 0, 0, instance->animation);
+            break;
+        }
+        instance->frame++;
+        instance->draw_cycles += DWT->CYCCNT - start;
+        instance->draw_count++;
+    }
+
+    furi_mutex_release(instance->mutex);
+}
+
+static void gui_bench_input_callback(InputEvent* event, void* context) {
+    GuiBench* instance = context;
+    furi_message_queue_put(instance->input_queue, event, 0);
+}
+
+static void gui_bench_workload_start(GuiBench* instance, GuiBenchWorkload workload) {
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    instance->workload = workload;
+    instance->running = true;
+    instance->frame = 0;
+    instance->draw_cycles = 0;
+    instance->draw_count = 0;
+    gui_reset_frame_stats(instance->gui);
+    furi_mutex_release(instance->mutex);
+}
+
+static void gui_bench_workload_finish(GuiBench* instance, uint32_t elapsed) {
+    GuiFrameStats stats;
+    gui_get_frame_stats(instance->gui, &stats);
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    GuiBenchResult* result = &instance->results[instance->workload];
+    result->fps_x10 = stats.drawn * 10000 / MAX(elapsed, 1UL);
+    result->draw_time_avg = instance->draw_cycles / MAX(instance->draw_count, 1UL) /
+                            furi_hal_cortex_instructions_per_microsecond();
+    result->frame_time_max = stats.draw_time_max;
+    result->dropped = stats.dropped;
+    instance->running = false;
+    furi_mutex_release(instance->mutex);
+
+    FURI_LOG_I(
+        TAG,
+        "%s: %lu.%lu fps, draw avg %luus, frame max %luus, %lu dropped, %lu requested",
+        gui_bench_workload_names[instance->workload],
+        result->fps_x10 / 10,
+        result->fps_x10 % 10,
+        result->draw_time_avg,
+        result->frame_time_max,
+        result->dropped,
+        stats.requested);
+}
+
+static GuiBench* gui_bench_alloc() {
+    GuiBench* instance = malloc(sizeof(GuiBench));
+
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    instance->input_queue = furi_message_queue_alloc(8, sizeof(InputEvent));
+    instance->animation = icon_animation_alloc(&A_Levelup_128x64);
+
+    instance->view_port = view_port_alloc();
+    view_port_draw_callback_set(instance->view_port, gui_bench_draw_callback, instance);
+    view_port_input_callback_set(instance->view_port, gui_bench_input_callback, instance);
+
+    instance->gui = furi_record_open(RECORD_GUI);
+    gui_add_view_port(instance->gui, instance->view_port, GuiLayerFullscreen);
+
+    return instance;
+}
+
+static void gui_bench_free(GuiBench* instance) {
+    gui_remove_view_port(instance->gui, instance->view_port);
+    furi_record_close(RECORD_GUI);
+    view_port_free(instance->view_port);
+
+    icon_animation_free(instance->animation);
+    furi_message_queue_free(instance->input_queue);
+    furi_mutex_free(instance->mutex);
+    free(instance);
+}
+
+int32_t gui_bench_app(void* p) {
+    UNUSED(p);
+
+    GuiBench* instance = gui_bench_alloc();
+    icon_animation_start(instance->animation);
+
+    GuiBenchWorkload workload = GuiBenchWorkloadText;
+    uint32_t workload_start = furi_get_tick();
+    gui_bench_workload_start(instance, workload);
+
+    while(true) {
+        InputEvent event;
+        // Short timeout keeps redraw requests coming faster than gui frame rate
+        if(furi_message_queue_get(instance->input_queue, &event, 1) == FuriStatusOk) {
+            if(event.type != InputTypeShort) continue;
+            if(event.key == InputKeyBack) break;
+            if(event.key == InputKeyOk && !instance->running) {
+                workload = GuiBenchWorkloadText;
+                workload_start = furi_get_tick();
+                gui_bench_workload_start(instance, workload);
+            }
+        }
+
+        if(instance->running) {
+            uint32_t elapsed = furi_get_tick() - workload_start;
+            if(elapsed >= furi_ms_to_ticks(GUI_BENCH_WORKLOAD_TIME)) {
+                elapsed = elapsed * 1000 / furi_kernel_get_tick_frequency();
+                gui_bench_workload_finish(instance, elapsed);
+                if(++workload < GuiBenchWorkloadMAX) {
+                    workload_start = furi_get_tick();
+                    gui_bench_workload_start(instance, workload);
+                }
+            }
+        }
+
+        view_port_update(instance->view_port);
+    }
+
+    icon_animation_stop(instance->animation);
+    gui_bench_free(instance);
+
+    return 0;
+}
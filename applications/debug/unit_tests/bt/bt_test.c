@@ -6,6 +6,7 @@
 #include <storage/storage.h>
 
 #define BT_TEST_KEY_STORAGE_FILE_PATH EXT_PATH("unit_tests/bt_test.keys")
+#define BT_TEST_KEY_STORAGE_JOURNAL_PATH EXT_PATH("unit_tests/bt_test.keys.journal")
 #define BT_TEST_NVM_RAM_BUFF_SIZE (507 * 4) // The same as in ble NVM storage
 
 typedef struct {
@@ -75,6 +76,9 @@ static void bt_test_keys_storage_profile() {
             &bt_test->nvm_ram_buff_dut[nvm_disconnect_update_offset],
             nvm_disconnect_update_size),
         "Failed to update key storage on initial disconnect");
+    mu_assert(
+        storage_file_exists(bt_test->storage, BT_TEST_KEY_STORAGE_JOURNAL_PATH),
+        "Update was not journaled");
     memset(bt_test->nvm_ram_buff_dut, 0, BT_TEST_NVM_RAM_BUFF_SIZE);
     mu_assert(bt_keys_storage_load(bt_test->bt_keys_storage), "Failed to load NVM");
     mu_assert(
@@ -86,6 +90,9 @@ static void bt_test_keys_remove_test_file() {
     mu_assert(
         storage_simply_remove(bt_test->storage, BT_TEST_KEY_STORAGE_FILE_PATH),
         "Can't remove test file");
+    mu_assert(
+        storage_simply_remove(bt_test->storage, BT_TEST_KEY_STORAGE_JOURNAL_PATH),
+        "Can't remove test journal");
 }
 
 MU_TEST(bt_test_keys_storage_serial_profile) {
@@ -0,0 +1,231 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <storage/storage.h>
+#include <flipper_format/flipper_format.h>
+#include "../minunit.h"
+
+#define BENCHMARK_DIR_NAME EXT_PATH("unit_tests_tmp")
+#define BENCHMARK_TEXT_FILE_NAME BENCHMARK_DIR_NAME "/ff_benchmark.test"
+#define BENCHMARK_BINARY_FILE_NAME BENCHMARK_DIR_NAME "/ff_benchmark_bin.test"
+// Stays under index limits, so indexed and scanning lookups can be compared on one file
+#define BENCHMARK_KEYS 120
+#define BENCHMARK_VALUES 64
+#define BENCHMARK_KEY_SIZE 16
+
+typedef struct {
+    size_t allocs;
+    uint32_t start;
+} FlipperFormatBenchmarkMark;
+
+typedef struct {
+    const char* name;
+    const char* path;
+    bool buffered;
+} FlipperFormatBenchmarkFile;
+
+static const FlipperFormatBenchmarkFile benchmark_files[] = {
+    {.name = "text", .path = BENCHMARK_TEXT_FILE_NAME, .buffered = false},
+    {.name = "text buffered", .path = BENCHMARK_TEXT_FILE_NAME, .buffered = true},
+    {.name = "binary buffered", .path = BENCHMARK_BINARY_FILE_NAME, .buffered = true},
+};
+
+static uint32_t* benchmark_values;
+
+static void flipper_format_benchmark_key(char* key, size_t index) {
+    snprintf(key, BENCHMARK_KEY_SIZE, "Array %03zu", index);
+}
+
+static uint32_t flipper_format_benchmark_value(size_t key, size_t index) {
+    // Mix of short and long numbers, as in real files
+    return (key * 2654435761UL + index * 40503UL) >> (index % 24);
+}
+
+static void flipper_format_benchmark_mark(FlipperFormatBenchmarkMark* mark) {
+    mark->allocs = memmgr_heap_get_alloc_count();
+    mark->start = DWT->CYCCNT;
+}
+
+static void flipper_format_benchmark_report(
+    const FlipperFormatBenchmarkMark* mark,
+    const char* test,
+    const char* file,
+    size_t bytes,
+    size_t ops) {
+    uint32_t cycles = DWT->CYCCNT - mark->start;
+    size_t allocs = memmgr_heap_get_alloc_count() - mark->allocs;
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    uint64_t cpu_hz = (uint64_t)cycles_per_us * 1000000;
+
+    printf(
+        "  %-10s %-16s %7lu B/s %6lu ops/s %6lu us/op %5zu allocs\r\n",
+        test,
+        file,
+        (uint32_t)(cycles ? bytes * cpu_hz / cycles : 0),
+        (uint32_t)(cycles ? ops * cpu_hz / cycles : 0),
+        cycles / cycles_per_us / MAX(ops, 1U),
+        allocs);
+}
+
+static bool flipper_format_benchmark_generate(
+    Storage* storage,
+    const char* path,
+    FlipperFormatEncoding encoding) {
+    FlipperFormat* flipper_format = flipper_format_file_alloc_ex(storage, encoding);
+    char key[BENCHMARK_KEY_SIZE];
+    bool success = flipper_format_file_open_always(flipper_format, path) &&
+                   flipper_format_write_header_cstr(flipper_format, "Benchmark", 1);
+
+    for(size_t k = 0; k < BENCHMARK_KEYS && success; k++) {
+        for(size_t i = 0; i < BENCHMARK_VALUES; i++) {
+            benchmark_values[i] = flipper_format_benchmark_value(k, i);
+        }
+        flipper_format_benchmark_key(key, k);
+        success = flipper_format_write_uint32(
+            flipper_format, key, benchmark_values, BENCHMARK_VALUES);
+    }
+
+    flipper_format_free(flipper_format);
+    return success;
+}
+
+static FlipperFormat* flipper_format_benchmark_open(
+    Storage* storage,
+    const FlipperFormatBenchmarkFile* file,
+    size_t* size) {
+    FlipperFormat* flipper_format = NULL;
+    bool success;
+
+    if(file->buffered) {
+        flipper_format = flipper_format_buffered_file_alloc(storage);
+        success = flipper_format_buffered_file_open_existing(flipper_format, file->path);
+    } else {
+        flipper_format = flipper_format_file_alloc(storage);
+        success = flipper_format_file_open_existing(flipper_format, file->path);
+    }
+
+    FileInfo info;
+    if(success && storage_common_stat(storage, file->path, &info) == FSE_OK) {
+        *size = info.size;
+    } else {
+        flipper_format_free(flipper_format);
+        flipper_format = NULL;
+    }
+
+    return flipper_format;
+}
+
+/** Read all arrays in file order, as apps load their files */
+static bool
+    flipper_format_benchmark_parse(Storage* storage, const FlipperFormatBenchmarkFile* file) {
+    size_t size;
+    FlipperFormat* flipper_format = flipper_format_benchmark_open(storage, file, &size);
+    if(!flipper_format) return false;
+
+    char key[BENCHMARK_KEY_SIZE];
+    bool success = true;
+
+    FlipperFormatBenchmarkMark mark;
+    flipper_format_benchmark_mark(&mark);
+    for(size_t k = 0; k < BENCHMARK_KEYS && success; k++) {
+        flipper_format_benchmark_key(key, k);
+        success = flipper_format_read_uint32(
+            flipper_format, key, benchmark_values, BENCHMARK_VALUES);
+    }
+    flipper_format_benchmark_report(
+        &mark, "parse", file->name, size, BENCHMARK_KEYS * BENCHMARK_VALUES);
+    flipper_format_free(flipper_format);
+
+    // Spot check of the last array, parse errors are covered by flipper_format tests
+    for(size_t i = 0; i < BENCHMARK_VALUES && success; i++) {
+        success = benchmark_values[i] == flipper_format_benchmark_value(BENCHMARK_KEYS - 1, i);
+    }
+
+    return success;
+}
+
+/** Look every key up, without index each lookup scans from the start of file */
+static bool flipper_format_benchmark_seek(
+    Storage* storage,
+    const FlipperFormatBenchmarkFile* file,
+    bool indexed) {
+    size_t size;
+    FlipperFormat* flipper_format = flipper_format_benchmark_open(storage, file, &size);
+    if(!flipper_format) return false;
+
+    char key[BENCHMARK_KEY_SIZE];
+    bool success = true;
+
+    FlipperFormatBenchmarkMark mark;
+    flipper_format_benchmark_mark(&mark);
+    if(indexed) success = flipper_format_build_index(flipper_format);
+    for(size_t k = 0; k < BENCHMARK_KEYS && success; k++) {
+        flipper_format_benchmark_key(key, k);
+        success = flipper_format_key_exist(flipper_format, key);
+    }
+    flipper_format_benchmark_report(
+        &mark, indexed ? "seek index" : "seek", file->name, size, BENCHMARK_KEYS);
+    flipper_format_free(flipper_format);
+
+    return success;
+}
+
+MU_TEST(flipper_format_benchmark_generate_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_mkdir(storage, BENCHMARK_DIR_NAME);
+    bool text = flipper_format_benchmark_generate(
+        storage, BENCHMARK_TEXT_FILE_NAME, FlipperFormatEncodingText);
+    bool binary = flipper_format_benchmark_generate(
+        storage, BENCHMARK_BINARY_FILE_NAME, FlipperFormatEncodingBinary);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(text, "Unable to generate text benchmark file\r\n");
+    mu_assert(binary, "Unable to generate binary benchmark file\r\n");
+    printf(
+        "FlipperFormat benchmark, %u keys of %u uint32:\r\n", BENCHMARK_KEYS, BENCHMARK_VALUES);
+}
+
+MU_TEST(flipper_format_benchmark_parse_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool success = true;
+    for(size_t i = 0; i < COUNT_OF(benchmark_files) && success; i++) {
+        success = flipper_format_benchmark_parse(storage, &benchmark_files[i]);
+    }
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(success, "Array parse failed\r\n");
+}
+
+MU_TEST(flipper_format_benchmark_seek_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool success = true;
+    for(size_t i = 0; i < COUNT_OF(benchmark_files) && success; i++) {
+        success = flipper_format_benchmark_seek(storage, &benchmark_files[i], false) &&
+                  flipper_format_benchmark_seek(storage, &benchmark_files[i], true);
+    }
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(success, "Key seek failed\r\n");
+}
+
+MU_TEST_SUITE(flipper_format_benchmark) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    if(storage_sd_status(storage) != FSE_OK) {
+        printf("FlipperFormat benchmark: no SD card\r\n");
+    } else {
+        benchmark_values = malloc(sizeof(uint32_t) * BENCHMARK_VALUES);
+        MU_RUN_TEST(flipper_format_benchmark_generate_test);
+        MU_RUN_TEST(flipper_format_benchmark_parse_test);
+        MU_RUN_TEST(flipper_format_benchmark_seek_test);
+        free(benchmark_values);
+    }
+
+    storage_simply_remove(storage, BENCHMARK_TEXT_FILE_NAME);
+    storage_simply_remove(storage, BENCHMARK_BINARY_FILE_NAME);
+    furi_record_close(RECORD_STORAGE);
+}
+
+int run_minunit_test_flipper_format_benchmark() {
+    MU_RUN_SUITE(flipper_format_benchmark);
+    return MU_EXIT_CODE;
+}
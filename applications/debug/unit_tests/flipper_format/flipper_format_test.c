@@ -84,6 +84,11 @@ static const char* test_file_flipper = TEST_DIR READ_TEST_FLP;
 // data containing odd user input
 static const char* test_file_oddities = TEST_DIR READ_TEST_ODD;
 
+#define READ_TEST_BIN "ff_bin.test"
+static const char* test_file_binary = TEST_DIR READ_TEST_BIN;
+#define READ_TEST_BIN_TEXT "ff_bin_text.test"
+static const char* test_file_binary_text = TEST_DIR READ_TEST_BIN_TEXT;
+
 static bool storage_write_string(const char* path, const char* data) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* file = storage_file_alloc(storage);
@@ -426,6 +431,7 @@ static bool test_read_multikey(const char* file_name) {
 
     do {
         if(!flipper_format_file_open_existing(file, file_name)) break;
+        if(!flipper_format_build_index(file)) break;
         if(!flipper_format_read_header(file, string_value, &uint32_value)) break;
         if(furi_string_cmp_str(string_value, test_filetype) != 0) break;
         if(uint32_value != test_version) break;
@@ -456,6 +462,219 @@ static bool test_read_multikey(const char* file_name) {
     return result;
 }
 
+static bool test_convert(const char* source_name, const char* destination_name, bool binary) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* source = flipper_format_file_alloc(storage);
+    FlipperFormat* destination = flipper_format_file_alloc_ex(
+        storage, binary ? FlipperFormatEncodingBinary : FlipperFormatEncodingText);
+
+    do {
+        if(!flipper_format_file_open_existing(source, source_name)) break;
+        if(!flipper_format_file_open_always(destination, destination_name)) break;
+        if(!flipper_format_convert(source, destination)) break;
+
+        result = true;
+    } while(false);
+
+    flipper_format_free(destination);
+    flipper_format_free(source);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+#define TEST_ARRAY_SIZE 1000U
+
+static bool test_write_read_array(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+
+    uint32_t* uint32_data = malloc(TEST_ARRAY_SIZE * sizeof(uint32_t));
+    int32_t* int32_data = malloc(TEST_ARRAY_SIZE * sizeof(int32_t));
+    uint8_t* hex_data = malloc(TEST_ARRAY_SIZE);
+    for(size_t i = 0; i < TEST_ARRAY_SIZE; i++) {
+        uint32_data[i] = i * 4000037U;
+        int32_data[i] = (i % 2) ? -(int32_t)(i * 31) : (int32_t)(i * 977);
+        hex_data[i] = i % 251;
+    }
+
+    do {
+        if(!flipper_format_buffered_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_uint32(file, test_uint_key, uint32_data, TEST_ARRAY_SIZE)) break;
+        if(!flipper_format_write_int32(file, test_int_key, int32_data, TEST_ARRAY_SIZE)) break;
+        if(!flipper_format_write_hex(file, test_hex_key, hex_data, TEST_ARRAY_SIZE)) break;
+        if(!flipper_format_rewind(file)) break;
+
+        memset(uint32_data, 0, TEST_ARRAY_SIZE * sizeof(uint32_t));
+        memset(int32_data, 0, TEST_ARRAY_SIZE * sizeof(int32_t));
+        memset(hex_data, 0, TEST_ARRAY_SIZE);
+        if(!flipper_format_read_uint32(file, test_uint_key, uint32_data, TEST_ARRAY_SIZE)) break;
+        if(!flipper_format_read_int32(file, test_int_key, int32_data, TEST_ARRAY_SIZE)) break;
+        if(!flipper_format_read_hex(file, test_hex_key, hex_data, TEST_ARRAY_SIZE)) break;
+
+        bool error = false;
+        for(size_t i = 0; i < TEST_ARRAY_SIZE; i++) {
+            if(uint32_data[i] != i * 4000037U || hex_data[i] != i % 251 ||
+               int32_data[i] != ((i % 2) ? -(int32_t)(i * 31) : (int32_t)(i * 977))) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        // one value more than the line has
+        if(!flipper_format_rewind(file)) break;
+        uint32_t* uint32_more = malloc((TEST_ARRAY_SIZE + 1) * sizeof(uint32_t));
+        error = flipper_format_read_uint32(file, test_uint_key, uint32_more, TEST_ARRAY_SIZE + 1);
+        free(uint32_more);
+        if(error) break;
+
+        result = true;
+    } while(false);
+
+    free(hex_data);
+    free(int32_data);
+    free(uint32_data);
+
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+#define TEST_ARRAY_LINES 3U
+#define TEST_ARRAY_CHUNK 7U
+
+static bool test_array_reader(const char* file_name, FlipperFormatEncoding encoding) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc_ex(storage, encoding);
+    FlipperFormatArrayReader* reader = flipper_format_array_reader_alloc(file);
+
+    int32_t* data = malloc(TEST_ARRAY_SIZE * sizeof(int32_t));
+    int32_t chunk[TEST_ARRAY_CHUNK];
+    FuriString* string_value = furi_string_alloc();
+
+    do {
+        if(!flipper_format_buffered_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_header_cstr(file, test_filetype, test_version)) break;
+
+        bool error = false;
+        for(size_t line = 0; line < TEST_ARRAY_LINES; line++) {
+            for(size_t i = 0; i < TEST_ARRAY_SIZE; i++) {
+                data[i] = (int32_t)(line * TEST_ARRAY_SIZE + i) * ((i % 2) ? -1 : 1);
+            }
+            if(!flipper_format_write_int32(file, test_int_key, data, TEST_ARRAY_SIZE)) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+        if(!flipper_format_write_string_cstr(file, test_string_key, test_string_data)) break;
+
+        // all lines as one array
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_array_reader_start_int32(reader, test_int_key, true)) break;
+        size_t total = 0;
+        size_t count = 0;
+        do {
+            if(!flipper_format_array_reader_read_int32(
+                   reader, chunk, TEST_ARRAY_CHUNK, &count)) {
+                error = true;
+                break;
+            }
+            for(size_t i = 0; i < count; i++, total++) {
+                const size_t index = total % TEST_ARRAY_SIZE;
+                if(chunk[i] != (int32_t)total * ((index % 2) ? -1 : 1)) error = true;
+            }
+        } while(count == TEST_ARRAY_CHUNK && !error);
+        if(error || total != TEST_ARRAY_LINES * TEST_ARRAY_SIZE) break;
+
+        // reads go on after the array
+        if(!flipper_format_read_string(file, test_string_key, string_value)) break;
+        if(furi_string_cmp_str(string_value, test_string_data) != 0) break;
+
+        // single line, left in the middle
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_array_reader_start_int32(reader, test_int_key, false)) break;
+        total = 0;
+        do {
+            if(!flipper_format_array_reader_read_int32(
+                   reader, chunk, TEST_ARRAY_CHUNK, &count)) {
+                error = true;
+                break;
+            }
+            total += count;
+        } while(count == TEST_ARRAY_CHUNK);
+        if(error || total != TEST_ARRAY_SIZE) break;
+
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_array_reader_start_int32(reader, test_int_key, false)) break;
+        if(!flipper_format_array_reader_read_int32(reader, chunk, TEST_ARRAY_CHUNK, &count)) break;
+        if(!flipper_format_array_reader_start_int32(reader, test_int_key, false)) break;
+        if(!flipper_format_array_reader_read_int32(reader, chunk, 1, &count)) break;
+        if(count != 1 || chunk[0] != (int32_t)TEST_ARRAY_SIZE) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(string_value);
+    free(data);
+    flipper_format_array_reader_free(reader);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static bool test_read_indexed(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+
+    FuriString* string_value;
+    string_value = furi_string_alloc();
+    uint32_t uint32_value;
+    uint8_t uint8_value;
+
+    do {
+        if(!flipper_format_file_open_existing(file, file_name)) break;
+        if(!flipper_format_build_index(file)) break;
+        if(!flipper_format_read_header(file, string_value, &uint32_value)) break;
+
+        // forward jump over the keys in between
+        if(!flipper_format_key_exist(file, test_string_key)) break;
+        if(flipper_format_key_exist(file, "Missing key")) break;
+        if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+        if(uint8_value != test_hex_data[0]) break;
+        if(flipper_format_read_string(file, test_string_key, string_value)) break;
+
+        // strict mode stops at the next key
+        if(!flipper_format_rewind(file)) break;
+        flipper_format_set_strict_mode(file, true);
+        bool strict_read = flipper_format_read_hex(file, test_hex_key, &uint8_value, 1);
+        flipper_format_set_strict_mode(file, false);
+        if(strict_read) break;
+
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_get_value_count(file, test_uint_key, &uint32_value)) break;
+        if(uint32_value != COUNT_OF(test_uint_data)) break;
+        if(!flipper_format_read_string(file, test_string_key, string_value)) break;
+        if(furi_string_cmp_str(string_value, test_string_data) != 0) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(string_value);
+
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 MU_TEST(flipper_format_write_test) {
     mu_assert(storage_write_string(test_file_linux, test_data_nix), "Write test error [Linux]");
     mu_assert(
@@ -469,6 +688,28 @@ MU_TEST(flipper_format_read_test) {
     mu_assert(test_read(test_file_flipper), "Read test error [Flipper]");
 }
 
+MU_TEST(flipper_format_read_indexed_test) {
+    mu_assert(test_read_indexed(test_file_linux), "Indexed read test error [Linux]");
+    mu_assert(test_read_indexed(test_file_windows), "Indexed read test error [Windows]");
+    mu_assert(test_read_indexed(test_file_flipper), "Indexed read test error [Flipper]");
+}
+
+MU_TEST(flipper_format_binary_test) {
+    mu_assert(
+        test_convert(test_file_linux, test_file_binary, true), "Convert to binary test error");
+    mu_assert(test_read(test_file_binary), "Read test error [Binary]");
+    mu_assert(test_read_indexed(test_file_binary), "Indexed read test error [Binary]");
+    mu_assert(
+        test_convert(test_file_binary, test_file_binary_text, false),
+        "Convert to text test error");
+    mu_assert(test_read(test_file_binary_text), "Read test error [Binary to text]");
+
+    mu_assert(test_update(test_file_binary), "Cannot update data [Binary]");
+    mu_assert(test_read_updated(test_file_binary), "Data updated incorrectly [Binary]");
+    mu_assert(test_update_backward(test_file_binary), "Cannot update data back [Binary]");
+    mu_assert(test_read(test_file_binary), "Data updated back incorrectly [Binary]");
+}
+
 MU_TEST(flipper_format_delete_test) {
     mu_assert(test_delete_last_key(test_file_linux), "Cannot delete key [Linux]");
     mu_assert(test_delete_last_key(test_file_windows), "Cannot delete key [Windows]");
@@ -522,6 +763,19 @@ MU_TEST(flipper_format_multikey_test) {
     mu_assert(test_read_multikey(TEST_DIR "ff_multiline.test"), "Multikey read test error");
 }
 
+MU_TEST(flipper_format_array_test) {
+    mu_assert(test_write_read_array(TEST_DIR "ff_array.test"), "Array test error");
+}
+
+MU_TEST(flipper_format_array_reader_test) {
+    mu_assert(
+        test_array_reader(TEST_DIR "ff_array_reader.test", FlipperFormatEncodingText),
+        "Array reader test error [Text]");
+    mu_assert(
+        test_array_reader(TEST_DIR "ff_array_reader_bin.test", FlipperFormatEncodingBinary),
+        "Array reader test error [Binary]");
+}
+
 MU_TEST(flipper_format_oddities_test) {
     mu_assert(
         storage_write_string(test_file_oddities, test_data_odd), "Write test error [Oddities]");
@@ -532,6 +786,8 @@ MU_TEST_SUITE(flipper_format) {
     tests_setup();
     MU_RUN_TEST(flipper_format_write_test);
     MU_RUN_TEST(flipper_format_read_test);
+    MU_RUN_TEST(flipper_format_read_indexed_test);
+    MU_RUN_TEST(flipper_format_binary_test);
     MU_RUN_TEST(flipper_format_delete_test);
     MU_RUN_TEST(flipper_format_delete_result_test);
     MU_RUN_TEST(flipper_format_append_test);
@@ -541,6 +797,8 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_test);
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
+    MU_RUN_TEST(flipper_format_array_test);
+    MU_RUN_TEST(flipper_format_array_reader_test);
     MU_RUN_TEST(flipper_format_oddities_test);
     tests_teardown();
 }
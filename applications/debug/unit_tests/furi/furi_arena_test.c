@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include "../minunit.h"
+
+#define ARENA_TEST_CHUNK_SIZE 64
+#define ARENA_TEST_OBJECTS 100
+
+void test_furi_arena() {
+    FuriArena* arena = furi_arena_alloc(ARENA_TEST_CHUNK_SIZE);
+    mu_assert_pointers_not_eq(arena, NULL);
+    mu_assert_int_eq(0, furi_arena_get_used(arena));
+
+    // objects are aligned, zeroed and don't overlap
+    uint8_t* objects[ARENA_TEST_OBJECTS];
+    for(size_t i = 0; i < ARENA_TEST_OBJECTS; i++) {
+        const size_t size = i % 13 + 1;
+        objects[i] = furi_arena_malloc(arena, size);
+        mu_assert_int_eq(0, (uintptr_t)objects[i] % 8);
+        for(size_t j = 0; j < size; j++) {
+            mu_assert_int_eq(0, objects[i][j]);
+        }
+        memset(objects[i], i, size);
+    }
+    for(size_t i = 0; i < ARENA_TEST_OBJECTS; i++) {
+        const size_t size = i % 13 + 1;
+        for(size_t j = 0; j < size; j++) {
+            mu_assert_int_eq(i, objects[i][j]);
+        }
+    }
+
+    // large object gets its own chunk
+    uint8_t* large = furi_arena_malloc(arena, ARENA_TEST_CHUNK_SIZE * 4);
+    memset(large, 0xAA, ARENA_TEST_CHUNK_SIZE * 4);
+    uint8_t* small = furi_arena_malloc(arena, 1);
+    mu_check(small < large || small >= large + ARENA_TEST_CHUNK_SIZE * 4);
+
+    // strings
+    mu_assert_string_eq("arena", furi_arena_strdup(arena, "arena"));
+    mu_assert_string_eq("key 12 ab", furi_arena_printf(arena, "key %d %s", 12, "ab"));
+    mu_check(furi_arena_get_used(arena) > ARENA_TEST_CHUNK_SIZE * 4);
+
+    // reset keeps memory usable
+    furi_arena_reset(arena);
+    mu_assert_int_eq(0, furi_arena_get_used(arena));
+    uint8_t* object = furi_arena_malloc(arena, ARENA_TEST_CHUNK_SIZE);
+    for(size_t j = 0; j < ARENA_TEST_CHUNK_SIZE; j++) {
+        mu_assert_int_eq(0, object[j]);
+    }
+
+    furi_arena_free(arena);
+}
@@ -1,3 +1,4 @@
+#include <furi.h>
 #include "../minunit.h"
 #include <stdlib.h>
 #include <string.h>
@@ -36,3 +37,30 @@ void test_furi_memmgr() {
     }
     free(ptr);
 }
+
+void test_furi_memmgr_transient() {
+    MemmgrPoolStats before;
+    memmgr_pool_get_stats(&before);
+
+    // transient buffer is zeroed and aligned, wherever it comes from
+    uint8_t* ptr = memmgr_alloc_transient(1000);
+    mu_check(ptr != NULL);
+    mu_assert_int_eq(0, (uintptr_t)ptr % 8);
+    for(int i = 0; i < 1000; i++) {
+        mu_assert_int_eq(0, ptr[i]);
+    }
+    memset(ptr, 66, 1000);
+
+    MemmgrPoolStats during;
+    memmgr_pool_get_stats(&during);
+    mu_assert_int_eq(before.transient_allocs + 1, during.transient_allocs);
+    mu_check(during.transient_peak >= during.transient_used);
+
+    // pool doesn't lose space on free
+    free(ptr);
+
+    MemmgrPoolStats after;
+    memmgr_pool_get_stats(&after);
+    mu_assert_int_eq(before.transient_used, after.transient_used);
+    mu_assert_int_eq(before.free, after.free);
+}
@@ -0,0 +1,55 @@
+#include <furi.h>
+#include "../minunit.h"
+
+#define MESSAGE_QUEUE_TEST_COUNT 4
+#define MESSAGE_QUEUE_TEST_URGENT_COUNT 2
+
+void test_furi_message_queue_priority() {
+    FuriMessageQueue* queue = furi_message_queue_alloc_ex(
+        MESSAGE_QUEUE_TEST_COUNT, MESSAGE_QUEUE_TEST_URGENT_COUNT, sizeof(uint32_t));
+    mu_assert_pointers_not_eq(queue, NULL);
+    mu_assert_int_eq(
+        MESSAGE_QUEUE_TEST_COUNT + MESSAGE_QUEUE_TEST_URGENT_COUNT,
+        furi_message_queue_get_capacity(queue));
+    mu_assert_int_eq(sizeof(uint32_t), furi_message_queue_get_message_size(queue));
+
+    uint32_t buffer[MESSAGE_QUEUE_TEST_COUNT + MESSAGE_QUEUE_TEST_URGENT_COUNT];
+
+    // empty queue case
+    mu_assert_int_eq(0, furi_message_queue_get_count(queue));
+    mu_assert_int_eq(FuriStatusErrorResource, furi_message_queue_get(queue, buffer, 0));
+    mu_assert_int_eq(FuriStatusErrorTimeout, furi_message_queue_get(queue, buffer, 1));
+    mu_assert_int_eq(0, furi_message_queue_get_many(queue, buffer, COUNT_OF(buffer), 0));
+
+    // fill both lanes, urgent ones are received first
+    for(uint32_t value = 0; value < MESSAGE_QUEUE_TEST_COUNT; value++) {
+        mu_assert_int_eq(FuriStatusOk, furi_message_queue_put(queue, &value, 0));
+    }
+    uint32_t value = 100;
+    mu_assert_int_eq(FuriStatusErrorResource, furi_message_queue_put(queue, &value, 0));
+    for(value = 100; value < 100 + MESSAGE_QUEUE_TEST_URGENT_COUNT; value++) {
+        mu_assert_int_eq(FuriStatusOk, furi_message_queue_put_urgent(queue, &value, 0));
+    }
+    mu_assert_int_eq(FuriStatusErrorResource, furi_message_queue_put_urgent(queue, &value, 0));
+    mu_assert_int_eq(COUNT_OF(buffer), furi_message_queue_get_count(queue));
+
+    // batched receive case
+    mu_assert_int_eq(3, furi_message_queue_get_many(queue, buffer, 3, 0));
+    mu_assert_int_eq(100, buffer[0]);
+    mu_assert_int_eq(101, buffer[1]);
+    mu_assert_int_eq(0, buffer[2]);
+    mu_assert_int_eq(3, furi_message_queue_get_many(queue, buffer, COUNT_OF(buffer), 0));
+    mu_assert_int_eq(1, buffer[0]);
+    mu_assert_int_eq(3, buffer[2]);
+    mu_assert_int_eq(0, furi_message_queue_get_count(queue));
+
+    // reset case
+    value = 1;
+    mu_assert_int_eq(FuriStatusOk, furi_message_queue_put(queue, &value, 0));
+    mu_assert_int_eq(FuriStatusOk, furi_message_queue_put_urgent(queue, &value, 0));
+    mu_assert_int_eq(FuriStatusOk, furi_message_queue_reset(queue));
+    mu_assert_int_eq(0, furi_message_queue_get_count(queue));
+    mu_assert_int_eq(FuriStatusErrorResource, furi_message_queue_get(queue, buffer, 0));
+
+    furi_message_queue_free(queue);
+}
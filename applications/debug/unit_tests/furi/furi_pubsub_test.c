@@ -43,3 +43,66 @@ void test_furi_pubsub() {
     // delete pubsub case
     furi_pubsub_free(test_pubsub);
 }
+
+void test_furi_pubsub_topics() {
+    FuriPubSub* test_pubsub = furi_pubsub_alloc();
+    FuriPubSubSubscription* test_pubsub_subscription =
+        furi_pubsub_subscribe(test_pubsub, test_pubsub_handler, (void*)&context_value);
+
+    furi_pubsub_subscription_set_topics(
+        test_pubsub, test_pubsub_subscription, FURI_PUBSUB_TOPIC(1) | FURI_PUBSUB_TOPIC(3));
+
+    // filtered topic case
+    pubsub_value = 0;
+    furi_pubsub_publish_topic(test_pubsub, FURI_PUBSUB_TOPIC(2), (void*)&notify_value_0);
+    mu_assert_int_eq(0, pubsub_value);
+
+    // matching topic case
+    furi_pubsub_publish_topic(test_pubsub, FURI_PUBSUB_TOPIC(3), (void*)&notify_value_0);
+    mu_assert_int_eq(notify_value_0, pubsub_value);
+
+    // untagged publish case
+    furi_pubsub_publish(test_pubsub, (void*)&notify_value_1);
+    mu_assert_int_eq(notify_value_1, pubsub_value);
+
+    furi_pubsub_unsubscribe(test_pubsub, test_pubsub_subscription);
+    furi_pubsub_free(test_pubsub);
+}
+
+void test_furi_pubsub_deferred() {
+    FuriPubSub* test_pubsub = furi_pubsub_alloc();
+    FuriThreadId thread_id = furi_thread_get_current_id();
+    furi_thread_flags_clear(1);
+    FuriPubSubSubscription* test_pubsub_subscription = furi_pubsub_subscribe_deferred(
+        test_pubsub,
+        test_pubsub_handler,
+        (void*)&context_value,
+        sizeof(uint32_t),
+        2,
+        thread_id,
+        1);
+    mu_assert_pointers_not_eq(test_pubsub_subscription, NULL);
+
+    // callback is not called on publish case
+    pubsub_value = 0;
+    uint32_t value = notify_value_0;
+    furi_pubsub_publish(test_pubsub, &value);
+    value = notify_value_1;
+    furi_pubsub_publish(test_pubsub, &value);
+    mu_assert_int_eq(0, pubsub_value);
+    mu_assert_int_eq(1, furi_thread_flags_get() & 1);
+
+    // dispatch on subscriber thread case, message is copied
+    value = 0;
+    mu_assert_int_eq(2, furi_pubsub_subscription_dispatch(test_pubsub_subscription));
+    mu_assert_int_eq(notify_value_1, pubsub_value);
+    mu_assert_int_eq(context_value, pubsub_context_value);
+    mu_assert_int_eq(0, furi_pubsub_subscription_dispatch(test_pubsub_subscription));
+    furi_thread_flags_clear(1);
+
+    // unsubscribe with queued message case
+    furi_pubsub_publish(test_pubsub, &value);
+    furi_pubsub_unsubscribe(test_pubsub, test_pubsub_subscription);
+    furi_thread_flags_clear(1);
+    furi_pubsub_free(test_pubsub);
+}
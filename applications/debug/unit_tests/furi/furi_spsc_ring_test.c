@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include "../minunit.h"
+
+#define SPSC_RING_TEST_CAPACITY 8
+#define SPSC_RING_TEST_RECORDS 1000
+
+static int32_t test_spsc_ring_producer(void* context) {
+    FuriSpscRing* ring = context;
+
+    for(uint32_t value = 0; value < SPSC_RING_TEST_RECORDS;) {
+        if(furi_spsc_ring_push(ring, &value)) {
+            value++;
+        } else {
+            furi_delay_tick(1);
+        }
+    }
+
+    return 0;
+}
+
+void test_furi_spsc_ring() {
+    FuriSpscRing* ring = furi_spsc_ring_alloc(sizeof(uint32_t), SPSC_RING_TEST_CAPACITY);
+    mu_assert_pointers_not_eq(ring, NULL);
+
+    uint32_t buffer[SPSC_RING_TEST_CAPACITY + 1];
+
+    // empty ring case
+    mu_assert_int_eq(0, furi_spsc_ring_get_count(ring));
+    mu_assert_int_eq(0, furi_spsc_ring_pop(ring, buffer, COUNT_OF(buffer), 0));
+
+    // fill ring case
+    for(uint32_t value = 0; value < SPSC_RING_TEST_CAPACITY; value++) {
+        mu_check(furi_spsc_ring_push(ring, &value));
+    }
+    uint32_t value = SPSC_RING_TEST_CAPACITY;
+    mu_check(!furi_spsc_ring_push(ring, &value));
+    mu_assert_int_eq(SPSC_RING_TEST_CAPACITY, furi_spsc_ring_get_count(ring));
+
+    // partial pop and wrap around case
+    mu_assert_int_eq(3, furi_spsc_ring_pop(ring, buffer, 3, 0));
+    mu_assert_int_eq(0, buffer[0]);
+    mu_assert_int_eq(2, buffer[2]);
+    for(value = SPSC_RING_TEST_CAPACITY; value < SPSC_RING_TEST_CAPACITY + 3; value++) {
+        mu_check(furi_spsc_ring_push(ring, &value));
+    }
+    mu_assert_int_eq(
+        SPSC_RING_TEST_CAPACITY, furi_spsc_ring_pop(ring, buffer, COUNT_OF(buffer), 0));
+    for(size_t i = 0; i < SPSC_RING_TEST_CAPACITY; i++) {
+        mu_assert_int_eq(i + 3, buffer[i]);
+    }
+
+    // reset case
+    mu_check(furi_spsc_ring_push(ring, &value));
+    furi_spsc_ring_reset(ring);
+    mu_assert_int_eq(0, furi_spsc_ring_get_count(ring));
+
+    // concurrent producer case
+    FuriThread* producer =
+        furi_thread_alloc_ex("SpscRingProducer", 1024, test_spsc_ring_producer, ring);
+    furi_thread_start(producer);
+
+    uint32_t expected = 0;
+    bool in_order = true;
+    while(expected < SPSC_RING_TEST_RECORDS) {
+        size_t count = furi_spsc_ring_pop(ring, buffer, COUNT_OF(buffer), 100);
+        mu_check(count > 0);
+        for(size_t i = 0; i < count; i++) {
+            if(buffer[i] != expected) in_order = false;
+            expected++;
+        }
+    }
+    mu_check(in_order);
+
+    furi_thread_join(producer);
+    furi_thread_free(producer);
+
+    furi_spsc_ring_free(ring);
+}
@@ -445,6 +445,37 @@ MU_TEST(mu_test_furi_string_utf8) {
     furi_string_free(utf8_string);
 }
 
+MU_TEST(mu_test_furi_string_inline) {
+    const char* short_str = "0123456789abcdefghijklm";
+    const char* long_str = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    // test growing from inline storage to heap
+    FuriString* string = furi_string_alloc_set(short_str);
+    mu_assert_string_eq(short_str, furi_string_get_cstr(string));
+    for(size_t i = strlen(short_str); i < strlen(long_str); i++) {
+        furi_string_push_back(string, long_str[i]);
+        mu_assert_int_eq(i + 1, furi_string_size(string));
+    }
+    mu_assert_string_eq(long_str, furi_string_get_cstr(string));
+
+    // test shrinking back to inline storage
+    furi_string_left(string, 4);
+    furi_string_reserve(string, 0);
+    mu_assert_string_eq("0123", furi_string_get_cstr(string));
+
+    // test cat and swap of inline and heap strings
+    FuriString* other = furi_string_alloc_set(long_str);
+    furi_string_cat(string, string);
+    mu_assert_string_eq("01230123", furi_string_get_cstr(string));
+    furi_string_swap(string, other);
+    mu_assert_string_eq(long_str, furi_string_get_cstr(string));
+    mu_assert_string_eq("01230123", furi_string_get_cstr(other));
+    furi_string_move(string, other);
+    mu_assert_string_eq("01230123", furi_string_get_cstr(string));
+
+    furi_string_free(string);
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -460,6 +491,7 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_string_start_end);
     MU_RUN_TEST(mu_test_furi_string_trim);
     MU_RUN_TEST(mu_test_furi_string_utf8);
+    MU_RUN_TEST(mu_test_furi_string_inline);
 }
 
 int run_minunit_test_furi_string() {
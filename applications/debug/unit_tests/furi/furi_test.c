@@ -7,8 +7,16 @@
 void test_furi_create_open();
 void test_furi_concurrent_access();
 void test_furi_pubsub();
+void test_furi_pubsub_topics();
+void test_furi_pubsub_deferred();
+void test_furi_spsc_ring();
+void test_furi_arena();
+void test_furi_message_queue_priority();
+void test_furi_thread_stats();
+void test_furi_work_queue();
 
 void test_furi_memmgr();
+void test_furi_memmgr_transient();
 
 static int foo = 0;
 
@@ -33,12 +41,44 @@ MU_TEST(mu_test_furi_pubsub) {
     test_furi_pubsub();
 }
 
+MU_TEST(mu_test_furi_pubsub_topics) {
+    test_furi_pubsub_topics();
+}
+
+MU_TEST(mu_test_furi_pubsub_deferred) {
+    test_furi_pubsub_deferred();
+}
+
+MU_TEST(mu_test_furi_spsc_ring) {
+    test_furi_spsc_ring();
+}
+
+MU_TEST(mu_test_furi_arena) {
+    test_furi_arena();
+}
+
+MU_TEST(mu_test_furi_message_queue_priority) {
+    test_furi_message_queue_priority();
+}
+
+MU_TEST(mu_test_furi_thread_stats) {
+    test_furi_thread_stats();
+}
+
+MU_TEST(mu_test_furi_work_queue) {
+    test_furi_work_queue();
+}
+
 MU_TEST(mu_test_furi_memmgr) {
     // this test is not accurate, but gives a basic understanding
     // that memory management is working fine
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_transient) {
+    test_furi_memmgr_transient();
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -47,7 +87,15 @@ MU_TEST_SUITE(test_suite) {
     // v2 tests
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
+    MU_RUN_TEST(mu_test_furi_pubsub_topics);
+    MU_RUN_TEST(mu_test_furi_pubsub_deferred);
+    MU_RUN_TEST(mu_test_furi_spsc_ring);
+    MU_RUN_TEST(mu_test_furi_arena);
+    MU_RUN_TEST(mu_test_furi_message_queue_priority);
+    MU_RUN_TEST(mu_test_furi_thread_stats);
+    MU_RUN_TEST(mu_test_furi_work_queue);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_transient);
 }
 
 int run_minunit_test_furi() {
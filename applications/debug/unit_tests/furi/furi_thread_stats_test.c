@@ -0,0 +1,46 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+
+#define THREAD_STATS_TEST_THREADS_MAX 32
+
+void test_furi_thread_stats() {
+    bool was_enabled = furi_thread_stats_is_enabled();
+    furi_thread_stats_set_enabled(true);
+    mu_check(furi_thread_stats_is_enabled());
+
+    // busy wait is accounted to this thread, sleep is not
+    furi_delay_us(10000);
+    furi_delay_ms(10);
+
+    FuriThreadStats* stats = malloc(sizeof(FuriThreadStats) * THREAD_STATS_TEST_THREADS_MAX);
+    FuriThreadStatsTotal total;
+    size_t count = furi_thread_stats_get(stats, THREAD_STATS_TEST_THREADS_MAX, &total);
+    mu_check(count > 0);
+    mu_check(total.switches > 0);
+
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    mu_check(total.window >= 19000ULL * cycles_per_us);
+
+    FuriThreadId thread_id = furi_thread_get_current_id();
+    const FuriThreadStats* current = NULL;
+    for(size_t i = 0; i < count; i++) {
+        if(stats[i].thread_id == thread_id) current = &stats[i];
+    }
+    mu_assert_pointers_not_eq(current, NULL);
+    mu_check(current->runtime >= 9000ULL * cycles_per_us);
+    mu_check(current->runtime < total.window);
+    mu_check(current->switches > 0);
+
+    // reset case
+    furi_thread_stats_reset();
+    count = furi_thread_stats_get(stats, THREAD_STATS_TEST_THREADS_MAX, &total);
+    for(size_t i = 0; i < count; i++) {
+        if(stats[i].thread_id == thread_id) {
+            mu_check(stats[i].runtime < 1000ULL * cycles_per_us);
+        }
+    }
+
+    free(stats);
+    furi_thread_stats_set_enabled(was_enabled);
+}
@@ -0,0 +1,99 @@
+#include <furi.h>
+#include "../minunit.h"
+
+#define WORK_QUEUE_TEST_COUNT 4
+
+typedef struct {
+    FuriSemaphore* gate;
+    uint32_t runs;
+    uint32_t completes;
+    uint32_t cancels;
+    uint32_t resubmits;
+    FuriWork* work;
+} WorkQueueTestContext;
+
+static void work_queue_test_job(void* context) {
+    WorkQueueTestContext* test = context;
+    test->runs++;
+}
+
+static void work_queue_test_blocker(void* context) {
+    WorkQueueTestContext* test = context;
+    furi_check(furi_semaphore_acquire(test->gate, FuriWaitForever) == FuriStatusOk);
+}
+
+static void work_queue_test_complete(bool cancelled, void* context) {
+    WorkQueueTestContext* test = context;
+    test->completes++;
+    if(cancelled) test->cancels++;
+}
+
+static void work_queue_test_resubmit(bool cancelled, void* context) {
+    UNUSED(cancelled);
+    WorkQueueTestContext* test = context;
+    if(test->resubmits) {
+        test->resubmits--;
+        furi_work_submit(test->work, FuriWorkQueuePriorityNormal);
+    }
+}
+
+void test_furi_work_queue() {
+    WorkQueueTestContext test = {0};
+    test.gate = furi_semaphore_alloc(1, 0);
+
+    FuriWork* works[WORK_QUEUE_TEST_COUNT];
+    for(size_t i = 0; i < WORK_QUEUE_TEST_COUNT; i++) {
+        works[i] = furi_work_alloc(work_queue_test_job, &test);
+        mu_assert_pointers_not_eq(works[i], NULL);
+        furi_work_set_complete_callback(works[i], work_queue_test_complete, &test);
+        mu_assert(!furi_work_is_busy(works[i]), "new work is busy");
+        mu_assert(furi_work_wait(works[i], 0), "new work is not done");
+    }
+
+    // run case
+    for(size_t i = 0; i < WORK_QUEUE_TEST_COUNT; i++) {
+        furi_work_submit(works[i], (FuriWorkQueuePriority)(i % FuriWorkQueuePriorityCount));
+    }
+    for(size_t i = 0; i < WORK_QUEUE_TEST_COUNT; i++) {
+        mu_assert(furi_work_wait(works[i], 1000), "work is not done");
+    }
+    mu_assert_int_eq(WORK_QUEUE_TEST_COUNT, test.runs);
+    mu_assert_int_eq(WORK_QUEUE_TEST_COUNT, test.completes);
+    mu_assert_int_eq(0, test.cancels);
+
+    // cancel case, jobs queued behind the blocker never run
+    FuriWork* blocker = furi_work_alloc(work_queue_test_blocker, &test);
+    furi_work_submit(blocker, FuriWorkQueuePriorityLow);
+    furi_work_submit(works[0], FuriWorkQueuePriorityLow);
+    furi_work_submit(works[1], FuriWorkQueuePriorityLow);
+    mu_assert(furi_work_is_busy(works[0]), "queued work is not busy");
+    mu_assert(furi_work_cancel(works[0]), "queued work is not removed");
+    mu_assert(!furi_work_is_busy(works[0]), "cancelled work is busy");
+    mu_assert_int_eq(1, test.cancels);
+    mu_assert(!furi_work_wait(works[1], 10), "work ran behind the blocker");
+    mu_assert(!furi_work_cancel(blocker), "running work is removed");
+    mu_assert(furi_work_is_cancelled(blocker), "running work is not marked");
+    furi_semaphore_release(test.gate);
+    mu_assert(furi_work_wait(blocker, 1000), "blocker is not done");
+    mu_assert(furi_work_wait(works[1], 1000), "work is not done");
+    mu_assert_int_eq(WORK_QUEUE_TEST_COUNT + 1, test.runs);
+    furi_work_free(blocker);
+
+    // resubmit from completion case
+    test.work = furi_work_alloc(work_queue_test_job, &test);
+    furi_work_set_complete_callback(test.work, work_queue_test_resubmit, &test);
+    test.runs = 0;
+    test.resubmits = 2;
+    furi_work_submit(test.work, FuriWorkQueuePriorityNormal);
+    while(test.resubmits) {
+        furi_delay_tick(1);
+    }
+    mu_assert(furi_work_wait(test.work, 1000), "resubmitted work is not done");
+    mu_assert_int_eq(3, test.runs);
+    furi_work_free(test.work);
+
+    for(size_t i = 0; i < WORK_QUEUE_TEST_COUNT; i++) {
+        furi_work_free(works[i]);
+    }
+    furi_semaphore_free(test.gate);
+}
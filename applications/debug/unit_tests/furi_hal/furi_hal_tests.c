@@ -116,6 +116,57 @@ MU_TEST(furi_hal_i2c_int_1b_fail) {
     mu_assert(data_one != 0, "9 invalid data");
 }
 
+static void furi_hal_i2c_int_queue_callback(FuriHalI2cTransaction* transaction, void* context) {
+    UNUSED(transaction);
+    size_t* completed = context;
+    (*completed)++;
+}
+
+MU_TEST(furi_hal_i2c_int_queue) {
+    size_t completed = 0;
+    uint8_t reg = LP5562_CHANNEL_BLUE_CURRENT_REGISTER;
+    uint8_t data_one = 0;
+    uint8_t data_fail = 0;
+
+    // read, fail, read: failed transaction doesn't affect the rest of queue
+    FuriHalI2cTransaction transactions[3] = {
+        {
+            .address = LP5562_ADDRESS,
+            .tx_data = &reg,
+            .tx_size = 1,
+            .rx_data = &data_one,
+            .rx_size = 1,
+        },
+        {
+            .address = LP5562_ADDRESS + 0x10,
+            .tx_data = &reg,
+            .tx_size = 1,
+            .rx_data = &data_fail,
+            .rx_size = 1,
+        },
+        {
+            .address = LP5562_ADDRESS,
+            .tx_data = &reg,
+            .tx_size = 1,
+        },
+    };
+    for(size_t i = 0; i < COUNT_OF(transactions); i++) {
+        transactions[i].callback = furi_hal_i2c_int_queue_callback;
+        transactions[i].context = &completed;
+        furi_hal_i2c_transaction_submit(&furi_hal_i2c_handle_power, &transactions[i]);
+    }
+
+    mu_assert(
+        furi_hal_i2c_transaction_flush(&furi_hal_i2c_handle_power, LP5562_I2C_TIMEOUT * 6),
+        "10 flush failed");
+    mu_assert(completed == COUNT_OF(transactions), "10 not all callbacks called");
+    mu_assert(transactions[0].result, "10 read failed");
+    mu_assert(data_one != 0, "10 invalid data");
+    mu_assert(!transactions[1].result, "11 read from wrong address succeeded");
+    mu_assert(data_fail == 0, "11 invalid data");
+    mu_assert(transactions[2].result, "12 write failed");
+}
+
 MU_TEST(furi_hal_i2c_int_ext_3b) {
     bool ret = false;
     uint8_t data_many[DATA_SIZE] = {0};
@@ -217,6 +268,7 @@ MU_TEST_SUITE(furi_hal_i2c_int_suite) {
     MU_RUN_TEST(furi_hal_i2c_int_3b);
     MU_RUN_TEST(furi_hal_i2c_int_ext_3b);
     MU_RUN_TEST(furi_hal_i2c_int_1b_fail);
+    MU_RUN_TEST(furi_hal_i2c_int_queue);
 }
 
 MU_TEST_SUITE(furi_hal_i2c_ext_suite) {
@@ -0,0 +1,170 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+#include <toolbox/protocols/protocol_dict.h>
+#include <lfrfid/protocols/lfrfid_protocols.h>
+#include <toolbox/pulse_protocols/pulse_glue.h>
+
+#define TAG "LfRfidBenchmark"
+#define LF_RFID_READ_TIMING_MULTIPLIER 8
+// Enough for a few frames of the longest protocol
+#define BENCHMARK_MAX_PULSES 2048
+
+typedef struct {
+    uint32_t length;
+    uint32_t period;
+} LfRfidBenchmarkPulse;
+
+typedef struct {
+    // Encoder and decoders share protocol instance data, so they can't live in one dict
+    ProtocolDict* encoder_dict;
+    ProtocolDict* decoder_dict;
+    LfRfidBenchmarkPulse* pulses;
+    uint8_t* data;
+
+    size_t pulses_total;
+    uint64_t cycles_total;
+} LfRfidBenchmark;
+
+static LfRfidBenchmark benchmark;
+
+/** Emulate protocol with test data and glue its output to read pulses
+ *
+ * @param protocol protocol index
+ * @return pulses count, 0 if protocol can't be emulated
+ */
+static size_t lfrfid_benchmark_encode(ProtocolId protocol) {
+    size_t data_size = protocol_dict_get_data_size(benchmark.encoder_dict, protocol);
+    for(size_t i = 0; i < data_size; i++) {
+        benchmark.data[i] = 0x5A ^ (i * 0x11);
+    }
+    protocol_dict_set_data(benchmark.encoder_dict, protocol, benchmark.data, data_size);
+
+    if(!protocol_dict_encoder_start(benchmark.encoder_dict, protocol)) return 0;
+
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    size_t count = 0;
+
+    // Upper bound of yields, in case encoder never produces an edge
+    for(size_t i = 0; i < BENCHMARK_MAX_PULSES * 64 && count < BENCHMARK_MAX_PULSES; i++) {
+        LevelDuration level_duration =
+            protocol_dict_encoder_yield(benchmark.encoder_dict, protocol);
+        if(level_duration_is_reset(level_duration)) break;
+
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            level_duration_get_level(level_duration),
+            level_duration_get_duration(level_duration) * LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            LfRfidBenchmarkPulse* pulse = &benchmark.pulses[count++];
+            pulse_glue_pop(pulse_glue, &pulse->length, &pulse->period);
+        }
+    }
+
+    pulse_glue_free(pulse_glue);
+    return count;
+}
+
+static void lfrfid_benchmark_run_protocol(ProtocolId protocol) {
+    const char* name = protocol_dict_get_name(benchmark.decoder_dict, protocol);
+    size_t count = lfrfid_benchmark_encode(protocol);
+    if(!count) {
+        printf("  %-16s can't be emulated\r\n", name);
+        return;
+    }
+
+    protocol_dict_decoders_start(benchmark.decoder_dict);
+
+    size_t first_decode_pulse = 0;
+    uint32_t first_decode_time = 0;
+    uint32_t signal_time = 0;
+    size_t decoded = 0;
+    ProtocolId wrong_protocol = PROTOCOL_NO;
+
+    uint32_t start = DWT->CYCCNT;
+    for(size_t i = 0; i < count; i++) {
+        const LfRfidBenchmarkPulse* pulse = &benchmark.pulses[i];
+        ProtocolId result =
+            protocol_dict_decoders_feed(benchmark.decoder_dict, true, pulse->period);
+        if(result == PROTOCOL_NO) {
+            result = protocol_dict_decoders_feed(
+                benchmark.decoder_dict, false, pulse->length - pulse->period);
+        }
+        signal_time += pulse->length;
+
+        if(result == protocol) {
+            if(!decoded) {
+                first_decode_pulse = i + 1;
+                first_decode_time = signal_time;
+            }
+            decoded++;
+        } else if(result != PROTOCOL_NO) {
+            wrong_protocol = result;
+        }
+    }
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    benchmark.pulses_total += count;
+    benchmark.cycles_total += cycles;
+
+    // A pulse is a high and a low level, so up to two feeds of every decoder
+    printf("  %-16s %4lu cycles/pulse", name, cycles / count);
+    if(decoded) {
+        printf(
+            ", first decode after %4zu pulses %6lu us, %3zu decoded",
+            first_decode_pulse,
+            first_decode_time,
+            decoded);
+    } else {
+        printf(", not decoded");
+    }
+    if(wrong_protocol != PROTOCOL_NO) {
+        printf(
+            ", also decoded as %s",
+            protocol_dict_get_name(benchmark.decoder_dict, wrong_protocol));
+    }
+    printf("\r\n");
+}
+
+MU_TEST(lfrfid_benchmark_decode_test) {
+    printf("LfRfid decoders, %d protocols active:\r\n", LFRFIDProtocolMax);
+
+    for(ProtocolId protocol = 0; protocol < LFRFIDProtocolMax; protocol++) {
+        lfrfid_benchmark_run_protocol(protocol);
+    }
+
+    mu_assert(benchmark.pulses_total, "No protocol can be emulated\r\n");
+
+    printf(
+        "LfRfid decoders: %zu pulses, %lu cycles/pulse average\r\n",
+        benchmark.pulses_total,
+        (uint32_t)(benchmark.cycles_total / benchmark.pulses_total));
+}
+
+static void lfrfid_benchmark_init(void) {
+    memset(&benchmark, 0, sizeof(LfRfidBenchmark));
+
+    benchmark.encoder_dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    benchmark.decoder_dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    benchmark.pulses = malloc(sizeof(LfRfidBenchmarkPulse) * BENCHMARK_MAX_PULSES);
+    benchmark.data = malloc(protocol_dict_get_max_data_size(benchmark.encoder_dict));
+}
+
+static void lfrfid_benchmark_deinit(void) {
+    free(benchmark.data);
+    free(benchmark.pulses);
+    protocol_dict_free(benchmark.decoder_dict);
+    protocol_dict_free(benchmark.encoder_dict);
+}
+
+MU_TEST_SUITE(lfrfid_benchmark) {
+    lfrfid_benchmark_init();
+    MU_RUN_TEST(lfrfid_benchmark_decode_test);
+    lfrfid_benchmark_deinit();
+}
+
+int run_minunit_test_lfrfid_benchmark() {
+    MU_RUN_SUITE(lfrfid_benchmark);
+    return MU_EXIT_CODE;
+}
@@ -21,6 +21,7 @@
 
 #define NFC_TEST_NFC_DEV_PATH EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
+#define NFC_APP_MF_CLASSIC_DICT_PACKED_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.bin")
 
 typedef struct {
     Storage* storage;
@@ -479,6 +480,21 @@ MU_TEST(mf_classic_dict_test) {
         key_idx++;
     }
 
+    MfClassicKey key_absent = {};
+    do {
+        furi_hal_random_fill_buf(key_absent.data, sizeof(MfClassicKey));
+    } while(nfc_dict_is_key_present(dict, key_absent.data, sizeof(MfClassicKey)));
+    mu_assert(
+        !nfc_dict_delete_key(dict, key_absent.data, sizeof(MfClassicKey)),
+        "nfc_dict_delete_key() deleted absent key");
+    mu_assert(nfc_dict_add_key(dict, key_absent.data, sizeof(MfClassicKey)), "add key failed");
+    mu_assert(
+        nfc_dict_is_key_present(dict, key_absent.data, sizeof(MfClassicKey)),
+        "nfc_dict_is_key_present() missed added key");
+    mu_assert(
+        nfc_dict_delete_key(dict, key_absent.data, sizeof(MfClassicKey)),
+        "nfc_dict_delete_key() failed");
+
     uint32_t delete_keys_idx[] = {1, 3, 9, 11, 19, 27};
 
     for(size_t i = 0; i < COUNT_OF(delete_keys_idx); i++) {
@@ -504,6 +520,81 @@ MU_TEST(mf_classic_dict_test) {
         "Remove test dict failed");
 }
 
+MU_TEST(mf_classic_dict_packed_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH);
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_PACKED_UNIT_TEST_PATH);
+
+    // More keys than one read chunk
+    const uint32_t test_key_num = 100;
+    MfClassicKey* key_arr_ref = malloc(test_key_num * sizeof(MfClassicKey));
+    NfcDict* dict = nfc_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, NfcDictModeOpenAlways, sizeof(MfClassicKey));
+    mu_assert(dict != NULL, "nfc_dict_alloc() failed");
+    for(size_t i = 0; i < test_key_num; i++) {
+        furi_hal_random_fill_buf(key_arr_ref[i].data, sizeof(MfClassicKey));
+        mu_assert(
+            nfc_dict_add_key(dict, key_arr_ref[i].data, sizeof(MfClassicKey)), "add key failed");
+    }
+    nfc_dict_free(dict);
+
+    mu_assert(
+        nfc_dict_update_packed(
+            NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH,
+            NFC_APP_MF_CLASSIC_DICT_PACKED_UNIT_TEST_PATH,
+            sizeof(MfClassicKey)),
+        "nfc_dict_update_packed() failed");
+    mu_assert(
+        nfc_dict_update_packed(
+            NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH,
+            NFC_APP_MF_CLASSIC_DICT_PACKED_UNIT_TEST_PATH,
+            sizeof(MfClassicKey)),
+        "nfc_dict_update_packed() failed on up to date dict");
+
+    dict = nfc_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_PACKED_UNIT_TEST_PATH,
+        NfcDictModeOpenExisting,
+        sizeof(MfClassicKey));
+    mu_assert(dict != NULL, "nfc_dict_alloc() failed on packed dict");
+    mu_assert(nfc_dict_get_total_keys(dict) == test_key_num, "nfc_dict_get_total_keys() failed");
+
+    MfClassicKey key_dut = {};
+    size_t key_idx = 0;
+    while(nfc_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey))) {
+        mu_assert(key_idx < test_key_num, "Too many keys in packed dict");
+        mu_assert(
+            memcmp(key_arr_ref[key_idx].data, key_dut.data, sizeof(MfClassicKey)) == 0,
+            "Packed key data mismatch");
+        key_idx++;
+    }
+    mu_assert(key_idx == test_key_num, "Not all keys read from packed dict");
+
+    MfClassicKey* key = &key_arr_ref[test_key_num - 1];
+    mu_assert(
+        nfc_dict_is_key_present(dict, key->data, sizeof(MfClassicKey)),
+        "nfc_dict_is_key_present() failed on packed dict");
+    mu_assert(
+        nfc_dict_delete_key(dict, key->data, sizeof(MfClassicKey)),
+        "nfc_dict_delete_key() failed on packed dict");
+    mu_assert(
+        !nfc_dict_is_key_present(dict, key->data, sizeof(MfClassicKey)),
+        "Deleted key is still present in packed dict");
+    mu_assert(
+        nfc_dict_add_key(dict, key->data, sizeof(MfClassicKey)),
+        "nfc_dict_add_key() failed on packed dict");
+    mu_assert(nfc_dict_get_total_keys(dict) == test_key_num, "nfc_dict_get_total_keys() failed");
+    nfc_dict_free(dict);
+
+    free(key_arr_ref);
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_PACKED_UNIT_TEST_PATH),
+        "Remove packed test dict failed");
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(nfc) {
     nfc_test_alloc();
 
@@ -544,6 +635,7 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_value_block);
 
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_packed_test);
 
     nfc_test_free();
 }
@@ -455,4 +455,11 @@ NfcError nfc_iso15693_listener_tx_sof(Nfc* instance) {
     return NfcErrorNone;
 }
 
+NfcError nfc_iso15693_listener_cache_frame(Nfc* instance, const BitBuffer* tx_buffer) {
+    UNUSED(instance);
+    UNUSED(tx_buffer);
+
+    return NfcErrorNone;
+}
+
 #endif
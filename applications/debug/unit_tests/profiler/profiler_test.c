@@ -0,0 +1,75 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <toolbox/profiler.h>
+
+#include "../minunit.h"
+
+#define PROFILER_TEST_NAME "profiler_test"
+
+typedef struct {
+    uint32_t outer_count;
+    uint32_t outer_total_us;
+    uint32_t outer_self_us;
+    uint32_t inner_count;
+    uint32_t inner_total_us;
+} ProfilerTestInfo;
+
+static void
+    profiler_test_info_callback(const char* key, const char* value, bool last, void* context) {
+    UNUSED(last);
+    ProfilerTestInfo* info = context;
+    uint32_t number = strtoul(value, NULL, 10);
+
+    if(!strcmp(key, PROFILER_TEST_NAME ".outer.count")) info->outer_count = number;
+    if(!strcmp(key, PROFILER_TEST_NAME ".outer.total_us")) info->outer_total_us = number;
+    if(!strcmp(key, PROFILER_TEST_NAME ".outer.self_us")) info->outer_self_us = number;
+    if(!strcmp(key, PROFILER_TEST_NAME ".inner.count")) info->inner_count = number;
+    if(!strcmp(key, PROFILER_TEST_NAME ".inner.total_us")) info->inner_total_us = number;
+}
+
+MU_TEST(profiler_test_register) {
+    Profiler* profiler = profiler_alloc(PROFILER_TEST_NAME, 2);
+
+    ProfilerSlot first = profiler_register(profiler, "first");
+    ProfilerSlot second = profiler_register(profiler, "second");
+    mu_assert(first != second, "different keys must get different slots");
+    mu_assert_int_eq(first, profiler_register(profiler, "first"));
+
+    profiler_free(profiler);
+}
+
+MU_TEST(profiler_test_nested) {
+    Profiler* profiler = profiler_alloc(PROFILER_TEST_NAME, 2);
+    ProfilerSlot outer = profiler_register(profiler, "outer");
+    ProfilerSlot inner = profiler_register(profiler, "inner");
+
+    for(size_t i = 0; i < 4; i++) {
+        profiler_start(profiler, outer);
+        furi_delay_us(500);
+        profiler_start(profiler, inner);
+        furi_delay_us(1000);
+        profiler_stop(profiler, inner);
+        profiler_stop(profiler, outer);
+    }
+
+    ProfilerTestInfo info = {0};
+    profiler_info_get(profiler_test_info_callback, '.', &info);
+    profiler_free(profiler);
+
+    mu_assert_int_eq(4, info.outer_count);
+    mu_assert_int_eq(4, info.inner_count);
+    // Upper bounds leave room for preemption by other threads
+    mu_assert(info.inner_total_us >= 4000 && info.inner_total_us < 6000, "inner total");
+    mu_assert(info.outer_total_us >= 6000 && info.outer_total_us < 9000, "outer total");
+    mu_assert(info.outer_self_us >= 2000 && info.outer_self_us < 3000, "outer self time");
+}
+
+MU_TEST_SUITE(profiler_suite) {
+    MU_RUN_TEST(profiler_test_register);
+    MU_RUN_TEST(profiler_test_nested);
+}
+
+int run_minunit_test_profiler() {
+    MU_RUN_SUITE(profiler_suite);
+    return MU_EXIT_CODE;
+}
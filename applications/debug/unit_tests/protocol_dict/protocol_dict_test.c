@@ -5,6 +5,7 @@
 typedef enum {
     TestDictProtocol0,
     TestDictProtocol1,
+    TestDictProtocol2,
 
     TestDictProtocolMax,
 } TestDictProtocols;
@@ -99,6 +100,50 @@ static LevelDuration protocol_1_encoder_yield(Protocol1Data* data) {
     return level_duration_make(!(data->encoder_counter % 2), 100);
 }
 
+/*********************** PROTOCOL 2 START ***********************/
+
+typedef struct {
+    uint32_t data;
+    bool synced;
+} Protocol2Data;
+
+static const uint32_t protocol_2_decoder_result = 0xC0FFEE;
+static size_t protocol_2_feed_count = 0;
+
+static void* protocol_2_alloc() {
+    void* data = malloc(sizeof(Protocol2Data));
+    return data;
+}
+
+static void protocol_2_free(Protocol2Data* data) {
+    free(data);
+}
+
+static uint8_t* protocol_2_get_data(Protocol2Data* data) {
+    return (uint8_t*)&data->data;
+}
+
+static void protocol_2_decoder_start(Protocol2Data* data) {
+    data->data = 0;
+    data->synced = false;
+}
+
+static bool protocol_2_decoder_feed(Protocol2Data* data, bool level, uint32_t duration) {
+    protocol_2_feed_count++;
+    if(duration == 888) {
+        data->synced = false;
+    } else if(level && duration == 777) {
+        data->data = protocol_2_decoder_result;
+        data->synced = true;
+        return true;
+    }
+    return false;
+}
+
+static bool protocol_2_decoder_is_synced(Protocol2Data* data) {
+    return data->synced;
+}
+
 /*********************** PROTOCOLS DESCRIPTION ***********************/
 static const ProtocolBase protocol_0 = {
     .name = "Protocol 0",
@@ -138,9 +183,26 @@ static const ProtocolBase protocol_1 = {
         },
 };
 
+static const ProtocolBase protocol_2 = {
+    .name = "Protocol 2",
+    .manufacturer = "Manufacturer 2",
+    .data_size = 4,
+    .alloc = (ProtocolAlloc)protocol_2_alloc,
+    .free = (ProtocolFree)protocol_2_free,
+    .get_data = (ProtocolGetData)protocol_2_get_data,
+    .decoder =
+        {
+            .start = (ProtocolDecoderStart)protocol_2_decoder_start,
+            .feed = (ProtocolDecoderFeed)protocol_2_decoder_feed,
+            .is_synced = (ProtocolDecoderIsSynced)protocol_2_decoder_is_synced,
+            .duration_min = 50,
+        },
+};
+
 static const ProtocolBase* test_protocols_base[] = {
     [TestDictProtocol0] = &protocol_0,
     [TestDictProtocol1] = &protocol_1,
+    [TestDictProtocol2] = &protocol_2,
 };
 
 MU_TEST(test_protocol_dict) {
@@ -212,8 +274,48 @@ MU_TEST(test_protocol_dict) {
     free(data);
 }
 
+MU_TEST(test_protocol_dict_candidates) {
+    ProtocolDict* dict = protocol_dict_alloc(test_protocols_base, TestDictProtocolMax);
+    protocol_dict_decoders_start(dict);
+    ProtocolId protocol_id = PROTOCOL_NO;
+
+    // short pulses reach protocol 2 only until its prefilter kicks in
+    protocol_2_feed_count = 0;
+    protocol_id = protocol_dict_decoders_feed(dict, true, 100);
+    mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+    for(size_t i = 0; i < 10; i++) {
+        protocol_id = protocol_dict_decoders_feed(dict, i % 2, 10);
+        mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+    }
+    mu_assert_int_eq(3, protocol_2_feed_count);
+
+    // decoded frame locks dict on protocol 2
+    protocol_id = protocol_dict_decoders_feed(dict, true, 777);
+    mu_assert_int_eq(TestDictProtocol2, protocol_id);
+
+    protocol_id = protocol_dict_decoders_feed(dict, true, 543);
+    mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+
+    // lock is dropped, other decoders are fed again
+    protocol_id = protocol_dict_decoders_feed(dict, false, 888);
+    mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+
+    protocol_id = protocol_dict_decoders_feed(dict, true, 543);
+    mu_assert_int_eq(TestDictProtocol1, protocol_id);
+
+    // restart clears the lock
+    protocol_id = protocol_dict_decoders_feed(dict, true, 777);
+    mu_assert_int_eq(TestDictProtocol2, protocol_id);
+    protocol_dict_decoders_start(dict);
+    protocol_id = protocol_dict_decoders_feed(dict, true, 666);
+    mu_assert_int_eq(TestDictProtocol0, protocol_id);
+
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_protocol_dict_suite) {
     MU_RUN_TEST(test_protocol_dict);
+    MU_RUN_TEST(test_protocol_dict_candidates);
 }
 
 int run_minunit_test_protocol_dict() {
@@ -1350,6 +1350,7 @@ MU_TEST(test_storage_md5sum) {
     char md5sum1[MD5SUM_SIZE * 2 + 1] = {0};
     char md5sum2[MD5SUM_SIZE * 2 + 1] = {0};
     char md5sum3[MD5SUM_SIZE * 2 + 1] = {0};
+    char md5sum4[MD5SUM_SIZE * 2 + 1] = {0};
 
     test_storage_md5sum_run(
         TEST_DIR "test1.txt", ++command_id, "", PB_CommandStatus_ERROR_STORAGE_NOT_EXIST);
@@ -1357,9 +1358,12 @@ MU_TEST(test_storage_md5sum) {
     test_create_file(TEST_DIR "file1.txt", 0);
     test_create_file(TEST_DIR "file2.txt", 1);
     test_create_file(TEST_DIR "file3.txt", 512);
+    // Large enough to be cached
+    test_create_file(TEST_DIR "file4.txt", 8192);
     test_storage_calculate_md5sum(TEST_DIR "file1.txt", md5sum1, MD5SUM_SIZE * 2 + 1);
     test_storage_calculate_md5sum(TEST_DIR "file2.txt", md5sum2, MD5SUM_SIZE * 2 + 1);
     test_storage_calculate_md5sum(TEST_DIR "file3.txt", md5sum3, MD5SUM_SIZE * 2 + 1);
+    test_storage_calculate_md5sum(TEST_DIR "file4.txt", md5sum4, MD5SUM_SIZE * 2 + 1);
 
     test_storage_md5sum_run(TEST_DIR "file1.txt", ++command_id, md5sum1, PB_CommandStatus_OK);
     test_storage_md5sum_run(TEST_DIR "file1.txt", ++command_id, md5sum1, PB_CommandStatus_OK);
@@ -1374,6 +1378,9 @@ MU_TEST(test_storage_md5sum) {
     test_storage_md5sum_run(TEST_DIR "file3.txt", ++command_id, md5sum3, PB_CommandStatus_OK);
     test_storage_md5sum_run(TEST_DIR "file1.txt", ++command_id, md5sum1, PB_CommandStatus_OK);
     test_storage_md5sum_run(TEST_DIR "file2.txt", ++command_id, md5sum2, PB_CommandStatus_OK);
+
+    test_storage_md5sum_run(TEST_DIR "file4.txt", ++command_id, md5sum4, PB_CommandStatus_OK);
+    test_storage_md5sum_run(TEST_DIR "file4.txt", ++command_id, md5sum4, PB_CommandStatus_OK);
 }
 
 static void test_rpc_storage_rename_run(
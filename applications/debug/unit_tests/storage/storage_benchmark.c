@@ -0,0 +1,51 @@
+#include "../minunit.h"
+#include <furi.h>
+#include <storage/storage.h>
+#include <storage/storage_bench.h>
+
+static bool storage_benchmark_callback(const StorageBenchResult* result, void* context) {
+    size_t* count = context;
+    printf("  ");
+    storage_bench_print_result(result);
+    (*count)++;
+    return true;
+}
+
+static void storage_benchmark_run(const char* root) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    size_t count = 0;
+
+    printf("Storage benchmark %s:\r\n", root);
+    mu_assert(
+        storage_bench_run(storage, root, storage_benchmark_callback, &count),
+        "Storage benchmark failed\r\n");
+    mu_assert(count > 0, "No results\r\n");
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(storage_benchmark_int) {
+    storage_benchmark_run(STORAGE_INT_PATH_PREFIX);
+}
+
+MU_TEST(storage_benchmark_ext) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool sd_ready = storage_sd_status(storage) == FSE_OK;
+    furi_record_close(RECORD_STORAGE);
+
+    if(sd_ready) {
+        storage_benchmark_run(STORAGE_EXT_PATH_PREFIX);
+    } else {
+        printf("Storage benchmark %s: no SD card\r\n", STORAGE_EXT_PATH_PREFIX);
+    }
+}
+
+MU_TEST_SUITE(storage_benchmark) {
+    MU_RUN_TEST(storage_benchmark_int);
+    MU_RUN_TEST(storage_benchmark_ext);
+}
+
+int run_minunit_test_storage_benchmark() {
+    MU_RUN_SUITE(storage_benchmark);
+    return MU_EXIT_CODE;
+}
@@ -175,6 +175,143 @@ MU_TEST(storage_file_read_write_64k) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(storage_file_read_write_iovec) {
+    const char* filename = UNIT_TESTS_PATH("storage_iovec.test");
+    const size_t test_size = 3000;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(test_size);
+
+    for(size_t i = 0; i < test_size; i++) {
+        data[i] = (i % 113);
+    }
+
+    // Uneven buffers, including an empty one
+    StorageIoVec iov[] = {
+        {.buff = &data[0], .size = 100},
+        {.buff = &data[100], .size = 0},
+        {.buff = &data[100], .size = 1900},
+        {.buff = &data[2000], .size = 1000},
+    };
+
+    mu_check(storage_file_open(file, filename, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(test_size, storage_file_writev(file, iov, COUNT_OF(iov)));
+    storage_file_close(file);
+
+    memset(data, 0, test_size);
+
+    mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(test_size, storage_file_readv(file, iov, COUNT_OF(iov)));
+    // Reading past the end must be short, not an error
+    mu_assert_int_eq(0, storage_file_readv(file, iov, COUNT_OF(iov)));
+    mu_assert_int_eq(FSE_OK, storage_file_get_error(file));
+    storage_file_close(file);
+
+    bool data_ok = true;
+    for(size_t i = 0; i < test_size; i++) {
+        if(data[i] != (i % 113)) {
+            data_ok = false;
+            break;
+        }
+    }
+
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(data_ok, "vectored read data mismatch");
+}
+
+#define STORAGE_ASYNC_CHUNK_SIZE (512U)
+#define STORAGE_ASYNC_CHUNK_COUNT (16U)
+#define STORAGE_ASYNC_DEPTH (4U)
+
+typedef struct {
+    FuriSemaphore* done;
+    size_t bytes;
+    bool error;
+} StorageAsyncTest;
+
+static void storage_file_async_callback(void* context, size_t bytes, FS_Error error) {
+    StorageAsyncTest* test = context;
+    // Callbacks come from storage thread one after another
+    test->bytes += bytes;
+    if(error != FSE_OK) test->error = true;
+    furi_semaphore_release(test->done);
+}
+
+static void storage_file_async_wait(StorageAsyncTest* test, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        furi_check(furi_semaphore_acquire(test->done, FuriWaitForever) == FuriStatusOk);
+    }
+}
+
+MU_TEST(storage_file_read_write_async) {
+    const char* filename = UNIT_TESTS_PATH("storage_async.test");
+    const size_t test_size = STORAGE_ASYNC_CHUNK_SIZE * STORAGE_ASYNC_CHUNK_COUNT;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(test_size);
+    StorageAsyncTest test = {
+        .done = furi_semaphore_alloc(STORAGE_ASYNC_DEPTH, 0),
+    };
+
+    for(size_t i = 0; i < test_size; i++) {
+        data[i] = (i % 113);
+    }
+
+    // Keep up to STORAGE_ASYNC_DEPTH requests in flight
+    mu_check(storage_file_open(file, filename, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    for(size_t i = 0; i < STORAGE_ASYNC_CHUNK_COUNT; i++) {
+        if(i >= STORAGE_ASYNC_DEPTH) storage_file_async_wait(&test, 1);
+        storage_file_write_async(
+            file,
+            &data[i * STORAGE_ASYNC_CHUNK_SIZE],
+            STORAGE_ASYNC_CHUNK_SIZE,
+            storage_file_async_callback,
+            &test);
+    }
+    storage_file_async_wait(&test, STORAGE_ASYNC_DEPTH);
+    storage_file_close(file);
+    mu_assert_int_eq(test_size, test.bytes);
+    mu_check(!test.error);
+
+    memset(data, 0, test_size);
+    test.bytes = 0;
+
+    mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+    for(size_t i = 0; i < STORAGE_ASYNC_CHUNK_COUNT; i++) {
+        if(i >= STORAGE_ASYNC_DEPTH) storage_file_async_wait(&test, 1);
+        storage_file_read_async(
+            file,
+            &data[i * STORAGE_ASYNC_CHUNK_SIZE],
+            STORAGE_ASYNC_CHUNK_SIZE,
+            storage_file_async_callback,
+            &test);
+    }
+    storage_file_async_wait(&test, STORAGE_ASYNC_DEPTH);
+    storage_file_close(file);
+    mu_assert_int_eq(test_size, test.bytes);
+    mu_check(!test.error);
+
+    bool data_ok = true;
+    for(size_t i = 0; i < test_size; i++) {
+        if(data[i] != (i % 113)) {
+            data_ok = false;
+            break;
+        }
+    }
+
+    furi_semaphore_free(test.done);
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(data_ok, "async read data mismatch");
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
@@ -184,6 +321,8 @@ MU_TEST_SUITE(storage_file) {
 
 MU_TEST_SUITE(storage_file_64k) {
     MU_RUN_TEST(storage_file_read_write_64k);
+    MU_RUN_TEST(storage_file_read_write_iovec);
+    MU_RUN_TEST(storage_file_read_write_async);
 }
 
 MU_TEST(storage_dir_open_close) {
@@ -258,10 +397,86 @@ MU_TEST(storage_dir_exists_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static size_t storage_dir_count(Storage* storage, const char* path, uint64_t* total_size) {
+    File* dir = storage_file_alloc(storage);
+    FileInfo fileinfo;
+    char name[64];
+    size_t count = 0;
+
+    *total_size = 0;
+    if(storage_dir_open(dir, path)) {
+        while(storage_dir_read(dir, &fileinfo, name, sizeof(name))) {
+            *total_size += fileinfo.size;
+            count++;
+        }
+    }
+    storage_dir_close(dir);
+    storage_file_free(dir);
+
+    return count;
+}
+
+static void storage_dir_change_callback(const void* message, void* context) {
+    const StorageEvent* event = message;
+    uint32_t* changes = context;
+
+    if(event->type == StorageEventTypeDirChange && strcmp(event->path, STORAGE_TEST_DIR) == 0) {
+        (*changes)++;
+    }
+}
+
+MU_TEST(storage_dir_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    uint32_t changes = 0;
+    uint64_t size = 0;
+    FileInfo fileinfo;
+
+    FuriPubSubSubscription* subscription = furi_pubsub_subscribe(
+        storage_get_pubsub(storage), storage_dir_change_callback, &changes);
+
+    storage_simply_remove_recursive(storage, STORAGE_TEST_DIR);
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_TEST_DIR));
+    mu_check(storage_file_create(storage, STORAGE_TEST_DIR "/a.test", "a"));
+
+    // Second listing is served from the cache and must match the first one
+    mu_assert_int_eq(1, storage_dir_count(storage, STORAGE_TEST_DIR, &size));
+    mu_assert_int_eq(1, storage_dir_count(storage, STORAGE_TEST_DIR, &size));
+    mu_assert_int_eq(1, size);
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_TEST_DIR "/a.test", &fileinfo));
+    mu_assert_int_eq(1, fileinfo.size);
+
+    changes = 0;
+    mu_check(storage_file_create(storage, STORAGE_TEST_DIR "/b.test", "bb"));
+    mu_check(changes > 0);
+    mu_assert_int_eq(2, storage_dir_count(storage, STORAGE_TEST_DIR, &size));
+    mu_assert_int_eq(3, size);
+
+    changes = 0;
+    mu_assert_int_eq(
+        FSE_OK,
+        storage_common_rename(storage, STORAGE_TEST_DIR "/a.test", STORAGE_TEST_DIR "/c.test"));
+    mu_check(changes > 0);
+    mu_assert_int_eq(
+        FSE_NOT_EXIST, storage_common_stat(storage, STORAGE_TEST_DIR "/a.test", &fileinfo));
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, STORAGE_TEST_DIR "/c.test", &fileinfo));
+
+    changes = 0;
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, STORAGE_TEST_DIR "/b.test"));
+    mu_check(changes > 0);
+    mu_assert_int_eq(1, storage_dir_count(storage, STORAGE_TEST_DIR, &size));
+    mu_assert_int_eq(1, size);
+
+    furi_pubsub_unsubscribe(storage_get_pubsub(storage), subscription);
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_TEST_DIR));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_dir) {
     MU_RUN_TEST(storage_dir_open_close);
     MU_RUN_TEST(storage_dir_open_lock);
     MU_RUN_TEST(storage_dir_exists_test);
+    MU_RUN_TEST(storage_dir_cache_test);
 }
 
 static const char* const storage_copy_test_paths[] = {
@@ -400,9 +615,77 @@ MU_TEST(storage_dir_rename) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_COPY_TEST_LARGE_FILE "large.test"
+#define STORAGE_COPY_TEST_LARGE_SIZE (64U * 1024U + 13U)
+
+static bool storage_copy_test_large_file(Storage* storage, const char* path, bool write) {
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(STORAGE_COPY_TEST_LARGE_SIZE);
+    bool result = false;
+
+    do {
+        if(write) {
+            for(size_t i = 0; i < STORAGE_COPY_TEST_LARGE_SIZE; i++) {
+                data[i] = i % 251;
+            }
+            if(!storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+            if(storage_file_write(file, data, STORAGE_COPY_TEST_LARGE_SIZE) !=
+               STORAGE_COPY_TEST_LARGE_SIZE)
+                break;
+        } else {
+            if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+            if(storage_file_size(file) != STORAGE_COPY_TEST_LARGE_SIZE) break;
+            if(storage_file_read(file, data, STORAGE_COPY_TEST_LARGE_SIZE) !=
+               STORAGE_COPY_TEST_LARGE_SIZE)
+                break;
+
+            size_t i = 0;
+            while(i < STORAGE_COPY_TEST_LARGE_SIZE && data[i] == i % 251) {
+                i++;
+            }
+            if(i != STORAGE_COPY_TEST_LARGE_SIZE) break;
+        }
+        result = true;
+    } while(false);
+
+    free(data);
+    storage_file_free(file);
+    return result;
+}
+
+MU_TEST(storage_dir_copy) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    storage_dir_create(storage, EXT_PATH("dir.old"));
+    mu_check(storage_copy_test_large_file(
+        storage, EXT_PATH("dir.old/111/" STORAGE_COPY_TEST_LARGE_FILE), true));
+
+    mu_assert_int_eq(
+        FSE_OK, storage_common_copy(storage, EXT_PATH("dir.old"), EXT_PATH("dir.new")));
+    mu_check(storage_dir_rename_check(storage, EXT_PATH("dir.old")));
+    mu_check(storage_dir_rename_check(storage, EXT_PATH("dir.new")));
+    mu_check(storage_copy_test_large_file(
+        storage, EXT_PATH("dir.new/111/" STORAGE_COPY_TEST_LARGE_FILE), false));
+
+    // Merge keeps existing files and copies colliding ones under the next free name
+    mu_assert_int_eq(
+        FSE_OK, storage_common_merge(storage, EXT_PATH("dir.old"), EXT_PATH("dir.new")));
+    mu_check(storage_dir_rename_check(storage, EXT_PATH("dir.new")));
+    mu_check(check_file_13DA(storage, EXT_PATH("dir.new/file1.test")));
+    mu_check(storage_copy_test_large_file(
+        storage, EXT_PATH("dir.new/111/large1.test"), false));
+
+    storage_dir_remove(storage, EXT_PATH("dir.old"));
+    storage_dir_remove(storage, EXT_PATH("dir.new"));
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_stat(storage, EXT_PATH("dir.new"), NULL));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_rename) {
     MU_RUN_TEST(storage_file_rename);
     MU_RUN_TEST(storage_dir_rename);
+    MU_RUN_TEST(storage_dir_copy);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     storage_dir_remove(storage, EXT_PATH("dir.old"));
@@ -702,6 +985,115 @@ MU_TEST_SUITE(test_md5_calc_suite) {
     MU_RUN_TEST(test_md5_calc);
 }
 
+#include <lib/toolbox/file_view.h>
+
+#define FILE_VIEW_TEST_FILE UNIT_TESTS_PATH("file_view.test")
+
+MU_TEST(test_file_view) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FileView* view = file_view_alloc(storage, 1024, 2);
+
+    mu_check(storage_copy_test_large_file(storage, FILE_VIEW_TEST_FILE, true));
+    mu_check(file_view_open(view, FILE_VIEW_TEST_FILE));
+    mu_assert_int_eq(STORAGE_COPY_TEST_LARGE_SIZE, file_view_size(view));
+
+    const uint8_t* head = file_view_pin(view, 1000, 100);
+    mu_check(head != NULL);
+    mu_assert_int_eq(1000 % 251, head[0]);
+    mu_assert_int_eq(1099 % 251, head[99]);
+
+    // Same page serves overlapping region
+    const uint8_t* overlap = file_view_pin(view, 1020, 10);
+    mu_check(overlap == head + 20);
+
+    const uint8_t* tail = file_view_pin(view, STORAGE_COPY_TEST_LARGE_SIZE - 13, 13);
+    mu_check(tail != NULL);
+    mu_assert_int_eq((STORAGE_COPY_TEST_LARGE_SIZE - 1) % 251, tail[12]);
+
+    // Out of file, too large, and no free page
+    mu_check(file_view_pin(view, STORAGE_COPY_TEST_LARGE_SIZE - 13, 14) == NULL);
+    mu_check(file_view_pin(view, 0, 1025) == NULL);
+    mu_check(file_view_pin(view, 0, 10) == NULL);
+
+    file_view_unpin(view, tail);
+    const uint8_t* start = file_view_pin(view, 0, 10);
+    mu_check(start != NULL);
+    mu_assert_int_eq(9, start[9]);
+    mu_assert_int_eq(1000 % 251, head[0]);
+
+    file_view_unpin(view, start);
+    file_view_unpin(view, overlap);
+    file_view_unpin(view, head);
+
+    uint8_t* data = malloc(STORAGE_COPY_TEST_LARGE_SIZE);
+    mu_assert_int_eq(
+        STORAGE_COPY_TEST_LARGE_SIZE - 3,
+        file_view_read(view, 3, data, STORAGE_COPY_TEST_LARGE_SIZE));
+    size_t i = 0;
+    while(i < STORAGE_COPY_TEST_LARGE_SIZE - 3 && data[i] == (i + 3) % 251) {
+        i++;
+    }
+    mu_assert_int_eq(STORAGE_COPY_TEST_LARGE_SIZE - 3, i);
+    free(data);
+
+    file_view_free(view);
+    storage_common_remove(storage, FILE_VIEW_TEST_FILE);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(test_file_view_suite) {
+    MU_RUN_TEST(test_file_view);
+}
+
+#define SECTORS_TEST_FILE UNIT_TESTS_PATH("sectors.test")
+#define SECTORS_TEST_COUNT 8
+
+MU_TEST(test_file_sectors) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(SECTORS_TEST_COUNT * 512);
+    uint32_t sector = 0;
+
+    mu_check(storage_file_open(file, SECTORS_TEST_FILE, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    // Empty file has no sectors
+    mu_check(!storage_file_get_contiguous_sector(file, &sector));
+    mu_check(storage_file_expand(file, SECTORS_TEST_COUNT * 512));
+    for(size_t i = 0; i < SECTORS_TEST_COUNT * 512; i++) data[i] = i % 251;
+    mu_assert_int_eq(
+        SECTORS_TEST_COUNT * 512, storage_file_write(file, data, SECTORS_TEST_COUNT * 512));
+    mu_check(storage_file_get_contiguous_sector(file, &sector));
+
+    // Written through the filesystem, read back directly
+    memset(data, 0, SECTORS_TEST_COUNT * 512);
+    mu_assert_int_eq(FSE_OK, storage_sd_read_sectors(storage, sector, data, SECTORS_TEST_COUNT));
+    size_t i = 0;
+    while(i < SECTORS_TEST_COUNT * 512 && data[i] == i % 251) {
+        i++;
+    }
+    mu_assert_int_eq(SECTORS_TEST_COUNT * 512, i);
+
+    // Written directly, read back through the filesystem
+    memset(data, 0x5A, 512);
+    mu_assert_int_eq(FSE_OK, storage_sd_write_sectors(storage, sector + 1, data, 1));
+    storage_file_close(file);
+    mu_check(storage_file_open(file, SECTORS_TEST_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_check(storage_file_seek(file, 512, true));
+    memset(data, 0, 512);
+    mu_assert_int_eq(512, storage_file_read(file, data, 512));
+    mu_assert_int_eq(0x5A, data[0]);
+    mu_assert_int_eq(0x5A, data[511]);
+    storage_file_close(file);
+
+    free(data);
+    storage_file_free(file);
+    storage_common_remove(storage, SECTORS_TEST_FILE);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(test_file_sectors_suite) {
+    MU_RUN_TEST(test_file_sectors);
+}
+
 int run_minunit_test_storage() {
     MU_RUN_SUITE(storage_file);
     MU_RUN_SUITE(storage_file_64k);
@@ -710,5 +1102,7 @@ int run_minunit_test_storage() {
     MU_RUN_SUITE(test_data_path);
     MU_RUN_SUITE(test_storage_common);
     MU_RUN_SUITE(test_md5_calc_suite);
+    MU_RUN_SUITE(test_file_view_suite);
+    MU_RUN_SUITE(test_file_sectors_suite);
     return MU_EXIT_CODE;
 }
@@ -0,0 +1,223 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <storage/storage.h>
+#include <toolbox/stream/stream.h>
+#include <toolbox/stream/string_stream.h>
+#include <toolbox/stream/file_stream.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include "../minunit.h"
+
+#define BENCHMARK_DIR_NAME EXT_PATH("unit_tests_tmp")
+#define BENCHMARK_FILE_NAME BENCHMARK_DIR_NAME "/stream_benchmark.txt"
+// About 100KiB, long enough for buffer refills to dominate over open and first fill
+#define BENCHMARK_LINES 2048
+#define BENCHMARK_BLOCK_MAX 512
+
+typedef struct {
+    size_t allocs;
+    uint32_t start;
+} StreamBenchmarkMark;
+
+static size_t benchmark_file_size;
+
+static void stream_benchmark_mark(StreamBenchmarkMark* mark) {
+    mark->allocs = memmgr_heap_get_alloc_count();
+    mark->start = DWT->CYCCNT;
+}
+
+static void
+    stream_benchmark_report(const StreamBenchmarkMark* mark, const char* name, size_t bytes) {
+    uint32_t cycles = DWT->CYCCNT - mark->start;
+    size_t allocs = memmgr_heap_get_alloc_count() - mark->allocs;
+    uint64_t cpu_hz = (uint64_t)furi_hal_cortex_instructions_per_microsecond() * 1000000;
+
+    printf(
+        "  %-28s %7lu B/s %7lu us %5zu allocs\r\n",
+        name,
+        (uint32_t)(cycles ? bytes * cpu_hz / cycles : 0),
+        cycles / furi_hal_cortex_instructions_per_microsecond(),
+        allocs);
+}
+
+static bool stream_benchmark_generate(Storage* storage) {
+    Stream* stream = buffered_file_stream_alloc(storage);
+    bool success = false;
+
+    storage_simply_mkdir(storage, BENCHMARK_DIR_NAME);
+    if(buffered_file_stream_open(
+           stream, BENCHMARK_FILE_NAME, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+        success = true;
+        for(size_t i = 0; i < BENCHMARK_LINES && success; i++) {
+            // Line length varies, so lines don't align with buffer boundaries
+            success = stream_write_format(
+                          stream,
+                          "Line %04zu: %.*s\n",
+                          i,
+                          (int)(8 + i % 40),
+                          "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ") > 0;
+        }
+        benchmark_file_size = stream_size(stream);
+    }
+
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+    return success;
+}
+
+/** Read whole file by lines
+ *
+ * @return true if all lines and bytes were read
+ */
+static bool stream_benchmark_read_line(Stream* stream, const char* name) {
+    FuriString* line = furi_string_alloc();
+    size_t lines = 0;
+    size_t bytes = 0;
+
+    StreamBenchmarkMark mark;
+    stream_benchmark_mark(&mark);
+    stream_rewind(stream);
+    while(stream_read_line(stream, line)) {
+        bytes += furi_string_size(line);
+        lines++;
+    }
+    stream_benchmark_report(&mark, name, bytes);
+
+    furi_string_free(line);
+    return lines == BENCHMARK_LINES && bytes == benchmark_file_size;
+}
+
+static bool stream_benchmark_read_line_view(Stream* stream, const char* name) {
+    FuriString* line = furi_string_alloc();
+    size_t lines = 0;
+    size_t bytes = 0;
+
+    StreamBenchmarkMark mark;
+    stream_benchmark_mark(&mark);
+    stream_rewind(stream);
+    while(true) {
+        const char* view;
+        size_t length;
+        if(stream_read_line_view(stream, &view, &length)) {
+            bytes += length;
+        } else if(stream_read_line(stream, line)) {
+            bytes += furi_string_size(line);
+        } else {
+            break;
+        }
+        lines++;
+    }
+    stream_benchmark_report(&mark, name, bytes);
+
+    furi_string_free(line);
+    return lines == BENCHMARK_LINES && bytes == benchmark_file_size;
+}
+
+static bool stream_benchmark_read_block(Stream* stream, const char* name, size_t block_size) {
+    uint8_t* block = malloc(BENCHMARK_BLOCK_MAX);
+    size_t bytes = 0;
+    size_t read;
+
+    StreamBenchmarkMark mark;
+    stream_benchmark_mark(&mark);
+    stream_rewind(stream);
+    do {
+        read = stream_read(stream, block, block_size);
+        bytes += read;
+    } while(read == block_size);
+    stream_benchmark_report(&mark, name, bytes);
+
+    free(block);
+    return bytes == benchmark_file_size;
+}
+
+MU_TEST(stream_benchmark_generate_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool success = stream_benchmark_generate(storage);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(success, "Unable to generate benchmark file\r\n");
+    printf("Stream benchmark, %zu bytes in %u lines:\r\n", benchmark_file_size, BENCHMARK_LINES);
+}
+
+MU_TEST(stream_benchmark_read_line_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool file_ok = false, buffered_ok = false, view_ok = false, string_ok = false;
+
+    Stream* stream = file_stream_alloc(storage);
+    if(file_stream_open(stream, BENCHMARK_FILE_NAME, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        file_ok = stream_benchmark_read_line(stream, "read_line file");
+    }
+    file_stream_close(stream);
+    stream_free(stream);
+
+    stream = buffered_file_stream_alloc(storage);
+    if(buffered_file_stream_open(stream, BENCHMARK_FILE_NAME, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        buffered_ok = stream_benchmark_read_line(stream, "read_line buffered");
+        view_ok = stream_benchmark_read_line_view(stream, "read_line_view buffered");
+    }
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+
+    // Storage cost excluded, shows line parsing alone
+    stream = string_stream_alloc();
+    if(stream_load_from_file(stream, storage, BENCHMARK_FILE_NAME) == benchmark_file_size) {
+        string_ok = stream_benchmark_read_line(stream, "read_line string");
+    }
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(file_ok, "File stream read_line failed\r\n");
+    mu_assert(buffered_ok, "Buffered file stream read_line failed\r\n");
+    mu_assert(view_ok, "Buffered file stream read_line_view failed\r\n");
+    mu_assert(string_ok, "String stream read_line failed\r\n");
+}
+
+MU_TEST(stream_benchmark_read_block_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    static const size_t block_sizes[] = {16, BENCHMARK_BLOCK_MAX};
+    char name[32];
+
+    Stream* file = file_stream_alloc(storage);
+    Stream* buffered = buffered_file_stream_alloc(storage);
+
+    bool success =
+        file_stream_open(file, BENCHMARK_FILE_NAME, FSAM_READ, FSOM_OPEN_EXISTING) &&
+        buffered_file_stream_open(buffered, BENCHMARK_FILE_NAME, FSAM_READ, FSOM_OPEN_EXISTING);
+
+    for(size_t i = 0; i < COUNT_OF(block_sizes) && success; i++) {
+        snprintf(name, sizeof(name), "read %zu file", block_sizes[i]);
+        success = stream_benchmark_read_block(file, name, block_sizes[i]);
+        snprintf(name, sizeof(name), "read %zu buffered", block_sizes[i]);
+        success = success && stream_benchmark_read_block(buffered, name, block_sizes[i]);
+    }
+
+    buffered_file_stream_close(buffered);
+    file_stream_close(file);
+    stream_free(buffered);
+    stream_free(file);
+
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(success, "Block read failed\r\n");
+}
+
+MU_TEST_SUITE(stream_benchmark) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    if(storage_sd_status(storage) != FSE_OK) {
+        printf("Stream benchmark: no SD card\r\n");
+    } else {
+        MU_RUN_TEST(stream_benchmark_generate_test);
+        MU_RUN_TEST(stream_benchmark_read_line_test);
+        MU_RUN_TEST(stream_benchmark_read_block_test);
+    }
+
+    storage_simply_remove(storage, BENCHMARK_FILE_NAME);
+    furi_record_close(RECORD_STORAGE);
+}
+
+int run_minunit_test_stream_benchmark() {
+    MU_RUN_SUITE(stream_benchmark);
+    return MU_EXIT_CODE;
+}
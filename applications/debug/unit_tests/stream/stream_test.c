@@ -315,6 +315,13 @@ MU_TEST(stream_composite_test) {
         stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
     MU_RUN_TEST_1(stream_composite_subtest, stream);
     stream_free(stream);
+
+    // test buffered file stream with small buffer growing on sequential reads
+    stream = buffered_file_stream_alloc_ex(storage, 8, 64);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_composite_subtest, stream);
+    stream_free(stream);
     furi_record_close(RECORD_STORAGE);
 }
 
@@ -362,6 +369,75 @@ MU_TEST(stream_write_read_save_load_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST_1(stream_read_line_subtest, Stream* stream) {
+    static const char* const lines[] = {
+        "first line\n",
+        "second\n",
+        "\n",
+        "I write differently from what I speak, I speak differently from what I think\n",
+        "last",
+    };
+
+    mu_check(stream_write_cstring(
+        stream,
+        "first line\r\nsecond\n\n"
+        "I write differently from what I speak, I speak differently from what I think\r\n"
+        "last"));
+
+    // read all lines with copy
+    FuriString* line = furi_string_alloc();
+    mu_check(stream_rewind(stream));
+    for(size_t i = 0; i < COUNT_OF(lines); i++) {
+        mu_check(stream_read_line(stream, line));
+        mu_assert_string_eq(lines[i], furi_string_get_cstr(line));
+    }
+    mu_check(!stream_read_line(stream, line));
+
+    // read all lines without copy where possible, same lines are expected
+    mu_check(stream_rewind(stream));
+    for(size_t i = 0; i < COUNT_OF(lines); i++) {
+        const char* data;
+        size_t length;
+        if(stream_read_line_view(stream, &data, &length)) {
+            furi_string_reset(line);
+            for(size_t j = 0; j < length; j++) {
+                if(data[j] != '\r') furi_string_push_back(line, data[j]);
+            }
+        } else {
+            mu_check(stream_read_line(stream, line));
+        }
+        mu_assert_string_eq(lines[i], furi_string_get_cstr(line));
+    }
+    mu_check(stream_eof(stream));
+
+    furi_string_free(line);
+}
+
+MU_TEST(stream_read_line_test) {
+    // test string stream
+    Stream* stream;
+    stream = string_stream_alloc();
+    MU_RUN_TEST_1(stream_read_line_subtest, stream);
+    stream_free(stream);
+
+    // test file stream
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    stream = file_stream_alloc(storage);
+    mu_check(
+        file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_read_line_subtest, stream);
+    stream_free(stream);
+
+    // test buffered file stream, with buffer smaller than some lines
+    stream = buffered_file_stream_alloc_ex(storage, 16, 32);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_read_line_subtest, stream);
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_1(stream_split_subtest, Stream* stream) {
     stream_clean(stream);
     stream_write_cstring(stream, stream_test_left_data);
@@ -518,12 +594,71 @@ MU_TEST(stream_buffered_large_file_test) {
     furi_string_free(output_data);
 }
 
+MU_TEST(stream_file_delete_and_insert_large_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    Stream* expected = string_stream_alloc();
+    FuriString* data = furi_string_alloc();
+
+    mu_check(
+        file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+
+    // more than one move buffer of data after edit position
+    for(size_t i = 0; i < 100; i++) {
+        furi_string_cat_printf(data, "line %03zu: %s\n", i, stream_test_left_data);
+    }
+    mu_check(stream_write_string(stream, data) == furi_string_size(data));
+    mu_check(stream_write_string(expected, data) == furi_string_size(data));
+
+    // grow, shrink and keep size of edited part
+    static const struct {
+        size_t position;
+        size_t delete_size;
+        const char* insert;
+    } edits[] = {
+        {10, 4, "with a much longer replacement"},
+        {500, 30, "short"},
+        {1000, 5, "equal"},
+        {0, 0, "head "},
+        {4000, 10000, "tail"},
+    };
+
+    for(size_t i = 0; i < COUNT_OF(edits); i++) {
+        mu_check(stream_seek(stream, edits[i].position, StreamOffsetFromStart));
+        mu_check(stream_seek(expected, edits[i].position, StreamOffsetFromStart));
+        mu_check(stream_delete_and_insert_cstring(stream, edits[i].delete_size, edits[i].insert));
+        mu_check(
+            stream_delete_and_insert_cstring(expected, edits[i].delete_size, edits[i].insert));
+        mu_assert_int_eq(stream_tell(expected), stream_tell(stream));
+        mu_assert_int_eq(stream_size(expected), stream_size(stream));
+    }
+
+    FuriString* file_line = furi_string_alloc();
+    FuriString* expected_line = furi_string_alloc();
+    mu_check(stream_rewind(stream));
+    mu_check(stream_rewind(expected));
+    while(stream_read_line(expected, expected_line)) {
+        mu_check(stream_read_line(stream, file_line));
+        mu_assert_string_eq(furi_string_get_cstr(expected_line), furi_string_get_cstr(file_line));
+    }
+    mu_check(!stream_read_line(stream, file_line));
+    furi_string_free(expected_line);
+    furi_string_free(file_line);
+
+    furi_string_free(data);
+    stream_free(expected);
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
+    MU_RUN_TEST(stream_read_line_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
+    MU_RUN_TEST(stream_file_delete_and_insert_large_test);
 }
 
 int run_minunit_test_stream() {
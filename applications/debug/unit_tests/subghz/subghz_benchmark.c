@@ -0,0 +1,282 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+#include <lib/subghz/receiver.h>
+#include <lib/subghz/protocols/protocol_items.h>
+#include <flipper_format/flipper_format.h>
+#include <storage/storage.h>
+
+#define TAG "SubGhzBenchmark"
+#define BENCHMARK_CORPUS_DIR_NAME EXT_PATH("unit_tests/subghz")
+#define KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
+#define NICE_FLOR_S_DIR_NAME EXT_PATH("subghz/assets/nice_flor_s")
+#define ALUTECH_AT_4N_DIR_NAME EXT_PATH("subghz/assets/alutech_at_4n")
+// Longer files are truncated, corpus is only loaded to RAM one file at a time
+#define BENCHMARK_MAX_PULSES 4096
+#define BENCHMARK_NAME_SIZE 64
+
+typedef struct {
+    SubGhzProtocolDecoderBase* decoder;
+    uint64_t cycles;
+    size_t allocs;
+    size_t decoded;
+} SubGhzBenchmarkDecoder;
+
+typedef struct {
+    SubGhzEnvironment* environment;
+    LevelDuration* pulses;
+    int32_t* raw;
+
+    SubGhzBenchmarkDecoder* decoders;
+    size_t decoders_count;
+
+    size_t files;
+    size_t pulses_total;
+    uint64_t receiver_cycles;
+    size_t receiver_allocs;
+    size_t receiver_decoded;
+} SubGhzBenchmark;
+
+static SubGhzBenchmark benchmark;
+
+static void subghz_benchmark_receiver_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(receiver);
+    UNUSED(decoder_base);
+    UNUSED(context);
+    benchmark.receiver_decoded++;
+}
+
+static void
+    subghz_benchmark_decoder_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
+    UNUSED(decoder_base);
+    SubGhzBenchmarkDecoder* decoder = context;
+    decoder->decoded++;
+}
+
+/** Load RAW pulses of one corpus file
+ *
+ * @param storage Storage instance
+ * @param path file path
+ * @return pulses count, 0 if file is not a text RAW file
+ */
+static size_t subghz_benchmark_load(Storage* storage, const char* path) {
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    FuriString* temp_str = furi_string_alloc();
+    size_t count = 0;
+
+    do {
+        if(!flipper_format_file_open_existing(flipper_format, path)) break;
+        if(!flipper_format_read_string(flipper_format, "Protocol", temp_str)) break;
+        if(!furi_string_equal(temp_str, "RAW")) break;
+
+        uint32_t line_count = 0;
+        while(count < BENCHMARK_MAX_PULSES &&
+              flipper_format_get_value_count(flipper_format, "RAW_Data", &line_count) &&
+              line_count) {
+            line_count = MIN(line_count, BENCHMARK_MAX_PULSES - count);
+            if(!flipper_format_read_int32(
+                   flipper_format, "RAW_Data", &benchmark.raw[count], line_count)) {
+                break;
+            }
+            count += line_count;
+        }
+    } while(false);
+
+    for(size_t i = 0; i < count; i++) {
+        int32_t duration = benchmark.raw[i];
+        benchmark.pulses[i] = level_duration_make(duration > 0, (uint32_t)abs(duration));
+    }
+
+    furi_string_free(temp_str);
+    flipper_format_free(flipper_format);
+    return count;
+}
+
+static void subghz_benchmark_run_receiver(SubGhzReceiver* receiver, size_t count) {
+    subghz_receiver_reset(receiver);
+
+    size_t allocs = memmgr_heap_get_alloc_count();
+    uint32_t start = DWT->CYCCNT;
+    for(size_t i = 0; i < count; i++) {
+        subghz_receiver_decode(
+            receiver,
+            level_duration_get_level(benchmark.pulses[i]),
+            level_duration_get_duration(benchmark.pulses[i]));
+    }
+    benchmark.receiver_cycles += DWT->CYCCNT - start;
+    benchmark.receiver_allocs += memmgr_heap_get_alloc_count() - allocs;
+}
+
+static void subghz_benchmark_run_decoders(size_t count) {
+    for(size_t d = 0; d < benchmark.decoders_count; d++) {
+        SubGhzBenchmarkDecoder* item = &benchmark.decoders[d];
+        SubGhzProtocolDecoderBase* decoder = item->decoder;
+        decoder->protocol->decoder->reset(decoder);
+
+        size_t allocs = memmgr_heap_get_alloc_count();
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < count; i++) {
+            decoder->protocol->decoder->feed(
+                decoder,
+                level_duration_get_level(benchmark.pulses[i]),
+                level_duration_get_duration(benchmark.pulses[i]));
+        }
+        item->cycles += DWT->CYCCNT - start;
+        item->allocs += memmgr_heap_get_alloc_count() - allocs;
+    }
+}
+
+static void subghz_benchmark_decoders_alloc(void) {
+    size_t count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    benchmark.decoders = malloc(sizeof(SubGhzBenchmarkDecoder) * count);
+    benchmark.decoders_count = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        const SubGhzProtocol* protocol =
+            subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i);
+        if(!protocol->decoder || !protocol->decoder->alloc) continue;
+        if((protocol->flag & SubGhzProtocolFlag_Decodable) == 0) continue;
+
+        SubGhzBenchmarkDecoder* item = &benchmark.decoders[benchmark.decoders_count++];
+        memset(item, 0, sizeof(SubGhzBenchmarkDecoder));
+        item->decoder = protocol->decoder->alloc(benchmark.environment);
+        subghz_protocol_decoder_base_set_decoder_callback(
+            item->decoder, subghz_benchmark_decoder_callback, item);
+    }
+}
+
+static void subghz_benchmark_decoders_free(void) {
+    for(size_t d = 0; d < benchmark.decoders_count; d++) {
+        SubGhzProtocolDecoderBase* decoder = benchmark.decoders[d].decoder;
+        decoder->protocol->decoder->free(decoder);
+    }
+    free(benchmark.decoders);
+    benchmark.decoders = NULL;
+    benchmark.decoders_count = 0;
+}
+
+/** Replay every RAW file of the corpus
+ *
+ * @param storage Storage instance
+ * @param receiver receiver to replay through, or NULL to feed each decoder separately
+ */
+static void subghz_benchmark_replay(Storage* storage, SubGhzReceiver* receiver) {
+    File* dir = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    char* name = malloc(BENCHMARK_NAME_SIZE);
+
+    if(storage_dir_open(dir, BENCHMARK_CORPUS_DIR_NAME)) {
+        FileInfo fileinfo;
+        while(storage_dir_read(dir, &fileinfo, name, BENCHMARK_NAME_SIZE)) {
+            if(file_info_is_dir(&fileinfo)) continue;
+            furi_string_printf(path, "%s/%s", BENCHMARK_CORPUS_DIR_NAME, name);
+            if(!furi_string_end_with(path, ".sub")) continue;
+
+            size_t count = subghz_benchmark_load(storage, furi_string_get_cstr(path));
+            if(!count) continue;
+
+            if(receiver) {
+                benchmark.files++;
+                benchmark.pulses_total += count;
+                subghz_benchmark_run_receiver(receiver, count);
+            } else {
+                subghz_benchmark_run_decoders(count);
+            }
+        }
+    }
+    storage_dir_close(dir);
+
+    free(name);
+    furi_string_free(path);
+    storage_file_free(dir);
+}
+
+static void subghz_benchmark_report(void) {
+    uint64_t cpu_hz = (uint64_t)furi_hal_cortex_instructions_per_microsecond() * 1000000;
+    uint64_t pulses = benchmark.pulses_total;
+
+    printf(
+        "SubGhz receiver: %zu files, %zu pulses, %lu pulses/s, %lu cycles/pulse, "
+        "%zu allocs, %zu decoded\r\n",
+        benchmark.files,
+        benchmark.pulses_total,
+        (uint32_t)(benchmark.receiver_cycles ? pulses * cpu_hz / benchmark.receiver_cycles : 0),
+        (uint32_t)(benchmark.receiver_cycles / pulses),
+        benchmark.receiver_allocs,
+        benchmark.receiver_decoded);
+
+    uint64_t cycles_total = 0;
+    for(size_t d = 0; d < benchmark.decoders_count; d++) {
+        SubGhzBenchmarkDecoder* item = &benchmark.decoders[d];
+        cycles_total += item->cycles;
+        printf(
+            "  %-24s %4lu.%02lu cycles/pulse %5zu allocs %4zu decoded\r\n",
+            item->decoder->protocol->name,
+            (uint32_t)(item->cycles / pulses),
+            (uint32_t)(item->cycles * 100 / pulses % 100),
+            item->allocs,
+            item->decoded);
+    }
+    printf(
+        "SubGhz decoders: %zu protocols, %lu cycles/pulse total\r\n",
+        benchmark.decoders_count,
+        (uint32_t)(cycles_total / pulses));
+}
+
+static void subghz_benchmark_init(void) {
+    memset(&benchmark, 0, sizeof(SubGhzBenchmark));
+
+    benchmark.environment = subghz_environment_alloc();
+    subghz_environment_load_keystore(benchmark.environment, KEYSTORE_DIR_NAME);
+    subghz_environment_set_nice_flor_s_rainbow_table_file_name(
+        benchmark.environment, NICE_FLOR_S_DIR_NAME);
+    subghz_environment_set_alutech_at_4n_rainbow_table_file_name(
+        benchmark.environment, ALUTECH_AT_4N_DIR_NAME);
+    subghz_environment_set_protocol_registry(
+        benchmark.environment, (void*)&subghz_protocol_registry);
+
+    benchmark.pulses = malloc(sizeof(LevelDuration) * BENCHMARK_MAX_PULSES);
+    benchmark.raw = malloc(sizeof(int32_t) * BENCHMARK_MAX_PULSES);
+}
+
+static void subghz_benchmark_deinit(void) {
+    free(benchmark.raw);
+    free(benchmark.pulses);
+    subghz_environment_free(benchmark.environment);
+}
+
+MU_TEST(subghz_benchmark_decode_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    // Same setup as SubGhz app receiver
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(benchmark.environment);
+    subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_prefilter(receiver, true);
+    subghz_receiver_set_rx_callback(receiver, subghz_benchmark_receiver_callback, NULL);
+    subghz_benchmark_replay(storage, receiver);
+    subghz_receiver_free(receiver);
+
+    mu_assert(benchmark.pulses_total, "Benchmark corpus is empty\r\n");
+
+    // Per protocol cost, receiver is freed to keep only one set of decoders in RAM
+    subghz_benchmark_decoders_alloc();
+    subghz_benchmark_replay(storage, NULL);
+    subghz_benchmark_report();
+    subghz_benchmark_decoders_free();
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(subghz_benchmark) {
+    subghz_benchmark_init();
+    MU_RUN_TEST(subghz_benchmark_decode_test);
+    subghz_benchmark_deinit();
+}
+
+int run_minunit_test_subghz_benchmark() {
+    MU_RUN_SUITE(subghz_benchmark);
+    return MU_EXIT_CODE;
+}
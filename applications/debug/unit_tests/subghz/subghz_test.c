@@ -17,6 +17,7 @@
 #define ALUTECH_AT_4N_DIR_NAME EXT_PATH("subghz/assets/alutech_at_4n")
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
+#define TEST_VARINT_RAW_NAME EXT_PATH("unit_tests/subghz/princeton_raw_varint.sub")
 #define TEST_TIMEOUT 10000
 
 static SubGhzEnvironment* environment_handler;
@@ -222,14 +223,17 @@ typedef enum {
     SubGhzHalAsyncTxTestTypeResetStart,
     SubGhzHalAsyncTxTestTypeResetMid,
     SubGhzHalAsyncTxTestTypeResetEnd,
+    SubGhzHalAsyncTxTestTypeWaitMid,
 } SubGhzHalAsyncTxTestType;
 
 typedef struct {
     SubGhzHalAsyncTxTestType type;
     size_t pos;
+    size_t waits;
 } SubGhzHalAsyncTxTest;
 
 #define SUBGHZ_HAL_TEST_DURATION 1
+#define SUBGHZ_HAL_TEST_WAITS 10
 
 static LevelDuration subghz_hal_async_tx_test_yield(void* context) {
     SubGhzHalAsyncTxTest* test = context;
@@ -311,6 +315,21 @@ static LevelDuration subghz_hal_async_tx_test_yield(void* context) {
         } else {
             furi_crash("Yield after reset");
         }
+    } else if(test->type == SubGhzHalAsyncTxTestTypeWaitMid) {
+        // Past initial prefetch, so wait is seen by prefetch thread
+        if(test->pos == API_HAL_SUBGHZ_ASYNC_TX_BUFFER_FULL * 6 &&
+           test->waits < SUBGHZ_HAL_TEST_WAITS) {
+            test->waits++;
+            return level_duration_wait();
+        } else if(test->pos < API_HAL_SUBGHZ_ASYNC_TX_BUFFER_FULL * 8) {
+            test->pos++;
+            return level_duration_make(is_odd, SUBGHZ_HAL_TEST_DURATION);
+        } else if(test->pos == API_HAL_SUBGHZ_ASYNC_TX_BUFFER_FULL * 8) {
+            test->pos++;
+            return level_duration_reset();
+        } else {
+            furi_crash("Yield after reset");
+        }
     } else {
         furi_crash("Programming error");
     }
@@ -364,6 +383,9 @@ MU_TEST(subghz_hal_async_tx_test) {
     mu_assert(
         subghz_hal_async_tx_test_run(SubGhzHalAsyncTxTestTypeResetEnd),
         "Test furi_hal_async_tx reset end");
+    mu_assert(
+        subghz_hal_async_tx_test_run(SubGhzHalAsyncTxTestTypeWaitMid),
+        "Test furi_hal_async_tx wait mid");
 }
 
 //test decoders
@@ -824,6 +846,20 @@ MU_TEST(subghz_decoder_acurite_592txr_test) {
         "Test decoder " WS_PROTOCOL_ACURITE_592TXR_NAME " error\r\n");
 }
 
+MU_TEST(subghz_decoder_varint_raw_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(
+        subghz_protocol_raw_file_convert_to_varint(
+            storage, EXT_PATH("unit_tests/subghz/Princeton_raw.sub"), TEST_VARINT_RAW_NAME),
+        "Convert RAW to varint error\r\n");
+
+    bool decoded = subghz_decoder_test(TEST_VARINT_RAW_NAME, SUBGHZ_PROTOCOL_PRINCETON_NAME);
+    storage_simply_remove(storage, TEST_VARINT_RAW_NAME);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(decoded, "Test decoder varint RAW error\r\n");
+}
+
 MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
@@ -903,6 +939,7 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dooya_test);
     MU_RUN_TEST(subghz_encoder_mastercode_test);
     MU_RUN_TEST(subghz_decoder_acurite_592txr_test);
+    MU_RUN_TEST(subghz_decoder_varint_raw_test);
 
     MU_RUN_TEST(subghz_random_test);
     subghz_test_deinit();
@@ -17,16 +17,22 @@ int run_minunit_test_rpc();
 int run_minunit_test_manifest();
 int run_minunit_test_flipper_format();
 int run_minunit_test_flipper_format_string();
+int run_minunit_test_flipper_format_benchmark();
 int run_minunit_test_stream();
+int run_minunit_test_stream_benchmark();
 int run_minunit_test_storage();
+int run_minunit_test_storage_benchmark();
 int run_minunit_test_subghz();
+int run_minunit_test_subghz_benchmark();
 int run_minunit_test_dirwalk();
 int run_minunit_test_power();
 int run_minunit_test_protocol_dict();
 int run_minunit_test_lfrfid_protocols();
+int run_minunit_test_lfrfid_benchmark();
 int run_minunit_test_nfc();
 int run_minunit_test_bit_lib();
 int run_minunit_test_float_tools();
+int run_minunit_test_profiler();
 int run_minunit_test_bt();
 int run_minunit_test_dialogs_file_browser_options();
 
@@ -43,20 +49,26 @@ const UnitTest unit_tests[] = {
     {.name = "furi_hal_crypto", .entry = run_minunit_test_furi_hal_crypto},
     {.name = "furi_string", .entry = run_minunit_test_furi_string},
     {.name = "storage", .entry = run_minunit_test_storage},
+    {.name = "storage_benchmark", .entry = run_minunit_test_storage_benchmark},
     {.name = "stream", .entry = run_minunit_test_stream},
+    {.name = "stream_benchmark", .entry = run_minunit_test_stream_benchmark},
     {.name = "dirwalk", .entry = run_minunit_test_dirwalk},
     {.name = "manifest", .entry = run_minunit_test_manifest},
     {.name = "flipper_format", .entry = run_minunit_test_flipper_format},
     {.name = "flipper_format_string", .entry = run_minunit_test_flipper_format_string},
+    {.name = "flipper_format_benchmark", .entry = run_minunit_test_flipper_format_benchmark},
     {.name = "rpc", .entry = run_minunit_test_rpc},
     {.name = "subghz", .entry = run_minunit_test_subghz},
+    {.name = "subghz_benchmark", .entry = run_minunit_test_subghz_benchmark},
     {.name = "infrared", .entry = run_minunit_test_infrared},
     {.name = "nfc", .entry = run_minunit_test_nfc},
     {.name = "power", .entry = run_minunit_test_power},
     {.name = "protocol_dict", .entry = run_minunit_test_protocol_dict},
     {.name = "lfrfid", .entry = run_minunit_test_lfrfid_protocols},
+    {.name = "lfrfid_benchmark", .entry = run_minunit_test_lfrfid_benchmark},
     {.name = "bit_lib", .entry = run_minunit_test_bit_lib},
     {.name = "float_tools", .entry = run_minunit_test_float_tools},
+    {.name = "profiler", .entry = run_minunit_test_profiler},
     {.name = "bt", .entry = run_minunit_test_bt},
     {.name = "dialogs_file_browser_options",
      .entry = run_minunit_test_dialogs_file_browser_options},
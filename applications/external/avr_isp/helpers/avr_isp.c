@@ -7,6 +7,18 @@
 #define AVR_ISP_PROG_TX_RX_BUF_SIZE 320
 #define TAG "AvrIsp"
 
+#define AVR_ISP_SPI_BATCH_CMDS 32 // 4 byte commands sent in one SPI transfer
+#define AVR_ISP_FLASH_POLL_TIMEOUT_MS 30
+#define AVR_ISP_FLASH_WAIT_MS 5
+#define AVR_ISP_EEPROM_POLL_TIMEOUT_MS 10
+#define AVR_ISP_EEPROM_WAIT_MS 10
+#define AVR_ISP_NO_POLL (-1)
+
+typedef struct {
+    uint8_t data[AVR_ISP_SPI_BATCH_CMDS * 4];
+    size_t count;
+} AvrIspSpiBatch;
+
 struct AvrIsp {
     AvrIspSpiSw* spi;
     bool pmode;
@@ -48,6 +60,32 @@ uint8_t avr_isp_spi_transaction(
     return avr_isp_spi_sw_txrx(instance->spi, data);
 }
 
+static void avr_isp_spi_batch_flush(AvrIsp* instance, AvrIspSpiBatch* batch) {
+    avr_isp_spi_sw_txrx_buffer(instance->spi, batch->data, batch->count * 4);
+    batch->count = 0;
+}
+
+static void avr_isp_spi_batch_add(
+    AvrIsp* instance,
+    AvrIspSpiBatch* batch,
+    uint8_t cmd,
+    uint8_t addr_hi,
+    uint8_t addr_lo,
+    uint8_t data) {
+    if(batch->count == AVR_ISP_SPI_BATCH_CMDS) avr_isp_spi_batch_flush(instance, batch);
+
+    uint8_t* buf = &batch->data[batch->count++ * 4];
+    buf[0] = cmd;
+    buf[1] = addr_hi;
+    buf[2] = addr_lo;
+    buf[3] = data;
+}
+
+/** Reply to command at index, valid after flush */
+static inline uint8_t avr_isp_spi_batch_reply(AvrIspSpiBatch* batch, size_t index) {
+    return batch->data[index * 4 + 3];
+}
+
 static bool avr_isp_set_pmode(AvrIsp* instance, uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
     furi_assert(instance);
 
@@ -161,24 +199,49 @@ bool avr_isp_auto_set_spi_speed_start_pmode(AvrIsp* instance) {
     return false;
 }
 
-static void avr_isp_commit(AvrIsp* instance, uint16_t addr, uint8_t data) {
-    furi_assert(instance);
+/** Wait for self-timed write to finish
+ *
+ * Memory reads back as 0xFF while it is being written, so a byte that was written
+ * with other value is polled. Without such byte full write time is waited.
+ */
+static void avr_isp_wait_write(
+    AvrIsp* instance,
+    uint8_t read_cmd,
+    uint16_t addr,
+    bool poll,
+    uint32_t poll_timeout_ms,
+    uint32_t wait_ms) {
+    if(!poll) {
+        furi_delay_ms(wait_ms);
+        return;
+    }
 
-    avr_isp_spi_transaction(instance, AVR_ISP_COMMIT(addr));
-    /* polling flash */
-    if(data == 0xFF) {
-        furi_delay_ms(5);
-    } else {
-        /* polling flash */
-        uint32_t starttime = furi_get_tick();
-        while((furi_get_tick() - starttime) < 30) {
-            if(avr_isp_spi_transaction(instance, AVR_ISP_READ_FLASH_HI(addr)) != 0xFF) {
-                break;
-            };
+    uint32_t starttime = furi_get_tick();
+    while((furi_get_tick() - starttime) < poll_timeout_ms) {
+        if(avr_isp_spi_transaction(instance, read_cmd, (addr >> 8) & 0xFF, addr & 0xFF, 0x00) !=
+           0xFF) {
+            break;
         }
     }
 }
 
+/** Write loaded page and wait for it
+ *
+ * @param      poll_byte  byte address of loaded byte that is not 0xFF, or AVR_ISP_NO_POLL
+ */
+static void avr_isp_commit(AvrIsp* instance, uint16_t addr, int32_t poll_byte) {
+    furi_assert(instance);
+
+    avr_isp_spi_transaction(instance, AVR_ISP_COMMIT(addr));
+    avr_isp_wait_write(
+        instance,
+        (poll_byte & 1) ? 0x28 : 0x20,
+        poll_byte >> 1,
+        poll_byte != AVR_ISP_NO_POLL,
+        AVR_ISP_FLASH_POLL_TIMEOUT_MS,
+        AVR_ISP_FLASH_WAIT_MS);
+}
+
 static uint16_t avr_isp_current_page(AvrIsp* instance, uint32_t addr, uint16_t page_size) {
     furi_assert(instance);
 
@@ -213,19 +276,27 @@ static bool avr_isp_flash_write_pages(
     uint32_t data_size) {
     furi_assert(instance);
 
+    AvrIspSpiBatch batch = {0};
     size_t x = 0;
     uint16_t page = avr_isp_current_page(instance, addr, page_size);
+    int32_t poll_byte = AVR_ISP_NO_POLL;
 
     while(x < data_size) {
         if(page != avr_isp_current_page(instance, addr, page_size)) {
-            avr_isp_commit(instance, page, data[x - 1]);
+            avr_isp_spi_batch_flush(instance, &batch);
+            avr_isp_commit(instance, page, poll_byte);
             page = avr_isp_current_page(instance, addr, page_size);
+            poll_byte = AVR_ISP_NO_POLL;
         }
-        avr_isp_spi_transaction(instance, AVR_ISP_WRITE_FLASH_LO(addr, data[x++]));
-        avr_isp_spi_transaction(instance, AVR_ISP_WRITE_FLASH_HI(addr, data[x++]));
+        if(data[x] != 0xFF) poll_byte = addr << 1;
+        if(data[x + 1] != 0xFF) poll_byte = (addr << 1) | 1;
+        avr_isp_spi_batch_add(instance, &batch, AVR_ISP_WRITE_FLASH_LO(addr, data[x]));
+        avr_isp_spi_batch_add(instance, &batch, AVR_ISP_WRITE_FLASH_HI(addr, data[x + 1]));
+        x += 2;
         addr++;
     }
-    avr_isp_commit(instance, page, data[x - 1]);
+    avr_isp_spi_batch_flush(instance, &batch);
+    avr_isp_commit(instance, page, poll_byte);
     return true;
 }
 
@@ -243,14 +314,50 @@ bool avr_isp_erase_chip(AvrIsp* instance) {
     return ret;
 }
 
-static bool
-    avr_isp_eeprom_write(AvrIsp* instance, uint16_t addr, uint8_t* data, uint32_t data_size) {
+static void avr_isp_eeprom_wait_write(AvrIsp* instance, uint16_t addr, bool poll) {
+    avr_isp_wait_write(
+        instance, 0xA0, addr, poll, AVR_ISP_EEPROM_POLL_TIMEOUT_MS, AVR_ISP_EEPROM_WAIT_MS);
+}
+
+static bool avr_isp_eeprom_write(
+    AvrIsp* instance,
+    uint16_t addr,
+    uint16_t page_size,
+    uint8_t* data,
+    uint32_t data_size) {
     furi_assert(instance);
 
-    for(uint16_t i = 0; i < data_size; i++) {
-        avr_isp_spi_transaction(instance, AVR_ISP_WRITE_EEPROM(addr, data[i]));
-        furi_delay_ms(10);
-        addr++;
+    if(page_size <= 1) {
+        for(uint32_t i = 0; i < data_size; i++) {
+            avr_isp_spi_transaction(instance, AVR_ISP_WRITE_EEPROM(addr, data[i]));
+            avr_isp_eeprom_wait_write(instance, addr, data[i] != 0xFF);
+            addr++;
+        }
+        return true;
+    }
+
+    // Page mode, all bytes of page are written at once in single write time
+    AvrIspSpiBatch batch = {0};
+    uint32_t i = 0;
+    while(i < data_size) {
+        uint16_t page = addr - addr % page_size;
+        uint16_t poll_addr = 0;
+        bool poll = false;
+
+        do {
+            if(data[i] != 0xFF) {
+                poll_addr = addr;
+                poll = true;
+            }
+            avr_isp_spi_batch_add(
+                instance, &batch, AVR_ISP_LOAD_EEPROM_PAGE(addr % page_size, data[i]));
+            i++;
+            addr++;
+        } while((i < data_size) && (addr % page_size));
+
+        avr_isp_spi_batch_add(instance, &batch, AVR_ISP_WRITE_EEPROM_PAGE(page));
+        avr_isp_spi_batch_flush(instance, &batch);
+        avr_isp_eeprom_wait_write(instance, poll_addr, poll);
     }
     return true;
 }
@@ -275,7 +382,7 @@ bool avr_isp_write_page(
 
     case STK_SET_EEPROM_TYPE:
         if((addr + data_size) <= mem_size) {
-            ret = avr_isp_eeprom_write(instance, addr, data, data_size);
+            ret = avr_isp_eeprom_write(instance, addr, page_size, data, data_size);
         }
         break;
 
@@ -296,10 +403,19 @@ static bool avr_isp_flash_read_page(
     furi_assert(instance);
 
     if(page_size > data_size) return false;
-    for(uint16_t i = 0; i < page_size; i += 2) {
-        data[i] = avr_isp_spi_transaction(instance, AVR_ISP_READ_FLASH_LO(addr));
-        data[i + 1] = avr_isp_spi_transaction(instance, AVR_ISP_READ_FLASH_HI(addr));
-        addr++;
+
+    AvrIspSpiBatch batch = {0};
+    for(uint16_t i = 0; i < page_size; i += AVR_ISP_SPI_BATCH_CMDS) {
+        uint16_t count = MIN((uint16_t)(page_size - i), (uint16_t)AVR_ISP_SPI_BATCH_CMDS);
+        for(uint16_t j = 0; j < count; j += 2) {
+            avr_isp_spi_batch_add(instance, &batch, AVR_ISP_READ_FLASH_LO(addr));
+            avr_isp_spi_batch_add(instance, &batch, AVR_ISP_READ_FLASH_HI(addr));
+            addr++;
+        }
+        avr_isp_spi_batch_flush(instance, &batch);
+        for(uint16_t j = 0; j < count; j++) {
+            data[i + j] = avr_isp_spi_batch_reply(&batch, j);
+        }
     }
     return true;
 }
@@ -313,9 +429,18 @@ static bool avr_isp_eeprom_read_page(
     furi_assert(instance);
 
     if(page_size > data_size) return false;
-    for(uint16_t i = 0; i < page_size; i++) {
-        data[i] = avr_isp_spi_transaction(instance, AVR_ISP_READ_EEPROM(addr));
-        addr++;
+
+    AvrIspSpiBatch batch = {0};
+    for(uint16_t i = 0; i < page_size; i += AVR_ISP_SPI_BATCH_CMDS) {
+        uint16_t count = MIN((uint16_t)(page_size - i), (uint16_t)AVR_ISP_SPI_BATCH_CMDS);
+        for(uint16_t j = 0; j < count; j++) {
+            avr_isp_spi_batch_add(instance, &batch, AVR_ISP_READ_EEPROM(addr));
+            addr++;
+        }
+        avr_isp_spi_batch_flush(instance, &batch);
+        for(uint16_t j = 0; j < count; j++) {
+            data[i + j] = avr_isp_spi_batch_reply(&batch, j);
+        }
     }
     return true;
 }
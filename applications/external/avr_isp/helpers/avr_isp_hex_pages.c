@@ -0,0 +1,172 @@
+#include "avr_isp_hex_pages.h"
+#include "flipper_i32hex_file.h"
+
+#define TAG "AvrIspHexPages"
+
+#define AVR_ISP_HEX_PAGES_COUNT 4
+#define AVR_ISP_HEX_PAGES_RECORD_SIZE 288
+#define AVR_ISP_HEX_PAGES_WAIT_MS 100
+
+struct AvrIspHexPages {
+    FuriThread* thread;
+    volatile bool running;
+    bool finished;
+
+    FuriString* file_path;
+    uint32_t start_addr;
+    uint16_t page_size;
+
+    AvrIspHexPage pages[AVR_ISP_HEX_PAGES_COUNT];
+    uint8_t* data;
+    FuriMessageQueue* free_queue;
+    FuriMessageQueue* ready_queue;
+};
+
+static AvrIspHexPage* avr_isp_hex_pages_take_free(AvrIspHexPages* instance) {
+    AvrIspHexPage* page = NULL;
+    while(instance->running) {
+        if(furi_message_queue_get(instance->free_queue, &page, AVR_ISP_HEX_PAGES_WAIT_MS) ==
+           FuriStatusOk) {
+            memset(page->data, 0xFF, page->size);
+            page->begin = page->size;
+            page->end = 0;
+            break;
+        }
+    }
+    return page;
+}
+
+static void avr_isp_hex_pages_put_ready(AvrIspHexPages* instance, AvrIspHexPage* page) {
+    // Ready queue fits all blocks and end marker, never blocks
+    furi_check(furi_message_queue_put(instance->ready_queue, &page, 0) == FuriStatusOk);
+}
+
+static int32_t avr_isp_hex_pages_thread(void* context) {
+    AvrIspHexPages* instance = context;
+
+    uint8_t record[AVR_ISP_HEX_PAGES_RECORD_SIZE] = {0};
+    uint32_t addr = instance->start_addr;
+    AvrIspHexPage* page = NULL;
+
+    FlipperI32HexFile* flipper_hex =
+        flipper_i32hex_file_open_read(furi_string_get_cstr(instance->file_path));
+    FlipperI32HexFileRet flipper_hex_ret =
+        flipper_i32hex_file_i32hex_to_bin_get_data(flipper_hex, record, sizeof(record));
+
+    while(instance->running && ((flipper_hex_ret.status == FlipperI32HexFileStatusData) ||
+                                (flipper_hex_ret.status == FlipperI32HexFileStatusUdateAddr))) {
+        if(flipper_hex_ret.status == FlipperI32HexFileStatusUdateAddr) {
+            addr = record[0] << 24 | record[1] << 16;
+        } else {
+            uint32_t i = 0;
+            while(i < flipper_hex_ret.data_size) {
+                uint32_t page_addr = addr - addr % instance->page_size;
+                if(page && page->addr != page_addr) {
+                    avr_isp_hex_pages_put_ready(instance, page);
+                    page = NULL;
+                }
+                if(!page) {
+                    page = avr_isp_hex_pages_take_free(instance);
+                    if(!page) break;
+                    page->addr = page_addr;
+                }
+
+                uint16_t offset = addr - page_addr;
+                uint16_t count =
+                    MIN((uint16_t)(flipper_hex_ret.data_size - i),
+                        (uint16_t)(instance->page_size - offset));
+                memcpy(page->data + offset, record + i, count);
+                page->begin = MIN(page->begin, offset);
+                page->end = MAX(page->end, (uint16_t)(offset + count));
+                i += count;
+                addr += count;
+            }
+        }
+
+        flipper_hex_ret =
+            flipper_i32hex_file_i32hex_to_bin_get_data(flipper_hex, record, sizeof(record));
+    }
+
+    if(flipper_hex_ret.status < FlipperI32HexFileStatusOK) {
+        FURI_LOG_E(TAG, "File error %d", flipper_hex_ret.status);
+    }
+    flipper_i32hex_file_close(flipper_hex);
+
+    if(page) avr_isp_hex_pages_put_ready(instance, page);
+    page = NULL;
+    avr_isp_hex_pages_put_ready(instance, page);
+
+    return 0;
+}
+
+AvrIspHexPages*
+    avr_isp_hex_pages_alloc(const char* file_path, uint32_t start_addr, uint16_t page_size) {
+    furi_assert(file_path);
+    furi_assert(page_size);
+
+    AvrIspHexPages* instance = malloc(sizeof(AvrIspHexPages));
+    instance->file_path = furi_string_alloc_set(file_path);
+    instance->start_addr = start_addr;
+    instance->page_size = page_size;
+
+    instance->data = malloc(AVR_ISP_HEX_PAGES_COUNT * page_size);
+    instance->free_queue =
+        furi_message_queue_alloc(AVR_ISP_HEX_PAGES_COUNT, sizeof(AvrIspHexPage*));
+    instance->ready_queue =
+        furi_message_queue_alloc(AVR_ISP_HEX_PAGES_COUNT + 1, sizeof(AvrIspHexPage*));
+    for(size_t i = 0; i < AVR_ISP_HEX_PAGES_COUNT; i++) {
+        AvrIspHexPage* page = &instance->pages[i];
+        page->size = page_size;
+        page->data = instance->data + i * page_size;
+        furi_check(furi_message_queue_put(instance->free_queue, &page, 0) == FuriStatusOk);
+    }
+
+    instance->running = true;
+    instance->thread = furi_thread_alloc_ex(TAG, 2048, avr_isp_hex_pages_thread, instance);
+    furi_thread_start(instance->thread);
+
+    return instance;
+}
+
+void avr_isp_hex_pages_free(AvrIspHexPages* instance) {
+    furi_assert(instance);
+
+    instance->running = false;
+    furi_thread_join(instance->thread);
+    furi_thread_free(instance->thread);
+
+    furi_message_queue_free(instance->ready_queue);
+    furi_message_queue_free(instance->free_queue);
+    free(instance->data);
+    furi_string_free(instance->file_path);
+    free(instance);
+}
+
+AvrIspHexPage* avr_isp_hex_pages_get(AvrIspHexPages* instance) {
+    furi_assert(instance);
+
+    AvrIspHexPage* page = NULL;
+    if(!instance->finished) {
+        furi_check(
+            furi_message_queue_get(instance->ready_queue, &page, FuriWaitForever) ==
+            FuriStatusOk);
+        instance->finished = (page == NULL);
+    }
+    return page;
+}
+
+void avr_isp_hex_pages_release(AvrIspHexPages* instance, AvrIspHexPage* page) {
+    furi_assert(instance);
+    furi_assert(page);
+
+    furi_check(furi_message_queue_put(instance->free_queue, &page, 0) == FuriStatusOk);
+}
+
+bool avr_isp_hex_page_is_blank(const AvrIspHexPage* page) {
+    furi_assert(page);
+
+    for(uint16_t i = page->begin; i < page->end; i++) {
+        if(page->data[i] != 0xFF) return false;
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <furi.h>
+
+/** Memory block assembled from i32hex records, bytes missing in file are 0xFF */
+typedef struct {
+    uint32_t addr; // Byte address of block, aligned to block size
+    uint16_t size; // Block size
+    uint16_t begin; // Offset of first byte present in file
+    uint16_t end; // Offset past last byte present in file
+    uint8_t* data;
+} AvrIspHexPage;
+
+/** I32hex file parsed into blocks ahead of time on separate thread,
+ * so SD access and parsing overlap with programming
+ */
+typedef struct AvrIspHexPages AvrIspHexPages;
+
+/** Open file and start parsing
+ *
+ * @param      file_path   path to i32hex file
+ * @param      start_addr  byte address of first record until address record
+ * @param      page_size   block size
+ *
+ * @return     AvrIspHexPages instance
+ */
+AvrIspHexPages*
+    avr_isp_hex_pages_alloc(const char* file_path, uint32_t start_addr, uint16_t page_size);
+
+/** Stop parsing and close file */
+void avr_isp_hex_pages_free(AvrIspHexPages* instance);
+
+/** Take next block in file order, waits for parser
+ *
+ * @return     block, NULL at end of file or on file error
+ */
+AvrIspHexPage* avr_isp_hex_pages_get(AvrIspHexPages* instance);
+
+/** Give block back to parser */
+void avr_isp_hex_pages_release(AvrIspHexPages* instance, AvrIspHexPage* page);
+
+/** Check if block holds erased memory only */
+bool avr_isp_hex_page_is_blank(const AvrIspHexPage* page);
@@ -6,6 +6,7 @@
 #include "../lib/driver/avr_isp_chip_arr.h"
 
 #include "flipper_i32hex_file.h"
+#include "avr_isp_hex_pages.h"
 #include <flipper_format/flipper_format.h>
 
 #include <furi.h>
@@ -15,6 +16,9 @@
 #define NAME_PATERN_FLASH_FILE "flash.hex"
 #define NAME_PATERN_EEPROM_FILE "eeprom.hex"
 
+// Smallest block taken from hex parser, small chip pages are grouped in one block
+#define AVR_ISP_WORKER_RW_BLOCK_SIZE_MIN 32
+
 struct AvrIspWorkerRW {
     AvrIsp* avr_isp;
     FuriThread* thread;
@@ -518,6 +522,27 @@ void avr_isp_worker_rw_read_dump_start(
     furi_thread_flags_set(furi_thread_get_id(instance->thread), AvrIspWorkerRWEvtReading);
 }
 
+static uint16_t avr_isp_worker_rw_block_size(int32_t page_size) {
+    // Unknown page size is negative
+    return MAX(page_size, (int32_t)AVR_ISP_WORKER_RW_BLOCK_SIZE_MIN);
+}
+
+static void avr_isp_worker_rw_log_mismatch(
+    uint32_t addr,
+    const uint8_t* expected,
+    const uint8_t* actual,
+    uint32_t size) {
+    FURI_LOG_E(TAG, "Addr: 0x%04lX", addr);
+    for(uint32_t i = 0; i < size; i++) {
+        FURI_LOG_RAW_E("%02X ", expected[i]);
+    }
+    FURI_LOG_RAW_E("\r\n");
+    for(uint32_t i = 0; i < size; i++) {
+        FURI_LOG_RAW_E("%02X ", actual[i]);
+    }
+    FURI_LOG_RAW_E("\r\n");
+}
+
 static bool avr_isp_worker_rw_verification_flash(AvrIspWorkerRW* instance, const char* file_path) {
     furi_assert(instance);
     furi_assert(file_path);
@@ -527,73 +552,52 @@ static bool avr_isp_worker_rw_verification_flash(AvrIspWorkerRW* instance, const
     instance->progress_flash = 0.0;
     bool ret = true;
 
-    FlipperI32HexFile* flipper_hex_flash = flipper_i32hex_file_open_read(file_path);
-
     uint8_t data_read_flash[272] = {0};
-    uint8_t data_read_hex[272] = {0};
+    uint16_t block_size =
+        avr_isp_worker_rw_block_size(avr_isp_chip_arr[instance->chip_arr_ind].pagesize);
+    furi_check(block_size <= sizeof(data_read_flash));
 
-    uint32_t addr = avr_isp_chip_arr[instance->chip_arr_ind].flashoffset;
     bool send_extended_addr = ((avr_isp_chip_arr[instance->chip_arr_ind].flashsize / 2) > 0x10000);
     uint8_t extended_addr = 0;
 
-    FlipperI32HexFileRet flipper_hex_ret = flipper_i32hex_file_i32hex_to_bin_get_data(
-        flipper_hex_flash, data_read_hex, sizeof(data_read_hex));
-
-    while(((flipper_hex_ret.status == FlipperI32HexFileStatusData) ||
-           (flipper_hex_ret.status == FlipperI32HexFileStatusUdateAddr)) &&
-          ret) {
-        switch(flipper_hex_ret.status) {
-        case FlipperI32HexFileStatusData:
-
-            if(send_extended_addr) {
-                if(extended_addr <= ((addr >> 16) & 0xFF)) {
-                    avr_isp_write_extended_addr(instance->avr_isp, extended_addr);
-                    extended_addr = ((addr >> 16) & 0xFF) + 1;
-                }
-            }
-
-            avr_isp_read_page(
-                instance->avr_isp,
-                STK_SET_FLASH_TYPE,
-                (uint16_t)addr,
-                flipper_hex_ret.data_size,
-                data_read_flash,
-                sizeof(data_read_flash));
+    AvrIspHexPages* hex_pages = avr_isp_hex_pages_alloc(
+        file_path, avr_isp_chip_arr[instance->chip_arr_ind].flashoffset * 2, block_size);
+    AvrIspHexPage* page;
 
-            if(memcmp(data_read_hex, data_read_flash, flipper_hex_ret.data_size) != 0) {
-                ret = false;
+    while(ret && (page = avr_isp_hex_pages_get(hex_pages))) {
+        uint32_t addr = page->addr / 2;
 
-                FURI_LOG_E(TAG, "Verification flash error");
-                FURI_LOG_E(TAG, "Addr: 0x%04lX", addr);
-                for(uint32_t i = 0; i < flipper_hex_ret.data_size; i++) {
-                    FURI_LOG_RAW_E("%02X ", data_read_hex[i]);
-                }
-                FURI_LOG_RAW_E("\r\n");
-                for(uint32_t i = 0; i < flipper_hex_ret.data_size; i++) {
-                    FURI_LOG_RAW_E("%02X ", data_read_flash[i]);
-                }
-                FURI_LOG_RAW_E("\r\n");
+        if(send_extended_addr) {
+            if(extended_addr <= ((addr >> 16) & 0xFF)) {
+                avr_isp_write_extended_addr(instance->avr_isp, extended_addr);
+                extended_addr = ((addr >> 16) & 0xFF) + 1;
             }
+        }
 
-            addr += flipper_hex_ret.data_size / 2;
-            instance->progress_flash =
-                (float)(addr) / ((float)avr_isp_chip_arr[instance->chip_arr_ind].flashsize / 2.0f);
-            break;
-
-        case FlipperI32HexFileStatusUdateAddr:
-            addr = (data_read_hex[0] << 24 | data_read_hex[1] << 16) / 2;
-            break;
-
-        default:
-            furi_crash(TAG " Incorrect status.");
-            break;
+        avr_isp_read_page(
+            instance->avr_isp,
+            STK_SET_FLASH_TYPE,
+            (uint16_t)addr,
+            page->size,
+            data_read_flash,
+            sizeof(data_read_flash));
+
+        if(memcmp(
+               page->data + page->begin,
+               data_read_flash + page->begin,
+               page->end - page->begin) != 0) {
+            ret = false;
+            FURI_LOG_E(TAG, "Verification flash error");
+            avr_isp_worker_rw_log_mismatch(addr, page->data, data_read_flash, page->size);
         }
 
-        flipper_hex_ret = flipper_i32hex_file_i32hex_to_bin_get_data(
-            flipper_hex_flash, data_read_hex, sizeof(data_read_hex));
+        instance->progress_flash =
+            (float)(addr + page->size / 2) /
+            ((float)avr_isp_chip_arr[instance->chip_arr_ind].flashsize / 2.0f);
+        avr_isp_hex_pages_release(hex_pages, page);
     }
 
-    flipper_i32hex_file_close(flipper_hex_flash);
+    avr_isp_hex_pages_free(hex_pages);
     instance->progress_flash = 1.0f;
 
     return ret;
@@ -609,62 +613,40 @@ static bool
     instance->progress_eeprom = 0.0;
     bool ret = true;
 
-    FlipperI32HexFile* flipper_hex_eeprom = flipper_i32hex_file_open_read(file_path);
-
     uint8_t data_read_eeprom[272] = {0};
-    uint8_t data_read_hex[272] = {0};
+    uint16_t block_size =
+        avr_isp_worker_rw_block_size(avr_isp_chip_arr[instance->chip_arr_ind].eeprompagesize);
+    furi_check(block_size <= sizeof(data_read_eeprom));
 
-    uint32_t addr = avr_isp_chip_arr[instance->chip_arr_ind].eepromoffset;
+    AvrIspHexPages* hex_pages = avr_isp_hex_pages_alloc(
+        file_path, avr_isp_chip_arr[instance->chip_arr_ind].eepromoffset, block_size);
+    AvrIspHexPage* page;
 
-    FlipperI32HexFileRet flipper_hex_ret = flipper_i32hex_file_i32hex_to_bin_get_data(
-        flipper_hex_eeprom, data_read_hex, sizeof(data_read_hex));
+    while(ret && (page = avr_isp_hex_pages_get(hex_pages))) {
+        uint32_t addr = page->addr + page->begin;
+        uint16_t size = page->end - page->begin;
 
-    while(((flipper_hex_ret.status == FlipperI32HexFileStatusData) ||
-           (flipper_hex_ret.status == FlipperI32HexFileStatusUdateAddr)) &&
-          ret) {
-        switch(flipper_hex_ret.status) {
-        case FlipperI32HexFileStatusData:
-            avr_isp_read_page(
-                instance->avr_isp,
-                STK_SET_EEPROM_TYPE,
-                (uint16_t)addr,
-                flipper_hex_ret.data_size,
-                data_read_eeprom,
-                sizeof(data_read_eeprom));
-
-            if(memcmp(data_read_hex, data_read_eeprom, flipper_hex_ret.data_size) != 0) {
-                ret = false;
-                FURI_LOG_E(TAG, "Verification eeprom error");
-                FURI_LOG_E(TAG, "Addr: 0x%04lX", addr);
-                for(uint32_t i = 0; i < flipper_hex_ret.data_size; i++) {
-                    FURI_LOG_RAW_E("%02X ", data_read_hex[i]);
-                }
-                FURI_LOG_RAW_E("\r\n");
-                for(uint32_t i = 0; i < flipper_hex_ret.data_size; i++) {
-                    FURI_LOG_RAW_E("%02X ", data_read_eeprom[i]);
-                }
-                FURI_LOG_RAW_E("\r\n");
-            }
-
-            addr += flipper_hex_ret.data_size;
-            instance->progress_eeprom =
-                (float)(addr) / ((float)avr_isp_chip_arr[instance->chip_arr_ind].eepromsize);
-            break;
-
-        case FlipperI32HexFileStatusUdateAddr:
-            addr = (data_read_hex[0] << 24 | data_read_hex[1] << 16);
-            break;
+        avr_isp_read_page(
+            instance->avr_isp,
+            STK_SET_EEPROM_TYPE,
+            (uint16_t)addr,
+            size,
+            data_read_eeprom,
+            sizeof(data_read_eeprom));
 
-        default:
-            furi_crash(TAG " Incorrect status.");
-            break;
+        if(memcmp(page->data + page->begin, data_read_eeprom, size) != 0) {
+            ret = false;
+            FURI_LOG_E(TAG, "Verification eeprom error");
+            avr_isp_worker_rw_log_mismatch(
+                addr, page->data + page->begin, data_read_eeprom, size);
         }
 
-        flipper_hex_ret = flipper_i32hex_file_i32hex_to_bin_get_data(
-            flipper_hex_eeprom, data_read_hex, sizeof(data_read_hex));
+        instance->progress_eeprom =
+            (float)(addr + size) / ((float)avr_isp_chip_arr[instance->chip_arr_ind].eepromsize);
+        avr_isp_hex_pages_release(hex_pages, page);
     }
 
-    flipper_i32hex_file_close(flipper_hex_eeprom);
+    avr_isp_hex_pages_free(hex_pages);
     instance->progress_eeprom = 1.0f;
 
     return ret;
@@ -729,22 +711,21 @@ static void avr_isp_worker_rw_write_flash(AvrIspWorkerRW* instance, const char*
 
     FURI_LOG_D(TAG, "Write Flash %s", file_path);
 
-    uint8_t data[288] = {0};
-
-    FlipperI32HexFile* flipper_hex_flash = flipper_i32hex_file_open_read(file_path);
-
-    uint32_t addr = avr_isp_chip_arr[instance->chip_arr_ind].flashoffset;
     bool send_extended_addr = ((avr_isp_chip_arr[instance->chip_arr_ind].flashsize / 2) > 0x10000);
     uint8_t extended_addr = 0;
 
-    FlipperI32HexFileRet flipper_hex_ret =
-        flipper_i32hex_file_i32hex_to_bin_get_data(flipper_hex_flash, data, sizeof(data));
+    AvrIspHexPages* hex_pages = avr_isp_hex_pages_alloc(
+        file_path,
+        avr_isp_chip_arr[instance->chip_arr_ind].flashoffset * 2,
+        avr_isp_worker_rw_block_size(avr_isp_chip_arr[instance->chip_arr_ind].pagesize));
+    AvrIspHexPage* page;
+    bool ret = true;
 
-    while((flipper_hex_ret.status == FlipperI32HexFileStatusData) ||
-          (flipper_hex_ret.status == FlipperI32HexFileStatusUdateAddr)) {
-        switch(flipper_hex_ret.status) {
-        case FlipperI32HexFileStatusData:
+    while(ret && (page = avr_isp_hex_pages_get(hex_pages))) {
+        uint32_t addr = page->addr / 2;
 
+        // Chip is erased before writing, blank pages don't need programming
+        if(!avr_isp_hex_page_is_blank(page)) {
             if(send_extended_addr) {
                 if(extended_addr <= ((addr >> 16) & 0xFF)) {
                     avr_isp_write_extended_addr(instance->avr_isp, extended_addr);
@@ -752,35 +733,23 @@ static void avr_isp_worker_rw_write_flash(AvrIspWorkerRW* instance, const char*
                 }
             }
 
-            if(!avr_isp_write_page(
-                   instance->avr_isp,
-                   STK_SET_FLASH_TYPE,
-                   avr_isp_chip_arr[instance->chip_arr_ind].flashsize,
-                   (uint16_t)addr,
-                   avr_isp_chip_arr[instance->chip_arr_ind].pagesize,
-                   data,
-                   flipper_hex_ret.data_size)) {
-                break;
-            }
-            addr += flipper_hex_ret.data_size / 2;
-            instance->progress_flash =
-                (float)(addr) / ((float)avr_isp_chip_arr[instance->chip_arr_ind].flashsize / 2.0f);
-            break;
-
-        case FlipperI32HexFileStatusUdateAddr:
-            addr = (data[0] << 24 | data[1] << 16) / 2;
-            break;
-
-        default:
-            furi_crash(TAG " Incorrect status.");
-            break;
+            ret = avr_isp_write_page(
+                instance->avr_isp,
+                STK_SET_FLASH_TYPE,
+                avr_isp_chip_arr[instance->chip_arr_ind].flashsize,
+                (uint16_t)addr,
+                avr_isp_chip_arr[instance->chip_arr_ind].pagesize,
+                page->data,
+                page->size);
         }
 
-        flipper_hex_ret =
-            flipper_i32hex_file_i32hex_to_bin_get_data(flipper_hex_flash, data, sizeof(data));
+        instance->progress_flash =
+            (float)(addr + page->size / 2) /
+            ((float)avr_isp_chip_arr[instance->chip_arr_ind].flashsize / 2.0f);
+        avr_isp_hex_pages_release(hex_pages, page);
     }
 
-    flipper_i32hex_file_close(flipper_hex_flash);
+    avr_isp_hex_pages_free(hex_pages);
     instance->progress_flash = 1.0f;
 }
 
@@ -789,49 +758,36 @@ static void avr_isp_worker_rw_write_eeprom(AvrIspWorkerRW* instance, const char*
     furi_check(instance->avr_isp);
 
     instance->progress_eeprom = 0.0;
-    uint8_t data[288] = {0};
 
     FURI_LOG_D(TAG, "Write EEPROM %s", file_path);
 
-    FlipperI32HexFile* flipper_hex_eeprom_read = flipper_i32hex_file_open_read(file_path);
-
-    uint32_t addr = avr_isp_chip_arr[instance->chip_arr_ind].eepromoffset;
-    FlipperI32HexFileRet flipper_hex_ret =
-        flipper_i32hex_file_i32hex_to_bin_get_data(flipper_hex_eeprom_read, data, sizeof(data));
-
-    while((flipper_hex_ret.status == FlipperI32HexFileStatusData) ||
-          (flipper_hex_ret.status == FlipperI32HexFileStatusUdateAddr)) {
-        switch(flipper_hex_ret.status) {
-        case FlipperI32HexFileStatusData:
-            if(!avr_isp_write_page(
-                   instance->avr_isp,
-                   STK_SET_EEPROM_TYPE,
-                   avr_isp_chip_arr[instance->chip_arr_ind].eepromsize,
-                   (uint16_t)addr,
-                   avr_isp_chip_arr[instance->chip_arr_ind].eeprompagesize,
-                   data,
-                   flipper_hex_ret.data_size)) {
-                break;
-            }
-            addr += flipper_hex_ret.data_size;
-            instance->progress_eeprom =
-                (float)(addr) / ((float)avr_isp_chip_arr[instance->chip_arr_ind].eepromsize);
-            break;
+    AvrIspHexPages* hex_pages = avr_isp_hex_pages_alloc(
+        file_path,
+        avr_isp_chip_arr[instance->chip_arr_ind].eepromoffset,
+        avr_isp_worker_rw_block_size(avr_isp_chip_arr[instance->chip_arr_ind].eeprompagesize));
+    AvrIspHexPage* page;
+    bool ret = true;
 
-        case FlipperI32HexFileStatusUdateAddr:
-            addr = data[0] << 24 | data[1] << 16;
-            break;
+    while(ret && (page = avr_isp_hex_pages_get(hex_pages))) {
+        // Only bytes present in file, EEPROM may be kept by chip erase
+        uint32_t addr = page->addr + page->begin;
+        uint16_t size = page->end - page->begin;
 
-        default:
-            furi_crash(TAG " Incorrect status.");
-            break;
-        }
+        ret = avr_isp_write_page(
+            instance->avr_isp,
+            STK_SET_EEPROM_TYPE,
+            avr_isp_chip_arr[instance->chip_arr_ind].eepromsize,
+            (uint16_t)addr,
+            MAX(avr_isp_chip_arr[instance->chip_arr_ind].eeprompagesize, (int32_t)1),
+            page->data + page->begin,
+            size);
 
-        flipper_hex_ret = flipper_i32hex_file_i32hex_to_bin_get_data(
-            flipper_hex_eeprom_read, data, sizeof(data));
+        instance->progress_eeprom =
+            (float)(addr + size) / ((float)avr_isp_chip_arr[instance->chip_arr_ind].eepromsize);
+        avr_isp_hex_pages_release(hex_pages, page);
     }
 
-    flipper_i32hex_file_close(flipper_hex_eeprom_read);
+    avr_isp_hex_pages_free(hex_pages);
     instance->progress_eeprom = 1.0f;
 }
 
@@ -60,6 +60,14 @@ uint8_t avr_isp_spi_sw_txrx(AvrIspSpiSw* instance, uint8_t data) {
     return data;
 }
 
+void avr_isp_spi_sw_txrx_buffer(AvrIspSpiSw* instance, uint8_t* data, size_t size) {
+    furi_assert(instance);
+    furi_assert(data);
+    for(size_t i = 0; i < size; i++) {
+        data[i] = avr_isp_spi_sw_txrx(instance, data[i]);
+    }
+}
+
 void avr_isp_spi_sw_res_set(AvrIspSpiSw* instance, bool state) {
     furi_assert(instance);
     furi_hal_gpio_write(instance->res, state);
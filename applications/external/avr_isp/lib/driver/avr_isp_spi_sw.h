@@ -20,5 +20,7 @@ typedef struct AvrIspSpiSw AvrIspSpiSw;
 AvrIspSpiSw* avr_isp_spi_sw_init(AvrIspSpiSwSpeed speed);
 void avr_isp_spi_sw_free(AvrIspSpiSw* instance);
 uint8_t avr_isp_spi_sw_txrx(AvrIspSpiSw* instance, uint8_t data);
+/** Exchange buffer in place, received bytes replace sent ones */
+void avr_isp_spi_sw_txrx_buffer(AvrIspSpiSw* instance, uint8_t* data, size_t size);
 void avr_isp_spi_sw_res_set(AvrIspSpiSw* instance, bool state);
 void avr_isp_spi_sw_sck_set(AvrIspSpiSw* instance, bool state);
\ No newline at end of file
@@ -8,29 +8,51 @@
 #include "../helpers/camera_suite_speaker.h"
 #include "../helpers/camera_suite_led.h"
 
-static void draw_pixel_by_orientation(Canvas* canvas, uint8_t x, uint8_t y, uint8_t orientation) {
-    furi_assert(canvas);
-    furi_assert(x);
-    furi_assert(y);
-    furi_assert(orientation);
+// Camera rows are MSB first, XBM is LSB first.
+static uint8_t reverse_bits(uint8_t byte) {
+    byte = (byte & 0xF0) >> 4 | (byte & 0x0F) << 4;
+    byte = (byte & 0xCC) >> 2 | (byte & 0x33) << 2;
+    byte = (byte & 0xAA) >> 1 | (byte & 0x55) << 1;
+    return byte;
+}
+
+static bool frame_get_pixel(const uint8_t* pixels, uint8_t x, uint8_t y) {
+    return pixels[y * ROW_BUFFER_LENGTH + x / 8] & (0x80 >> (x % 8));
+}
+
+// Done once per frame, so drawing is one framebuffer blit instead of a dot per pixel.
+static void render_display_by_orientation(UartDumpModel* model) {
+    const uint8_t* pixels = model->pixels;
+    uint8_t* display = model->display;
 
-    switch(orientation) {
+    switch(model->orientation) {
     default:
     case 0: { // Camera rotated 0 degrees (right side up, default)
-        canvas_draw_dot(canvas, x, y);
-        break;
-    }
-    case 1: { // Camera rotated 90 degrees
-
-        canvas_draw_dot(canvas, y, FRAME_WIDTH - 1 - x);
+        for(size_t i = 0; i < FRAME_BUFFER_LENGTH; ++i) {
+            display[i] = reverse_bits(pixels[i]);
+        }
         break;
     }
-    case 2: { // Camera rotated 180 degrees (upside down)
-        canvas_draw_dot(canvas, FRAME_WIDTH - 1 - x, FRAME_HEIGHT - 1 - y);
+    case 2: { // Camera rotated 180 degrees (upside down), reversed bit order cancels out
+        for(size_t i = 0; i < FRAME_BUFFER_LENGTH; ++i) {
+            display[i] = pixels[FRAME_BUFFER_LENGTH - 1 - i];
+        }
         break;
     }
+    case 1: // Camera rotated 90 degrees
     case 3: { // Camera rotated 270 degrees
-        canvas_draw_dot(canvas, FRAME_HEIGHT - 1 - y, x);
+        // Only 64 of 128 frame columns fit the screen height.
+        memset(display, 0, FRAME_BUFFER_LENGTH);
+        for(uint8_t y = 0; y < FRAME_HEIGHT; ++y) {
+            for(uint8_t x = 0; x < FRAME_HEIGHT; ++x) {
+                bool is_set = model->orientation == 1 ?
+                                  frame_get_pixel(pixels, FRAME_WIDTH - 1 - y, x) :
+                                  frame_get_pixel(pixels, y, FRAME_HEIGHT - 1 - x);
+                if(is_set) {
+                    display[y * ROW_BUFFER_LENGTH + x / 8] |= 1 << (x % 8);
+                }
+            }
+        }
         break;
     }
     }
@@ -45,20 +67,12 @@ static void camera_suite_view_camera_draw(Canvas* canvas, void* model) {
     // Clear the screen.
     canvas_set_color(canvas, ColorBlack);
 
+    // Draw the image, already in screen orientation.
+    canvas_draw_xbm(canvas, 0, 0, FRAME_WIDTH, FRAME_HEIGHT, uartDumpModel->display);
+
     // Draw the frame.
     canvas_draw_frame(canvas, 0, 0, FRAME_WIDTH, FRAME_HEIGHT);
 
-    for(size_t p = 0; p < FRAME_BUFFER_LENGTH; ++p) {
-        uint8_t x = p % ROW_BUFFER_LENGTH; // 0 .. 15
-        uint8_t y = p / ROW_BUFFER_LENGTH; // 0 .. 63
-
-        for(uint8_t i = 0; i < 8; ++i) {
-            if((uartDumpModel->pixels[p] & (1 << (7 - i))) != 0) {
-                draw_pixel_by_orientation(canvas, (x * 8) + i, y, uartDumpModel->orientation);
-            }
-        }
-    }
-
     // Draw the guide if the camera is not initialized.
     if(!uartDumpModel->is_initialized) {
         canvas_draw_icon(canvas, 74, 16, &I_DolphinCommon_56x48);
@@ -162,6 +176,7 @@ static void
 
     for(size_t i = 0; i < FRAME_BUFFER_LENGTH; i++) {
         model->pixels[i] = 0;
+        model->display[i] = 0;
     }
 }
 
@@ -374,66 +389,77 @@ static void camera_suite_view_camera_enter(void* context) {
         true);
 }
 
-static void camera_on_irq_cb(UartIrqEvent uartIrqEvent, uint8_t data, void* context) {
-    furi_assert(uartIrqEvent);
-    furi_assert(data);
+static void camera_on_rx_cb(FuriHalUartId ch, const uint8_t* data, size_t size, void* context) {
+    UNUSED(ch);
     furi_assert(context);
 
     // Cast `context` to `CameraSuiteViewCamera*` and store it in `instance`.
     CameraSuiteViewCamera* instance = context;
 
-    // If `uartIrqEvent` is `UartIrqEventRXNE`, send the data to the
-    // `rx_stream` and set the `WorkerEventRx` flag.
-    if(uartIrqEvent == UartIrqEventRXNE) {
-        furi_stream_buffer_send(instance->rx_stream, &data, 1, 0);
-        furi_thread_flags_set(furi_thread_get_id(instance->worker_thread), WorkerEventRx);
-    }
+    // DMA hands over chunks, send them to the `rx_stream` and set the
+    // `WorkerEventRx` flag.
+    furi_stream_buffer_send(instance->rx_stream, data, size, 0);
+    furi_thread_flags_set(furi_thread_get_id(instance->worker_thread), WorkerEventRx);
 }
 
-static void process_ringbuffer(UartDumpModel* model, uint8_t const byte) {
-    furi_assert(model);
-    furi_assert(byte);
-
-    // The first HEADER_LENGTH bytes are reserved for header information.
-    if(model->ringbuffer_index < HEADER_LENGTH) {
-        // Validate the start of row characters 'Y' and ':'.
-        if(model->ringbuffer_index == 0 && byte != 'Y') {
-            // Incorrect start of frame; reset.
-            return;
-        }
-        if(model->ringbuffer_index == 1 && byte != ':') {
-            // Incorrect start of frame; reset.
-            model->ringbuffer_index = 0;
-            return;
-        }
-        if(model->ringbuffer_index == 2) {
-            // Assign the third byte as the row identifier.
-            model->row_identifier = byte;
-        }
-        model->ringbuffer_index++; // Increment index for the next byte.
-        return;
-    }
-
-    // Store pixel value directly after the header.
-    model->row_ringbuffer[model->ringbuffer_index - HEADER_LENGTH] = byte;
-    model->ringbuffer_index++; // Increment index for the next byte.
-
-    // Check whether the ring buffer is filled.
-    if(model->ringbuffer_index >= RING_BUFFER_LENGTH) {
-        model->ringbuffer_index = 0; // Reset the ring buffer index.
-        model->is_initialized = true; // Set the connection as successfully established.
-
-        // Compute the starting index for the row in the pixel buffer.
-        size_t row_start_index = model->row_identifier * ROW_BUFFER_LENGTH;
+static void publish_frame(CameraSuiteViewCamera* instance) {
+    // Swap complete frame into the model, the view is redrawn once per frame.
+    with_view_model(
+        instance->view,
+        UartDumpModel * model,
+        {
+            memcpy(model->pixels, instance->frame, FRAME_BUFFER_LENGTH);
+            render_display_by_orientation(model);
+            model->is_initialized = true;
+        },
+        true);
+}
 
-        // Ensure the row start index is within the valid range.
-        if(row_start_index > LAST_ROW_INDEX) {
-            row_start_index = 0; // Reset to a safe value in case of an overflow.
+static void process_rx_data(CameraSuiteViewCamera* instance, const uint8_t* data, size_t size) {
+    while(size > 0) {
+        // The first HEADER_LENGTH bytes are reserved for header information.
+        if(instance->row_offset < HEADER_LENGTH) {
+            uint8_t byte = *data++;
+            size--;
+
+            // Validate the start of row characters 'Y' and ':'.
+            if(instance->row_offset == 0 && byte != 'Y') {
+                // Incorrect start of frame; reset.
+                continue;
+            }
+            if(instance->row_offset == 1 && byte != ':') {
+                // Incorrect start of frame; reset.
+                instance->row_offset = 0;
+                continue;
+            }
+            if(instance->row_offset == 2) {
+                // Assign the third byte as the row identifier.
+                instance->row_identifier = byte;
+            }
+            instance->row_offset++;
+            continue;
         }
 
-        // Flush the contents of the ring buffer to the pixel buffer.
-        for(size_t i = 0; i < ROW_BUFFER_LENGTH; ++i) {
-            model->pixels[row_start_index + i] = model->row_ringbuffer[i];
+        // Copy as much of the row as this chunk has directly to the back buffer.
+        size_t received = instance->row_offset - HEADER_LENGTH;
+        size_t length = MIN(size, (size_t)(ROW_BUFFER_LENGTH - received));
+        // Rows with an out of range identifier are dropped.
+        if(instance->row_identifier < FRAME_HEIGHT) {
+            memcpy(
+                &instance->frame[instance->row_identifier * ROW_BUFFER_LENGTH + received],
+                data,
+                length);
+        }
+        data += length;
+        size -= length;
+        instance->row_offset += length;
+
+        // Check whether the row is complete.
+        if(instance->row_offset >= RING_BUFFER_LENGTH) {
+            instance->row_offset = 0;
+            if(instance->row_identifier == FRAME_HEIGHT - 1) {
+                publish_frame(instance);
+            }
         }
     }
 }
@@ -442,6 +468,7 @@ static int32_t camera_worker(void* context) {
     furi_assert(context);
 
     CameraSuiteViewCamera* instance = context;
+    uint8_t data[RX_CHUNK_LENGTH];
 
     while(1) {
         uint32_t events =
@@ -453,26 +480,9 @@ static int32_t camera_worker(void* context) {
         } else if(events & WorkerEventRx) {
             size_t length = 0;
             do {
-                size_t intended_data_size = 64;
-                uint8_t data[intended_data_size];
-                length =
-                    furi_stream_buffer_receive(instance->rx_stream, data, intended_data_size, 0);
-
-                if(length > 0) {
-                    with_view_model(
-                        instance->view,
-                        UartDumpModel * model,
-                        {
-                            for(size_t i = 0; i < length; i++) {
-                                process_ringbuffer(model, data[i]);
-                            }
-                        },
-                        false);
-                }
+                length = furi_stream_buffer_receive(instance->rx_stream, data, sizeof(data), 0);
+                process_rx_data(instance, data, length);
             } while(length > 0);
-
-            with_view_model(
-                instance->view, UartDumpModel * model, { UNUSED(model); }, true);
         }
     }
 
@@ -522,8 +532,8 @@ CameraSuiteViewCamera* camera_suite_view_camera_alloc() {
     // 115200 is the default baud rate for the ESP32-CAM.
     furi_hal_uart_set_br(UART_CH, 230400);
 
-    // Enable UART1 and set the IRQ callback.
-    furi_hal_uart_set_irq_cb(UART_CH, camera_on_irq_cb, instance);
+    // Receive with DMA, frames come nonstop and a byte interrupt each is too much.
+    furi_hal_uart_dma_rx_start(UART_CH, camera_on_rx_cb, instance);
 
     return instance;
 }
@@ -531,10 +541,12 @@ CameraSuiteViewCamera* camera_suite_view_camera_alloc() {
 void camera_suite_view_camera_free(CameraSuiteViewCamera* instance) {
     furi_assert(instance);
 
-    // Remove the IRQ callback.
-    furi_hal_uart_set_irq_cb(UART_CH, NULL, NULL);
+    // Stop DMA reception.
+    furi_hal_uart_dma_rx_stop(UART_CH);
 
-    // Free the worker thread.
+    // Stop and free the worker thread.
+    furi_thread_flags_set(furi_thread_get_id(instance->worker_thread), WorkerEventStop);
+    furi_thread_join(instance->worker_thread);
     furi_thread_free(instance->worker_thread);
 
     // Free the allocated stream buffer.
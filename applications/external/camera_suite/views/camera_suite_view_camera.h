@@ -28,9 +28,9 @@
 #define FRAME_HEIGHT 64
 #define FRAME_WIDTH 128
 #define HEADER_LENGTH 3 // 'Y', ':', and row identifier
-#define LAST_ROW_INDEX 1008
 #define RING_BUFFER_LENGTH 19
 #define ROW_BUFFER_LENGTH 16
+#define RX_CHUNK_LENGTH 256
 
 static const unsigned char bitmap_header[BITMAP_HEADER_LENGTH] = {
     0x42, 0x4D, 0x3E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x28, 0x00,
@@ -57,6 +57,11 @@ typedef struct CameraSuiteViewCamera {
     NotificationApp* notification;
     View* view;
     void* context;
+
+    // Back buffer, rows are assembled here and the model only gets complete frames
+    uint8_t frame[FRAME_BUFFER_LENGTH];
+    uint8_t row_offset;
+    uint8_t row_identifier;
 } CameraSuiteViewCamera;
 
 typedef struct UartDumpModel {
@@ -66,9 +71,7 @@ typedef struct UartDumpModel {
     int rotation_angle;
     uint32_t orientation;
     uint8_t pixels[FRAME_BUFFER_LENGTH];
-    uint8_t ringbuffer_index;
-    uint8_t row_identifier;
-    uint8_t row_ringbuffer[RING_BUFFER_LENGTH];
+    uint8_t display[FRAME_BUFFER_LENGTH]; // Screen sized XBM of pixels in current orientation
 } UartDumpModel;
 
 // Function Prototypes
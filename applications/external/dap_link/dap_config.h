@@ -27,6 +27,10 @@
 #define DAP_CONFIG_RESET_TARGET_FN dap_app_target_reset
 #define DAP_CONFIG_VENDOR_FN dap_app_vendor_cmd
 
+// SWD transfers go through timer and DMA driven sequencer, bit-banging is the fallback
+#define DAP_CONFIG_SWD_TRANSFER_FN dap_app_swd_transfer
+#define DAP_CONFIG_SETUP_CLOCK_FN dap_app_setup_clock
+
 // Attribute to use for performance-critical functions
 #define DAP_CONFIG_PERFORMANCE_ATTR
 
@@ -53,6 +57,13 @@ extern void dap_app_target_reset();
 extern void dap_app_disconnect();
 extern void dap_app_connect_swd();
 extern void dap_app_connect_jtag();
+extern int dap_app_swd_transfer(
+    int req,
+    uint32_t* data,
+    int turnaround,
+    bool data_phase,
+    int idle_cycles);
+extern void dap_app_setup_clock(int freq);
 
 //-----------------------------------------------------------------------------
 static inline void DAP_CONFIG_SWCLK_TCK_write(int value) {
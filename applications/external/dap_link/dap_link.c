@@ -6,6 +6,7 @@
 #include <furi_hal_console.h>
 #include <furi_hal_resources.h>
 #include <furi_hal_power.h>
+#include <swd_sequencer.h>
 #include <stm32wbxx_ll_usart.h>
 #include <stm32wbxx_ll_lpuart.h>
 
@@ -51,6 +52,9 @@ GpioPin flipper_dap_reset_pin;
 GpioPin flipper_dap_tdo_pin;
 GpioPin flipper_dap_tdi_pin;
 
+static SwdSequencer* dap_swd_sequencer = NULL;
+static uint32_t dap_swd_clock = DAP_CONFIG_DEFAULT_CLOCK;
+
 /***************************************************************************/
 /****************************** DAP PROCESS ********************************/
 /***************************************************************************/
@@ -235,6 +239,7 @@ static int32_t dap_process(void* p) {
 
             if(events & DapThreadEventApplyConfig) {
                 if(swd_pins_prev != app->config.swd_pins) {
+                    dap_app_swd_sequencer_stop();
                     dap_deinit_gpio(swd_pins_prev);
                     swd_pins_prev = app->config.swd_pins;
                     dap_init_gpio(swd_pins_prev);
@@ -250,6 +255,7 @@ static int32_t dap_process(void* p) {
     // deinit usb
     furi_hal_usb_set_config(usb_config_prev, NULL);
     dap_common_usb_free_name();
+    dap_app_swd_sequencer_stop();
     dap_deinit_gpio(swd_pins_prev);
     return 0;
 }
@@ -488,18 +494,49 @@ static void dap_app_free(DapApp* dap_app) {
 
 static DapApp* app_handle = NULL;
 
+static void dap_app_swd_sequencer_stop() {
+    if(dap_swd_sequencer) {
+        swd_sequencer_free(dap_swd_sequencer);
+        dap_swd_sequencer = NULL;
+    }
+}
+
 void dap_app_disconnect() {
+    dap_app_swd_sequencer_stop();
     app_handle->state.dap_mode = DapModeDisconnected;
 }
 
 void dap_app_connect_swd() {
+    if(!dap_swd_sequencer &&
+       swd_sequencer_is_supported(&flipper_dap_swclk_pin, &flipper_dap_swdio_pin)) {
+        dap_swd_sequencer = swd_sequencer_alloc(&flipper_dap_swclk_pin, &flipper_dap_swdio_pin);
+        swd_sequencer_set_clock(dap_swd_sequencer, dap_swd_clock);
+    }
     app_handle->state.dap_mode = DapModeSWD;
 }
 
 void dap_app_connect_jtag() {
+    dap_app_swd_sequencer_stop();
     app_handle->state.dap_mode = DapModeJTAG;
 }
 
+void dap_app_setup_clock(int freq) {
+    dap_swd_clock = freq;
+    if(dap_swd_sequencer) swd_sequencer_set_clock(dap_swd_sequencer, dap_swd_clock);
+}
+
+int dap_app_swd_transfer(
+    int req,
+    uint32_t* data,
+    int turnaround,
+    bool data_phase,
+    int idle_cycles) {
+    if(!dap_swd_sequencer) return -1;
+
+    swd_sequencer_configure(dap_swd_sequencer, turnaround, idle_cycles, data_phase);
+    return swd_sequencer_transfer(dap_swd_sequencer, req, data);
+}
+
 void dap_app_set_config(DapApp* app, DapConfig* config) {
     app->config = *config;
     furi_thread_flags_set(furi_thread_get_id(app->dap_thread), DapThreadEventApplyConfig);
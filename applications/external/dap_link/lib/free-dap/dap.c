@@ -348,6 +348,14 @@ static int dap_swd_operation(int req, uint32_t *data)
   uint32_t value;
   int ack = 0;
 
+#ifdef DAP_CONFIG_SWD_TRANSFER_FN
+  ack = DAP_CONFIG_SWD_TRANSFER_FN(req, data, dap_swd_turnaround, dap_swd_data_phase,
+      dap_idle_cycles);
+
+  if (ack >= 0)
+    return ack;
+#endif
+
   req &= (DAP_TRANSFER_APnDP | DAP_TRANSFER_RnW | DAP_TRANSFER_A2 | DAP_TRANSFER_A3);
 
   dap_swd_write(0x81 | (dap_parity(req) << 5) | (req << 1), 8);
@@ -601,6 +609,10 @@ static int dap_jtag_operation(int req, uint32_t *data)
 //-----------------------------------------------------------------------------
 static void dap_setup_clock(int freq)
 {
+#ifdef DAP_CONFIG_SETUP_CLOCK_FN
+  DAP_CONFIG_SETUP_CLOCK_FN(freq);
+#endif
+
   if (freq > DAP_CONFIG_FAST_CLOCK)
   {
     dap_clock_delay = 0;
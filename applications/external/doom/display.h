@@ -4,6 +4,7 @@
 #include "doom_icons.h"
 #include <assets_icons.h>
 #include "assets.h"
+#include "fixed.h"
 
 #define CHECK_BIT(var, pos) ((var) & (1 << (pos)))
 
@@ -23,7 +24,7 @@ void drawSprite(
     int16_t w,
     int16_t h,
     uint8_t sprite,
-    double distance,
+    fixed_t distance,
     Canvas* const canvas);
 void drawBitmap(
     int16_t x,
@@ -78,12 +79,13 @@ void drawGun(
     }
 }
 
+// Whole column at once, u8g2 fills vertical lines by framebuffer bytes
 void drawVLine(uint8_t x, int8_t start_y, int8_t end_y, uint8_t intensity, Canvas* const canvas) {
     UNUSED(intensity);
-    uint8_t dots = end_y - start_y;
-    for(int i = 0; i < dots; i++) {
-        canvas_draw_dot(canvas, x, start_y + i);
-    }
+    if(start_y < 0) start_y = 0;
+    if(end_y > RENDER_HEIGHT) end_y = RENDER_HEIGHT;
+    if(end_y <= start_y) return;
+    canvas_draw_line(canvas, x, start_y, x, end_y - 1);
 }
 
 void drawBitmap(
@@ -126,6 +128,7 @@ void drawTextSpace(int8_t x, int8_t y, char* txt, uint8_t space, Canvas* const c
 }
 
 // Custom drawBitmap method with scale support, mask, zindex and pattern filling
+// Drawn column by column, so each column is z tested against walls on its own
 void drawSprite(
     int8_t x,
     int8_t y,
@@ -134,56 +137,50 @@ void drawSprite(
     int16_t w,
     int16_t h,
     uint8_t sprite,
-    double distance,
+    fixed_t distance,
     Canvas* const canvas) {
-    uint8_t tw = (double)w / distance;
-    uint8_t th = (double)h / distance;
+    uint8_t tw = ((fixed_t)w << FIXED_SHIFT) / distance;
+    uint8_t th = ((fixed_t)h << FIXED_SHIFT) / distance;
     uint8_t byte_width = w / 8;
-    uint8_t pixel_size = fmax(1, (double)1.0 / (double)distance);
+    uint8_t pixel_size = MAX(FIXED_ONE / distance, (fixed_t)1);
     uint16_t sprite_offset = byte_width * h * sprite;
+    fixed_t depth = distance * DISTANCE_MULTIPLIER;
 
-    bool pixel;
-    bool maskPixel;
-
-    // Don't draw the whole sprite if the anchor is hidden by z buffer
-    // Not checked per pixel for performance reasons
-    if(zbuffer[(int)(fmin(fmax(x, 0), ZBUFFER_SIZE - 1) / Z_RES_DIVIDER)] <
-       distance * DISTANCE_MULTIPLIER) {
-        return;
-    }
+    for(uint8_t tx = 0; tx < tw; tx += pixel_size) {
+        int16_t screen_x = x + tx;
 
-    for(uint8_t ty = 0; ty < th; ty += pixel_size) {
-        // Don't draw out of screen
-        if(y + ty < 0 || y + ty >= RENDER_HEIGHT) {
+        // Don't draw out of screen or behind walls
+        if(screen_x < 0 || screen_x >= SCREEN_WIDTH) {
+            continue;
+        }
+        if(((fixed_t)zbuffer[screen_x / Z_RES_DIVIDER] << FIXED_SHIFT) < depth) {
             continue;
         }
 
-        uint8_t sy = ty * distance; // The y from the sprite
+        uint8_t sx = ((fixed_t)tx * distance) >> FIXED_SHIFT; // The x from the sprite
+        uint8_t box_w = MIN(pixel_size, (uint8_t)(SCREEN_WIDTH - screen_x));
 
-        for(uint8_t tx = 0; tx < tw; tx += pixel_size) {
-            uint8_t sx = tx * distance; // The x from the sprite
-            uint16_t byte_offset = sprite_offset + sy * byte_width + sx / 8;
+        for(uint8_t ty = 0; ty < th; ty += pixel_size) {
+            int16_t screen_y = y + ty;
 
             // Don't draw out of screen
-            if(x + tx < 0 || x + tx >= SCREEN_WIDTH) {
+            if(screen_y < 0 || screen_y >= RENDER_HEIGHT) {
                 continue;
             }
 
-            maskPixel = read_bit(pgm_read_byte(bitmap_mask + byte_offset), sx % 8);
+            uint8_t sy = ((fixed_t)ty * distance) >> FIXED_SHIFT; // The y from the sprite
+            uint16_t byte_offset = sprite_offset + sy * byte_width + sx / 8;
 
-            if(maskPixel) {
-                pixel = read_bit(pgm_read_byte(bitmap + byte_offset), sx % 8);
-                for(uint8_t ox = 0; ox < pixel_size; ox++) {
-                    for(uint8_t oy = 0; oy < pixel_size; oy++) {
-                        if(bitmap == imp_inv)
-                            drawPixel(x + tx + ox, y + ty + oy, 1, true, canvas);
-                        else
-                            drawPixel(x + tx + ox, y + ty + oy, pixel, true, canvas);
-                    }
-                }
+            if(read_bit(pgm_read_byte(bitmap_mask + byte_offset), sx % 8)) {
+                bool pixel = bitmap == imp_inv ||
+                             (read_bit(pgm_read_byte(bitmap + byte_offset), sx % 8));
+                uint8_t box_h = MIN(pixel_size, (uint8_t)(RENDER_HEIGHT - screen_y));
+                canvas_set_color(canvas, pixel ? ColorBlack : ColorWhite);
+                canvas_draw_box(canvas, screen_x, screen_y, box_w, box_h);
             }
         }
     }
+    canvas_set_color(canvas, ColorBlack);
 }
 
 void drawPixel(int8_t x, int8_t y, bool color, bool raycasterViewport, Canvas* const canvas) {
@@ -11,6 +11,7 @@
 #include "entities.h"
 #include "types.h"
 #include "level.h"
+#include "fixed.h"
 #include <notification/notification.h>
 #include <notification/notification_messages.h>
 #include <dolphin/dolphin.h>
@@ -27,6 +28,10 @@
 #define sign(a, b) (double)(a > b ? 1 : (b > a ? -1 : 0))
 #define pgm_read_byte(addr) (*(const unsigned char*)(addr))
 
+#define RAY_DELTA_MAX 256
+// furi_get_tick() * JOGGING_SPEED radians in fixed_sin angle steps
+#define JOGGING_ANGLE(tick) ((uint8_t)(((tick) * 13) >> 6))
+
 typedef enum {
     EventTypeTick,
     EventTypeKey,
@@ -466,7 +471,24 @@ void updateEntities(const uint8_t level[], Canvas* const canvas, PluginState* co
     }
 }
 
+// Ray length between grid lines, clamped so MAX_RENDER_DEPTH steps can't overflow
+static inline fixed_t getRayDelta(fixed_t ray) {
+    ray = fixed_abs(ray);
+    if(ray < FIXED_ONE / RAY_DELTA_MAX) return RAY_DELTA_MAX * FIXED_ONE;
+    return fixed_div(FIXED_ONE, ray);
+}
+
+// Integer version of coords_distance(pos, block) < MAX_ENTITY_DISTANCE
+static inline bool isBlockInEntityDistance(uint8_t x, uint8_t y, fixed_t pos_x, fixed_t pos_y) {
+    // Q8 is enough here and keeps squares in 32 bits
+    int32_t dx = ((((fixed_t)x << FIXED_SHIFT) + FIXED_HALF - pos_x) >> 8);
+    int32_t dy = ((((fixed_t)y << FIXED_SHIFT) + FIXED_HALF - pos_y) >> 8);
+    int32_t max = (MAX_ENTITY_DISTANCE << 8) / DISTANCE_MULTIPLIER;
+    return dx * dx + dy * dy < max * max;
+}
+
 // The map raycaster. Based on https://lodev.org/cgtutor/raycasting.html
+// All per column math is fixed point, player state is converted once per frame
 void renderMap(
     const uint8_t level[],
     double view_height,
@@ -474,35 +496,46 @@ void renderMap(
     PluginState* const plugin_state) {
     UID last_uid = 0; // NOT SURE ?
 
+    const fixed_t pos_x = to_fixed(plugin_state->player.pos.x);
+    const fixed_t pos_y = to_fixed(plugin_state->player.pos.y);
+    const fixed_t dir_x = to_fixed(plugin_state->player.dir.x);
+    const fixed_t dir_y = to_fixed(plugin_state->player.dir.y);
+    const fixed_t plane_x = to_fixed(plugin_state->player.plane.x);
+    const fixed_t plane_y = to_fixed(plugin_state->player.plane.y);
+    const fixed_t height = to_fixed(view_height);
+    const uint8_t start_x = fixed_to_int(pos_x);
+    const uint8_t start_y = fixed_to_int(pos_y);
+    const fixed_t frac_x = pos_x - ((fixed_t)start_x << FIXED_SHIFT);
+    const fixed_t frac_y = pos_y - ((fixed_t)start_y << FIXED_SHIFT);
+
     for(uint8_t x = 0; x < SCREEN_WIDTH; x += RES_DIVIDER) {
-        double camera_x = 2 * (double)x / SCREEN_WIDTH - 1;
-        double ray_x = plugin_state->player.dir.x + plugin_state->player.plane.x * camera_x;
-        double ray_y = plugin_state->player.dir.y + plugin_state->player.plane.y * camera_x;
-        uint8_t map_x = (uint8_t)plugin_state->player.pos.x;
-        uint8_t map_y = (uint8_t)plugin_state->player.pos.y;
-        Coords map_coords = {plugin_state->player.pos.x, plugin_state->player.pos.y};
-        double delta_x = fabs(1 / ray_x);
-        double delta_y = fabs(1 / ray_y);
+        fixed_t camera_x = (fixed_t)x * 2 * FIXED_ONE / SCREEN_WIDTH - FIXED_ONE;
+        fixed_t ray_x = dir_x + fixed_mul(plane_x, camera_x);
+        fixed_t ray_y = dir_y + fixed_mul(plane_y, camera_x);
+        uint8_t map_x = start_x;
+        uint8_t map_y = start_y;
+        fixed_t delta_x = getRayDelta(ray_x);
+        fixed_t delta_y = getRayDelta(ray_y);
 
         int8_t step_x;
         int8_t step_y;
-        double side_x;
-        double side_y;
+        fixed_t side_x;
+        fixed_t side_y;
 
         if(ray_x < 0) {
             step_x = -1;
-            side_x = (plugin_state->player.pos.x - map_x) * delta_x;
+            side_x = fixed_mul(frac_x, delta_x);
         } else {
             step_x = 1;
-            side_x = (map_x + (double)1.0 - plugin_state->player.pos.x) * delta_x;
+            side_x = fixed_mul(FIXED_ONE - frac_x, delta_x);
         }
 
         if(ray_y < 0) {
             step_y = -1;
-            side_y = (plugin_state->player.pos.y - map_y) * delta_y;
+            side_y = fixed_mul(frac_y, delta_y);
         } else {
             step_y = 1;
-            side_y = (map_y + (double)1.0 - plugin_state->player.pos.y) * delta_y;
+            side_y = fixed_mul(FIXED_ONE - frac_y, delta_y);
         }
 
         // Wall detection
@@ -530,8 +563,7 @@ void renderMap(
                 // cost scan for them in another loop
                 if(block == E_ENEMY || (block & 0b00001000) /* all collectable items */) {
                     // Check that it's close to the player
-                    if(coords_distance(&(plugin_state->player.pos), &map_coords) <
-                       MAX_ENTITY_DISTANCE) {
+                    if(isBlockInEntityDistance(map_x, map_y, pos_x, pos_y)) {
                         UID uid = create_uid(block, map_x, map_y);
                         if(last_uid != uid && !isSpawned(uid, plugin_state)) {
                             spawnEntity(block, map_x, map_y, plugin_state);
@@ -545,27 +577,23 @@ void renderMap(
         }
 
         if(hit) {
-            double distance;
-
-            if(side == 0) {
-                distance =
-                    fmax(1, (map_x - plugin_state->player.pos.x + (1 - step_x) / 2) / ray_x);
-            } else {
-                distance =
-                    fmax(1, (map_y - plugin_state->player.pos.y + (1 - step_y) / 2) / ray_y);
-            }
+            // Perpendicular distance is the side distance before the last step
+            fixed_t distance = MAX(side ? side_y - delta_y : side_x - delta_x, FIXED_ONE);
 
             // store zbuffer value for the column
-            zbuffer[x / Z_RES_DIVIDER] = fmin(distance * DISTANCE_MULTIPLIER, 255);
+            zbuffer[x / Z_RES_DIVIDER] =
+                MIN((int64_t)distance * DISTANCE_MULTIPLIER >> FIXED_SHIFT, (int64_t)UINT8_MAX);
 
             // rendered line height
-            uint8_t line_height = RENDER_HEIGHT / distance;
+            uint8_t line_height = ((fixed_t)RENDER_HEIGHT << FIXED_SHIFT) / distance;
+            int8_t offset = height / distance;
 
             drawVLine(
                 x,
-                view_height / distance - line_height / 2 + RENDER_HEIGHT / 2,
-                view_height / distance + line_height / 2 + RENDER_HEIGHT / 2,
-                GRADIENT_COUNT - (int)distance / MAX_RENDER_DEPTH * GRADIENT_COUNT - side * 2,
+                offset - line_height / 2 + RENDER_HEIGHT / 2,
+                offset + line_height / 2 + RENDER_HEIGHT / 2,
+                GRADIENT_COUNT - fixed_to_int(distance) / MAX_RENDER_DEPTH * GRADIENT_COUNT -
+                    side * 2,
                 canvas);
         }
     }
@@ -665,7 +693,7 @@ void renderEntities(double view_height, Canvas* const canvas, PluginState* const
                 BMP_IMP_WIDTH,
                 BMP_IMP_HEIGHT,
                 sprite,
-                transform.y,
+                to_fixed(transform.y),
                 canvas);
             break;
         }
@@ -679,7 +707,7 @@ void renderEntities(double view_height, Canvas* const canvas, PluginState* const
                 BMP_FIREBALL_WIDTH,
                 BMP_FIREBALL_HEIGHT,
                 0,
-                transform.y,
+                to_fixed(transform.y),
                 canvas);
             break;
         }
@@ -693,7 +721,7 @@ void renderEntities(double view_height, Canvas* const canvas, PluginState* const
                 BMP_ITEMS_WIDTH,
                 BMP_ITEMS_HEIGHT,
                 0,
-                transform.y,
+                to_fixed(transform.y),
                 canvas);
             break;
         }
@@ -707,7 +735,7 @@ void renderEntities(double view_height, Canvas* const canvas, PluginState* const
                 BMP_ITEMS_WIDTH,
                 BMP_ITEMS_HEIGHT,
                 1,
-                transform.y,
+                to_fixed(transform.y),
                 canvas);
             break;
         }
@@ -717,9 +745,11 @@ void renderEntities(double view_height, Canvas* const canvas, PluginState* const
 
 void renderGun(uint8_t gun_pos, double amount_jogging, Canvas* const canvas) {
     // jogging
-    char x = 48 + sin((double)furi_get_tick() * (double)JOGGING_SPEED) * 10 * amount_jogging;
+    uint8_t angle = JOGGING_ANGLE(furi_get_tick());
+    fixed_t jogging = to_fixed(amount_jogging);
+    char x = 48 + fixed_to_int(fixed_mul(fixed_sin(angle), jogging) * 10);
     char y = RENDER_HEIGHT - gun_pos +
-             fabs(cos((double)furi_get_tick() * (double)JOGGING_SPEED)) * 8 * amount_jogging;
+             fixed_to_int(fixed_mul(fixed_abs(fixed_cos(angle)), jogging) * 8);
 
     if(gun_pos > GUN_SHOT_POS - 2) {
         // Gun fire
@@ -908,7 +938,7 @@ static void doom_game_tick(PluginState* const plugin_state) {
                 //plugin_state->left = false;
             }
             plugin_state->view_height =
-                fabs(sin((double)furi_get_tick() * (double)JOGGING_SPEED)) * 6 *
+                (double)fixed_abs(fixed_sin(JOGGING_ANGLE(furi_get_tick()))) / FIXED_ONE * 6 *
                 plugin_state->jogging;
 
             if(plugin_state->gun_pos > GUN_TARGET_POS) {
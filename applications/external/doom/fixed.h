@@ -0,0 +1,45 @@
+#ifndef _fixed_h
+#define _fixed_h
+
+#include <stdint.h>
+
+// Q16.16 fixed point, M4 FPU is single precision only and doubles are emulated
+typedef int32_t fixed_t;
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE ((fixed_t)1 << FIXED_SHIFT)
+#define FIXED_HALF (FIXED_ONE / 2)
+
+#define to_fixed(a) ((fixed_t)((a) * (double)FIXED_ONE))
+#define fixed_to_int(a) ((a) >> FIXED_SHIFT)
+#define fixed_mul(a, b) ((fixed_t)(((int64_t)(a) * (b)) >> FIXED_SHIFT))
+#define fixed_div(a, b) ((fixed_t)(((int64_t)(a) << FIXED_SHIFT) / (b)))
+
+// Angles are in 1/256 of full turn
+#define FIXED_ANGLE_STEPS 256
+
+// First quarter of sine wave, Q15
+static const int16_t fixed_sin_table[FIXED_ANGLE_STEPS / 4 + 1] = {
+    0,     804,   1608,  2410,  3212,  4011,  4808,  5602,  6393,  7179,  7962,  8739,  9512,
+    10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868,
+    19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319,
+    26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571, 30852, 31113,
+    31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757, 32767,
+};
+
+static inline fixed_t fixed_sin(uint8_t angle) {
+    uint8_t index = angle % (FIXED_ANGLE_STEPS / 2);
+    if(index > FIXED_ANGLE_STEPS / 4) index = FIXED_ANGLE_STEPS / 2 - index;
+    fixed_t value = (fixed_t)fixed_sin_table[index] << 1;
+    return angle < FIXED_ANGLE_STEPS / 2 ? value : -value;
+}
+
+static inline fixed_t fixed_cos(uint8_t angle) {
+    return fixed_sin(angle + FIXED_ANGLE_STEPS / 4);
+}
+
+static inline fixed_t fixed_abs(fixed_t a) {
+    return a < 0 ? -a : a;
+}
+
+#endif
@@ -30,13 +30,14 @@ void esp_flasher_uart_set_handle_rx_data_cb(
 
 #define WORKER_ALL_RX_EVENTS (WorkerEvtStop | WorkerEvtRxDone)
 
-void esp_flasher_uart_on_irq_cb(UartIrqEvent ev, uint8_t data, void* context) {
+static void
+    esp_flasher_uart_on_rx_cb(FuriHalUartId ch, const uint8_t* data, size_t size, void* context) {
+    UNUSED(ch);
     EspFlasherUart* uart = (EspFlasherUart*)context;
 
-    if(ev == UartIrqEventRXNE) {
-        furi_stream_buffer_send(uart->rx_stream, &data, 1, 0);
-        furi_thread_flags_set(furi_thread_get_id(uart->rx_thread), WorkerEvtRxDone);
-    }
+    // DMA keeps up with high baudrates, per byte interrupt used to drop packets
+    furi_stream_buffer_send(uart->rx_stream, data, size, 0);
+    furi_thread_flags_set(furi_thread_get_id(uart->rx_thread), WorkerEvtRxDone);
 }
 
 static int32_t uart_worker(void* context) {
@@ -55,7 +56,7 @@ static int32_t uart_worker(void* context) {
         }
     }
 
-    furi_hal_uart_set_irq_cb(uart->channel, NULL, NULL);
+    furi_hal_uart_dma_rx_stop(uart->channel);
     furi_stream_buffer_free(uart->rx_stream);
 
     return 0;
@@ -65,6 +66,10 @@ void esp_flasher_uart_tx(uint8_t* data, size_t len) {
     furi_hal_uart_tx(UART_CH, data, len);
 }
 
+void esp_flasher_uart_set_br(uint32_t baudrate) {
+    furi_hal_uart_set_br(UART_CH, baudrate);
+}
+
 EspFlasherUart*
     esp_flasher_uart_init(EspFlasherApp* app, FuriHalUartId channel, const char* thread_name) {
     EspFlasherUart* uart = malloc(sizeof(EspFlasherUart));
@@ -84,7 +89,7 @@ EspFlasherUart*
         furi_hal_uart_init(channel, BAUDRATE);
     }
     furi_hal_uart_set_br(channel, BAUDRATE);
-    furi_hal_uart_set_irq_cb(channel, esp_flasher_uart_on_irq_cb, uart);
+    furi_hal_uart_dma_rx_start(channel, esp_flasher_uart_on_rx_cb, uart);
 
     return uart;
 }
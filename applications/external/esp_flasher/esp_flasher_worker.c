@@ -12,10 +12,49 @@ static void _timer_callback(void* context) {
     }
 }
 
+#define FLASH_BLOCK_SIZE (1024)
+#define FLASH_READ_AHEAD_SIZE (4 * FLASH_BLOCK_SIZE)
+#define FLASH_READ_TIMEOUT_MS (1000)
+
+typedef struct {
+    File* file;
+    FuriStreamBuffer* stream;
+    volatile bool stop;
+} FlashReader;
+
+// Reads file ahead into stream, so SD access overlaps with UART transfer of previous block
+static int32_t _flash_reader_thread(void* context) {
+    FlashReader* reader = context;
+    uint8_t* buf = malloc(FLASH_BLOCK_SIZE);
+
+    while(!reader->stop) {
+        size_t num_bytes = storage_file_read(reader->file, buf, FLASH_BLOCK_SIZE);
+        // Writer side times out on short file or read error
+        if(num_bytes == 0) break;
+
+        size_t sent = 0;
+        while(sent < num_bytes && !reader->stop) {
+            sent += furi_stream_buffer_send(reader->stream, buf + sent, num_bytes - sent, 100);
+        }
+    }
+
+    free(buf);
+    return 0;
+}
+
+static bool _flash_reader_receive(FlashReader* reader, uint8_t* data, size_t size) {
+    size_t received = 0;
+    while(received < size) {
+        size_t num_bytes = furi_stream_buffer_receive(
+            reader->stream, data + received, size - received, FLASH_READ_TIMEOUT_MS);
+        if(num_bytes == 0) break;
+        received += num_bytes;
+    }
+    return received == size;
+}
+
 static esp_loader_error_t _flash_file(EspFlasherApp* app, char* filepath, uint32_t addr) {
-    // TODO cleanup
     esp_loader_error_t err;
-    static uint8_t payload[1024];
     File* bin_file = storage_file_alloc(app->storage);
 
     char user_msg[256];
@@ -31,7 +70,7 @@ static esp_loader_error_t _flash_file(EspFlasherApp* app, char* filepath, uint32
     uint64_t size = storage_file_size(bin_file);
 
     loader_port_debug_print("Erasing flash...this may take a while\n");
-    err = esp_loader_flash_start(addr, size, sizeof(payload));
+    err = esp_loader_flash_start(addr, size, FLASH_BLOCK_SIZE);
     if(err != ESP_LOADER_SUCCESS) {
         storage_file_close(bin_file);
         storage_file_free(bin_file);
@@ -40,6 +79,16 @@ static esp_loader_error_t _flash_file(EspFlasherApp* app, char* filepath, uint32
         return err;
     }
 
+    FlashReader reader = {
+        .file = bin_file,
+        .stream = furi_stream_buffer_alloc(FLASH_READ_AHEAD_SIZE, 1),
+    };
+    FuriThread* reader_thread =
+        furi_thread_alloc_ex("EspFlasherReader", 1024, _flash_reader_thread, &reader);
+    furi_thread_start(reader_thread);
+
+    uint8_t* payload = malloc(FLASH_BLOCK_SIZE);
+
     loader_port_debug_print("Start programming\n");
     uint64_t last_updated = size;
     while(size > 0) {
@@ -50,28 +99,50 @@ static esp_loader_error_t _flash_file(EspFlasherApp* app, char* filepath, uint32
             loader_port_debug_print(user_msg);
             last_updated = size;
         }
-        size_t to_read = MIN(size, sizeof(payload));
-        uint16_t num_bytes = storage_file_read(bin_file, payload, to_read);
+        size_t num_bytes = MIN(size, (uint64_t)FLASH_BLOCK_SIZE);
+        if(!_flash_reader_receive(&reader, payload, num_bytes)) {
+            snprintf(user_msg, sizeof(user_msg), "Cannot read file\n");
+            err = ESP_LOADER_ERROR_FAIL;
+            break;
+        }
         err = esp_loader_flash_write(payload, num_bytes);
         if(err != ESP_LOADER_SUCCESS) {
             snprintf(user_msg, sizeof(user_msg), "Packet could not be written! Error: %u\n", err);
-            storage_file_close(bin_file);
-            storage_file_free(bin_file);
-            loader_port_debug_print(user_msg);
-            return err;
+            break;
         }
 
         size -= num_bytes;
     }
 
-    loader_port_debug_print("Finished programming\n");
-
-    // TODO verify
-
+    reader.stop = true;
+    furi_thread_join(reader_thread);
+    furi_thread_free(reader_thread);
+    furi_stream_buffer_free(reader.stream);
+    free(payload);
     storage_file_close(bin_file);
     storage_file_free(bin_file);
 
-    return ESP_LOADER_SUCCESS;
+    if(err != ESP_LOADER_SUCCESS) {
+        loader_port_debug_print(user_msg);
+        return err;
+    }
+
+    loader_port_debug_print("Finished programming\n");
+
+#if MD5_ENABLED
+    err = esp_loader_flash_verify();
+    if(err == ESP_LOADER_ERROR_UNSUPPORTED_FUNC) {
+        loader_port_debug_print("Verification not supported by target\n");
+        err = ESP_LOADER_SUCCESS;
+    } else if(err != ESP_LOADER_SUCCESS) {
+        snprintf(user_msg, sizeof(user_msg), "MD5 does not match! Error: %u\n", err);
+        loader_port_debug_print(user_msg);
+    } else {
+        loader_port_debug_print("Flash verified\n");
+    }
+#endif
+
+    return err;
 }
 
 // This in-app FW switch "exploits" the otadata (boot_app0)
@@ -201,6 +272,46 @@ static void _flash_all_files(EspFlasherApp* app) {
     }
 }
 
+#define ESP_FLASHER_DEFAULT_BAUDRATE (115200)
+#define ESP_FLASHER_CHIP_MAGIC_REG_ADDR (0x40001000)
+
+static const uint32_t _transmission_rates[] = {921600, 460800, 230400};
+static uint32_t _transmission_rate = ESP_FLASHER_DEFAULT_BAUDRATE;
+
+// Probe rates from the fastest, a register read at new rate proves the link is stable
+static void _increase_transmission_rate(void) {
+    char user_msg[256];
+
+    for(size_t i = 0; i < COUNT_OF(_transmission_rates); i++) {
+        uint32_t rate = _transmission_rates[i];
+        snprintf(user_msg, sizeof(user_msg), "Trying %lu baud\n", rate);
+        loader_port_debug_print(user_msg);
+
+        esp_loader_error_t err = esp_loader_change_transmission_rate(rate);
+        if(err != ESP_LOADER_SUCCESS) {
+            snprintf(
+                user_msg, sizeof(user_msg), "Cannot change transmission rate. Error: %u\n", err);
+            loader_port_debug_print(user_msg);
+            // Target stays at the rate we know is working
+            return;
+        }
+        esp_flasher_uart_set_br(rate);
+        _transmission_rate = rate;
+        loader_port_delay_ms(10);
+        furi_stream_buffer_reset(flash_rx_stream);
+
+        uint32_t reg_value;
+        err = esp_loader_read_register(ESP_FLASHER_CHIP_MAGIC_REG_ADDR, &reg_value);
+        if(err == ESP_LOADER_SUCCESS) {
+            snprintf(user_msg, sizeof(user_msg), "Using %lu baud\n", rate);
+            loader_port_debug_print(user_msg);
+            return;
+        }
+    }
+
+    loader_port_debug_print("No stable higher rate found\n");
+}
+
 static int32_t esp_flasher_flash_bin(void* context) {
     EspFlasherApp* app = (void*)context;
     esp_loader_error_t err;
@@ -227,23 +338,10 @@ static int32_t esp_flasher_flash_bin(void* context) {
         loader_port_debug_print(err_msg);
     }
 
-#if 0 // still getting packet drops with this
-    // higher BR
+    // higher BR, DMA reception keeps up with it
     if(!err) {
-        loader_port_debug_print("Increasing speed for faster flash\n");
-        err = esp_loader_change_transmission_rate(230400);
-        if (err != ESP_LOADER_SUCCESS) {
-            char err_msg[256];
-            snprintf(
-                err_msg,
-                sizeof(err_msg),
-                "Cannot change transmission rate. Error: %u\n",
-                err);
-            loader_port_debug_print(err_msg);
-        }
-        furi_hal_uart_set_br(FuriHalUartIdUSART1, 230400);
+        _increase_transmission_rate();
     }
-#endif
 
     if(!err) {
         loader_port_debug_print("Connected\n");
@@ -251,10 +349,11 @@ static int32_t esp_flasher_flash_bin(void* context) {
             _flash_all_files(app);
         }
         app->switch_fw = SwitchNotSet;
-#if 0
-        loader_port_debug_print("Restoring transmission rate\n");
-        furi_hal_uart_set_br(FuriHalUartIdUSART1, 115200);
-#endif
+        if(_transmission_rate != ESP_FLASHER_DEFAULT_BAUDRATE) {
+            loader_port_debug_print("Restoring transmission rate\n");
+            esp_flasher_uart_set_br(ESP_FLASHER_DEFAULT_BAUDRATE);
+            _transmission_rate = ESP_FLASHER_DEFAULT_BAUDRATE;
+        }
         loader_port_debug_print(
             "Done flashing. Please reset the board manually if it doesn't auto-reset.\n");
 
@@ -467,6 +467,8 @@ static int flipbip_scene_1_model_init(
     strncpy(xprv_acc, buf, buflen);
     model->xprv_account = xprv_acc;
 
+    // Private derivation leaves public key empty, fill it before serialization
+    hdnode_fill_public_key(node);
     hdnode_serialize_public(node, fingerprint, coin_info[2], buf, buflen);
     char* xpub_acc = malloc(buflen + 1);
     strncpy(xpub_acc, buf, buflen);
@@ -481,6 +483,8 @@ static int flipbip_scene_1_model_init(
     strncpy(xprv_ext, buf, buflen);
     model->xprv_extended = xprv_ext;
 
+    // Addresses are derived from copies of this node, so its public key is computed once
+    hdnode_fill_public_key(node);
     hdnode_serialize_public(node, fingerprint, coin_info[2], buf, buflen);
     char* xpub_ext = malloc(buflen + 1);
     strncpy(xpub_ext, buf, buflen);
@@ -1,8 +1,10 @@
 #include <furi.h>
+#include <furi_hal.h>
 #include <gui/gui.h>
 
 #include <input/input.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
@@ -21,58 +23,96 @@ typedef struct {
 typedef struct {
     bool revive;
     int evo;
+    bool show_time;
+    uint32_t generation_time;
     FuriMutex* mutex;
 } State;
 
-unsigned char new[TOTAL_PIXELS] = {};
-unsigned char old[TOTAL_PIXELS] = {};
-unsigned char* fields[] = {new, old};
+// Row is bit packed, 32 cells per word, LSB is leftmost cell same as XBM
+#define ROW_WORDS (SCREEN_WIDTH / 32)
+
+typedef uint32_t Field[SCREEN_HEIGHT][ROW_WORDS];
+
+Field new = {};
+Field old = {};
+Field* fields[] = {&new, &old};
 
 int current = 0;
 int next = 1;
 
-unsigned char get_cell(int x, int y) {
-    if(x <= 0 || x >= SCREEN_WIDTH) return 0;
-    if(y <= 0 || y >= SCREEN_HEIGHT) return 0;
-
-    int pix = (y * SCREEN_WIDTH) + x;
-    return fields[current][pix];
+static void full_add(uint32_t a, uint32_t b, uint32_t c, uint32_t* sum, uint32_t* carry) {
+    uint32_t ab = a ^ b;
+    *sum = ab ^ c;
+    *carry = (a & b) | (ab & c);
 }
 
-int count_neightbors(int x, int y) {
-    return get_cell(x + 1, y - 1) + get_cell(x - 1, y - 1) + get_cell(x - 1, y + 1) +
-           get_cell(x + 1, y + 1) + get_cell(x + 1, y) + get_cell(x - 1, y) + get_cell(x, y - 1) +
-           get_cell(x, y + 1);
+// Neighbors from the left and right, word borders are carried over
+static void row_shift(const uint32_t* row, uint32_t* west, uint32_t* east) {
+    for(int w = 0; w < ROW_WORDS; ++w) {
+        west[w] = (row[w] << 1) | (w > 0 ? row[w - 1] >> 31 : 0);
+        east[w] = (row[w] >> 1) | (w < ROW_WORDS - 1 ? row[w + 1] << 31 : 0);
+    }
 }
 
 static void update_field(State* state) {
+    uint32_t start = DWT->CYCCNT;
+    Field* field = fields[current];
+
     if(state->revive) {
-        for(int i = 0; i < TOTAL_PIXELS; ++i) {
-            if((random() % 100) == 1) {
-                fields[current][i] = 1;
-            }
-            state->revive = false;
+        // Same density as 1% chance per cell
+        for(int i = 0; i < TOTAL_PIXELS / 100; ++i) {
+            int cell = random() % TOTAL_PIXELS;
+            (*field)[cell / SCREEN_WIDTH][cell % SCREEN_WIDTH / 32] |= 1UL << (cell % 32);
         }
+        state->revive = false;
     }
 
-    for(int i = 0; i < TOTAL_PIXELS; ++i) {
-        int x = i % SCREEN_WIDTH;
-        int y = (int)(i / SCREEN_WIDTH);
-
-        int v = get_cell(x, y);
-        int n = count_neightbors(x, y);
-
-        if(v && n == 3) {
-            ++state->evo;
-        } else if(v && (n < 2 || n > 3)) {
-            ++state->evo;
-            v = 0;
-        } else if(!v && n == 3) {
-            ++state->evo;
-            v = 1;
+    // First row and column are always read as dead
+    static Field cells;
+    memcpy(cells, field, sizeof(Field));
+    memset(cells[0], 0, sizeof(cells[0]));
+    for(int y = 0; y < SCREEN_HEIGHT; ++y) cells[y][0] &= ~1UL;
+
+    static const uint32_t empty[ROW_WORDS] = {};
+    uint32_t above_w[ROW_WORDS], above_e[ROW_WORDS];
+    uint32_t row_w[ROW_WORDS], row_e[ROW_WORDS];
+    uint32_t below_w[ROW_WORDS], below_e[ROW_WORDS];
+
+    row_shift(empty, above_w, above_e);
+    row_shift(cells[0], row_w, row_e);
+
+    for(int y = 0; y < SCREEN_HEIGHT; ++y) {
+        const uint32_t* above = y > 0 ? cells[y - 1] : empty;
+        const uint32_t* row = cells[y];
+        const uint32_t* below = y < SCREEN_HEIGHT - 1 ? cells[y + 1] : empty;
+        row_shift(below, below_w, below_e);
+
+        for(int w = 0; w < ROW_WORDS; ++w) {
+            // Count 8 neighbors of 32 cells at once with bitwise adders
+            uint32_t s1, c1, s2, c2, s3, c3, ones, c4;
+            full_add(above_w[w], above[w], above_e[w], &s1, &c1);
+            full_add(row_w[w], row_e[w], below_w[w], &s2, &c2);
+            s3 = below[w] ^ below_e[w];
+            c3 = below[w] & below_e[w];
+            full_add(s1, s2, s3, &ones, &c4);
+
+            // Twos are set when exactly one of the carries is, 4 or more otherwise
+            uint32_t p = c1 ^ c2;
+            uint32_t q = c3 ^ c4;
+            uint32_t twos = (p ^ q) & ~((c1 & c2) | (c3 & c4) | (p & q));
+
+            uint32_t alive = row[w];
+            uint32_t born = twos & ones;
+            uint32_t result = born | (alive & twos);
+
+            state->evo += __builtin_popcount((alive & born) | (alive ^ result));
+            (*fields[next])[y][w] = result;
         }
 
-        fields[next][i] = v;
+        memcpy(above_w, row_w, sizeof(row_w));
+        memcpy(above_e, row_e, sizeof(row_e));
+        memcpy(row_w, below_w, sizeof(below_w));
+        memcpy(row_e, below_e, sizeof(below_e));
     }
 
     next ^= current;
@@ -83,6 +123,9 @@ static void update_field(State* state) {
         state->revive = true;
         state->evo = 0;
     }
+
+    state->generation_time =
+        (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond();
 }
 
 static void input_callback(InputEvent* input_event, FuriMessageQueue* event_queue) {
@@ -98,11 +141,17 @@ static void render_callback(Canvas* canvas, void* ctx) {
     furi_mutex_acquire(state->mutex, FuriWaitForever);
 
     canvas_clear(canvas);
-
-    for(int i = 0; i < TOTAL_PIXELS; ++i) {
-        int x = i % SCREEN_WIDTH;
-        int y = (int)(i / SCREEN_WIDTH);
-        if(fields[current][i] == 1) canvas_draw_dot(canvas, x, y);
+    canvas_draw_xbm(
+        canvas, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, (const uint8_t*)fields[current]);
+
+    if(state->show_time) {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%luus", state->generation_time);
+        canvas_set_font(canvas, FontSecondary);
+        canvas_set_color(canvas, ColorWhite);
+        canvas_draw_box(canvas, 0, 0, canvas_string_width(canvas, buffer) + 2, 10);
+        canvas_set_color(canvas, ColorBlack);
+        canvas_draw_str(canvas, 1, 8, buffer);
     }
     furi_mutex_release(state->mutex);
 }
@@ -138,7 +187,10 @@ int32_t game_of_life_app(void* p) {
 
         if(event_status == FuriStatusOk && event.type == EventTypeKey &&
            event.input.type == InputTypePress) {
-            if(event.input.key == InputKeyBack) {
+            if(event.input.key == InputKeyOk) {
+                // Generation time, to compare firmware builds
+                _state->show_time = !_state->show_time;
+            } else if(event.input.key == InputKeyBack) {
                 // furiac_exit(NULL);
                 processing = false;
                 furi_mutex_release(_state->mutex);
@@ -21,6 +21,8 @@ static void render_callback(Canvas* const canvas, void* context) {
     furi_mutex_acquire(gps_uart->mutex, FuriWaitForever);
 
     char buffer[64];
+    NmeaFix status;
+    nmea_parser_get_fix(gps_uart->parser, &status);
 
     switch(gps_uart->view_state) {
     case CHANGE_BAUDRATE:
@@ -77,23 +79,23 @@ static void render_callback(Canvas* const canvas, void* context) {
         canvas_draw_str_aligned(canvas, 96, 52, AlignCenter, AlignBottom, "Last Fix");
 
         canvas_set_font(canvas, FontSecondary);
-        snprintf(buffer, 64, "%f", (double)gps_uart->status.latitude);
+        snprintf(buffer, 64, "%f", (double)status.latitude);
         canvas_draw_str_aligned(canvas, 32, 18, AlignCenter, AlignBottom, buffer);
-        snprintf(buffer, 64, "%f", (double)gps_uart->status.longitude);
+        snprintf(buffer, 64, "%f", (double)status.longitude);
         canvas_draw_str_aligned(canvas, 96, 18, AlignCenter, AlignBottom, buffer);
-        snprintf(buffer, 64, "%.1f", (double)gps_uart->status.course);
+        snprintf(buffer, 64, "%.1f", (double)status.course);
         canvas_draw_str_aligned(canvas, 21, 40, AlignCenter, AlignBottom, buffer);
 
         switch(gps_uart->speed_units) {
         case KPH:
-            snprintf(buffer, 64, "%.2f km", (double)(gps_uart->status.speed * KNOTS_TO_KPH));
+            snprintf(buffer, 64, "%.2f km", (double)(status.speed * KNOTS_TO_KPH));
             break;
         case MPH:
-            snprintf(buffer, 64, "%.2f mi", (double)(gps_uart->status.speed * KNOTS_TO_MPH));
+            snprintf(buffer, 64, "%.2f mi", (double)(status.speed * KNOTS_TO_MPH));
             break;
         case KNOTS:
         default:
-            snprintf(buffer, 64, "%.2f kn", (double)gps_uart->status.speed);
+            snprintf(buffer, 64, "%.2f kn", (double)status.speed);
             break;
         }
 
@@ -102,18 +104,18 @@ static void render_callback(Canvas* const canvas, void* context) {
             buffer,
             64,
             "%.1f %c",
-            (double)gps_uart->status.altitude,
-            tolower(gps_uart->status.altitude_units));
+            (double)status.altitude,
+            tolower(status.altitude_units));
         canvas_draw_str_aligned(canvas, 107, 40, AlignCenter, AlignBottom, buffer);
-        snprintf(buffer, 64, "%d", gps_uart->status.satellites_tracked);
+        snprintf(buffer, 64, "%d", status.satellites);
         canvas_draw_str_aligned(canvas, 32, 62, AlignCenter, AlignBottom, buffer);
         snprintf(
             buffer,
             64,
             "%02d:%02d:%02d UTC",
-            gps_uart->status.time_hours,
-            gps_uart->status.time_minutes,
-            gps_uart->status.time_seconds);
+            status.hours,
+            status.minutes,
+            status.seconds);
         canvas_draw_str_aligned(canvas, 96, 62, AlignCenter, AlignBottom, buffer);
         break;
     }
@@ -2,6 +2,7 @@
 
 #include <furi_hal.h>
 #include <notification/notification_messages.h>
+#include <nmea_parser.h>
 
 #include <xtreme.h>
 
@@ -9,25 +10,11 @@
     (xtreme_settings.uart_nmea_channel == UARTDefault ? FuriHalUartIdUSART1 : FuriHalUartIdLPUART1)
 
 #define RX_BUF_SIZE 1024
+#define RX_CHUNK_SIZE 128
 
 static const int gps_baudrates[6] = {4800, 9600, 19200, 38400, 57600, 115200};
 static int current_gps_baudrate = 1;
 
-typedef struct {
-    bool valid;
-    float latitude;
-    float longitude;
-    float speed;
-    float course;
-    float altitude;
-    char altitude_units;
-    int fix_quality;
-    int satellites_tracked;
-    int time_hours;
-    int time_minutes;
-    int time_seconds;
-} GpsStatus;
-
 typedef enum { KNOTS, KPH, MPH, INVALID } SpeedUnit;
 
 typedef enum {
@@ -42,7 +29,7 @@ typedef struct {
     FuriMutex* mutex;
     FuriThread* thread;
     FuriStreamBuffer* rx_stream;
-    uint8_t rx_buf[RX_BUF_SIZE];
+    uint8_t rx_buf[RX_CHUNK_SIZE];
 
     NotificationApp* notifications;
     uint32_t baudrate;
@@ -51,7 +38,7 @@ typedef struct {
     SpeedUnit speed_units;
     ViewState view_state;
 
-    GpsStatus status;
+    NmeaParser* parser;
 } GpsUart;
 
 void gps_uart_init_thread(GpsUart* gps_uart);
@@ -7,22 +7,26 @@
 #include <notification/notification_messages.h>
 
 #include <storage/storage.h>
-#include <stream/stream.h>
-#include <stream/buffered_file_stream.h>
-#include <toolbox/stream/file_stream.h>
+
+#include "hex_editor_pages.h"
 
 #include <hex_editor_icons.h>
 #include <assets_icons.h>
 
 #define TAG "HexEditor"
 
+/** Files without line breaks are shown in chunks of this size */
+#define HEX_EDITOR_LINE_MAX 128
+/** Long OK jumps through file in this many steps */
+#define HEX_EDITOR_JUMP_STEPS 16
+
 typedef struct {
-    uint32_t file_offset;
-    uint32_t file_read_bytes;
+    uint32_t line_offset;
+    uint32_t line_size;
     uint32_t file_size;
     uint8_t string_offset;
     char editable_char;
-    Stream* stream;
+    HexEditorPages* pages;
     bool mode;
 } HexEditorModel;
 
@@ -44,7 +48,17 @@ static void draw_callback(Canvas* canvas, void* ctx) {
 
     canvas_clear(canvas);
     canvas_set_font(canvas, FontPrimary);
-    canvas_draw_str(canvas, 0, 10, "Line and mode:");
+    char header[32];
+    snprintf(
+        header,
+        sizeof(header),
+        "0x%08lX %lu%%",
+        hex_editor->model->line_offset + hex_editor->model->string_offset,
+        hex_editor->model->file_size ?
+            (uint32_t)((uint64_t)hex_editor->model->line_offset * 100 /
+                       hex_editor->model->file_size) :
+            0UL);
+    canvas_draw_str(canvas, 0, 10, header);
 
     canvas_set_font(canvas, FontSecondary);
 
@@ -116,7 +130,7 @@ static void hex_editor_free(HexEditor* instance) {
 
     furi_mutex_free(instance->mutex);
 
-    if(instance->model->stream) buffered_file_stream_close(instance->model->stream);
+    if(instance->model->pages) hex_editor_pages_free(instance->model->pages);
 
     furi_string_free(instance->buffer);
 
@@ -128,23 +142,63 @@ static bool hex_editor_open_file(HexEditor* hex_editor, const char* file_path) {
     furi_assert(hex_editor);
     furi_assert(file_path);
 
-    hex_editor->model->stream = buffered_file_stream_alloc(hex_editor->storage);
+    hex_editor->model->pages = hex_editor_pages_alloc(hex_editor->storage);
     bool isOk = true;
 
     do {
-        if(!buffered_file_stream_open(
-               hex_editor->model->stream, file_path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
-            FURI_LOG_E(TAG, "Unable to open stream: %s", file_path);
+        if(!hex_editor_pages_open(hex_editor->model->pages, file_path)) {
             isOk = false;
             break;
         };
 
-        hex_editor->model->file_size = stream_size(hex_editor->model->stream);
+        hex_editor->model->file_size = hex_editor_pages_get_size(hex_editor->model->pages);
     } while(false);
 
     return isOk;
 }
 
+static bool hex_editor_load_line(HexEditor* hex_editor, uint32_t offset, bool forward) {
+    HexEditorModel* model = hex_editor->model;
+    uint8_t line[HEX_EDITOR_LINE_MAX];
+
+    size_t size = hex_editor_pages_read(model->pages, offset, line, sizeof(line));
+    if(!size) return false;
+
+    // Line ends after line break, or is cut at max size
+    uint8_t* line_end = memchr(line, '\n', size);
+    if(line_end) size = line_end - line + 1;
+
+    furi_string_reset(hex_editor->buffer);
+    for(size_t i = 0; i < size; i++) {
+        furi_string_push_back(
+            hex_editor->buffer, (line[i] >= ' ' && line[i] < 0x7F) ? (char)line[i] : '.');
+    }
+
+    model->line_offset = offset;
+    model->line_size = size;
+    model->string_offset = 0;
+
+    hex_editor_pages_prefetch(model->pages, forward ? offset + size : offset, forward);
+    return true;
+}
+
+static uint32_t hex_editor_prev_line_offset(HexEditor* hex_editor, uint32_t offset) {
+    HexEditorModel* model = hex_editor->model;
+    uint8_t line[HEX_EDITOR_LINE_MAX];
+
+    if(offset == 0) return 0;
+    // Skip line break of previous line
+    uint32_t end = offset - 1;
+    uint32_t start = end > HEX_EDITOR_LINE_MAX ? end - HEX_EDITOR_LINE_MAX : 0;
+
+    size_t size = hex_editor_pages_read(model->pages, start, line, end - start);
+    while(size > 0) {
+        if(line[size - 1] == '\n') return start + size;
+        size--;
+    }
+    return start;
+}
+
 int32_t hex_editor_app(void* p) {
     UNUSED(p);
 
@@ -177,8 +231,8 @@ int32_t hex_editor_app(void* p) {
 
         if(!hex_editor_open_file(hex_editor, furi_string_get_cstr(file_path))) break;
 
-        if(!stream_read_line(hex_editor->model->stream, hex_editor->buffer)) {
-            FURI_LOG_T(TAG, "No keys left in dict");
+        if(!hex_editor_load_line(hex_editor, 0, true)) {
+            FURI_LOG_E(TAG, "File is empty");
             break;
         }
 
@@ -216,42 +270,30 @@ int32_t hex_editor_app(void* p) {
                         hex_editor->model->string_offset -= off;
                     }
                     if(event.key == InputKeyDown) {
-                        hex_editor->model->string_offset = 0;
-                        if(!stream_read_line(hex_editor->model->stream, hex_editor->buffer)) {
-                            FURI_LOG_T(TAG, "No keys left in dict");
+                        if(!hex_editor_load_line(
+                               hex_editor,
+                               hex_editor->model->line_offset + hex_editor->model->line_size,
+                               true)) {
+                            FURI_LOG_T(TAG, "No lines left");
                         }
                     }
                     if(event.key == InputKeyUp) {
-                        hex_editor->model->string_offset = 0;
-                        // TODO asert
-                        if(!stream_seek(hex_editor->model->stream, -1, StreamOffsetFromCurrent)) {
-                            FURI_LOG_E(TAG, "Unable to seek stream");
-                            break;
-                        }
-                        // NOT work on first line
-                        stream_seek_to_char(
-                            hex_editor->model->stream, '\n', StreamDirectionBackward);
-
-                        if(!stream_seek_to_char(
-                               hex_editor->model->stream, '\n', StreamDirectionBackward)) {
-                            stream_rewind(hex_editor->model->stream);
-                        } else {
-                            if(!stream_seek(
-                                   hex_editor->model->stream, 1, StreamOffsetFromCurrent)) {
-                                FURI_LOG_E(TAG, "Unable to seek stream");
-                                break;
-                            }
-                        }
-
-                        if(!stream_read_line(hex_editor->model->stream, hex_editor->buffer)) {
-                            FURI_LOG_T(TAG, "No keys left in dict");
-                            break;
-                        }
+                        hex_editor_load_line(
+                            hex_editor,
+                            hex_editor_prev_line_offset(
+                                hex_editor, hex_editor->model->line_offset),
+                            false);
                     }
 
-                    if(event.key == InputKeyOk) {
-                        hex_editor->model->editable_char = furi_string_get_char(
-                            hex_editor->buffer, hex_editor->model->string_offset);
+                    if(event.key == InputKeyOk && event.type == InputTypeShort) {
+                        // Shown line has unprintable bytes replaced, edit real one
+                        uint8_t byte = ' ';
+                        hex_editor_pages_read(
+                            hex_editor->model->pages,
+                            hex_editor->model->line_offset + hex_editor->model->string_offset,
+                            &byte,
+                            1);
+                        hex_editor->model->editable_char = byte;
 
                         hex_editor->model->mode = 1;
                     }
@@ -268,39 +310,34 @@ int32_t hex_editor_app(void* p) {
                     }
 
                     if(event.key == InputKeyOk) {
-                        if(!stream_seek(hex_editor->model->stream, -1, StreamOffsetFromCurrent)) {
-                            FURI_LOG_E(TAG, "Unable to seek stream");
-                            break;
-                        }
-                        stream_seek_to_char(
-                            hex_editor->model->stream, '\n', StreamDirectionBackward);
-                        stream_seek(
-                            hex_editor->model->stream,
-                            hex_editor->model->string_offset + 1,
-                            StreamOffsetFromCurrent);
-
-                        stream_write_char(
-                            hex_editor->model->stream, hex_editor->model->editable_char);
+                        uint8_t string_offset = hex_editor->model->string_offset;
+                        hex_editor_pages_write(
+                            hex_editor->model->pages,
+                            hex_editor->model->line_offset + string_offset,
+                            hex_editor->model->editable_char);
 
                         hex_editor->model->editable_char = ' ';
 
                         hex_editor->model->mode = 0;
 
-                        stream_seek_to_char(
-                            hex_editor->model->stream, '\n', StreamDirectionBackward);
-
-                        if(!stream_seek(hex_editor->model->stream, 1, StreamOffsetFromCurrent)) {
-                            FURI_LOG_E(TAG, "Unable to seek stream");
-                            break;
-                        }
-
-                        if(!stream_read_line(hex_editor->model->stream, hex_editor->buffer)) {
-                            FURI_LOG_T(TAG, "No keys left in dict");
+                        if(!hex_editor_load_line(
+                               hex_editor, hex_editor->model->line_offset, true)) {
                             break;
                         }
+                        hex_editor->model->string_offset = string_offset;
                     }
                 }
             }
+            // Jump through file, pages are read directly at new offset
+            if(event.type == InputTypeLong && event.key == InputKeyOk &&
+               !hex_editor->model->mode) {
+                uint32_t step = hex_editor->model->file_size / HEX_EDITOR_JUMP_STEPS;
+                step = MAX(step - step % HEX_EDITOR_PAGE_SIZE, (uint32_t)HEX_EDITOR_PAGE_SIZE);
+                uint32_t offset = hex_editor->model->line_offset + step;
+                offset -= offset % HEX_EDITOR_PAGE_SIZE;
+                if(offset >= hex_editor->model->file_size) offset = 0;
+                hex_editor_load_line(hex_editor, offset, true);
+            }
             if(event.key == InputKeyBack) {
                 break;
             }
@@ -0,0 +1,189 @@
+#include "hex_editor_pages.h"
+
+#include <furi.h>
+
+#define TAG "HexEditorPages"
+
+#define HEX_EDITOR_PAGES_COUNT 8
+#define HEX_EDITOR_PAGES_QUEUE_SIZE 4
+#define HEX_EDITOR_PAGES_EXIT UINT32_MAX
+
+typedef struct {
+    bool valid;
+    uint32_t index;
+    uint32_t size;
+    uint32_t used;
+    uint8_t data[HEX_EDITOR_PAGE_SIZE];
+} HexEditorPage;
+
+struct HexEditorPages {
+    Storage* storage;
+    File* file;
+    uint32_t file_size;
+
+    HexEditorPage pages[HEX_EDITOR_PAGES_COUNT];
+    uint32_t clock;
+    FuriMutex* mutex;
+
+    FuriThread* thread;
+    FuriMessageQueue* prefetch_queue;
+};
+
+static HexEditorPage* hex_editor_pages_find(HexEditorPages* pages, uint32_t index) {
+    for(size_t i = 0; i < HEX_EDITOR_PAGES_COUNT; i++) {
+        if(pages->pages[i].valid && pages->pages[i].index == index) {
+            return &pages->pages[i];
+        }
+    }
+    return NULL;
+}
+
+// Must be called with mutex taken
+static HexEditorPage* hex_editor_pages_load(HexEditorPages* pages, uint32_t index) {
+    HexEditorPage* page = hex_editor_pages_find(pages, index);
+
+    if(!page) {
+        // Evict least recently used page
+        page = &pages->pages[0];
+        for(size_t i = 0; i < HEX_EDITOR_PAGES_COUNT; i++) {
+            if(!pages->pages[i].valid) {
+                page = &pages->pages[i];
+                break;
+            }
+            if(pages->pages[i].used < page->used) page = &pages->pages[i];
+        }
+
+        page->valid = false;
+        if(!storage_file_seek(pages->file, index * HEX_EDITOR_PAGE_SIZE, true)) {
+            FURI_LOG_E(TAG, "Unable to seek to page %lu", index);
+            return NULL;
+        }
+        page->size = storage_file_read(pages->file, page->data, HEX_EDITOR_PAGE_SIZE);
+        page->index = index;
+        page->valid = true;
+    }
+
+    page->used = ++pages->clock;
+    return page;
+}
+
+static int32_t hex_editor_pages_prefetch_thread(void* context) {
+    HexEditorPages* pages = context;
+    uint32_t index;
+
+    while(true) {
+        furi_check(
+            furi_message_queue_get(pages->prefetch_queue, &index, FuriWaitForever) ==
+            FuriStatusOk);
+        if(index == HEX_EDITOR_PAGES_EXIT) break;
+
+        furi_check(furi_mutex_acquire(pages->mutex, FuriWaitForever) == FuriStatusOk);
+        if(!hex_editor_pages_find(pages, index)) hex_editor_pages_load(pages, index);
+        furi_mutex_release(pages->mutex);
+    }
+
+    return 0;
+}
+
+HexEditorPages* hex_editor_pages_alloc(Storage* storage) {
+    HexEditorPages* pages = malloc(sizeof(HexEditorPages));
+    pages->storage = storage;
+    pages->file = storage_file_alloc(storage);
+    pages->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    pages->prefetch_queue =
+        furi_message_queue_alloc(HEX_EDITOR_PAGES_QUEUE_SIZE, sizeof(uint32_t));
+    pages->thread = furi_thread_alloc_ex(TAG, 1024, hex_editor_pages_prefetch_thread, pages);
+    return pages;
+}
+
+void hex_editor_pages_free(HexEditorPages* pages) {
+    furi_assert(pages);
+
+    if(furi_thread_get_state(pages->thread) != FuriThreadStateStopped) {
+        uint32_t index = HEX_EDITOR_PAGES_EXIT;
+        furi_message_queue_reset(pages->prefetch_queue);
+        furi_message_queue_put(pages->prefetch_queue, &index, FuriWaitForever);
+        furi_thread_join(pages->thread);
+    }
+    furi_thread_free(pages->thread);
+
+    furi_message_queue_free(pages->prefetch_queue);
+    furi_mutex_free(pages->mutex);
+    storage_file_free(pages->file);
+    free(pages);
+}
+
+bool hex_editor_pages_open(HexEditorPages* pages, const char* path) {
+    furi_assert(pages);
+    furi_assert(path);
+
+    if(!storage_file_open(pages->file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        FURI_LOG_E(TAG, "Unable to open file: %s", path);
+        return false;
+    }
+
+    pages->file_size = storage_file_size(pages->file);
+    furi_thread_start(pages->thread);
+    return true;
+}
+
+uint32_t hex_editor_pages_get_size(HexEditorPages* pages) {
+    furi_assert(pages);
+    return pages->file_size;
+}
+
+size_t hex_editor_pages_read(HexEditorPages* pages, uint32_t offset, uint8_t* data, size_t size) {
+    furi_assert(pages);
+    size_t read = 0;
+
+    furi_check(furi_mutex_acquire(pages->mutex, FuriWaitForever) == FuriStatusOk);
+    while(read < size && offset < pages->file_size) {
+        HexEditorPage* page = hex_editor_pages_load(pages, offset / HEX_EDITOR_PAGE_SIZE);
+        uint32_t page_offset = offset % HEX_EDITOR_PAGE_SIZE;
+        if(!page || page_offset >= page->size) break;
+
+        size_t to_copy = MIN(size - read, (size_t)(page->size - page_offset));
+        memcpy(data + read, page->data + page_offset, to_copy);
+        read += to_copy;
+        offset += to_copy;
+    }
+    furi_mutex_release(pages->mutex);
+
+    return read;
+}
+
+bool hex_editor_pages_write(HexEditorPages* pages, uint32_t offset, uint8_t byte) {
+    furi_assert(pages);
+    bool success = false;
+
+    furi_check(furi_mutex_acquire(pages->mutex, FuriWaitForever) == FuriStatusOk);
+    do {
+        if(offset >= pages->file_size) break;
+        if(!storage_file_seek(pages->file, offset, true)) break;
+        if(storage_file_write(pages->file, &byte, 1) != 1) break;
+
+        HexEditorPage* page = hex_editor_pages_find(pages, offset / HEX_EDITOR_PAGE_SIZE);
+        if(page) page->data[offset % HEX_EDITOR_PAGE_SIZE] = byte;
+        success = true;
+    } while(false);
+    furi_mutex_release(pages->mutex);
+
+    if(!success) FURI_LOG_E(TAG, "Unable to write at %lu", offset);
+    return success;
+}
+
+void hex_editor_pages_prefetch(HexEditorPages* pages, uint32_t offset, bool forward) {
+    furi_assert(pages);
+
+    uint32_t index = offset / HEX_EDITOR_PAGE_SIZE;
+    if(forward) {
+        index++;
+        if(index * HEX_EDITOR_PAGE_SIZE >= pages->file_size) return;
+    } else {
+        if(index == 0) return;
+        index--;
+    }
+
+    // Queue is small on purpose, stale requests are dropped when user scrolls fast
+    furi_message_queue_put(pages->prefetch_queue, &index, 0);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <storage/storage.h>
+
+#define HEX_EDITOR_PAGE_SIZE 512
+
+/** Paged file access with small LRU cache and background prefetch */
+typedef struct HexEditorPages HexEditorPages;
+
+HexEditorPages* hex_editor_pages_alloc(Storage* storage);
+
+void hex_editor_pages_free(HexEditorPages* pages);
+
+bool hex_editor_pages_open(HexEditorPages* pages, const char* path);
+
+uint32_t hex_editor_pages_get_size(HexEditorPages* pages);
+
+/** Read bytes, only pages missing from cache touch the file
+ *
+ * @return     bytes read, less than size at the end of file
+ */
+size_t hex_editor_pages_read(HexEditorPages* pages, uint32_t offset, uint8_t* data, size_t size);
+
+/** Write byte through to file and cache */
+bool hex_editor_pages_write(HexEditorPages* pages, uint32_t offset, uint8_t byte);
+
+/** Load page next to offset in background, so scrolling that way doesn't wait for SD */
+void hex_editor_pages_prefetch(HexEditorPages* pages, uint32_t offset, bool forward);
@@ -1,4 +1,5 @@
 #include <furi.h>
+#include <furi_hal.h>
 #include <math.h>
 #include <gui/gui.h>
 #include <input/input.h>
@@ -14,6 +15,17 @@ typedef struct {
     InputEvent input;
 } PluginEvent;
 
+#define TAG "Mandelbrot"
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define MAX_ITERATION 50
+
+// Q7.25 fixed point, |z|^2 right before escape stays below 64
+#define FIXED_SHIFT 25
+#define FIXED_ONE (1L << FIXED_SHIFT)
+#define to_fixed(a) ((int32_t)((a) * (float)FIXED_ONE))
+
 typedef struct {
     FuriMutex* mutex;
     float xZoom;
@@ -21,60 +33,65 @@ typedef struct {
     float xOffset;
     float yOffset;
     float zoom;
+    // XBM, redrawn only when view changes
+    uint8_t bitmap[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+    bool dirty;
+    uint32_t render_time;
 } PluginState;
 
-bool mandelbrot_pixel(int x, int y, float xZoom, float yZoom, float xOffset, float yOffset) {
-    float ratio = 128.0 / 64.0;
-    //x0 := scaled x coordinate of pixel (scaled to lie in the Mandelbrot X scale (-2.00, 0.47))
-    float x0 = (((x / 128.0) * ratio * xZoom)) - xOffset;
-    //y0 := scaled y coordinate of pixel (scaled to lie in the Mandelbrot Y scale (-1.12, 1.12))
-    float y0 = ((y / 64.0) * yZoom) - yOffset;
-    float x1 = 0.0;
-    float y1 = 0.0;
-    float x2 = 0.0;
-    float y2 = 0.0;
+static bool mandelbrot_pixel(int32_t x0, int32_t y0) {
+    int32_t x1 = 0;
+    int32_t y1 = 0;
+    int32_t x2 = 0;
+    int32_t y2 = 0;
 
     int iteration = 0;
-    int max_iteration = 50;
 
-    while(x2 + y2 <= 4.0 && iteration < max_iteration) {
-        y1 = 2.0 * x1 * y1 + y0;
+    // Products are single SMULL instructions, squares are positive so the sum fits unsigned
+    while((uint32_t)x2 + (uint32_t)y2 <= 4 * FIXED_ONE && iteration < MAX_ITERATION) {
+        y1 = (((int64_t)x1 * y1) >> (FIXED_SHIFT - 1)) + y0;
         x1 = x2 - y2 + x0;
-        x2 = x1 * x1;
-        y2 = y1 * y1;
+        x2 = ((int64_t)x1 * x1) >> FIXED_SHIFT;
+        y2 = ((int64_t)y1 * y1) >> FIXED_SHIFT;
         iteration++;
     }
 
-    if(iteration > 49) {
-        return true;
+    return iteration == MAX_ITERATION;
+}
+
+static void mandelbrot_render(PluginState* const plugin_state) {
+    uint32_t start = DWT->CYCCNT;
+    float ratio = 128.0 / 64.0;
+
+    //x0 := scaled x coordinate of pixel (scaled to lie in the Mandelbrot X scale (-2.00, 0.47))
+    int32_t x_step = to_fixed(ratio * plugin_state->xZoom / SCREEN_WIDTH);
+    int32_t x_start = to_fixed(-plugin_state->xOffset);
+    //y0 := scaled y coordinate of pixel (scaled to lie in the Mandelbrot Y scale (-1.12, 1.12))
+    int32_t y_step = to_fixed(plugin_state->yZoom / SCREEN_HEIGHT);
+    int32_t y0 = to_fixed(-plugin_state->yOffset);
+
+    memset(plugin_state->bitmap, 0, sizeof(plugin_state->bitmap));
+    uint8_t* row = plugin_state->bitmap;
+    for(int y = 0; y < SCREEN_HEIGHT; y++, y0 += y_step, row += SCREEN_WIDTH / 8) {
+        int32_t x0 = x_start;
+        for(int x = 0; x < SCREEN_WIDTH; x++, x0 += x_step) {
+            if(mandelbrot_pixel(x0, y0)) row[x / 8] |= 1 << (x % 8);
+        }
     }
 
-    return false;
+    plugin_state->render_time =
+        (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond();
+    plugin_state->dirty = false;
+    FURI_LOG_D(TAG, "Rendered in %luus", plugin_state->render_time);
 }
 
 static void render_callback(Canvas* const canvas, void* ctx) {
     furi_assert(ctx);
     const PluginState* plugin_state = ctx;
     furi_mutex_acquire(plugin_state->mutex, FuriWaitForever);
+    canvas_draw_xbm(canvas, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, plugin_state->bitmap);
     // border around the edge of the screen
     canvas_draw_frame(canvas, 0, 0, 128, 64);
-
-    for(int y = 0; y < 64; y++) {
-        for(int x = 0; x < 128; x++) {
-            // did you know if you just pass the indivdiual bits of plugin_state instead of plugin_state
-            // you dont get any compiler warnings :)
-            if(mandelbrot_pixel(
-                   x,
-                   y,
-                   plugin_state->xZoom,
-                   plugin_state->yZoom,
-                   plugin_state->xOffset,
-                   plugin_state->yOffset)) {
-                canvas_draw_dot(canvas, x, y);
-            }
-        }
-    }
-
     furi_mutex_release(plugin_state->mutex);
 }
 
@@ -91,6 +108,7 @@ static void mandelbrot_state_init(PluginState* const plugin_state) {
     plugin_state->xZoom = 2.47;
     plugin_state->yZoom = 2.24;
     plugin_state->zoom = 1; // this controls the camera when
+    plugin_state->dirty = true;
 }
 
 int32_t mandelbrot_app(void* p) {
@@ -155,6 +173,8 @@ int32_t mandelbrot_app(void* p) {
                 }
             }
         }
+        if(event_status == FuriStatusOk) plugin_state->dirty = true;
+        if(plugin_state->dirty) mandelbrot_render(plugin_state);
         view_port_update(view_port);
         furi_mutex_release(plugin_state->mutex);
     }
@@ -22,7 +22,8 @@
 
 // must be SCSI_BLOCK_SIZE aligned
 // larger than 0x10000 exceeds size_t, storage_file_* ops fail
-#define USB_MSC_BUF_MAX (0x10000UL - SCSI_BLOCK_SIZE)
+// two buffers are allocated: one is on the bus while the other is on the disk
+#define USB_MSC_BUF_MAX (0x8000UL)
 
 static usbd_respond usb_ep_config(usbd_device* dev, uint8_t cfg);
 static usbd_respond usb_control(usbd_device* dev, usbd_ctlreq* req, usbd_rqc_callback* callback);
@@ -52,6 +53,18 @@ typedef struct {
     uint8_t status;
 } __attribute__((packed)) CSW;
 
+// Disk part of transfer, runs on the work queue so it overlaps with USB part
+typedef struct {
+    SCSISession* scsi;
+    FuriWork* work;
+    bool pending;
+    bool tx;
+    uint8_t* buf;
+    uint32_t len;
+    uint32_t cap;
+    bool result;
+} MassStorageTransfer;
+
 struct MassStorageUsb {
     FuriHalUsbInterface usb;
     FuriHalUsbInterface* usb_prev;
@@ -61,6 +74,39 @@ struct MassStorageUsb {
     SCSIDeviceFunc fn;
 };
 
+static void mass_transfer_callback(void* context) {
+    MassStorageTransfer* transfer = context;
+    if(transfer->tx) {
+        transfer->result =
+            scsi_cmd_tx_data(transfer->scsi, transfer->buf, &transfer->len, transfer->cap);
+    } else {
+        transfer->result = scsi_cmd_rx_data(transfer->scsi, transfer->buf, transfer->len);
+    }
+}
+
+static void mass_transfer_submit(
+    MassStorageTransfer* transfer,
+    bool tx,
+    uint8_t* buf,
+    uint32_t len,
+    uint32_t cap) {
+    furi_assert(!transfer->pending);
+    transfer->tx = tx;
+    transfer->buf = buf;
+    transfer->len = len;
+    transfer->cap = cap;
+    transfer->pending = true;
+    furi_work_submit(transfer->work, FuriWorkQueuePriorityHigh);
+}
+
+// Returns result of pending transfer, true if none
+static bool mass_transfer_wait(MassStorageTransfer* transfer) {
+    if(!transfer->pending) return true;
+    furi_work_wait(transfer->work, FuriWaitForever);
+    transfer->pending = false;
+    return transfer->result;
+}
+
 static int32_t mass_thread_worker(void* context) {
     MassStorageUsb* mass = context;
     usbd_device* dev = mass->dev;
@@ -69,8 +115,13 @@ static int32_t mass_thread_worker(void* context) {
     };
     CBW cbw = {0};
     CSW csw = {0};
+    uint8_t* bufs[2] = {NULL, NULL};
     uint8_t* buf = NULL;
     uint32_t buf_len = 0, buf_cap = 0, buf_sent = 0;
+    MassStorageTransfer transfer = {
+        .scsi = &scsi,
+    };
+    transfer.work = furi_work_alloc(mass_transfer_callback, &transfer);
     enum {
         StateReadCBW,
         StateReadData,
@@ -86,14 +137,16 @@ static int32_t mass_thread_worker(void* context) {
         }
         if(flags & EventReset) {
             FURI_LOG_D(TAG, "reset");
+            mass_transfer_wait(&transfer);
             scsi.sk = 0;
             scsi.asc = 0;
             memset(&cbw, 0, sizeof(cbw));
             memset(&csw, 0, sizeof(csw));
-            if(buf) {
-                free(buf);
-                buf = NULL;
+            for(size_t i = 0; i < COUNT_OF(bufs); i++) {
+                free(bufs[i]);
+                bufs[i] = NULL;
             }
+            buf = NULL;
             buf_len = buf_cap = buf_sent = 0;
             state = StateReadCBW;
         }
@@ -140,11 +193,12 @@ static int32_t mass_thread_worker(void* context) {
                     uint32_t buf_clamp = MIN(cbw.len, USB_MSC_BUF_MAX);
                     if(buf_clamp > buf_cap) {
                         FURI_LOG_T(TAG, "growing buf %lu -> %lu", buf_cap, buf_clamp);
-                        if(buf) {
-                            free(buf);
+                        for(size_t i = 0; i < COUNT_OF(bufs); i++) {
+                            free(bufs[i]);
+                            bufs[i] = malloc(buf_clamp);
                         }
                         buf_cap = buf_clamp;
-                        buf = malloc(buf_cap);
+                        buf = bufs[0];
                     }
                     if(buf_len < buf_clamp) {
                         int32_t len =
@@ -157,7 +211,8 @@ static int32_t mass_thread_worker(void* context) {
                         buf_len += len;
                     }
                     if(buf_len == buf_clamp) {
-                        if(!scsi_cmd_rx_data(&scsi, buf, buf_len)) {
+                        // Commit previous chunk, then this one while next is received
+                        if(!mass_transfer_wait(&transfer)) {
                             FURI_LOG_W(TAG, "short rx");
                             usbd_ep_stall(dev, USB_MSC_RX_EP);
                             csw.sig = CSW_SIG;
@@ -167,6 +222,8 @@ static int32_t mass_thread_worker(void* context) {
                             state = StateWriteCSW;
                             continue;
                         }
+                        mass_transfer_submit(&transfer, false, buf, buf_len, buf_len);
+                        buf = (buf == bufs[0]) ? bufs[1] : bufs[0];
                         cbw.len -= buf_len;
                         buf_len = 0;
                     }
@@ -181,17 +238,38 @@ static int32_t mass_thread_worker(void* context) {
                     uint32_t buf_clamp = MIN(cbw.len, USB_MSC_BUF_MAX);
                     if(buf_clamp > buf_cap) {
                         FURI_LOG_T(TAG, "growing buf %lu -> %lu", buf_cap, buf_clamp);
-                        if(buf) {
-                            free(buf);
+                        for(size_t i = 0; i < COUNT_OF(bufs); i++) {
+                            free(bufs[i]);
+                            bufs[i] = malloc(buf_clamp);
                         }
                         buf_cap = buf_clamp;
-                        buf = malloc(buf_cap);
+                        buf = bufs[0];
                     }
-                    if(!buf_len && !scsi_cmd_tx_data(&scsi, buf, &buf_len, buf_clamp)) {
-                        FURI_LOG_W(TAG, "short tx");
-                        // usbd_ep_stall(dev, USB_MSC_TX_EP);
-                        state = StateBuildCSW;
-                        continue;
+                    if(!buf_len) {
+                        bool result;
+                        if(transfer.pending) {
+                            // Chunk was read ahead while previous one was sent
+                            result = mass_transfer_wait(&transfer);
+                            buf = transfer.buf;
+                            buf_len = transfer.len;
+                        } else {
+                            result = scsi_cmd_tx_data(&scsi, buf, &buf_len, buf_clamp);
+                        }
+                        if(!result) {
+                            FURI_LOG_W(TAG, "short tx");
+                            // usbd_ep_stall(dev, USB_MSC_TX_EP);
+                            state = StateBuildCSW;
+                            continue;
+                        }
+                        // Read next chunk of the same command into the other buffer
+                        if(!scsi.tx_done && cbw.len > buf_len) {
+                            mass_transfer_submit(
+                                &transfer,
+                                true,
+                                (buf == bufs[0]) ? bufs[1] : bufs[0],
+                                0,
+                                MIN(cbw.len - buf_len, USB_MSC_BUF_MAX));
+                        }
                     }
                     int32_t len = usbd_ep_write(
                         dev,
@@ -214,7 +292,9 @@ static int32_t mass_thread_worker(void* context) {
                     FURI_LOG_T(TAG, "StateBuildCSW");
                     csw.sig = CSW_SIG;
                     csw.tag = cbw.tag;
-                    if(scsi_cmd_end(&scsi)) {
+                    // Last chunk is committed in background, its result counts too
+                    bool transfer_result = mass_transfer_wait(&transfer);
+                    if(scsi_cmd_end(&scsi) && transfer_result) {
                         csw.status = CSW_STATUS_OK;
                     } else {
                         csw.status = CSW_STATUS_NOK;
@@ -253,8 +333,10 @@ static int32_t mass_thread_worker(void* context) {
                 break;
             } while(true);
     }
-    if(buf) {
-        free(buf);
+    mass_transfer_wait(&transfer);
+    furi_work_free(transfer.work);
+    for(size_t i = 0; i < COUNT_OF(bufs); i++) {
+        free(bufs[i]);
     }
     return 0;
 }
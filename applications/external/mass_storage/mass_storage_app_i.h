@@ -37,6 +37,10 @@ struct MassStorageApp {
 
     FuriString* file_path;
     File* file;
+    // Contiguous image is accessed by SD card sectors, bypassing the filesystem
+    bool file_raw;
+    uint32_t file_sector;
+    uint32_t file_blocks;
     MassStorage* mass_storage_view;
 
     FuriMutex* usb_mutex;
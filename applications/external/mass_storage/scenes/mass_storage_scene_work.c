@@ -14,6 +14,20 @@ static bool file_read(
     uint32_t out_cap) {
     MassStorageApp* app = ctx;
     FURI_LOG_T(TAG, "file_read lba=%08lX count=%04X out_cap=%08lX", lba, count, out_cap);
+    if(app->file_raw) {
+        uint16_t blocks = MIN(out_cap / SCSI_BLOCK_SIZE, count);
+        if(lba + blocks > app->file_blocks) {
+            FURI_LOG_W(TAG, "read out of bounds");
+            return false;
+        }
+        if(storage_sd_read_sectors(app->fs_api, app->file_sector + lba, out, blocks) != FSE_OK) {
+            FURI_LOG_W(TAG, "sector read failed");
+            return false;
+        }
+        *out_len = blocks * SCSI_BLOCK_SIZE;
+        app->bytes_read += *out_len;
+        return true;
+    }
     if(!storage_file_seek(app->file, lba * SCSI_BLOCK_SIZE, true)) {
         FURI_LOG_W(TAG, "seek failed");
         return false;
@@ -32,6 +46,15 @@ static bool file_write(void* ctx, uint32_t lba, uint16_t count, uint8_t* buf, ui
         FURI_LOG_W(TAG, "bad write params count=%u len=%lu", count, len);
         return false;
     }
+    if(app->file_raw) {
+        if(lba + count > app->file_blocks) {
+            FURI_LOG_W(TAG, "write out of bounds");
+            return false;
+        }
+        app->bytes_written += len;
+        return storage_sd_write_sectors(app->fs_api, app->file_sector + lba, buf, count) ==
+               FSE_OK;
+    }
     if(!storage_file_seek(app->file, lba * SCSI_BLOCK_SIZE, true)) {
         FURI_LOG_W(TAG, "seek failed");
         return false;
@@ -42,7 +65,7 @@ static bool file_write(void* ctx, uint32_t lba, uint16_t count, uint8_t* buf, ui
 
 static uint32_t file_num_blocks(void* ctx) {
     MassStorageApp* app = ctx;
-    return storage_file_size(app->file) / SCSI_BLOCK_SIZE;
+    return app->file_blocks;
 }
 
 static void file_eject(void* ctx) {
@@ -100,6 +123,9 @@ void mass_storage_scene_work_on_enter(void* context) {
         furi_string_get_cstr(app->file_path),
         FSAM_READ | FSAM_WRITE,
         FSOM_OPEN_EXISTING));
+    app->file_blocks = storage_file_size(app->file) / SCSI_BLOCK_SIZE;
+    app->file_raw = storage_file_get_contiguous_sector(app->file, &app->file_sector);
+    FURI_LOG_I(TAG, "Image is %s", app->file_raw ? "contiguous, raw access" : "fragmented");
 
     SCSIDeviceFunc fn = {
         .ctx = app,
@@ -22,12 +22,18 @@
 #include <toolbox/stream/buffered_file_stream.h>
 #include <lib/toolbox/args.h>
 #include <lib/flipper_format/flipper_format.h>
+#include <nfc/protocols/mf_classic/crypto1.h>
 #include <dolphin/dolphin.h>
 #include <notification/notification_messages.h>
 
 #define MF_CLASSIC_DICT_FLIPPER_PATH EXT_PATH("nfc/assets/mf_classic_dict.nfc")
 #define MF_CLASSIC_DICT_USER_PATH EXT_PATH("nfc/assets/mf_classic_dict_user.nfc")
 #define MF_CLASSIC_NONCE_PATH EXT_PATH("nfc/.mfkey32.log")
+#define MF_CLASSIC_NONCE_BIN_PATH EXT_PATH("nfc/.mfkey32.bin")
+// Binary nonce log format, must match NFC app mfkey32_logger
+#define MF_CLASSIC_NONCE_BIN_MAGIC (0x3233464DU) // "MF32"
+#define MF_CLASSIC_NONCE_BIN_VERSION (1U)
+#define MFKEY32_CHECKPOINT_PATH EXT_PATH("nfc/.mfkey32.checkpoint")
 #define TAG "Mfkey32"
 #define NFC_MF_CLASSIC_KEY_LEN (13)
 
@@ -40,14 +46,14 @@
 #define CONST_M2_2 (LF_POLY_EVEN << 1 | 1)
 #define BIT(x, n) ((x) >> (n)&1)
 #define BEBIT(x, n) BIT(x, (n) ^ 24)
-#define SWAPENDIAN(x) \
-    ((x) = ((x) >> 8 & 0xff00ff) | ((x)&0xff00ff) << 8, (x) = (x) >> 16 | (x) << 16)
 //#define SIZEOF(arr) sizeof(arr) / sizeof(*arr)
 
 static int eta_round_time = 56;
 static int eta_total_time = 900;
 // MSB_LIMIT: Chunk size (out of 256)
 static int MSB_LIMIT = 16;
+// MSB value stored in checkpoint once whole search space is done
+#define MSB_EXHAUSTED (256)
 
 struct Crypto1State {
     uint32_t odd, even;
@@ -55,6 +61,7 @@ struct Crypto1State {
 struct Crypto1Params {
     uint64_t key;
     uint32_t nr0_enc, uid_xor_nt0, uid_xor_nt1, nr1_enc, p64b, ar1_enc;
+    bool found;
 };
 struct Msb {
     int tail;
@@ -116,13 +123,48 @@ typedef struct {
     uint32_t ar1_enc; // second encrypted reader response
 } MfClassicNonce;
 
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t record_size;
+    uint16_t reserved;
+} MfClassicNonceBinHeader;
+
+typedef struct {
+    uint32_t cuid;
+    uint8_t sector_num;
+    uint8_t key_type;
+    uint16_t reserved;
+    uint32_t nt0;
+    uint32_t nr0;
+    uint32_t ar0;
+    uint32_t nt1;
+    uint32_t nr1;
+    uint32_t ar1;
+} MfClassicNonceBinRecord;
+
+// Nonces are streamed from the log, only one bit per nonce is kept in RAM
 typedef struct {
     Stream* stream;
-    uint32_t total_nonces;
-    MfClassicNonce* remaining_nonce_array;
+    bool binary; // Binary log, legacy text log otherwise
+    FuriString* line;
+    uint32_t total_nonces; // Nonces left to crack
+    size_t record_count; // Nonces in the log
+    uint32_t* done_mask; // Nonces with key already known
     size_t remaining_nonces;
 } MfClassicNonceArray;
 
+// Search progress of one nonce pair, survives app restart
+typedef struct {
+    MfClassicNonce nonce;
+    uint32_t next_msb; // First MSB of the next round to run
+} MfkeyCheckpointEntry;
+
+typedef struct {
+    MfkeyCheckpointEntry* entries;
+    size_t count;
+} MfkeyCheckpoint;
+
 typedef enum {
     MfClassicDictTypeSystem,
     MfClassicDictTypeUser,
@@ -166,12 +208,8 @@ static const uint8_t lookup2[256] = {
     2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2,
     2, 6, 2, 2, 6, 6, 6, 6, 2, 2, 6, 6, 2, 6, 2, 2, 2, 6, 2, 2, 6, 6, 6, 6};
 
-uint32_t prng_successor(uint32_t x, uint32_t n) {
-    SWAPENDIAN(x);
-    while(n--) x = x >> 1 | (x >> 16 ^ x >> 18 ^ x >> 19 ^ x >> 21) << 31;
-    return SWAPENDIAN(x);
-}
-
+// Key recovery works on partial states and rolls the cipher back, which firmware Crypto1
+// doesn't do. Hot loops stay inline here, shared parts come from firmware crypto1.h
 static inline int filter(uint32_t const x) {
     uint32_t f;
     f = lookup1[x & 0xff] | lookup2[(x >> 8) & 0xff];
@@ -462,6 +500,7 @@ int calculate_msb_tables(
     int eks,
     int msb_round,
     struct Crypto1Params* p,
+    int p_count,
     unsigned int* states_buffer,
     struct Msb* odd_msbs,
     struct Msb* even_msbs,
@@ -536,30 +575,43 @@ int calculate_msb_tables(
     oks >>= 12;
     eks >>= 12;
 
+    int remaining = 0;
+    for(j = 0; j < p_count; j++) {
+        if(!p[j].found) remaining++;
+    }
+
     for(i = 0; i < MSB_LIMIT; i++) {
         if(sync_state(program_state) == 1) {
             return 0;
         }
-        // TODO: Why is this necessary?
-        memset(temp_states_even, 0, sizeof(unsigned int) * (1280));
-        memset(temp_states_odd, 0, sizeof(unsigned int) * (1280));
-        memcpy(temp_states_odd, odd_msbs[i].states, odd_msbs[i].tail * sizeof(unsigned int));
-        memcpy(temp_states_even, even_msbs[i].states, even_msbs[i].tail * sizeof(unsigned int));
-        int res = old_recover(
-            temp_states_odd,
-            0,
-            odd_msbs[i].tail,
-            oks,
-            temp_states_even,
-            0,
-            even_msbs[i].tail,
-            eks,
-            3,
-            0,
-            p,
-            1);
-        if(res == -1) {
-            return 1;
+        // Tables only depend on keystream, check every pair sharing it
+        for(j = 0; j < p_count; j++) {
+            if(p[j].found) continue;
+            // TODO: Why is this necessary?
+            memset(temp_states_even, 0, sizeof(unsigned int) * (1280));
+            memset(temp_states_odd, 0, sizeof(unsigned int) * (1280));
+            memcpy(temp_states_odd, odd_msbs[i].states, odd_msbs[i].tail * sizeof(unsigned int));
+            memcpy(
+                temp_states_even, even_msbs[i].states, even_msbs[i].tail * sizeof(unsigned int));
+            int res = old_recover(
+                temp_states_odd,
+                0,
+                odd_msbs[i].tail,
+                oks,
+                temp_states_even,
+                0,
+                even_msbs[i].tail,
+                eks,
+                3,
+                0,
+                &p[j],
+                1);
+            if(res == -1) {
+                p[j].found = true;
+                if(--remaining == 0) {
+                    return 1;
+                }
+            }
         }
         //odd_msbs[i].tail = 0;
         //even_msbs[i].tail = 0;
@@ -568,7 +620,82 @@ int calculate_msb_tables(
     return 0;
 }
 
-bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
+static void mfkey32_checkpoint_load(MfkeyCheckpoint* checkpoint) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    checkpoint->entries = NULL;
+    checkpoint->count = 0;
+    do {
+        if(!storage_file_open(file, MFKEY32_CHECKPOINT_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+        uint64_t size = storage_file_size(file);
+        if((size == 0) || (size % sizeof(MfkeyCheckpointEntry))) {
+            FURI_LOG_W(TAG, "Ignoring invalid checkpoint");
+            break;
+        }
+        checkpoint->entries = malloc(size);
+        if(storage_file_read(file, checkpoint->entries, size) != size) {
+            free(checkpoint->entries);
+            checkpoint->entries = NULL;
+            break;
+        }
+        checkpoint->count = size / sizeof(MfkeyCheckpointEntry);
+        FURI_LOG_I(TAG, "Loaded checkpoint with %zu nonces", checkpoint->count);
+    } while(false);
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void mfkey32_checkpoint_save(MfkeyCheckpoint* checkpoint) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    size_t size = checkpoint->count * sizeof(MfkeyCheckpointEntry);
+    if(!storage_file_open(file, MFKEY32_CHECKPOINT_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS) ||
+       (storage_file_write(file, checkpoint->entries, size) != size)) {
+        FURI_LOG_E(TAG, "Failed to save checkpoint");
+    }
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void mfkey32_checkpoint_free(MfkeyCheckpoint* checkpoint, bool remove) {
+    if(remove) {
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        storage_simply_remove(storage, MFKEY32_CHECKPOINT_PATH);
+        furi_record_close(RECORD_STORAGE);
+    }
+    free(checkpoint->entries);
+    checkpoint->entries = NULL;
+    checkpoint->count = 0;
+}
+
+// Returns checkpoint entry index for nonce, entry is added if nonce is new
+static size_t mfkey32_checkpoint_get(MfkeyCheckpoint* checkpoint, const MfClassicNonce* nonce) {
+    for(size_t i = 0; i < checkpoint->count; i++) {
+        if(memcmp(&checkpoint->entries[i].nonce, nonce, sizeof(MfClassicNonce)) == 0) {
+            return i;
+        }
+    }
+    checkpoint->entries = realloc( //-V701
+        checkpoint->entries,
+        sizeof(MfkeyCheckpointEntry) * (checkpoint->count + 1));
+    checkpoint->entries[checkpoint->count].nonce = *nonce;
+    checkpoint->entries[checkpoint->count].next_msb = 0;
+    return checkpoint->count++;
+}
+
+bool recover(
+    struct Crypto1Params* p,
+    int p_count,
+    int ks2,
+    MfkeyCheckpoint* checkpoint,
+    const size_t* checkpoint_entries,
+    ProgramState* program_state) {
     bool found = false;
     unsigned int* states_buffer = malloc(sizeof(unsigned int) * (2 << 9));
     struct Msb* odd_msbs = (struct Msb*)malloc(MSB_LIMIT * sizeof(struct Msb));
@@ -583,10 +710,15 @@ bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
     for(i = 30; i >= 0; i -= 2) {
         eks = eks << 1 | BEBIT(ks2, i);
     }
+    // Pairs are always searched together, resume from the least advanced one
+    uint32_t next_msb = MSB_EXHAUSTED;
+    for(i = 0; i < p_count; i++) {
+        next_msb = MIN(next_msb, checkpoint->entries[checkpoint_entries[i]].next_msb);
+    }
     int bench_start = furi_hal_rtc_get_timestamp();
     program_state->eta_total = eta_total_time;
     program_state->eta_timestamp = bench_start;
-    for(msb = 0; msb <= ((256 / MSB_LIMIT) - 1); msb++) {
+    for(msb = next_msb / MSB_LIMIT; msb <= ((256 / MSB_LIMIT) - 1); msb++) {
         program_state->search = msb;
         program_state->eta_round = eta_round_time;
         program_state->eta_total = eta_total_time - (eta_round_time * msb);
@@ -595,6 +727,7 @@ bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
                eks,
                msb,
                p,
+               p_count,
                states_buffer,
                odd_msbs,
                even_msbs,
@@ -609,6 +742,13 @@ bool recover(struct Crypto1Params* p, int ks2, ProgramState* program_state) {
         if(program_state->close_thread_please) {
             break;
         }
+        for(i = 0; i < p_count; i++) {
+            checkpoint->entries[checkpoint_entries[i]].next_msb = MSB_LIMIT * (msb + 1);
+        }
+        mfkey32_checkpoint_save(checkpoint);
+    }
+    for(i = 0; i < p_count; i++) {
+        found |= p[i].found;
     }
     free(states_buffer);
     free(odd_msbs);
@@ -854,31 +994,130 @@ bool napi_key_already_found_for_nonce(
 bool napi_mf_classic_nonces_check_presence() {
     Storage* storage = furi_record_open(RECORD_STORAGE);
 
-    bool nonces_present = storage_common_stat(storage, MF_CLASSIC_NONCE_PATH, NULL) == FSE_OK;
+    bool nonces_present =
+        (storage_common_stat(storage, MF_CLASSIC_NONCE_BIN_PATH, NULL) == FSE_OK) ||
+        (storage_common_stat(storage, MF_CLASSIC_NONCE_PATH, NULL) == FSE_OK);
 
     furi_record_close(RECORD_STORAGE);
 
     return nonces_present;
 }
 
-MfClassicNonceArray* napi_mf_classic_nonce_array_alloc(
-    MfClassicDict* system_dict,
-    bool system_dict_exists,
-    MfClassicDict* user_dict,
-    ProgramState* program_state) {
-    MfClassicNonceArray* nonce_array = malloc(sizeof(MfClassicNonceArray));
-    MfClassicNonce* remaining_nonce_array_init = malloc(sizeof(MfClassicNonce) * 1);
-    nonce_array->remaining_nonce_array = remaining_nonce_array_init;
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    nonce_array->stream = buffered_file_stream_alloc(storage);
-    furi_record_close(RECORD_STORAGE);
+static bool napi_mf_classic_nonce_parse_line(const char* line, MfClassicNonce* res) {
+    // Sec %d key %c cuid %08lx nt0 %08lx nr0 %08lx ar0 %08lx nt1 %08lx nr1 %08lx ar1 %08lx
+    if(strncmp(line, "Sec", 3) != 0) return false;
+
+    memset(res, 0, sizeof(MfClassicNonce));
+    char* endptr;
+    for(int i = 0; i <= 17; i++) {
+        if(i != 0) {
+            line = strchr(line, ' ');
+            if(line) {
+                line++;
+            } else {
+                break;
+            }
+        }
+        unsigned long value = strtoul(line, &endptr, 16);
+        switch(i) {
+        case 5:
+            res->uid = value;
+            break;
+        case 7:
+            res->nt0 = value;
+            break;
+        case 9:
+            res->nr0_enc = value;
+            break;
+        case 11:
+            res->ar0_enc = value;
+            break;
+        case 13:
+            res->nt1 = value;
+            break;
+        case 15:
+            res->nr1_enc = value;
+            break;
+        case 17:
+            res->ar1_enc = value;
+            break;
+        default:
+            break; // Do nothing
+        }
+        line = endptr;
+    }
+
+    return true;
+}
+
+static bool
+    napi_mf_classic_nonce_read_next(MfClassicNonceArray* nonce_array, MfClassicNonce* res) {
+    bool nonce_read = false;
+
+    if(nonce_array->binary) {
+        MfClassicNonceBinRecord record;
+        if(stream_read(nonce_array->stream, (uint8_t*)&record, sizeof(record)) ==
+           sizeof(record)) {
+            res->uid = record.cuid;
+            res->nt0 = record.nt0;
+            res->nr0_enc = record.nr0;
+            res->ar0_enc = record.ar0;
+            res->nt1 = record.nt1;
+            res->nr1_enc = record.nr1;
+            res->ar1_enc = record.ar1;
+            nonce_read = true;
+        }
+    } else {
+        while(stream_read_line(nonce_array->stream, nonce_array->line)) {
+            FURI_LOG_T(TAG, "Read line: %s", furi_string_get_cstr(nonce_array->line));
+            if(napi_mf_classic_nonce_parse_line(furi_string_get_cstr(nonce_array->line), res)) {
+                nonce_read = true;
+                break;
+            }
+        }
+    }
+
+    return nonce_read;
+}
+
+static bool napi_mf_classic_nonce_rewind(MfClassicNonceArray* nonce_array) {
+    size_t offset = nonce_array->binary ? sizeof(MfClassicNonceBinHeader) : 0;
+    return stream_seek(nonce_array->stream, offset, StreamOffsetFromStart);
+}
+
+static bool napi_mf_classic_nonce_is_done(MfClassicNonceArray* nonce_array, size_t index) {
+    return nonce_array->done_mask[index / 32] & (1UL << (index % 32));
+}
+
+static void napi_mf_classic_nonce_set_done(MfClassicNonceArray* nonce_array, size_t index) {
+    nonce_array->done_mask[index / 32] |= (1UL << (index % 32));
+}
+
+static bool napi_mf_classic_nonce_open(MfClassicNonceArray* nonce_array) {
+    bool opened = false;
 
-    bool array_loaded = false;
     do {
+        // Binary log is written by current firmware, text log is only read if there is no other
+        if(buffered_file_stream_open(
+               nonce_array->stream, MF_CLASSIC_NONCE_BIN_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            MfClassicNonceBinHeader header;
+            if((stream_read(nonce_array->stream, (uint8_t*)&header, sizeof(header)) !=
+                sizeof(header)) ||
+               (header.magic != MF_CLASSIC_NONCE_BIN_MAGIC) ||
+               (header.version != MF_CLASSIC_NONCE_BIN_VERSION) ||
+               (header.record_size != sizeof(MfClassicNonceBinRecord))) {
+                FURI_LOG_E(TAG, "Invalid binary nonce log");
+                break;
+            }
+            nonce_array->binary = true;
+            opened = true;
+            break;
+        }
+        buffered_file_stream_close(nonce_array->stream);
+
         // https://github.com/flipperdevices/flipperzero-firmware/blob/5134f44c09d39344a8747655c0d59864bb574b96/applications/services/storage/filesystem_api_defines.h#L8-L22
         if(!buffered_file_stream_open(
                nonce_array->stream, MF_CLASSIC_NONCE_PATH, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
-            buffered_file_stream_close(nonce_array->stream);
             break;
         }
 
@@ -894,61 +1133,40 @@ MfClassicNonceArray* napi_mf_classic_nonce_array_alloc(
             if(!stream_rewind(nonce_array->stream)) break;
         }
 
-        // Read total amount of nonces
-        FuriString* next_line;
-        next_line = furi_string_alloc();
-        while(!(program_state->close_thread_please)) {
-            if(!stream_read_line(nonce_array->stream, next_line)) {
-                FURI_LOG_T(TAG, "No nonces left");
-                break;
-            }
-            FURI_LOG_T(
-                TAG,
-                "Read line: %s, len: %zu",
-                furi_string_get_cstr(next_line),
-                furi_string_size(next_line));
-            if(!furi_string_start_with_str(next_line, "Sec")) continue;
-            const char* next_line_cstr = furi_string_get_cstr(next_line);
-            MfClassicNonce res = {0};
-            int i = 0;
-            char* endptr;
-            for(i = 0; i <= 17; i++) {
-                if(i != 0) {
-                    next_line_cstr = strchr(next_line_cstr, ' ');
-                    if(next_line_cstr) {
-                        next_line_cstr++;
-                    } else {
-                        break;
-                    }
-                }
-                unsigned long value = strtoul(next_line_cstr, &endptr, 16);
-                switch(i) {
-                case 5:
-                    res.uid = value;
-                    break;
-                case 7:
-                    res.nt0 = value;
-                    break;
-                case 9:
-                    res.nr0_enc = value;
-                    break;
-                case 11:
-                    res.ar0_enc = value;
-                    break;
-                case 13:
-                    res.nt1 = value;
-                    break;
-                case 15:
-                    res.nr1_enc = value;
-                    break;
-                case 17:
-                    res.ar1_enc = value;
-                    break;
-                default:
-                    break; // Do nothing
-                }
-                next_line_cstr = endptr;
+        nonce_array->binary = false;
+        opened = true;
+    } while(false);
+
+    return opened;
+}
+
+MfClassicNonceArray* napi_mf_classic_nonce_array_alloc(
+    MfClassicDict* system_dict,
+    bool system_dict_exists,
+    MfClassicDict* user_dict,
+    ProgramState* program_state) {
+    MfClassicNonceArray* nonce_array = malloc(sizeof(MfClassicNonceArray));
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    nonce_array->stream = buffered_file_stream_alloc(storage);
+    furi_record_close(RECORD_STORAGE);
+    nonce_array->line = furi_string_alloc();
+
+    bool array_loaded = false;
+    do {
+        if(!napi_mf_classic_nonce_open(nonce_array)) break;
+
+        // Count nonces and mark the ones with key in dictionaries
+        MfClassicNonce res;
+        while(!(program_state->close_thread_please) &&
+              napi_mf_classic_nonce_read_next(nonce_array, &res)) {
+            size_t index = nonce_array->record_count++;
+            if(index % 32 == 0) {
+                nonce_array->done_mask = realloc( //-V701
+                    nonce_array->done_mask,
+                    sizeof(uint32_t) * (index / 32 + 1));
+                nonce_array->done_mask[index / 32] = 0;
             }
+
             (program_state->total)++;
             uint32_t p64b = prng_successor(res.nt1, 64);
             if((system_dict_exists &&
@@ -958,27 +1176,20 @@ MfClassicNonceArray* napi_mf_classic_nonce_array_alloc(
                    user_dict, res.uid ^ res.nt1, res.nr1_enc, p64b, res.ar1_enc))) {
                 (program_state->cracked)++;
                 (program_state->num_completed)++;
+                napi_mf_classic_nonce_set_done(nonce_array, index);
                 continue;
             }
             FURI_LOG_I(TAG, "No key found for %8lx %8lx", res.uid, res.ar1_enc);
-            // TODO: Refactor
-            nonce_array->remaining_nonce_array = realloc( //-V701
-                nonce_array->remaining_nonce_array,
-                sizeof(MfClassicNonce) * ((nonce_array->remaining_nonces) + 1));
             nonce_array->remaining_nonces++;
-            nonce_array->remaining_nonce_array[(nonce_array->remaining_nonces) - 1] = res;
             nonce_array->total_nonces++;
         }
-        furi_string_free(next_line);
-        buffered_file_stream_close(nonce_array->stream);
 
         array_loaded = true;
         FURI_LOG_I(TAG, "Loaded %lu nonces", nonce_array->total_nonces);
     } while(false);
 
     if(!array_loaded) {
-        free(nonce_array);
-        nonce_array = NULL;
+        FURI_LOG_E(TAG, "Failed to open nonce log");
     }
 
     return nonce_array;
@@ -990,6 +1201,8 @@ void napi_mf_classic_nonce_array_free(MfClassicNonceArray* nonce_array) {
 
     buffered_file_stream_close(nonce_array->stream);
     stream_free(nonce_array->stream);
+    furi_string_free(nonce_array->line);
+    free(nonce_array->done_mask);
     free(nonce_array);
 }
 
@@ -1053,68 +1266,118 @@ void mfkey32(ProgramState* program_state) {
         MSB_LIMIT /= 2;
     }
     program_state->mfkey_state = MfkeyAttack;
-    // TODO: Work backwards on this array and free memory
-    for(i = 0; i < nonce_arr->total_nonces; i++) {
-        MfClassicNonce next_nonce = nonce_arr->remaining_nonce_array[i];
+    MfkeyCheckpoint checkpoint;
+    mfkey32_checkpoint_load(&checkpoint);
+    size_t group_capacity = 4;
+    struct Crypto1Params* group = malloc(sizeof(struct Crypto1Params) * group_capacity);
+    size_t* group_entries = malloc(sizeof(size_t) * group_capacity);
+    napi_mf_classic_nonce_rewind(nonce_arr);
+    for(i = 0; i < nonce_arr->record_count; i++) {
+        MfClassicNonce next_nonce;
+        if(!napi_mf_classic_nonce_read_next(nonce_arr, &next_nonce)) break;
+        if(napi_mf_classic_nonce_is_done(nonce_arr, i)) continue;
+        size_t next_offset = stream_tell(nonce_arr->stream);
         uint32_t p64 = prng_successor(next_nonce.nt0, 64);
-        uint32_t p64b = prng_successor(next_nonce.nt1, 64);
-        if(key_already_found_for_nonce(
-               keyarray,
-               keyarray_size,
-               next_nonce.uid ^ next_nonce.nt1,
-               next_nonce.nr1_enc,
-               p64b,
-               next_nonce.ar1_enc)) {
-            nonce_arr->remaining_nonces--;
-            (program_state->cracked)++;
-            (program_state->num_completed)++;
-            continue;
+        // Pairs with the same first half share MSB tables, search them at once
+        int group_size = 0;
+        MfClassicNonce nonce_data = next_nonce;
+        MfClassicNonce* nonce = &nonce_data;
+        for(j = i; j < nonce_arr->record_count; j++) {
+            if((j != i) && !napi_mf_classic_nonce_read_next(nonce_arr, nonce)) break;
+            if(napi_mf_classic_nonce_is_done(nonce_arr, j)) continue;
+            if(nonce->uid != next_nonce.uid || nonce->nt0 != next_nonce.nt0 ||
+               nonce->nr0_enc != next_nonce.nr0_enc || nonce->ar0_enc != next_nonce.ar0_enc) {
+                continue;
+            }
+            napi_mf_classic_nonce_set_done(nonce_arr, j);
+            uint32_t p64b = prng_successor(nonce->nt1, 64);
+            if(key_already_found_for_nonce(
+                   keyarray,
+                   keyarray_size,
+                   nonce->uid ^ nonce->nt1,
+                   nonce->nr1_enc,
+                   p64b,
+                   nonce->ar1_enc)) {
+                nonce_arr->remaining_nonces--;
+                (program_state->cracked)++;
+                (program_state->num_completed)++;
+                continue;
+            }
+            size_t entry = mfkey32_checkpoint_get(&checkpoint, nonce);
+            if(checkpoint.entries[entry].next_msb >= MSB_EXHAUSTED) {
+                // Searched before without result
+                (program_state->num_completed)++;
+                continue;
+            }
+            if((size_t)group_size == group_capacity) {
+                group_capacity *= 2;
+                group = realloc(group, sizeof(struct Crypto1Params) * group_capacity); //-V701
+                group_entries = realloc(group_entries, sizeof(size_t) * group_capacity); //-V701
+            }
+            group[group_size] = (struct Crypto1Params){
+                .key = 0,
+                .nr0_enc = nonce->nr0_enc,
+                .uid_xor_nt0 = nonce->uid ^ nonce->nt0,
+                .uid_xor_nt1 = nonce->uid ^ nonce->nt1,
+                .nr1_enc = nonce->nr1_enc,
+                .p64b = p64b,
+                .ar1_enc = nonce->ar1_enc,
+                .found = false,
+            };
+            group_entries[group_size] = entry;
+            group_size++;
         }
-        FURI_LOG_I(TAG, "Cracking %8lx %8lx", next_nonce.uid, next_nonce.ar1_enc);
-        struct Crypto1Params p = {
-            0,
-            next_nonce.nr0_enc,
-            next_nonce.uid ^ next_nonce.nt0,
-            next_nonce.uid ^ next_nonce.nt1,
-            next_nonce.nr1_enc,
-            p64b,
-            next_nonce.ar1_enc};
-        if(!recover(&p, next_nonce.ar0_enc ^ p64, program_state)) {
-            if(program_state->close_thread_please) {
-                break;
+        stream_seek(nonce_arr->stream, next_offset, StreamOffsetFromStart);
+        if(group_size == 0) continue;
+        FURI_LOG_I(
+            TAG, "Cracking %8lx %8lx (%d pairs)", next_nonce.uid, next_nonce.ar1_enc, group_size);
+        recover(
+            group,
+            group_size,
+            next_nonce.ar0_enc ^ p64,
+            &checkpoint,
+            group_entries,
+            program_state);
+        for(int k = 0; k < group_size; k++) {
+            if(!group[k].found) {
+                // No key found in recover()
+                if(!program_state->close_thread_please) {
+                    (program_state->num_completed)++;
+                }
+                continue;
             }
-            // No key found in recover()
+            (program_state->cracked)++;
             (program_state->num_completed)++;
-            continue;
-        }
-        (program_state->cracked)++;
-        (program_state->num_completed)++;
-        found_key = p.key;
-        bool already_found = false;
-        for(j = 0; j < keyarray_size; j++) {
-            if(keyarray[j] == found_key) {
-                already_found = true;
-                break;
+            found_key = group[k].key;
+            bool already_found = false;
+            for(j = 0; j < keyarray_size; j++) {
+                if(keyarray[j] == found_key) {
+                    already_found = true;
+                    break;
+                }
+            }
+            if(already_found == false) {
+                // New key, save right away so it is not lost if app is closed
+                keyarray = realloc(keyarray, sizeof(uint64_t) * (keyarray_size + 1)); //-V701
+                keyarray_size += 1;
+                keyarray[keyarray_size - 1] = found_key;
+                (program_state->unique_cracked)++;
+                FuriString* temp_key = furi_string_alloc();
+                furi_string_cat_printf(temp_key, "%012" PRIX64, found_key);
+                napi_mf_classic_dict_add_key_str(user_dict, temp_key);
+                furi_string_free(temp_key);
             }
         }
-        if(already_found == false) {
-            // New key
-            keyarray = realloc(keyarray, sizeof(uint64_t) * (keyarray_size + 1)); //-V701
-            keyarray_size += 1;
-            keyarray[keyarray_size - 1] = found_key;
-            (program_state->unique_cracked)++;
+        if(program_state->close_thread_please) {
+            break;
         }
     }
+    // Keep checkpoint only if interrupted
+    mfkey32_checkpoint_free(&checkpoint, !program_state->close_thread_please);
+    free(group_entries);
+    free(group);
     // TODO: Update display to show all keys were found
     // TODO: Prepend found key(s) to user dictionary file
-    //FURI_LOG_I(TAG, "Unique keys found:");
-    for(i = 0; i < keyarray_size; i++) {
-        //FURI_LOG_I(TAG, "%012" PRIx64, keyarray[i]);
-        FuriString* temp_key = furi_string_alloc();
-        furi_string_cat_printf(temp_key, "%012" PRIX64, keyarray[i]);
-        napi_mf_classic_dict_add_key_str(user_dict, temp_key);
-        furi_string_free(temp_key);
-    }
     if(keyarray_size > 0) {
         // TODO: Should we use DolphinDeedNfcMfcAdd?
         dolphin_deed(DolphinDeedNfcMfcAdd);
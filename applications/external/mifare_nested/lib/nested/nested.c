@@ -570,7 +570,7 @@ struct nonce_info_hard nested_hard_nonce_attack(
     uint64_t ui64Key,
     uint32_t* found,
     uint32_t* first_byte_sum,
-    Stream* file_stream) {
+    NestedNonceWriter* nonce_writer) {
     uint32_t cuid = 0;
     uint8_t same = 0;
     uint64_t previous = 0;
@@ -624,11 +624,9 @@ struct nonce_info_hard nested_hard_nonce_attack(
 
         previous = nt;
 
-        FuriString* row = furi_string_alloc_printf("%llu|%u\n", nt, pbits);
-        stream_write_string(file_stream, row);
+        nested_nonce_writer_add(nonce_writer, nt, pbits);
 
         FURI_LOG_D(TAG, "Accured %lu/8 nonces", i + 1);
-        furi_string_free(row);
     }
 
     if(same > 4) {
@@ -641,6 +639,9 @@ struct nonce_info_hard nested_hard_nonce_attack(
 
     nfc_deactivate();
 
+    // Rows are written to SD while next round is collected
+    nested_nonce_writer_flush(nonce_writer);
+
     return r;
 }
 
@@ -7,6 +7,7 @@
 #include <storage/storage.h>
 #include <stream/stream.h>
 #include <stream/buffered_file_stream.h>
+#include "nonce_writer.h"
 
 typedef enum {
     MifareNestedNonceNoTag,
@@ -71,7 +72,7 @@ struct nonce_info_hard nested_hard_nonce_attack(
     uint64_t ui64Key,
     uint32_t* found,
     uint32_t* first_byte_sum,
-    Stream* file_stream);
+    NestedNonceWriter* nonce_writer);
 
 uint32_t nested_calibrate_distance(
     FuriHalNfcTxRxContext* tx_rx,
@@ -0,0 +1,106 @@
+#include "nonce_writer.h"
+
+#include <furi.h>
+#include <stdio.h>
+
+#define TAG "NestedNonceWriter"
+
+#define NESTED_NONCE_WRITER_BUFFER_SIZE (512)
+// Longest row: 20 digit nonce, separator, 3 digit parity and new line
+#define NESTED_NONCE_WRITER_ROW_SIZE (32)
+
+typedef enum {
+    NestedNonceWriterFlagWrite = (1 << 0),
+    NestedNonceWriterFlagStop = (1 << 1),
+} NestedNonceWriterFlag;
+
+struct NestedNonceWriter {
+    Stream* stream;
+    FuriThread* thread;
+    // Taken while back buffer is owned by writer thread
+    FuriSemaphore* back_free;
+
+    char buffer[2][NESTED_NONCE_WRITER_BUFFER_SIZE];
+    size_t length;
+    uint8_t active;
+
+    uint8_t pending;
+    size_t pending_length;
+};
+
+static int32_t nested_nonce_writer_thread(void* context) {
+    NestedNonceWriter* writer = context;
+
+    for(;;) {
+        uint32_t flags = furi_thread_flags_wait(
+            NestedNonceWriterFlagWrite | NestedNonceWriterFlagStop,
+            FuriFlagWaitAny,
+            FuriWaitForever);
+
+        if(flags & NestedNonceWriterFlagWrite) {
+            const uint8_t* data = (const uint8_t*)writer->buffer[writer->pending];
+            if(stream_write(writer->stream, data, writer->pending_length) !=
+               writer->pending_length) {
+                FURI_LOG_E(TAG, "Failed to write nonces");
+            }
+            furi_semaphore_release(writer->back_free);
+        }
+
+        if(flags & NestedNonceWriterFlagStop) break;
+    }
+
+    return 0;
+}
+
+NestedNonceWriter* nested_nonce_writer_alloc(Stream* stream) {
+    furi_assert(stream);
+
+    NestedNonceWriter* writer = malloc(sizeof(NestedNonceWriter));
+    writer->stream = stream;
+    writer->back_free = furi_semaphore_alloc(1, 1);
+
+    writer->thread = furi_thread_alloc_ex(TAG, 1024, nested_nonce_writer_thread, writer);
+    furi_thread_start(writer->thread);
+
+    return writer;
+}
+
+void nested_nonce_writer_free(NestedNonceWriter* writer) {
+    furi_assert(writer);
+
+    nested_nonce_writer_flush(writer);
+
+    // Wait for the last write
+    furi_semaphore_acquire(writer->back_free, FuriWaitForever);
+    furi_thread_flags_set(furi_thread_get_id(writer->thread), NestedNonceWriterFlagStop);
+    furi_thread_join(writer->thread);
+    furi_thread_free(writer->thread);
+
+    furi_semaphore_free(writer->back_free);
+    free(writer);
+}
+
+void nested_nonce_writer_flush(NestedNonceWriter* writer) {
+    furi_assert(writer);
+
+    if(writer->length == 0) return;
+
+    furi_semaphore_acquire(writer->back_free, FuriWaitForever);
+    writer->pending = writer->active;
+    writer->pending_length = writer->length;
+    writer->active ^= 1;
+    writer->length = 0;
+    furi_thread_flags_set(furi_thread_get_id(writer->thread), NestedNonceWriterFlagWrite);
+}
+
+void nested_nonce_writer_add(NestedNonceWriter* writer, uint64_t nt, uint8_t pbits) {
+    furi_assert(writer);
+
+    if(writer->length + NESTED_NONCE_WRITER_ROW_SIZE > NESTED_NONCE_WRITER_BUFFER_SIZE) {
+        nested_nonce_writer_flush(writer);
+    }
+
+    char* row = &writer->buffer[writer->active][writer->length];
+    int length = snprintf(row, NESTED_NONCE_WRITER_ROW_SIZE, "%llu|%u\n", nt, pbits);
+    if(length > 0) writer->length += length;
+}
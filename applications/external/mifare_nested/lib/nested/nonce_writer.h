@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include <stream/stream.h>
+
+/**
+ * Nonce rows are collected to one buffer while the other one is written to SD
+ * by a separate thread, so card polling doesn't wait for storage.
+ */
+typedef struct NestedNonceWriter NestedNonceWriter;
+
+NestedNonceWriter* nested_nonce_writer_alloc(Stream* stream);
+
+/** Flush pending rows and wait until everything is written */
+void nested_nonce_writer_free(NestedNonceWriter* writer);
+
+/** Append hardnested nonce row, blocks only if both buffers are full */
+void nested_nonce_writer_add(NestedNonceWriter* writer, uint64_t nt, uint8_t pbits);
+
+/** Hand collected rows to writer thread without waiting for the write */
+void nested_nonce_writer_flush(NestedNonceWriter* writer);
@@ -1000,6 +1000,8 @@ void mifare_nested_worker_collect_nonces_hard(MifareNestedWorker* mifare_nested_
                 stream_write_string(file_stream, header);
                 furi_string_free(header);
 
+                NestedNonceWriter* nonce_writer = nested_nonce_writer_alloc(file_stream);
+
                 uint32_t first_byte_sum = 0;
                 uint32_t* found = malloc(sizeof(uint32_t) * 256);
                 for(uint32_t i = 0; i < 256; i++) {
@@ -1016,9 +1018,10 @@ void mifare_nested_worker_collect_nonces_hard(MifareNestedWorker* mifare_nested_
                         key,
                         found,
                         &first_byte_sum,
-                        file_stream);
+                        nonce_writer);
 
                     if(result.static_encrypted) {
+                        nested_nonce_writer_free(nonce_writer);
                         file_stream_close(file_stream);
 
                         storage_simply_remove(storage, furi_string_get_cstr(hardnested_file));
@@ -1087,6 +1090,7 @@ void mifare_nested_worker_collect_nonces_hard(MifareNestedWorker* mifare_nested_
                     }
                 }
 
+                nested_nonce_writer_free(nonce_writer);
                 free(found);
                 furi_string_free(hardnested_file);
                 file_stream_close(file_stream);
@@ -43,7 +43,11 @@ void nrf24_spi_trx(
     uint32_t timeout) {
     UNUSED(timeout);
     furi_hal_gpio_write(handle->cs, false);
-    furi_hal_spi_bus_trx(handle, tx, rx, size, nrf24_TIMEOUT);
+    if(size > nrf24_DMA_MIN_SIZE) {
+        furi_hal_spi_bus_trx_dma(handle, tx, rx, size, nrf24_TIMEOUT);
+    } else {
+        furi_hal_spi_bus_trx(handle, tx, rx, size, nrf24_TIMEOUT);
+    }
     furi_hal_gpio_write(handle->cs, true);
 }
 
@@ -234,6 +238,46 @@ uint8_t
     return status;
 }
 
+uint8_t nrf24_rxpacket_burst(
+    FuriHalSpiBusHandle* handle,
+    uint8_t (*packets)[nrf24_MAX_PAYLOAD],
+    uint8_t* sizes,
+    uint8_t count,
+    bool full) {
+    uint8_t received = 0;
+    uint8_t size = 0;
+    uint8_t tx_pl_wid[] = {R_RX_PL_WID, 0};
+    uint8_t rx_pl_wid[] = {0, 0};
+    uint8_t tx_cmd[nrf24_MAX_PAYLOAD + 1] = {0};
+    uint8_t tmp_packet[nrf24_MAX_PAYLOAD + 1] = {0};
+
+    uint8_t status = nrf24_status(handle);
+    if(full) size = nrf24_get_packetlen(handle);
+
+    while(received < count && nrf24_STATUS_RX_P_NO(status) != nrf24_RX_P_NO_EMPTY) {
+        if(!full) {
+            nrf24_spi_trx(handle, tx_pl_wid, rx_pl_wid, 2, nrf24_TIMEOUT);
+            size = rx_pl_wid[1];
+        }
+        if(size == 0 || size > nrf24_MAX_PAYLOAD) {
+            // Corrupted width, datasheet says to flush
+            nrf24_flush_rx(handle);
+            nrf24_write_reg(handle, REG_STATUS, RX_DR);
+            break;
+        }
+
+        tx_cmd[0] = R_RX_PAYLOAD;
+        nrf24_spi_trx(handle, tx_cmd, tmp_packet, size + 1, nrf24_TIMEOUT);
+        memcpy(packets[received], &tmp_packet[1], size);
+        sizes[received++] = size;
+
+        // Status is shifted out before the write, so it shows what is left in FIFO
+        status = nrf24_write_reg(handle, REG_STATUS, RX_DR);
+    }
+
+    return received;
+}
+
 uint8_t nrf24_txpacket(FuriHalSpiBusHandle* handle, uint8_t* payload, uint8_t size, bool ack) {
     uint8_t status = 0;
     uint8_t tx[size + 1];
@@ -509,6 +553,22 @@ bool nrf24_sniff_address(FuriHalSpiBusHandle* handle, uint8_t maclen, uint8_t* a
     return found;
 }
 
+uint8_t
+    nrf24_sniff_addresses(FuriHalSpiBusHandle* handle, uint8_t maclen, uint8_t (*addresses)[5]) {
+    uint8_t packets[nrf24_RX_FIFO_SIZE][nrf24_MAX_PAYLOAD];
+    uint8_t sizes[nrf24_RX_FIFO_SIZE];
+    uint8_t found = 0;
+
+    uint8_t received = nrf24_rxpacket_burst(handle, packets, sizes, nrf24_RX_FIFO_SIZE, true);
+    for(uint8_t i = 0; i < received; i++) {
+        if(!validate_address(packets[i])) continue;
+        for(int j = 0; j < maclen; j++) addresses[found][j] = packets[i][maclen - 1 - j];
+        found++;
+    }
+
+    return found;
+}
+
 uint8_t nrf24_find_channel(
     FuriHalSpiBusHandle* handle,
     uint8_t* srcmac,
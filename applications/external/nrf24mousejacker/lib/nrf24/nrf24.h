@@ -36,9 +36,19 @@ extern "C" {
 #define REG_TX_ADDR 0x10
 
 #define RX_PW_P0 0x11
+#define RX_DR 0x40
 #define TX_DS 0x20
 #define MAX_RT 0x10
 
+/* RX_P_NO field of STATUS register reads 0b111 when RX FIFO is empty */
+#define nrf24_STATUS_RX_P_NO(status) (((status) >> 1) & 0x07)
+#define nrf24_RX_P_NO_EMPTY 0x07
+#define nrf24_RX_FIFO_SIZE 3
+#define nrf24_MAX_PAYLOAD 32
+
+/* Transfers longer than this go over DMA, shorter ones are cheaper in blocking mode */
+#define nrf24_DMA_MIN_SIZE 8
+
 #define nrf24_TIMEOUT 500
 #define nrf24_CE_PIN &gpio_ext_pb2
 #define nrf24_HANDLE                                                                         \
@@ -267,6 +277,25 @@ uint8_t nrf24_set_dst_mac(FuriHalSpiBusHandle* handle, uint8_t* mac, uint8_t siz
 uint8_t
     nrf24_rxpacket(FuriHalSpiBusHandle* handle, uint8_t* packet, uint8_t* packetsize, bool full);
 
+/** Drains RX FIFO, reads up to count packets in one go
+ * Payloads are read over DMA, FIFO state is taken from the status byte clocked out with each
+ * command, so every packet costs width read, payload read and RX_DR clear
+ *
+ * @param      handle  - pointer to FuriHalSpiHandle
+ * @param[out] packets - packets contents
+ * @param[out] sizes - sizes of the received packets
+ * @param      count - max packets to read, nrf24_RX_FIFO_SIZE covers whole FIFO
+ * @param      full - boolean set to true, packet length is determined by RX_PW_P0 register, false it is determined by dynamic payload length command
+ * 
+ * @return     number of packets read
+ */
+uint8_t nrf24_rxpacket_burst(
+    FuriHalSpiBusHandle* handle,
+    uint8_t (*packets)[nrf24_MAX_PAYLOAD],
+    uint8_t* sizes,
+    uint8_t count,
+    bool full);
+
 /** Sends TX packet
  *
  * @param      handle  - pointer to FuriHalSpiHandle
@@ -319,6 +348,17 @@ void nrf24_init_promisc_mode(FuriHalSpiBusHandle* handle, uint8_t channel, uint8
  */
 bool nrf24_sniff_address(FuriHalSpiBusHandle* handle, uint8_t maclen, uint8_t* address);
 
+/** Drains RX FIFO and returns all possible addresses sniffed
+ * Call this only after calling nrf24_init_promisc_mode
+ * @param      handle  - pointer to FuriHalSpiHandle
+ * @param      maclen - length of target mac address
+ * @param[out] addresses - sniffed addresses, room for nrf24_RX_FIFO_SIZE entries
+ * 
+ * @return     number of addresses sniffed
+ */
+uint8_t
+    nrf24_sniff_addresses(FuriHalSpiBusHandle* handle, uint8_t maclen, uint8_t (*addresses)[5]);
+
 /** Sends ping packet on each channel for designated tx mac looking for ack
  * 
  * @param      handle  - pointer to FuriHalSpiHandle
@@ -45,7 +45,11 @@ void nrf24_spi_trx(
     uint32_t timeout) {
     UNUSED(timeout);
     furi_hal_gpio_write(handle->cs, false);
-    furi_hal_spi_bus_trx(handle, tx, rx, size, nrf24_TIMEOUT);
+    if(size > nrf24_DMA_MIN_SIZE) {
+        furi_hal_spi_bus_trx_dma(handle, tx, rx, size, nrf24_TIMEOUT);
+    } else {
+        furi_hal_spi_bus_trx(handle, tx, rx, size, nrf24_TIMEOUT);
+    }
     furi_hal_gpio_write(handle->cs, true);
 }
 
@@ -114,6 +118,10 @@ uint8_t nrf24_status(FuriHalSpiBusHandle* handle) {
     return status;
 }
 
+bool nrf24_rx_ready(FuriHalSpiBusHandle* handle) {
+    return nrf24_STATUS_RX_P_NO(nrf24_status(handle)) != nrf24_RX_P_NO_EMPTY;
+}
+
 uint32_t nrf24_get_rate(FuriHalSpiBusHandle* handle) {
     uint8_t setup = 0;
     uint32_t rate = 0;
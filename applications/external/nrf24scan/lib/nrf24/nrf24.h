@@ -51,6 +51,14 @@ extern "C" {
 #define TX_DS    0x20
 #define MAX_RT   0x10
 
+/* RX_P_NO field of STATUS register reads 0b111 when RX FIFO is empty */
+#define nrf24_STATUS_RX_P_NO(status) (((status) >> 1) & 0x07)
+#define nrf24_RX_P_NO_EMPTY 0x07
+#define nrf24_RX_FIFO_SIZE 3
+
+/* Transfers longer than this go over DMA, shorter ones are cheaper in blocking mode */
+#define nrf24_DMA_MIN_SIZE 8
+
 #define nrf24_TIMEOUT 500
 #define nrf24_CE_PIN &gpio_ext_pb2
 #define nrf24_HANDLE                                                                         \
@@ -194,6 +202,15 @@ uint8_t nrf24_set_maclen(FuriHalSpiBusHandle* handle, uint8_t maclen);
  */
 uint8_t nrf24_status(FuriHalSpiBusHandle* handle);
 
+/** Checks if there is a packet waiting in RX FIFO
+ * Costs a single byte transfer, RX FIFO state is a part of status byte
+ * 
+ * @param      handle  - pointer to FuriHalSpiHandle
+ * 
+ * @return     true if RX FIFO is not empty
+ */
+bool nrf24_rx_ready(FuriHalSpiBusHandle* handle);
+
 /** Gets the current transfer rate
  * 
  * @param      handle  - pointer to FuriHalSpiHandle
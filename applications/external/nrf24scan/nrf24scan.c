@@ -45,6 +45,8 @@
 #define LOG_REC_SIZE 34 // max packet size
 #define VIEW_LOG_MAX_X 22
 #define VIEW_LOG_WIDTH_B 10 // bytes
+#define RX_POLL_INTERVAL 2 // ms, RX FIFO holds only 3 packets
+#define RX_DRAW_INTERVAL 100 // ms
 
 const char SettingsFld_Rate[] = "Rate:";
 const char SettingsFld_Ch[] = "Ch:";
@@ -1403,8 +1405,11 @@ int32_t nrf24scan_app(void* p) {
     furi_string_free(path);
 
     PluginEvent event;
+    uint32_t last_draw = 0;
     for(bool processing = true; processing;) {
-        FuriStatus event_status = furi_message_queue_get(APP->event_queue, &event, 100);
+        bool receiving = what_doing && what_to_do;
+        FuriStatus event_status = furi_message_queue_get(
+            APP->event_queue, &event, receiving ? RX_POLL_INTERVAL : 100);
         furi_mutex_acquire(plugin_state->mutex, FuriWaitForever);
 
         if(event_status == FuriStatusOk) {
@@ -1628,7 +1633,9 @@ int32_t nrf24scan_app(void* p) {
             }
         }
         if(what_doing && what_to_do) {
-            nrf24_read_newpacket();
+            for(uint8_t i = 0; i < nrf24_RX_FIFO_SIZE && nrf24_rx_ready(nrf24_HANDLE); i++) {
+                nrf24_read_newpacket();
+            }
             if(find_channel_period &&
                furi_get_tick() - start_time >= (uint32_t)find_channel_period * 1000UL) {
                 if(++NRF_channel > MAX_CHANNEL) NRF_channel = 0;
@@ -1637,7 +1644,11 @@ int32_t nrf24scan_app(void* p) {
         }
 
         furi_mutex_release(plugin_state->mutex);
-        view_port_update(APP->view_port);
+        if(!receiving || event_status == FuriStatusOk ||
+           furi_get_tick() - last_draw >= RX_DRAW_INTERVAL) {
+            view_port_update(APP->view_port);
+            last_draw = furi_get_tick();
+        }
     }
     nrf24_set_idle(nrf24_HANDLE);
     if(log_arr_idx && (log_to_file == 1 || log_to_file == 2)) {
@@ -0,0 +1,55 @@
+#include "nrf24_hop.h"
+#include <furi.h>
+#include <string.h>
+
+void nrf24_hop_reset(Nrf24HopScheduler* hop, uint8_t min_channel, uint8_t max_channel) {
+    furi_assert(hop);
+    furi_assert(min_channel <= max_channel);
+    furi_assert(max_channel <= NRF24_HOP_MAX_CHANNEL);
+
+    memset(hop, 0, sizeof(Nrf24HopScheduler));
+    hop->min_channel = min_channel;
+    hop->max_channel = max_channel;
+    hop->channel = min_channel;
+    hop->sweep_channel = min_channel < max_channel ? min_channel + 1 : min_channel;
+}
+
+void nrf24_hop_hit(Nrf24HopScheduler* hop, uint8_t count) {
+    furi_assert(hop);
+    hop->hits[hop->channel] += count;
+    hop->score[hop->channel] = MIN(hop->score[hop->channel] + count, UINT16_MAX);
+}
+
+uint8_t nrf24_hop_next(Nrf24HopScheduler* hop) {
+    furi_assert(hop);
+    uint8_t hottest = nrf24_hop_hottest(hop);
+
+    if(hop->revisit && hop->score[hottest] && hottest != hop->channel) {
+        hop->channel = hottest;
+    } else {
+        hop->channel = hop->sweep_channel;
+        if(++hop->sweep_channel > hop->max_channel) {
+            hop->sweep_channel = hop->min_channel;
+            for(uint8_t ch = hop->min_channel; ch <= hop->max_channel; ch++) {
+                hop->score[ch] >>= 1;
+            }
+        }
+    }
+    hop->revisit = !hop->revisit;
+
+    return hop->channel;
+}
+
+uint8_t nrf24_hop_hottest(const Nrf24HopScheduler* hop) {
+    furi_assert(hop);
+    uint8_t hottest = hop->min_channel;
+    for(uint8_t ch = hop->min_channel; ch <= hop->max_channel; ch++) {
+        if(hop->score[ch] > hop->score[hottest]) hottest = ch;
+    }
+    return hottest;
+}
+
+uint32_t nrf24_hop_dwell(const Nrf24HopScheduler* hop, uint32_t dwell) {
+    furi_assert(hop);
+    return hop->score[hop->channel] ? dwell : dwell / NRF24_HOP_IDLE_DWELL_DIV;
+}
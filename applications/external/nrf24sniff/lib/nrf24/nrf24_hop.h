@@ -0,0 +1,70 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF24_HOP_MAX_CHANNEL 125
+
+/* Channels that didn't give a single hit are left after this part of the dwell time */
+#define NRF24_HOP_IDLE_DWELL_DIV 4
+
+/** Channel hopping scheduler
+ * Sweeps the channel range, but every other hop goes back to the busiest channel seen so far.
+ * Busy score is halved after each full sweep so devices that moved away are not chased forever.
+ */
+typedef struct {
+    uint8_t min_channel;
+    uint8_t max_channel;
+    uint8_t channel;
+    uint8_t sweep_channel;
+    bool revisit;
+    uint16_t score[NRF24_HOP_MAX_CHANNEL + 1];
+    uint32_t hits[NRF24_HOP_MAX_CHANNEL + 1];
+} Nrf24HopScheduler;
+
+/** Resets statistics and starts sweep from min_channel
+ *
+ * @param      hop  - pointer to Nrf24HopScheduler
+ * @param      min_channel - first channel of the range
+ * @param      max_channel - last channel of the range, up to NRF24_HOP_MAX_CHANNEL
+ */
+void nrf24_hop_reset(Nrf24HopScheduler* hop, uint8_t min_channel, uint8_t max_channel);
+
+/** Accounts packets received on current channel
+ *
+ * @param      hop  - pointer to Nrf24HopScheduler
+ * @param      count - number of packets
+ */
+void nrf24_hop_hit(Nrf24HopScheduler* hop, uint8_t count);
+
+/** Picks the next channel to listen on
+ *
+ * @param      hop  - pointer to Nrf24HopScheduler
+ * 
+ * @return     channel to tune to
+ */
+uint8_t nrf24_hop_next(Nrf24HopScheduler* hop);
+
+/** Gets the busiest channel
+ *
+ * @param      hop  - pointer to Nrf24HopScheduler
+ * 
+ * @return     channel with the highest busy score, min_channel if nothing was received yet
+ */
+uint8_t nrf24_hop_hottest(const Nrf24HopScheduler* hop);
+
+/** Gets dwell time for current channel
+ *
+ * @param      hop  - pointer to Nrf24HopScheduler
+ * @param      dwell - full dwell time
+ * 
+ * @return     full dwell time for busy channels, shortened one for quiet channels
+ */
+uint32_t nrf24_hop_dwell(const Nrf24HopScheduler* hop, uint32_t dwell);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 
 #include <nrf24.h>
+#include <nrf24_hop.h>
 #include <toolbox/stream/file_stream.h>
 
 #define LOGITECH_MAX_CHANNEL 85
@@ -13,6 +14,8 @@
 #define DEFAULT_SAMPLE_TIME 4000
 #define MAX_ADDRS 100
 #define MAX_CONFIRMED 32
+#define SNIFF_POLL_INTERVAL 2
+#define SNIFF_DRAW_INTERVAL 100
 
 #define NRFSNIFF_APP_PATH_FOLDER STORAGE_APP_DATA_PATH_PREFIX
 #define NRFSNIFF_APP_FILENAME "addresses.txt"
@@ -47,6 +50,7 @@ char sniff_text[38];
 char sniffed_address[14];
 
 uint8_t target_channel = 0;
+Nrf24HopScheduler hop;
 uint32_t found_count = 0;
 uint32_t unique_saved_count = 0;
 uint32_t sample_time = DEFAULT_SAMPLE_TIME;
@@ -301,7 +305,8 @@ static void clear_cache() {
     unique_saved_count = 0;
     confirmed_idx = 0;
     candidate_idx = 0;
-    target_channel = 2;
+    nrf24_hop_reset(&hop, 2, LOGITECH_MAX_CHANNEL);
+    target_channel = hop.channel;
     total_candidates = 0;
     memset(candidates, 0, sizeof(candidates));
     memset(counts, 0, sizeof(counts));
@@ -315,7 +320,9 @@ static void start_sniffing() {
 int32_t nrfsniff_app(void* p) {
     UNUSED(p);
     uint8_t address[5] = {0};
+    uint8_t addresses[nrf24_RX_FIFO_SIZE][5];
     uint32_t start = 0;
+    uint32_t last_draw = 0;
     hexlify(address, 5, top_address);
     FuriMessageQueue* event_queue = furi_message_queue_alloc(8, sizeof(PluginEvent));
     PluginState* plugin_state = malloc(sizeof(PluginState));
@@ -352,7 +359,9 @@ int32_t nrfsniff_app(void* p) {
 
     PluginEvent event;
     for(bool processing = true; processing;) {
-        FuriStatus event_status = furi_message_queue_get(event_queue, &event, 100);
+        // RX FIFO holds only 3 packets, poll it often while sniffing
+        FuriStatus event_status = furi_message_queue_get(
+            event_queue, &event, sniffing_state ? SNIFF_POLL_INTERVAL : 100);
         furi_mutex_acquire(plugin_state->mutex, FuriWaitForever);
 
         if(event_status == FuriStatusOk) {
@@ -419,13 +428,15 @@ int32_t nrfsniff_app(void* p) {
         }
 
         if(sniffing_state) {
-            if(nrf24_sniff_address(nrf24_HANDLE, 5, address)) {
+            uint8_t sniffed = nrf24_sniff_addresses(nrf24_HANDLE, 5, addresses);
+            if(sniffed) nrf24_hop_hit(&hop, sniffed);
+            for(uint8_t i = 0; i < sniffed; i++) {
                 int idx;
                 uint8_t* top_addr;
-                if(!previously_confirmed(address)) {
-                    idx = get_addr_index(address, 5);
+                if(!previously_confirmed(addresses[i])) {
+                    idx = get_addr_index(addresses[i], 5);
                     if(idx == -1)
-                        insert_addr(address, 5);
+                        insert_addr(addresses[i], 5);
                     else
                         counts[idx]++;
 
@@ -434,9 +445,8 @@ int32_t nrfsniff_app(void* p) {
                 }
             }
 
-            if(furi_get_tick() - start >= sample_time) {
-                target_channel++;
-                if(target_channel > LOGITECH_MAX_CHANNEL) target_channel = 2;
+            if(furi_get_tick() - start >= nrf24_hop_dwell(&hop, sample_time)) {
+                target_channel = nrf24_hop_next(&hop);
                 {
                     wrap_up(storage, notification);
                     start_sniffing();
@@ -446,7 +456,11 @@ int32_t nrfsniff_app(void* p) {
             }
         }
 
-        view_port_update(view_port);
+        if(!sniffing_state || event_status == FuriStatusOk ||
+           furi_get_tick() - last_draw >= SNIFF_DRAW_INTERVAL) {
+            view_port_update(view_port);
+            last_draw = furi_get_tick();
+        }
         furi_mutex_release(plugin_state->mutex);
     }
 
@@ -0,0 +1,88 @@
+#include "picopass_dict.h"
+
+#include <optimized_elite.h>
+
+#define TAG "PicopassDict"
+
+static void
+    picopass_dict_elite_record_callback(const uint8_t* key, uint8_t* record, void* context) {
+    UNUSED(context);
+    loclass_hash2(key, record + PICOPASS_KEY_LEN);
+}
+
+bool picopass_dict_open(
+    PicopassDict* dict,
+    const char* path,
+    const char* packed_path,
+    bool is_elite) {
+    furi_assert(dict);
+    furi_assert(path);
+    furi_assert(packed_path);
+
+    dict->is_elite = is_elite;
+    dict->has_keytables = false;
+
+    bool packed = false;
+    if(is_elite) {
+        packed = nfc_dict_update_packed_ex(
+            path,
+            packed_path,
+            PICOPASS_KEY_LEN,
+            PICOPASS_DICT_ELITE_RECORD_LEN,
+            picopass_dict_elite_record_callback,
+            NULL);
+    } else {
+        packed = nfc_dict_update_packed(path, packed_path, PICOPASS_KEY_LEN);
+    }
+
+    if(packed) {
+        dict->has_keytables = is_elite;
+        dict->dict = nfc_dict_alloc(
+            packed_path,
+            NfcDictModeOpenExisting,
+            is_elite ? PICOPASS_DICT_ELITE_RECORD_LEN : PICOPASS_KEY_LEN);
+    } else {
+        FURI_LOG_W(TAG, "Unable to pack %s, using text dictionary", path);
+        dict->dict = nfc_dict_alloc(path, NfcDictModeOpenExisting, PICOPASS_KEY_LEN);
+    }
+
+    return dict->dict != NULL;
+}
+
+void picopass_dict_close(PicopassDict* dict) {
+    furi_assert(dict);
+
+    if(dict->dict) {
+        nfc_dict_free(dict->dict);
+        dict->dict = NULL;
+    }
+}
+
+uint32_t picopass_dict_get_total_keys(PicopassDict* dict) {
+    furi_assert(dict);
+    return dict->dict ? nfc_dict_get_total_keys(dict->dict) : 0;
+}
+
+bool picopass_dict_get_next_key(PicopassDict* dict, PicopassPollerEventDataRequestKey* req_key) {
+    furi_assert(dict);
+    furi_assert(req_key);
+    if(!dict->dict) return false;
+
+    bool key_read = false;
+    req_key->is_elite_key = dict->is_elite;
+    req_key->is_keytable_provided = false;
+
+    if(dict->has_keytables) {
+        uint8_t record[PICOPASS_DICT_ELITE_RECORD_LEN];
+        key_read = nfc_dict_get_next_key(dict->dict, record, sizeof(record));
+        if(key_read) {
+            memcpy(req_key->key, record, PICOPASS_KEY_LEN);
+            memcpy(req_key->keytable, record + PICOPASS_KEY_LEN, LOCLASS_ELITE_KEYTABLE_LEN);
+            req_key->is_keytable_provided = true;
+        }
+    } else {
+        key_read = nfc_dict_get_next_key(dict->dict, req_key->key, PICOPASS_KEY_LEN);
+    }
+
+    return key_read;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <nfc/helpers/nfc_dict.h>
+#include "../protocol/picopass_poller.h"
+
+/** Packed elite dictionary record: key followed by its keytable */
+#define PICOPASS_DICT_ELITE_RECORD_LEN (PICOPASS_KEY_LEN + LOCLASS_ELITE_KEYTABLE_LEN)
+
+typedef struct {
+    NfcDict* dict;
+    bool is_elite;
+    bool has_keytables;
+} PicopassDict;
+
+/** Open key dictionary, through its packed copy when it can be made
+ *
+ * Packed copy of elite dictionary also stores keytable of each key, so it
+ * isn't computed for every key on every card. Text dictionary is used as is
+ * if packed copy can't be written.
+ *
+ * @param dict          dictionary to fill, dict field is NULL on failure
+ * @param path          text dictionary path
+ * @param packed_path   packed copy path
+ * @param is_elite      dictionary of elite keys
+ *
+ * @return true if dictionary is opened
+ */
+bool picopass_dict_open(
+    PicopassDict* dict,
+    const char* path,
+    const char* packed_path,
+    bool is_elite);
+
+/** Close dictionary, does nothing if it isn't opened */
+void picopass_dict_close(PicopassDict* dict);
+
+uint32_t picopass_dict_get_total_keys(PicopassDict* dict);
+
+/** Fill key request with next key, keytable and is_elite_key included
+ *
+ * @return true if key is read, false at the end of dictionary
+ */
+bool picopass_dict_get_next_key(PicopassDict* dict, PicopassPollerEventDataRequestKey* req_key);
@@ -109,9 +109,25 @@ void loclass_opt_doBothMAC_2(
     const uint8_t* div_key_p);
 
 void loclass_doMAC_N(uint8_t* in_p, uint8_t in_size, uint8_t* div_key_p, uint8_t mac[4]);
+
+/** Size of elite keytable made by loclass_hash2 */
+#define LOCLASS_ELITE_KEYTABLE_LEN 128
+
 void loclass_iclass_calc_div_key(
     const uint8_t* csn,
     const uint8_t* key,
     uint8_t* div_key,
     bool elite);
+
+/**
+ * Elite key diversification with keytable of the key computed in advance,
+ * skips loclass_hash2 that takes most of loclass_iclass_calc_div_key time.
+ * @param csn card serial number
+ * @param keytable keytable of elite key, see loclass_hash2
+ * @param div_key output
+ */
+void loclass_iclass_calc_elite_div_key(
+    const uint8_t* csn,
+    const uint8_t* keytable,
+    uint8_t* div_key);
 #endif // OPTIMIZED_CIPHER_H
@@ -217,10 +217,15 @@ void loclass_hash2(const uint8_t* key64, uint8_t* outp_keytable) {
     // Once again, key is on iclass-format
     loclass_desdecrypt_iclass(z[0], key64_negated, y[0]);
 
+    uint8_t key_std_format[8] = {0};
     for(i = 1; i < 8; i++) {
         loclass_rk(key64, i, temp_output);
-        loclass_desdecrypt_iclass(temp_output, z[i - 1], z[i]);
-        loclass_desencrypt_iclass(temp_output, y[i - 1], y[i]);
+        // Both chains use the same round key, permute it once
+        loclass_permutekey_rev(temp_output, key_std_format);
+        mbedtls_des_setkey_dec(&loclass_ctx_dec, key_std_format);
+        mbedtls_des_crypt_ecb(&loclass_ctx_dec, z[i - 1], z[i]);
+        mbedtls_des_setkey_enc(&loclass_ctx_enc, key_std_format);
+        mbedtls_des_crypt_ecb(&loclass_ctx_enc, y[i - 1], y[i]);
     }
 
     if(outp_keytable != NULL) {
@@ -53,6 +53,12 @@ void loclass_permutekey_rev(const uint8_t key[8], uint8_t dest[8]);
  * @param k output
  */
 void loclass_hash1(const uint8_t* csn, uint8_t* k);
+/**
+ * Hash2 computes the keytable of elite key, it only depends on the key, so
+ * it can be computed once per key and reused for every card.
+ * @param key64 elite key
+ * @param outp_keytable output, LOCLASS_ELITE_KEYTABLE_LEN bytes
+ */
 void loclass_hash2(const uint8_t* key64, uint8_t* outp_keytable);
 
 #endif
@@ -31,7 +31,7 @@
 #include <assets_icons.h>
 
 #include <nfc/nfc.h>
-#include <nfc/helpers/nfc_dict.h>
+#include "helpers/picopass_dict.h"
 #include "protocol/picopass_poller.h"
 #include "protocol/picopass_listener.h"
 
@@ -40,6 +40,10 @@
 #define PICOPASS_ICLASS_ELITE_DICT_FLIPPER_NAME APP_ASSETS_PATH("iclass_elite_dict.txt")
 #define PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME APP_ASSETS_PATH("iclass_standard_dict.txt")
 #define PICOPASS_ICLASS_ELITE_DICT_USER_NAME APP_DATA_PATH("assets/iclass_elite_dict_user.txt")
+#define PICOPASS_ICLASS_ELITE_DICT_PACKED_NAME APP_DATA_PATH("assets/iclass_elite_dict.bin")
+#define PICOPASS_ICLASS_STANDARD_DICT_PACKED_NAME APP_DATA_PATH("assets/iclass_standard_dict.bin")
+#define PICOPASS_ICLASS_ELITE_DICT_USER_PACKED_NAME \
+    APP_DATA_PATH("assets/iclass_elite_dict_user.bin")
 
 enum PicopassCustomEvent {
     // Reserve first 100 events for button types and indexes, starting from 0
@@ -89,7 +93,7 @@ struct Picopass {
     Nfc* nfc;
     PicopassPoller* poller;
     PicopassListener* listener;
-    NfcDict* dict;
+    PicopassDict dict;
 
     char text_store[PICOPASS_TEXT_STORE_SIZE + 1];
     FuriString* text_box_store;
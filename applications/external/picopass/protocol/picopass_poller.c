@@ -226,11 +226,16 @@ NfcCommand picopass_poller_auth_handler(PicopassPoller* instance) {
         }
         memcpy(ccnr, read_check_resp.data, sizeof(PicopassReadCheckResp)); // last 4 bytes left 0
 
-        loclass_iclass_calc_div_key(
-            csn,
-            instance->event_data.req_key.key,
-            div_key,
-            instance->event_data.req_key.is_elite_key);
+        if(instance->event_data.req_key.is_elite_key &&
+           instance->event_data.req_key.is_keytable_provided) {
+            loclass_iclass_calc_elite_div_key(csn, instance->event_data.req_key.keytable, div_key);
+        } else {
+            loclass_iclass_calc_div_key(
+                csn,
+                instance->event_data.req_key.key,
+                div_key,
+                instance->event_data.req_key.is_elite_key);
+        }
         loclass_opt_doReaderMAC(ccnr, div_key, mac.data);
 
         PicopassCheckResp check_resp = {};
@@ -32,6 +32,9 @@ typedef struct {
     uint8_t key[PICOPASS_KEY_LEN];
     bool is_key_provided;
     bool is_elite_key;
+    // Keytable of elite key computed in advance, saves most of key diversification time
+    bool is_keytable_provided;
+    uint8_t keytable[LOCLASS_ELITE_KEYTABLE_LEN];
 } PicopassPollerEventDataRequestKey;
 
 typedef struct {
@@ -22,26 +22,27 @@ static bool picopass_elite_dict_attack_change_dict(Picopass* picopass) {
     do {
         uint32_t scene_state =
             scene_manager_get_scene_state(picopass->scene_manager, PicopassSceneEliteDictAttack);
-        nfc_dict_free(picopass->dict);
-        picopass->dict = NULL;
+        picopass_dict_close(&picopass->dict);
         if(scene_state == PicopassSceneEliteDictAttackDictElite) break;
         if(scene_state == PicopassSceneEliteDictAttackDictEliteUser) {
             if(!nfc_dict_check_presence(PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME)) break;
-            picopass->dict = nfc_dict_alloc(
+            picopass_dict_open(
+                &picopass->dict,
                 PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME,
-                NfcDictModeOpenExisting,
-                PICOPASS_KEY_LEN);
+                PICOPASS_ICLASS_STANDARD_DICT_PACKED_NAME,
+                false);
             scene_state = PicopassSceneEliteDictAttackDictStandart;
         } else if(scene_state == PicopassSceneEliteDictAttackDictStandart) {
             if(!nfc_dict_check_presence(PICOPASS_ICLASS_ELITE_DICT_FLIPPER_NAME)) break;
-            picopass->dict = nfc_dict_alloc(
+            picopass_dict_open(
+                &picopass->dict,
                 PICOPASS_ICLASS_ELITE_DICT_FLIPPER_NAME,
-                NfcDictModeOpenExisting,
-                PICOPASS_KEY_LEN);
+                PICOPASS_ICLASS_ELITE_DICT_PACKED_NAME,
+                true);
             scene_state = PicopassSceneEliteDictAttackDictElite;
         }
         picopass->dict_attack_ctx.card_detected = true;
-        picopass->dict_attack_ctx.total_keys = nfc_dict_get_total_keys(picopass->dict);
+        picopass->dict_attack_ctx.total_keys = picopass_dict_get_total_keys(&picopass->dict);
         picopass->dict_attack_ctx.current_key = 0;
         picopass->dict_attack_ctx.name = picopass_dict_name[scene_state];
         scene_manager_set_scene_state(
@@ -61,23 +62,14 @@ NfcCommand picopass_elite_dict_attack_worker_callback(PicopassPollerEvent event,
     if(event.type == PicopassPollerEventTypeRequestMode) {
         event.data->req_mode.mode = PicopassPollerModeRead;
     } else if(event.type == PicopassPollerEventTypeRequestKey) {
-        uint8_t key[PICOPASS_KEY_LEN] = {};
-        bool is_key_provided = true;
-        if(!nfc_dict_get_next_key(picopass->dict, key, PICOPASS_KEY_LEN)) {
-            if(picopass_elite_dict_attack_change_dict(picopass)) {
-                is_key_provided = nfc_dict_get_next_key(picopass->dict, key, PICOPASS_KEY_LEN);
-                view_dispatcher_send_custom_event(
-                    picopass->view_dispatcher, PicopassCustomEventDictAttackUpdateView);
-            } else {
-                is_key_provided = false;
-            }
+        PicopassPollerEventDataRequestKey* req_key = &event.data->req_key;
+        bool is_key_provided = picopass_dict_get_next_key(&picopass->dict, req_key);
+        if(!is_key_provided && picopass_elite_dict_attack_change_dict(picopass)) {
+            is_key_provided = picopass_dict_get_next_key(&picopass->dict, req_key);
+            view_dispatcher_send_custom_event(
+                picopass->view_dispatcher, PicopassCustomEventDictAttackUpdateView);
         }
-        uint32_t scene_state =
-            scene_manager_get_scene_state(picopass->scene_manager, PicopassSceneEliteDictAttack);
-        memcpy(event.data->req_key.key, key, PICOPASS_KEY_LEN);
-        event.data->req_key.is_elite_key =
-            (scene_state != PicopassSceneEliteDictAttackDictStandart);
-        event.data->req_key.is_key_provided = is_key_provided;
+        req_key->is_key_provided = is_key_provided;
         if(is_key_provided) {
             picopass->dict_attack_ctx.current_key++;
             if(picopass->dict_attack_ctx.current_key %
@@ -139,22 +131,28 @@ void picopass_scene_elite_dict_attack_on_enter(void* context) {
 
     bool use_user_dict = nfc_dict_check_presence(PICOPASS_ICLASS_ELITE_DICT_USER_NAME);
     if(use_user_dict) {
-        picopass->dict = nfc_dict_alloc(
-            PICOPASS_ICLASS_ELITE_DICT_USER_NAME, NfcDictModeOpenExisting, PICOPASS_KEY_LEN);
-        if(nfc_dict_get_total_keys(picopass->dict) == 0) {
-            nfc_dict_free(picopass->dict);
+        picopass_dict_open(
+            &picopass->dict,
+            PICOPASS_ICLASS_ELITE_DICT_USER_NAME,
+            PICOPASS_ICLASS_ELITE_DICT_USER_PACKED_NAME,
+            true);
+        if(picopass_dict_get_total_keys(&picopass->dict) == 0) {
+            picopass_dict_close(&picopass->dict);
             use_user_dict = false;
         }
     }
     if(use_user_dict) {
         state = PicopassSceneEliteDictAttackDictEliteUser;
     } else {
-        picopass->dict = nfc_dict_alloc(
-            PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME, NfcDictModeOpenExisting, PICOPASS_KEY_LEN);
+        picopass_dict_open(
+            &picopass->dict,
+            PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME,
+            PICOPASS_ICLASS_STANDARD_DICT_PACKED_NAME,
+            false);
         state = PicopassSceneEliteDictAttackDictStandart;
     }
     picopass->dict_attack_ctx.card_detected = true;
-    picopass->dict_attack_ctx.total_keys = nfc_dict_get_total_keys(picopass->dict);
+    picopass->dict_attack_ctx.total_keys = picopass_dict_get_total_keys(&picopass->dict);
     picopass->dict_attack_ctx.current_key = 0;
     picopass->dict_attack_ctx.name = picopass_dict_name[state];
     scene_manager_set_scene_state(picopass->scene_manager, PicopassSceneEliteDictAttack, state);
@@ -217,10 +215,7 @@ bool picopass_scene_elite_dict_attack_on_event(void* context, SceneManagerEvent
 void picopass_scene_elite_dict_attack_on_exit(void* context) {
     Picopass* picopass = context;
 
-    if(picopass->dict) {
-        nfc_dict_free(picopass->dict);
-        picopass->dict = NULL;
-    }
+    picopass_dict_close(&picopass->dict);
     picopass->dict_attack_ctx.current_key = 0;
     picopass->dict_attack_ctx.total_keys = 0;
 
@@ -13,13 +13,15 @@ static bool picopass_read_card_change_dict(Picopass* picopass) {
     do {
         uint32_t scene_state =
             scene_manager_get_scene_state(picopass->scene_manager, PicopassSceneReadCard);
-        nfc_dict_free(picopass->dict);
-        picopass->dict = NULL;
+        picopass_dict_close(&picopass->dict);
         if(scene_state == PicopassSceneReadCardDictElite) break;
         if(!nfc_dict_check_presence(PICOPASS_ICLASS_ELITE_DICT_FLIPPER_NAME)) break;
 
-        picopass->dict = nfc_dict_alloc(
-            PICOPASS_ICLASS_ELITE_DICT_FLIPPER_NAME, NfcDictModeOpenExisting, PICOPASS_KEY_LEN);
+        picopass_dict_open(
+            &picopass->dict,
+            PICOPASS_ICLASS_ELITE_DICT_FLIPPER_NAME,
+            PICOPASS_ICLASS_ELITE_DICT_PACKED_NAME,
+            true);
         scene_manager_set_scene_state(
             picopass->scene_manager, PicopassSceneReadCard, PicopassSceneReadCardDictElite);
         success = true;
@@ -37,20 +39,12 @@ NfcCommand picopass_read_card_worker_callback(PicopassPollerEvent event, void* c
     if(event.type == PicopassPollerEventTypeRequestMode) {
         event.data->req_mode.mode = PicopassPollerModeRead;
     } else if(event.type == PicopassPollerEventTypeRequestKey) {
-        uint8_t key[PICOPASS_KEY_LEN] = {};
-        bool is_key_provided = true;
-        if(!nfc_dict_get_next_key(picopass->dict, key, PICOPASS_KEY_LEN)) {
-            if(picopass_read_card_change_dict(picopass)) {
-                is_key_provided = nfc_dict_get_next_key(picopass->dict, key, PICOPASS_KEY_LEN);
-            } else {
-                is_key_provided = false;
-            }
+        PicopassPollerEventDataRequestKey* req_key = &event.data->req_key;
+        bool is_key_provided = picopass_dict_get_next_key(&picopass->dict, req_key);
+        if(!is_key_provided && picopass_read_card_change_dict(picopass)) {
+            is_key_provided = picopass_dict_get_next_key(&picopass->dict, req_key);
         }
-        uint32_t scene_state =
-            scene_manager_get_scene_state(picopass->scene_manager, PicopassSceneReadCard);
-        memcpy(event.data->req_key.key, key, PICOPASS_KEY_LEN);
-        event.data->req_key.is_elite_key = (scene_state == PicopassSceneReadCardDictElite);
-        event.data->req_key.is_key_provided = is_key_provided;
+        req_key->is_key_provided = is_key_provided;
     } else if(event.type == PicopassPollerEventTypeSuccess) {
         const PicopassDeviceData* data = picopass_poller_get_data(picopass->poller);
         memcpy(&picopass->dev->dev_data, data, sizeof(PicopassDeviceData));
@@ -75,8 +69,11 @@ void picopass_scene_read_card_on_enter(void* context) {
     popup_set_header(popup, "Detecting\npicopass\ncard", 68, 30, AlignLeft, AlignTop);
     popup_set_icon(popup, 0, 3, &I_RFIDDolphinReceive_97x61);
 
-    picopass->dict = nfc_dict_alloc(
-        PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME, NfcDictModeOpenExisting, PICOPASS_KEY_LEN);
+    picopass_dict_open(
+        &picopass->dict,
+        PICOPASS_ICLASS_STANDARD_DICT_FLIPPER_NAME,
+        PICOPASS_ICLASS_STANDARD_DICT_PACKED_NAME,
+        false);
     scene_manager_set_scene_state(
         picopass->scene_manager, PicopassSceneReadCard, PicopassSceneReadCardDictStandart);
     // Start worker
@@ -110,10 +107,7 @@ bool picopass_scene_read_card_on_event(void* context, SceneManagerEvent event) {
 void picopass_scene_read_card_on_exit(void* context) {
     Picopass* picopass = context;
 
-    if(picopass->dict) {
-        nfc_dict_free(picopass->dict);
-        picopass->dict = NULL;
-    }
+    picopass_dict_close(&picopass->dict);
     picopass_poller_stop(picopass->poller);
     picopass_poller_free(picopass->poller);
 
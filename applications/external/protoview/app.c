@@ -151,7 +151,7 @@ ProtoViewApp* protoview_app_alloc() {
 
     // Signal found and visualization defaults
     app->signal_bestlen = 0;
-    app->signal_last_scan_idx = 0;
+    app->signal_last_scan_written = 0;
     app->signal_decoded = false;
     app->us_scale = PROTOVIEW_RAW_VIEW_DEFAULT_SCALE;
     app->signal_offset = 0;
@@ -222,21 +222,16 @@ void protoview_app_free(ProtoViewApp* app) {
  * function is to scan for signals and set DetectedSamples. */
 static void timer_callback(void* ctx) {
     ProtoViewApp* app = ctx;
-    uint32_t delta, lastidx = app->signal_last_scan_idx;
-
-    /* scan_for_signal(), called by this function, deals with a
-     * circular buffer. To never miss anything, even if a signal spawns
-     * cross-boundaries, it is enough if we scan each time the buffer fills
-     * for 50% more compared to the last scan. Thanks to this check we
-     * can avoid scanning too many times to just find the same data. */
-    if(lastidx < RawSamples->idx) {
-        delta = RawSamples->idx - lastidx;
-    } else {
-        delta = RawSamples->total - lastidx + RawSamples->idx;
-    }
-    if(delta < RawSamples->total / 2) return;
-    app->signal_last_scan_idx = RawSamples->idx;
-    scan_for_signal(app, RawSamples, ProtoViewModulations[app->modulation].duration_filter);
+
+    /* scan_for_new_signal(), called by this function, only looks at
+     * samples received since the previous pass, and keeps a signal that
+     * was still being received for the next one. So we can scan every
+     * time there is something new, without falling behind on busy bands,
+     * as long as the buffer doesn't fill more than once between calls. */
+    uint32_t written = RawSamples->written;
+    if(written == app->signal_last_scan_written) return;
+    app->signal_last_scan_written = written;
+    scan_for_new_signal(app, RawSamples, ProtoViewModulations[app->modulation].duration_filter);
 }
 
 /* This is the navigation callback we use in the view dispatcher used
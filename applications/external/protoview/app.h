@@ -138,8 +138,8 @@ struct ProtoViewApp {
     /* Generic app state. */
     int running; /* Once false exists the app. */
     uint32_t signal_bestlen; /* Longest coherent signal observed so far. */
-    uint32_t signal_last_scan_idx; /* Index of the buffer last time we
-                                      performed the scan. */
+    uint32_t signal_last_scan_written; /* Samples received last time we
+                                          performed the scan. */
     bool signal_decoded; /* Was the current signal decoded? */
     ProtoViewMsgInfo* msg_info; /* Decoded message info if not NULL. */
     bool direct_sampling_enabled; /* This special view needs an explicit
@@ -257,6 +257,7 @@ void protoview_rx_callback(bool level, uint32_t duration, void* context);
 uint32_t duration_delta(uint32_t a, uint32_t b);
 void reset_current_signal(ProtoViewApp* app);
 void scan_for_signal(ProtoViewApp* app, RawSamplesBuffer* source, uint32_t min_duration);
+void scan_for_new_signal(ProtoViewApp* app, RawSamplesBuffer* source, uint32_t min_duration);
 bool bitmap_get(uint8_t* b, uint32_t blen, uint32_t bitpos);
 void bitmap_set(uint8_t* b, uint32_t blen, uint32_t bitpos, bool val);
 void bitmap_copy(
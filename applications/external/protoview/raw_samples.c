@@ -10,6 +10,7 @@
 /* Allocate and initialize a samples buffer. */
 RawSamplesBuffer* raw_samples_alloc(void) {
     RawSamplesBuffer* buf = malloc(sizeof(*buf));
+    buf->samples = memmgr_alloc_transient(RAW_SAMPLES_NUM * sizeof(*buf->samples));
     buf->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
     raw_samples_reset(buf);
     return buf;
@@ -18,6 +19,7 @@ RawSamplesBuffer* raw_samples_alloc(void) {
 /* Free a sample buffer. Should be called when the mutex is released. */
 void raw_samples_free(RawSamplesBuffer* s) {
     furi_mutex_free(s->mutex);
+    free(s->samples);
     free(s);
 }
 
@@ -28,8 +30,10 @@ void raw_samples_reset(RawSamplesBuffer* s) {
     furi_mutex_acquire(s->mutex, FuriWaitForever);
     s->total = RAW_SAMPLES_NUM;
     s->idx = 0;
+    s->written = 0;
+    s->scan_pos = 0;
     s->short_pulse_dur = 0;
-    memset(s->samples, 0, sizeof(s->samples));
+    memset(s->samples, 0, RAW_SAMPLES_NUM * sizeof(*s->samples));
     furi_mutex_release(s->mutex);
 }
 
@@ -45,6 +49,7 @@ void raw_samples_add(RawSamplesBuffer* s, bool level, uint32_t dur) {
     s->samples[s->idx].level = level;
     s->samples[s->idx].dur = dur;
     s->idx = (s->idx + 1) % RAW_SAMPLES_NUM;
+    s->written++;
     furi_mutex_release(s->mutex);
 }
 
@@ -67,6 +72,7 @@ void raw_samples_add_or_update(RawSamplesBuffer* s, bool level, uint32_t dur) {
         s->samples[s->idx].level = level;
         s->samples[s->idx].dur = dur;
         s->idx = (s->idx + 1) % RAW_SAMPLES_NUM;
+        s->written++;
     }
     furi_mutex_release(s->mutex);
 }
@@ -86,8 +92,9 @@ void raw_samples_copy(RawSamplesBuffer* dst, RawSamplesBuffer* src) {
     furi_mutex_acquire(src->mutex, FuriWaitForever);
     furi_mutex_acquire(dst->mutex, FuriWaitForever);
     dst->idx = src->idx;
+    dst->written = src->written;
     dst->short_pulse_dur = src->short_pulse_dur;
-    memcpy(dst->samples, src->samples, sizeof(dst->samples));
+    memcpy(dst->samples, src->samples, RAW_SAMPLES_NUM * sizeof(*dst->samples));
     furi_mutex_release(src->mutex);
     furi_mutex_release(dst->mutex);
 }
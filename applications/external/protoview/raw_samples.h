@@ -5,7 +5,7 @@
  * the signal. */
 
 #define RAW_SAMPLES_NUM \
-    2048 /* Use a power of two: we take the modulo
+    4096 /* Use a power of two: we take the modulo
                                 of the index quite often to normalize inside
                                 the range, and division is slow. */
 typedef struct RawSamplesBuffer {
@@ -13,8 +13,14 @@ typedef struct RawSamplesBuffer {
     struct {
         uint16_t level : 1;
         uint16_t dur : 15;
-    } samples[RAW_SAMPLES_NUM];
+    } * samples; /* RAW_SAMPLES_NUM samples, taken from the memory pool
+                    when it has space, so the heap is left to the app. */
     uint32_t idx; /* Current idx (next to write). */
+    uint32_t written; /* Samples added since reset, also counting the ones
+                         already overwritten. Gives samples a position
+                         that does not change as the buffer rotates. */
+    uint32_t scan_pos; /* Position (like 'written') where the next
+                          incremental scan starts, see scan_for_new_signal(). */
     uint32_t total; /* Total samples: same as RAW_SAMPLES_NUM, we provide
                        this field for a cleaner interface with the user, but
                        we always use RAW_SAMPLES_NUM when taking the modulo so
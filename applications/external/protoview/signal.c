@@ -59,6 +59,7 @@ void reset_current_signal(ProtoViewApp* app) {
     app->signal_decoded = false;
     raw_samples_reset(DetectedSamples);
     raw_samples_reset(RawSamples);
+    app->signal_last_scan_written = 0;
     free_msg_info(app->msg_info);
     app->msg_info = NULL;
 }
@@ -92,7 +93,9 @@ uint32_t search_coherent_signal(RawSamplesBuffer* s, uint32_t idx, uint32_t min_
 
     uint32_t len = 0; /* Observed len of coherent samples. */
     s->short_pulse_dur = 0;
-    for(uint32_t j = idx; j < idx + s->total; j++) {
+    /* Stop at the newest sample: wrapping around would join it with the
+     * oldest one, that was received much earlier. */
+    for(uint32_t j = idx; j < s->total; j++) {
         bool level;
         uint32_t dur;
         raw_samples_get(s, j, &level, &dur);
@@ -180,27 +183,40 @@ void notify_signal_detected(ProtoViewApp* app, bool decoded) {
         notification_message(app->notification, &unknown_seq);
 }
 
-/* Search the source buffer with the stored signal (last N samples received)
- * in order to find a coherent signal. If a signal that does not appear to
- * be just noise is found, it is set in DetectedSamples global signal
- * buffer, that is what is rendered on the screen. */
-void scan_for_signal(ProtoViewApp* app, RawSamplesBuffer* source, uint32_t min_duration) {
-    /* We need to work on a copy: the source buffer may be populated
-     * by the background thread receiving data. */
-    RawSamplesBuffer* copy = raw_samples_alloc();
-    raw_samples_copy(copy, source);
-
+/* Scan 'copy' starting at sample position 'from' (see 'written' in
+ * RawSamplesBuffer), or from the oldest sample if it was already
+ * overwritten. When 'live' is true more samples will follow, so a run
+ * reaching the newest sample may still be growing: it is left for the next
+ * pass instead of being decoded now. Returns the position where the next
+ * pass should start. */
+static uint32_t scan_for_signal_from(
+    ProtoViewApp* app,
+    RawSamplesBuffer* copy,
+    uint32_t min_duration,
+    uint32_t from,
+    bool live) {
     /* Try to seek on data that looks to have a regular high low high low
      * pattern. */
     uint32_t minlen = 18; /* Min run of coherent samples. With less
                                        than a few samples it's very easy to
                                        mistake noise for signal. */
 
-    uint32_t i = 0;
+    /* Position of the sample at index zero, negative until the buffer
+     * is filled for the first time. */
+    int64_t base = (int64_t)copy->written - copy->total;
+    uint32_t i = from > base ? from - base : 0;
+    uint32_t resume = copy->written;
 
     while(i < copy->total - 1) {
         uint32_t thislen = search_coherent_signal(copy, i, min_duration);
 
+        /* Runs filling the whole buffer are decoded anyway, there is
+         * no room for them to grow. */
+        if(live && thislen && i > 0 && i + thislen == copy->total) {
+            resume = base + i;
+            break;
+        }
+
         /* For messages that are long enough, attempt decoding. */
         if(thislen > minlen) {
             /* Allocate the message information that some decoder may
@@ -248,6 +264,29 @@ void scan_for_signal(ProtoViewApp* app, RawSamplesBuffer* source, uint32_t min_d
         }
         i += thislen ? thislen : 1;
     }
+    return resume;
+}
+
+/* Search the source buffer with the stored signal (last N samples received)
+ * in order to find a coherent signal. If a signal that does not appear to
+ * be just noise is found, it is set in DetectedSamples global signal
+ * buffer, that is what is rendered on the screen. */
+void scan_for_signal(ProtoViewApp* app, RawSamplesBuffer* source, uint32_t min_duration) {
+    /* We need to work on a copy: the source buffer may be populated
+     * by the background thread receiving data. */
+    RawSamplesBuffer* copy = raw_samples_alloc();
+    raw_samples_copy(copy, source);
+    scan_for_signal_from(app, copy, min_duration, 0, false);
+    raw_samples_free(copy);
+}
+
+/* Like scan_for_signal(), but only looks at samples received since the
+ * previous call, plus the run that was still being received back then.
+ * Cheap enough to be called as soon as new samples arrive. */
+void scan_for_new_signal(ProtoViewApp* app, RawSamplesBuffer* source, uint32_t min_duration) {
+    RawSamplesBuffer* copy = raw_samples_alloc();
+    raw_samples_copy(copy, source);
+    source->scan_pos = scan_for_signal_from(app, copy, min_duration, source->scan_pos, true);
     raw_samples_free(copy);
 }
 
@@ -22,10 +22,8 @@ typedef struct {
     bool mode_change;
     bool modulation_change;
 
-    float max_rssi;
-    uint8_t max_rssi_dec;
-    uint8_t max_rssi_channel;
-    uint8_t channel_ss[NUM_CHANNELS];
+    // Last complete sweep, owned by worker
+    const SpectrumAnalyzerFrame* frame;
 } SpectrumAnalyzerModel;
 
 typedef struct {
@@ -61,6 +59,22 @@ void spectrum_analyzer_draw_scale(Canvas* canvas, const SpectrumAnalyzerModel* m
 
     tag_center = model->center_freq;
 
+    canvas_set_font(canvas, FontSecondary);
+    if(model->width == WIDESCAN) {
+        // Band center below middle of each band section, separators between sections
+        static const uint32_t band_centers[WIDESCAN_BANDS] = {CEN_300, CEN_400, CEN_900};
+        for(uint8_t band = 0; band < WIDESCAN_BANDS; band++) {
+            uint8_t x = band * WIDESCAN_CHANNELS + WIDESCAN_CHANNELS / 2 - 2;
+            snprintf(temp_str, 18, "%lu", band_centers[band] / 1000);
+            canvas_draw_str_aligned(canvas, x, 63, AlignCenter, AlignBottom, temp_str);
+            if(band) {
+                uint8_t separator_x = band * WIDESCAN_CHANNELS - 2;
+                canvas_draw_line(canvas, separator_x, FREQ_BOTTOM_Y - 8, separator_x, 63);
+            }
+        }
+        return;
+    }
+
     switch(model->width) {
     case NARROW:
         tag_left = model->center_freq - 2000;
@@ -83,7 +97,6 @@ void spectrum_analyzer_draw_scale(Canvas* canvas, const SpectrumAnalyzerModel* m
         tag_right = model->center_freq + 10000;
     }
 
-    canvas_set_font(canvas, FontSecondary);
     switch(model->width) {
     case PRECISE:
     case ULTRANARROW:
@@ -114,14 +127,21 @@ static void spectrum_analyzer_render_callback(Canvas* const canvas, void* ctx) {
 
     spectrum_analyzer_draw_scale(canvas, model);
 
-    for(uint8_t column = 0; column < 128; column++) {
-        uint8_t ss = model->channel_ss[column + 2];
-        // Compress height to max of 64 values (255>>2)
-        uint8_t s = MAX((ss - model->vscroll) >> 2, 0);
-        uint8_t y = FREQ_BOTTOM_Y - s; // bar height
+    const SpectrumAnalyzerFrame* frame = model->frame;
+    if(frame) {
+        for(uint8_t column = 0; column < 128; column++) {
+            uint8_t ss = frame->channel_ss[column + 2];
+            // Compress height to max of 64 values (255>>2)
+            uint8_t s = MAX((ss - model->vscroll) >> 2, 0);
+            uint8_t y = FREQ_BOTTOM_Y - s; // bar height
+
+            // Draw each bar
+            canvas_draw_line(canvas, column, FREQ_BOTTOM_Y, column, y);
 
-        // Draw each bar
-        canvas_draw_line(canvas, column, FREQ_BOTTOM_Y, column, y);
+            // Peak hold dot above the bar
+            uint8_t peak = MAX((frame->peak_ss[column + 2] - model->vscroll) >> 2, 0);
+            if(peak > s + 1) canvas_draw_dot(canvas, column, FREQ_BOTTOM_Y - peak);
+        }
     }
 
     if(model->mode_change) {
@@ -139,6 +159,9 @@ static void spectrum_analyzer_render_callback(Canvas* const canvas, void* ctx) {
         case ULTRAWIDE:
             strncpy(temp_mode_str, "ULTRAWIDE", 12);
             break;
+        case WIDESCAN:
+            strncpy(temp_mode_str, "WIDESCAN", 12);
+            break;
         default:
             strncpy(temp_mode_str, "WIDE", 12);
             break;
@@ -168,28 +191,28 @@ static void spectrum_analyzer_render_callback(Canvas* const canvas, void* ctx) {
     }
 
     // Draw cross and label
-    if(model->max_rssi > PEAK_THRESHOLD) {
+    if(frame && frame->max_rssi > PEAK_THRESHOLD) {
         // Compress height to max of 64 values (255>>2)
-        uint8_t max_y = MAX((model->max_rssi_dec - model->vscroll) >> 2, 0);
+        uint8_t max_y = MAX((frame->max_rssi_dec - model->vscroll) >> 2, 0);
         max_y = (FREQ_BOTTOM_Y - max_y);
 
         // Cross
         int16_t x1, x2, y1, y2;
-        x1 = model->max_rssi_channel - 2 - 2;
+        x1 = frame->max_rssi_channel - 2 - 2;
         if(x1 < 0) x1 = 0;
         y1 = max_y - 2;
         if(y1 < 0) y1 = 0;
-        x2 = model->max_rssi_channel - 2 + 2;
+        x2 = frame->max_rssi_channel - 2 + 2;
         if(x2 > 127) x2 = 127;
         y2 = max_y + 2;
         if(y2 > 63) y2 = 63; // SHOULD NOT HAPPEN CHECK!
         canvas_draw_line(canvas, x1, y1, x2, y2);
 
-        x1 = model->max_rssi_channel - 2 + 2;
+        x1 = frame->max_rssi_channel - 2 + 2;
         if(x1 > 127) x1 = 127;
         y1 = max_y - 2;
         if(y1 < 0) y1 = 0;
-        x2 = model->max_rssi_channel - 2 - 2;
+        x2 = frame->max_rssi_channel - 2 - 2;
         if(x2 < 0) x2 = 0;
         y2 = max_y + 2;
         if(y2 > 63) y2 = 63; // SHOULD NOT HAPPEN CHECK!
@@ -201,9 +224,8 @@ static void spectrum_analyzer_render_callback(Canvas* const canvas, void* ctx) {
             temp_str,
             36,
             "Peak: %3.2f Mhz %3.1f dbm",
-            ((double)(model->channel0_frequency + (model->max_rssi_channel * model->spacing)) /
-             1000000),
-            (double)model->max_rssi);
+            ((double)frame->max_rssi_frequency / 1000000),
+            (double)frame->max_rssi);
         canvas_draw_str_aligned(canvas, 127, 0, AlignRight, AlignTop, temp_str);
     }
 
@@ -220,21 +242,14 @@ static void spectrum_analyzer_input_callback(InputEvent* input_event, void* ctx)
     }
 }
 
-static void spectrum_analyzer_worker_callback(
-    void* channel_ss,
-    float max_rssi,
-    uint8_t max_rssi_dec,
-    uint8_t max_rssi_channel,
-    void* context) {
+static void spectrum_analyzer_worker_callback(const SpectrumAnalyzerFrame* frame, void* context) {
     SpectrumAnalyzer* spectrum_analyzer = context;
     furi_check(
         furi_mutex_acquire(spectrum_analyzer->model_mutex, FuriWaitForever) == FuriStatusOk);
 
+    // Worker fills the other frame next, no copy needed
     SpectrumAnalyzerModel* model = (SpectrumAnalyzerModel*)spectrum_analyzer->model;
-    memcpy(model->channel_ss, (uint8_t*)channel_ss, sizeof(uint8_t) * NUM_CHANNELS);
-    model->max_rssi = max_rssi;
-    model->max_rssi_dec = max_rssi_dec;
-    model->max_rssi_channel = max_rssi_channel;
+    model->frame = frame;
 
     furi_mutex_release(spectrum_analyzer->model_mutex);
     view_port_update(spectrum_analyzer->view_port);
@@ -255,6 +270,12 @@ void spectrum_analyzer_calculate_frequencies(SpectrumAnalyzerModel* model) {
     uint8_t next_band_up;
     uint8_t next_band_down;
 
+    // Frame of previous frequencies shouldn't be shown
+    model->frame = NULL;
+
+    // Fixed frequencies, computed by worker
+    if(model->width == WIDESCAN) return;
+
     switch(model->width) {
     case NARROW:
         margin = NARROW_MARGIN;
@@ -368,9 +389,6 @@ void spectrum_analyzer_calculate_frequencies(SpectrumAnalyzerModel* model) {
     //     hz -= model->spacing;
     // }
 
-    model->max_rssi = -200.0;
-    model->max_rssi_dec = 0;
-
     FURI_LOG_D("Spectrum", "setup_frequencies - max_hz: %lu - min_hz: %lu", max_hz, min_hz);
     FURI_LOG_D("Spectrum", "center_freq: %lu", model->center_freq);
     FURI_LOG_D(
@@ -387,12 +405,7 @@ SpectrumAnalyzer* spectrum_analyzer_alloc() {
 
     SpectrumAnalyzerModel* model = instance->model;
 
-    for(uint8_t ch = 0; ch < NUM_CHANNELS - 1; ch++) {
-        model->channel_ss[ch] = 0;
-    }
-    model->max_rssi_dec = 0;
-    model->max_rssi_channel = 0;
-    model->max_rssi = PEAK_THRESHOLD - 1; // Should initializar to < PEAK_THRESHOLD
+    model->frame = NULL;
 
     model->center_freq = DEFAULT_FREQ;
     model->width = WIDE;
@@ -486,6 +499,9 @@ int32_t spectrum_analyzer_app(void* p) {
         case PRECISE:
             hstep = PRECISE_STEP;
             break;
+        case WIDESCAN:
+            hstep = 0;
+            break;
         default:
             hstep = WIDE_STEP;
             break;
@@ -537,6 +553,9 @@ int32_t spectrum_analyzer_app(void* p) {
                     model->width = ULTRAWIDE;
                     break;
                 case ULTRAWIDE:
+                    model->width = WIDESCAN;
+                    break;
+                case WIDESCAN:
                     model->width = WIDE;
                     break;
                 default:
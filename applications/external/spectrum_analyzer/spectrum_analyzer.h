@@ -9,6 +9,8 @@
 #define FREQ_LENGTH_X 102
 // dBm threshold to show peak value
 #define PEAK_THRESHOLD -85
+// Peak hold falls by 1/8 of its distance to current value every sweep
+#define PEAK_DECAY_SHIFT 3
 
 /*
  * ultrawide mode: 80 MHz on screen, 784 kHz per channel
@@ -16,12 +18,18 @@
  * narrow mode: 4 MHz on screen, 39 kHz per channel
  * ultranarrow mode: 2 MHz on screen, 19 kHz per channel
  * precise mode: 400 KHz on screen, 3.92 kHz per channel
+ * wide scan mode: 300, 400 and 900 MHz bands side by side, 1.8 to 4.8 MHz per channel
  */
 #define WIDE 0
 #define NARROW 1
 #define ULTRAWIDE 2
 #define ULTRANARROW 3
 #define PRECISE 4
+#define WIDESCAN 5
+
+/* wide scan mode: every band gets an equal part of channels */
+#define WIDESCAN_BANDS 3
+#define WIDESCAN_CHANNELS (NUM_CHANNELS / WIDESCAN_BANDS)
 
 /* channel spacing in Hz */
 #define WIDE_SPACING 196078
@@ -6,7 +6,12 @@
 
 #include "helpers/radio_device_loader.h"
 
-#include <lib/drivers/cc1101_regs.h>
+#include <lib/drivers/cc1101.h>
+#include <applications/drivers/subghz/cc1101_ext/cc1101_ext_interconnect.h>
+#include <xtreme.h>
+
+#define SPECTRUM_ANALYZER_SETTLE_US 3000
+#define SPECTRUM_ANALYZER_MODULATION_NONE 0xFF
 
 struct SpectrumAnalyzerWorker {
     FuriThread* thread;
@@ -16,18 +21,42 @@ struct SpectrumAnalyzerWorker {
     void* callback_context;
 
     const SubGhzDevice* radio_device;
+    FuriHalSpiBusHandle* spi_bus;
 
     uint32_t channel0_frequency;
     uint32_t spacing;
     uint8_t width;
     uint8_t modulation;
-    float max_rssi;
-    uint8_t max_rssi_dec;
-    uint8_t max_rssi_channel;
-
-    uint8_t channel_ss[NUM_CHANNELS];
+    volatile bool retune;
+
+    // Results are filled in one frame while the other one is shown
+    SpectrumAnalyzerFrame frames[2];
+    uint8_t frame_index;
+    // Peak hold in 8.8 fixed point
+    uint16_t peak_hold[NUM_CHANNELS];
+
+    // Sweep batch in visit order, channel of each point
+    CC1101SweepPoint points[NUM_CHANNELS];
+    CC1101SweepCalibration calibrations[NUM_CHANNELS];
+    uint8_t points_channel[NUM_CHANNELS];
 };
 
+static const uint32_t spectrum_analyzer_widescan_min[WIDESCAN_BANDS] = {MIN_300, MIN_400, MIN_900};
+static const uint32_t spectrum_analyzer_widescan_max[WIDESCAN_BANDS] = {MAX_300, MAX_400, MAX_900};
+
+static uint32_t
+    spectrum_analyzer_worker_channel_frequency(SpectrumAnalyzerWorker* instance, uint8_t ch) {
+    if(instance->width != WIDESCAN) {
+        return instance->channel0_frequency + (ch * instance->spacing);
+    }
+
+    // Stitch bands: equal part of channels for each one, spread over whole band
+    uint8_t band = MIN(ch / WIDESCAN_CHANNELS, WIDESCAN_BANDS - 1);
+    uint32_t min_khz = spectrum_analyzer_widescan_min[band];
+    uint32_t span_khz = spectrum_analyzer_widescan_max[band] - min_khz;
+    return (min_khz + span_khz * (ch - band * WIDESCAN_CHANNELS) / WIDESCAN_CHANNELS) * 1000;
+}
+
 /* set the channel bandwidth */
 void spectrum_analyzer_worker_set_filter(SpectrumAnalyzerWorker* instance) {
     uint8_t filter_config[2][2] = {
@@ -188,16 +217,22 @@ static int32_t spectrum_analyzer_worker_thread(void* context) {
         0x00};
 
     const uint8_t* modulations[] = {default_modulation, narrow_modulation};
+    uint8_t loaded_modulation = SPECTRUM_ANALYZER_MODULATION_NONE;
 
     while(instance->should_work) {
-        furi_delay_ms(50);
+        furi_delay_tick(1); // to give some time to OS
 
         // FURI_LOG_T("SpectrumWorker", "spectrum_analyzer_worker_thread: Worker Loop");
-        subghz_devices_idle(instance->radio_device);
-        subghz_devices_load_preset(
-            instance->radio_device,
-            FuriHalSubGhzPresetCustom,
-            (uint8_t*)modulations[instance->modulation]);
+        // Registers are kept between sweeps, reload only when modulation is changed
+        if(loaded_modulation != instance->modulation) {
+            loaded_modulation = instance->modulation;
+            subghz_devices_idle(instance->radio_device);
+            subghz_devices_load_preset(
+                instance->radio_device,
+                FuriHalSubGhzPresetCustom,
+                (uint8_t*)modulations[loaded_modulation]);
+            instance->retune = true;
+        }
         //subghz_devices_load_preset(
         //    instance->radio_device, FuriHalSubGhzPresetCustom, (uint8_t*)default_modulation);
         //furi_hal_subghz_load_custom_preset(modulations[instance->modulation]);
@@ -205,49 +240,80 @@ static int32_t spectrum_analyzer_worker_thread(void* context) {
         // TODO: Check filter!
         // spectrum_analyzer_worker_set_filter(instance);
 
-        instance->max_rssi_dec = 0;
+        // Channels moved, stored calibrations and peaks are for old frequencies
+        if(instance->retune) {
+            instance->retune = false;
+            memset(instance->calibrations, 0, sizeof(instance->calibrations));
+            memset(instance->peak_hold, 0, sizeof(instance->peak_hold));
+        }
+
+        SpectrumAnalyzerFrame* frame = &instance->frames[instance->frame_index];
+        instance->frame_index ^= 1;
+        frame->max_rssi = -200.0f;
+        frame->max_rssi_dec = 0;
+        frame->max_rssi_channel = 0;
+        frame->max_rssi_frequency = 0;
 
         // Visit each channel non-consecutively
+        size_t count = 0;
         for(uint8_t ch_offset = 0, chunk = 0; ch_offset < CHUNK_SIZE;
             ++chunk >= NUM_CHUNKS && ++ch_offset && (chunk = 0)) {
             uint8_t ch = chunk * CHUNK_SIZE + ch_offset;
+            uint32_t frequency = spectrum_analyzer_worker_channel_frequency(instance, ch);
+
+            if(subghz_devices_is_frequency_valid(instance->radio_device, frequency)) {
+                instance->points[count].frequency = frequency;
+                instance->points_channel[count] = ch;
+                count++;
+            } else {
+                frame->channel_ss[ch] = 0;
+                frame->peak_ss[ch] = 0;
+            }
+        }
 
-            if(subghz_devices_is_frequency_valid(
-                   instance->radio_device,
-                   instance->channel0_frequency + (ch * instance->spacing)))
-                subghz_devices_set_frequency(
-                    instance->radio_device,
-                    instance->channel0_frequency + (ch * instance->spacing));
+        // Measure all channels in one batch, calibration is done on the first sweep only
+        cc1101_sweep_calibrated(
+            instance->spi_bus,
+            instance->points,
+            instance->calibrations,
+            count,
+            SPECTRUM_ANALYZER_SETTLE_US);
 
-            subghz_devices_set_rx(instance->radio_device);
-            furi_delay_ms(3);
+        for(size_t i = 0; i < count; i++) {
+            uint8_t ch = instance->points_channel[i];
 
             //         dec      dBm
             //max_ss = 127 ->  -10.5
             //max_ss = 0   ->  -74.0
             //max_ss = 255 ->  -74.5
             //max_ss = 128 -> -138.0
-            instance->channel_ss[ch] = (subghz_devices_get_rssi(instance->radio_device) + 138) * 2;
-
-            if(instance->channel_ss[ch] > instance->max_rssi_dec) {
-                instance->max_rssi_dec = instance->channel_ss[ch];
-                instance->max_rssi = (instance->channel_ss[ch] / 2) - 138;
-                instance->max_rssi_channel = ch;
+            uint8_t ss = (instance->points[i].rssi + 138) * 2;
+            frame->channel_ss[ch] = ss;
+
+            // Jump up to new peak, fall towards current value
+            uint16_t current = ss << 8;
+            uint16_t peak = instance->peak_hold[ch];
+            if(current >= peak) {
+                peak = current;
+            } else {
+                peak -= (peak - current) >> PEAK_DECAY_SHIFT;
+            }
+            instance->peak_hold[ch] = peak;
+            frame->peak_ss[ch] = peak >> 8;
+
+            if(ss > frame->max_rssi_dec) {
+                frame->max_rssi_dec = ss;
+                frame->max_rssi = (ss / 2) - 138;
+                frame->max_rssi_channel = ch;
+                frame->max_rssi_frequency = instance->points[i].frequency;
             }
-
-            subghz_devices_idle(instance->radio_device);
         }
 
-        // FURI_LOG_T("SpectrumWorker", "channel_ss[0]: %u", instance->channel_ss[0]);
+        // FURI_LOG_T("SpectrumWorker", "channel_ss[0]: %u", frame->channel_ss[0]);
 
         // Report results back to main thread
         if(instance->callback) {
-            instance->callback(
-                (void*)&(instance->channel_ss),
-                instance->max_rssi,
-                instance->max_rssi_dec,
-                instance->max_rssi_channel,
-                instance->callback_context);
+            instance->callback(frame, instance->callback_context);
         }
     }
 
@@ -269,6 +335,14 @@ SpectrumAnalyzerWorker* spectrum_analyzer_worker_alloc() {
 
     instance->radio_device =
         radio_device_loader_set(instance->radio_device, SubGhzRadioDeviceTypeExternalCC1101);
+    if(strcmp(instance->radio_device->name, SUBGHZ_DEVICE_CC1101_EXT_NAME) == 0) {
+        // Same bus as picked by external driver
+        instance->spi_bus = xtreme_settings.spi_cc1101_handle == SpiDefault ?
+                                &furi_hal_spi_bus_handle_external :
+                                &furi_hal_spi_bus_handle_external_extra;
+    } else {
+        instance->spi_bus = &furi_hal_spi_bus_handle_subghz;
+    }
 
     FURI_LOG_D("Spectrum", "spectrum_analyzer_worker_alloc: End");
 
@@ -314,6 +388,7 @@ void spectrum_analyzer_worker_set_frequencies(
     instance->channel0_frequency = channel0_frequency;
     instance->spacing = spacing;
     instance->width = width;
+    instance->retune = true;
 }
 
 void spectrum_analyzer_worker_set_modulation(SpectrumAnalyzerWorker* instance, uint8_t modulation) {
@@ -1,13 +1,19 @@
 #pragma once
 
 #include <stdint.h>
-
-typedef void (*SpectrumAnalyzerWorkerCallback)(
-    void* chan_table,
-    float max_rssi,
-    uint8_t max_rssi_dec,
-    uint8_t max_rssi_channel,
-    void* context);
+#include "spectrum_analyzer.h"
+
+/** Results of one sweep, stays valid until the next callback */
+typedef struct {
+    uint8_t channel_ss[NUM_CHANNELS];
+    uint8_t peak_ss[NUM_CHANNELS];
+    float max_rssi;
+    uint8_t max_rssi_dec;
+    uint8_t max_rssi_channel;
+    uint32_t max_rssi_frequency;
+} SpectrumAnalyzerFrame;
+
+typedef void (*SpectrumAnalyzerWorkerCallback)(const SpectrumAnalyzerFrame* frame, void* context);
 
 typedef struct SpectrumAnalyzerWorker SpectrumAnalyzerWorker;
 
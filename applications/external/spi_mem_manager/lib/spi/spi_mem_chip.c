@@ -60,6 +60,17 @@ bool spi_mem_chip_find_all(SPIMemChip* chip_info, found_chips_t found_chips) {
     return false;
 }
 
+// Chip missing from the list, but with size and page size discovered via SFDP
+static SPIMemChip spi_mem_chip_sfdp;
+
+void spi_mem_chip_add_sfdp(SPIMemChip* chip_info, found_chips_t found_chips) {
+    spi_mem_chip_copy_chip_info(&spi_mem_chip_sfdp, chip_info);
+    spi_mem_chip_sfdp.model_name = "SFDP";
+    spi_mem_chip_sfdp.vendor_enum = SPIMemChipVendorUnknown;
+    spi_mem_chip_sfdp.write_mode = SPIMemChipWriteModePage;
+    found_chips_push_back(found_chips, &spi_mem_chip_sfdp);
+}
+
 void spi_mem_chip_copy_chip_info(SPIMemChip* dest, const SPIMemChip* src) {
     memcpy(dest, src, sizeof(SPIMemChip));
 }
@@ -29,6 +29,7 @@ uint8_t spi_mem_chip_get_capacity_id(SPIMemChip* chip);
 SPIMemChipWriteMode spi_mem_chip_get_write_mode(SPIMemChip* chip);
 size_t spi_mem_chip_get_page_size(SPIMemChip* chip);
 bool spi_mem_chip_find_all(SPIMemChip* chip_info, found_chips_t found_chips);
+void spi_mem_chip_add_sfdp(SPIMemChip* chip_info, found_chips_t found_chips);
 void spi_mem_chip_copy_chip_info(SPIMemChip* dest, const SPIMemChip* src);
 uint32_t spi_mem_chip_get_vendor_enum(const SPIMemChip* chip);
 const char* spi_mem_chip_get_vendor_name_by_enum(uint32_t vendor_enum);
@@ -47,6 +47,8 @@ typedef enum {
 typedef enum {
     SPIMemChipCMDReadJEDECChipID = 0x9F,
     SPIMemChipCMDReadData = 0x03,
+    SPIMemChipCMDFastReadData = 0x0B,
+    SPIMemChipCMDReadSFDP = 0x5A,
     SPIMemChipCMDChipErase = 0xC7,
     SPIMemChipCMDWriteEnable = 0x06,
     SPIMemChipCMDWriteDisable = 0x04,
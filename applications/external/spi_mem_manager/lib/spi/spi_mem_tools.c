@@ -39,6 +39,27 @@ static bool spi_mem_tools_trx(
     return success;
 }
 
+// One transaction with DMA reception, FAST_READ and SFDP commands need one dummy byte
+static bool
+    spi_mem_tools_read_buffer(SPIMemChipCMD cmd, size_t offset, uint8_t* data, size_t size) {
+    uint8_t header[5] = {(uint8_t)cmd};
+    uint8_t header_size = 1 + spi_mem_tools_addr_to_byte_arr(offset, &header[1]);
+    header[header_size++] = 0;
+    furi_hal_spi_acquire(&furi_hal_spi_bus_handle_external);
+    bool success = false;
+    do {
+        if(!furi_hal_spi_bus_tx(
+               &furi_hal_spi_bus_handle_external, header, header_size, SPI_MEM_SPI_TIMEOUT))
+            break;
+        if(!furi_hal_spi_bus_trx_dma(
+               &furi_hal_spi_bus_handle_external, NULL, data, size, SPI_MEM_SPI_TIMEOUT))
+            break;
+        success = true;
+    } while(0);
+    furi_hal_spi_release(&furi_hal_spi_bus_handle_external);
+    return success;
+}
+
 static bool spi_mem_tools_write_buffer(uint8_t* data, size_t size, size_t offset) {
     furi_hal_spi_acquire(&furi_hal_spi_bus_handle_external);
     uint8_t cmd = (uint8_t)SPIMemChipCMDWriteData;
@@ -84,22 +105,40 @@ bool spi_mem_tools_check_chip_info(SPIMemChip* chip) {
     return false;
 }
 
+bool spi_mem_tools_read_sfdp(SPIMemChip* chip) {
+    uint8_t header[16];
+    uint32_t params[11] = {0};
+    do {
+        // SFDP header and first parameter header, which is always JEDEC basic flash table
+        if(!spi_mem_tools_read_buffer(SPIMemChipCMDReadSFDP, 0, header, sizeof(header))) break;
+        if(memcmp(header, "SFDP", 4) != 0) break;
+        if(header[8] != 0x00) break;
+        size_t params_size = MIN((size_t)header[11] * 4, sizeof(params));
+        size_t params_offset = header[12] | (header[13] << 8) | (header[14] << 16);
+        if(params_size < 8) break;
+        if(!spi_mem_tools_read_buffer(
+               SPIMemChipCMDReadSFDP, params_offset, (uint8_t*)params, params_size))
+            break;
+
+        // Density is in bits, as N - 1 or as 2^N for huge chips
+        uint64_t size_bits = (params[1] & 0x80000000) ? (1ULL << (params[1] & 0x7FFFFFFF)) :
+                                                         ((uint64_t)params[1] + 1);
+        // Only 3 bytes address mode is supported
+        if(size_bits < 8 || size_bits > (1ULL << 27)) break;
+        chip->size = size_bits / 8;
+
+        chip->page_size = SPI_MEM_MAX_BLOCK_SIZE;
+        uint8_t page_size_bits = (params[10] >> 4) & 0x0F;
+        if(params_size >= 44 && page_size_bits >= 4) chip->page_size = 1 << page_size_bits;
+        return true;
+    } while(0);
+    return false;
+}
+
 bool spi_mem_tools_read_block(SPIMemChip* chip, size_t offset, uint8_t* data, size_t block_size) {
     if(!spi_mem_tools_check_chip_info(chip)) return false;
-    for(size_t i = 0; i < block_size; i += SPI_MEM_MAX_BLOCK_SIZE) {
-        uint8_t cmd[4];
-        if((offset + SPI_MEM_MAX_BLOCK_SIZE) > chip->size) return false;
-        if(!spi_mem_tools_trx(
-               SPIMemChipCMDReadData,
-               cmd,
-               spi_mem_tools_addr_to_byte_arr(offset, cmd),
-               data,
-               SPI_MEM_MAX_BLOCK_SIZE))
-            return false;
-        offset += SPI_MEM_MAX_BLOCK_SIZE;
-        data += SPI_MEM_MAX_BLOCK_SIZE;
-    }
-    return true;
+    if((offset + block_size) > chip->size) return false;
+    return spi_mem_tools_read_buffer(SPIMemChipCMDFastReadData, offset, data, block_size);
 }
 
 size_t spi_mem_tools_get_file_max_block_size(SPIMemChip* chip) {
@@ -7,6 +7,7 @@
 #define SPI_MEM_FILE_BUFFER_SIZE 4096
 
 bool spi_mem_tools_read_chip_info(SPIMemChip* chip);
+bool spi_mem_tools_read_sfdp(SPIMemChip* chip);
 bool spi_mem_tools_read_block(SPIMemChip* chip, size_t offset, uint8_t* data, size_t block_size);
 size_t spi_mem_tools_get_file_max_block_size(SPIMemChip* chip);
 SPIMemChipStatus spi_mem_tools_get_chip_status(SPIMemChip* chip);
@@ -51,6 +51,9 @@ static void spi_mem_worker_chip_detect_process(SPIMemWorker* worker) {
     }
     if(spi_mem_chip_find_all(worker->chip_info, *worker->found_chips)) {
         event = SPIMemCustomEventWorkerChipIdentified;
+    } else if(spi_mem_tools_read_sfdp(worker->chip_info)) {
+        spi_mem_chip_add_sfdp(worker->chip_info, *worker->found_chips);
+        event = SPIMemCustomEventWorkerChipIdentified;
     } else {
         event = SPIMemCustomEventWorkerChipUnknown;
     }
@@ -58,18 +61,59 @@ static void spi_mem_worker_chip_detect_process(SPIMemWorker* worker) {
 }
 
 // Read
+typedef struct {
+    SPIMemChip* chip_info;
+    FuriStreamBuffer* stream;
+    volatile bool stop;
+    volatile bool chip_fail;
+} SPIMemWorkerReader;
+
+// Reads chip ahead, so SPI transfer overlaps with SD card write of the previous block
+static int32_t spi_mem_worker_reader_thread(void* context) {
+    SPIMemWorkerReader* reader = context;
+    uint8_t* data_buffer = malloc(SPI_MEM_FILE_BUFFER_SIZE);
+    size_t chip_size = spi_mem_chip_get_size(reader->chip_info);
+    size_t offset = 0;
+    while(!reader->stop && offset < chip_size) {
+        size_t block_size = MIN((size_t)SPI_MEM_FILE_BUFFER_SIZE, chip_size - offset);
+        if(!spi_mem_tools_read_block(reader->chip_info, offset, data_buffer, block_size)) {
+            reader->chip_fail = true;
+            break;
+        }
+        size_t sent = 0;
+        while(sent < block_size && !reader->stop) {
+            sent += furi_stream_buffer_send(
+                reader->stream, data_buffer + sent, block_size - sent, 100);
+        }
+        offset += block_size;
+    }
+    free(data_buffer);
+    return 0;
+}
+
 static bool spi_mem_worker_read(SPIMemWorker* worker, SPIMemCustomEventWorker* event) {
-    uint8_t data_buffer[SPI_MEM_FILE_BUFFER_SIZE];
+    SPIMemWorkerReader reader = {
+        .chip_info = worker->chip_info,
+        .stream = furi_stream_buffer_alloc(SPI_MEM_FILE_BUFFER_SIZE * 2, 1),
+    };
+    FuriThread* reader_thread =
+        furi_thread_alloc_ex("SPIMemReader", 1024, spi_mem_worker_reader_thread, &reader);
+    furi_thread_start(reader_thread);
+
+    uint8_t* data_buffer = malloc(SPI_MEM_FILE_BUFFER_SIZE);
     size_t chip_size = spi_mem_chip_get_size(worker->chip_info);
     size_t offset = 0;
     bool success = true;
     while(true) {
-        furi_delay_tick(10); // to give some time to OS
-        size_t block_size = SPI_MEM_FILE_BUFFER_SIZE;
         if(spi_mem_worker_check_for_stop(worker)) break;
         if(offset >= chip_size) break;
-        if((offset + block_size) > chip_size) block_size = chip_size - offset;
-        if(!spi_mem_tools_read_block(worker->chip_info, offset, data_buffer, block_size)) {
+        size_t block_size = MIN((size_t)SPI_MEM_FILE_BUFFER_SIZE, chip_size - offset);
+        size_t received = 0;
+        while(received < block_size && !reader.chip_fail) {
+            received += furi_stream_buffer_receive(
+                reader.stream, data_buffer + received, block_size - received, 100);
+        }
+        if(received < block_size) {
             *event = SPIMemCustomEventWorkerChipFail;
             success = false;
             break;
@@ -81,6 +125,12 @@ static bool spi_mem_worker_read(SPIMemWorker* worker, SPIMemCustomEventWorker* e
         offset += block_size;
         spi_mem_worker_run_callback(worker, SPIMemCustomEventWorkerBlockReaded);
     }
+
+    reader.stop = true;
+    furi_thread_join(reader_thread);
+    furi_thread_free(reader_thread);
+    furi_stream_buffer_free(reader.stream);
+    free(data_buffer);
     if(success) *event = SPIMemCustomEventWorkerDone;
     return success;
 }
@@ -104,7 +154,7 @@ static bool
     size_t offset = 0;
     bool success = true;
     while(true) {
-        furi_delay_tick(10); // to give some time to OS
+        furi_thread_yield(); // to give some time to OS
         size_t block_size = SPI_MEM_FILE_BUFFER_SIZE;
         if(spi_mem_worker_check_for_stop(worker)) break;
         if(offset >= total_size) break;
@@ -354,6 +354,45 @@ void subbrute_worker_send_callback(SubBruteWorker* instance) {
     }
 }
 
+/**
+ * Build payload of step and encode it into transmitter upload
+ *
+ * @param instance SubBruteWorker*
+ * @param flipper_format scratch FlipperFormat
+ * @param transmitter SubGhzTransmitter* that is not transmitting now
+ * @param step step to encode
+ * @return true if encoded
+ */
+static bool subbrute_worker_encode(
+    SubBruteWorker* instance,
+    FlipperFormat* flipper_format,
+    SubGhzTransmitter* transmitter,
+    uint64_t step) {
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    stream_clean(stream);
+
+    if(instance->attack == SubBruteAttackLoadFile) {
+        subbrute_protocol_file_payload(
+            stream,
+            step,
+            instance->bits,
+            instance->te,
+            instance->repeat,
+            instance->load_index,
+            instance->file_key,
+            instance->two_bytes);
+    } else {
+        subbrute_protocol_default_payload(
+            stream, instance->file, step, instance->bits, instance->te, instance->repeat);
+    }
+
+    if(subghz_transmitter_deserialize(transmitter, flipper_format) != SubGhzProtocolStatusOk) {
+        FURI_LOG_W(TAG, "Cannot encode step %lld", step);
+        return false;
+    }
+    return true;
+}
+
 /**
  * Entrypoint for worker
  *
@@ -382,60 +421,71 @@ int32_t subbrute_worker_thread(void* context) {
 
     instance->protocol_name = subbrute_protocol_file(instance->file);
 
+    // Next code is encoded into the spare transmitter while current one is on air
+    SubGhzTransmitter* transmitter[2];
+    for(size_t i = 0; i < COUNT_OF(transmitter); i++) {
+        transmitter[i] =
+            subghz_transmitter_alloc_init(instance->environment, instance->protocol_name);
+    }
     FlipperFormat* flipper_format = flipper_format_string_alloc();
-    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+
+    const uint8_t timeout = instance->tx_timeout_ms;
+    while(instance->transmit_mode) {
+        furi_delay_ms(timeout);
+    }
+    instance->transmit_mode = true;
+
+    // Radio is configured once for the whole run
+    subghz_devices_reset(instance->radio_device);
+    subghz_devices_idle(instance->radio_device);
+    subghz_devices_load_preset(instance->radio_device, instance->preset, NULL);
+    subghz_devices_set_frequency(
+        instance->radio_device, instance->frequency); // TODO is freq valid check
+
+    size_t current = 0;
+    bool is_encoded =
+        subbrute_worker_encode(instance, flipper_format, transmitter[current], instance->step);
 
     while(instance->worker_running) {
-        stream_clean(stream);
-        if(instance->attack == SubBruteAttackLoadFile) {
-            subbrute_protocol_file_payload(
-                stream,
-                instance->step,
-                instance->bits,
-                instance->te,
-                instance->repeat,
-                instance->load_index,
-                instance->file_key,
-                instance->two_bytes);
-        } else {
-            subbrute_protocol_default_payload(
-                stream,
-                instance->file,
-                instance->step,
-                instance->bits,
-                instance->te,
-                instance->repeat);
+        bool is_sending = is_encoded && subghz_devices_set_tx(instance->radio_device);
+        if(is_sending) {
+            subghz_devices_start_async_tx(
+                instance->radio_device, subghz_transmitter_yield, transmitter[current]);
         }
-#ifdef FURI_DEBUG
-        //FURI_LOG_I(TAG, "Payload: %s", furi_string_get_cstr(payload));
-        //furi_delay_ms(SUBBRUTE_MANUAL_TRANSMIT_INTERVAL / 4);
-#endif
 
-        //        size_t written = stream_write_stream_write_string(stream, payload);
-        //        if(written <= 0) {
-        //            FURI_LOG_W(TAG, "Error creating packet! BREAK");
-        //            instance->worker_running = false;
-        //            local_state = SubBruteWorkerStateIDLE;
-        //            furi_string_free(payload);
-        //            break;
-        //        }
+        bool is_last = instance->step + 1 > instance->max_value;
+        if(!is_last) {
+            is_encoded = subbrute_worker_encode(
+                instance, flipper_format, transmitter[current ^ 1], instance->step + 1);
+        }
 
-        subbrute_worker_subghz_transmit(instance, flipper_format);
+        if(is_sending) {
+            while(!subghz_devices_is_async_complete_tx(instance->radio_device)) {
+                furi_delay_ms(timeout);
+            }
+            subghz_devices_stop_async_tx(instance->radio_device);
+        }
 
-        if(instance->step + 1 > instance->max_value) {
+        if(is_last) {
 #ifdef FURI_DEBUG
             FURI_LOG_I(TAG, "Worker finished to end");
 #endif
             local_state = SubBruteWorkerStateFinished;
-            //            furi_string_free(payload);
             break;
         }
         instance->step++;
+        current ^= 1;
 
-        //        furi_string_free(payload);
         furi_delay_ms(instance->tx_timeout_ms);
     }
 
+    subghz_devices_idle(instance->radio_device);
+    instance->transmit_mode = false;
+
+    for(size_t i = 0; i < COUNT_OF(transmitter); i++) {
+        subghz_transmitter_stop(transmitter[i]);
+        subghz_transmitter_free(transmitter[i]);
+    }
     flipper_format_free(flipper_format);
 
     instance->worker_running = false; // Because we have error states
@@ -231,6 +231,34 @@ static void swd_write(AppFSM* const ctx, const uint8_t* data, size_t bits) {
     }
 }
 
+/* Sequencer drives found pins only, scanning toggles several candidates and keeps bit-banging */
+static SwdSequencer* swd_get_sequencer(AppFSM* const ctx) {
+    if(ctx->mode_page <= ModePageFound || ctx->io_num_swc >= 8 || ctx->io_num_swd >= 8) {
+        return NULL;
+    }
+
+    if(ctx->sequencer &&
+       (ctx->sequencer_swc != ctx->io_num_swc || ctx->sequencer_swd != ctx->io_num_swd)) {
+        swd_sequencer_free(ctx->sequencer);
+        ctx->sequencer = NULL;
+    }
+
+    if(!ctx->sequencer &&
+       swd_sequencer_is_supported(gpios[ctx->io_num_swc], gpios[ctx->io_num_swd])) {
+        ctx->sequencer = swd_sequencer_alloc(gpios[ctx->io_num_swc], gpios[ctx->io_num_swd]);
+        ctx->sequencer_swc = ctx->io_num_swc;
+        ctx->sequencer_swd = ctx->io_num_swd;
+    }
+
+    if(ctx->sequencer) {
+        uint32_t frequency = ctx->swd_clock_delay ? 500000 / ctx->swd_clock_delay :
+                                                    SWD_SEQUENCER_CLOCK_MAX;
+        swd_sequencer_set_clock(ctx->sequencer, frequency);
+    }
+
+    return ctx->sequencer;
+}
+
 static uint8_t swd_transfer(AppFSM* const ctx, bool ap, bool write, uint8_t a23, uint32_t* data) {
     //notification_message(ctx->notification, &sequence_set_blue_255);
     //notification_message(ctx->notification, &sequence_reset_red);
@@ -239,6 +267,23 @@ static uint8_t swd_transfer(AppFSM* const ctx, bool ap, bool write, uint8_t a23,
     swd_configure_pins(ctx, true);
 
     uint32_t idle = 0;
+    SwdSequencer* sequencer = swd_get_sequencer(ctx);
+
+    /* DP register 0 stays bit-banged, ACK is ignored for ABORT and DPIDR below */
+    if(sequencer && (ap || a23 != 0)) {
+        if(ctx->swd_idle_bits) {
+            swd_sequencer_write(sequencer, (uint8_t*)&idle, ctx->swd_idle_bits);
+        }
+
+        uint8_t request = (a23 & 0x03) << 2;
+        request |= ap ? SWD_SEQUENCER_REQUEST_APnDP : 0;
+        request |= write ? 0 : SWD_SEQUENCER_REQUEST_RnW;
+        uint8_t ack = swd_sequencer_transfer(sequencer, request, data);
+
+        swd_set_data(ctx, false);
+        return ack;
+    }
+
     swd_write(ctx, (uint8_t*)&idle, ctx->swd_idle_bits);
 
     uint8_t request[] = {0};
@@ -3172,6 +3217,10 @@ int32_t swd_probe_app_main(void* p) {
 
     usb_uart_disable(app->uart);
 
+    if(app->sequencer) {
+        swd_sequencer_free(app->sequencer);
+    }
+
     furi_message_queue_free(app->event_queue);
     furi_mutex_free(app->gui_mutex);
     furi_mutex_free(app->swd_mutex);
@@ -18,6 +18,7 @@
 #include <dolphin/dolphin.h>
 #include <notification/notification.h>
 #include <notification/notification_messages.h>
+#include <swd_sequencer.h>
 
 #include "usb_uart.h"
 
@@ -187,6 +188,9 @@ typedef struct {
     int32_t detected_timeout;
     uint32_t swd_clock_delay;
     uint32_t swd_idle_bits;
+    SwdSequencer* sequencer;
+    uint8_t sequencer_swc;
+    uint8_t sequencer_swd;
     bool detected;
     bool detected_device;
     bool detected_notified;
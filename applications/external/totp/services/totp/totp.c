@@ -2,10 +2,14 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 #include <timezone_utils.h>
 #include "../../config/wolfssl/config.h"
 #include <wolfssl/wolfcrypt/hmac.h>
+#include <wolfssl/wolfcrypt/hash.h>
+#include <memset_s.h>
+#include <furi/core/check.h>
 #ifdef NO_INLINE
 #include <wolfssl/wolfcrypt/misc.h>
 #else
@@ -14,6 +18,15 @@
 #endif
 
 #define HMAC_MAX_RESULT_SIZE WC_SHA512_DIGEST_SIZE
+#define HMAC_MAX_BLOCK_SIZE WC_SHA512_BLOCK_SIZE
+#define HMAC_IPAD (0x36)
+#define HMAC_OPAD (0x5C)
+
+struct OtpKeySchedule {
+    enum wc_HashType type;
+    wc_HashAlg inner;
+    wc_HashAlg outer;
+};
 
 /**
  * @brief Generates the timeblock for a time in seconds.
@@ -28,6 +41,21 @@ uint64_t totp_timecode(uint8_t interval, uint64_t for_time) {
     return for_time / interval;
 }
 
+/**
+ * @brief Extracts OTP code from HMAC using dynamic truncation (RFC 4226 section 5.3)
+ * @param hmac HMAC result
+ * @param hmac_len HMAC result length
+ * @return OTP code
+ */
+static uint64_t otp_truncate(const uint8_t* hmac, int hmac_len) {
+    uint64_t offset = (hmac[hmac_len - 1] & 0xF);
+    uint64_t i_code =
+        ((hmac[offset] & 0x7F) << 24 | (hmac[offset + 1] & 0xFF) << 16 |
+         (hmac[offset + 2] & 0xFF) << 8 | (hmac[offset + 3] & 0xFF));
+
+    return i_code;
+}
+
 /**
  * @brief Generates an OTP (One Time Password)
  * @param algo hashing algorithm to be used
@@ -51,11 +79,43 @@ uint64_t otp_generate(
         return OTP_ERROR;
     }
 
-    uint64_t offset = (hmac[hmac_len - 1] & 0xF);
-    uint64_t i_code =
-        ((hmac[offset] & 0x7F) << 24 | (hmac[offset + 1] & 0xFF) << 16 |
-         (hmac[offset + 2] & 0xFF) << 8 | (hmac[offset + 3] & 0xFF));
+    return otp_truncate(hmac, hmac_len);
+}
 
+/**
+ * @brief Generates an OTP (One Time Password) using precomputed key schedule
+ * @param key_schedule key schedule
+ * @param input input data for OTP code generation
+ * @return OTP code if code was successfully generated; 0 otherwise
+ */
+static uint64_t otp_generate_scheduled(const OtpKeySchedule* key_schedule, uint64_t input) {
+    if(key_schedule->type == WC_HASH_TYPE_NONE) {
+        return OTP_ERROR;
+    }
+
+    uint8_t hmac[HMAC_MAX_RESULT_SIZE] = {0};
+    uint64_t input_swapped = ByteReverseWord64(input);
+    int hmac_len = wc_HashGetDigestSize(key_schedule->type);
+
+    // Both pads are already absorbed, so only message and digest blocks are left to hash
+    wc_HashAlg hash = key_schedule->inner;
+    int ret = wc_HashUpdate(&hash, key_schedule->type, (uint8_t*)&input_swapped, 8);
+    if(ret == 0) {
+        ret = wc_HashFinal(&hash, key_schedule->type, &hmac[0]);
+    }
+
+    if(ret == 0) {
+        hash = key_schedule->outer;
+        ret = wc_HashUpdate(&hash, key_schedule->type, &hmac[0], hmac_len);
+    }
+
+    if(ret == 0) {
+        ret = wc_HashFinal(&hash, key_schedule->type, &hmac[0]);
+    }
+
+    uint64_t i_code = ret == 0 ? otp_truncate(hmac, hmac_len) : OTP_ERROR;
+    memset_s(&hash, sizeof(hash), 0, sizeof(hash));
+    memset_s(hmac, sizeof(hmac), 0, sizeof(hmac));
     return i_code;
 }
 
@@ -80,6 +140,20 @@ uint64_t hotp_at(
     return otp_generate(algo, plain_secret, plain_secret_length, counter);
 }
 
+uint64_t totp_at_scheduled(
+    const OtpKeySchedule* key_schedule,
+    uint64_t for_time,
+    float timezone,
+    uint8_t interval) {
+    uint64_t for_time_adjusted =
+        timezone_offset_apply(for_time, timezone_offset_from_hours(timezone));
+    return otp_generate_scheduled(key_schedule, totp_timecode(interval, for_time_adjusted));
+}
+
+uint64_t hotp_at_scheduled(const OtpKeySchedule* key_schedule, uint64_t counter) {
+    return otp_generate_scheduled(key_schedule, counter);
+}
+
 static int totp_algo_common(
     int type,
     const uint8_t* key,
@@ -131,3 +205,80 @@ static int totp_algo_sha512(
 const TOTP_ALGO TOTP_ALGO_SHA1 = (TOTP_ALGO)(&totp_algo_sha1);
 const TOTP_ALGO TOTP_ALGO_SHA256 = (TOTP_ALGO)(&totp_algo_sha256);
 const TOTP_ALGO TOTP_ALGO_SHA512 = (TOTP_ALGO)(&totp_algo_sha512);
+
+OtpKeySchedule* otp_key_schedule_alloc() {
+    OtpKeySchedule* key_schedule = malloc(sizeof(OtpKeySchedule));
+    furi_check(key_schedule != NULL);
+    otp_key_schedule_reset(key_schedule);
+    return key_schedule;
+}
+
+void otp_key_schedule_free(OtpKeySchedule* key_schedule) {
+    otp_key_schedule_reset(key_schedule);
+    free(key_schedule);
+}
+
+void otp_key_schedule_reset(OtpKeySchedule* key_schedule) {
+    memset_s(key_schedule, sizeof(OtpKeySchedule), 0, sizeof(OtpKeySchedule));
+    key_schedule->type = WC_HASH_TYPE_NONE;
+}
+
+bool otp_key_schedule_set(
+    OtpKeySchedule* key_schedule,
+    TOTP_ALGO algo,
+    const uint8_t* plain_secret,
+    size_t plain_secret_length) {
+    otp_key_schedule_reset(key_schedule);
+
+    enum wc_HashType type;
+    if(algo == TOTP_ALGO_SHA1) {
+        type = WC_HASH_TYPE_SHA;
+    } else if(algo == TOTP_ALGO_SHA256) {
+        type = WC_HASH_TYPE_SHA256;
+    } else if(algo == TOTP_ALGO_SHA512) {
+        type = WC_HASH_TYPE_SHA512;
+    } else {
+        return false;
+    }
+
+    int block_size = wc_HashGetBlockSize(type);
+    uint8_t key_block[HMAC_MAX_BLOCK_SIZE] = {0};
+    int ret = 0;
+    if(plain_secret_length > (size_t)block_size) {
+        ret = wc_Hash(type, plain_secret, plain_secret_length, &key_block[0], sizeof(key_block));
+    } else {
+        memcpy(&key_block[0], plain_secret, plain_secret_length);
+    }
+
+    if(ret == 0) {
+        for(int i = 0; i < block_size; i++) {
+            key_block[i] ^= HMAC_IPAD;
+        }
+        ret = wc_HashInit(&key_schedule->inner, type);
+    }
+
+    if(ret == 0) {
+        ret = wc_HashUpdate(&key_schedule->inner, type, &key_block[0], block_size);
+    }
+
+    if(ret == 0) {
+        for(int i = 0; i < block_size; i++) {
+            key_block[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+        }
+        ret = wc_HashInit(&key_schedule->outer, type);
+    }
+
+    if(ret == 0) {
+        ret = wc_HashUpdate(&key_schedule->outer, type, &key_block[0], block_size);
+    }
+
+    memset_s(key_block, sizeof(key_block), 0, sizeof(key_block));
+
+    if(ret != 0) {
+        otp_key_schedule_reset(key_schedule);
+        return false;
+    }
+
+    key_schedule->type = type;
+    return true;
+}
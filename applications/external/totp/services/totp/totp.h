@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #define OTP_ERROR (0)
 
@@ -21,6 +22,13 @@ typedef int (*TOTP_ALGO)(
     size_t input_length,
     uint8_t* output);
 
+/**
+ * @brief HMAC key schedule, hash states with inner and outer pads of a token secret already
+ *        absorbed. Lets codes be generated without having plain secret around and saves two
+ *        hash blocks per code.
+ */
+typedef struct OtpKeySchedule OtpKeySchedule;
+
 /**
  * @brief Computes HMAC using SHA1
  */
@@ -67,3 +75,57 @@ uint64_t hotp_at(
     const uint8_t* plain_secret,
     size_t plain_secret_length,
     uint64_t counter);
+
+/**
+ * @brief Allocates empty HMAC key schedule.
+ * @return HMAC key schedule
+ */
+OtpKeySchedule* otp_key_schedule_alloc();
+
+/**
+ * @brief Wipes and frees HMAC key schedule.
+ * @param key_schedule HMAC key schedule
+ */
+void otp_key_schedule_free(OtpKeySchedule* key_schedule);
+
+/**
+ * @brief Wipes HMAC key schedule, codes generated with it are \c OTP_ERROR until it is set again.
+ * @param key_schedule HMAC key schedule
+ */
+void otp_key_schedule_reset(OtpKeySchedule* key_schedule);
+
+/**
+ * @brief Precomputes HMAC key schedule for a token secret.
+ * @param key_schedule HMAC key schedule
+ * @param algo hashing algorithm to be used
+ * @param plain_secret plain token secret
+ * @param plain_secret_length plain token secret length
+ * @return \c true if key schedule has been computed; \c false otherwise
+ */
+bool otp_key_schedule_set(
+    OtpKeySchedule* key_schedule,
+    TOTP_ALGO algo,
+    const uint8_t* plain_secret,
+    size_t plain_secret_length);
+
+/**
+ * @brief Generates a TOTP key using the totp algorithm and precomputed HMAC key schedule.
+ * @param key_schedule HMAC key schedule
+ * @param for_time the time the generated key will be created for
+ * @param timezone UTC timezone adjustment for the generated key
+ * @param interval token lifetime in seconds
+ * @return TOTP code if code was successfully generated; 0 otherwise
+ */
+uint64_t totp_at_scheduled(
+    const OtpKeySchedule* key_schedule,
+    uint64_t for_time,
+    float timezone,
+    uint8_t interval);
+
+/**
+ * @brief Generates a HOTP key using the hotp algorithm and precomputed HMAC key schedule.
+ * @param key_schedule HMAC key schedule
+ * @param counter the HOTP counter
+ * @return HOTP code if code was successfully generated; 0 otherwise
+ */
+uint64_t hotp_at_scheduled(const OtpKeySchedule* key_schedule, uint64_t counter);
@@ -16,6 +16,8 @@ struct TotpGenerateCodeWorkerContext {
     const TokenInfo* token_info;
     float timezone_offset;
     const CryptoSettings* crypto_settings;
+    OtpKeySchedule* key_schedule;
+    bool key_schedule_valid;
     TOTP_NEW_CODE_GENERATED_HANDLER on_new_code_generated_handler;
     void* on_new_code_generated_handler_context;
     TOTP_CODE_LIFETIME_CHANGED_HANDLER on_code_lifetime_changed_handler;
@@ -63,34 +65,43 @@ static TOTP_ALGO get_totp_algo_impl(TokenHashAlgo algo) {
     return NULL;
 }
 
+static void
+    update_key_schedule(TotpGenerateCodeWorkerContext* context, const TokenInfo* token_info) {
+    size_t key_length;
+    uint8_t* key = totp_crypto_decrypt(
+        token_info->token, token_info->token_length, context->crypto_settings, &key_length);
+
+    context->key_schedule_valid = otp_key_schedule_set(
+        context->key_schedule, get_totp_algo_impl(token_info->algo), key, key_length);
+
+    memset_s(key, key_length, 0, key_length);
+    free(key);
+}
+
 static void generate_totp_code(
     TotpGenerateCodeWorkerContext* context,
     const TokenInfo* token_info,
     uint32_t current_ts) {
     if(token_info->token != NULL && token_info->token_length > 0) {
-        size_t key_length;
-        uint8_t* key = totp_crypto_decrypt(
-            token_info->token, token_info->token_length, context->crypto_settings, &key_length);
+        // Secret is decrypted only when token changes, time steps reuse precomputed HMAC pads
+        if(!context->key_schedule_valid) {
+            update_key_schedule(context, token_info);
+        }
 
         uint64_t otp_code;
         if(token_info->type == TokenTypeTOTP) {
-            otp_code = totp_at(
-                get_totp_algo_impl(token_info->algo),
-                key,
-                key_length,
+            otp_code = totp_at_scheduled(
+                context->key_schedule,
                 current_ts,
                 context->timezone_offset,
                 token_info->duration);
         } else if(token_info->type == TokenTypeHOTP) {
-            otp_code = hotp_at(
-                get_totp_algo_impl(token_info->algo), key, key_length, token_info->counter);
+            otp_code = hotp_at_scheduled(context->key_schedule, token_info->counter);
         } else {
             furi_crash("Unknown token type");
         }
 
         int_token_to_str(otp_code, context->code_buffer, token_info->digits, token_info->algo);
-        memset_s(key, key_length, 0, key_length);
-        free(key);
     } else {
         int_token_to_str(0, context->code_buffer, token_info->digits, token_info->algo);
     }
@@ -126,6 +137,12 @@ static int32_t totp_generate_worker_callback(void* context) {
 
         uint32_t curr_ts = is_time_based ? furi_hal_rtc_get_timestamp() : 0;
 
+        if(flags & TotpGenerateCodeWorkerEventForceUpdate) {
+            // Current token may have been switched, key schedule has to be computed again
+            otp_key_schedule_reset(t_context->key_schedule);
+            t_context->key_schedule_valid = false;
+        }
+
         bool time_left = false;
         if(flags & TotpGenerateCodeWorkerEventForceUpdate ||
            (is_time_based && (time_left = (curr_ts % token_info->duration) == 0))) {
@@ -167,6 +184,8 @@ TotpGenerateCodeWorkerContext* totp_generate_code_worker_start(
     context->code_buffer_sync = code_buffer_sync;
     context->timezone_offset = timezone_offset;
     context->crypto_settings = crypto_settings;
+    context->key_schedule = otp_key_schedule_alloc();
+    context->key_schedule_valid = false;
     context->thread = furi_thread_alloc();
     furi_thread_set_name(context->thread, "TOTPGenerateWorker");
     furi_thread_set_stack_size(context->thread, 2048);
@@ -181,6 +200,7 @@ void totp_generate_code_worker_stop(TotpGenerateCodeWorkerContext* context) {
     furi_thread_flags_set(furi_thread_get_id(context->thread), TotpGenerateCodeWorkerEventStop);
     furi_thread_join(context->thread);
     furi_thread_free(context->thread);
+    otp_key_schedule_free(context->key_schedule);
     free(context);
 }
 
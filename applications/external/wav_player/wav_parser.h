@@ -63,7 +63,16 @@ typedef struct {
 
     FuriMessageQueue* queue;
 
+    FuriThread* reader_thread;
+    FuriStreamBuffer* ring;
+    size_t ring_size;
+    FuriMessageQueue* seek_queue;
+    volatile bool reader_stop;
+    volatile size_t ring_discard;
+    volatile size_t position;
+
     float volume;
+    uint8_t volume_lut[256];
     bool play;
 
     WavPlayerView* view;
@@ -20,6 +20,13 @@
 
 #define WAVPLAYER_FOLDER "/ext/wav_player"
 
+/* Ring of converted samples between SD reader thread and DMA, sized from free heap */
+#define WAV_PLAYER_RING_MIN ((size_t)8 * 1024)
+#define WAV_PLAYER_RING_MAX ((size_t)64 * 1024)
+#define WAV_PLAYER_READ_FRAMES 512
+#define WAV_PLAYER_READ_TIMEOUT_MS 100
+#define WAV_PLAYER_PREFILL_TIMEOUT_MS 1000
+
 static bool open_wav_stream(Stream* stream) {
     DialogsApp* dialogs = furi_record_open(RECORD_DIALOGS);
     bool result = false;
@@ -81,6 +88,133 @@ static void wav_player_dma_isr(void* ctx) {
     }
 }
 
+static void update_volume_lut(WavPlayerApp* app) {
+    for(size_t i = 0; i < COUNT_OF(app->volume_lut); i++) {
+        float data = (float)i;
+        data -= UINT8_MAX / 2; // to signed
+        data /= UINT8_MAX / 2; // scale -1..1
+
+        data *= app->volume; // volume
+        data = tanhf(data); // hyperbolic tangent limiter
+
+        data *= UINT8_MAX / 2; // scale -128..127
+        data += UINT8_MAX / 2; // to unsigned
+
+        if(data < 0) {
+            data = 0;
+        }
+
+        if(data > 255) {
+            data = 255;
+        }
+
+        app->volume_lut[i] = data;
+    }
+}
+
+// Downmixes frames to unsigned 8-bit mono, returns number of samples produced
+static size_t convert_frames(WavPlayerApp* app, const uint8_t* in, size_t size, uint8_t* out) {
+    size_t count = 0;
+
+    if(app->num_channels == 1 && app->bits_per_sample == 8) {
+        memcpy(out, in, size);
+        count = size;
+    } else if(app->num_channels == 2 && app->bits_per_sample == 8) {
+        for(size_t i = 0; i + 1 < size; i += 2) {
+            out[count++] = (in[i] + in[i + 1]) >> 1; // (L + R) / 2
+        }
+    } else if(app->num_channels == 1 && app->bits_per_sample == 16) {
+        for(size_t i = 0; i + 1 < size; i += 2) {
+            int16_t data = (int16_t)(in[i] | (in[i + 1] << 8));
+            out[count++] = (data >> 8) + 128;
+        }
+    } else if(app->num_channels == 2 && app->bits_per_sample == 16) {
+        for(size_t i = 0; i + 3 < size; i += 4) {
+            int32_t l = (int16_t)(in[i] | (in[i + 1] << 8));
+            int32_t r = (int16_t)(in[i + 2] | (in[i + 3] << 8));
+            out[count++] = ((l + r) >> 9) + 128; // (L + R) / 2
+        }
+    }
+
+    return count;
+}
+
+static int32_t wav_player_reader_thread(void* context) {
+    WavPlayerApp* app = context;
+    size_t frame_size = app->num_channels * (app->bits_per_sample / 8);
+    if((app->num_channels != 1 && app->num_channels != 2) ||
+       (app->bits_per_sample != 8 && app->bits_per_sample != 16)) {
+        FURI_LOG_E(TAG, "Unsupported format");
+        return 0;
+    }
+
+    uint8_t* raw = malloc(WAV_PLAYER_READ_FRAMES * frame_size);
+    uint8_t* samples = malloc(WAV_PLAYER_READ_FRAMES);
+    size_t data_start = wav_parser_get_data_start(app->parser);
+    size_t data_end = wav_parser_get_data_end(app->parser);
+
+    while(!app->reader_stop) {
+        int32_t seek;
+        if(furi_message_queue_get(app->seek_queue, &seek, 0) == FuriStatusOk) {
+            int32_t position = CLAMP(
+                (int32_t)stream_tell(app->stream) + seek, (int32_t)data_end, (int32_t)data_start);
+            position -= (position - data_start) % frame_size;
+            stream_seek(app->stream, position, StreamOffsetFromStart);
+            // Samples queued before seek are dropped by consumer
+            app->ring_discard = furi_stream_buffer_bytes_available(app->ring);
+        }
+
+        size_t to_read =
+            MIN(WAV_PLAYER_READ_FRAMES * frame_size, data_end - stream_tell(app->stream));
+        to_read -= to_read % frame_size;
+        size_t read = to_read ? stream_read(app->stream, raw, to_read) : 0;
+        if(read < frame_size) {
+            // Don't spin on read errors
+            if(to_read) furi_delay_ms(WAV_PLAYER_READ_TIMEOUT_MS);
+            // End of data, loop from the beginning
+            stream_seek(app->stream, data_start, StreamOffsetFromStart);
+            continue;
+        }
+        app->position = stream_tell(app->stream);
+
+        size_t count = convert_frames(app, raw, read, samples);
+        size_t sent = 0;
+        while(sent < count && !app->reader_stop) {
+            sent += furi_stream_buffer_send(
+                app->ring, samples + sent, count - sent, WAV_PLAYER_READ_TIMEOUT_MS);
+        }
+    }
+
+    free(samples);
+    free(raw);
+    return 0;
+}
+
+static void fill_data(WavPlayerApp* app, size_t index) {
+    uint16_t* sample_buffer_start = &app->sample_buffer[index];
+
+    while(app->ring_discard) {
+        size_t discard = MIN(app->ring_discard, app->samples_count_half);
+        discard = furi_stream_buffer_receive(app->ring, app->tmp_buffer, discard, 0);
+        app->ring_discard -= discard;
+        if(!discard) break;
+    }
+
+    // Never wait here, DMA is already playing the other half
+    size_t count =
+        furi_stream_buffer_receive(app->ring, app->tmp_buffer, app->samples_count_half, 0);
+    if(count < app->samples_count_half) {
+        FURI_LOG_D(TAG, "Underrun: %u of %u", count, app->samples_count_half);
+        memset(&app->tmp_buffer[count], UINT8_MAX / 2 + 1, app->samples_count_half - count);
+    }
+
+    for(size_t i = 0; i < app->samples_count_half; i++) {
+        sample_buffer_start[i] = app->volume_lut[app->tmp_buffer[i]];
+    }
+
+    wav_player_view_set_data(app->view, sample_buffer_start, app->samples_count_half);
+}
+
 static WavPlayerApp* app_alloc() {
     WavPlayerApp* app = malloc(sizeof(WavPlayerApp));
     app->samples_count_half = 1024 * 4;
@@ -91,8 +225,14 @@ static WavPlayerApp* app_alloc() {
     app->sample_buffer = malloc(sizeof(uint16_t) * app->samples_count);
     app->tmp_buffer = malloc(sizeof(uint8_t) * app->samples_count);
     app->queue = furi_message_queue_alloc(10, sizeof(WavPlayerEvent));
+    app->seek_queue = furi_message_queue_alloc(4, sizeof(int32_t));
+
+    // Leave most of the heap to GUI and storage
+    app->ring_size = CLAMP(memmgr_get_free_heap() / 4, WAV_PLAYER_RING_MAX, WAV_PLAYER_RING_MIN);
+    app->ring = furi_stream_buffer_alloc(app->ring_size, 1);
 
     app->volume = 10.0f;
+    update_volume_lut(app);
     app->play = true;
 
     app->gui = furi_record_open(RECORD_GUI);
@@ -116,6 +256,8 @@ static void app_free(WavPlayerApp* app) {
     furi_record_close(RECORD_GUI);
 
     furi_message_queue_free(app->queue);
+    furi_message_queue_free(app->seek_queue);
+    furi_stream_buffer_free(app->ring);
     free(app->tmp_buffer);
     free(app->sample_buffer);
     wav_parser_free(app->parser);
@@ -127,188 +269,6 @@ static void app_free(WavPlayerApp* app) {
     free(app);
 }
 
-// TODO: that works only with 8-bit 2ch audio
-static bool fill_data(WavPlayerApp* app, size_t index) {
-    if(app->num_channels == 1 && app->bits_per_sample == 8) {
-        uint16_t* sample_buffer_start = &app->sample_buffer[index];
-        size_t count = stream_read(app->stream, app->tmp_buffer, app->samples_count_half);
-
-        for(size_t i = count; i < app->samples_count_half; i++) {
-            app->tmp_buffer[i] = 0;
-        }
-
-        //for(size_t i = 0; i < app->samples_count; i += 2)
-        for(size_t i = 0; i < app->samples_count_half; i++) //now works with mono!
-        {
-            float data = app->tmp_buffer[i];
-            data -= UINT8_MAX / 2; // to signed
-            data /= UINT8_MAX / 2; // scale -1..1
-
-            data *= app->volume; // volume
-            data = tanhf(data); // hyperbolic tangent limiter
-
-            data *= UINT8_MAX / 2; // scale -128..127
-            data += UINT8_MAX / 2; // to unsigned
-
-            if(data < 0) {
-                data = 0;
-            }
-
-            if(data > 255) {
-                data = 255;
-            }
-
-            //uint8_t data = app->tmp_buffer[i];
-
-            sample_buffer_start[i] = data;
-        }
-
-        wav_player_view_set_data(app->view, sample_buffer_start, app->samples_count_half);
-
-        return count != app->samples_count_half;
-    }
-
-    if(app->num_channels == 1 && app->bits_per_sample == 16) {
-        uint16_t* sample_buffer_start = &app->sample_buffer[index];
-        size_t count = stream_read(app->stream, app->tmp_buffer, app->samples_count);
-
-        for(size_t i = count; i < app->samples_count; i++) {
-            //app->tmp_buffer[i] = 0;
-        }
-
-        for(size_t i = 0; i < app->samples_count; i += 2) {
-            int16_t int_16 =
-                (((int16_t)app->tmp_buffer[i + 1] << 8) + (int16_t)app->tmp_buffer[i]);
-
-            float data = ((float)int_16 / 256.0 + 127.0);
-            data -= UINT8_MAX / 2; // to signed
-            data /= UINT8_MAX / 2; // scale -1..1
-
-            data *= app->volume; // volume
-            data = tanhf(data); // hyperbolic tangent limiter
-
-            data *= UINT8_MAX / 2; // scale -128..127
-            data += UINT8_MAX / 2; // to unsigned
-
-            if(data < 0) {
-                data = 0;
-            }
-
-            if(data > 255) {
-                data = 255;
-            }
-
-            sample_buffer_start[i / 2] = data;
-        }
-
-        wav_player_view_set_data(app->view, sample_buffer_start, app->samples_count_half);
-
-        return count != app->samples_count;
-    }
-
-    if(app->num_channels == 2 && app->bits_per_sample == 16) {
-        uint16_t* sample_buffer_start = &app->sample_buffer[index];
-        size_t count = stream_read(app->stream, app->tmp_buffer, app->samples_count);
-
-        for(size_t i = 0; i < app->samples_count; i += 4) {
-            int16_t L = (((int16_t)app->tmp_buffer[i + 1] << 8) + (int16_t)app->tmp_buffer[i]);
-            int16_t R = (((int16_t)app->tmp_buffer[i + 3] << 8) + (int16_t)app->tmp_buffer[i + 2]);
-            int32_t int_16 = L / 2 + R / 2; // (L + R) / 2
-
-            float data = ((float)int_16 / 256.0 + 127.0);
-            data -= UINT8_MAX / 2; // to signed
-            data /= UINT8_MAX / 2; // scale -1..1
-
-            data *= app->volume; // volume
-            data = tanhf(data); // hyperbolic tangent limiter
-
-            data *= UINT8_MAX / 2; // scale -128..127
-            data += UINT8_MAX / 2; // to unsigned
-
-            if(data < 0) {
-                data = 0;
-            }
-
-            if(data > 255) {
-                data = 255;
-            }
-
-            sample_buffer_start[i / 4] = data;
-        }
-
-        count = stream_read(app->stream, app->tmp_buffer, app->samples_count);
-
-        for(size_t i = 0; i < app->samples_count; i += 4) {
-            int16_t L = (((int16_t)app->tmp_buffer[i + 1] << 8) + (int16_t)app->tmp_buffer[i]);
-            int16_t R = (((int16_t)app->tmp_buffer[i + 3] << 8) + (int16_t)app->tmp_buffer[i + 2]);
-            int32_t int_16 = L / 2 + R / 2; // (L + R) / 2
-
-            float data = ((float)int_16 / 256.0 + 127.0);
-            data -= UINT8_MAX / 2; // to signed
-            data /= UINT8_MAX / 2; // scale -1..1
-
-            data *= app->volume; // volume
-            data = tanhf(data); // hyperbolic tangent limiter
-
-            data *= UINT8_MAX / 2; // scale -128..127
-            data += UINT8_MAX / 2; // to unsigned
-
-            if(data < 0) {
-                data = 0;
-            }
-
-            if(data > 255) {
-                data = 255;
-            }
-
-            sample_buffer_start[i / 4 + app->samples_count / 4] = data;
-        }
-
-        wav_player_view_set_data(app->view, sample_buffer_start, app->samples_count_half);
-
-        return count != app->samples_count;
-    }
-
-    if(app->num_channels == 2 && app->bits_per_sample == 8) {
-        uint16_t* sample_buffer_start = &app->sample_buffer[index];
-        size_t count = stream_read(app->stream, app->tmp_buffer, app->samples_count);
-
-        for(size_t i = count; i < app->samples_count; i++) {
-            app->tmp_buffer[i] = 0;
-        }
-
-        for(size_t i = 0; i < app->samples_count; i += 2) {
-            float data = (app->tmp_buffer[i] + app->tmp_buffer[i + 1]) / 2; // (L + R) / 2
-            data -= UINT8_MAX / 2; // to signed
-            data /= UINT8_MAX / 2; // scale -1..1
-
-            data *= app->volume; // volume
-            data = tanhf(data); // hyperbolic tangent limiter
-
-            data *= UINT8_MAX / 2; // scale -128..127
-            data += UINT8_MAX / 2; // to unsigned
-
-            if(data < 0) {
-                data = 0;
-            }
-
-            if(data > 255) {
-                data = 255;
-            }
-
-            //uint8_t data = app->tmp_buffer[i];
-
-            sample_buffer_start[i / 2] = data;
-        }
-
-        wav_player_view_set_data(app->view, sample_buffer_start, app->samples_count_half);
-
-        return count != app->samples_count;
-    }
-
-    return true;
-}
-
 static void ctrl_callback(WavPlayerCtrl ctrl, void* ctx) {
     FuriMessageQueue* event_queue = ctx;
     WavPlayerEvent event;
@@ -356,8 +316,22 @@ static void app_run(WavPlayerApp* app) {
     wav_player_view_set_context(app->view, app->queue);
     wav_player_view_set_ctrl_callback(app->view, ctrl_callback);
 
-    bool eof = fill_data(app, 0);
-    eof = fill_data(app, app->samples_count_half);
+    app->reader_stop = false;
+    app->reader_thread =
+        furi_thread_alloc_ex("WavPlayerReader", 1024, wav_player_reader_thread, app);
+    furi_thread_start(app->reader_thread);
+
+    // Let reader get ahead of DMA before playback starts
+    uint32_t prefill_start = furi_get_tick();
+    while(furi_stream_buffer_bytes_available(app->ring) < app->ring_size / 2 &&
+          furi_get_tick() - prefill_start < WAV_PLAYER_PREFILL_TIMEOUT_MS) {
+        furi_delay_ms(10);
+    }
+
+    wav_player_view_set_chans(app->view, app->num_channels);
+    wav_player_view_set_bits(app->view, app->bits_per_sample);
+    fill_data(app, 0);
+    fill_data(app, app->samples_count_half);
 
     if(furi_hal_speaker_acquire(1000)) {
         wav_player_speaker_init(app->sample_rate);
@@ -373,55 +347,36 @@ static void app_run(WavPlayerApp* app) {
         while(1) {
             if(furi_message_queue_get(app->queue, &event, FuriWaitForever) == FuriStatusOk) {
                 if(event.type == WavPlayerEventHalfTransfer) {
-                    wav_player_view_set_chans(app->view, app->num_channels);
-                    wav_player_view_set_bits(app->view, app->bits_per_sample);
-
-                    eof = fill_data(app, 0);
-                    wav_player_view_set_current(app->view, stream_tell(app->stream));
-                    if(eof) {
-                        stream_seek(
-                            app->stream,
-                            wav_parser_get_data_start(app->parser),
-                            StreamOffsetFromStart);
-                    }
-
+                    fill_data(app, 0);
+                    wav_player_view_set_current(app->view, app->position);
                 } else if(event.type == WavPlayerEventFullTransfer) {
-                    wav_player_view_set_chans(app->view, app->num_channels);
-                    wav_player_view_set_bits(app->view, app->bits_per_sample);
-
-                    eof = fill_data(app, app->samples_count_half);
-                    wav_player_view_set_current(app->view, stream_tell(app->stream));
-                    if(eof) {
-                        stream_seek(
-                            app->stream,
-                            wav_parser_get_data_start(app->parser),
-                            StreamOffsetFromStart);
-                    }
+                    fill_data(app, app->samples_count_half);
+                    wav_player_view_set_current(app->view, app->position);
                 } else if(event.type == WavPlayerEventCtrlVolUp) {
                     if(app->volume < 9.9) app->volume += 0.4;
+                    update_volume_lut(app);
                     wav_player_view_set_volume(app->view, app->volume);
                 } else if(event.type == WavPlayerEventCtrlVolDn) {
                     if(app->volume > 0.01) app->volume -= 0.4;
+                    update_volume_lut(app);
                     wav_player_view_set_volume(app->view, app->volume);
                 } else if(event.type == WavPlayerEventCtrlMoveL) {
-                    int32_t seek =
-                        stream_tell(app->stream) - wav_parser_get_data_start(app->parser);
+                    int32_t seek = app->position - wav_parser_get_data_start(app->parser);
                     seek = MIN(
                         seek,
                         (int32_t)(wav_parser_get_data_len(app->parser) / (size_t)100) % 2 ?
                             ((int32_t)(wav_parser_get_data_len(app->parser) / (size_t)100) - 1) :
                             (int32_t)(wav_parser_get_data_len(app->parser) / (size_t)100));
-                    stream_seek(app->stream, -seek, StreamOffsetFromCurrent);
-                    wav_player_view_set_current(app->view, stream_tell(app->stream));
+                    seek = -seek;
+                    furi_message_queue_put(app->seek_queue, &seek, 0);
                 } else if(event.type == WavPlayerEventCtrlMoveR) {
-                    int32_t seek = wav_parser_get_data_end(app->parser) - stream_tell(app->stream);
+                    int32_t seek = wav_parser_get_data_end(app->parser) - app->position;
                     seek = MIN(
                         seek,
                         (int32_t)(wav_parser_get_data_len(app->parser) / (size_t)100) % 2 ?
                             ((int32_t)(wav_parser_get_data_len(app->parser) / (size_t)100) - 1) :
                             (int32_t)(wav_parser_get_data_len(app->parser) / (size_t)100));
-                    stream_seek(app->stream, seek, StreamOffsetFromCurrent);
-                    wav_player_view_set_current(app->view, stream_tell(app->stream));
+                    furi_message_queue_put(app->seek_queue, &seek, 0);
                 } else if(event.type == WavPlayerEventCtrlOk) {
                     app->play = !app->play;
                     wav_player_view_set_play(app->view, app->play);
@@ -442,6 +397,10 @@ static void app_run(WavPlayerApp* app) {
         furi_hal_speaker_release();
     }
 
+    app->reader_stop = true;
+    furi_thread_join(app->reader_thread);
+    furi_thread_free(app->reader_thread);
+
     // Reset GPIO pin and bus states
     wav_player_hal_deinit();
 
@@ -0,0 +1,135 @@
+#include "buffered_file.h"
+
+#include <furi.h>
+
+#define TAG "BufferedFile"
+
+#define BUFFERED_FILE_BLOCK_SIZE (4 * 1024)
+#define BUFFERED_FILE_BLOCK_COUNT (4)
+#define BUFFERED_FILE_BLOCK_NONE UINT8_MAX
+
+typedef struct {
+    uint8_t index;
+    size_t size;
+} BufferedFileBlock;
+
+struct BufferedFile {
+    File* file;
+    bool expanded;
+    FuriThread* thread;
+
+    uint8_t* blocks;
+    FuriMessageQueue* free_queue;
+    FuriMessageQueue* full_queue;
+
+    // Only touched by the producer
+    uint8_t current;
+    size_t current_size;
+    size_t dropped;
+};
+
+static int32_t buffered_file_worker(void* context) {
+    BufferedFile* buffered = context;
+    BufferedFileBlock block;
+
+    while(true) {
+        furi_check(
+            furi_message_queue_get(buffered->full_queue, &block, FuriWaitForever) ==
+            FuriStatusOk);
+        if(block.index == BUFFERED_FILE_BLOCK_NONE) break;
+
+        uint8_t* data = buffered->blocks + block.index * BUFFERED_FILE_BLOCK_SIZE;
+        if(storage_file_write(buffered->file, data, block.size) != block.size) {
+            FURI_LOG_E(TAG, "Write failed");
+        }
+        furi_check(furi_message_queue_put(buffered->free_queue, &block.index, 0) == FuriStatusOk);
+    }
+
+    return 0;
+}
+
+static void buffered_file_submit(BufferedFile* buffered) {
+    if(buffered->current == BUFFERED_FILE_BLOCK_NONE) return;
+
+    BufferedFileBlock block = {.index = buffered->current, .size = buffered->current_size};
+    if(block.size) {
+        // Queue holds every block, it can't be full
+        furi_check(furi_message_queue_put(buffered->full_queue, &block, 0) == FuriStatusOk);
+    } else {
+        furi_check(furi_message_queue_put(buffered->free_queue, &block.index, 0) == FuriStatusOk);
+    }
+    buffered->current = BUFFERED_FILE_BLOCK_NONE;
+}
+
+BufferedFile* buffered_file_alloc(File* file, uint64_t prealloc) {
+    furi_assert(file);
+    BufferedFile* buffered = malloc(sizeof(BufferedFile));
+
+    buffered->file = file;
+    // Contiguous preallocation is optional, plain writes will allocate otherwise
+    buffered->expanded = prealloc && storage_file_expand(file, prealloc);
+
+    buffered->blocks = malloc(BUFFERED_FILE_BLOCK_SIZE * BUFFERED_FILE_BLOCK_COUNT);
+    buffered->free_queue = furi_message_queue_alloc(BUFFERED_FILE_BLOCK_COUNT, sizeof(uint8_t));
+    // One more slot for stop request
+    buffered->full_queue =
+        furi_message_queue_alloc(BUFFERED_FILE_BLOCK_COUNT + 1, sizeof(BufferedFileBlock));
+    for(uint8_t i = 0; i < BUFFERED_FILE_BLOCK_COUNT; i++) {
+        furi_message_queue_put(buffered->free_queue, &i, 0);
+    }
+    buffered->current = BUFFERED_FILE_BLOCK_NONE;
+
+    buffered->thread = furi_thread_alloc_ex(TAG, 2048, buffered_file_worker, buffered);
+    furi_thread_start(buffered->thread);
+
+    return buffered;
+}
+
+void buffered_file_free(BufferedFile* buffered) {
+    furi_assert(buffered);
+
+    buffered_file_submit(buffered);
+    BufferedFileBlock stop = {.index = BUFFERED_FILE_BLOCK_NONE};
+    furi_check(
+        furi_message_queue_put(buffered->full_queue, &stop, FuriWaitForever) == FuriStatusOk);
+    furi_thread_join(buffered->thread);
+    furi_thread_free(buffered->thread);
+
+    // Cut preallocated space that was not written
+    if(buffered->expanded && !storage_file_truncate(buffered->file)) {
+        FURI_LOG_E(TAG, "Truncate failed");
+    }
+    if(buffered->dropped) {
+        FURI_LOG_W(TAG, "Dropped %zu bytes, SD was too slow", buffered->dropped);
+    }
+
+    furi_message_queue_free(buffered->full_queue);
+    furi_message_queue_free(buffered->free_queue);
+    free(buffered->blocks);
+    free(buffered);
+}
+
+void buffered_file_write(BufferedFile* buffered, const uint8_t* data, size_t size) {
+    furi_assert(buffered);
+
+    while(size) {
+        if(buffered->current == BUFFERED_FILE_BLOCK_NONE) {
+            if(furi_message_queue_get(buffered->free_queue, &buffered->current, 0) !=
+               FuriStatusOk) {
+                buffered->current = BUFFERED_FILE_BLOCK_NONE;
+                buffered->dropped += size;
+                return;
+            }
+            buffered->current_size = 0;
+        }
+
+        uint8_t* block = buffered->blocks + buffered->current * BUFFERED_FILE_BLOCK_SIZE;
+        size_t chunk = MIN(size, BUFFERED_FILE_BLOCK_SIZE - buffered->current_size);
+        memcpy(block + buffered->current_size, data, chunk);
+        buffered->current_size += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if(buffered->current_size == BUFFERED_FILE_BLOCK_SIZE) buffered_file_submit(buffered);
+    }
+}
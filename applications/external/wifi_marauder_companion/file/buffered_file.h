@@ -0,0 +1,20 @@
+#pragma once
+
+#include <storage/storage.h>
+
+/** Writes an open file from a background thread in large blocks,
+ * so the UART thread that produces the data never waits for SD */
+typedef struct BufferedFile BufferedFile;
+
+/** Start writing into empty, already opened file
+ *
+ * @param file        open file, must stay open until buffered_file_free
+ * @param prealloc    bytes to allocate up front or 0, unused space is cut on free
+ */
+BufferedFile* buffered_file_alloc(File* file, uint64_t prealloc);
+
+/** Write remaining data and stop, file is left open */
+void buffered_file_free(BufferedFile* buffered);
+
+/** Queue data for writing, data is dropped if all blocks are waiting for SD */
+void buffered_file_write(BufferedFile* buffered, const uint8_t* data, size_t size);
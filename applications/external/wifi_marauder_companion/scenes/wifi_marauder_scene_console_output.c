@@ -35,7 +35,7 @@ void wifi_marauder_console_output_handle_rx_data_cb(uint8_t* buf, size_t len, vo
 
     if(app->is_writing_log) {
         app->has_saved_logs_this_session = true;
-        storage_file_write(app->log_file, buf, len);
+        buffered_file_write(app->log_writer, buf, len);
     }
 
     // If text box store gets too big, then truncate it
@@ -56,7 +56,7 @@ void wifi_marauder_console_output_handle_rx_packets_cb(uint8_t* buf, size_t len,
     WifiMarauderApp* app = context;
 
     if(app->is_writing_pcap) {
-        storage_file_write(app->capture_file, buf, len);
+        buffered_file_write(app->capture_writer, buf, len);
     }
 }
 
@@ -127,6 +127,7 @@ void wifi_marauder_scene_console_output_on_enter(void* context) {
             if(app->log_file_path != NULL) {
                 if(storage_file_open(
                        app->log_file, app->log_file_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+                    app->log_writer = buffered_file_alloc(app->log_file, 0);
                     app->is_writing_log = true;
                 } else {
                     dialog_message_show_storage_error(app->dialogs, "Cannot open log file");
@@ -140,6 +141,8 @@ void wifi_marauder_scene_console_output_on_enter(void* context) {
         if(_wifi_marauder_is_save_pcaps_enabled(app)) {
             if(sequential_file_open(
                    app->storage, app->capture_file, MARAUDER_APP_FOLDER_PCAPS, prefix, "pcap")) {
+                app->capture_writer =
+                    buffered_file_alloc(app->capture_file, WIFI_MARAUDER_PCAP_PREALLOC_SIZE);
                 app->is_writing_pcap = true;
             } else {
                 dialog_message_show_storage_error(app->dialogs, "Cannot open pcap file");
@@ -211,11 +214,19 @@ void wifi_marauder_scene_console_output_on_exit(void* context) {
     app->script_worker = NULL;
 
     app->is_writing_pcap = false;
+    if(app->capture_writer) {
+        buffered_file_free(app->capture_writer);
+        app->capture_writer = NULL;
+    }
     if(app->capture_file && storage_file_is_open(app->capture_file)) {
         storage_file_close(app->capture_file);
     }
 
     app->is_writing_log = false;
+    if(app->log_writer) {
+        buffered_file_free(app->log_writer);
+        app->log_writer = NULL;
+    }
     if(app->log_file && storage_file_is_open(app->log_file)) {
         storage_file_close(app->log_file);
     }
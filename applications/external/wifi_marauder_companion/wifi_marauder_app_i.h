@@ -8,6 +8,7 @@
 #include "wifi_marauder_uart.h"
 #include "wifi_marauder_ep.h"
 #include "file/sequential_file.h"
+#include "file/buffered_file.h"
 #include "script/wifi_marauder_script.h"
 #include "script/wifi_marauder_script_worker.h"
 #include "script/wifi_marauder_script_executor.h"
@@ -33,6 +34,7 @@
 
 #define WIFI_MARAUDER_TEXT_BOX_STORE_SIZE (4096)
 #define WIFI_MARAUDER_TEXT_INPUT_STORE_SIZE (512)
+#define WIFI_MARAUDER_PCAP_PREALLOC_SIZE (1024 * 1024)
 
 #define MARAUDER_APP_FOLDER_USER "apps_data/marauder"
 #define MARAUDER_APP_FOLDER EXT_PATH(MARAUDER_APP_FOLDER_USER)
@@ -65,6 +67,8 @@ struct WifiMarauderApp {
     Storage* storage;
     File* capture_file;
     File* log_file;
+    BufferedFile* capture_writer;
+    BufferedFile* log_writer;
     char log_file_path[100];
     File* save_pcap_setting_file;
     File* save_logs_setting_file;
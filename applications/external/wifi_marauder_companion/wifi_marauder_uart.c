@@ -33,13 +33,17 @@ void wifi_marauder_uart_set_handle_rx_data_cb(
 
 #define WORKER_ALL_RX_EVENTS (WorkerEvtStop | WorkerEvtRxDone)
 
-void wifi_marauder_uart_on_irq_cb(UartIrqEvent ev, uint8_t data, void* context) {
+static void wifi_marauder_uart_on_rx_cb(
+    FuriHalUartId ch,
+    const uint8_t* data,
+    size_t size,
+    void* context) {
+    UNUSED(ch);
     WifiMarauderUart* uart = (WifiMarauderUart*)context;
 
-    if(ev == UartIrqEventRXNE) {
-        furi_stream_buffer_send(uart->rx_stream, &data, 1, 0);
-        furi_thread_flags_set(furi_thread_get_id(uart->rx_thread), WorkerEvtRxDone);
-    }
+    // DMA chunks instead of per byte interrupts, sniffers stream packets nonstop
+    furi_stream_buffer_send(uart->rx_stream, data, size, 0);
+    furi_thread_flags_set(furi_thread_get_id(uart->rx_thread), WorkerEvtRxDone);
 }
 
 static int32_t uart_worker(void* context) {
@@ -95,7 +99,7 @@ WifiMarauderUart*
         furi_hal_uart_init(channel, BAUDRATE);
     }
     furi_hal_uart_set_br(channel, BAUDRATE);
-    furi_hal_uart_set_irq_cb(channel, wifi_marauder_uart_on_irq_cb, uart);
+    furi_hal_uart_dma_rx_start(channel, wifi_marauder_uart_on_rx_cb, uart);
 
     return uart;
 }
@@ -121,7 +125,7 @@ void wifi_marauder_uart_free(WifiMarauderUart* uart) {
     furi_thread_join(uart->rx_thread);
     furi_thread_free(uart->rx_thread);
 
-    furi_hal_uart_set_irq_cb(uart->channel, NULL, NULL);
+    furi_hal_uart_dma_rx_stop(uart->channel);
     if(uart->channel == FuriHalUartIdLPUART1) {
         furi_hal_uart_deinit(uart->channel);
     } else {
@@ -71,10 +71,10 @@ void archive_free(ArchiveApp* archive) {
 
     scene_manager_set_scene_state(archive->scene_manager, ArchiveAppSceneInfo, false);
     scene_manager_set_scene_state(archive->scene_manager, ArchiveAppSceneSearch, false);
-    if(archive->thread) {
-        furi_thread_join(archive->thread);
-        furi_thread_free(archive->thread);
-        archive->thread = NULL;
+    if(archive->work) {
+        furi_work_wait(archive->work, FuriWaitForever);
+        furi_work_free(archive->work);
+        archive->work = NULL;
     }
 
     // Loading
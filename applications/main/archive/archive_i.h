@@ -43,7 +43,7 @@ struct ArchiveApp {
     FuriString* file_extension;
 
     WidgetElement* element;
-    FuriThread* thread;
+    FuriWork* work;
 };
 
 void archive_show_loading_popup(ArchiveApp* context, bool show);
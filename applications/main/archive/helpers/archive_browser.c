@@ -532,10 +532,10 @@ void archive_switch_tab(ArchiveBrowserView* browser, InputKey key) {
         with_view_model(
             browser->view, ArchiveBrowserViewModel * model, { archive = model->archive; }, false);
         scene_manager_set_scene_state(archive->scene_manager, ArchiveAppSceneSearch, false);
-        if(archive->thread) {
-            furi_thread_join(archive->thread);
-            furi_thread_free(archive->thread);
-            archive->thread = NULL;
+        if(archive->work) {
+            furi_work_wait(archive->work, FuriWaitForever);
+            furi_work_free(archive->work);
+            archive->work = NULL;
         }
     }
 
@@ -13,7 +13,7 @@ void archive_scene_info_widget_callback(GuiButtonType result, InputType type, vo
     }
 }
 
-uint32_t archive_scene_info_dirwalk(void* context) {
+void archive_scene_info_dirwalk(void* context) {
     furi_assert(context);
     ArchiveApp* instance = context;
 
@@ -58,7 +58,6 @@ uint32_t archive_scene_info_dirwalk(void* context) {
     furi_record_close(RECORD_STORAGE);
 
     view_dispatcher_switch_to_view(instance->view_dispatcher, ArchiveViewWidget);
-    return 0;
 }
 
 void archive_scene_info_on_enter(void* context) {
@@ -133,9 +132,8 @@ void archive_scene_info_on_enter(void* context) {
 
     if(is_dir) {
         scene_manager_set_scene_state(instance->scene_manager, ArchiveAppSceneInfo, true);
-        instance->thread = furi_thread_alloc_ex(
-            "ArchiveInfoDirWalk", 1024, (FuriThreadCallback)archive_scene_info_dirwalk, instance);
-        furi_thread_start(instance->thread);
+        instance->work = furi_work_alloc(archive_scene_info_dirwalk, instance);
+        furi_work_submit(instance->work, FuriWorkQueuePriorityNormal);
     }
 }
 
@@ -155,10 +153,10 @@ void archive_scene_info_on_exit(void* context) {
     ArchiveApp* app = (ArchiveApp*)context;
 
     scene_manager_set_scene_state(app->scene_manager, ArchiveAppSceneInfo, false);
-    if(app->thread) {
-        furi_thread_join(app->thread);
-        furi_thread_free(app->thread);
-        app->thread = NULL;
+    if(app->work) {
+        furi_work_wait(app->work, FuriWaitForever);
+        furi_work_free(app->work);
+        app->work = NULL;
     }
     widget_reset(app->widget);
 }
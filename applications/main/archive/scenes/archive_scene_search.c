@@ -34,7 +34,7 @@ void archive_scene_search_on_enter(void* context) {
     view_dispatcher_switch_to_view(archive->view_dispatcher, ArchiveViewTextInput);
 }
 
-uint32_t archive_scene_search_dirwalk(void* context) {
+void archive_scene_search_dirwalk(void* context) {
     furi_assert(context);
     ArchiveApp* archive = context;
 
@@ -85,7 +85,6 @@ uint32_t archive_scene_search_dirwalk(void* context) {
     furi_string_free(path);
     dir_walk_free(dir_walk);
     furi_record_close(RECORD_STORAGE);
-    return 0;
 }
 
 bool archive_scene_search_on_event(void* context, SceneManagerEvent event) {
@@ -98,15 +97,11 @@ bool archive_scene_search_on_event(void* context, SceneManagerEvent event) {
             archive_add_app_item(archive->browser, "/app:search/Cancel search");
             archive_set_item_count(archive->browser, 1);
 
-            // Thread here is fine because only the info pane uses it too,
+            // Work here is fine because only the info pane uses it too,
             // but only for directories, which are ignored for search
             scene_manager_set_scene_state(archive->scene_manager, ArchiveAppSceneSearch, true);
-            archive->thread = furi_thread_alloc_ex(
-                "ArchiveSearchDirWalk",
-                1024,
-                (FuriThreadCallback)archive_scene_search_dirwalk,
-                archive);
-            furi_thread_start(archive->thread);
+            archive->work = furi_work_alloc(archive_scene_search_dirwalk, archive);
+            furi_work_submit(archive->work, FuriWorkQueuePriorityLow);
 
             scene_manager_previous_scene(archive->scene_manager);
             consumed = true;
@@ -205,34 +205,60 @@ int32_t ducky_error(BadKbScript* bad_kb, const char* text, ...) {
     return SCRIPT_STATE_ERROR;
 }
 
+static void ducky_string_batch_release(BadKbScript* bad_kb, uint16_t* batch, size_t batch_len) {
+    if(bad_kb->bt) furi_delay_ms(bt_timeout);
+    if(batch_len == 1) {
+        // Keys held with HOLD stay pressed
+        if(bad_kb->bt) {
+            furi_hal_bt_hid_kb_release(batch[0]);
+        } else {
+            furi_hal_hid_kb_release(batch[0]);
+        }
+    } else {
+        if(bad_kb->bt) {
+            furi_hal_bt_hid_kb_release_all();
+        } else {
+            furi_hal_hid_kb_release_all();
+        }
+    }
+}
+
 bool ducky_string(BadKbScript* bad_kb, const char* param) {
     uint32_t i = 0;
+    uint16_t batch[HID_KB_MAX_KEYS];
+    size_t batch_len = 0;
+    // Keys of batch are pressed one by one, each report adds one key, so host gets them in
+    // order, and released together. Held keys would be released too, so no batching then.
+    size_t batch_max = (bad_kb->key_hold_nb == 0) ? bad_kb->string_batch : 1;
+    batch_max = CLAMP(batch_max, (size_t)HID_KB_MAX_KEYS, 1U);
 
     while(param[i] != '\0') {
-        if(param[i] != '\n') {
-            uint16_t keycode = BADKB_ASCII_TO_KEY(bad_kb, param[i]);
-            if(keycode != HID_KEYBOARD_NONE) {
-                if(bad_kb->bt) {
-                    furi_hal_bt_hid_kb_press(keycode);
-                    furi_delay_ms(bt_timeout);
-                    furi_hal_bt_hid_kb_release(keycode);
-                } else {
-                    furi_hal_hid_kb_press(keycode);
-                    furi_hal_hid_kb_release(keycode);
+        uint16_t keycode = (param[i] != '\n') ? BADKB_ASCII_TO_KEY(bad_kb, param[i]) :
+                                                HID_KEYBOARD_RETURN;
+        if(keycode != HID_KEYBOARD_NONE) {
+            if(batch_len > 0) {
+                // Modifiers are shared by the whole report, same key can't be pressed twice
+                bool fits = batch_len < batch_max && (batch[0] >> 8) == (keycode >> 8);
+                for(size_t j = 0; fits && j < batch_len; j++) {
+                    fits = (batch[j] & 0xFF) != (keycode & 0xFF);
+                }
+                if(!fits) {
+                    ducky_string_batch_release(bad_kb, batch, batch_len);
+                    batch_len = 0;
                 }
             }
-        } else {
             if(bad_kb->bt) {
-                furi_hal_bt_hid_kb_press(HID_KEYBOARD_RETURN);
-                furi_delay_ms(bt_timeout);
-                furi_hal_bt_hid_kb_release(HID_KEYBOARD_RETURN);
+                furi_hal_bt_hid_kb_press(keycode);
             } else {
-                furi_hal_hid_kb_press(HID_KEYBOARD_RETURN);
-                furi_hal_hid_kb_release(HID_KEYBOARD_RETURN);
+                furi_hal_hid_kb_press(keycode);
             }
+            batch[batch_len++] = keycode;
         }
         i++;
     }
+    if(batch_len > 0) {
+        ducky_string_batch_release(bad_kb, batch, batch_len);
+    }
     bad_kb->stringdelay = 0;
     return true;
 }
@@ -357,15 +383,53 @@ static bool ducky_set_bt_id(BadKbScript* bad_kb, const char* line) {
     return true;
 }
 
+static uint8_t ducky_script_read(BadKbScript* bad_kb, File* script_file, bool* eof) {
+    uint8_t ret;
+    if(bad_kb->script_data) {
+        ret = MIN(bad_kb->script_size - bad_kb->script_pos, (size_t)FILE_BUFFER_LEN);
+        memcpy(bad_kb->file_buf, bad_kb->script_data + bad_kb->script_pos, ret);
+        bad_kb->script_pos += ret;
+        *eof = bad_kb->script_pos == bad_kb->script_size;
+    } else {
+        ret = storage_file_read(script_file, bad_kb->file_buf, FILE_BUFFER_LEN);
+        *eof = storage_file_eof(script_file);
+    }
+    return ret;
+}
+
+static void ducky_script_rewind(BadKbScript* bad_kb, File* script_file) {
+    bad_kb->script_pos = 0;
+    if(!bad_kb->script_data) {
+        storage_file_seek(script_file, 0, true);
+    }
+}
+
 static void ducky_script_preload(BadKbScript* bad_kb, File* script_file) {
     BadKbApp* app = bad_kb->app;
     uint8_t ret = 0;
     uint32_t line_len = 0;
+    bool eof = false;
 
     furi_string_reset(bad_kb->line);
 
+    // Small script is played from memory, so storage isn't waited for while typing
+    free(bad_kb->script_data);
+    bad_kb->script_data = NULL;
+    bad_kb->script_size = 0;
+    uint64_t size = storage_file_size(script_file);
+    if(size > 0 && size <= SCRIPT_PRELOAD_MAX_SIZE) {
+        bad_kb->script_data = malloc(size);
+        if(storage_file_read(script_file, bad_kb->script_data, size) == size) {
+            bad_kb->script_size = size;
+        } else {
+            free(bad_kb->script_data);
+            bad_kb->script_data = NULL;
+        }
+    }
+    ducky_script_rewind(bad_kb, script_file);
+
     do {
-        ret = storage_file_read(script_file, bad_kb->file_buf, FILE_BUFFER_LEN);
+        ret = ducky_script_read(bad_kb, script_file, &eof);
         for(uint16_t i = 0; i < ret; i++) {
             if(bad_kb->file_buf[i] == '\n' && line_len > 0) {
                 bad_kb->st.line_nb++;
@@ -377,7 +441,7 @@ static void ducky_script_preload(BadKbScript* bad_kb, File* script_file) {
                 line_len++;
             }
         }
-        if(storage_file_eof(script_file)) {
+        if(eof) {
             if(line_len > 0) {
                 bad_kb->st.line_nb++;
                 break;
@@ -400,7 +464,7 @@ static void ducky_script_preload(BadKbScript* bad_kb, File* script_file) {
         app->set_bt_id = ducky_set_bt_id(bad_kb, &line_tmp[strlen(ducky_cmd_bt_id) + 1]);
     }
 
-    storage_file_seek(script_file, 0, true);
+    ducky_script_rewind(bad_kb, script_file);
     furi_string_reset(bad_kb->line);
 }
 
@@ -430,8 +494,9 @@ static int32_t ducky_script_execute_next(BadKbScript* bad_kb, File* script_file)
 
     while(1) {
         if(bad_kb->buf_len == 0) {
-            bad_kb->buf_len = storage_file_read(script_file, bad_kb->file_buf, FILE_BUFFER_LEN);
-            if(storage_file_eof(script_file)) {
+            bool eof = false;
+            bad_kb->buf_len = ducky_script_read(bad_kb, script_file, &eof);
+            if(eof) {
                 if((bad_kb->buf_len < FILE_BUFFER_LEN) && (bad_kb->file_end == false)) {
                     bad_kb->file_buf[bad_kb->buf_len] = '\n';
                     bad_kb->buf_len++;
@@ -767,10 +832,11 @@ static int32_t bad_kb_worker(void* context) {
                 bad_kb->st.line_cur = 0;
                 bad_kb->defdelay = 0;
                 bad_kb->stringdelay = 0;
+                bad_kb->string_batch = 0;
                 bad_kb->repeat_cnt = 0;
                 bad_kb->key_hold_nb = 0;
                 bad_kb->file_end = false;
-                storage_file_seek(script_file, 0, true);
+                ducky_script_rewind(bad_kb, script_file);
                 bad_kb_script_set_keyboard_layout(bad_kb, bad_kb->keyboard_layout);
                 worker_state = BadKbStateRunning;
                 bad_kb->st.elapsed = 0;
@@ -796,9 +862,10 @@ static int32_t bad_kb_worker(void* context) {
                 bad_kb->st.line_cur = 0;
                 bad_kb->defdelay = 0;
                 bad_kb->stringdelay = 0;
+                bad_kb->string_batch = 0;
                 bad_kb->repeat_cnt = 0;
                 bad_kb->file_end = false;
-                storage_file_seek(script_file, 0, true);
+                ducky_script_rewind(bad_kb, script_file);
                 // extra time for PC to recognize Flipper as keyboard
                 flags = furi_thread_flags_wait(
                     WorkerEvtEnd | WorkerEvtDisconnect | WorkerEvtStartStop,
@@ -1038,6 +1105,8 @@ static int32_t bad_kb_worker(void* context) {
 
     storage_file_close(script_file);
     storage_file_free(script_file);
+    free(bad_kb->script_data);
+    bad_kb->script_data = NULL;
     furi_string_free(bad_kb->line);
     furi_string_free(bad_kb->line_prev);
     furi_string_free(bad_kb->string_print);
@@ -17,6 +17,8 @@ extern "C" {
 #include "../bad_kb_paths.h"
 
 #define FILE_BUFFER_LEN 16
+// Scripts up to this size are read to memory once and played from there
+#define SCRIPT_PRELOAD_MAX_SIZE (8 * 1024)
 
 typedef enum {
     LevelRssi122_100,
@@ -72,8 +74,13 @@ typedef struct {
     uint8_t buf_len;
     bool file_end;
 
+    uint8_t* script_data; // Whole script, NULL if it is streamed from file
+    size_t script_size;
+    size_t script_pos;
+
     uint32_t defdelay;
     uint32_t stringdelay;
+    uint32_t string_batch; // Keys typed per report batch by STRING, up to 6
     uint16_t layout[128];
 
     FuriString* line;
@@ -26,6 +26,9 @@ static const uint32_t baudrate_list[] = {
     230400,
     460800,
     921600,
+    1000000,
+    1500000,
+    2000000,
 };
 
 bool gpio_scene_usb_uart_cfg_on_event(void* context, SceneManagerEvent event) {
@@ -103,7 +106,7 @@ static void line_baudrate_cb(VariableItem* item) {
     char br_text[8];
 
     if(index > 0) {
-        snprintf(br_text, 7, "%lu", baudrate_list[index - 1]);
+        snprintf(br_text, sizeof(br_text), "%lu", baudrate_list[index - 1]);
         variable_item_set_current_value_text(item, br_text);
         app->usb_uart_cfg->baudrate = baudrate_list[index - 1];
     } else {
@@ -137,7 +140,11 @@ void gpio_scene_usb_uart_cfg_on_enter(void* context) {
         app);
     variable_item_set_current_value_index(item, app->usb_uart_cfg->baudrate_mode);
     if(app->usb_uart_cfg->baudrate_mode > 0) {
-        snprintf(br_text, 7, "%lu", baudrate_list[app->usb_uart_cfg->baudrate_mode - 1]);
+        snprintf(
+            br_text,
+            sizeof(br_text),
+            "%lu",
+            baudrate_list[app->usb_uart_cfg->baudrate_mode - 1]);
         variable_item_set_current_value_text(item, br_text);
     } else {
         variable_item_set_current_value_text(
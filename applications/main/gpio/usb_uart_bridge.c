@@ -7,7 +7,8 @@
 #include <furi_hal_usb_cdc.h>
 
 #define USB_CDC_PKT_LEN CDC_DATA_SZ
-#define USB_UART_RX_BUF_SIZE (USB_CDC_PKT_LEN * 5)
+/* ~10ms of data at 2Mbaud, covers host polling gaps */
+#define USB_UART_RX_BUF_SIZE (USB_CDC_PKT_LEN * 32)
 
 #define USB_CDC_BIT_DTR (1 << 0)
 #define USB_CDC_BIT_RTS (1 << 1)
@@ -30,12 +31,13 @@ typedef enum {
     WorkerEvtLineCfgSet = (1 << 5),
     WorkerEvtCtrlLineSet = (1 << 6),
 
+    WorkerEvtUartTxDone = (1 << 7),
 } WorkerEvtFlags;
 
 #define WORKER_ALL_RX_EVENTS                                                      \
     (WorkerEvtStop | WorkerEvtRxDone | WorkerEvtCfgChange | WorkerEvtLineCfgSet | \
      WorkerEvtCtrlLineSet)
-#define WORKER_ALL_TX_EVENTS (WorkerEvtTxStop | WorkerEvtCdcRx)
+#define WORKER_ALL_TX_EVENTS (WorkerEvtTxStop | WorkerEvtCdcRx | WorkerEvtUartTxDone)
 
 struct UsbUartBridge {
     UsbUartConfig cfg;
@@ -75,13 +77,19 @@ static const CdcCallbacks cdc_cb = {
 
 static int32_t usb_uart_tx_thread(void* context);
 
-static void usb_uart_on_irq_cb(UartIrqEvent ev, uint8_t data, void* context) {
+static void usb_uart_on_rx_cb(FuriHalUartId ch, const uint8_t* data, size_t size, void* context) {
+    UNUSED(ch);
     UsbUartBridge* usb_uart = (UsbUartBridge*)context;
 
-    if(ev == UartIrqEventRXNE) {
-        furi_stream_buffer_send(usb_uart->rx_stream, &data, 1, 0);
-        furi_thread_flags_set(furi_thread_get_id(usb_uart->thread), WorkerEvtRxDone);
-    }
+    furi_stream_buffer_send(usb_uart->rx_stream, data, size, 0);
+    furi_thread_flags_set(furi_thread_get_id(usb_uart->thread), WorkerEvtRxDone);
+}
+
+static void usb_uart_on_tx_done_cb(FuriHalUartId ch, void* context) {
+    UNUSED(ch);
+    UsbUartBridge* usb_uart = (UsbUartBridge*)context;
+
+    furi_thread_flags_set(furi_thread_get_id(usb_uart->tx_thread), WorkerEvtUartTxDone);
 }
 
 static void usb_uart_vcp_init(UsbUartBridge* usb_uart, uint8_t vcp_ch) {
@@ -116,12 +124,12 @@ static void usb_uart_serial_init(UsbUartBridge* usb_uart, uint8_t uart_ch) {
     } else if(uart_ch == FuriHalUartIdLPUART1) {
         furi_hal_uart_init(uart_ch, 115200);
     }
-    furi_hal_uart_set_irq_cb(uart_ch, usb_uart_on_irq_cb, usb_uart);
+    furi_hal_uart_dma_rx_start(uart_ch, usb_uart_on_rx_cb, usb_uart);
 }
 
 static void usb_uart_serial_deinit(UsbUartBridge* usb_uart, uint8_t uart_ch) {
     UNUSED(usb_uart);
-    furi_hal_uart_set_irq_cb(uart_ch, NULL, NULL);
+    furi_hal_uart_dma_rx_stop(uart_ch);
     if(uart_ch == FuriHalUartIdUSART1)
         furi_hal_console_enable();
     else if(uart_ch == FuriHalUartIdLPUART1)
@@ -164,6 +172,7 @@ static int32_t usb_uart_worker(void* context) {
 
     usb_uart->tx_thread =
         furi_thread_alloc_ex("UsbUartTxWorker", 512, usb_uart_tx_thread, usb_uart);
+    furi_thread_set_priority(usb_uart->tx_thread, FuriThreadPriorityHigh);
 
     usb_uart_vcp_init(usb_uart, usb_uart->cfg.vcp_ch);
     usb_uart_serial_init(usb_uart, usb_uart->cfg.uart_ch);
@@ -187,18 +196,20 @@ static int32_t usb_uart_worker(void* context) {
         furi_check(!(events & FuriFlagError));
         if(events & WorkerEvtStop) break;
         if(events & WorkerEvtRxDone) {
-            size_t len = furi_stream_buffer_receive(
-                usb_uart->rx_stream, usb_uart->rx_buf, USB_CDC_PKT_LEN, 0);
-            if(len > 0) {
-                if(furi_semaphore_acquire(usb_uart->tx_sem, 100) == FuriStatusOk) {
-                    usb_uart->st.rx_cnt += len;
-                    furi_check(
-                        furi_mutex_acquire(usb_uart->usb_mutex, FuriWaitForever) == FuriStatusOk);
-                    furi_hal_cdc_send(usb_uart->cfg.vcp_ch, usb_uart->rx_buf, len);
-                    furi_check(furi_mutex_release(usb_uart->usb_mutex) == FuriStatusOk);
-                } else {
+            // DMA delivers up to half of its buffer at once, send it all as back to back packets
+            while(true) {
+                size_t len = furi_stream_buffer_receive(
+                    usb_uart->rx_stream, usb_uart->rx_buf, USB_CDC_PKT_LEN, 0);
+                if(len == 0) break;
+                if(furi_semaphore_acquire(usb_uart->tx_sem, 100) != FuriStatusOk) {
                     furi_stream_buffer_reset(usb_uart->rx_stream);
+                    break;
                 }
+                usb_uart->st.rx_cnt += len;
+                furi_check(
+                    furi_mutex_acquire(usb_uart->usb_mutex, FuriWaitForever) == FuriStatusOk);
+                furi_hal_cdc_send(usb_uart->cfg.vcp_ch, usb_uart->rx_buf, len);
+                furi_check(furi_mutex_release(usb_uart->usb_mutex) == FuriStatusOk);
             }
         }
         if(events & WorkerEvtCfgChange) {
@@ -285,23 +296,47 @@ static int32_t usb_uart_worker(void* context) {
 static int32_t usb_uart_tx_thread(void* context) {
     UsbUartBridge* usb_uart = (UsbUartBridge*)context;
 
-    uint8_t data[USB_CDC_PKT_LEN];
+    // Packets are read from endpoint straight into the buffer DMA sends from.
+    // One buffer is on the wire while the other one takes the next packet,
+    // endpoint is NAKed to host until one of them is free.
+    uint8_t data[2][USB_CDC_PKT_LEN];
+    size_t fill = 0;
+    size_t pending = 0;
+    bool tx_busy = false;
+
     while(1) {
         uint32_t events =
             furi_thread_flags_wait(WORKER_ALL_TX_EVENTS, FuriFlagWaitAny, FuriWaitForever);
         furi_check(!(events & FuriFlagError));
+        if(events & WorkerEvtUartTxDone) tx_busy = false;
         if(events & WorkerEvtTxStop) break;
-        if(events & WorkerEvtCdcRx) {
-            furi_check(furi_mutex_acquire(usb_uart->usb_mutex, FuriWaitForever) == FuriStatusOk);
-            size_t len = furi_hal_cdc_receive(usb_uart->cfg.vcp_ch, data, USB_CDC_PKT_LEN);
-            furi_check(furi_mutex_release(usb_uart->usb_mutex) == FuriStatusOk);
-
-            if(len > 0) {
-                usb_uart->st.tx_cnt += len;
-                furi_hal_uart_tx(usb_uart->cfg.uart_ch, data, len);
+
+        while(true) {
+            if(pending == 0) {
+                furi_check(
+                    furi_mutex_acquire(usb_uart->usb_mutex, FuriWaitForever) == FuriStatusOk);
+                pending =
+                    furi_hal_cdc_receive(usb_uart->cfg.vcp_ch, data[fill], USB_CDC_PKT_LEN);
+                furi_check(furi_mutex_release(usb_uart->usb_mutex) == FuriStatusOk);
             }
+            if(pending == 0 || tx_busy) break;
+
+            usb_uart->st.tx_cnt += pending;
+            tx_busy = true;
+            furi_check(furi_hal_uart_dma_tx(
+                usb_uart->cfg.uart_ch, data[fill], pending, usb_uart_on_tx_done_cb, usb_uart));
+            fill ^= 1;
+            pending = 0;
         }
     }
+
+    // Buffers are on stack, DMA must be done with them
+    while(tx_busy) {
+        uint32_t events =
+            furi_thread_flags_wait(WorkerEvtUartTxDone, FuriFlagWaitAny, FuriWaitForever);
+        furi_check(!(events & FuriFlagError));
+        tx_busy = false;
+    }
     return 0;
 }
 
@@ -340,6 +375,7 @@ UsbUartBridge* usb_uart_enable(UsbUartConfig* cfg) {
     memcpy(&(usb_uart->cfg_new), cfg, sizeof(UsbUartConfig));
 
     usb_uart->thread = furi_thread_alloc_ex("UsbUartWorker", 1024, usb_uart_worker, usb_uart);
+    furi_thread_set_priority(usb_uart->thread, FuriThreadPriorityHigh);
 
     furi_thread_start(usb_uart->thread);
     return usb_uart;
@@ -340,7 +340,8 @@ void infrared_tx_start(InfraredApp* infrared) {
         return;
     }
 
-    if(infrared_signal_is_raw(infrared->current_signal)) {
+    const bool is_raw = infrared_signal_is_raw(infrared->current_signal);
+    if(is_raw) {
         const InfraredRawSignal* raw = infrared_signal_get_raw_signal(infrared->current_signal);
         infrared_worker_set_raw_signal(
             infrared->worker, raw->timings, raw->timings_size, raw->frequency, raw->duty_cycle);
@@ -352,6 +353,8 @@ void infrared_tx_start(InfraredApp* infrared) {
     dolphin_deed(DolphinDeedIrSend);
     infrared_play_notification_message(infrared, InfraredNotificationMessageBlinkStartSend);
 
+    // Dense raw signals may outrun worker thread, so their timings are pre-rendered
+    infrared_worker_tx_enable_prerender(infrared->worker, is_raw);
     infrared_worker_tx_set_get_signal_callback(
         infrared->worker, infrared_worker_tx_get_signal_steady_callback, infrared);
     infrared_worker_tx_start(infrared->worker);
@@ -2,15 +2,51 @@
 
 #include <stdlib.h>
 #include <m-dict.h>
+#include <m-array.h>
+#include <storage/storage.h>
 #include <flipper_format/flipper_format.h>
+#include <flipper_format/flipper_format_i.h>
+#include <infrared_transmit.h>
 
 #include "infrared_signal.h"
 
+// Raw timings kept in RAM across all cached signals, the rest is streamed from file
+#define INFRARED_BRUTE_FORCE_CACHE_TIMINGS_MAX (2048U)
+
+// Index sidecar is stored next to the database file
+#define INFRARED_BRUTE_FORCE_INDEX_EXTENSION ".idx"
+#define INFRARED_BRUTE_FORCE_INDEX_MAGIC (0x58495249U) // "IRIX"
+#define INFRARED_BRUTE_FORCE_INDEX_VERSION (1U)
+
 typedef struct {
     uint32_t index;
     uint32_t count;
+    // Database file offsets of each signal, a signal is read starting from its offset
+    uint32_t* offsets;
 } InfraredBruteForceRecord;
 
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    // Database file this index was built for
+    uint32_t db_size;
+    uint32_t db_timestamp;
+    uint32_t name_count;
+} InfraredBruteForceIndexHeader;
+
+/* Index file layout: header, then name_count entries each made of
+ * uint8_t name_size, name_size bytes of name, uint32_t count, count uint32_t offsets.
+ */
+
+ARRAY_DEF(InfraredBruteForceOffsetArray, uint32_t, M_POD_OPLIST);
+
+DICT_DEF2(
+    InfraredBruteForceOffsetDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    InfraredBruteForceOffsetArray_t,
+    ARRAY_OPLIST(InfraredBruteForceOffsetArray, M_POD_OPLIST));
+
 DICT_DEF2(
     InfraredBruteForceRecordDict,
     FuriString*,
@@ -18,28 +54,332 @@ DICT_DEF2(
     InfraredBruteForceRecord,
     M_POD_OPLIST);
 
+typedef struct {
+    bool is_raw;
+    union {
+        InfraredMessage message;
+        InfraredRawSignal raw;
+    } payload;
+} InfraredBruteForceSignal;
+
+ARRAY_DEF(InfraredBruteForceSignalArray, InfraredBruteForceSignal, M_POD_OPLIST);
+
+typedef struct {
+    InfraredBruteForceSignalArray_t signals;
+    // Next signal to be sent, signals past the cached ones are read from the file
+    size_t position;
+    // Record the cache was built for
+    uint32_t index;
+    bool is_valid;
+    bool is_complete;
+} InfraredBruteForceCache;
+
 struct InfraredBruteForce {
     FlipperFormat* ff;
     const char* db_filename;
     FuriString* current_record_name;
     InfraredSignal* current_signal;
+    const InfraredBruteForceRecord* current_record;
     InfraredBruteForceRecordDict_t records;
+    InfraredBruteForceCache cache;
     bool is_started;
 };
 
+static void infrared_brute_force_cache_reset(InfraredBruteForceCache* cache) {
+    InfraredBruteForceSignalArray_it_t it;
+    for(InfraredBruteForceSignalArray_it(it, cache->signals);
+        !InfraredBruteForceSignalArray_end_p(it);
+        InfraredBruteForceSignalArray_next(it)) {
+        const InfraredBruteForceSignal* signal = InfraredBruteForceSignalArray_cref(it);
+        if(signal->is_raw) free(signal->payload.raw.timings);
+    }
+    InfraredBruteForceSignalArray_reset(cache->signals);
+    cache->position = 0;
+    cache->is_valid = false;
+    cache->is_complete = false;
+}
+
+/**
+ * Pre-read signals of the current record, so that they can be sent without touching the file.
+ * Once the timings budget is spent the rest of signals are streamed from the file as before.
+ */
+static bool infrared_brute_force_read_signal(InfraredBruteForce* brute_force, size_t position) {
+    const InfraredBruteForceRecord* record = brute_force->current_record;
+    if(position >= record->count) return false;
+
+    // Offsets save parsing all the other signals in between
+    return stream_seek(
+               flipper_format_get_raw_stream(brute_force->ff),
+               record->offsets[position],
+               StreamOffsetFromStart) &&
+           infrared_signal_search_by_name_and_read(
+               brute_force->current_signal,
+               brute_force->ff,
+               furi_string_get_cstr(brute_force->current_record_name));
+}
+
+static void infrared_brute_force_cache_fill(InfraredBruteForce* brute_force, uint32_t index) {
+    InfraredBruteForceCache* cache = &brute_force->cache;
+    const uint32_t record_count = brute_force->current_record->count;
+    size_t timings_total = 0;
+
+    infrared_brute_force_cache_reset(cache);
+    InfraredBruteForceSignalArray_reserve(cache->signals, record_count);
+
+    while(timings_total < INFRARED_BRUTE_FORCE_CACHE_TIMINGS_MAX &&
+          infrared_brute_force_read_signal(
+              brute_force, InfraredBruteForceSignalArray_size(cache->signals))) {
+        InfraredBruteForceSignal* signal = InfraredBruteForceSignalArray_push_new(cache->signals);
+        signal->is_raw = infrared_signal_is_raw(brute_force->current_signal);
+
+        if(signal->is_raw) {
+            const InfraredRawSignal* raw =
+                infrared_signal_get_raw_signal(brute_force->current_signal);
+            signal->payload.raw = *raw;
+            signal->payload.raw.timings = malloc(raw->timings_size * sizeof(uint32_t));
+            memcpy(
+                signal->payload.raw.timings, raw->timings, raw->timings_size * sizeof(uint32_t));
+            timings_total += raw->timings_size;
+        } else {
+            signal->payload.message = *infrared_signal_get_message(brute_force->current_signal);
+        }
+    }
+
+    cache->index = index;
+    cache->is_valid = true;
+    cache->is_complete = InfraredBruteForceSignalArray_size(cache->signals) == record_count;
+}
+
+static void infrared_brute_force_cache_transmit(const InfraredBruteForceSignal* signal) {
+    if(signal->is_raw) {
+        const InfraredRawSignal* raw = &signal->payload.raw;
+        infrared_send_raw_ext(
+            raw->timings, raw->timings_size, true, raw->frequency, raw->duty_cycle);
+    } else {
+        infrared_send(&signal->payload.message, 1);
+    }
+}
+
+static void infrared_brute_force_get_index_path(const char* db_filename, FuriString* path) {
+    furi_string_printf(path, "%s" INFRARED_BRUTE_FORCE_INDEX_EXTENSION, db_filename);
+}
+
+static bool infrared_brute_force_get_db_info(
+    Storage* storage,
+    const char* db_filename,
+    InfraredBruteForceIndexHeader* header) {
+    FileInfo fileinfo;
+    bool success = (storage_common_stat(storage, db_filename, &fileinfo) == FSE_OK) &&
+                   (storage_common_timestamp(storage, db_filename, &header->db_timestamp) ==
+                    FSE_OK);
+
+    header->magic = INFRARED_BRUTE_FORCE_INDEX_MAGIC;
+    header->version = INFRARED_BRUTE_FORCE_INDEX_VERSION;
+    header->db_size = fileinfo.size;
+    header->name_count = 0;
+
+    return success;
+}
+
+static void infrared_brute_force_index_set_record(
+    InfraredBruteForceRecord* record,
+    const uint32_t* offsets,
+    uint32_t count) {
+    free(record->offsets);
+    record->offsets = malloc(count * sizeof(uint32_t));
+    memcpy(record->offsets, offsets, count * sizeof(uint32_t));
+    record->count = count;
+}
+
+/**
+ * Load signal counts and offsets from the index sidecar.
+ * Fails if the index is missing or the database file changed since it was built.
+ */
+static bool infrared_brute_force_index_load(InfraredBruteForce* brute_force, Storage* storage) {
+    InfraredBruteForceIndexHeader expected, header;
+    FuriString* path = furi_string_alloc();
+    FuriString* name = furi_string_alloc();
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    infrared_brute_force_get_index_path(brute_force->db_filename, path);
+
+    do {
+        if(!infrared_brute_force_get_db_info(storage, brute_force->db_filename, &expected)) break;
+        if(!storage_file_open(
+               file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != expected.magic || header.version != expected.version ||
+           header.db_size != expected.db_size || header.db_timestamp != expected.db_timestamp) {
+            break;
+        }
+
+        uint32_t i;
+        for(i = 0; i < header.name_count; ++i) {
+            char name_buf[UINT8_MAX + 1];
+            uint8_t name_size;
+            uint32_t count;
+
+            if(storage_file_read(file, &name_size, sizeof(name_size)) != sizeof(name_size)) break;
+            if(storage_file_read(file, name_buf, name_size) != name_size) break;
+            if(storage_file_read(file, &count, sizeof(count)) != sizeof(count)) break;
+            name_buf[name_size] = '\0';
+            furi_string_set(name, name_buf);
+
+            const size_t offsets_size = count * sizeof(uint32_t);
+            InfraredBruteForceRecord* record =
+                InfraredBruteForceRecordDict_get(brute_force->records, name);
+
+            if(record) {
+                record->offsets = realloc(record->offsets, offsets_size); //-V701
+                record->count = count;
+                if(storage_file_read(file, record->offsets, offsets_size) != offsets_size) break;
+            } else if(!storage_file_seek(file, storage_file_tell(file) + offsets_size, true)) {
+                break;
+            }
+        }
+
+        success = (i == header.name_count);
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_string_free(name);
+    furi_string_free(path);
+    return success;
+}
+
+static void infrared_brute_force_index_save(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    InfraredBruteForceOffsetDict_t offset_dict) {
+    InfraredBruteForceIndexHeader header;
+    FuriString* path = furi_string_alloc();
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    infrared_brute_force_get_index_path(brute_force->db_filename, path);
+
+    do {
+        if(!infrared_brute_force_get_db_info(storage, brute_force->db_filename, &header)) break;
+        header.name_count = InfraredBruteForceOffsetDict_size(offset_dict);
+        if(!storage_file_open(
+               file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            break;
+        }
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        InfraredBruteForceOffsetDict_it_t it;
+        for(InfraredBruteForceOffsetDict_it(it, offset_dict);
+            !InfraredBruteForceOffsetDict_end_p(it);
+            InfraredBruteForceOffsetDict_next(it)) {
+            const InfraredBruteForceOffsetDict_itref_t* item =
+                InfraredBruteForceOffsetDict_cref(it);
+            const uint8_t name_size = MIN(furi_string_size(item->key), UINT8_MAX);
+            const uint32_t count = InfraredBruteForceOffsetArray_size(item->value);
+            const size_t offsets_size = count * sizeof(uint32_t);
+
+            if(storage_file_write(file, &name_size, sizeof(name_size)) != sizeof(name_size) ||
+               storage_file_write(file, furi_string_get_cstr(item->key), name_size) !=
+                   name_size ||
+               storage_file_write(file, &count, sizeof(count)) != sizeof(count) ||
+               storage_file_write(
+                   file, InfraredBruteForceOffsetArray_cget(item->value, 0), offsets_size) !=
+                   offsets_size) {
+                break;
+            }
+        }
+
+        success = InfraredBruteForceOffsetDict_end_p(it);
+    } while(false);
+
+    storage_file_close(file);
+    // Incomplete index would fail validation only by chance, better have none
+    if(!success) storage_simply_remove(storage, furi_string_get_cstr(path));
+
+    storage_file_free(file);
+    furi_string_free(path);
+}
+
+/**
+ * Scan the whole database file for signal offsets of every name and save them as an index.
+ */
+static bool infrared_brute_force_index_build(InfraredBruteForce* brute_force, Storage* storage) {
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    InfraredBruteForceOffsetDict_t offset_dict;
+    InfraredBruteForceOffsetDict_init(offset_dict);
+
+    bool success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
+    if(success) {
+        Stream* stream = flipper_format_get_raw_stream(ff);
+        FuriString* signal_name;
+        signal_name = furi_string_alloc();
+
+        // Lookup of the next name starts from the end of the previous signal
+        for(uint32_t offset = stream_tell(stream);
+            flipper_format_read_string(ff, "name", signal_name);
+            offset = stream_tell(stream)) {
+            InfraredBruteForceOffsetArray_push_back(
+                *InfraredBruteForceOffsetDict_safe_get(offset_dict, signal_name), offset);
+        }
+        furi_string_free(signal_name);
+
+        infrared_brute_force_index_save(brute_force, storage, offset_dict);
+
+        InfraredBruteForceRecordDict_it_t it;
+        for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+            !InfraredBruteForceRecordDict_end_p(it);
+            InfraredBruteForceRecordDict_next(it)) {
+            InfraredBruteForceRecordDict_itref_t* record = InfraredBruteForceRecordDict_ref(it);
+            InfraredBruteForceOffsetArray_t* offsets =
+                InfraredBruteForceOffsetDict_get(offset_dict, record->key);
+            if(offsets) {
+                infrared_brute_force_index_set_record(
+                    &record->value,
+                    InfraredBruteForceOffsetArray_cget(*offsets, 0),
+                    InfraredBruteForceOffsetArray_size(*offsets));
+            }
+        }
+    }
+
+    InfraredBruteForceOffsetDict_clear(offset_dict);
+    flipper_format_free(ff);
+    return success;
+}
+
+static void infrared_brute_force_records_clear_offsets(InfraredBruteForce* brute_force) {
+    InfraredBruteForceRecordDict_it_t it;
+    for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+        !InfraredBruteForceRecordDict_end_p(it);
+        InfraredBruteForceRecordDict_next(it)) {
+        InfraredBruteForceRecord* record = &InfraredBruteForceRecordDict_ref(it)->value;
+        free(record->offsets);
+        record->offsets = NULL;
+        record->count = 0;
+    }
+}
+
 InfraredBruteForce* infrared_brute_force_alloc() {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
     brute_force->ff = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->current_record = NULL;
     brute_force->is_started = false;
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
+    InfraredBruteForceSignalArray_init(brute_force->cache.signals);
+    infrared_brute_force_cache_reset(&brute_force->cache);
     return brute_force;
 }
 
 void infrared_brute_force_free(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
+    infrared_brute_force_cache_reset(&brute_force->cache);
+    InfraredBruteForceSignalArray_clear(brute_force->cache.signals);
+    infrared_brute_force_records_clear_offsets(brute_force);
     InfraredBruteForceRecordDict_clear(brute_force->records);
     furi_string_free(brute_force->current_record_name);
     free(brute_force);
@@ -47,32 +387,25 @@ void infrared_brute_force_free(InfraredBruteForce* brute_force) {
 
 void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const char* db_filename) {
     furi_assert(!brute_force->is_started);
+    infrared_brute_force_cache_reset(&brute_force->cache);
     brute_force->db_filename = db_filename;
 }
 
 bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     furi_assert(brute_force->db_filename);
-    bool success = false;
+
+    infrared_brute_force_cache_reset(&brute_force->cache);
+    infrared_brute_force_records_clear_offsets(brute_force);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
 
-    success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
-    if(success) {
-        FuriString* signal_name;
-        signal_name = furi_string_alloc();
-        while(flipper_format_read_string(ff, "name", signal_name)) {
-            InfraredBruteForceRecord* record =
-                InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
-            if(record) { //-V547
-                ++(record->count);
-            }
-        }
-        furi_string_free(signal_name);
+    bool success = infrared_brute_force_index_load(brute_force, storage);
+    if(!success) {
+        infrared_brute_force_records_clear_offsets(brute_force);
+        success = infrared_brute_force_index_build(brute_force, storage);
     }
 
-    flipper_format_free(ff);
     furi_record_close(RECORD_STORAGE);
     return success;
 }
@@ -94,18 +427,33 @@ bool infrared_brute_force_start(
             *record_count = record->value.count;
             if(*record_count) {
                 furi_string_set(brute_force->current_record_name, record->key);
+                brute_force->current_record = &record->value;
             }
             break;
         }
     }
 
     if(*record_count) {
+        InfraredBruteForceCache* cache = &brute_force->cache;
+        const bool is_cached = cache->is_valid && (cache->index == index);
+
         Storage* storage = furi_record_open(RECORD_STORAGE);
-        brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
         brute_force->is_started = true;
-        success =
-            flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
+        cache->position = 0;
+
+        if(is_cached && cache->is_complete) {
+            // Everything is in RAM, no need to open the file at all
+            success = true;
+        } else {
+            brute_force->ff = flipper_format_buffered_file_alloc(storage);
+            success = flipper_format_buffered_file_open_existing(
+                brute_force->ff, brute_force->db_filename);
+            if(success && !is_cached) {
+                infrared_brute_force_cache_fill(brute_force, index);
+            }
+        }
+
         if(!success) infrared_brute_force_stop(brute_force);
     }
     return success;
@@ -119,8 +467,9 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->ff) flipper_format_free(brute_force->ff);
     brute_force->current_signal = NULL;
+    brute_force->current_record = NULL;
     brute_force->ff = NULL;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
@@ -128,10 +477,17 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
 
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_by_name_and_read(
-        brute_force->current_signal,
-        brute_force->ff,
-        furi_string_get_cstr(brute_force->current_record_name));
+    InfraredBruteForceCache* cache = &brute_force->cache;
+
+    if(cache->position < InfraredBruteForceSignalArray_size(cache->signals)) {
+        infrared_brute_force_cache_transmit(
+            InfraredBruteForceSignalArray_cget(cache->signals, cache->position++));
+        return true;
+    } else if(!brute_force->ff) {
+        return false;
+    }
+
+    const bool success = infrared_brute_force_read_signal(brute_force, cache->position++);
     if(success) {
         infrared_signal_transmit(brute_force->current_signal);
     }
@@ -142,14 +498,18 @@ void infrared_brute_force_add_record(
     InfraredBruteForce* brute_force,
     uint32_t index,
     const char* name) {
-    InfraredBruteForceRecord value = {.index = index, .count = 0};
+    InfraredBruteForceRecord value = {.index = index, .count = 0, .offsets = NULL};
     FuriString* key;
     key = furi_string_alloc_set(name);
+    InfraredBruteForceRecord* record = InfraredBruteForceRecordDict_get(brute_force->records, key);
+    if(record) free(record->offsets);
     InfraredBruteForceRecordDict_set_at(brute_force->records, key, value);
     furi_string_free(key);
 }
 
 void infrared_brute_force_reset(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
+    infrared_brute_force_cache_reset(&brute_force->cache);
+    infrared_brute_force_records_clear_offsets(brute_force);
     InfraredBruteForceRecordDict_reset(brute_force->records);
 }
@@ -44,6 +44,9 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
  * This function must be called each time after setting the database via
  * a infrared_brute_force_set_db_filename() call.
  *
+ * Signal offsets are taken from the "<db_filename>.idx" index file when it matches
+ * the database size and timestamp, otherwise the database is scanned and the index is rebuilt.
+ *
  * @param[in,out] brute_force pointer to the instance to be updated.
  * @returns true on success, false otherwise.
  */
@@ -52,6 +55,9 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force);
 /**
  * @brief Start transmitting signals from a category stored in an InfraredBruteForce's instance dictionary.
  *
+ * Signals of the category are read into RAM on first start and reused while the same
+ * category is started again, until the instance is reset or the database is changed.
+ *
  * @param[in,out] brute_force pointer to the instance to be started.
  * @param[in] index index of the signal category in the dictionary.
  * @returns true on success, false otherwise.
@@ -5,6 +5,7 @@
 #include <toolbox/m_cstr_dup.h>
 #include <toolbox/path.h>
 #include <storage/storage.h>
+#include <flipper_format/flipper_format_i.h>
 
 #define TAG "InfraredRemote"
 
@@ -12,34 +13,21 @@
 #define INFRARED_FILE_VERSION (1)
 
 ARRAY_DEF(StringArray, const char*, M_CSTR_DUP_OPLIST); //-V575
+ARRAY_DEF(OffsetArray, uint32_t, M_POD_OPLIST);
 
 struct InfraredRemote {
     StringArray_t signal_names;
+    /* File offset of each signal's first line, followed by the file size.
+     * Signal i occupies [offsets[i], offsets[i + 1]) and is read or edited in place. */
+    OffsetArray_t signal_offsets;
     FuriString* name;
     FuriString* path;
 };
 
-typedef struct {
-    InfraredRemote* remote;
-    FlipperFormat* ff_in;
-    FlipperFormat* ff_out;
-    FuriString* signal_name;
-    InfraredSignal* signal;
-    size_t signal_index;
-} InfraredBatch;
-
-typedef struct {
-    size_t signal_index;
-    const char* signal_name;
-    const InfraredSignal* signal;
-} InfraredBatchTarget;
-
-typedef bool (
-    *InfraredBatchCallback)(const InfraredBatch* batch, const InfraredBatchTarget* target);
-
 InfraredRemote* infrared_remote_alloc() {
     InfraredRemote* remote = malloc(sizeof(InfraredRemote));
     StringArray_init(remote->signal_names);
+    OffsetArray_init(remote->signal_offsets);
     remote->name = furi_string_alloc();
     remote->path = furi_string_alloc();
     return remote;
@@ -47,6 +35,7 @@ InfraredRemote* infrared_remote_alloc() {
 
 void infrared_remote_free(InfraredRemote* remote) {
     StringArray_clear(remote->signal_names);
+    OffsetArray_clear(remote->signal_offsets);
     furi_string_free(remote->path);
     furi_string_free(remote->name);
     free(remote);
@@ -54,6 +43,7 @@ void infrared_remote_free(InfraredRemote* remote) {
 
 void infrared_remote_reset(InfraredRemote* remote) {
     StringArray_reset(remote->signal_names);
+    OffsetArray_reset(remote->signal_offsets);
     furi_string_reset(remote->name);
     furi_string_reset(remote->path);
 }
@@ -95,7 +85,9 @@ bool infrared_remote_load_signal(
         const char* path = furi_string_get_cstr(remote->path);
         if(!flipper_format_buffered_file_open_existing(ff, path)) break;
 
-        if(!infrared_signal_search_by_index_and_read(signal, ff, index)) {
+        const uint32_t offset = *OffsetArray_cget(remote->signal_offsets, index);
+        if(!stream_seek(flipper_format_get_raw_stream(ff), offset, StreamOffsetFromStart) ||
+           !infrared_signal_search_by_index_and_read(signal, ff, 0)) {
             const char* signal_name = infrared_remote_get_signal_name(remote, index);
             FURI_LOG_E(TAG, "Failed to load signal '%s' from file '%s'", signal_name, path);
             break;
@@ -143,6 +135,8 @@ bool infrared_remote_append_signal(
         if(!infrared_signal_save(signal, ff, name)) break;
 
         StringArray_push_back(remote->signal_names, name);
+        OffsetArray_push_back(
+            remote->signal_offsets, stream_size(flipper_format_get_raw_stream(ff)));
         success = true;
     } while(false);
 
@@ -152,86 +146,79 @@ bool infrared_remote_append_signal(
     return success;
 }
 
-static bool infrared_remote_batch_start(
-    InfraredRemote* remote,
-    InfraredBatchCallback batch_callback,
-    const InfraredBatchTarget* target) {
-    FuriString* tmp = furi_string_alloc();
-    Storage* storage = furi_record_open(RECORD_STORAGE);
+static bool infrared_remote_write_signal_callback(Stream* stream, const void* context) {
+    Stream* signal_stream = (Stream*)context;
+    const size_t signal_size = stream_size(signal_stream);
 
-    InfraredBatch batch_context = {
-        .remote = remote,
-        .ff_in = flipper_format_buffered_file_alloc(storage),
-        .ff_out = flipper_format_buffered_file_alloc(storage),
-        .signal_name = furi_string_alloc(),
-        .signal = infrared_signal_alloc(),
-        .signal_index = 0,
-    };
+    return stream_rewind(signal_stream) &&
+           (stream_copy(signal_stream, stream, signal_size) == signal_size);
+}
 
-    const char* path_in = furi_string_get_cstr(remote->path);
-    const char* path_out;
+/**
+ * Replace delete_count signals starting from index with the given signal, if any.
+ * Only the affected part of the file is changed, offsets of the following signals are shifted.
+ */
+static bool infrared_remote_edit(
+    InfraredRemote* remote,
+    size_t index,
+    size_t delete_count,
+    const InfraredSignal* signal,
+    const char* name) {
+    furi_assert(index + delete_count < OffsetArray_size(remote->signal_offsets));
 
-    FS_Error status;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    FlipperFormat* ff_signal = flipper_format_string_alloc();
 
-    do {
-        furi_string_printf(tmp, "%s.temp%08x.swp", path_in, rand());
-        path_out = furi_string_get_cstr(tmp);
-        status = storage_common_stat(storage, path_out, NULL);
-    } while(status == FSE_OK || status == FSE_EXIST);
+    const uint32_t offset = *OffsetArray_cget(remote->signal_offsets, index);
+    const uint32_t delete_size =
+        *OffsetArray_cget(remote->signal_offsets, index + delete_count) - offset;
+    const size_t insert_count = signal ? 1 : 0;
+    uint32_t insert_size = 0;
 
     bool success = false;
 
     do {
-        if(!flipper_format_buffered_file_open_existing(batch_context.ff_in, path_in)) break;
-        if(!flipper_format_buffered_file_open_always(batch_context.ff_out, path_out)) break;
-        if(!flipper_format_write_header_cstr(
-               batch_context.ff_out, INFRARED_FILE_HEADER, INFRARED_FILE_VERSION))
-            break;
-
-        const size_t signal_count = infrared_remote_get_signal_count(remote);
-
-        for(; batch_context.signal_index < signal_count; ++batch_context.signal_index) {
-            if(!infrared_signal_read(
-                   batch_context.signal, batch_context.ff_in, batch_context.signal_name))
-                break;
-            if(!batch_callback(&batch_context, target)) break;
+        if(signal) {
+            if(!infrared_signal_save(signal, ff_signal, name)) break;
+            insert_size = stream_size(flipper_format_get_raw_stream(ff_signal));
         }
 
-        if(batch_context.signal_index != signal_count) break;
+        if(!flipper_format_file_open_existing(ff, furi_string_get_cstr(remote->path))) break;
 
-        if(!flipper_format_buffered_file_close(batch_context.ff_out)) break;
-        if(!flipper_format_buffered_file_close(batch_context.ff_in)) break;
+        Stream* stream = flipper_format_get_raw_stream(ff);
+        if(!stream_seek(stream, offset, StreamOffsetFromStart)) break;
+        if(!stream_delete_and_insert(
+               stream,
+               delete_size,
+               signal ? infrared_remote_write_signal_callback : NULL,
+               flipper_format_get_raw_stream(ff_signal))) {
+            break;
+        }
 
-        const FS_Error status = storage_common_rename(storage, path_out, path_in);
-        success = (status == FSE_OK || status == FSE_EXIST);
+        success = true;
     } while(false);
 
-    infrared_signal_free(batch_context.signal);
-    furi_string_free(batch_context.signal_name);
-    flipper_format_free(batch_context.ff_out);
-    flipper_format_free(batch_context.ff_in);
-    furi_string_free(tmp);
+    if(success) {
+        const size_t offset_count = OffsetArray_size(remote->signal_offsets);
+        for(size_t i = index + delete_count; i < offset_count; ++i) {
+            *OffsetArray_get(remote->signal_offsets, i) += insert_size - delete_size;
+        }
+
+        if(insert_count > delete_count) {
+            OffsetArray_push_at(remote->signal_offsets, index, offset);
+        } else if(insert_count < delete_count) {
+            OffsetArray_remove_v(remote->signal_offsets, index + 1, index + 1 + delete_count);
+        }
+    }
 
+    flipper_format_free(ff_signal);
+    flipper_format_free(ff);
     furi_record_close(RECORD_STORAGE);
 
     return success;
 }
 
-static bool infrared_remote_insert_signal_callback(
-    const InfraredBatch* batch,
-    const InfraredBatchTarget* target) {
-    // Insert a signal under the specified index
-    if(batch->signal_index == target->signal_index) {
-        if(!infrared_signal_save(target->signal, batch->ff_out, target->signal_name)) return false;
-        StringArray_push_at(
-            batch->remote->signal_names, target->signal_index, target->signal_name);
-    }
-
-    // Write the rest normally
-    return infrared_signal_save(
-        batch->signal, batch->ff_out, furi_string_get_cstr(batch->signal_name));
-}
-
 bool infrared_remote_insert_signal(
     InfraredRemote* remote,
     const InfraredSignal* signal,
@@ -241,73 +228,39 @@ bool infrared_remote_insert_signal(
         return infrared_remote_append_signal(remote, signal, name);
     }
 
-    const InfraredBatchTarget insert_target = {
-        .signal_index = index,
-        .signal_name = name,
-        .signal = signal,
-    };
-
-    return infrared_remote_batch_start(
-        remote, infrared_remote_insert_signal_callback, &insert_target);
-}
-
-static bool infrared_remote_rename_signal_callback(
-    const InfraredBatch* batch,
-    const InfraredBatchTarget* target) {
-    const char* signal_name;
-
-    if(batch->signal_index == target->signal_index) {
-        // Rename the signal at requested index
-        signal_name = target->signal_name;
-        StringArray_set_at(batch->remote->signal_names, batch->signal_index, signal_name);
-    } else {
-        // Use the original name otherwise
-        signal_name = furi_string_get_cstr(batch->signal_name);
+    const bool success = infrared_remote_edit(remote, index, 0, signal, name);
+    if(success) {
+        StringArray_push_at(remote->signal_names, index, name);
     }
 
-    return infrared_signal_save(batch->signal, batch->ff_out, signal_name);
+    return success;
 }
 
 bool infrared_remote_rename_signal(InfraredRemote* remote, size_t index, const char* new_name) {
     furi_assert(index < infrared_remote_get_signal_count(remote));
 
-    const InfraredBatchTarget rename_target = {
-        .signal_index = index,
-        .signal_name = new_name,
-        .signal = NULL,
-    };
-
-    return infrared_remote_batch_start(
-        remote, infrared_remote_rename_signal_callback, &rename_target);
-}
+    InfraredSignal* signal = infrared_signal_alloc();
 
-static bool infrared_remote_delete_signal_callback(
-    const InfraredBatch* batch,
-    const InfraredBatchTarget* target) {
-    if(batch->signal_index == target->signal_index) {
-        // Do not save the signal to be deleted, remove it from the signal name list instead
-        StringArray_remove_v(
-            batch->remote->signal_names, batch->signal_index, batch->signal_index + 1);
-    } else {
-        // Pass other signals through
-        return infrared_signal_save(
-            batch->signal, batch->ff_out, furi_string_get_cstr(batch->signal_name));
+    const bool success = infrared_remote_load_signal(remote, signal, index) &&
+                         infrared_remote_edit(remote, index, 1, signal, new_name);
+    if(success) {
+        StringArray_set_at(remote->signal_names, index, new_name);
     }
 
-    return true;
+    infrared_signal_free(signal);
+
+    return success;
 }
 
 bool infrared_remote_delete_signal(InfraredRemote* remote, size_t index) {
     furi_assert(index < infrared_remote_get_signal_count(remote));
 
-    const InfraredBatchTarget delete_target = {
-        .signal_index = index,
-        .signal_name = NULL,
-        .signal = NULL,
-    };
+    const bool success = infrared_remote_edit(remote, index, 1, NULL, NULL);
+    if(success) {
+        StringArray_remove_v(remote->signal_names, index, index + 1);
+    }
 
-    return infrared_remote_batch_start(
-        remote, infrared_remote_delete_signal_callback, &delete_target);
+    return success;
 }
 
 bool infrared_remote_move_signal(InfraredRemote* remote, size_t index, size_t new_index) {
@@ -352,6 +305,8 @@ bool infrared_remote_create(InfraredRemote* remote, const char* path) {
         if(!flipper_format_write_header_cstr(ff, INFRARED_FILE_HEADER, INFRARED_FILE_VERSION))
             break;
 
+        OffsetArray_push_back(
+            remote->signal_offsets, stream_size(flipper_format_get_raw_stream(ff)));
         success = true;
     } while(false);
 
@@ -381,11 +336,25 @@ bool infrared_remote_load(InfraredRemote* remote, const char* path) {
 
         infrared_remote_set_path(remote, path);
         StringArray_reset(remote->signal_names);
+        OffsetArray_reset(remote->signal_offsets);
+
+        Stream* stream = flipper_format_get_raw_stream(ff);
+
+        for(;;) {
+            // Previous value is read up to its line end, a signal starts on the next line
+            uint32_t offset = stream_tell(stream);
+            char c;
+            if(stream_read(stream, (uint8_t*)&c, 1) == 1 && c == '\n') ++offset;
+
+            if(!stream_seek(stream, offset, StreamOffsetFromStart)) break;
+            if(!infrared_signal_read_name(ff, tmp)) break;
 
-        while(infrared_signal_read_name(ff, tmp)) {
             StringArray_push_back(remote->signal_names, furi_string_get_cstr(tmp));
+            OffsetArray_push_back(remote->signal_offsets, offset);
         }
 
+        OffsetArray_push_back(remote->signal_offsets, stream_size(stream));
+
         success = true;
     } while(false);
 
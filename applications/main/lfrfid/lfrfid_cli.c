@@ -26,7 +26,8 @@ void lfrfid_on_system_start() {
 static void lfrfid_cli_print_usage() {
     printf("Usage:\r\n");
     printf("rfid read <optional: normal | indala>\r\n");
-    printf("rfid <write | emulate> <key_type> <key_data>\r\n");
+    printf("rfid write <key_type> <key_data> <optional: fast>\r\n");
+    printf("rfid emulate <key_type> <key_data>\r\n");
     printf("rfid raw_read <ask | psk> <filename>\r\n");
     printf("rfid raw_emulate <filename>\r\n");
     printf("rfid raw_analyze <filename>\r\n");
@@ -199,10 +200,25 @@ static void lfrfid_cli_write(Cli* cli, FuriString* args) {
         return;
     }
 
+    LFRFIDT5577Speed speed = LFRFIDT5577SpeedDefault;
+    FuriString* speed_string = furi_string_alloc();
+    if(args_read_string_and_trim(args, speed_string)) {
+        if(furi_string_cmp_str(speed_string, "fast") == 0) {
+            speed = LFRFIDT5577SpeedFast;
+        } else {
+            lfrfid_cli_print_usage();
+            furi_string_free(speed_string);
+            protocol_dict_free(dict);
+            return;
+        }
+    }
+    furi_string_free(speed_string);
+
     LFRFIDWorker* worker = lfrfid_worker_alloc(dict);
     FuriEventFlag* event = furi_event_flag_alloc();
 
     lfrfid_worker_start_thread(worker);
+    lfrfid_worker_set_write_speed(worker, speed);
     lfrfid_worker_write_start(worker, protocol, lfrfid_cli_write_callback, event);
 
     printf("Writing RFID...\r\nPress Ctrl+C to abort\r\n");
@@ -5,14 +5,25 @@
 
 #define NFC_APP_KEYS_EXTENSION ".keys"
 #define NFC_APP_KEY_CACHE_FOLDER "/ext/nfc/.cache"
+#define NFC_APP_HOT_KEYS_FILE_PATH NFC_APP_KEY_CACHE_FOLDER "/hot_keys.keys"
+
+#define MF_CLASSIC_KEY_CACHE_HOT_KEYS_MAX (64)
 
 static const char* mf_classic_key_cache_file_header = "Flipper NFC keys";
 static const uint32_t mf_classic_key_cache_file_version = 1;
 
+static const char* mf_classic_hot_keys_file_header = "Flipper NFC hot keys";
+static const uint32_t mf_classic_hot_keys_file_version = 1;
+
 struct MfClassicKeyCache {
     MfClassicDeviceKeys keys;
     MfClassicKeyType current_key_type;
     uint8_t current_sector;
+
+    // Keys found by dictionary attacks, sorted by number of sectors they opened
+    MfClassicKey hot_keys[MF_CLASSIC_KEY_CACHE_HOT_KEYS_MAX];
+    uint32_t hot_key_hits[MF_CLASSIC_KEY_CACHE_HOT_KEYS_MAX];
+    size_t hot_keys_count;
 };
 
 static void nfc_get_key_cache_file_path(const uint8_t* uid, size_t uid_len, FuriString* path) {
@@ -210,3 +221,159 @@ void mf_classic_key_cache_reset(MfClassicKeyCache* instance) {
     instance->keys.key_a_mask = 0;
     instance->keys.key_b_mask = 0;
 }
+
+bool mf_classic_key_cache_load_hot_keys(MfClassicKeyCache* instance) {
+    furi_assert(instance);
+
+    instance->hot_keys_count = 0;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+
+    FuriString* temp_str = furi_string_alloc();
+    bool load_success = false;
+    do {
+        if(!flipper_format_buffered_file_open_existing(ff, NFC_APP_HOT_KEYS_FILE_PATH)) break;
+
+        uint32_t version = 0;
+        if(!flipper_format_read_header(ff, temp_str, &version)) break;
+        if(furi_string_cmp_str(temp_str, mf_classic_hot_keys_file_header)) break;
+        if(version != mf_classic_hot_keys_file_version) break;
+
+        uint32_t count = 0;
+        if(!flipper_format_read_uint32(ff, "Key count", &count, 1)) break;
+        if(count > MF_CLASSIC_KEY_CACHE_HOT_KEYS_MAX) break;
+        if(count) {
+            if(!flipper_format_read_hex(
+                   ff, "Keys", instance->hot_keys[0].data, count * sizeof(MfClassicKey)))
+                break;
+            if(!flipper_format_read_uint32(ff, "Hits", instance->hot_key_hits, count)) break;
+        }
+        instance->hot_keys_count = count;
+        load_success = true;
+    } while(false);
+
+    flipper_format_buffered_file_close(ff);
+    flipper_format_free(ff);
+    furi_string_free(temp_str);
+    furi_record_close(RECORD_STORAGE);
+
+    return load_success;
+}
+
+bool mf_classic_key_cache_save_hot_keys(MfClassicKeyCache* instance) {
+    furi_assert(instance);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+
+    bool save_success = false;
+    do {
+        if(!storage_simply_mkdir(storage, NFC_APP_KEY_CACHE_FOLDER)) break;
+        if(!storage_simply_remove(storage, NFC_APP_HOT_KEYS_FILE_PATH)) break;
+        if(!flipper_format_buffered_file_open_always(ff, NFC_APP_HOT_KEYS_FILE_PATH)) break;
+
+        if(!flipper_format_write_header_cstr(
+               ff, mf_classic_hot_keys_file_header, mf_classic_hot_keys_file_version))
+            break;
+        uint32_t count = instance->hot_keys_count;
+        if(!flipper_format_write_uint32(ff, "Key count", &count, 1)) break;
+        if(count) {
+            if(!flipper_format_write_hex(
+                   ff, "Keys", instance->hot_keys[0].data, count * sizeof(MfClassicKey)))
+                break;
+            if(!flipper_format_write_uint32(ff, "Hits", instance->hot_key_hits, count)) break;
+        }
+        save_success = true;
+    } while(false);
+
+    flipper_format_free(ff);
+    furi_record_close(RECORD_STORAGE);
+
+    return save_success;
+}
+
+size_t mf_classic_key_cache_get_hot_keys_count(MfClassicKeyCache* instance) {
+    furi_assert(instance);
+
+    return instance->hot_keys_count;
+}
+
+bool mf_classic_key_cache_get_hot_key(
+    MfClassicKeyCache* instance,
+    size_t index,
+    MfClassicKey* key) {
+    furi_assert(instance);
+    furi_assert(key);
+
+    if(index >= instance->hot_keys_count) return false;
+    *key = instance->hot_keys[index];
+
+    return true;
+}
+
+bool mf_classic_key_cache_is_hot_key(MfClassicKeyCache* instance, const MfClassicKey* key) {
+    furi_assert(instance);
+    furi_assert(key);
+
+    bool key_found = false;
+    for(size_t i = 0; i < instance->hot_keys_count; i++) {
+        if(memcmp(instance->hot_keys[i].data, key->data, sizeof(MfClassicKey)) == 0) {
+            key_found = true;
+            break;
+        }
+    }
+
+    return key_found;
+}
+
+static void
+    mf_classic_key_cache_add_hot_key_hit(MfClassicKeyCache* instance, const MfClassicKey* key) {
+    size_t index = 0;
+    for(; index < instance->hot_keys_count; index++) {
+        if(memcmp(instance->hot_keys[index].data, key->data, sizeof(MfClassicKey)) == 0) break;
+    }
+
+    if(index == instance->hot_keys_count) {
+        // New key takes place of the least used one when table is full
+        if(instance->hot_keys_count < MF_CLASSIC_KEY_CACHE_HOT_KEYS_MAX) {
+            instance->hot_keys_count++;
+        } else {
+            index--;
+        }
+        instance->hot_keys[index] = *key;
+        instance->hot_key_hits[index] = 0;
+    }
+    instance->hot_key_hits[index]++;
+
+    // Keep table sorted, key can only move up
+    while(index > 0 && instance->hot_key_hits[index - 1] < instance->hot_key_hits[index]) {
+        MfClassicKey key_tmp = instance->hot_keys[index - 1];
+        uint32_t hits_tmp = instance->hot_key_hits[index - 1];
+        instance->hot_keys[index - 1] = instance->hot_keys[index];
+        instance->hot_key_hits[index - 1] = instance->hot_key_hits[index];
+        instance->hot_keys[index] = key_tmp;
+        instance->hot_key_hits[index] = hits_tmp;
+        index--;
+    }
+}
+
+void mf_classic_key_cache_add_hot_key_hits(
+    MfClassicKeyCache* instance,
+    const MfClassicData* data,
+    uint64_t key_a_mask,
+    uint64_t key_b_mask) {
+    furi_assert(instance);
+    furi_assert(data);
+
+    uint8_t sectors_total = mf_classic_get_total_sectors_num(data->type);
+    for(uint8_t i = 0; i < sectors_total; i++) {
+        MfClassicSectorTrailer* sec_tr = mf_classic_get_sector_trailer_by_sector(data, i);
+        if(FURI_BIT(data->key_a_mask, i) && FURI_BIT(key_a_mask, i)) {
+            mf_classic_key_cache_add_hot_key_hit(instance, &sec_tr->key_a);
+        }
+        if(FURI_BIT(data->key_b_mask, i) && FURI_BIT(key_b_mask, i)) {
+            mf_classic_key_cache_add_hot_key_hit(instance, &sec_tr->key_b);
+        }
+    }
+}
@@ -26,6 +26,25 @@ bool mf_classic_key_cache_save(MfClassicKeyCache* instance, const MfClassicData*
 
 void mf_classic_key_cache_reset(MfClassicKeyCache* instance);
 
+bool mf_classic_key_cache_load_hot_keys(MfClassicKeyCache* instance);
+
+bool mf_classic_key_cache_save_hot_keys(MfClassicKeyCache* instance);
+
+size_t mf_classic_key_cache_get_hot_keys_count(MfClassicKeyCache* instance);
+
+bool mf_classic_key_cache_get_hot_key(
+    MfClassicKeyCache* instance,
+    size_t index,
+    MfClassicKey* key);
+
+bool mf_classic_key_cache_is_hot_key(MfClassicKeyCache* instance, const MfClassicKey* key);
+
+void mf_classic_key_cache_add_hot_key_hits(
+    MfClassicKeyCache* instance,
+    const MfClassicData* data,
+    uint64_t key_a_mask,
+    uint64_t key_b_mask);
+
 #ifdef __cplusplus
 }
 #endif
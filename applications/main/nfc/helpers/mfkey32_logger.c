@@ -8,6 +8,30 @@
 
 #define MFKEY32_LOGGER_MAX_NONCES_SAVED (100)
 
+// Binary log format, mfkey32 app reads it as is
+#define MFKEY32_LOGGER_BIN_MAGIC (0x3233464DU) // "MF32"
+#define MFKEY32_LOGGER_BIN_VERSION (1U)
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t record_size;
+    uint16_t reserved;
+} Mfkey32LoggerBinHeader;
+
+typedef struct {
+    uint32_t cuid;
+    uint8_t sector_num;
+    uint8_t key_type;
+    uint16_t reserved;
+    uint32_t nt0;
+    uint32_t nr0;
+    uint32_t ar0;
+    uint32_t nt1;
+    uint32_t nr1;
+    uint32_t ar1;
+} Mfkey32LoggerBinRecord;
+
 typedef struct {
     bool is_filled;
     uint32_t cuid;
@@ -155,6 +179,64 @@ bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
     return params_saved;
 }
 
+bool mfkey32_logger_save_params_binary(Mfkey32Logger* instance, const char* path) {
+    furi_assert(instance);
+    furi_assert(path);
+    furi_assert(instance->params_collected > 0);
+    furi_assert(instance->params_arr);
+
+    bool params_saved = false;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = buffered_file_stream_alloc(storage);
+
+    do {
+        if(!buffered_file_stream_open(stream, path, FSAM_WRITE, FSOM_OPEN_APPEND)) break;
+
+        if(stream_size(stream) == 0) {
+            const Mfkey32LoggerBinHeader header = {
+                .magic = MFKEY32_LOGGER_BIN_MAGIC,
+                .version = MFKEY32_LOGGER_BIN_VERSION,
+                .record_size = sizeof(Mfkey32LoggerBinRecord),
+            };
+            if(stream_write(stream, (const uint8_t*)&header, sizeof(header)) != sizeof(header))
+                break;
+        }
+
+        bool params_write_success = true;
+        Mfkey32LoggerParams_it_t it;
+        for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
+            Mfkey32LoggerParams_next(it)) {
+            Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
+            if(!params->is_filled) continue;
+
+            const Mfkey32LoggerBinRecord record = {
+                .cuid = params->cuid,
+                .sector_num = params->sector_num,
+                .key_type = params->key_type,
+                .nt0 = params->nt0,
+                .nr0 = params->nr0,
+                .ar0 = params->ar0,
+                .nt1 = params->nt1,
+                .nr1 = params->nr1,
+                .ar1 = params->ar1,
+            };
+            if(stream_write(stream, (const uint8_t*)&record, sizeof(record)) != sizeof(record)) {
+                params_write_success = false;
+                break;
+            }
+        }
+        if(!params_write_success) break;
+
+        params_saved = true;
+    } while(false);
+
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+
+    return params_saved;
+}
+
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
     furi_assert(instance);
     furi_assert(str);
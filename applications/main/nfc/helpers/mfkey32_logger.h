@@ -18,6 +18,9 @@ size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance);
 
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path);
 
+/** Append collected params to binary log with fixed-size records, read by mfkey32 app */
+bool mfkey32_logger_save_params_binary(Mfkey32Logger* instance, const char* path);
+
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str);
 
 #ifdef __cplusplus
@@ -1,29 +1,33 @@
 #include "nfc_emv_parser.h"
 #include <flipper_format/flipper_format.h>
 
+// Longest key is a 16 byte AID in hex
+#define NFC_EMV_PARSER_KEY_SIZE (16 * 2 + 1)
+
 static const char* nfc_resources_header = "Flipper EMV resources";
 static const uint32_t nfc_resources_file_version = 1;
 
 static bool nfc_emv_parser_search_data(
     Storage* storage,
     const char* file_name,
-    FuriString* key,
+    const char* key,
     FuriString* data) {
     bool parsed = false;
-    FlipperFormat* file = flipper_format_file_alloc(storage);
+    // Resource files are large and searched sequentially, buffered reads are much faster
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
     FuriString* temp_str;
     temp_str = furi_string_alloc();
 
     do {
         // Open file
-        if(!flipper_format_file_open_existing(file, file_name)) break;
+        if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
         // Read file header and version
         uint32_t version = 0;
         if(!flipper_format_read_header(file, temp_str, &version)) break;
         if(furi_string_cmp_str(temp_str, nfc_resources_header) ||
            (version != nfc_resources_file_version))
             break;
-        if(!flipper_format_read_string(file, furi_string_get_cstr(key), data)) break;
+        if(!flipper_format_read_string(file, key, data)) break;
         parsed = true;
     } while(false);
 
@@ -38,45 +42,35 @@ bool nfc_emv_parser_get_aid_name(
     uint8_t aid_len,
     FuriString* aid_name) {
     furi_assert(storage);
-    bool parsed = false;
-    FuriString* key;
-    key = furi_string_alloc();
+    furi_assert(aid_len <= (NFC_EMV_PARSER_KEY_SIZE - 1) / 2);
+
+    char key[NFC_EMV_PARSER_KEY_SIZE];
     for(uint8_t i = 0; i < aid_len; i++) {
-        furi_string_cat_printf(key, "%02X", aid[i]);
-    }
-    if(nfc_emv_parser_search_data(storage, EXT_PATH("nfc/assets/aid.nfc"), key, aid_name)) {
-        parsed = true;
+        snprintf(&key[i * 2], sizeof(key) - i * 2, "%02X", aid[i]);
     }
-    furi_string_free(key);
-    return parsed;
+    key[aid_len * 2] = '\0';
+
+    return nfc_emv_parser_search_data(storage, EXT_PATH("nfc/assets/aid.nfc"), key, aid_name);
 }
 
 bool nfc_emv_parser_get_country_name(
     Storage* storage,
     uint16_t country_code,
     FuriString* country_name) {
-    bool parsed = false;
-    FuriString* key;
-    key = furi_string_alloc_printf("%04X", country_code);
-    if(nfc_emv_parser_search_data(
-           storage, EXT_PATH("nfc/assets/country_code.nfc"), key, country_name)) {
-        parsed = true;
-    }
-    furi_string_free(key);
-    return parsed;
+    char key[NFC_EMV_PARSER_KEY_SIZE];
+    snprintf(key, sizeof(key), "%04X", country_code);
+
+    return nfc_emv_parser_search_data(
+        storage, EXT_PATH("nfc/assets/country_code.nfc"), key, country_name);
 }
 
 bool nfc_emv_parser_get_currency_name(
     Storage* storage,
     uint16_t currency_code,
     FuriString* currency_name) {
-    bool parsed = false;
-    FuriString* key;
-    key = furi_string_alloc_printf("%04X", currency_code);
-    if(nfc_emv_parser_search_data(
-           storage, EXT_PATH("nfc/assets/currency_code.nfc"), key, currency_name)) {
-        parsed = true;
-    }
-    furi_string_free(key);
-    return parsed;
+    char key[NFC_EMV_PARSER_KEY_SIZE];
+    snprintf(key, sizeof(key), "%04X", currency_code);
+
+    return nfc_emv_parser_search_data(
+        storage, EXT_PATH("nfc/assets/currency_code.nfc"), key, currency_name);
 }
@@ -7,18 +7,53 @@
 
 #include <furi.h>
 #include <path.h>
+#include <toolbox/saved_struct.h>
 
 #define TAG "NfcSupportedCards"
 
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+#define NFC_SUPPORTED_CARDS_INDEX_PATH APP_DATA_PATH(".supported_cards.idx")
+#define NFC_SUPPORTED_CARDS_INDEX_MAGIC (0x4E)
+#define NFC_SUPPORTED_CARDS_INDEX_VERSION (1)
+#define NFC_SUPPORTED_CARDS_INDEX_SIZE (32)
+#define NFC_SUPPORTED_CARDS_INDEX_NAME_SIZE (32)
+
+typedef enum {
+    NfcSupportedCardsFeatureRead = (1U << 0),
+    NfcSupportedCardsFeatureParse = (1U << 1),
+} NfcSupportedCardsFeature;
+
+/**
+ * Plugin properties learned on its first load, so that plugins for other
+ * protocols are skipped without loading them from SD card.
+ * Entry is valid while plugin file size and timestamp match.
+ */
+typedef struct {
+    char file_name[NFC_SUPPORTED_CARDS_INDEX_NAME_SIZE];
+    uint32_t file_size;
+    uint32_t timestamp;
+    uint8_t protocol; /**< NfcProtocolInvalid if file is not a compatible plugin. */
+    uint8_t features;
+} NfcSupportedCardsIndexEntry;
+
+typedef struct {
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint32_t count;
+    NfcSupportedCardsIndexEntry entries[NFC_SUPPORTED_CARDS_INDEX_SIZE];
+} NfcSupportedCardsIndex;
+
 typedef struct {
     Storage* storage;
     File* directory;
     FuriString* file_path;
     char file_name[256];
     FlipperApplication* app;
+
+    NfcSupportedCardsIndex index;
+    bool index_changed;
 } NfcSupportedCards;
 
 static NfcSupportedCards* nfc_supported_cards_alloc() {
@@ -28,6 +63,21 @@ static NfcSupportedCards* nfc_supported_cards_alloc() {
     instance->directory = storage_file_alloc(instance->storage);
     instance->file_path = furi_string_alloc();
 
+    const ElfApiInterface* api = firmware_api_interface;
+    if(!saved_struct_load(
+           NFC_SUPPORTED_CARDS_INDEX_PATH,
+           &instance->index,
+           sizeof(NfcSupportedCardsIndex),
+           NFC_SUPPORTED_CARDS_INDEX_MAGIC,
+           NFC_SUPPORTED_CARDS_INDEX_VERSION) ||
+       (instance->index.api_version_major != api->api_version_major) ||
+       (instance->index.api_version_minor != api->api_version_minor) ||
+       (instance->index.count > NFC_SUPPORTED_CARDS_INDEX_SIZE)) {
+        memset(&instance->index, 0, sizeof(NfcSupportedCardsIndex));
+        instance->index.api_version_major = api->api_version_major;
+        instance->index.api_version_minor = api->api_version_minor;
+    }
+
     if(!storage_dir_open(instance->directory, NFC_SUPPORTED_CARDS_PLUGINS_PATH)) {
         FURI_LOG_D(TAG, "Failed to open directory: %s", NFC_SUPPORTED_CARDS_PLUGINS_PATH);
     }
@@ -40,6 +90,15 @@ static void nfc_supported_cards_free(NfcSupportedCards* instance) {
         flipper_application_free(instance->app);
     }
 
+    if(instance->index_changed) {
+        saved_struct_save(
+            NFC_SUPPORTED_CARDS_INDEX_PATH,
+            &instance->index,
+            sizeof(NfcSupportedCardsIndex),
+            NFC_SUPPORTED_CARDS_INDEX_MAGIC,
+            NFC_SUPPORTED_CARDS_INDEX_VERSION);
+    }
+
     furi_string_free(instance->file_path);
 
     storage_dir_close(instance->directory);
@@ -49,42 +108,119 @@ static void nfc_supported_cards_free(NfcSupportedCards* instance) {
     free(instance);
 }
 
-static const NfcSupportedCardsPlugin*
-    nfc_supported_cards_get_next_plugin(NfcSupportedCards* instance) {
-    const NfcSupportedCardsPlugin* plugin = NULL;
-
-    do {
-        if(!storage_file_is_open(instance->directory)) break;
-        if(!storage_dir_read(
-               instance->directory, NULL, instance->file_name, sizeof(instance->file_name)))
+static NfcSupportedCardsIndexEntry* nfc_supported_cards_index_find(
+    NfcSupportedCards* instance,
+    const char* file_name,
+    bool allocate) {
+    NfcSupportedCardsIndexEntry* entry = NULL;
+    NfcSupportedCardsIndex* index = &instance->index;
+
+    for(size_t i = 0; i < index->count; i++) {
+        if(strncmp(index->entries[i].file_name, file_name, NFC_SUPPORTED_CARDS_INDEX_NAME_SIZE) ==
+           0) {
+            entry = &index->entries[i];
             break;
+        }
+    }
 
-        furi_string_set(instance->file_path, instance->file_name);
-        if(!furi_string_end_with_str(instance->file_path, NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX))
-            continue;
+    if(!entry && allocate && (index->count < NFC_SUPPORTED_CARDS_INDEX_SIZE)) {
+        entry = &index->entries[index->count++];
+        memset(entry, 0, sizeof(NfcSupportedCardsIndexEntry));
+        strlcpy(entry->file_name, file_name, NFC_SUPPORTED_CARDS_INDEX_NAME_SIZE);
+    }
 
-        path_concat(NFC_SUPPORTED_CARDS_PLUGINS_PATH, instance->file_name, instance->file_path);
+    return entry;
+}
+
+static void nfc_supported_cards_index_update(
+    NfcSupportedCards* instance,
+    uint32_t file_size,
+    uint32_t timestamp,
+    const NfcSupportedCardsPlugin* plugin) {
+    // Long names can't be indexed, such plugins are always loaded
+    if(strlen(instance->file_name) >= NFC_SUPPORTED_CARDS_INDEX_NAME_SIZE) return;
+
+    NfcSupportedCardsIndexEntry* entry =
+        nfc_supported_cards_index_find(instance, instance->file_name, true);
+    if(!entry) return;
+
+    entry->file_size = file_size;
+    entry->timestamp = timestamp;
+    entry->protocol = plugin ? plugin->protocol : NfcProtocolInvalid;
+    entry->features = 0;
+    if(plugin && plugin->read) entry->features |= NfcSupportedCardsFeatureRead;
+    if(plugin && plugin->parse) entry->features |= NfcSupportedCardsFeatureParse;
+
+    instance->index_changed = true;
+}
 
+static const NfcSupportedCardsPlugin*
+    nfc_supported_cards_load_plugin(NfcSupportedCards* instance) {
+    const NfcSupportedCardsPlugin* plugin = NULL;
+
+    do {
         if(instance->app) flipper_application_free(instance->app);
         instance->app = flipper_application_alloc(instance->storage, firmware_api_interface);
 
         if(flipper_application_preload(instance->app, furi_string_get_cstr(instance->file_path)) !=
            FlipperApplicationPreloadStatusSuccess)
-            continue;
-        if(!flipper_application_is_plugin(instance->app)) continue;
+            break;
+        if(!flipper_application_is_plugin(instance->app)) break;
 
         if(flipper_application_map_to_memory(instance->app) != FlipperApplicationLoadStatusSuccess)
-            continue;
+            break;
 
         const FlipperAppPluginDescriptor* descriptor =
             flipper_application_plugin_get_descriptor(instance->app);
 
-        if(descriptor == NULL) continue;
+        if(descriptor == NULL) break;
 
-        if(strcmp(descriptor->appid, NFC_SUPPORTED_CARD_PLUGIN_APP_ID) != 0) continue;
-        if(descriptor->ep_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) continue;
+        if(strcmp(descriptor->appid, NFC_SUPPORTED_CARD_PLUGIN_APP_ID) != 0) break;
+        if(descriptor->ep_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) break;
 
         plugin = descriptor->entry_point;
+    } while(false);
+
+    return plugin;
+}
+
+static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
+    NfcSupportedCards* instance,
+    NfcProtocol protocol,
+    NfcSupportedCardsFeature feature) {
+    const NfcSupportedCardsPlugin* plugin = NULL;
+
+    do {
+        if(!storage_file_is_open(instance->directory)) break;
+        FileInfo file_info;
+        if(!storage_dir_read(
+               instance->directory, &file_info, instance->file_name, sizeof(instance->file_name)))
+            break;
+
+        furi_string_set(instance->file_path, instance->file_name);
+        if(!furi_string_end_with_str(instance->file_path, NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX))
+            continue;
+
+        path_concat(NFC_SUPPORTED_CARDS_PLUGINS_PATH, instance->file_name, instance->file_path);
+
+        uint32_t timestamp = 0;
+        storage_common_timestamp(
+            instance->storage, furi_string_get_cstr(instance->file_path), &timestamp);
+
+        const NfcSupportedCardsIndexEntry* entry =
+            nfc_supported_cards_index_find(instance, instance->file_name, false);
+        if(entry && (entry->file_size == file_info.size) && (entry->timestamp == timestamp)) {
+            if(entry->protocol != protocol) continue;
+            if(!(entry->features & feature)) continue;
+        }
+
+        plugin = nfc_supported_cards_load_plugin(instance);
+        nfc_supported_cards_index_update(instance, file_info.size, timestamp, plugin);
+
+        if(plugin == NULL) continue;
+        if(plugin->protocol != protocol) {
+            plugin = NULL;
+        }
     } while(plugin == NULL); //-V654
 
     return plugin;
@@ -95,17 +231,15 @@ bool nfc_supported_cards_read(NfcDevice* device, Nfc* nfc) {
     furi_assert(nfc);
 
     bool card_read = false;
+    const NfcProtocol protocol = nfc_device_get_protocol(device);
 
     NfcSupportedCards* supported_cards = nfc_supported_cards_alloc();
 
     do {
-        const NfcSupportedCardsPlugin* plugin =
-            nfc_supported_cards_get_next_plugin(supported_cards);
+        const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_next_plugin(
+            supported_cards, protocol, NfcSupportedCardsFeatureRead);
         if(plugin == NULL) break; //-V547
 
-        const NfcProtocol protocol = nfc_device_get_protocol(device); //-V779
-        if(plugin->protocol != protocol) continue;
-
         if(plugin->verify) {
             if(!plugin->verify(nfc)) continue;
         }
@@ -125,17 +259,15 @@ bool nfc_supported_cards_parse(const NfcDevice* device, FuriString* parsed_data)
     furi_assert(parsed_data);
 
     bool parsed = false;
+    const NfcProtocol protocol = nfc_device_get_protocol(device);
 
     NfcSupportedCards* supported_cards = nfc_supported_cards_alloc();
 
     do {
-        const NfcSupportedCardsPlugin* plugin =
-            nfc_supported_cards_get_next_plugin(supported_cards);
+        const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_next_plugin(
+            supported_cards, protocol, NfcSupportedCardsFeatureParse);
         if(plugin == NULL) break; //-V547
 
-        const NfcProtocol protocol = nfc_device_get_protocol(device); //-V779
-        if(plugin->protocol != protocol) continue;
-
         if(plugin->parse) {
             parsed = plugin->parse(device, parsed_data);
         }
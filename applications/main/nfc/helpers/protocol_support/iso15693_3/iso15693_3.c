@@ -79,7 +79,8 @@ static NfcCommand
                     bit_buffer_get_byte(iso15693_3_event->data->buffer, i));
             }
             furi_string_push_back(nfc->text_box_store, '\n');
-            view_dispatcher_send_custom_event(nfc->view_dispatcher, NfcCustomEventListenerUpdate);
+            view_dispatcher_send_custom_event_coalesced(
+                nfc->view_dispatcher, NfcCustomEventListenerUpdate, UINT32_MAX);
         }
     }
 
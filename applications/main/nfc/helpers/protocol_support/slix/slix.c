@@ -77,7 +77,8 @@ static NfcCommand nfc_scene_emulate_listener_callback_slix(NfcGenericEvent event
                     bit_buffer_get_byte(slix_event->data->buffer, i));
             }
             furi_string_push_back(nfc->text_box_store, '\n');
-            view_dispatcher_send_custom_event(nfc->view_dispatcher, NfcCustomEventListenerUpdate);
+            view_dispatcher_send_custom_event_coalesced(
+                nfc->view_dispatcher, NfcCustomEventListenerUpdate, UINT32_MAX);
         }
     }
 
@@ -69,9 +69,12 @@
 
 #define NFC_APP_MFKEY32_LOGS_FILE_NAME ".mfkey32.log"
 #define NFC_APP_MFKEY32_LOGS_FILE_PATH (NFC_APP_FOLDER "/" NFC_APP_MFKEY32_LOGS_FILE_NAME)
+#define NFC_APP_MFKEY32_BIN_LOGS_FILE_NAME ".mfkey32.bin"
+#define NFC_APP_MFKEY32_BIN_LOGS_FILE_PATH (NFC_APP_FOLDER "/" NFC_APP_MFKEY32_BIN_LOGS_FILE_NAME)
 
 #define NFC_APP_MF_CLASSIC_DICT_USER_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict_user.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict.nfc")
+#define NFC_APP_MF_CLASSIC_DICT_SYSTEM_PACKED_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict.bin")
 
 typedef enum {
     NfcRpcStateIdle,
@@ -89,6 +92,10 @@ typedef struct {
     bool is_key_attack;
     uint8_t key_attack_current_sector;
     bool is_card_present;
+    bool try_hot_keys;
+    size_t hot_keys_current;
+    uint64_t key_a_mask_known;
+    uint64_t key_b_mask_known;
 } NfcMfClassicDictAttackContext;
 
 struct NfcApp {
@@ -8,6 +8,21 @@
 
 #define FLAG_EVENT (1 << 10)
 
+#define NFC_CLI_TRACE_RECORDS_MAX (256U)
+
+static const char* const nfc_cli_trace_point_names[FuriHalNfcTracePointNum] = {
+    [FuriHalNfcTracePointIrq] = "irq",
+    [FuriHalNfcTracePointIrqRead] = "irq_read",
+    [FuriHalNfcTracePointTxStart] = "tx_start",
+    [FuriHalNfcTracePointFifoRead] = "fifo_read",
+    [FuriHalNfcTracePointFwtArmed] = "fwt_armed",
+    [FuriHalNfcTracePointFwtExpired] = "fwt_expired",
+    [FuriHalNfcTracePointBlockTxArmed] = "block_tx_armed",
+    [FuriHalNfcTracePointBlockTxExpired] = "block_tx_expired",
+    [FuriHalNfcTracePointCallbackStart] = "callback_start",
+    [FuriHalNfcTracePointCallbackEnd] = "callback_end",
+};
+
 static void nfc_cli_print_usage() {
     printf("Usage:\r\n");
     printf("nfc <cmd>\r\n");
@@ -15,6 +30,7 @@ static void nfc_cli_print_usage() {
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
         printf("\tfield\t - turn field on\r\n");
     }
+    printf("\ttrace <dump|reset>\t - NFC HAL timing trace\r\n");
 }
 
 static void nfc_cli_field(Cli* cli, FuriString* args) {
@@ -40,6 +56,40 @@ static void nfc_cli_field(Cli* cli, FuriString* args) {
     furi_hal_nfc_release();
 }
 
+static void nfc_cli_trace(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+
+    if(!furi_hal_nfc_trace_is_enabled()) {
+        printf("Trace is disabled, build firmware with FURI_HAL_NFC_TRACE defined\r\n");
+        return;
+    }
+
+    if(furi_string_cmp_str(args, "reset") == 0) {
+        furi_hal_nfc_trace_reset();
+        return;
+    }
+
+    FuriHalNfcTraceRecord* records =
+        malloc(sizeof(FuriHalNfcTraceRecord) * NFC_CLI_TRACE_RECORDS_MAX);
+    size_t count = furi_hal_nfc_trace_read(records, NFC_CLI_TRACE_RECORDS_MAX);
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+
+    printf("%-8s %-10s %-16s %s\r\n", "dt_us", "dt_cycles", "point", "value");
+    for(size_t i = 0; i < count; i++) {
+        const FuriHalNfcTraceRecord* record = &records[i];
+        uint32_t delta = i ? record->cycles - records[i - 1].cycles : 0;
+        printf(
+            "%-8lu %-10lu %-16s %08lX\r\n",
+            delta / cycles_per_us,
+            delta,
+            nfc_cli_trace_point_names[record->point],
+            record->value);
+    }
+    printf("%zu records\r\n", count);
+
+    free(records);
+}
+
 static void nfc_cli(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriString* cmd;
@@ -50,6 +100,10 @@ static void nfc_cli(Cli* cli, FuriString* args, void* context) {
             nfc_cli_print_usage();
             break;
         }
+        if(furi_string_cmp_str(cmd, "trace") == 0) {
+            nfc_cli_trace(cli, args);
+            break;
+        }
         if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
             if(furi_string_cmp_str(cmd, "field") == 0) {
                 nfc_cli_field(cli, args);
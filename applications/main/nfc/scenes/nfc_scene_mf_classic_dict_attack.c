@@ -29,7 +29,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestMode) {
         const MfClassicData* mfc_data =
             nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
-        mfc_event->data->poller_mode.mode = MfClassicPollerModeDictAttack;
+        mfc_event->data->poller_mode.mode = MfClassicPollerModeDictAttackBatch;
         mfc_event->data->poller_mode.data = mfc_data;
         instance->nfc_dict_context.sectors_total =
             mf_classic_get_total_sectors_num(mfc_data->type);
@@ -39,18 +39,37 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
             &instance->nfc_dict_context.keys_found);
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
-    } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
-        MfClassicKey key = {};
-        if(nfc_dict_get_next_key(instance->nfc_dict_context.dict, key.data, sizeof(MfClassicKey))) {
-            mfc_event->data->key_request_data.key = key;
-            mfc_event->data->key_request_data.key_provided = true;
-            instance->nfc_dict_context.dict_keys_current++;
-            if(instance->nfc_dict_context.dict_keys_current % 10 == 0) {
-                view_dispatcher_send_custom_event(
-                    instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
+    } else if(mfc_event->type == MfClassicPollerEventTypeRequestKeyBatch) {
+        MfClassicPollerEventDataKeyBatchRequest* batch_data =
+            &mfc_event->data->key_batch_request_data;
+        NfcMfClassicDictAttackContext* dict_context = &instance->nfc_dict_context;
+        uint8_t keys_provided = 0;
+        // Keys that opened most sectors before go first
+        while(dict_context->try_hot_keys && keys_provided < MF_CLASSIC_POLLER_KEY_BATCH_SIZE &&
+              mf_classic_key_cache_get_hot_key(
+                  instance->mfc_key_cache,
+                  dict_context->hot_keys_current,
+                  &batch_data->keys[keys_provided])) {
+            dict_context->hot_keys_current++;
+            keys_provided++;
+        }
+        while(keys_provided < MF_CLASSIC_POLLER_KEY_BATCH_SIZE &&
+              nfc_dict_get_next_key(
+                  dict_context->dict,
+                  batch_data->keys[keys_provided].data,
+                  sizeof(MfClassicKey))) {
+            if(dict_context->try_hot_keys &&
+               mf_classic_key_cache_is_hot_key(
+                   instance->mfc_key_cache, &batch_data->keys[keys_provided])) {
+                continue;
             }
-        } else {
-            mfc_event->data->key_request_data.key_provided = false;
+            keys_provided++;
+        }
+        batch_data->keys_provided = keys_provided;
+        if(keys_provided) {
+            instance->nfc_dict_context.dict_keys_current += keys_provided;
+            view_dispatcher_send_custom_event(
+                instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
         }
     } else if(mfc_event->type == MfClassicPollerEventTypeDataUpdate) {
         MfClassicPollerEventDataUpdate* data_update = &mfc_event->data->data_update;
@@ -62,6 +81,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
     } else if(mfc_event->type == MfClassicPollerEventTypeNextSector) {
         nfc_dict_rewind(instance->nfc_dict_context.dict);
         instance->nfc_dict_context.dict_keys_current = 0;
+        instance->nfc_dict_context.hot_keys_current = 0;
         instance->nfc_dict_context.current_sector =
             mfc_event->data->next_sector_data.current_sector;
         view_dispatcher_send_custom_event(
@@ -82,6 +102,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         nfc_dict_rewind(instance->nfc_dict_context.dict);
         instance->nfc_dict_context.is_key_attack = false;
         instance->nfc_dict_context.dict_keys_current = 0;
+        instance->nfc_dict_context.hot_keys_current = 0;
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeSuccess) {
@@ -141,13 +162,26 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
         } while(false);
     }
     if(state == DictAttackStateSystemDictInProgress) {
-        instance->nfc_dict_context.dict = nfc_dict_alloc(
-            NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH, NfcDictModeOpenExisting, sizeof(MfClassicKey));
+        // Packed copy is read without parsing, text one is used if copy can't be made
+        const char* dict_path = NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH;
+        if(nfc_dict_update_packed(
+               NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH,
+               NFC_APP_MF_CLASSIC_DICT_SYSTEM_PACKED_PATH,
+               sizeof(MfClassicKey))) {
+            dict_path = NFC_APP_MF_CLASSIC_DICT_SYSTEM_PACKED_PATH;
+        }
+        instance->nfc_dict_context.dict =
+            nfc_dict_alloc(dict_path, NfcDictModeOpenExisting, sizeof(MfClassicKey));
         dict_attack_set_header(instance->dict_attack, "MF Classic System Dictionary");
     }
 
     instance->nfc_dict_context.dict_keys_total =
         nfc_dict_get_total_keys(instance->nfc_dict_context.dict);
+    instance->nfc_dict_context.hot_keys_current = 0;
+    if(instance->nfc_dict_context.try_hot_keys) {
+        instance->nfc_dict_context.dict_keys_total +=
+            mf_classic_key_cache_get_hot_keys_count(instance->mfc_key_cache);
+    }
     dict_attack_set_total_dict_keys(
         instance->dict_attack, instance->nfc_dict_context.dict_keys_total);
     instance->nfc_dict_context.dict_keys_current = 0;
@@ -159,9 +193,29 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
     scene_manager_set_scene_state(instance->scene_manager, NfcSceneMfClassicDictAttack, state);
 }
 
+static void nfc_scene_mf_classic_dict_attack_update_hot_keys(NfcApp* instance) {
+    const MfClassicData* mfc_data =
+        nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
+    // Only keys found by this attack are counted
+    mf_classic_key_cache_add_hot_key_hits(
+        instance->mfc_key_cache,
+        mfc_data,
+        ~instance->nfc_dict_context.key_a_mask_known,
+        ~instance->nfc_dict_context.key_b_mask_known);
+    mf_classic_key_cache_save_hot_keys(instance->mfc_key_cache);
+}
+
 void nfc_scene_mf_classic_dict_attack_on_enter(void* context) {
     NfcApp* instance = context;
 
+    const MfClassicData* mfc_data =
+        nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
+    instance->nfc_dict_context.key_a_mask_known = mfc_data->key_a_mask;
+    instance->nfc_dict_context.key_b_mask_known = mfc_data->key_b_mask;
+    mf_classic_key_cache_load_hot_keys(instance->mfc_key_cache);
+    // Hot keys are tried before dictionary keys in the first dictionary only
+    instance->nfc_dict_context.try_hot_keys = true;
+
     scene_manager_set_scene_state(
         instance->scene_manager, NfcSceneMfClassicDictAttack, DictAttackStateUserDictInProgress);
     nfc_scene_mf_classic_dict_attack_prepare_view(instance);
@@ -190,11 +244,13 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
                     instance->scene_manager,
                     NfcSceneMfClassicDictAttack,
                     DictAttackStateSystemDictInProgress);
+                instance->nfc_dict_context.try_hot_keys = false;
                 nfc_scene_mf_classic_dict_attack_prepare_view(instance);
                 instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
                 nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
                 consumed = true;
             } else {
+                nfc_scene_mf_classic_dict_attack_update_hot_keys(instance);
                 notification_message(instance->notifications, &sequence_success);
                 scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
                 dolphin_deed(DolphinDeedNfcReadSuccess);
@@ -220,16 +276,19 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
                         instance->scene_manager,
                         NfcSceneMfClassicDictAttack,
                         DictAttackStateSystemDictInProgress);
+                    instance->nfc_dict_context.try_hot_keys = false;
                     nfc_scene_mf_classic_dict_attack_prepare_view(instance);
                     instance->poller = nfc_poller_alloc(instance->nfc, NfcProtocolMfClassic);
                     nfc_poller_start(instance->poller, nfc_dict_attack_worker_callback, instance);
                 } else {
+                    nfc_scene_mf_classic_dict_attack_update_hot_keys(instance);
                     notification_message(instance->notifications, &sequence_success);
                     scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
                     dolphin_deed(DolphinDeedNfcReadSuccess);
                 }
                 consumed = true;
             } else if(state == DictAttackStateSystemDictInProgress) {
+                nfc_scene_mf_classic_dict_attack_update_hot_keys(instance);
                 notification_message(instance->notifications, &sequence_success);
                 scene_manager_next_scene(instance->scene_manager, NfcSceneReadSuccess);
                 dolphin_deed(DolphinDeedNfcReadSuccess);
@@ -264,6 +323,8 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
     instance->nfc_dict_context.is_key_attack = false;
     instance->nfc_dict_context.key_attack_current_sector = 0;
     instance->nfc_dict_context.is_card_present = false;
+    instance->nfc_dict_context.try_hot_keys = false;
+    instance->nfc_dict_context.hot_keys_current = 0;
 
     nfc_blink_stop(instance);
     notification_message(instance->notifications, &sequence_display_backlight_enforce_auto);
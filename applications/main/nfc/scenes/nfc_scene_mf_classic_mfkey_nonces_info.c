@@ -44,8 +44,12 @@ bool nfc_scene_mf_classic_mfkey_nonces_info_on_event(void* context, SceneManager
 
     if(event.type == SceneManagerEventTypeCustom) {
         if(event.event == GuiButtonTypeCenter) {
-            if(mfkey32_logger_save_params(
-                   instance->mfkey32_logger, NFC_APP_MFKEY32_LOGS_FILE_PATH)) {
+            // Text log is kept for desktop and mobile tools
+            bool saved = mfkey32_logger_save_params(
+                instance->mfkey32_logger, NFC_APP_MFKEY32_LOGS_FILE_PATH);
+            saved &= mfkey32_logger_save_params_binary(
+                instance->mfkey32_logger, NFC_APP_MFKEY32_BIN_LOGS_FILE_PATH);
+            if(saved) {
                 scene_manager_next_scene(instance->scene_manager, NfcSceneMfClassicMfkeyComplete);
             } else {
                 scene_manager_search_and_switch_to_previous_scene(
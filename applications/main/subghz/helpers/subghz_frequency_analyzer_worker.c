@@ -3,11 +3,20 @@
 
 #include <furi.h>
 #include <float_tools.h>
+#include <xtreme.h>
 
 #define TAG "SubghzFrequencyAnalyzerWorker"
 
 #define SUBGHZ_FREQUENCY_ANALYZER_THRESHOLD -97.0f
 
+#define SUBGHZ_FREQUENCY_ANALYZER_SETTLE_US 2000
+//for example -0.3 ... 433.92 ... +0.3 step 20KHz
+#define SUBGHZ_FREQUENCY_ANALYZER_FINE_SPAN 300000
+#define SUBGHZ_FREQUENCY_ANALYZER_FINE_STEP 20000
+#define SUBGHZ_FREQUENCY_ANALYZER_FINE_POINTS \
+    (2 * SUBGHZ_FREQUENCY_ANALYZER_FINE_SPAN / SUBGHZ_FREQUENCY_ANALYZER_FINE_STEP)
+#define SUBGHZ_FREQUENCY_ANALYZER_RESULTS_SIZE 8
+
 static const uint8_t subghz_preset_ook_58khz[][2] = {
     {CC1101_MDMCFG4, 0b11110111}, // Rx BW filter is 58.035714kHz
     /* End  */
@@ -22,6 +31,14 @@ static const uint8_t subghz_preset_ook_650khz[][2] = {
 
 struct SubGhzFrequencyAnalyzerWorker {
     FuriThread* thread;
+    FuriThread* deliver_thread;
+    // Sweep results, thread -> deliver_thread
+    FuriSpscRing* results;
+
+    uint32_t* coarse_frequency;
+    CC1101SweepPoint* coarse_points;
+    size_t coarse_count;
+    CC1101SweepPoint fine_points[SUBGHZ_FREQUENCY_ANALYZER_FINE_POINTS];
 
     volatile bool worker_running;
     uint8_t sample_hold_counter;
@@ -67,7 +84,18 @@ static uint32_t subghz_frequency_analyzer_worker_expRunningAverageAdaptive(
     return (uint32_t)instance->filVal;
 }
 
-/** Worker thread
+static bool subghz_frequency_analyzer_worker_is_coarse_frequency(
+    SubGhzFrequencyAnalyzerWorker* instance,
+    uint32_t frequency) {
+    return subghz_devices_is_frequency_valid(instance->radio_device, frequency) &&
+           (frequency != 467750000) && (frequency != 464000000) &&
+           !((instance->ext_radio) &&
+             ((frequency == 390000000) || (frequency == 312000000) ||
+              (frequency == 312100000) || (frequency == 312200000) ||
+              (frequency == 440175000)));
+}
+
+/** Sweep thread, measures and pushes results to deliver thread
  * 
  * @param context 
  * @return exit code 
@@ -77,15 +105,22 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
 
     FrequencyRSSI frequency_rssi = {
         .frequency_coarse = 0, .rssi_coarse = 0, .frequency_fine = 0, .rssi_fine = 0};
-    float rssi = 0;
-    uint32_t frequency = 0;
-    float rssi_temp = 0;
-    uint32_t frequency_temp = 0;
-    CC1101Status status;
 
     FuriHalSpiBusHandle* spi_bus = instance->spi_bus;
     const SubGhzDevice* radio_device = instance->radio_device;
 
+    // Coarse frequency list doesn't change while running, filter it once
+    size_t frequency_count = subghz_setting_get_frequency_count(instance->setting);
+    instance->coarse_frequency = malloc(sizeof(uint32_t) * frequency_count);
+    instance->coarse_points = malloc(sizeof(CC1101SweepPoint) * frequency_count);
+    instance->coarse_count = 0;
+    for(size_t i = 0; i < frequency_count; i++) {
+        uint32_t frequency = subghz_setting_get_frequency(instance->setting, i);
+        if(subghz_frequency_analyzer_worker_is_coarse_frequency(instance, frequency)) {
+            instance->coarse_frequency[instance->coarse_count++] = frequency;
+        }
+    }
+
     //Start CC1101
     // furi_hal_subghz_reset();
     subghz_devices_reset(radio_device);
@@ -120,7 +155,6 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
 
         float rssi_min = 26.0f;
         float rssi_avg = 0;
-        size_t rssi_avg_samples = 0;
 
         frequency_rssi.rssi_coarse = -127.0f;
         frequency_rssi.rssi_fine = -127.0f;
@@ -129,48 +163,30 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
         subghz_frequency_analyzer_worker_load_registers(spi_bus, subghz_preset_ook_650khz);
 
         // First stage: coarse scan
-        for(size_t i = 0; i < subghz_setting_get_frequency_count(instance->setting); i++) {
-            uint32_t current_frequency = subghz_setting_get_frequency(instance->setting, i);
-            // if(furi_hal_subghz_is_frequency_valid(current_frequency) &&
-            if(subghz_devices_is_frequency_valid(radio_device, current_frequency) &&
-               (current_frequency != 467750000) && (current_frequency != 464000000) &&
-               !((instance->ext_radio) &&
-                 ((current_frequency == 390000000) || (current_frequency == 312000000) ||
-                  (current_frequency == 312100000) || (current_frequency == 312200000) ||
-                  (current_frequency == 440175000)))) {
-                furi_hal_spi_acquire(spi_bus);
-                cc1101_switch_to_idle(spi_bus);
-                frequency = cc1101_set_frequency(spi_bus, current_frequency);
-
-                cc1101_calibrate(spi_bus);
-                do {
-                    status = cc1101_get_status(spi_bus);
-                } while(status.STATE != CC1101StateIDLE);
-
-                cc1101_switch_to_rx(spi_bus);
-                furi_hal_spi_release(spi_bus);
-
-                furi_delay_ms(2);
-
-                // rssi = furi_hal_subghz_get_rssi();
-                rssi = subghz_devices_get_rssi(radio_device);
-
-                rssi_avg += rssi;
-                rssi_avg_samples++;
-
-                if(rssi < rssi_min) rssi_min = rssi;
-
-                if(frequency_rssi.rssi_coarse < rssi) {
-                    frequency_rssi.rssi_coarse = rssi;
-                    frequency_rssi.frequency_coarse = frequency;
-                }
+        for(size_t i = 0; i < instance->coarse_count; i++) {
+            instance->coarse_points[i].frequency = instance->coarse_frequency[i];
+        }
+        cc1101_sweep(
+            spi_bus,
+            instance->coarse_points,
+            instance->coarse_count,
+            SUBGHZ_FREQUENCY_ANALYZER_SETTLE_US);
+
+        for(size_t i = 0; i < instance->coarse_count; i++) {
+            float rssi = instance->coarse_points[i].rssi;
+            rssi_avg += rssi;
+            if(rssi < rssi_min) rssi_min = rssi;
+
+            if(frequency_rssi.rssi_coarse < rssi) {
+                frequency_rssi.rssi_coarse = rssi;
+                frequency_rssi.frequency_coarse = instance->coarse_points[i].frequency;
             }
         }
 
         FURI_LOG_T(
             TAG,
             "RSSI: avg %f, max %f at %lu, min %f",
-            (double)(rssi_avg / rssi_avg_samples),
+            (double)(rssi_avg / instance->coarse_count),
             (double)frequency_rssi.rssi_coarse,
             frequency_rssi.frequency_coarse,
             (double)rssi_min);
@@ -180,38 +196,62 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
             // furi_hal_subghz_idle();
             subghz_devices_idle(radio_device);
             subghz_frequency_analyzer_worker_load_registers(spi_bus, subghz_preset_ook_58khz);
-            //for example -0.3 ... 433.92 ... +0.3 step 20KHz
-            for(uint32_t i = frequency_rssi.frequency_coarse - 300000;
-                i < frequency_rssi.frequency_coarse + 300000;
-                i += 20000) {
+
+            size_t fine_count = 0;
+            for(uint32_t i = frequency_rssi.frequency_coarse - SUBGHZ_FREQUENCY_ANALYZER_FINE_SPAN;
+                i < frequency_rssi.frequency_coarse + SUBGHZ_FREQUENCY_ANALYZER_FINE_SPAN;
+                i += SUBGHZ_FREQUENCY_ANALYZER_FINE_STEP) {
                 // if(furi_hal_subghz_is_frequency_valid(i)) {
                 if(subghz_devices_is_frequency_valid(radio_device, i)) {
-                    furi_hal_spi_acquire(spi_bus);
-                    cc1101_switch_to_idle(spi_bus);
-                    frequency = cc1101_set_frequency(spi_bus, i);
+                    instance->fine_points[fine_count++].frequency = i;
+                }
+            }
+            cc1101_sweep(
+                spi_bus, instance->fine_points, fine_count, SUBGHZ_FREQUENCY_ANALYZER_SETTLE_US);
 
-                    cc1101_calibrate(spi_bus);
-                    do {
-                        status = cc1101_get_status(spi_bus);
-                    } while(status.STATE != CC1101StateIDLE);
+            for(size_t i = 0; i < fine_count; i++) {
+                CC1101SweepPoint* point = &instance->fine_points[i];
+                FURI_LOG_T(TAG, "#:%lu:%f", point->frequency, (double)point->rssi);
 
-                    cc1101_switch_to_rx(spi_bus);
-                    furi_hal_spi_release(spi_bus);
+                if(frequency_rssi.rssi_fine < point->rssi) {
+                    frequency_rssi.rssi_fine = point->rssi;
+                    frequency_rssi.frequency_fine = point->frequency;
+                }
+            }
+        }
 
-                    furi_delay_ms(2);
+        // Results are dropped if deliver thread can't keep up, next sweep is fresher anyway
+        furi_spsc_ring_push(instance->results, &frequency_rssi);
+    }
 
-                    // rssi = furi_hal_subghz_get_rssi();
-                    rssi = subghz_devices_get_rssi(radio_device);
+    //Stop CC1101
+    // furi_hal_subghz_idle();
+    // furi_hal_subghz_sleep();
+    subghz_devices_idle(radio_device);
+    subghz_devices_sleep(radio_device);
 
-                    FURI_LOG_T(TAG, "#:%lu:%f", frequency, (double)rssi);
+    free(instance->coarse_points);
+    free(instance->coarse_frequency);
+    instance->coarse_points = NULL;
+    instance->coarse_frequency = NULL;
 
-                    if(frequency_rssi.rssi_fine < rssi) {
-                        frequency_rssi.rssi_fine = rssi;
-                        frequency_rssi.frequency_fine = frequency;
-                    }
-                }
-            }
-        }
+    return 0;
+}
+
+/** Deliver thread, filters sweep results and calls pair callback
+ * 
+ * @param context 
+ * @return exit code 
+ */
+static int32_t subghz_frequency_analyzer_worker_deliver_thread(void* context) {
+    SubGhzFrequencyAnalyzerWorker* instance = context;
+
+    FrequencyRSSI frequency_rssi;
+    float rssi_temp = 0;
+    uint32_t frequency_temp = 0;
+
+    while(instance->worker_running) {
+        if(!furi_spsc_ring_pop(instance->results, &frequency_rssi, 1, 100)) continue;
 
         // Deliver results fine
         if(frequency_rssi.rssi_fine > instance->trigger_level) {
@@ -277,12 +317,6 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
         }
     }
 
-    //Stop CC1101
-    // furi_hal_subghz_idle();
-    // furi_hal_subghz_sleep();
-    subghz_devices_idle(radio_device);
-    subghz_devices_sleep(radio_device);
-
     return 0;
 }
 
@@ -296,6 +330,16 @@ SubGhzFrequencyAnalyzerWorker* subghz_frequency_analyzer_worker_alloc(void* cont
     furi_thread_set_context(instance->thread, instance);
     furi_thread_set_callback(instance->thread, subghz_frequency_analyzer_worker_thread);
 
+    instance->deliver_thread = furi_thread_alloc();
+    furi_thread_set_name(instance->deliver_thread, "SubGhzFADeliver");
+    furi_thread_set_stack_size(instance->deliver_thread, 2048);
+    furi_thread_set_context(instance->deliver_thread, instance);
+    furi_thread_set_callback(
+        instance->deliver_thread, subghz_frequency_analyzer_worker_deliver_thread);
+
+    instance->results =
+        furi_spsc_ring_alloc(sizeof(FrequencyRSSI), SUBGHZ_FREQUENCY_ANALYZER_RESULTS_SIZE);
+
     SubGhz* subghz = context;
     instance->setting = subghz_txrx_get_setting(subghz->txrx);
     instance->trigger_level = subghz->last_settings->frequency_analyzer_trigger;
@@ -307,6 +351,8 @@ void subghz_frequency_analyzer_worker_free(SubGhzFrequencyAnalyzerWorker* instan
     furi_assert(instance);
 
     furi_thread_free(instance->thread);
+    furi_thread_free(instance->deliver_thread);
+    furi_spsc_ring_free(instance->results);
     free(instance);
 }
 
@@ -329,7 +375,9 @@ void subghz_frequency_analyzer_worker_start(
     SubGhzRadioDeviceType radio_type = subghz_txrx_radio_device_get(txrx);
 
     if(radio_type == SubGhzRadioDeviceTypeExternalCC1101) {
-        instance->spi_bus = &furi_hal_spi_bus_handle_external;
+        instance->spi_bus = xtreme_settings.spi_cc1101_handle == SpiDefault ?
+                                &furi_hal_spi_bus_handle_external :
+                                &furi_hal_spi_bus_handle_external_extra;
         instance->ext_radio = true;
     } else if(radio_type == SubGhzRadioDeviceTypeInternal) {
         instance->spi_bus = &furi_hal_spi_bus_handle_subghz;
@@ -342,6 +390,8 @@ void subghz_frequency_analyzer_worker_start(
 
     instance->worker_running = true;
 
+    furi_spsc_ring_reset(instance->results);
+    furi_thread_start(instance->deliver_thread);
     furi_thread_start(instance->thread);
 }
 
@@ -352,6 +402,7 @@ void subghz_frequency_analyzer_worker_stop(SubGhzFrequencyAnalyzerWorker* instan
     instance->worker_running = false;
 
     furi_thread_join(instance->thread);
+    furi_thread_join(instance->deliver_thread);
 }
 
 bool subghz_frequency_analyzer_worker_is_running(SubGhzFrequencyAnalyzerWorker* instance) {
@@ -1,60 +1,30 @@
 #include "subghz_gps.h"
 
-static void subghz_gps_uart_parse_nmea(SubGhzGPS* subghz_gps, char* line) {
-    switch(minmea_sentence_id(line, false)) {
-    case MINMEA_SENTENCE_RMC: {
-        struct minmea_sentence_rmc frame;
-        if(minmea_parse_rmc(&frame, line)) {
-            subghz_gps->latitude = minmea_tocoord(&frame.latitude);
-            subghz_gps->longitude = minmea_tocoord(&frame.longitude);
-            subghz_gps->fix_second = frame.time.seconds;
-            subghz_gps->fix_minute = frame.time.minutes;
-            subghz_gps->fix_hour = frame.time.hours;
-        }
-    } break;
-
-    case MINMEA_SENTENCE_GGA: {
-        struct minmea_sentence_gga frame;
-        if(minmea_parse_gga(&frame, line)) {
-            subghz_gps->latitude = minmea_tocoord(&frame.latitude);
-            subghz_gps->longitude = minmea_tocoord(&frame.longitude);
-            subghz_gps->satellites = frame.satellites_tracked;
-            subghz_gps->fix_second = frame.time.seconds;
-            subghz_gps->fix_minute = frame.time.minutes;
-            subghz_gps->fix_hour = frame.time.hours;
-        }
-    } break;
-
-    case MINMEA_SENTENCE_GLL: {
-        struct minmea_sentence_gll frame;
-        if(minmea_parse_gll(&frame, line)) {
-            subghz_gps->latitude = minmea_tocoord(&frame.latitude);
-            subghz_gps->longitude = minmea_tocoord(&frame.longitude);
-            subghz_gps->fix_second = frame.time.seconds;
-            subghz_gps->fix_minute = frame.time.minutes;
-            subghz_gps->fix_hour = frame.time.hours;
-        }
-    } break;
-
-    default:
-        break;
-    }
+static void subghz_gps_update(SubGhzGPS* subghz_gps) {
+    NmeaFix fix;
+    nmea_parser_get_fix(subghz_gps->parser, &fix);
+
+    subghz_gps->latitude = fix.latitude;
+    subghz_gps->longitude = fix.longitude;
+    subghz_gps->satellites = fix.satellites;
+    subghz_gps->fix_second = fix.seconds;
+    subghz_gps->fix_minute = fix.minutes;
+    subghz_gps->fix_hour = fix.hours;
 }
 
-static void subghz_gps_uart_on_irq_cb(UartIrqEvent ev, uint8_t data, void* context) {
+static void
+    subghz_gps_uart_on_rx_cb(FuriHalUartId ch, const uint8_t* data, size_t size, void* context) {
+    UNUSED(ch);
     SubGhzGPS* subghz_gps = (SubGhzGPS*)context;
 
-    if(ev == UartIrqEventRXNE) {
-        furi_stream_buffer_send(subghz_gps->rx_stream, &data, 1, 0);
-        furi_thread_flags_set(furi_thread_get_id(subghz_gps->thread), WorkerEvtRxDone);
-    }
+    // Chunks come on line idle, one wakeup per burst of sentences instead of per byte
+    furi_stream_buffer_send(subghz_gps->rx_stream, data, size, 0);
+    furi_thread_flags_set(furi_thread_get_id(subghz_gps->thread), WorkerEvtRxDone);
 }
 
 static int32_t subghz_gps_uart_worker(void* context) {
     SubGhzGPS* subghz_gps = (SubGhzGPS*)context;
 
-    size_t rx_offset = 0;
-
     while(1) {
         uint32_t events =
             furi_thread_flags_wait(WORKER_ALL_RX_EVENTS, FuriFlagWaitAny, FuriWaitForever);
@@ -66,41 +36,14 @@ static int32_t subghz_gps_uart_worker(void* context) {
 
         if(events & WorkerEvtRxDone) {
             size_t len = 0;
+            uint32_t applied = 0;
             do {
                 len = furi_stream_buffer_receive(
-                    subghz_gps->rx_stream,
-                    subghz_gps->rx_buf + rx_offset,
-                    RX_BUF_SIZE - rx_offset,
-                    0);
-
-                if(len > 0) {
-                    rx_offset += len;
-                    subghz_gps->rx_buf[rx_offset] = '\0';
-
-                    char* current_line = (char*)subghz_gps->rx_buf;
-                    while(true) {
-                        while(*current_line == '\0' &&
-                              current_line < (char*)subghz_gps->rx_buf + rx_offset) {
-                            current_line++;
-                        }
-
-                        char* next_line = strchr(current_line, '\n');
-                        if(next_line) {
-                            *next_line = '\0';
-                            subghz_gps_uart_parse_nmea(subghz_gps, current_line);
-                            current_line = next_line + 1;
-                        } else {
-                            if(current_line > (char*)subghz_gps->rx_buf) {
-                                rx_offset = 0;
-                                while(*current_line) {
-                                    subghz_gps->rx_buf[rx_offset++] = *(current_line++);
-                                }
-                            }
-                            break;
-                        }
-                    }
-                }
+                    subghz_gps->rx_stream, subghz_gps->rx_buf, RX_CHUNK_SIZE, 0);
+                applied |= nmea_parser_feed(subghz_gps->parser, subghz_gps->rx_buf, len);
             } while(len > 0);
+
+            if(applied) subghz_gps_update(subghz_gps);
         }
     }
 
@@ -118,6 +61,7 @@ SubGhzGPS* subghz_gps_init() {
     subghz_gps->fix_second = 0;
 
     subghz_gps->rx_stream = furi_stream_buffer_alloc(RX_BUF_SIZE, 1);
+    subghz_gps->parser = nmea_parser_alloc();
 
     subghz_gps->thread = furi_thread_alloc();
     furi_thread_set_name(subghz_gps->thread, "SubGhzGPSWorker");
@@ -131,18 +75,17 @@ SubGhzGPS* subghz_gps_init() {
         furi_hal_uart_init(UART_CH, 9600);
     }
 
-    furi_hal_uart_set_irq_cb(UART_CH, subghz_gps_uart_on_irq_cb, subghz_gps);
-
     return subghz_gps;
 }
 
 void subghz_gps_deinit(SubGhzGPS* subghz_gps) {
     furi_assert(subghz_gps);
     furi_thread_free(subghz_gps->thread);
+    nmea_parser_free(subghz_gps->parser);
+    furi_stream_buffer_free(subghz_gps->rx_stream);
 
     free(subghz_gps);
 
-    furi_hal_uart_set_irq_cb(UART_CH, NULL, NULL);
     if(UART_CH == FuriHalUartIdLPUART1) {
         furi_hal_uart_deinit(UART_CH);
     } else {
@@ -152,9 +95,11 @@ void subghz_gps_deinit(SubGhzGPS* subghz_gps) {
 
 void subghz_gps_start(SubGhzGPS* subghz_gps) {
     furi_thread_start(subghz_gps->thread);
+    furi_hal_uart_dma_rx_start(UART_CH, subghz_gps_uart_on_rx_cb, subghz_gps);
 }
 
 void subghz_gps_stop(SubGhzGPS* subghz_gps) {
+    furi_hal_uart_dma_rx_stop(UART_CH);
     furi_thread_flags_set(furi_thread_get_id(subghz_gps->thread), WorkerEvtStop);
     furi_thread_join(subghz_gps->thread);
 }
@@ -1,11 +1,13 @@
 #include <furi_hal.h>
 #include <xtreme.h>
-#include "minmea.h"
+#include <nmea_parser.h>
+#include <math.h>
 
 #define UART_CH \
     (xtreme_settings.uart_nmea_channel == UARTDefault ? FuriHalUartIdUSART1 : FuriHalUartIdLPUART1)
 
 #define RX_BUF_SIZE 1024
+#define RX_CHUNK_SIZE 128
 
 typedef enum {
     WorkerEvtStop = (1 << 0),
@@ -17,7 +19,8 @@ typedef enum {
 typedef struct {
     FuriThread* thread;
     FuriStreamBuffer* rx_stream;
-    uint8_t rx_buf[RX_BUF_SIZE];
+    uint8_t rx_buf[RX_CHUNK_SIZE];
+    NmeaParser* parser;
 
     FuriTimer* timer;
 
@@ -17,6 +17,54 @@ static void subghz_txrx_radio_device_power_on(SubGhzTxRx* instance) {
     }
 }
 
+#define SUBGHZ_TXRX_HOPPER_RSSI_THRESHOLD (-90.0f)
+#define SUBGHZ_TXRX_HOPPER_STAY_TICKS 10
+#define SUBGHZ_TXRX_HOPPER_DWELL_MAX_TICKS 8
+#define SUBGHZ_TXRX_HOPPER_HIT_SCORE 32
+#define SUBGHZ_TXRX_HOPPER_DECODE_SCORE 128
+
+#define SUBGHZ_TXRX_MULTI_PRESET_SLOT_MS 250
+#define SUBGHZ_TXRX_MULTI_PRESET_AM "AM650"
+#define SUBGHZ_TXRX_MULTI_PRESET_FM "FM238"
+
+static void subghz_txrx_rx_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    SubGhzTxRx* instance = context;
+    // Called from worker threads, only flag it for hopper
+    instance->hopper_decoded = true;
+    if(instance->rx_callback) {
+        furi_check(furi_mutex_acquire(instance->rx_mutex, FuriWaitForever) == FuriStatusOk);
+        instance->rx_callback(receiver, decoder_base, instance->rx_callback_context);
+        furi_mutex_release(instance->rx_mutex);
+    }
+}
+
+static void subghz_txrx_receiver_reset(void* context) {
+    SubGhzTxRx* instance = context;
+    subghz_receiver_reset(instance->receiver);
+}
+
+static void subghz_txrx_decode_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    SubGhzTxRx* instance = context;
+
+    uint32_t generation;
+    SubGhzProtocolFlag modulation =
+        subghz_preset_scheduler_get_modulation(instance->preset_scheduler, &generation);
+    if(generation != instance->multi_preset_generation) {
+        // Preset switched, partial frames of the previous slot are garbage
+        instance->multi_preset_generation = generation;
+        subghz_receiver_reset(instance->receiver);
+        subghz_receiver_set_modulation(instance->receiver, modulation);
+    }
+
+    subghz_receiver_decode_batch(instance->receiver, level_duration, count);
+}
+
 static void subghz_txrx_radio_device_power_off(SubGhzTxRx* instance) {
     UNUSED(instance);
     if(furi_hal_power_is_otg_enabled()) furi_hal_power_disable_otg();
@@ -34,6 +82,11 @@ SubGhzTxRx* subghz_txrx_alloc() {
     instance->txrx_state = SubGhzTxRxStateSleep;
 
     subghz_txrx_hopper_set_state(instance, SubGhzHopperStateOFF);
+    instance->hopper_activity = NULL;
+    instance->hopper_activity_count = 0;
+    instance->hopper_dwell = 0;
+    instance->hopper_hits = 0;
+    instance->hopper_decoded = false;
     subghz_txrx_speaker_set_state(instance, SubGhzSpeakerStateDisable);
     subghz_txrx_set_debug_pin_state(instance, false);
 
@@ -51,12 +104,18 @@ SubGhzTxRx* subghz_txrx_alloc() {
     subghz_environment_set_protocol_registry(
         instance->environment, (void*)&subghz_protocol_registry);
     instance->receiver = subghz_receiver_alloc_init(instance->environment);
+    subghz_receiver_set_prefilter(instance->receiver, true);
+    instance->rx_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    memset(&instance->dual_rx, 0, sizeof(SubGhzTxRxDualRx));
+    subghz_txrx_set_rx_callback(instance, NULL, NULL);
+
+    instance->preset_scheduler = subghz_preset_scheduler_alloc();
+    instance->multi_preset = false;
+    instance->multi_preset_generation = 0;
 
-    subghz_worker_set_overrun_callback(
-        instance->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
-    subghz_worker_set_pair_callback(
-        instance->worker, (SubGhzWorkerPairCallback)subghz_receiver_decode);
-    subghz_worker_set_context(instance->worker, instance->receiver);
+    subghz_worker_set_overrun_callback(instance->worker, subghz_txrx_receiver_reset);
+    subghz_worker_set_pair_batch_callback(instance->worker, subghz_txrx_decode_batch);
+    subghz_worker_set_context(instance->worker, instance);
 
     //set default device External
     subghz_devices_init();
@@ -75,15 +134,19 @@ void subghz_txrx_free(SubGhzTxRx* instance) {
         subghz_devices_end(instance->radio_device);
     }
 
+    subghz_txrx_dual_rx_disable(instance);
     subghz_devices_deinit();
 
     subghz_worker_free(instance->worker);
+    subghz_preset_scheduler_free(instance->preset_scheduler);
     subghz_receiver_free(instance->receiver);
+    furi_mutex_free(instance->rx_mutex);
     subghz_environment_free(instance->environment);
     flipper_format_free(instance->fff_data);
     furi_string_free(instance->preset->name);
     subghz_setting_free(instance->setting);
 
+    free(instance->hopper_activity);
     free(instance->preset);
     free(instance);
 }
@@ -107,6 +170,15 @@ void subghz_txrx_set_preset(
     preset->frequency = frequency;
     preset->latitude = latitude;
     preset->longitude = longitude;
+    if(preset_data) {
+        // Interned copy stays valid if custom preset is deleted from setting
+        size_t preset_index = subghz_setting_intern_preset(
+            instance->setting,
+            furi_string_get_cstr(preset->name),
+            preset_data,
+            preset_data_size);
+        preset_data = subghz_setting_get_interned_preset_data(instance->setting, preset_index);
+    }
     preset->data = preset_data;
     preset->data_size = preset_data_size;
 }
@@ -180,6 +252,30 @@ static void subghz_txrx_begin(SubGhzTxRx* instance, uint8_t* preset_data) {
     instance->txrx_state = SubGhzTxRxStateIDLE;
 }
 
+static void subghz_txrx_dual_rx_start(SubGhzTxRx* instance) {
+    SubGhzTxRxDualRx* dual_rx = &instance->dual_rx;
+
+    subghz_devices_reset(dual_rx->device);
+    subghz_devices_idle(dual_rx->device);
+    subghz_devices_load_preset(dual_rx->device, FuriHalSubGhzPresetCustom, instance->preset->data);
+    subghz_devices_set_frequency(dual_rx->device, dual_rx->frequency);
+    subghz_devices_flush_rx(dual_rx->device);
+
+    subghz_devices_start_async_rx(dual_rx->device, subghz_worker_rx_callback, dual_rx->worker);
+    subghz_worker_start(dual_rx->worker);
+    dual_rx->is_running = true;
+}
+
+static void subghz_txrx_dual_rx_stop(SubGhzTxRx* instance) {
+    SubGhzTxRxDualRx* dual_rx = &instance->dual_rx;
+
+    subghz_worker_stop(dual_rx->worker);
+    subghz_devices_stop_async_rx(dual_rx->device);
+    subghz_devices_idle(dual_rx->device);
+    subghz_devices_sleep(dual_rx->device);
+    dual_rx->is_running = false;
+}
+
 static uint32_t subghz_txrx_rx(SubGhzTxRx* instance, uint32_t frequency) {
     furi_assert(instance);
     furi_assert(
@@ -194,6 +290,16 @@ static uint32_t subghz_txrx_rx(SubGhzTxRx* instance, uint32_t frequency) {
     subghz_devices_start_async_rx(
         instance->radio_device, subghz_worker_rx_callback, instance->worker);
     subghz_worker_start(instance->worker);
+    if(instance->multi_preset) {
+        subghz_preset_scheduler_start(
+            instance->preset_scheduler,
+            instance->radio_device,
+            frequency,
+            SUBGHZ_TXRX_MULTI_PRESET_SLOT_MS);
+    }
+    if(instance->dual_rx.worker) {
+        subghz_txrx_dual_rx_start(instance);
+    }
     instance->txrx_state = SubGhzTxRxStateRx;
     return value;
 }
@@ -211,6 +317,12 @@ static void subghz_txrx_rx_end(SubGhzTxRx* instance) {
     furi_assert(instance);
     furi_assert(instance->txrx_state == SubGhzTxRxStateRx);
 
+    if(instance->dual_rx.is_running) {
+        subghz_txrx_dual_rx_stop(instance);
+    }
+    if(subghz_preset_scheduler_is_running(instance->preset_scheduler)) {
+        subghz_preset_scheduler_stop(instance->preset_scheduler);
+    }
     if(subghz_worker_is_running(instance->worker)) {
         subghz_worker_stop(instance->worker);
         subghz_devices_stop_async_rx(instance->radio_device);
@@ -381,45 +493,34 @@ void subghz_txrx_stop(SubGhzTxRx* instance) {
     }
 }
 
-void subghz_txrx_hopper_update(SubGhzTxRx* instance) {
-    furi_assert(instance);
-
-    switch(instance->hopper_state) {
-    case SubGhzHopperStateOFF:
-    case SubGhzHopperStatePause:
-        return;
-    case SubGhzHopperStateRSSITimeOut:
-        if(instance->hopper_timeout != 0) {
-            instance->hopper_timeout--;
-            return;
-        }
-        break;
-    default:
-        break;
+static void subghz_txrx_hopper_next(SubGhzTxRx* instance) {
+    size_t count = subghz_setting_get_hopper_frequency_count(instance->setting);
+    if(instance->hopper_activity_count != count) {
+        free(instance->hopper_activity);
+        instance->hopper_activity = malloc(count);
+        memset(instance->hopper_activity, 0, count);
+        instance->hopper_activity_count = count;
     }
-    //    Init value isn't using
-    //    float rssi = -127.0f;
-    if(instance->hopper_state != SubGhzHopperStateRSSITimeOut) {
-        // See RSSI Calculation timings in CC1101 17.3 RSSI
-        float rssi = subghz_devices_get_rssi(instance->radio_device);
+    if(instance->hopper_idx_frequency >= count) instance->hopper_idx_frequency = 0;
+
+    // Fold activity seen during this visit into the score, moving average 1/4
+    uint8_t* activity = &instance->hopper_activity[instance->hopper_idx_frequency];
+    int32_t sample = MIN((int32_t)instance->hopper_hits, 255);
+    *activity = (uint8_t)(*activity + (sample - *activity) / 4);
+    instance->hopper_hits = 0;
 
-        // Stay if RSSI is high enough
-        if(rssi > -90.0f) {
-            instance->hopper_timeout = 10;
-            instance->hopper_state = SubGhzHopperStateRSSITimeOut;
-            return;
-        }
-    } else {
-        instance->hopper_state = SubGhzHopperStateRunning;
-    }
     // Select next frequency
-    if(instance->hopper_idx_frequency <
-       subghz_setting_get_hopper_frequency_count(instance->setting) - 1) {
+    if(instance->hopper_idx_frequency < count - 1) {
         instance->hopper_idx_frequency++;
     } else {
         instance->hopper_idx_frequency = 0;
     }
 
+    // Every frequency is visited every round, but active ones are listened longer
+    instance->hopper_dwell =
+        instance->hopper_activity[instance->hopper_idx_frequency] *
+        SUBGHZ_TXRX_HOPPER_DWELL_MAX_TICKS / 255;
+
     if(instance->txrx_state == SubGhzTxRxStateRx) {
         subghz_txrx_rx_end(instance);
     }
@@ -431,6 +532,53 @@ void subghz_txrx_hopper_update(SubGhzTxRx* instance) {
     }
 }
 
+void subghz_txrx_hopper_update(SubGhzTxRx* instance) {
+    furi_assert(instance);
+
+    if((instance->hopper_state == SubGhzHopperStateOFF) ||
+       (instance->hopper_state == SubGhzHopperStatePause)) {
+        return;
+    }
+
+    bool decoded = instance->hopper_decoded;
+    instance->hopper_decoded = false;
+    // See RSSI Calculation timings in CC1101 17.3 RSSI
+    bool active = subghz_devices_get_rssi(instance->radio_device) >
+                  SUBGHZ_TXRX_HOPPER_RSSI_THRESHOLD;
+
+    if(decoded) {
+        instance->hopper_hits = MIN(instance->hopper_hits + SUBGHZ_TXRX_HOPPER_DECODE_SCORE, 255);
+    } else if(active) {
+        instance->hopper_hits = MIN(instance->hopper_hits + SUBGHZ_TXRX_HOPPER_HIT_SCORE, 255);
+    }
+
+    if(instance->hopper_state == SubGhzHopperStateRSSITimeOut) {
+        // Stay while frames keep coming
+        if(decoded) {
+            instance->hopper_timeout = SUBGHZ_TXRX_HOPPER_STAY_TICKS;
+            return;
+        }
+        if(instance->hopper_timeout != 0) {
+            instance->hopper_timeout--;
+            return;
+        }
+        instance->hopper_state = SubGhzHopperStateRunning;
+    } else {
+        // Stay if RSSI is high enough or something was decoded
+        if(active || decoded) {
+            instance->hopper_timeout = SUBGHZ_TXRX_HOPPER_STAY_TICKS;
+            instance->hopper_state = SubGhzHopperStateRSSITimeOut;
+            return;
+        }
+        if(instance->hopper_dwell != 0) {
+            instance->hopper_dwell--;
+            return;
+        }
+    }
+
+    subghz_txrx_hopper_next(instance);
+}
+
 SubGhzHopperState subghz_txrx_hopper_get_state(SubGhzTxRx* instance) {
     furi_assert(instance);
     return instance->hopper_state;
@@ -567,13 +715,110 @@ bool subghz_txrx_protocol_is_transmittable(SubGhzTxRx* instance, bool check_type
 void subghz_txrx_receiver_set_filter(SubGhzTxRx* instance, SubGhzProtocolFlag filter) {
     furi_assert(instance);
     subghz_receiver_set_filter(instance->receiver, filter);
+    if(instance->dual_rx.receiver) {
+        subghz_receiver_set_filter(instance->dual_rx.receiver, filter);
+    }
 }
 
 void subghz_txrx_set_rx_callback(
     SubGhzTxRx* instance,
     SubGhzReceiverCallback callback,
     void* context) {
-    subghz_receiver_set_rx_callback(instance->receiver, callback, context);
+    furi_assert(instance);
+    instance->rx_callback = callback;
+    instance->rx_callback_context = context;
+    subghz_receiver_set_rx_callback(instance->receiver, subghz_txrx_rx_callback, instance);
+}
+
+bool subghz_txrx_dual_rx_enable(SubGhzTxRx* instance, uint32_t frequency) {
+    furi_assert(instance);
+    furi_assert(instance->txrx_state != SubGhzTxRxStateRx);
+
+    if(instance->radio_device_type != SubGhzRadioDeviceTypeExternalCC1101) return false;
+
+    const SubGhzDevice* device = subghz_devices_get_by_name(SUBGHZ_DEVICE_CC1101_INT_NAME);
+    if(!subghz_devices_is_frequency_valid(device, frequency)) return false;
+
+    SubGhzTxRxDualRx* dual_rx = &instance->dual_rx;
+    dual_rx->device = device;
+    dual_rx->frequency = frequency;
+    if(!dual_rx->worker) {
+        // Receiver allocates every decoder, so only pay for it while enabled
+        dual_rx->worker = subghz_worker_alloc();
+        dual_rx->receiver = subghz_receiver_alloc_init(instance->environment);
+        subghz_receiver_set_prefilter(dual_rx->receiver, true);
+        subghz_receiver_set_filter(dual_rx->receiver, SubGhzProtocolFlag_Decodable);
+        subghz_receiver_set_rx_callback(dual_rx->receiver, subghz_txrx_rx_callback, instance);
+
+        subghz_worker_set_overrun_callback(
+            dual_rx->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
+        subghz_worker_set_pair_batch_callback(
+            dual_rx->worker, (SubGhzWorkerPairBatchCallback)subghz_receiver_decode_batch);
+        subghz_worker_set_context(dual_rx->worker, dual_rx->receiver);
+    }
+
+    return true;
+}
+
+void subghz_txrx_dual_rx_disable(SubGhzTxRx* instance) {
+    furi_assert(instance);
+    SubGhzTxRxDualRx* dual_rx = &instance->dual_rx;
+    if(!dual_rx->worker) return;
+
+    if(dual_rx->is_running) {
+        subghz_txrx_dual_rx_stop(instance);
+    }
+    subghz_worker_free(dual_rx->worker);
+    subghz_receiver_free(dual_rx->receiver);
+    memset(dual_rx, 0, sizeof(SubGhzTxRxDualRx));
+}
+
+bool subghz_txrx_dual_rx_is_enabled(SubGhzTxRx* instance) {
+    furi_assert(instance);
+    return instance->dual_rx.worker != NULL;
+}
+
+SubGhzRadioDeviceType
+    subghz_txrx_get_receiver_radio_device(SubGhzTxRx* instance, SubGhzReceiver* receiver) {
+    furi_assert(instance);
+    if(receiver && receiver == instance->dual_rx.receiver) {
+        return SubGhzRadioDeviceTypeInternal;
+    }
+    return instance->radio_device_type;
+}
+
+SubGhzRadioPreset subghz_txrx_get_receiver_preset(SubGhzTxRx* instance, SubGhzReceiver* receiver) {
+    furi_assert(instance);
+    SubGhzRadioPreset preset = subghz_txrx_get_preset(instance);
+    if(receiver && receiver == instance->dual_rx.receiver) {
+        preset.frequency = instance->dual_rx.frequency;
+    }
+    return preset;
+}
+
+bool subghz_txrx_set_multi_preset(SubGhzTxRx* instance, bool enable) {
+    furi_assert(instance);
+    furi_assert(!subghz_preset_scheduler_is_running(instance->preset_scheduler));
+
+    subghz_preset_scheduler_clear(instance->preset_scheduler);
+    instance->multi_preset = false;
+    if(!enable) return true;
+
+    uint8_t* am_data = subghz_setting_get_preset_data_by_name(
+        instance->setting, SUBGHZ_TXRX_MULTI_PRESET_AM);
+    uint8_t* fm_data = subghz_setting_get_preset_data_by_name(
+        instance->setting, SUBGHZ_TXRX_MULTI_PRESET_FM);
+    if(!am_data || !fm_data) return false;
+
+    subghz_preset_scheduler_add(instance->preset_scheduler, am_data, SubGhzProtocolFlag_AM);
+    subghz_preset_scheduler_add(instance->preset_scheduler, fm_data, SubGhzProtocolFlag_FM);
+    instance->multi_preset = true;
+    return true;
+}
+
+bool subghz_txrx_get_multi_preset(SubGhzTxRx* instance) {
+    furi_assert(instance);
+    return instance->multi_preset;
 }
 
 void subghz_txrx_set_raw_file_encoder_worker_callback_end(
@@ -618,6 +863,8 @@ SubGhzRadioDeviceType
         subghz_devices_begin(instance->radio_device);
         instance->radio_device_type = SubGhzRadioDeviceTypeExternalCC1101;
     } else {
+        // Internal radio can't be both the selected and the second one
+        subghz_txrx_dual_rx_disable(instance);
         subghz_txrx_radio_device_power_off(instance);
         if(instance->radio_device_type != SubGhzRadioDeviceTypeInternal) {
             subghz_devices_end(instance->radio_device);
@@ -8,6 +8,7 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/protocols/raw.h>
 #include <lib/subghz/devices/devices.h>
+#include <lib/subghz/devices/preset_scheduler.h>
 
 typedef struct SubGhzTxRx SubGhzTxRx;
 
@@ -295,6 +296,71 @@ void subghz_txrx_set_rx_callback(
     SubGhzReceiverCallback callback,
     void* context);
 
+/**
+ * Enable or disable time-sliced AM/FM receive.
+ * While enabled, RX alternates AM650 and FM238 presets on the current frequency
+ * and feeds pulses only to protocols of the active modulation.
+ * Takes effect on next RX start.
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @param enable true to enable
+ * @return true if both presets are present in settings
+ */
+bool subghz_txrx_set_multi_preset(SubGhzTxRx* instance, bool enable);
+
+/**
+ * Get state of time-sliced AM/FM receive
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @return true if enabled
+ */
+bool subghz_txrx_get_multi_preset(SubGhzTxRx* instance);
+
+/**
+ * Enable receive on the internal radio in parallel with the selected external radio.
+ * Both radios use the current preset, results of both are delivered to rx callback,
+ * one call at a time. Takes effect on next RX start.
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @param frequency Frequency of the internal radio
+ * @return true if external radio is selected and frequency is valid for internal radio
+ */
+bool subghz_txrx_dual_rx_enable(SubGhzTxRx* instance, uint32_t frequency);
+
+/**
+ * Disable receive on the internal radio in parallel with the external radio
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ */
+void subghz_txrx_dual_rx_disable(SubGhzTxRx* instance);
+
+/**
+ * Check if dual radio receive is enabled
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @return true if enabled
+ */
+bool subghz_txrx_dual_rx_is_enabled(SubGhzTxRx* instance);
+
+/**
+ * Get radio device that a receiver passed to rx callback belongs to
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @param receiver Receiver passed to rx callback
+ * @return SubGhzRadioDeviceType
+ */
+SubGhzRadioDeviceType
+    subghz_txrx_get_receiver_radio_device(SubGhzTxRx* instance, SubGhzReceiver* receiver);
+
+/**
+ * Get preset that a receiver passed to rx callback is running with
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @param receiver Receiver passed to rx callback
+ * @return SubGhzRadioPreset, frequency is the one of the receiver radio
+ */
+SubGhzRadioPreset subghz_txrx_get_receiver_preset(SubGhzTxRx* instance, SubGhzReceiver* receiver);
+
 /**
  * Set callback for Raw decoder, end of data transfer  
  * 
@@ -2,6 +2,15 @@
 
 #include "subghz_txrx.h"
 
+/** Second receive path, runs on the internal radio while external one is selected */
+typedef struct {
+    const SubGhzDevice* device;
+    SubGhzWorker* worker;
+    SubGhzReceiver* receiver;
+    uint32_t frequency;
+    bool is_running;
+} SubGhzTxRxDualRx;
+
 struct SubGhzTxRx {
     SubGhzWorker* worker;
 
@@ -18,6 +27,25 @@ struct SubGhzTxRx {
     uint8_t hopper_idx_frequency;
     bool is_database_loaded;
     SubGhzHopperState hopper_state;
+    // Adaptive dwell: activity score per hopper frequency, hits seen on current one
+    uint8_t* hopper_activity;
+    size_t hopper_activity_count;
+    uint8_t hopper_dwell;
+    uint8_t hopper_hits;
+    volatile bool hopper_decoded;
+
+    // Time-sliced AM/FM receive, generation seen by the worker thread
+    SubGhzPresetScheduler* preset_scheduler;
+    bool multi_preset;
+    uint32_t multi_preset_generation;
+
+    // NULL worker if dual RX is disabled
+    SubGhzTxRxDualRx dual_rx;
+    // Serializes rx_callback calls from both workers
+    FuriMutex* rx_mutex;
+
+    SubGhzReceiverCallback rx_callback;
+    void* rx_callback_context;
 
     SubGhzTxRxState txrx_state;
     SubGhzSpeakerState speaker_state;
@@ -55,7 +55,8 @@ static void subghz_scene_add_to_history_callback(
     preset.latitude = subghz->gps->latitude;
     preset.longitude = subghz->gps->longitude;
 
-    if(subghz_history_add_to_history(subghz->history, decoder_base, &preset)) {
+    if(subghz_history_add_to_history(
+           subghz->history, decoder_base, &preset, SubGhzRadioDeviceTypeAuto)) {
         furi_string_reset(item_name);
         furi_string_reset(item_time);
 
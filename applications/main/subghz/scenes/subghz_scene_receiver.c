@@ -112,11 +112,16 @@ static void subghz_scene_add_to_history_callback(
         FuriString* item_time = furi_string_alloc();
         uint16_t idx = subghz_history_get_item(history);
 
-        SubGhzRadioPreset preset = subghz_txrx_get_preset(subghz->txrx);
+        // Each radio runs on its own frequency in dual RX
+        SubGhzRadioPreset preset = subghz_txrx_get_receiver_preset(subghz->txrx, receiver);
         preset.latitude = subghz->gps->latitude;
         preset.longitude = subghz->gps->longitude;
+        SubGhzRadioDeviceType radio_device = SubGhzRadioDeviceTypeAuto;
+        if(subghz_txrx_dual_rx_is_enabled(subghz->txrx)) {
+            radio_device = subghz_txrx_get_receiver_radio_device(subghz->txrx, receiver);
+        }
 
-        if(subghz_history_add_to_history(history, decoder_base, &preset)) {
+        if(subghz_history_add_to_history(history, decoder_base, &preset, radio_device)) {
             furi_string_reset(item_name);
             furi_string_reset(item_time);
 
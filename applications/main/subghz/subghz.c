@@ -215,7 +215,7 @@ SubGhz* subghz_alloc(bool alloc_for_tx_only) {
 #else
         subghz_txrx_set_default_preset(subghz->txrx, subghz->last_settings->frequency);
 #endif
-        subghz->history = subghz_history_alloc();
+        subghz->history = subghz_history_alloc(setting);
     }
 
     subghz_rx_key_state_set(subghz, SubGhzRxKeyStateIDLE);
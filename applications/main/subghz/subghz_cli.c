@@ -30,6 +30,9 @@
 
 #define TAG "SubGhzCli"
 
+// Rx RAW durations per stdout write
+#define SUBGHZ_CLI_RAW_FLUSH_COUNT 16
+
 static void subghz_cli_radio_device_power_on() {
     uint8_t attempts = 5;
     while(--attempts > 0) {
@@ -352,6 +355,8 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
         "Listening at frequency: %lu device: %lu. Press CTRL+C to stop\r\n",
         frequency,
         device_ind);
+    // Slow terminal must not stall decoder, drop output instead
+    cli_set_nonblocking_output(cli, true);
     LevelDuration level_duration;
     while(!cli_cmd_interrupt_received(cli)) {
         int ret = furi_stream_buffer_receive(
@@ -377,7 +382,9 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
 
     furi_hal_power_suppress_charge_exit();
 
+    size_t dropped = cli_set_nonblocking_output(cli, false);
     printf("\r\nPackets received %zu\r\n", instance->packet_count);
+    if(dropped) printf("Output dropped: %zu bytes\r\n", dropped);
 
     // Cleanup
     subghz_receiver_free(receiver);
@@ -424,12 +431,16 @@ void subghz_cli_command_rx_raw(Cli* cli, FuriString* args, void* context) {
 
     // Wait for packets to arrive
     printf("Listening at %lu. Press CTRL+C to stop\r\n", frequency);
+    // Slow terminal must not stall capture, drop output instead
+    cli_set_nonblocking_output(cli, true);
     LevelDuration level_duration;
     size_t counter = 0;
     while(!cli_cmd_interrupt_received(cli)) {
         int ret = furi_stream_buffer_receive(
             instance->stream, &level_duration, sizeof(LevelDuration), 10);
         if(ret == 0) {
+            // Idle, send out what is buffered so far
+            furi_thread_stdout_flush();
             continue;
         }
         if(ret != sizeof(LevelDuration)) {
@@ -443,8 +454,9 @@ void subghz_cli_command_rx_raw(Cli* cli, FuriString* args, void* context) {
             uint32_t duration = level_duration_get_duration(level_duration);
             printf("%c%lu ", level ? '+' : '-', duration);
         }
-        furi_thread_stdout_flush();
         counter++;
+        // Coalesce durations into bigger writes
+        if(counter % SUBGHZ_CLI_RAW_FLUSH_COUNT == 0) furi_thread_stdout_flush();
         if(counter > 255) {
             puts("\r\n");
             counter = 0;
@@ -457,6 +469,9 @@ void subghz_cli_command_rx_raw(Cli* cli, FuriString* args, void* context) {
 
     furi_hal_power_suppress_charge_exit();
 
+    size_t dropped = cli_set_nonblocking_output(cli, false);
+    if(dropped) printf("\r\nOutput dropped: %zu bytes\r\n", dropped);
+
     // Cleanup
     furi_stream_buffer_free(instance->stream);
     free(instance);
@@ -585,6 +600,8 @@ static void subghz_cli_command_print_usage() {
     printf("\trx <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Receive\r\n");
     printf("\trx_raw <frequency:in Hz>\t - Receive RAW\r\n");
     printf("\tdecode_raw <file_name: path_RAW_file>\t - Testing\r\n");
+    printf(
+        "\tconvert_raw <path_text_RAW_file> <path_binary_RAW_file>\t - Convert RAW file to compact binary format\r\n");
 
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
         printf("\r\n");
@@ -674,6 +691,38 @@ static void subghz_cli_command_encrypt_raw(Cli* cli, FuriString* args) {
     furi_string_free(source);
 }
 
+static void subghz_cli_command_convert_raw(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+
+    FuriString* source = furi_string_alloc();
+    FuriString* destination = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, source)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        if(!args_read_string_and_trim(args, destination)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        bool converted = subghz_protocol_raw_file_convert_to_varint(
+            storage, furi_string_get_cstr(source), furi_string_get_cstr(destination));
+        furi_record_close(RECORD_STORAGE);
+
+        if(!converted) {
+            printf("Failed to convert RAW file");
+            break;
+        }
+    } while(false);
+
+    furi_string_free(destination);
+    furi_string_free(source);
+}
+
 static void subghz_cli_command_chat(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     uint32_t frequency = 433920000;
@@ -902,6 +951,11 @@ static void subghz_cli_command(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "convert_raw") == 0) {
+            subghz_cli_command_convert_raw(cli, args);
+            break;
+        }
+
         if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
             if(furi_string_cmp_str(cmd, "encrypt_keeloq") == 0) {
                 subghz_cli_command_encrypt_keeloq(cli, args);
@@ -1,17 +1,36 @@
 #include "subghz_history.h"
 #include <lib/subghz/receiver.h>
+#include <storage/storage.h>
 
 #include <furi.h>
 
 #define SUBGHZ_HISTORY_MAX 55
+#define SUBGHZ_HISTORY_SPILL_MAX 500
 #define SUBGHZ_HISTORY_FREE_HEAP 20480
+#define SUBGHZ_HISTORY_SPILL_PATH EXT_PATH("subghz/.history.tmp")
+#define SUBGHZ_HISTORY_SPILL_BUFFER_SIZE 64
+#define SUBGHZ_HISTORY_ITEM_TEXT_SIZE 48
 #define TAG "SubGhzHistory"
 
 typedef struct {
-    FuriString* item_str;
+    union {
+        // Menu text, rendered on add for protocols without compact representation
+        char item_str[SUBGHZ_HISTORY_ITEM_TEXT_SIZE];
+        // Rendered to menu text only when requested
+        SubGhzProtocolDecoderCompact compact;
+    };
+    bool is_compact;
+    const char* protocol_name;
+    // Serialized item, NULL if it was spilled to SD
     FlipperFormat* flipper_string;
+    uint32_t spill_offset;
+    uint32_t spill_size;
     uint8_t type;
-    SubGhzRadioPreset* preset;
+    // SubGhzRadioDeviceType the item was received with
+    uint8_t radio_device;
+    // Interned in SubGhzSetting
+    uint16_t preset_index;
+    uint32_t frequency;
     FuriHalRtcDateTime datetime;
     float latitude;
     float longitude;
@@ -31,48 +50,158 @@ struct SubGhzHistory {
     uint8_t code_last_hash_data;
     FuriString* tmp_string;
     SubGhzHistoryStruct* history;
+    SubGhzSetting* setting;
+    // Filled from item on request
+    SubGhzRadioPreset preset;
+
+    // Append-only file with serialized items, NULL if SD is not available
+    Storage* storage;
+    File* spill_file;
+    uint32_t spill_file_size;
+    // Last item loaded back from SD
+    FlipperFormat* spill_loaded;
+    uint32_t spill_loaded_offset;
 };
 
-SubGhzHistory* subghz_history_alloc(void) {
+static void subghz_history_spill_open(SubGhzHistory* instance) {
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->spill_file = storage_file_alloc(instance->storage);
+    instance->spill_file_size = 0;
+    instance->spill_loaded = flipper_format_string_alloc();
+    instance->spill_loaded_offset = UINT32_MAX;
+
+    storage_simply_mkdir(instance->storage, SUBGHZ_RAW_FOLDER);
+    if(!storage_file_open(
+           instance->spill_file, SUBGHZ_HISTORY_SPILL_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+        FURI_LOG_W(TAG, "No SD, history is kept in RAM");
+        storage_file_free(instance->spill_file);
+        instance->spill_file = NULL;
+    }
+}
+
+static void subghz_history_spill_close(SubGhzHistory* instance) {
+    if(instance->spill_file) {
+        storage_file_close(instance->spill_file);
+        storage_file_free(instance->spill_file);
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_SPILL_PATH);
+    }
+    flipper_format_free(instance->spill_loaded);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static bool subghz_history_spill_write(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    if(!instance->spill_file) return false;
+
+    Stream* stream = flipper_format_get_raw_stream(item->flipper_string);
+    uint8_t buffer[SUBGHZ_HISTORY_SPILL_BUFFER_SIZE];
+    bool result = storage_file_seek(instance->spill_file, instance->spill_file_size, true);
+    size_t size = 0;
+
+    stream_rewind(stream);
+    while(result) {
+        size_t read = stream_read(stream, buffer, sizeof(buffer));
+        if(!read) break;
+        result = storage_file_write(instance->spill_file, buffer, read) == read;
+        size += read;
+    }
+
+    if(result) {
+        item->spill_offset = instance->spill_file_size;
+        item->spill_size = size;
+        instance->spill_file_size += size;
+    } else {
+        FURI_LOG_E(TAG, "Spill write error, item is kept in RAM");
+    }
+    return result;
+}
+
+static bool subghz_history_spill_read(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    if(instance->spill_loaded_offset == item->spill_offset) return true;
+
+    Stream* stream = flipper_format_get_raw_stream(instance->spill_loaded);
+    uint8_t buffer[SUBGHZ_HISTORY_SPILL_BUFFER_SIZE];
+    bool result = storage_file_seek(instance->spill_file, item->spill_offset, true);
+    size_t left = item->spill_size;
+
+    stream_clean(stream);
+    while(result && left) {
+        size_t chunk = MIN(left, sizeof(buffer));
+        result = (storage_file_read(instance->spill_file, buffer, chunk) == chunk) &&
+                 (stream_write(stream, buffer, chunk) == chunk);
+        left -= chunk;
+    }
+
+    if(result) {
+        instance->spill_loaded_offset = item->spill_offset;
+    } else {
+        FURI_LOG_E(TAG, "Spill read error");
+        stream_clean(stream);
+        instance->spill_loaded_offset = UINT32_MAX;
+    }
+    return result;
+}
+
+static void subghz_history_item_free(SubGhzHistoryItem* item) {
+    if(item->flipper_string) flipper_format_free(item->flipper_string);
+    item->type = 0;
+}
+
+static uint16_t subghz_history_get_max(SubGhzHistory* instance) {
+    return instance->spill_file ? SUBGHZ_HISTORY_SPILL_MAX : SUBGHZ_HISTORY_MAX;
+}
+
+SubGhzHistory* subghz_history_alloc(SubGhzSetting* setting) {
+    furi_assert(setting);
     SubGhzHistory* instance = malloc(sizeof(SubGhzHistory));
     instance->tmp_string = furi_string_alloc();
+    instance->setting = setting;
+    instance->preset.name = furi_string_alloc();
     instance->history = malloc(sizeof(SubGhzHistoryStruct));
     SubGhzHistoryItemArray_init(instance->history->data);
+    subghz_history_spill_open(instance);
     return instance;
 }
 
 void subghz_history_free(SubGhzHistory* instance) {
     furi_assert(instance);
     furi_string_free(instance->tmp_string);
+    furi_string_free(instance->preset.name);
     for
         M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
+            subghz_history_item_free(item);
         }
     SubGhzHistoryItemArray_clear(instance->history->data);
     free(instance->history);
+    subghz_history_spill_close(instance);
     free(instance);
 }
 
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset->frequency;
+    return item->frequency;
 }
 
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset;
+    SubGhzRadioPreset* preset = &instance->preset;
+    furi_string_set(
+        preset->name,
+        subghz_setting_get_interned_preset_name(instance->setting, item->preset_index));
+    preset->frequency = item->frequency;
+    preset->data = subghz_setting_get_interned_preset_data(instance->setting, item->preset_index);
+    preset->data_size =
+        subghz_setting_get_interned_preset_data_size(instance->setting, item->preset_index);
+    preset->latitude = item->latitude;
+    preset->longitude = item->longitude;
+    return preset;
 }
 
 const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return furi_string_get_cstr(item->preset->name);
+    return subghz_setting_get_interned_preset_name(instance->setting, item->preset_index);
 }
 
 float subghz_history_get_latitude(SubGhzHistory* instance, uint16_t idx) {
@@ -92,15 +221,18 @@ void subghz_history_reset(SubGhzHistory* instance) {
     furi_string_reset(instance->tmp_string);
     for
         M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
+            subghz_history_item_free(item);
         }
     SubGhzHistoryItemArray_reset(instance->history->data);
     instance->last_index_write = 0;
     instance->code_last_hash_data = 0;
+
+    if(instance->spill_file) {
+        storage_file_seek(instance->spill_file, 0, true);
+        storage_file_truncate(instance->spill_file);
+        instance->spill_file_size = 0;
+    }
+    instance->spill_loaded_offset = UINT32_MAX;
 }
 
 void subghz_history_delete_item(SubGhzHistory* instance, uint16_t item_id) {
@@ -113,11 +245,8 @@ void subghz_history_delete_item(SubGhzHistory* instance, uint16_t item_id) {
         SubGhzHistoryItem* item = SubGhzHistoryItemArray_ref(it);
 
         if(it->index == (size_t)(item_id)) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
+            // Spilled data stays in the file until reset
+            subghz_history_item_free(item);
             SubGhzHistoryItemArray_remove(instance->history->data, it);
         }
         SubGhzHistoryItemArray_previous(it);
@@ -139,17 +268,12 @@ uint8_t subghz_history_get_type_protocol(SubGhzHistory* instance, uint16_t idx)
 const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(!item || !item->flipper_string) {
+    if(!item) {
         FURI_LOG_E(TAG, "Missing Item");
         furi_string_reset(instance->tmp_string);
         return furi_string_get_cstr(instance->tmp_string);
     }
-    flipper_format_rewind(item->flipper_string);
-    if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-        FURI_LOG_E(TAG, "Missing Protocol");
-        furi_string_reset(instance->tmp_string);
-    }
-    return furi_string_get_cstr(instance->tmp_string);
+    return item->protocol_name;
 }
 
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx) {
@@ -157,6 +281,8 @@ FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
     if(item->flipper_string) {
         return item->flipper_string;
+    } else if(subghz_history_spill_read(instance, item)) {
+        return instance->spill_loaded;
     } else {
         return NULL;
     }
@@ -167,14 +293,15 @@ bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* out
         if(output != NULL) furi_string_printf(output, "    Free heap LOW");
         return true;
     }
-    if(instance->last_index_write == SUBGHZ_HISTORY_MAX) {
+    uint16_t history_max = subghz_history_get_max(instance);
+    if(instance->last_index_write >= history_max) {
         if(output != NULL) furi_string_printf(output, "   Memory is FULL");
         return true;
     }
     if(output != NULL) {
         if(sats == 0) {
             furi_string_printf(
-                output, "%02u/%02u", instance->last_index_write, SUBGHZ_HISTORY_MAX);
+                output, "%02u/%02u", instance->last_index_write, history_max);
             return false;
         } else {
             FuriHalRtcDateTime datetime;
@@ -182,7 +309,7 @@ bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* out
 
             if(furi_hal_rtc_datetime_to_timestamp(&datetime) % 2) {
                 furi_string_printf(
-                    output, "%02u/%02u", instance->last_index_write, SUBGHZ_HISTORY_MAX);
+                    output, "%02u/%02u", instance->last_index_write, history_max);
             } else {
                 furi_string_printf(output, "%d sats", sats);
             }
@@ -194,26 +321,71 @@ bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* out
 uint16_t subghz_history_get_last_index(SubGhzHistory* instance) {
     return instance->last_index_write;
 }
+static void subghz_history_format_text(
+    FuriString* output,
+    const char* protocol_name,
+    const char* manufacture,
+    uint64_t data) {
+    if(!strcmp(protocol_name, "KeeLoq")) {
+        furi_string_printf(output, "KL %s", manufacture ? manufacture : "");
+    } else if(!strcmp(protocol_name, "Star Line")) {
+        furi_string_printf(output, "SL %s", manufacture ? manufacture : "");
+    } else {
+        furi_string_set_str(output, protocol_name);
+    }
+
+    if(data != 0) {
+        if(!(uint32_t)(data >> 32)) {
+            furi_string_cat_printf(output, " %lX", (uint32_t)(data & 0xFFFFFFFF));
+        } else {
+            furi_string_cat_printf(
+                output, " %lX%08lX", (uint32_t)(data >> 32), (uint32_t)(data & 0xFFFFFFFF));
+        }
+    }
+}
+
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    furi_string_set(output, item->item_str);
+    if(item->is_compact) {
+        subghz_history_format_text(
+            output, item->protocol_name, item->compact.manufacture, item->compact.key);
+        // Same length limit as for items rendered on add
+        if(furi_string_size(output) >= SUBGHZ_HISTORY_ITEM_TEXT_SIZE) {
+            furi_string_left(output, SUBGHZ_HISTORY_ITEM_TEXT_SIZE - 1);
+        }
+    } else {
+        furi_string_set_str(output, item->item_str);
+    }
 }
 
 void subghz_history_get_time_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
     FuriHalRtcDateTime* t = &item->datetime;
-    furi_string_printf(output, "%.2d:%.2d:%.2d ", t->hour, t->minute, t->second);
+    const char* tag = "";
+    if(item->radio_device == SubGhzRadioDeviceTypeInternal) {
+        tag = "Int ";
+    } else if(item->radio_device == SubGhzRadioDeviceTypeExternalCC1101) {
+        tag = "Ext ";
+    }
+    furi_string_printf(output, "%s%.2d:%.2d:%.2d ", tag, t->hour, t->minute, t->second);
+}
+
+SubGhzRadioDeviceType subghz_history_get_radio_device(SubGhzHistory* instance, uint16_t idx) {
+    furi_assert(instance);
+    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
+    return item->radio_device;
 }
 
 bool subghz_history_add_to_history(
     SubGhzHistory* instance,
     void* context,
-    SubGhzRadioPreset* preset) {
+    SubGhzRadioPreset* preset,
+    SubGhzRadioDeviceType radio_device) {
     furi_assert(instance);
     furi_assert(context);
 
     if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return false;
-    if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return false;
+    if(instance->last_index_write >= subghz_history_get_max(instance)) return false;
 
     SubGhzProtocolDecoderBase* decoder_base = context;
     if((instance->code_last_hash_data ==
@@ -226,81 +398,70 @@ bool subghz_history_add_to_history(
     instance->code_last_hash_data = subghz_protocol_decoder_base_get_hash_data(decoder_base);
     instance->last_update_timestamp = furi_get_tick();
 
-    FuriString* text = furi_string_alloc();
     SubGhzHistoryItem* item = SubGhzHistoryItemArray_push_raw(instance->history->data);
-    item->preset = malloc(sizeof(SubGhzRadioPreset));
     item->type = decoder_base->protocol->type;
-    item->preset->frequency = preset->frequency;
-    item->preset->name = furi_string_alloc();
-    furi_string_set(item->preset->name, preset->name);
-    item->preset->data = preset->data;
-    item->preset->data_size = preset->data_size;
+    item->radio_device = radio_device;
+    item->frequency = preset->frequency;
+    item->preset_index = subghz_setting_intern_preset(
+        instance->setting,
+        furi_string_get_cstr(preset->name),
+        preset->data,
+        preset->data_size);
     furi_hal_rtc_get_datetime(&item->datetime);
     item->latitude = preset->latitude;
     item->longitude = preset->longitude;
 
-    item->item_str = furi_string_alloc();
+    item->protocol_name = decoder_base->protocol->name;
     item->flipper_string = flipper_format_string_alloc();
     subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
 
-    do {
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
-            break;
-        }
-        if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-            FURI_LOG_E(TAG, "Missing Protocol");
-            break;
-        }
-        if(!strcmp(furi_string_get_cstr(instance->tmp_string), "KeeLoq")) {
-            furi_string_set(instance->tmp_string, "KL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
+    item->is_compact = subghz_protocol_decoder_base_get_compact(decoder_base, &item->compact);
+    if(!item->is_compact) {
+        FuriString* text = furi_string_alloc();
+        const char* manufacture = NULL;
+        uint64_t data = 0;
+        do {
+            if(!flipper_format_rewind(item->flipper_string)) {
+                FURI_LOG_E(TAG, "Rewind error");
                 break;
             }
-            furi_string_cat(instance->tmp_string, text);
-        } else if(!strcmp(furi_string_get_cstr(instance->tmp_string), "Star Line")) {
-            furi_string_set(instance->tmp_string, "SL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
+            if(!flipper_format_read_string(item->flipper_string, "Protocol", text)) {
                 FURI_LOG_E(TAG, "Missing Protocol");
                 break;
             }
-            furi_string_cat(instance->tmp_string, text);
-        }
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
-            break;
-        }
-        uint8_t key_data[sizeof(uint64_t)] = {0};
-        if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
-            FURI_LOG_D(TAG, "No Key");
-        }
-        uint64_t data = 0;
-        for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
-            data = (data << 8) | key_data[i];
-        }
-        if(data != 0) {
-            if(!(uint32_t)(data >> 32)) {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            } else {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX%08lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data >> 32),
-                    (uint32_t)(data & 0xFFFFFFFF));
+            if(!strcmp(furi_string_get_cstr(text), "KeeLoq") ||
+               !strcmp(furi_string_get_cstr(text), "Star Line")) {
+                if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
+                    FURI_LOG_E(TAG, "Missing Protocol");
+                    break;
+                }
+                manufacture = furi_string_get_cstr(text);
             }
-        } else {
-            furi_string_printf(item->item_str, "%s", furi_string_get_cstr(instance->tmp_string));
-        }
+            if(!flipper_format_rewind(item->flipper_string)) {
+                FURI_LOG_E(TAG, "Rewind error");
+                break;
+            }
+            uint8_t key_data[sizeof(uint64_t)] = {0};
+            if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
+                FURI_LOG_D(TAG, "No Key");
+            }
+            for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
+                data = (data << 8) | key_data[i];
+            }
+        } while(false);
+
+        subghz_history_format_text(instance->tmp_string, item->protocol_name, manufacture, data);
+        strlcpy(
+            item->item_str, furi_string_get_cstr(instance->tmp_string), sizeof(item->item_str));
+        furi_string_free(text);
+    }
 
-    } while(false);
+    // Only summary stays in RAM if serialized item made it to SD
+    if(subghz_history_spill_write(instance, item)) {
+        flipper_format_free(item->flipper_string);
+        item->flipper_string = NULL;
+    }
 
-    furi_string_free(text);
     instance->last_index_write++;
     return true;
 }
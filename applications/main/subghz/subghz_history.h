@@ -6,14 +6,17 @@
 #include <furi_hal.h>
 #include <lib/flipper_format/flipper_format.h>
 #include <lib/subghz/types.h>
+#include <lib/subghz/subghz_setting.h>
+#include "helpers/subghz_types.h"
 
 typedef struct SubGhzHistory SubGhzHistory;
 
 /** Allocate SubGhzHistory
  * 
+ * @param setting - SubGhzSetting instance, presets of items are interned there
  * @return SubGhzHistory* 
  */
-SubGhzHistory* subghz_history_alloc(void);
+SubGhzHistory* subghz_history_alloc(SubGhzSetting* setting);
 
 /** Free SubGhzHistory
  * 
@@ -37,6 +40,12 @@ void subghz_history_delete_item(SubGhzHistory* instance, uint16_t item_id);
  */
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx);
 
+/** Get radio preset to history[idx]
+ * 
+ * @param instance  - SubGhzHistory instance
+ * @param idx       - record index  
+ * @return preset   - valid until next call
+ */
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx);
 
 /** Get preset to history[idx]
@@ -78,7 +87,7 @@ const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t i
  */
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx);
 
-/** Get time item menu to history[idx]
+/** Get time item menu to history[idx], prefixed with radio tag if item has one
  * 
  * @param instance  - SubGhzHistory instance
  * @param output    - FuriString* output
@@ -107,12 +116,22 @@ uint16_t subghz_history_get_last_index(SubGhzHistory* instance);
  * @param instance  - SubGhzHistory instance
  * @param context    - SubGhzProtocolCommon context
  * @param preset    - SubGhzRadioPreset preset
+ * @param radio_device - radio tag, SubGhzRadioDeviceTypeAuto for untagged item
  * @return bool;
  */
 bool subghz_history_add_to_history(
     SubGhzHistory* instance,
     void* context,
-    SubGhzRadioPreset* preset);
+    SubGhzRadioPreset* preset,
+    SubGhzRadioDeviceType radio_device);
+
+/** Get radio tag of history[idx]
+ * 
+ * @param instance  - SubGhzHistory instance
+ * @param idx       - record index
+ * @return SubGhzRadioDeviceType, SubGhzRadioDeviceTypeAuto if untagged
+ */
+SubGhzRadioDeviceType subghz_history_get_radio_device(SubGhzHistory* instance, uint16_t idx);
 
 /** Get SubGhzProtocolCommonLoad to load into the protocol decoder bin data
  * 
@@ -82,6 +82,7 @@ struct U2fData {
     uint8_t cert_key[32];
     uint32_t counter;
     const struct uECC_Curve_t* p_curve;
+    uECC_SignPrecomp sign_precomp;
     bool ready;
     bool user_present;
     U2fEvtCallback callback;
@@ -99,9 +100,23 @@ U2fData* u2f_alloc() {
 
 void u2f_free(U2fData* U2F) {
     furi_assert(U2F);
+    memset(&U2F->sign_precomp, 0, sizeof(U2F->sign_precomp));
     free(U2F);
 }
 
+// Scalar multiplication is almost all of signing time, do it while waiting for user
+static void u2f_sign_prepare(U2fData* U2F) {
+    if(U2F->sign_precomp.curve == NULL) {
+        uECC_sign_precompute(&U2F->sign_precomp, U2F->p_curve);
+    }
+}
+
+static void u2f_sign(U2fData* U2F, const uint8_t* key, const uint8_t* hash, uint8_t* signature) {
+    if(!uECC_sign_precomputed(key, hash, 32, &U2F->sign_precomp, signature, U2F->p_curve)) {
+        uECC_sign(key, hash, 32, signature, U2F->p_curve);
+    }
+}
+
 bool u2f_init(U2fData* U2F) {
     furi_assert(U2F);
 
@@ -131,6 +146,7 @@ bool u2f_init(U2fData* U2F) {
 
     U2F->p_curve = uECC_secp256r1();
     uECC_set_rng(u2f_uecc_random);
+    u2f_sign_prepare(U2F);
 
     U2F->ready = true;
     return true;
@@ -196,6 +212,7 @@ static uint16_t u2f_register(U2fData* U2F, uint8_t* buf) {
 
     if(U2F->callback != NULL) U2F->callback(U2fNotifyRegister, U2F->context);
     if(U2F->user_present == false) {
+        u2f_sign_prepare(U2F);
         memcpy(&buf[0], state_user_missing, 2);
         return 2;
     }
@@ -234,7 +251,7 @@ static uint16_t u2f_register(U2fData* U2F, uint8_t* buf) {
     sha256_update(&sha_ctx, (uint8_t*)&pub_key, 65);
     sha256_finish(&sha_ctx, hash);
 
-    uECC_sign(U2F->cert_key, hash, 32, signature, U2F->p_curve);
+    u2f_sign(U2F, U2F->cert_key, hash, signature);
 
     // Encode response message
     resp->reserved = 0x05;
@@ -271,6 +288,7 @@ static uint16_t u2f_authenticate(U2fData* U2F, uint8_t* buf) {
         flags |= 1;
     } else {
         if(req->p1 == U2fEnforce) {
+            u2f_sign_prepare(U2F);
             memcpy(&buf[0], state_user_missing, 2);
             return 2;
         }
@@ -307,11 +325,12 @@ static uint16_t u2f_authenticate(U2fData* U2F, uint8_t* buf) {
     }
 
     if(req->p1 == U2fCheckOnly) { // Check-only: don't need to send full response
+        u2f_sign_prepare(U2F);
         memcpy(&buf[0], state_user_missing, 2);
         return 2;
     }
 
-    uECC_sign(priv_key, hash, 32, signature, U2F->p_curve);
+    u2f_sign(U2F, priv_key, hash, signature);
 
     resp->user_present = flags;
     resp->counter = be_u2f_counter;
@@ -3,19 +3,191 @@
 #include <furi.h>
 #include <furi_hal_bt.h>
 #include <lib/toolbox/saved_struct.h>
+#include <lib/toolbox/crc32_calc.h>
 #include <storage/storage.h>
 
 #define BT_KEYS_STORAGE_VERSION (0)
 #define BT_KEYS_STORAGE_MAGIC (0x18)
 
+#define BT_KEYS_STORAGE_JOURNAL_SUFFIX ".journal"
+#define BT_KEYS_STORAGE_JOURNAL_VERSION (0)
+#define BT_KEYS_STORAGE_JOURNAL_MAGIC (0x19)
+/** Journal is folded into main file once it grows past this */
+#define BT_KEYS_STORAGE_JOURNAL_LIMIT (2048)
+
 #define TAG "BtKeyStorage"
 
+/** Journal is only valid on top of the exact main file it was started for */
+typedef struct {
+    uint8_t magic;
+    uint8_t version;
+    uint16_t base_size;
+    uint32_t base_crc;
+} BtKeysStorageJournalHeader;
+
+/** Changed region of NVM buffer, followed by data. Blob ends where last record ends */
+typedef struct {
+    uint16_t offset;
+    uint16_t size;
+    uint32_t crc;
+} BtKeysStorageJournalRecord;
+
 struct BtKeysStorage {
     uint8_t* nvm_sram_buff;
     uint16_t nvm_sram_buff_size;
     FuriString* file_path;
+    FuriString* journal_path;
+
+    bool base_valid;
+    uint16_t base_size;
+    uint32_t base_crc;
+    uint32_t journal_size;
 };
 
+static void bt_keys_storage_reset_state(BtKeysStorage* instance) {
+    furi_string_printf(
+        instance->journal_path,
+        "%s" BT_KEYS_STORAGE_JOURNAL_SUFFIX,
+        furi_string_get_cstr(instance->file_path));
+    instance->base_valid = false;
+    instance->journal_size = 0;
+}
+
+static uint32_t
+    bt_keys_storage_record_crc(const BtKeysStorageJournalRecord* record, const uint8_t* data) {
+    uint32_t crc = crc32_calc_buffer(0, record, offsetof(BtKeysStorageJournalRecord, crc));
+    return crc32_calc_buffer(crc, data, record->size);
+}
+
+static void bt_keys_storage_journal_remove(BtKeysStorage* instance) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, furi_string_get_cstr(instance->journal_path));
+    furi_record_close(RECORD_STORAGE);
+    instance->journal_size = 0;
+}
+
+static bool bt_keys_storage_journal_replay(BtKeysStorage* instance) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(instance->nvm_sram_buff_size);
+    bool intact = true;
+
+    instance->journal_size = 0;
+    do {
+        if(!storage_file_open(
+               file,
+               furi_string_get_cstr(instance->journal_path),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        BtKeysStorageJournalHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header) ||
+           header.magic != BT_KEYS_STORAGE_JOURNAL_MAGIC ||
+           header.version != BT_KEYS_STORAGE_JOURNAL_VERSION ||
+           header.base_size != instance->base_size || header.base_crc != instance->base_crc) {
+            FURI_LOG_W(TAG, "Stale journal, ignoring");
+            intact = false;
+            break;
+        }
+        instance->journal_size = sizeof(header);
+
+        size_t replayed = 0;
+        BtKeysStorageJournalRecord record;
+        while(storage_file_read(file, &record, sizeof(record)) == sizeof(record)) {
+            // Torn write at the end is expected after power loss, keep what was complete
+            if(record.offset + record.size > instance->nvm_sram_buff_size ||
+               storage_file_read(file, data, record.size) != record.size ||
+               bt_keys_storage_record_crc(&record, data) != record.crc) {
+                FURI_LOG_W(TAG, "Journal record %zu is broken", replayed);
+                intact = false;
+                break;
+            }
+
+            furi_hal_bt_nvm_sram_sem_acquire();
+            memcpy(instance->nvm_sram_buff + record.offset, data, record.size);
+            furi_hal_bt_nvm_sram_sem_release();
+
+            instance->journal_size += sizeof(record) + record.size;
+            replayed++;
+        }
+
+        if(intact && storage_file_tell(file) != storage_file_size(file)) intact = false;
+        FURI_LOG_I(TAG, "Replayed %zu journal records", replayed);
+    } while(false);
+
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return intact;
+}
+
+static bool bt_keys_storage_journal_append(
+    BtKeysStorage* instance,
+    uint16_t offset,
+    const uint8_t* data,
+    uint16_t size) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool appended = false;
+
+    do {
+        bool start = instance->journal_size == 0;
+        if(!storage_file_open(
+               file,
+               furi_string_get_cstr(instance->journal_path),
+               FSAM_WRITE,
+               start ? FSOM_CREATE_ALWAYS : FSOM_OPEN_APPEND)) {
+            break;
+        }
+
+        if(start) {
+            BtKeysStorageJournalHeader header = {
+                .magic = BT_KEYS_STORAGE_JOURNAL_MAGIC,
+                .version = BT_KEYS_STORAGE_JOURNAL_VERSION,
+                .base_size = instance->base_size,
+                .base_crc = instance->base_crc,
+            };
+            if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+            instance->journal_size = sizeof(header);
+        }
+
+        BtKeysStorageJournalRecord record = {.offset = offset, .size = size};
+        record.crc = bt_keys_storage_record_crc(&record, data);
+        if(storage_file_write(file, &record, sizeof(record)) != sizeof(record)) break;
+        if(storage_file_write(file, data, size) != size) break;
+
+        instance->journal_size += sizeof(record) + size;
+        appended = true;
+    } while(false);
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return appended;
+}
+
+static bool bt_keys_storage_compact(BtKeysStorage* instance, const uint8_t* data, uint16_t size) {
+    if(!saved_struct_save(
+           furi_string_get_cstr(instance->file_path),
+           data,
+           size,
+           BT_KEYS_STORAGE_MAGIC,
+           BT_KEYS_STORAGE_VERSION)) {
+        instance->base_valid = false;
+        return false;
+    }
+
+    instance->base_valid = true;
+    instance->base_size = size;
+    instance->base_crc = crc32_calc_buffer(0, data, size);
+    bt_keys_storage_journal_remove(instance);
+
+    return true;
+}
+
 bool bt_keys_storage_delete(BtKeysStorage* instance) {
     furi_assert(instance);
 
@@ -40,6 +212,8 @@ BtKeysStorage* bt_keys_storage_alloc(const char* keys_storage_path) {
     // Set key storage file
     instance->file_path = furi_string_alloc();
     furi_string_set_str(instance->file_path, keys_storage_path);
+    instance->journal_path = furi_string_alloc();
+    bt_keys_storage_reset_state(instance);
 
     return instance;
 }
@@ -47,6 +221,7 @@ BtKeysStorage* bt_keys_storage_alloc(const char* keys_storage_path) {
 void bt_keys_storage_free(BtKeysStorage* instance) {
     furi_assert(instance);
 
+    furi_string_free(instance->journal_path);
     furi_string_free(instance->file_path);
     free(instance);
 }
@@ -56,6 +231,7 @@ void bt_keys_storage_set_file_path(BtKeysStorage* instance, const char* path) {
     furi_assert(path);
 
     furi_string_set_str(instance->file_path, path);
+    bt_keys_storage_reset_state(instance);
 }
 
 void bt_keys_storage_set_ram_params(BtKeysStorage* instance, uint8_t* buff, uint16_t size) {
@@ -70,6 +246,7 @@ bool bt_keys_storage_load(BtKeysStorage* instance) {
     furi_assert(instance);
 
     bool loaded = false;
+    bt_keys_storage_reset_state(instance);
     do {
         // Get payload size
         size_t payload_size = 0;
@@ -95,12 +272,23 @@ bool bt_keys_storage_load(BtKeysStorage* instance) {
             payload_size,
             BT_KEYS_STORAGE_MAGIC,
             BT_KEYS_STORAGE_VERSION);
+        if(data_loaded) {
+            instance->base_crc = crc32_calc_buffer(0, instance->nvm_sram_buff, payload_size);
+        }
         furi_hal_bt_nvm_sram_sem_release();
         if(!data_loaded) {
             FURI_LOG_E(TAG, "Failed to load struct");
             break;
         }
 
+        instance->base_valid = true;
+        instance->base_size = payload_size;
+        if(!bt_keys_storage_journal_replay(instance)) {
+            // Start over from what was recovered, so broken tail is not appended to
+            bt_keys_storage_journal_remove(instance);
+            instance->base_valid = false;
+        }
+
         loaded = true;
     } while(false);
 
@@ -121,20 +309,44 @@ bool bt_keys_storage_update(BtKeysStorage* instance, uint8_t* start_addr, uint32
         size);
 
     do {
-        size_t new_size = start_addr - instance->nvm_sram_buff + size;
+        size_t offset = start_addr - instance->nvm_sram_buff;
+        size_t new_size = offset + size;
         if(new_size > instance->nvm_sram_buff_size) {
             FURI_LOG_E(TAG, "NVM RAM buffer overflow");
             break;
         }
 
+        // Fold journal into main file when there is nothing to append to or it grew too big
+        bool compact = !instance->base_valid ||
+                       instance->journal_size + sizeof(BtKeysStorageJournalRecord) + size >
+                           BT_KEYS_STORAGE_JOURNAL_LIMIT;
+
+        // Copy changed data out, so radio stack is not blocked while storage is written
+        size_t copy_offset = compact ? 0 : offset;
+        size_t copy_size = new_size - copy_offset;
+        uint8_t* data = malloc(copy_size);
         furi_hal_bt_nvm_sram_sem_acquire();
-        bool data_updated = saved_struct_save(
-            furi_string_get_cstr(instance->file_path),
-            instance->nvm_sram_buff,
-            new_size,
-            BT_KEYS_STORAGE_MAGIC,
-            BT_KEYS_STORAGE_VERSION);
+        memcpy(data, instance->nvm_sram_buff + copy_offset, copy_size);
         furi_hal_bt_nvm_sram_sem_release();
+
+        bool data_updated = false;
+        if(!compact) {
+            data_updated = bt_keys_storage_journal_append(instance, offset, data, size);
+            if(!data_updated) {
+                FURI_LOG_W(TAG, "Failed to append journal, rewriting storage");
+                free(data);
+                data = malloc(new_size);
+                furi_hal_bt_nvm_sram_sem_acquire();
+                memcpy(data, instance->nvm_sram_buff, new_size);
+                furi_hal_bt_nvm_sram_sem_release();
+                compact = true;
+            }
+        }
+        if(compact) {
+            data_updated = bt_keys_storage_compact(instance, data, new_size);
+        }
+        free(data);
+
         if(!data_updated) {
             FURI_LOG_E(TAG, "Failed to update key storage");
             break;
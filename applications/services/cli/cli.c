@@ -53,6 +53,17 @@ void cli_write(Cli* cli, const uint8_t* buffer, size_t size) {
     }
 }
 
+size_t cli_set_nonblocking_output(Cli* cli, bool nonblocking) {
+    furi_assert(cli);
+    // Pending stdout line goes out in current mode
+    fflush(stdout);
+    furi_thread_stdout_flush();
+    if(cli->session != NULL && cli->session->set_tx_nonblocking != NULL) {
+        return cli->session->set_tx_nonblocking(nonblocking);
+    }
+    return 0;
+}
+
 size_t cli_read(Cli* cli, uint8_t* buffer, size_t size) {
     furi_assert(cli);
     if(cli->session != NULL) {
@@ -187,6 +198,9 @@ static void cli_execute_command(Cli* cli, CliCommand* command, FuriString* args)
         command->callback(cli, args, command->context);
     }
 
+    // Command may have left output non-blocking
+    cli_set_nonblocking_output(cli, false);
+
     if(!(command->flags & CliCommandFlagInsomniaSafe)) {
         furi_hal_power_insomnia_exit();
     }
@@ -255,36 +269,30 @@ static void cli_handle_autocomplete(Cli* cli) {
     // Prepare common base for autocomplete
     FuriString* common;
     common = furi_string_alloc();
-    // Iterate throw commands
-    for
-        M_EACH(cli_command, cli->commands, CliCommandTree_t) {
-            // Process only if starts with line buffer
-            if(furi_string_start_with(*cli_command->key_ptr, cli->line)) {
-                // Show autocomplete option
-                printf("%s\r\n", furi_string_get_cstr(*cli_command->key_ptr));
-                // Process common base for autocomplete
-                if(furi_string_size(common) > 0) {
-                    // Choose shortest string
-                    const size_t key_size = furi_string_size(*cli_command->key_ptr);
-                    const size_t common_size = furi_string_size(common);
-                    const size_t min_size = key_size > common_size ? common_size : key_size;
-                    size_t i = 0;
-                    while(i < min_size) {
-                        // Stop when do not match
-                        if(furi_string_get_char(*cli_command->key_ptr, i) !=
-                           furi_string_get_char(common, i)) {
-                            break;
-                        }
-                        i++;
-                    }
-                    // Cut right part if any
-                    furi_string_left(common, i);
-                } else {
-                    // Start with something
-                    furi_string_set(common, *cli_command->key_ptr);
-                }
-            }
+    furi_check(furi_mutex_acquire(cli->mutex, FuriWaitForever) == FuriStatusOk);
+    // Tree is sorted: matches are a contiguous run starting at the first key >= line
+    CliCommandTree_it_t it;
+    CliCommandTree_it_from(it, cli->commands, cli->line);
+    const FuriString* last = NULL;
+    for(; !CliCommandTree_end_p(it); CliCommandTree_next(it)) {
+        const FuriString* key = *CliCommandTree_cref(it)->key_ptr;
+        if(!furi_string_start_with(key, cli->line)) break;
+        // Show autocomplete option
+        printf("%s\r\n", furi_string_get_cstr(key));
+        if(last == NULL) furi_string_set(common, key);
+        last = key;
+    }
+    // Common base of sorted run is common base of its first and last keys
+    if(last != NULL) {
+        const size_t min_size = MIN(furi_string_size(common), furi_string_size(last));
+        size_t i = 0;
+        while(i < min_size && furi_string_get_char(common, i) == furi_string_get_char(last, i)) {
+            i++;
         }
+        // Cut right part if any
+        furi_string_left(common, i);
+    }
+    furi_check(furi_mutex_release(cli->mutex) == FuriStatusOk);
     // Replace line buffer if autocomplete better
     if(furi_string_size(common) > furi_string_size(cli->line)) {
         furi_string_set(cli->line, common);
@@ -111,6 +111,19 @@ bool cli_cmd_interrupt_received(Cli* cli);
  */
 void cli_write(Cli* cli, const uint8_t* buffer, size_t size);
 
+/** Make terminal output non-blocking. Do it only from inside of cli call.
+ *
+ * Streaming commands use it so their data source isn't stalled by a slow
+ * terminal. Writes that don't fit session buffer are dropped. Output is made
+ * blocking again when command returns.
+ *
+ * @param      cli          Cli instance
+ * @param      nonblocking  true to drop output instead of waiting
+ *
+ * @return     bytes dropped since previous call
+ */
+size_t cli_set_nonblocking_output(Cli* cli, bool nonblocking);
+
 /** Read character
  *
  * @param      cli   Cli instance
@@ -8,6 +8,7 @@
 #include <notification/notification_messages.h>
 #include <loader/loader.h>
 #include <lib/toolbox/args.h>
+#include <lib/toolbox/profiler.h>
 
 // Close to ISO, `date +'%Y-%m-%d %H:%M:%S %u'`
 #define CLI_DATE_FORMAT "%.4d-%.2d-%.2d %.2d:%.2d:%.2d %d"
@@ -194,6 +195,7 @@ bool cli_command_log_level_set_from_string(FuriString* level) {
         printf("<log warn> — non-critical errors and warnings including <log error>\r\n");
         printf("<log info> — non-critical information including <log warn>\r\n");
         printf("<log default> — the default system log level (equivalent to <log info>)\r\n");
+        printf("<log deferred [level]> — format records later on a low priority thread\r\n");
         printf(
             "<log debug> — debug information including <log info> (may impact system performance)\r\n");
         printf(
@@ -208,9 +210,17 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     uint8_t buffer[CLI_COMMAND_LOG_BUFFER_SIZE];
     FuriLogLevel previous_level = furi_log_get_level();
     bool restore_log_level = false;
+    bool previous_deferred = furi_log_is_deferred();
+
+    if(furi_string_start_with_str(args, "deferred")) {
+        furi_string_right(args, strlen("deferred"));
+        furi_string_trim(args);
+        furi_log_set_deferred(true);
+    }
 
     if(furi_string_size(args) > 0) {
         if(!cli_command_log_level_set_from_string(args)) {
+            furi_log_set_deferred(previous_deferred);
             furi_stream_buffer_free(ring);
             return;
         }
@@ -231,6 +241,7 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     }
 
     furi_hal_console_set_tx_callback(NULL, NULL);
+    furi_log_set_deferred(previous_deferred);
 
     if(restore_log_level) {
         // There will be strange behaviour if log level is set from settings while log command is running
@@ -416,6 +427,89 @@ void cli_command_ps(Cli* cli, FuriString* args, void* context) {
     printf("\r\nTotal: %d", thread_num);
 }
 
+#define CLI_COMMAND_TOP_THREADS_MAX 32
+#define CLI_COMMAND_TOP_PERIOD_MS 1000
+
+static void cli_command_top_print(void) {
+    FuriThreadStats* stats = malloc(sizeof(FuriThreadStats) * CLI_COMMAND_TOP_THREADS_MAX);
+    FuriThreadStatsTotal total;
+    size_t count = furi_thread_stats_get(stats, CLI_COMMAND_TOP_THREADS_MAX, &total);
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    uint64_t window = MAX(total.window, 1U);
+
+    // Busiest first
+    for(size_t i = 1; i < count; i++) {
+        for(size_t j = i; j > 0 && stats[j].runtime > stats[j - 1].runtime; j--) {
+            FuriThreadStats tmp = stats[j];
+            stats[j] = stats[j - 1];
+            stats[j - 1] = tmp;
+        }
+    }
+
+    printf(
+        "%-20s %-20s %-7s %-9s %s\r\n", "AppID", "Name", "CPU", "Switches", "Max latency us");
+    uint64_t busy = total.isr;
+    for(size_t i = 0; i < count; i++) {
+        uint32_t permille = stats[i].runtime * 1000 / window;
+        busy += stats[i].runtime;
+        printf(
+            "%-20s %-20s %3lu.%lu%%  %-9lu %lu\r\n",
+            furi_thread_get_appid(stats[i].thread_id),
+            furi_thread_get_name(stats[i].thread_id),
+            permille / 10,
+            permille % 10,
+            stats[i].switches,
+            stats[i].latency_max / cycles_per_us);
+    }
+
+    uint32_t isr_permille = total.isr * 1000 / window;
+    uint32_t sleep_permille = busy < window ? (window - busy) * 1000 / window : 0;
+    printf(
+        "\r\nISR: %lu.%lu%%, sleep: %lu.%lu%%, switches: %lu in %lu ms\r\n",
+        isr_permille / 10,
+        isr_permille % 10,
+        sleep_permille / 10,
+        sleep_permille % 10,
+        total.switches,
+        (uint32_t)(total.window / cycles_per_us / 1000));
+
+    free(stats);
+}
+
+void cli_command_top(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    if(!furi_string_cmp(args, "start")) {
+        furi_thread_stats_set_enabled(true);
+        printf("Thread statistics started");
+        return;
+    } else if(!furi_string_cmp(args, "stop")) {
+        furi_thread_stats_set_enabled(false);
+        printf("Thread statistics stopped");
+        return;
+    } else if(!furi_string_empty(args)) {
+        cli_print_usage("top", "<start|stop>", furi_string_get_cstr(args));
+        return;
+    }
+
+    // Live view restarts the window every period, background collection included
+    bool was_enabled = furi_thread_stats_is_enabled();
+    furi_thread_stats_set_enabled(true);
+
+    printf("Press CTRL+C to stop...\r\n");
+    while(!cli_cmd_interrupt_received(cli)) {
+        for(size_t i = 0; i < CLI_COMMAND_TOP_PERIOD_MS / 100; i++) {
+            if(cli_cmd_interrupt_received(cli)) break;
+            furi_delay_ms(100);
+        }
+        printf("\r\n");
+        cli_command_top_print();
+        furi_thread_stats_reset();
+    }
+
+    furi_thread_stats_set_enabled(was_enabled);
+}
+
 void cli_command_free(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -426,8 +520,16 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
     printf("Minimum heap size: %zu\r\n", memmgr_get_minimum_free_heap());
     printf("Maximum heap block: %zu\r\n", memmgr_heap_get_max_free_block());
 
-    printf("Pool free: %zu\r\n", memmgr_pool_get_free());
-    printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
+    MemmgrPoolStats pool;
+    memmgr_pool_get_stats(&pool);
+    printf("Pool free: %zu\r\n", pool.free);
+    printf("Maximum pool block: %zu\r\n", pool.max_block);
+    printf("Pool transient used: %zu\r\n", pool.transient_used);
+    printf("Pool transient peak: %zu\r\n", pool.transient_peak);
+    printf(
+        "Pool transient allocations: %lu, from heap: %lu\r\n",
+        pool.transient_allocs,
+        pool.transient_fallbacks);
 }
 
 void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
@@ -438,6 +540,72 @@ void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
     memmgr_heap_printf_free_blocks();
 }
 
+static void cli_command_heap_profile_print_size_classes(const uint32_t* counts) {
+    for(size_t i = 0; i < MEMMGR_HEAP_SIZE_CLASSES; i++) {
+        if(i < MEMMGR_HEAP_SIZE_CLASSES - 1) {
+            printf(" <=%u:%lu", MEMMGR_HEAP_SIZE_CLASS_LIMIT(i), counts[i]);
+        } else {
+            printf(" >%u:%lu", MEMMGR_HEAP_SIZE_CLASS_LIMIT(i - 1), counts[i]);
+        }
+    }
+    printf("\r\n");
+}
+
+void cli_command_heap_profile(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    if(!furi_string_cmp(args, "start")) {
+        memmgr_heap_profile_start();
+        printf("Heap profiling started");
+        return;
+    } else if(!furi_string_cmp(args, "stop")) {
+        memmgr_heap_profile_stop();
+        printf("Heap profiling stopped");
+        return;
+    } else if(!furi_string_empty(args)) {
+        cli_print_usage("heap_profile", "<start|stop>", furi_string_get_cstr(args));
+        return;
+    }
+
+    MemmgrHeapFragmentation fragmentation;
+    memmgr_heap_get_fragmentation(&fragmentation);
+    printf(
+        "Free heap: %zu in %zu blocks\r\n", fragmentation.free_bytes, fragmentation.free_blocks);
+    printf("Maximum heap block: %zu\r\n", fragmentation.max_free_block);
+    if(fragmentation.free_bytes) {
+        printf(
+            "Fragmentation: %zu%%\r\n",
+            100 - fragmentation.max_free_block * 100 / fragmentation.free_bytes);
+    }
+    printf("Free in small allocation pools: %zu\r\n", fragmentation.slab_free_bytes);
+    printf("Free blocks by size:");
+    cli_command_heap_profile_print_size_classes(fragmentation.free_size_class);
+
+    MemmgrHeapProfile* profile = malloc(sizeof(MemmgrHeapProfile));
+    memmgr_heap_get_profile(profile);
+    printf(
+        "\r\nProfiling %s, allocations: %lu, frees: %lu\r\n",
+        profile->enabled ? "running" : "stopped",
+        profile->alloc_count,
+        profile->free_count);
+    printf("Allocations by size:");
+    cli_command_heap_profile_print_size_classes(profile->alloc_size_class);
+    printf("Frees by size:");
+    cli_command_heap_profile_print_size_classes(profile->free_size_class);
+    printf("Top call sites:\r\n");
+    for(size_t i = 0; i < MEMMGR_HEAP_PROFILE_CALL_SITES; i++) {
+        const MemmgrHeapProfileCallSite* site = &profile->call_sites[i];
+        if(!site->count) break;
+        printf(
+            "0x%08lx count %lu bytes %lu\r\n",
+            (uint32_t)site->address,
+            site->count,
+            site->bytes);
+    }
+    free(profile);
+}
+
 void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -461,6 +629,20 @@ void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
     furi_hal_i2c_release(&furi_hal_i2c_handle_external);
 }
 
+void cli_command_profiler(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    if(!furi_string_cmp(args, "reset")) {
+        profiler_reset_all();
+        printf("Profilers reset");
+    } else if(furi_string_empty(args)) {
+        profiler_dump_all();
+    } else {
+        cli_print_usage("profiler", "[reset]", furi_string_get_cstr(args));
+    }
+}
+
 void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "!", CliCommandFlagParallelSafe, cli_command_info, (void*)true);
     cli_add_command(cli, "info", CliCommandFlagParallelSafe, cli_command_info, NULL);
@@ -477,8 +659,12 @@ void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "l", CliCommandFlagParallelSafe, cli_command_log, NULL);
     cli_add_command(cli, "sysctl", CliCommandFlagDefault, cli_command_sysctl, NULL);
     cli_add_command(cli, "ps", CliCommandFlagParallelSafe, cli_command_ps, NULL);
+    cli_add_command(cli, "top", CliCommandFlagParallelSafe, cli_command_top, NULL);
     cli_add_command(cli, "free", CliCommandFlagParallelSafe, cli_command_free, NULL);
     cli_add_command(cli, "free_blocks", CliCommandFlagParallelSafe, cli_command_free_blocks, NULL);
+    cli_add_command(
+        cli, "heap_profile", CliCommandFlagParallelSafe, cli_command_heap_profile, NULL);
+    cli_add_command(cli, "profiler", CliCommandFlagParallelSafe, cli_command_profiler, NULL);
 
     cli_add_command(cli, "vibro", CliCommandFlagDefault, cli_command_vibro, NULL);
     cli_add_command(cli, "led", CliCommandFlagDefault, cli_command_led, NULL);
@@ -31,6 +31,7 @@ struct CliSession {
     void (*tx)(const uint8_t* buffer, size_t size);
     void (*tx_stdout)(const char* data, size_t size);
     bool (*is_connected)(void);
+    size_t (*set_tx_nonblocking)(bool nonblocking); /**< Optional, returns dropped bytes count */
 };
 
 BPTREE_DEF2(
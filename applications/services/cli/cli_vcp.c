@@ -6,8 +6,9 @@
 #define TAG "CliVcp"
 
 #define USB_CDC_PKT_LEN CDC_DATA_SZ
-#define VCP_RX_BUF_SIZE (USB_CDC_PKT_LEN * 3)
-#define VCP_TX_BUF_SIZE (USB_CDC_PKT_LEN * 3)
+#define VCP_RX_BUF_SIZE (USB_CDC_PKT_LEN * 8)
+#define VCP_TX_BUF_SIZE (USB_CDC_PKT_LEN * 16)
+#define VCP_TX_BATCH_SIZE (VCP_TX_BUF_SIZE / 2)
 
 #define VCP_IF_NUM 0
 
@@ -42,6 +43,15 @@ typedef struct {
 
     FuriHalUsbInterface* usb_if_prev;
 
+    // Packet in flight, refilled from USB interrupt while Tx buffer has data
+    volatile bool tx_idle;
+    volatile uint8_t last_tx_pkt_len;
+    uint8_t tx_buffer[USB_CDC_PKT_LEN];
+
+    // Writes that don't fit Tx buffer are dropped instead of waiting
+    volatile bool tx_nonblocking;
+    size_t tx_dropped;
+
     uint8_t data_buffer[USB_CDC_PKT_LEN];
 } CliVcp;
 
@@ -87,11 +97,28 @@ static void cli_vcp_deinit() {
     vcp->thread = NULL;
 }
 
+static bool vcp_tx_next_packet() {
+    size_t len = furi_stream_buffer_receive(vcp->tx_stream, vcp->tx_buffer, USB_CDC_PKT_LEN, 0);
+    if(len > 0) {
+        furi_hal_cdc_send(VCP_IF_NUM, vcp->tx_buffer, len);
+        vcp->last_tx_pkt_len = len;
+    }
+    return len > 0;
+}
+
+static void vcp_tx_flush() {
+    // Interrupt may be refilling packet in flight. Draining wakes up blocked writer
+    FURI_CRITICAL_ENTER();
+    while(furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0))
+        ;
+    FURI_CRITICAL_EXIT();
+}
+
 static int32_t vcp_worker(void* context) {
     UNUSED(context);
-    bool tx_idle = true;
     size_t missed_rx = 0;
-    uint8_t last_tx_pkt_len = 0;
+    vcp->tx_idle = true;
+    vcp->last_tx_pkt_len = 0;
 
     // Switch USB to VCP mode (if it is not set yet)
     vcp->usb_if_prev = furi_hal_usb_get_config();
@@ -124,7 +151,7 @@ static int32_t vcp_worker(void* context) {
 
             if(vcp->connected == true) {
                 vcp->connected = false;
-                furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0);
+                vcp_tx_flush();
                 furi_stream_buffer_send(vcp->rx_stream, &ascii_eot, 1, FuriWaitForever);
             }
         }
@@ -161,31 +188,25 @@ static int32_t vcp_worker(void* context) {
         if(flags & VcpEvtStreamTx) {
             VCP_DEBUG("StreamTx");
 
-            if(tx_idle) {
+            if(vcp->tx_idle) {
                 flags |= VcpEvtTx;
             }
         }
 
-        // CDC write transfer done
+        // Nothing in flight: transfer is idle, or interrupt found Tx buffer empty
         if(flags & VcpEvtTx) {
-            size_t len =
-                furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0);
-
-            VCP_DEBUG("Tx %d", len);
-
-            if(len > 0) { // Some data left in Tx buffer. Sending it now
-                tx_idle = false;
-                furi_hal_cdc_send(VCP_IF_NUM, vcp->data_buffer, len);
-                last_tx_pkt_len = len;
+            if(vcp_tx_next_packet()) { // Some data left in Tx buffer. Sending it now
+                VCP_DEBUG("Tx %d", vcp->last_tx_pkt_len);
+                vcp->tx_idle = false;
             } else { // There is nothing to send.
-                if(last_tx_pkt_len == 64) {
+                if(vcp->last_tx_pkt_len == USB_CDC_PKT_LEN) {
                     // Send extra zero-length packet if last packet len is 64 to indicate transfer end
                     furi_hal_cdc_send(VCP_IF_NUM, NULL, 0);
                 } else {
                     // Set flag to start next transfer instantly
-                    tx_idle = true;
+                    vcp->tx_idle = true;
                 }
-                last_tx_pkt_len = 0;
+                vcp->last_tx_pkt_len = 0;
             }
         }
 
@@ -198,7 +219,7 @@ static int32_t vcp_worker(void* context) {
                 furi_hal_usb_unlock();
                 furi_hal_usb_set_config(vcp->usb_if_prev, NULL);
             }
-            furi_stream_buffer_receive(vcp->tx_stream, vcp->data_buffer, USB_CDC_PKT_LEN, 0);
+            vcp_tx_flush();
             furi_stream_buffer_send(vcp->rx_stream, &ascii_eot, 1, FuriWaitForever);
             break;
         }
@@ -252,9 +273,17 @@ static void cli_vcp_tx(const uint8_t* buffer, size_t size) {
 
     VCP_DEBUG("tx %u start", size);
 
+    if(vcp->tx_nonblocking) {
+        // Whole write is dropped, so terminal doesn't get torn lines
+        if(!vcp->connected || furi_stream_buffer_spaces_available(vcp->tx_stream) < size) {
+            vcp->tx_dropped += size;
+            return;
+        }
+    }
+
     while(size > 0 && vcp->connected) {
         size_t batch_size = size;
-        if(batch_size > USB_CDC_PKT_LEN) batch_size = USB_CDC_PKT_LEN;
+        if(batch_size > VCP_TX_BATCH_SIZE) batch_size = VCP_TX_BATCH_SIZE;
 
         furi_stream_buffer_send(vcp->tx_stream, buffer, batch_size, FuriWaitForever);
         furi_thread_flags_set(furi_thread_get_id(vcp->thread), VcpEvtStreamTx);
@@ -298,7 +327,10 @@ static void vcp_on_cdc_rx(void* context) {
 
 static void vcp_on_cdc_tx_complete(void* context) {
     UNUSED(context);
-    furi_thread_flags_set(furi_thread_get_id(vcp->thread), VcpEvtTx);
+    // Keep endpoint busy without waking worker for every packet
+    if(!vcp_tx_next_packet()) {
+        furi_thread_flags_set(furi_thread_get_id(vcp->thread), VcpEvtTx);
+    }
 }
 
 static bool cli_vcp_is_connected(void) {
@@ -306,6 +338,14 @@ static bool cli_vcp_is_connected(void) {
     return vcp->connected;
 }
 
+static size_t cli_vcp_set_tx_nonblocking(bool nonblocking) {
+    furi_assert(vcp);
+    vcp->tx_nonblocking = nonblocking;
+    size_t dropped = vcp->tx_dropped;
+    vcp->tx_dropped = 0;
+    return dropped;
+}
+
 CliSession cli_vcp = {
     cli_vcp_init,
     cli_vcp_deinit,
@@ -313,4 +353,5 @@ CliSession cli_vcp = {
     cli_vcp_tx,
     cli_vcp_tx_stdout,
     cli_vcp_is_connected,
+    cli_vcp_set_tx_nonblocking,
 };
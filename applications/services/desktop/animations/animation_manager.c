@@ -294,6 +294,13 @@ AnimationManager* animation_manager_alloc(void) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     animation_manager->pubsub_subscription_storage = furi_pubsub_subscribe(
         storage_get_pubsub(storage), animation_manager_check_blocking_callback, animation_manager);
+    // Skip file and dir events, they come on every close
+    furi_pubsub_subscription_set_topics(
+        storage_get_pubsub(storage),
+        animation_manager->pubsub_subscription_storage,
+        FURI_PUBSUB_TOPIC(StorageEventTypeCardMount) |
+            FURI_PUBSUB_TOPIC(StorageEventTypeCardUnmount) |
+            FURI_PUBSUB_TOPIC(StorageEventTypeCardMountError));
     furi_record_close(RECORD_STORAGE);
 
     Dolphin* dolphin = furi_record_open(RECORD_DOLPHIN);
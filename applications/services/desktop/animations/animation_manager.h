@@ -7,6 +7,9 @@
 
 typedef struct AnimationManager AnimationManager;
 
+/** Streamed frames of external animation, NULL for animations in flash */
+typedef struct AnimationFrameStream AnimationFrameStream;
+
 typedef struct {
     uint8_t x;
     uint8_t y;
@@ -32,6 +35,7 @@ typedef struct {
     uint8_t active_cycles;
     uint16_t duration;
     uint16_t active_cooldown;
+    AnimationFrameStream* frame_stream;
 } BubbleAnimation;
 
 typedef void (*AnimationManagerSetNewIdleAnimationCallback)(void* context);
@@ -14,9 +14,55 @@
 #include <xtreme.h>
 #define ANIMATION_META_FILE "meta.txt"
 #define TAG "AnimationStorage"
+
+/** Frames are streamed from SD, 2 ahead of the drawn one are requested by view */
+#define ANIMATION_FRAME_STREAM_SLOTS 4
+#define ANIMATION_FRAME_STREAM_QUEUE_SIZE 4
+#define ANIMATION_FRAME_STREAM_EXIT 0xFFFF
+
+#define ANIMATION_MANIFEST_CACHE_PATH CFG_PATH(".anim_manifest.cache")
+#define ANIMATION_MANIFEST_CACHE_MAGIC 0x434D4E41
+#define ANIMATION_MANIFEST_CACHE_VERSION 1
 char ANIMATION_DIR[23 /*"/ext/asset_packs//Anims"*/ + XTREME_ASSETS_PACK_NAME_LEN + 1];
 char ANIMATION_MANIFEST_FILE[sizeof(ANIMATION_DIR) + 13 /*"/manifest.txt"*/];
 
+struct AnimationFrameStream {
+    FuriThread* thread;
+    FuriMessageQueue* queue;
+    FuriString* path;
+    size_t frame_size;
+    const uint8_t** frames;
+    uint8_t frame_count;
+
+    /* Frame 0 is never evicted, it is used for freezing and as fallback */
+    uint8_t* first_frame;
+    uint8_t* slots[ANIMATION_FRAME_STREAM_SLOTS];
+    int16_t slot_frames[ANIMATION_FRAME_STREAM_SLOTS];
+    uint8_t next_slot;
+};
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t timestamp;
+    uint32_t size;
+    char manifest[sizeof(ANIMATION_MANIFEST_FILE)];
+    uint32_t count;
+} AnimationManifestCacheHeader;
+
+typedef struct {
+    uint8_t min_butthurt;
+    uint8_t max_butthurt;
+    uint8_t min_level;
+    uint8_t max_level;
+    uint8_t weight;
+    uint8_t name_length;
+} AnimationManifestCacheRecord;
+
+#pragma pack(pop)
+
 static void animation_storage_free_bubbles(BubbleAnimation* animation);
 static void animation_storage_free_frames(BubbleAnimation* animation);
 static void animation_storage_free_animation(BubbleAnimation** storage_animation);
@@ -108,6 +154,153 @@ static bool animation_storage_load_single_manifest_info(
     return result;
 }
 
+static bool
+    animation_storage_manifest_cache_key(Storage* storage, AnimationManifestCacheHeader* key) {
+    FileInfo file_info;
+    memset(key, 0, sizeof(AnimationManifestCacheHeader));
+    if(storage_common_stat(storage, ANIMATION_MANIFEST_FILE, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, ANIMATION_MANIFEST_FILE, &key->timestamp) != FSE_OK)
+        return false;
+
+    key->magic = ANIMATION_MANIFEST_CACHE_MAGIC;
+    key->version = ANIMATION_MANIFEST_CACHE_VERSION;
+    key->size = file_info.size;
+    strlcpy(key->manifest, ANIMATION_MANIFEST_FILE, sizeof(key->manifest));
+    return true;
+}
+
+static bool animation_storage_load_manifest_cache(
+    Storage* storage,
+    const AnimationManifestCacheHeader* key,
+    StorageAnimationList_t* animation_list) {
+    bool result = false;
+    File* file = storage_file_alloc(storage);
+    AnimationManifestCacheHeader header;
+    AnimationManifestCacheRecord record;
+    uint32_t loaded = 0;
+
+    do {
+        if(!storage_file_open(file, ANIMATION_MANIFEST_CACHE_PATH, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        /* Same manifest file, unchanged since cache was written */
+        if(memcmp(&header, key, offsetof(AnimationManifestCacheHeader, count))) break;
+
+        for(; loaded < header.count; loaded++) {
+            if(storage_file_read(file, &record, sizeof(record)) != sizeof(record)) break;
+            char* name = malloc(record.name_length + 1);
+            if(storage_file_read(file, name, record.name_length) != record.name_length) {
+                free(name);
+                break;
+            }
+            name[record.name_length] = '\0';
+
+            StorageAnimation* storage_animation = malloc(sizeof(StorageAnimation));
+            storage_animation->external = true;
+            storage_animation->animation = NULL;
+            storage_animation->manifest_info.name = name;
+            storage_animation->manifest_info.min_butthurt = record.min_butthurt;
+            storage_animation->manifest_info.max_butthurt = record.max_butthurt;
+            storage_animation->manifest_info.min_level = record.min_level;
+            storage_animation->manifest_info.max_level = record.max_level;
+            storage_animation->manifest_info.weight = record.weight;
+            StorageAnimationList_push_back(*animation_list, storage_animation);
+        }
+        result = loaded == header.count;
+    } while(0);
+
+    if(!result) {
+        /* Drop partially loaded list, manifest will be parsed instead */
+        StorageAnimation* storage_animation;
+        while(loaded--) {
+            StorageAnimationList_pop_back(&storage_animation, *animation_list);
+            animation_storage_free_storage_animation(&storage_animation);
+        }
+    }
+
+    storage_file_free(file);
+    return result;
+}
+
+static void animation_storage_save_manifest_cache(
+    Storage* storage,
+    const AnimationManifestCacheHeader* key,
+    StorageAnimationList_t* animation_list) {
+    File* file = storage_file_alloc(storage);
+    AnimationManifestCacheHeader header = *key;
+    AnimationManifestCacheRecord record;
+    bool result = false;
+
+    do {
+        if(!storage_file_open(file, ANIMATION_MANIFEST_CACHE_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+        header.count = StorageAnimationList_size(*animation_list);
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        result = true;
+        for
+            M_EACH(item, *animation_list, StorageAnimationList_t) {
+                const StorageAnimationManifestInfo* info = &(*item)->manifest_info;
+                record.min_butthurt = info->min_butthurt;
+                record.max_butthurt = info->max_butthurt;
+                record.min_level = info->min_level;
+                record.max_level = info->max_level;
+                record.weight = info->weight;
+                record.name_length = MIN(strlen(info->name), (size_t)UINT8_MAX);
+                if(storage_file_write(file, &record, sizeof(record)) != sizeof(record) ||
+                   storage_file_write(file, info->name, record.name_length) !=
+                       record.name_length) {
+                    result = false;
+                    break;
+                }
+            }
+    } while(0);
+
+    storage_file_free(file);
+    if(!result) {
+        FURI_LOG_E(TAG, "Failed to save manifest cache");
+        storage_common_remove(storage, ANIMATION_MANIFEST_CACHE_PATH);
+    }
+}
+
+static bool animation_storage_parse_manifest(
+    FlipperFormat* file,
+    FuriString* read_string,
+    StorageAnimationList_t* animation_list) {
+    uint32_t u32value;
+    StorageAnimation* storage_animation = NULL;
+
+    if(!flipper_format_file_open_existing(file, ANIMATION_MANIFEST_FILE)) return false;
+    if(!flipper_format_read_header(file, read_string, &u32value)) return false;
+    if(furi_string_cmp_str(read_string, "Flipper Animation Manifest")) return false;
+    do {
+        storage_animation = malloc(sizeof(StorageAnimation));
+        storage_animation->external = true;
+        storage_animation->animation = NULL;
+        storage_animation->manifest_info.name = NULL;
+
+        if(!flipper_format_read_string(file, "Name", read_string)) break;
+        storage_animation->manifest_info.name = malloc(furi_string_size(read_string) + 1);
+        strcpy((char*)storage_animation->manifest_info.name, furi_string_get_cstr(read_string));
+
+        if(!flipper_format_read_uint32(file, "Min butthurt", &u32value, 1)) break;
+        storage_animation->manifest_info.min_butthurt = u32value;
+        if(!flipper_format_read_uint32(file, "Max butthurt", &u32value, 1)) break;
+        storage_animation->manifest_info.max_butthurt = u32value;
+        if(!flipper_format_read_uint32(file, "Min level", &u32value, 1)) break;
+        storage_animation->manifest_info.min_level = u32value;
+        if(!flipper_format_read_uint32(file, "Max level", &u32value, 1)) break;
+        storage_animation->manifest_info.max_level = u32value;
+        if(!flipper_format_read_uint32(file, "Weight", &u32value, 1)) break;
+        storage_animation->manifest_info.weight = u32value;
+
+        StorageAnimationList_push_back(*animation_list, storage_animation);
+    } while(1);
+
+    animation_storage_free_storage_animation(&storage_animation);
+    return true;
+}
+
 void animation_storage_fill_animation_list(StorageAnimationList_t* animation_list) {
     furi_assert(sizeof(StorageAnimationList_t) == sizeof(void*));
     furi_assert(!StorageAnimationList_size(*animation_list));
@@ -121,39 +314,15 @@ void animation_storage_fill_animation_list(StorageAnimationList_t* animation_lis
     read_string = furi_string_alloc();
 
     do {
-        uint32_t u32value;
-        StorageAnimation* storage_animation = NULL;
-
         if(FSE_OK != storage_sd_status(storage)) break;
-        if(!flipper_format_file_open_existing(file, ANIMATION_MANIFEST_FILE)) break;
-        if(!flipper_format_read_header(file, read_string, &u32value)) break;
-        if(furi_string_cmp_str(read_string, "Flipper Animation Manifest")) break;
-        do {
-            storage_animation = malloc(sizeof(StorageAnimation));
-            storage_animation->external = true;
-            storage_animation->animation = NULL;
-            storage_animation->manifest_info.name = NULL;
-
-            if(!flipper_format_read_string(file, "Name", read_string)) break;
-            storage_animation->manifest_info.name = malloc(furi_string_size(read_string) + 1);
-            strcpy(
-                (char*)storage_animation->manifest_info.name, furi_string_get_cstr(read_string));
-
-            if(!flipper_format_read_uint32(file, "Min butthurt", &u32value, 1)) break;
-            storage_animation->manifest_info.min_butthurt = u32value;
-            if(!flipper_format_read_uint32(file, "Max butthurt", &u32value, 1)) break;
-            storage_animation->manifest_info.max_butthurt = u32value;
-            if(!flipper_format_read_uint32(file, "Min level", &u32value, 1)) break;
-            storage_animation->manifest_info.min_level = u32value;
-            if(!flipper_format_read_uint32(file, "Max level", &u32value, 1)) break;
-            storage_animation->manifest_info.max_level = u32value;
-            if(!flipper_format_read_uint32(file, "Weight", &u32value, 1)) break;
-            storage_animation->manifest_info.weight = u32value;
 
-            StorageAnimationList_push_back(*animation_list, storage_animation);
-        } while(1);
+        AnimationManifestCacheHeader key;
+        bool cacheable = animation_storage_manifest_cache_key(storage, &key);
+        if(cacheable && animation_storage_load_manifest_cache(storage, &key, animation_list))
+            break;
 
-        animation_storage_free_storage_animation(&storage_animation);
+        if(!animation_storage_parse_manifest(file, read_string, animation_list)) break;
+        if(cacheable) animation_storage_save_manifest_cache(storage, &key, animation_list);
     } while(0);
 
     furi_string_free(read_string);
@@ -282,14 +451,103 @@ static bool animation_storage_cast_align(FuriString* align_str, Align* align) {
 static void animation_storage_free_frames(BubbleAnimation* animation) {
     furi_assert(animation);
 
-    const Icon* icon = &animation->icon_animation;
-    for(int i = 0; i < icon->frame_count; ++i) {
-        if(icon->frames[i]) {
-            free((void*)icon->frames[i]);
+    AnimationFrameStream* stream = animation->frame_stream;
+    if(stream) {
+        if(stream->thread) {
+            uint16_t message = ANIMATION_FRAME_STREAM_EXIT;
+            furi_message_queue_reset(stream->queue);
+            furi_message_queue_put(stream->queue, &message, FuriWaitForever);
+            furi_thread_join(stream->thread);
+            furi_thread_free(stream->thread);
+            furi_message_queue_free(stream->queue);
+        }
+        for(size_t i = 0; i < ANIMATION_FRAME_STREAM_SLOTS; ++i) {
+            free(stream->slots[i]);
         }
+        free(stream->first_frame);
+        furi_string_free(stream->path);
+        free(stream);
+        animation->frame_stream = NULL;
     }
 
+    Icon* icon = (Icon*)&animation->icon_animation;
     free((void*)icon->frames);
+    icon->frames = NULL;
+}
+
+static bool animation_storage_read_frame(
+    File* file,
+    AnimationFrameStream* stream,
+    FuriString* filename,
+    uint8_t frame,
+    uint8_t* buffer) {
+    bool result = false;
+    furi_string_printf(filename, "%s/frame_%u.bm", furi_string_get_cstr(stream->path), frame);
+
+    do {
+        if(!storage_file_open(
+               file, furi_string_get_cstr(filename), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            FURI_LOG_E(TAG, "Can't open file \'%s\'", furi_string_get_cstr(filename));
+            break;
+        }
+        uint64_t size = storage_file_size(file);
+        if(size > stream->frame_size) {
+            FURI_LOG_E(TAG, "Filesize %llu, max: %zu", size, stream->frame_size);
+            break;
+        }
+        if(storage_file_read(file, buffer, size) != size) {
+            FURI_LOG_E(TAG, "Read failed: \'%s\'", furi_string_get_cstr(filename));
+            break;
+        }
+        result = true;
+    } while(0);
+
+    storage_file_close(file);
+    return result;
+}
+
+static int32_t animation_storage_frame_stream_thread(void* context) {
+    AnimationFrameStream* stream = context;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* filename = furi_string_alloc();
+    uint16_t frame;
+
+    while(true) {
+        furi_check(
+            furi_message_queue_get(stream->queue, &frame, FuriWaitForever) == FuriStatusOk);
+        if(frame == ANIMATION_FRAME_STREAM_EXIT) break;
+        if(frame >= stream->frame_count || stream->frames[frame]) continue;
+
+        /* Frames are requested in playing order, so the oldest slot is the one to reuse */
+        uint8_t slot = stream->next_slot;
+        stream->next_slot = (slot + 1) % ANIMATION_FRAME_STREAM_SLOTS;
+        if(stream->slot_frames[slot] >= 0) {
+            stream->frames[stream->slot_frames[slot]] = NULL;
+            stream->slot_frames[slot] = -1;
+        }
+
+        if(animation_storage_read_frame(file, stream, filename, frame, stream->slots[slot])) {
+            stream->slot_frames[slot] = frame;
+            stream->frames[frame] = stream->slots[slot];
+        }
+    }
+
+    furi_string_free(filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return 0;
+}
+
+void animation_storage_request_frame(const BubbleAnimation* animation, uint8_t frame) {
+    furi_assert(animation);
+
+    AnimationFrameStream* stream = animation->frame_stream;
+    if(!stream || !stream->thread) return;
+    if(frame >= stream->frame_count || stream->frames[frame]) return;
+
+    uint16_t message = frame;
+    furi_message_queue_put(stream->queue, &message, 0);
 }
 
 static bool animation_storage_load_frames(
@@ -318,58 +576,66 @@ static bool animation_storage_load_frames(
     FURI_CONST_ASSIGN(icon->width, width);
     icon->frames = malloc(sizeof(const uint8_t*) * icon->frame_count);
 
+    /* Only frame 0 and few slots are kept in memory, the rest is streamed while playing */
+    AnimationFrameStream* stream = malloc(sizeof(AnimationFrameStream));
+    stream->path = furi_string_alloc_printf("%s/%s", ANIMATION_DIR, name);
+    stream->frame_size = ROUND_UP_TO(width, 8) * height + 2;
+    stream->frames = (const uint8_t**)icon->frames;
+    stream->frame_count = icon->frame_count;
+    stream->first_frame = malloc(stream->frame_size);
+    for(size_t i = 0; i < ANIMATION_FRAME_STREAM_SLOTS; ++i) {
+        stream->slots[i] = malloc(stream->frame_size);
+        stream->slot_frames[i] = -1;
+    }
+    animation->frame_stream = stream;
+
     bool frames_ok = false;
     File* file = storage_file_alloc(storage);
     FileInfo file_info;
     FuriString* filename;
     filename = furi_string_alloc();
-    size_t max_filesize = ROUND_UP_TO(width, 8) * height + 2;
 
+    /* Broken animation should fail now, not while playing */
     for(int i = 0; i < icon->frame_count; ++i) {
         frames_ok = false;
-        furi_string_printf(filename, "%s/%s/frame_%d.bm", ANIMATION_DIR, name, i);
+        furi_string_printf(filename, "%s/frame_%d.bm", furi_string_get_cstr(stream->path), i);
 
         if(storage_common_stat(storage, furi_string_get_cstr(filename), &file_info) != FSE_OK)
             break;
-        if(file_info.size > max_filesize) {
+        if(file_info.size > stream->frame_size) {
             FURI_LOG_E(
                 TAG,
                 "Filesize %llu, max: %zu (width %u, height %u)",
                 file_info.size,
-                max_filesize,
+                stream->frame_size,
                 width,
                 height);
             break;
         }
-        if(!storage_file_open(
-               file, furi_string_get_cstr(filename), FSAM_READ, FSOM_OPEN_EXISTING)) {
-            FURI_LOG_E(TAG, "Can't open file \'%s\'", furi_string_get_cstr(filename));
-            break;
-        }
-
-        FURI_CONST_ASSIGN_PTR(icon->frames[i], malloc(file_info.size));
-        if(storage_file_read(file, (void*)icon->frames[i], file_info.size) != file_info.size) {
-            FURI_LOG_E(TAG, "Read failed: \'%s\'", furi_string_get_cstr(filename));
-            break;
-        }
-        storage_file_close(file);
         frames_ok = true;
     }
 
+    if(frames_ok) {
+        frames_ok = animation_storage_read_frame(file, stream, filename, 0, stream->first_frame);
+    }
+
     if(!frames_ok) {
         FURI_LOG_E(
             TAG,
-            "Load \'%s\' failed, %ux%u, size: %llu",
+            "Load \'%s\' failed, %ux%u",
             furi_string_get_cstr(filename),
             width,
-            height,
-            file_info.size);
+            height);
         animation_storage_free_frames(animation);
     } else {
-        furi_check(animation->icon_animation.frames);
-        for(int i = 0; i < animation->icon_animation.frame_count; ++i) {
-            furi_check(animation->icon_animation.frames[i]);
-        }
+        stream->frames[0] = stream->first_frame;
+        stream->queue =
+            furi_message_queue_alloc(ANIMATION_FRAME_STREAM_QUEUE_SIZE, sizeof(uint16_t));
+        stream->thread = furi_thread_alloc_ex(
+            "AnimFrameStream", 1024, animation_storage_frame_stream_thread, stream);
+        furi_thread_start(stream->thread);
+        animation_storage_request_frame(animation, frame_order[0]);
+        if(frame_order_count > 1) animation_storage_request_frame(animation, frame_order[1]);
     }
 
     storage_file_free(file);
@@ -474,6 +740,7 @@ static BubbleAnimation* animation_storage_load_animation(const char* name) {
     animation->frame_bubble_sequences = NULL;
 
     bool success = false;
+    bool frames_loaded = false;
     do {
         uint32_t u32value;
 
@@ -509,6 +776,7 @@ static BubbleAnimation* animation_storage_load_animation(const char* name) {
         /* passive and active frames must be loaded up to this point */
         if(!animation_storage_load_frames(storage, name, animation, u32array, width, height))
             break;
+        frames_loaded = true;
 
         if(!flipper_format_read_uint32(ff, "Active cycles", &u32value, 1)) break; //-V779
         animation->active_cycles = u32value;
@@ -532,6 +800,9 @@ static BubbleAnimation* animation_storage_load_animation(const char* name) {
     }
 
     if(!success) { //-V547
+        if(frames_loaded) {
+            animation_storage_free_frames(animation);
+        }
         if(animation->frame_order) {
             free((void*)animation->frame_order);
         }
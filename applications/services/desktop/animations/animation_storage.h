@@ -56,6 +56,18 @@ const BubbleAnimation* animation_storage_get_bubble_animation(StorageAnimation*
  */
 void animation_storage_cache_animation(StorageAnimation* storage_animation);
 
+/**
+ * Request frame to be loaded before it is drawn.
+ * Frames of external animations are streamed from SD card and only
+ * few of them are kept in memory. Frame which is not loaded yet is
+ * drawn as frame 0. Does nothing for animations in flash.
+ * Doesn't block, safe to call from timer callback.
+ *
+ * @animation   animation to be drawn
+ * @frame       frame index, value from frame_order
+ */
+void animation_storage_request_frame(const BubbleAnimation* animation, uint8_t frame);
+
 /**
  * Find animation by name.
  * Search through the inner flash, and SD-card if has.
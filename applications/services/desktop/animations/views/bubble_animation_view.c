@@ -14,6 +14,8 @@
 #include <core/dangerous_defines.h>
 
 #define ACTIVE_SHIFT 2
+/* Frames of external animations are streamed from SD, request them early */
+#define FRAME_LOOKAHEAD 2
 
 typedef struct {
     const BubbleAnimation* current;
@@ -36,6 +38,7 @@ struct BubbleAnimationView {
 
 static void bubble_animation_activate(BubbleAnimationView* view, bool force);
 static void bubble_animation_activate_right_now(BubbleAnimationView* view);
+static void bubble_animation_next_frame(BubbleAnimationViewModel* model);
 
 static uint8_t bubble_animation_get_frame_index(BubbleAnimationViewModel* model) {
     furi_assert(model);
@@ -54,6 +57,21 @@ static uint8_t bubble_animation_get_frame_index(BubbleAnimationViewModel* model)
     return animation->frame_order[icon_index];
 }
 
+static void bubble_animation_request_frames(BubbleAnimationViewModel* model) {
+    furi_assert(model);
+
+    if(!model->current || model->freeze_frame) {
+        return;
+    }
+
+    BubbleAnimationViewModel next = *model;
+    animation_storage_request_frame(model->current, bubble_animation_get_frame_index(&next));
+    for(size_t i = 0; i < FRAME_LOOKAHEAD; ++i) {
+        bubble_animation_next_frame(&next);
+        animation_storage_request_frame(model->current, bubble_animation_get_frame_index(&next));
+    }
+}
+
 static void bubble_animation_draw_callback(Canvas* canvas, void* model_) {
     furi_assert(model_);
     furi_assert(canvas);
@@ -77,8 +95,12 @@ static void bubble_animation_draw_callback(Canvas* canvas, void* model_) {
     uint8_t width = icon_get_width(&animation->icon_animation);
     uint8_t height = icon_get_height(&animation->icon_animation);
     uint8_t y_offset = canvas_height(canvas) - height;
-    canvas_draw_bitmap(
-        canvas, 0, y_offset, width, height, animation->icon_animation.frames[index]);
+    const uint8_t* frame = animation->icon_animation.frames[index];
+    if(!frame) {
+        /* Streamed frame is not loaded yet */
+        frame = animation->icon_animation.frames[0];
+    }
+    canvas_draw_bitmap(canvas, 0, y_offset, width, height, frame);
 
     const FrameBubble* bubble = model->current_bubble;
     if(bubble) {
@@ -188,6 +210,7 @@ static void bubble_animation_activate_right_now(BubbleAnimationView* view) {
         model->current_frame = model->current->passive_frames;
         model->current_bubble = bubble_animation_pick_bubble(model, true);
         frame_rate = model->current->icon_animation.frame_rate;
+        bubble_animation_request_frames(model);
     }
     view_commit_model(view->view, true);
 
@@ -239,6 +262,7 @@ static void bubble_animation_timer_callback(void* context) {
 
     if(!model->freeze_frame && !activate) {
         bubble_animation_next_frame(model);
+        bubble_animation_request_frames(model);
     }
 
     view_commit_model(view->view, !activate);
@@ -370,6 +394,7 @@ void bubble_animation_view_set_animation(
     model->current_bubble = bubble_animation_pick_bubble(model, false);
     model->current_frame = 0;
     model->active_cycle = 0;
+    bubble_animation_request_frames(model);
     view_commit_model(view->view, true);
 
     furi_timer_start(view->timer, 1000 / new_animation->icon_animation.frame_rate);
@@ -174,6 +174,10 @@ static void desktop_auto_lock_arm(Desktop* desktop) {
     if(desktop->settings.auto_lock_delay_ms) {
         desktop->input_events_subscription = furi_pubsub_subscribe(
             desktop->input_events_pubsub, desktop_input_event_callback, desktop);
+        furi_pubsub_subscription_set_topics(
+            desktop->input_events_pubsub,
+            desktop->input_events_subscription,
+            FURI_PUBSUB_TOPIC(InputTypePress));
         desktop_start_auto_lock_timer(desktop);
     }
 }
@@ -375,11 +379,13 @@ Desktop* desktop_alloc() {
 
     desktop->auto_lock_timer =
         furi_timer_alloc(desktop_auto_lock_timer_callback, FuriTimerTypeOnce, desktop);
+    furi_timer_set_slack(desktop->auto_lock_timer, furi_ms_to_ticks(1000));
 
     desktop->status_pubsub = furi_pubsub_alloc();
 
     desktop->update_clock_timer =
         furi_timer_alloc(desktop_clock_timer_callback, FuriTimerTypePeriodic, desktop);
+    furi_timer_set_slack(desktop->update_clock_timer, furi_ms_to_ticks(100));
 
     furi_record_create(RECORD_DESKTOP, desktop);
 
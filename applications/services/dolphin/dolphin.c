@@ -10,6 +10,7 @@
 
 #define TAG "Dolphin"
 #define HOURS_IN_TICKS(x) ((x)*60 * 60 * 1000)
+#define DOLPHIN_TIMER_SLACK (1000)
 
 static void dolphin_update_clear_limits_timer_period(Dolphin* dolphin);
 
@@ -86,6 +87,9 @@ Dolphin* dolphin_alloc() {
         furi_timer_alloc(dolphin_flush_timer_callback, FuriTimerTypeOnce, dolphin);
     dolphin->clear_limits_timer =
         furi_timer_alloc(dolphin_clear_limits_timer_callback, FuriTimerTypePeriodic, dolphin);
+    furi_timer_set_slack(dolphin->butthurt_timer, DOLPHIN_TIMER_SLACK);
+    furi_timer_set_slack(dolphin->flush_timer, DOLPHIN_TIMER_SLACK);
+    furi_timer_set_slack(dolphin->clear_limits_timer, DOLPHIN_TIMER_SLACK);
 
     return dolphin;
 }
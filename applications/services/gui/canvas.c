@@ -27,6 +27,7 @@ Canvas* canvas_init() {
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
     canvas->orientation = CanvasOrientationHorizontal;
+    canvas->sent_buffer = malloc(canvas_get_buffer_size(canvas));
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
     // Wake up display
@@ -42,6 +43,7 @@ Canvas* canvas_init() {
 void canvas_free(Canvas* canvas) {
     furi_assert(canvas);
     compress_icon_free(canvas->compress_icon);
+    free(canvas->sent_buffer);
     free(canvas);
 }
 
@@ -57,7 +59,28 @@ void canvas_reset(Canvas* canvas) {
 
 void canvas_commit(Canvas* canvas) {
     furi_assert(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+
+    uint8_t* buffer = u8g2_GetBufferPtr(&canvas->fb);
+    size_t page_size = canvas->fb.pixel_buf_width;
+    uint8_t page_count = u8g2_GetBufferTileHeight(&canvas->fb);
+
+    // Only send 8 row pages that changed since the last commit
+    for(uint8_t page = 0; page < page_count; page++) {
+        uint8_t* data = buffer + page * page_size;
+        uint8_t* sent = canvas->sent_buffer + page * page_size;
+        if(canvas->sent_buffer_valid && memcmp(data, sent, page_size) == 0) continue;
+
+        u8g2_UpdateDisplayArea(&canvas->fb, 0, page, u8g2_GetBufferTileWidth(&canvas->fb), 1);
+        memcpy(sent, data, page_size);
+    }
+    canvas->sent_buffer_valid = true;
+
+    u8x8_RefreshDisplay(u8g2_GetU8x8(&canvas->fb));
+}
+
+void canvas_invalidate(Canvas* canvas) {
+    furi_assert(canvas);
+    canvas->sent_buffer_valid = false;
 }
 
 uint8_t* canvas_get_buffer(Canvas* canvas) {
@@ -359,6 +382,70 @@ static void canvas_draw_u8g2_bitmap_int(
     }
 }
 
+/* Resolve 8 bit coordinate wrap the same way u8g2 does for negative positions */
+static int32_t canvas_bitmap_start(u8g2_uint_t pos, u8g2_uint_t size) {
+    int32_t start = pos;
+    if(start + size > 256) start -= 256;
+    return start;
+}
+
+/* Unrotated bitmap on unrotated canvas: clip once and write framebuffer bytes directly */
+static bool canvas_draw_u8g2_bitmap_fast(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    const uint8_t* bitmap) {
+    if(u8g2->cb != U8G2_R0 || u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb) return false;
+    if(w > 128 || h > 128) return false;
+    if(!u8g2->is_page_clip_window_intersection) return true;
+
+    int32_t bx = canvas_bitmap_start(x, w);
+    int32_t by = canvas_bitmap_start(y, h);
+    int32_t x0 = MAX(bx, (int32_t)u8g2->user_x0);
+    int32_t x1 = MIN(bx + w, (int32_t)u8g2->user_x1);
+    int32_t y0 = MAX(by, (int32_t)u8g2->user_y0);
+    int32_t y1 = MIN(by + h, (int32_t)u8g2->user_y1);
+    if(x0 >= x1 || y0 >= y1) return true;
+
+    const size_t stride = (w + 7) / 8;
+    const uint8_t color = u8g2->draw_color;
+    const uint8_t ncolor = (color == 0 ? 1 : 0);
+    const bool transparent = u8g2->bitmap_transparency;
+
+    for(int32_t row = y0; row < y1; row++) {
+        const uint8_t* src = bitmap + (row - by) * stride;
+        int32_t buffer_row = row - u8g2->pixel_curr_row;
+        uint8_t* dst = u8g2->tile_buf_ptr + (buffer_row >> 3) * u8g2->pixel_buf_width;
+        uint8_t mask = 1 << (buffer_row & 7);
+
+        // Same or/xor masks as u8g2_ll_hvline_vertical_top_lsb
+        uint8_t set_or = color <= 1 ? mask : 0;
+        uint8_t set_xor = color != 1 ? mask : 0;
+        uint8_t clear_or = ncolor <= 1 ? mask : 0;
+        uint8_t clear_xor = ncolor != 1 ? mask : 0;
+
+        for(int32_t col = x0; col < x1; col++) {
+            int32_t bit = col - bx;
+            uint8_t data = src[bit >> 3];
+            if(transparent && !data && !(bit & 7) && col + 8 <= x1) {
+                col += 7;
+                continue;
+            }
+            if(data & (1 << (bit & 7))) {
+                dst[col] |= set_or;
+                dst[col] ^= set_xor;
+            } else if(!transparent) {
+                dst[col] |= clear_or;
+                dst[col] ^= clear_xor;
+            }
+        }
+    }
+
+    return true;
+}
+
 void canvas_draw_u8g2_bitmap(
     u8g2_t* u8g2,
     u8g2_uint_t x,
@@ -377,7 +464,9 @@ void canvas_draw_u8g2_bitmap(
 
     switch(rotation) {
     case IconRotation0:
-        canvas_draw_u8g2_bitmap_int(u8g2, x, y, w, h, 0, 0, bitmap);
+        if(!canvas_draw_u8g2_bitmap_fast(u8g2, x, y, w, h, bitmap)) {
+            canvas_draw_u8g2_bitmap_int(u8g2, x, y, w, h, 0, 0, bitmap);
+        }
         break;
     case IconRotation90:
         canvas_draw_u8g2_bitmap_int(u8g2, x, y, w, h, 0, 1, bitmap);
@@ -23,6 +23,8 @@ struct Canvas {
     uint8_t width;
     uint8_t height;
     CompressIcon* compress_icon;
+    uint8_t* sent_buffer;
+    bool sent_buffer_valid;
 };
 
 /** Allocate memory and initialize canvas
@@ -37,6 +39,14 @@ Canvas* canvas_init();
  */
 void canvas_free(Canvas* canvas);
 
+/** Invalidate display contents, next commit sends the whole buffer
+ *
+ * Use it after display controller was reinitialized.
+ *
+ * @param      canvas  Canvas instance
+ */
+void canvas_invalidate(Canvas* canvas);
+
 /** Get canvas buffer.
  *
  * @param      canvas  Canvas instance
@@ -1,11 +1,24 @@
 #include <xtreme.h>
 #include "gui_i.h"
+#include <furi_hal.h>
 #include <assets_icons.h>
 #include <storage/storage.h>
 #include <storage/storage_i.h>
 
 #define TAG "GuiSrv"
 
+static const char* const gui_profiler_keys[GuiProfilerSlotMAX] = {
+    [GuiProfilerSlotFrame] = "frame",
+    [GuiProfilerSlotFullscreen] = "fullscreen",
+    [GuiProfilerSlotWindow] = "window",
+    [GuiProfilerSlotDesktop] = "desktop",
+    [GuiProfilerSlotStatusBar] = "status_bar",
+    [GuiProfilerSlotCommit] = "commit",
+    [GuiProfilerSlotCallbacks] = "callbacks",
+    [GuiProfilerSlotInput] = "input",
+    [GuiProfilerSlotViewInput] = "view_input",
+};
+
 ViewPort* gui_view_port_find_enabled(ViewPortArray_t array) {
     // Iterating backward
     ViewPortArray_it_t it;
@@ -42,26 +55,19 @@ size_t gui_active_view_port_count(Gui* gui, GuiLayer layer) {
 
 void gui_update(Gui* gui) {
     furi_assert(gui);
+    gui->frame_stats.requested++;
     if(!gui->direct_draw) furi_thread_flags_set(gui->thread_id, GUI_THREAD_FLAG_DRAW);
 }
 
-void gui_input_events_callback(const void* value, void* ctx) {
-    furi_assert(value);
-    furi_assert(ctx);
-
-    Gui* gui = ctx;
-
-    furi_message_queue_put(gui->input_queue, value, FuriWaitForever);
-    furi_thread_flags_set(gui->thread_id, GUI_THREAD_FLAG_INPUT);
-}
-
 // Only Fullscreen supports vertical display for now
 static bool gui_redraw_fs(Gui* gui) {
     canvas_set_orientation(gui->canvas, CanvasOrientationHorizontal);
     canvas_frame_set(gui->canvas, 0, 0, GUI_DISPLAY_WIDTH, GUI_DISPLAY_HEIGHT);
     ViewPort* view_port = gui_view_port_find_enabled(gui->layers[GuiLayerFullscreen]);
     if(view_port) {
+        profiler_start(gui->profiler, GuiProfilerSlotFullscreen);
         view_port_draw(view_port, gui->canvas);
+        profiler_stop(gui->profiler, GuiProfilerSlotFullscreen);
         return true;
     } else {
         return false;
@@ -249,7 +255,9 @@ static bool gui_redraw_window(Gui* gui) {
     canvas_frame_set(gui->canvas, GUI_WINDOW_X, GUI_WINDOW_Y, GUI_WINDOW_WIDTH, GUI_WINDOW_HEIGHT);
     ViewPort* view_port = gui_view_port_find_enabled(gui->layers[GuiLayerWindow]);
     if(view_port) {
+        profiler_start(gui->profiler, GuiProfilerSlotWindow);
         view_port_draw(view_port, gui->canvas);
+        profiler_stop(gui->profiler, GuiProfilerSlotWindow);
         return true;
     }
     return false;
@@ -260,7 +268,9 @@ static bool gui_redraw_desktop(Gui* gui) {
     canvas_frame_set(gui->canvas, 0, 0, GUI_DISPLAY_WIDTH, GUI_DISPLAY_HEIGHT);
     ViewPort* view_port = gui_view_port_find_enabled(gui->layers[GuiLayerDesktop]);
     if(view_port) {
+        profiler_start(gui->profiler, GuiProfilerSlotDesktop);
         view_port_draw(view_port, gui->canvas);
+        profiler_stop(gui->profiler, GuiProfilerSlotDesktop);
         return true;
     }
 
@@ -274,6 +284,12 @@ static void gui_redraw(Gui* gui) {
     do {
         if(gui->direct_draw) break;
 
+        uint32_t cycles = DWT->CYCCNT;
+        gui->frame_tick = furi_get_tick();
+        // Drawn ViewPorts raise it to their own interval
+        gui->frame_interval = GUI_FRAME_INTERVAL_MIN;
+
+        profiler_start(gui->profiler, GuiProfilerSlotFrame);
         canvas_reset(gui->canvas);
 
         if(gui->lockdown) {
@@ -282,18 +298,36 @@ static void gui_redraw(Gui* gui) {
                 (gui_view_port_find_enabled(gui->layers[GuiLayerWindow]) != 0 ||
                  gui_view_port_find_enabled(gui->layers[GuiLayerFullscreen]) != 0);
             if(xtreme_settings.lockscreen_statusbar) {
+                profiler_start(gui->profiler, GuiProfilerSlotStatusBar);
                 gui_redraw_status_bar(gui, need_attention);
+                profiler_stop(gui->profiler, GuiProfilerSlotStatusBar);
             }
         } else {
             if(!gui_redraw_fs(gui)) {
                 if(!gui_redraw_window(gui)) {
                     gui_redraw_desktop(gui);
                 }
+                profiler_start(gui->profiler, GuiProfilerSlotStatusBar);
                 gui_redraw_status_bar(gui, false);
+                profiler_stop(gui->profiler, GuiProfilerSlotStatusBar);
             }
         }
 
+        profiler_start(gui->profiler, GuiProfilerSlotCommit);
         canvas_commit(gui->canvas);
+        profiler_stop(gui->profiler, GuiProfilerSlotCommit);
+
+        uint32_t draw_time =
+            (DWT->CYCCNT - cycles) / furi_hal_cortex_instructions_per_microsecond();
+        gui->frame_stats.drawn++;
+        if(draw_time > gui->frame_stats.draw_time_max) {
+            gui->frame_stats.draw_time_max = draw_time;
+        }
+        if(draw_time > GUI_FRAME_INTERVAL_MIN * 1000) {
+            gui->frame_stats.dropped++;
+        }
+
+        profiler_start(gui->profiler, GuiProfilerSlotCallbacks);
         for
             M_EACH(p, gui->canvas_callback_pair, CanvasCallbackPairArray_t) {
                 p->callback(
@@ -302,6 +336,8 @@ static void gui_redraw(Gui* gui) {
                     canvas_get_orientation(gui->canvas),
                     p->context);
             }
+        profiler_stop(gui->profiler, GuiProfilerSlotCallbacks);
+        profiler_stop(gui->profiler, GuiProfilerSlotFrame);
     } while(false);
 
     gui_unlock(gui);
@@ -349,6 +385,7 @@ static void gui_input(Gui* gui, InputEvent* input_event) {
         }
 
         if(view_port && view_port == gui->ongoing_input_view_port) {
+            gui_input_latency_record(gui, input_event, GuiProfilerSlotInput);
             view_port_input(view_port, input_event);
         } else if(gui->ongoing_input_view_port && input_event->type == InputTypeRelease) {
             FURI_LOG_D(
@@ -375,6 +412,26 @@ static void gui_input(Gui* gui, InputEvent* input_event) {
     gui_unlock(gui);
 }
 
+void gui_input_events_callback(const void* value, void* ctx) {
+    furi_assert(value);
+    furi_assert(ctx);
+
+    Gui* gui = ctx;
+
+    gui_input(gui, (InputEvent*)value);
+}
+
+void gui_input_latency_record(Gui* gui, const InputEvent* event, GuiProfilerSlot slot) {
+    furi_assert(gui);
+    furi_assert(event);
+    furi_assert(slot == GuiProfilerSlotInput || slot == GuiProfilerSlotViewInput);
+
+    uint32_t time;
+    if(input_get_event_time(event, &time)) {
+        profiler_add_sample(gui->profiler, slot, DWT->CYCCNT - time);
+    }
+}
+
 void gui_lock(Gui* gui) {
     furi_assert(gui);
     furi_check(furi_mutex_acquire(gui->mutex, FuriWaitForever) == FuriStatusOk);
@@ -567,6 +624,23 @@ Canvas* gui_direct_draw_acquire(Gui* gui) {
     return gui->canvas;
 }
 
+void gui_get_frame_stats(Gui* gui, GuiFrameStats* stats) {
+    furi_assert(gui);
+    furi_assert(stats);
+
+    gui_lock(gui);
+    *stats = gui->frame_stats;
+    gui_unlock(gui);
+}
+
+void gui_reset_frame_stats(Gui* gui) {
+    furi_assert(gui);
+
+    gui_lock(gui);
+    memset(&gui->frame_stats, 0, sizeof(GuiFrameStats));
+    gui_unlock(gui);
+}
+
 void gui_direct_draw_release(Gui* gui) {
     furi_assert(gui);
 
@@ -594,13 +668,24 @@ Gui* gui_alloc() {
     // Drawing canvas
     gui->canvas = canvas_init();
     CanvasCallbackPairArray_init(gui->canvas_callback_pair);
+    // Profiler
+    gui->profiler = profiler_alloc("gui", GuiProfilerSlotMAX);
+    for(size_t i = 0; i < GuiProfilerSlotMAX; i++) {
+        furi_check(profiler_register(gui->profiler, gui_profiler_keys[i]) == i);
+    }
 
     // Input
-    gui->input_queue = furi_message_queue_alloc(8, sizeof(InputEvent));
     gui->input_events = furi_record_open(RECORD_INPUT_EVENTS);
 
     furi_check(gui->input_events);
-    furi_pubsub_subscribe(gui->input_events, gui_input_events_callback, gui);
+    gui->input_events_subscription = furi_pubsub_subscribe_deferred(
+        gui->input_events,
+        gui_input_events_callback,
+        gui,
+        sizeof(InputEvent),
+        GUI_INPUT_QUEUE_SIZE,
+        gui->thread_id,
+        GUI_THREAD_FLAG_INPUT);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     gui_add_view_port(gui, storage->sd_gui.view_port, GuiLayerStatusBarLeft);
@@ -615,21 +700,34 @@ int32_t gui_srv(void* p) {
 
     furi_record_create(RECORD_GUI, gui);
 
+    bool draw_pending = false;
     while(1) {
-        uint32_t flags =
-            furi_thread_flags_wait(GUI_THREAD_FLAG_ALL, FuriFlagWaitAny, FuriWaitForever);
+        // Hold pending redraw until its frame slot, requests in between are merged
+        uint32_t timeout = FuriWaitForever;
+        if(draw_pending) {
+            uint32_t elapsed = furi_get_tick() - gui->frame_tick;
+            uint32_t interval = furi_ms_to_ticks(gui->frame_interval);
+            timeout = elapsed < interval ? interval - elapsed : 0;
+        }
+
+        uint32_t flags = 0;
+        if(timeout) {
+            flags = furi_thread_flags_wait(GUI_THREAD_FLAG_ALL, FuriFlagWaitAny, timeout);
+            if(flags & FuriFlagError) flags = 0;
+        }
         // Process and dispatch input
         if(flags & GUI_THREAD_FLAG_INPUT) {
             // Process till queue become empty
-            InputEvent input_event;
-            while(furi_message_queue_get(gui->input_queue, &input_event, 0) == FuriStatusOk) {
-                gui_input(gui, &input_event);
-            }
+            furi_pubsub_subscription_dispatch(gui->input_events_subscription);
         }
-        // Process and dispatch draw call
         if(flags & GUI_THREAD_FLAG_DRAW) {
+            draw_pending = true;
+        }
+        // Process and dispatch draw call
+        if(draw_pending && !timeout) {
             // Clear flags that arrived on input step
             furi_thread_flags_clear(GUI_THREAD_FLAG_DRAW);
+            draw_pending = false;
             gui_redraw(gui);
         }
     }
@@ -26,6 +26,17 @@ typedef enum {
     GuiLayerMAX /**< Don't use or move, special value */
 } GuiLayer;
 
+/** Maximum frame rate, redraw requests that come faster are merged */
+#define GUI_FRAME_RATE_MAX 60
+
+/** Frame statistics */
+typedef struct {
+    uint32_t requested; /**< Redraw requests, including merged ones */
+    uint32_t drawn; /**< Frames drawn */
+    uint32_t draw_time_max; /**< Longest frame draw and commit time, us */
+    uint32_t dropped; /**< Frames that took longer than frame slot, next one was late */
+} GuiFrameStats;
+
 /** Gui Canvas Commit Callback */
 typedef void (*GuiCanvasCommitCallback)(
     uint8_t* data,
@@ -141,6 +152,22 @@ Canvas* gui_direct_draw_acquire(Gui* gui);
  */
 void gui_direct_draw_release(Gui* gui);
 
+/** Get frame statistics
+ *
+ * Counters run since boot or last gui_reset_frame_stats call. Per layer draw
+ * times and input latency are collected by `gui` profiler, see toolbox/profiler.h.
+ *
+ * @param      gui    Gui instance
+ * @param      stats  pointer to GuiFrameStats to fill
+ */
+void gui_get_frame_stats(Gui* gui, GuiFrameStats* stats);
+
+/** Reset frame statistics
+ *
+ * @param      gui   Gui instance
+ */
+void gui_reset_frame_stats(Gui* gui);
+
 #ifdef __cplusplus
 }
 #endif
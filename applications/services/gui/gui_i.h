@@ -9,6 +9,7 @@
 
 #include <furi.h>
 #include <furi_hal_rtc.h>
+#include <toolbox/profiler.h>
 #include <m-array.h>
 #include <m-algo.h>
 #include <stdio.h>
@@ -42,6 +43,25 @@
 #define GUI_THREAD_FLAG_INPUT (1 << 1)
 #define GUI_THREAD_FLAG_ALL (GUI_THREAD_FLAG_DRAW | GUI_THREAD_FLAG_INPUT)
 
+#define GUI_INPUT_QUEUE_SIZE 8
+
+/** Minimal interval between frames, ms. Redraw requests in between are merged */
+#define GUI_FRAME_INTERVAL_MIN (1000 / GUI_FRAME_RATE_MAX)
+
+/** Gui profiler slots, registered in this order */
+typedef enum {
+    GuiProfilerSlotFrame, /**< Whole frame: draw, commit and callbacks */
+    GuiProfilerSlotFullscreen,
+    GuiProfilerSlotWindow,
+    GuiProfilerSlotDesktop,
+    GuiProfilerSlotStatusBar,
+    GuiProfilerSlotCommit, /**< Display transfer */
+    GuiProfilerSlotCallbacks, /**< Canvas commit callbacks */
+    GuiProfilerSlotInput, /**< Input edge to ViewPort input callback */
+    GuiProfilerSlotViewInput, /**< Input edge to View input callback in ViewDispatcher */
+    GuiProfilerSlotMAX,
+} GuiProfilerSlot;
+
 ARRAY_DEF(ViewPortArray, ViewPort*, M_PTR_OPLIST);
 
 typedef struct {
@@ -69,12 +89,18 @@ struct Gui {
     CanvasCallbackPairArray_t canvas_callback_pair;
 
     // Input
-    FuriMessageQueue* input_queue;
     FuriPubSub* input_events;
+    FuriPubSubSubscription* input_events_subscription;
     uint8_t ongoing_input;
     ViewPort* ongoing_input_view_port;
 
     uint16_t hide_statusbar_count;
+
+    // Frame pacing
+    uint32_t frame_tick;
+    uint32_t frame_interval;
+    GuiFrameStats frame_stats;
+    Profiler* profiler;
 };
 
 /** Find enabled ViewPort in ViewPortArray
@@ -100,6 +126,17 @@ void gui_update(Gui* gui);
  */
 void gui_input_events_callback(const void* value, void* ctx);
 
+/** Record time since input event edge to profiler
+ *
+ * Only Press, Release and Short hardware events have edge time, others are
+ * ignored. Slot must not be fed from more than one thread.
+ *
+ * @param      gui    Gui instance
+ * @param      event  received input event
+ * @param      slot   GuiProfilerSlotInput or GuiProfilerSlotViewInput
+ */
+void gui_input_latency_record(Gui* gui, const InputEvent* event, GuiProfilerSlot slot);
+
 /** Get count of view ports in layer
  *
  * @param      gui        The Gui instance
@@ -1,13 +1,18 @@
 #include "icon_i.h"
 
+#include <xtreme.h>
+
 uint8_t icon_get_width(const Icon* instance) {
+    if(instance->original) XTREME_ASSETS_USE(instance);
     return instance->width;
 }
 
 uint8_t icon_get_height(const Icon* instance) {
+    if(instance->original) XTREME_ASSETS_USE(instance);
     return instance->height;
 }
 
 const uint8_t* icon_get_data(const Icon* instance) {
+    if(instance->original) XTREME_ASSETS_USE(instance);
     return instance->frames[0];
 }
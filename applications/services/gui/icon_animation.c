@@ -2,9 +2,12 @@
 #include "icon_i.h"
 
 #include <furi.h>
+#include <xtreme.h>
 
 IconAnimation* icon_animation_alloc(const Icon* icon) {
     furi_assert(icon);
+    /* Frame count must not change while animation runs, so replacement is loaded now */
+    if(icon->original) XTREME_ASSETS_USE(icon);
     IconAnimation* instance = malloc(sizeof(IconAnimation));
     instance->icon = icon;
     instance->timer =
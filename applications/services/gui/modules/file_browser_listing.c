@@ -0,0 +1,466 @@
+#include "file_browser_listing.h"
+
+#include <storage/storage.h>
+#include <m-array.h>
+#include <xtreme.h>
+#include <ctype.h>
+
+#define TAG "BrowserListing"
+
+#define BROWSER_LISTING_DIR EXT_PATH(".tmp")
+
+/** RAM pool for collecting entries, reused for run readers while merging */
+#define BROWSER_LISTING_POOL_SIZE (8192U)
+#define BROWSER_LISTING_POOL_ENTRIES (512U)
+#define BROWSER_LISTING_RUNS_MAX (32U)
+#define BROWSER_LISTING_BUFFER_SIZE (BROWSER_LISTING_POOL_SIZE / BROWSER_LISTING_RUNS_MAX)
+#define BROWSER_LISTING_WRITE_BUFFER_SIZE (512U)
+
+/** Every Nth record offset is kept in RAM index */
+#define BROWSER_LISTING_INDEX_STEP (32U)
+
+/** Record: flags, name length, name without terminator */
+#define BROWSER_LISTING_HEADER_SIZE (2U)
+#define BROWSER_LISTING_NAME_LEN_MAX (253U)
+#define BROWSER_LISTING_FLAG_DIR (1U << 0)
+
+_Static_assert(
+    BROWSER_LISTING_HEADER_SIZE + BROWSER_LISTING_NAME_LEN_MAX <= BROWSER_LISTING_BUFFER_SIZE,
+    "Record must fit in reader buffer");
+
+ARRAY_DEF(BrowserListingIndex, uint32_t, M_POD_OPLIST)
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t start;
+    uint32_t pos;
+    uint32_t end;
+} BrowserListingReader;
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    uint32_t offset;
+} BrowserListingWriter;
+
+struct BrowserListing {
+    Storage* storage;
+    FuriString* listing_path;
+    FuriString* runs_path;
+    File* file;
+    File* runs;
+
+    bool valid;
+    uint32_t count;
+    uint32_t size;
+    BrowserListingIndex_t index;
+    BrowserListingReader reader;
+    uint8_t reader_data[BROWSER_LISTING_BUFFER_SIZE];
+
+    // Build state, allocated from begin till end
+    uint8_t* pool;
+    size_t pool_size;
+    uint16_t* entries;
+    size_t entry_count;
+    uint32_t run_offsets[BROWSER_LISTING_RUNS_MAX + 1];
+    size_t run_count;
+    BrowserListingWriter writer;
+};
+
+static int browser_listing_cmp(const uint8_t* a, const uint8_t* b) {
+    bool a_dir = a[0] & BROWSER_LISTING_FLAG_DIR;
+    bool b_dir = b[0] & BROWSER_LISTING_FLAG_DIR;
+    if(xtreme_settings.sort_dirs_first && a_dir != b_dir) {
+        return a_dir ? -1 : 1;
+    }
+
+    // Same order as furi_string_cmpi()
+    size_t len = MIN(a[1], b[1]);
+    for(size_t i = 0; i < len; i++) {
+        int diff = toupper(a[BROWSER_LISTING_HEADER_SIZE + i]) -
+                   toupper(b[BROWSER_LISTING_HEADER_SIZE + i]);
+        if(diff) return diff;
+    }
+    return a[1] - b[1];
+}
+
+static void browser_listing_reader_init(
+    BrowserListingReader* reader,
+    uint8_t* data,
+    uint32_t pos,
+    uint32_t end) {
+    reader->data = data;
+    reader->size = 0;
+    reader->start = 0;
+    reader->pos = pos;
+    reader->end = end;
+}
+
+static bool browser_listing_reader_fill(BrowserListingReader* reader, File* file) {
+    // Keep the unread part and read more after it
+    memmove(reader->data, reader->data + reader->start, reader->size - reader->start);
+    reader->size -= reader->start;
+    reader->start = 0;
+
+    size_t to_read = MIN(BROWSER_LISTING_BUFFER_SIZE - reader->size, reader->end - reader->pos);
+    if(!to_read) return true;
+    if(!storage_file_seek(file, reader->pos, true)) return false;
+    if(storage_file_read(file, reader->data + reader->size, to_read) != to_read) return false;
+
+    reader->size += to_read;
+    reader->pos += to_read;
+    return true;
+}
+
+static bool browser_listing_reader_has_record(BrowserListingReader* reader) {
+    size_t available = reader->size - reader->start;
+    return available >= BROWSER_LISTING_HEADER_SIZE &&
+           available >= BROWSER_LISTING_HEADER_SIZE + reader->data[reader->start + 1];
+}
+
+/* Get current record, NULL at the end of data or on read error */
+static const uint8_t* browser_listing_reader_peek(BrowserListingReader* reader, File* file) {
+    if(!browser_listing_reader_has_record(reader)) {
+        if(!browser_listing_reader_fill(reader, file)) return NULL;
+        if(!browser_listing_reader_has_record(reader)) return NULL;
+    }
+    return reader->data + reader->start;
+}
+
+static void browser_listing_reader_next(BrowserListingReader* reader) {
+    reader->start += BROWSER_LISTING_HEADER_SIZE + reader->data[reader->start + 1];
+}
+
+static bool browser_listing_writer_flush(BrowserListingWriter* writer, File* file) {
+    if(writer->size) {
+        if(storage_file_write(file, writer->data, writer->size) != writer->size) return false;
+        writer->size = 0;
+    }
+    return true;
+}
+
+static bool
+    browser_listing_writer_put(BrowserListingWriter* writer, File* file, const uint8_t* record) {
+    size_t size = BROWSER_LISTING_HEADER_SIZE + record[1];
+    if(writer->size + size > BROWSER_LISTING_WRITE_BUFFER_SIZE) {
+        if(!browser_listing_writer_flush(writer, file)) return false;
+    }
+    memcpy(writer->data + writer->size, record, size);
+    writer->size += size;
+    writer->offset += size;
+    return true;
+}
+
+static void browser_listing_pool_sort(BrowserListing* listing) {
+    uint16_t* entries = listing->entries;
+    size_t count = listing->entry_count;
+
+    // Shell sort, no recursion and no extra memory
+    for(size_t gap = count / 2; gap > 0; gap /= 2) {
+        for(size_t i = gap; i < count; i++) {
+            uint16_t entry = entries[i];
+            size_t j = i;
+            while(j >= gap &&
+                  browser_listing_cmp(listing->pool + entries[j - gap], listing->pool + entry) >
+                      0) {
+                entries[j] = entries[j - gap];
+                j -= gap;
+            }
+            entries[j] = entry;
+        }
+    }
+}
+
+static bool browser_listing_flush_run(BrowserListing* listing) {
+    if(!listing->entry_count) return true;
+    if(listing->run_count == BROWSER_LISTING_RUNS_MAX) {
+        FURI_LOG_W(TAG, "Too many entries");
+        return false;
+    }
+
+    if(!listing->runs) {
+        listing->runs = storage_file_alloc(listing->storage);
+        if(!storage_file_open(
+               listing->runs,
+               furi_string_get_cstr(listing->runs_path),
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS)) {
+            return false;
+        }
+        listing->writer.offset = 0;
+    }
+
+    browser_listing_pool_sort(listing);
+
+    listing->run_offsets[listing->run_count] = listing->writer.offset;
+    for(size_t i = 0; i < listing->entry_count; i++) {
+        const uint8_t* record = listing->pool + listing->entries[i];
+        if(!browser_listing_writer_put(&listing->writer, listing->runs, record)) return false;
+    }
+    if(!browser_listing_writer_flush(&listing->writer, listing->runs)) return false;
+    listing->run_count++;
+    listing->run_offsets[listing->run_count] = listing->writer.offset;
+
+    listing->pool_size = 0;
+    listing->entry_count = 0;
+    return true;
+}
+
+static bool browser_listing_emit(
+    BrowserListing* listing,
+    const uint8_t* record,
+    const char* selected,
+    int32_t* selected_idx) {
+    if(listing->count % BROWSER_LISTING_INDEX_STEP == 0) {
+        BrowserListingIndex_push_back(listing->index, listing->writer.offset);
+    }
+
+    if(selected && *selected_idx < 0 && strlen(selected) == record[1] &&
+       strncmp(selected, (const char*)record + BROWSER_LISTING_HEADER_SIZE, record[1]) == 0) {
+        *selected_idx = listing->count;
+    }
+
+    listing->count++;
+    return browser_listing_writer_put(&listing->writer, listing->file, record);
+}
+
+static bool browser_listing_merge(
+    BrowserListing* listing,
+    const char* selected,
+    int32_t* selected_idx) {
+    // Entries are in runs now, pool becomes reader buffers
+    BrowserListingReader* readers = malloc(sizeof(BrowserListingReader) * listing->run_count);
+    for(size_t i = 0; i < listing->run_count; i++) {
+        browser_listing_reader_init(
+            &readers[i],
+            listing->pool + i * BROWSER_LISTING_BUFFER_SIZE,
+            listing->run_offsets[i],
+            listing->run_offsets[i + 1]);
+    }
+
+    bool ok = true;
+    while(ok) {
+        BrowserListingReader* next = NULL;
+        const uint8_t* next_record = NULL;
+        for(size_t i = 0; i < listing->run_count; i++) {
+            BrowserListingReader* reader = &readers[i];
+            const uint8_t* record = browser_listing_reader_peek(reader, listing->runs);
+            if(!record) {
+                // Not at the end of run means read error
+                if(reader->pos != reader->end || reader->start != reader->size) ok = false;
+                continue;
+            }
+            if(!next_record || browser_listing_cmp(record, next_record) < 0) {
+                next = reader;
+                next_record = record;
+            }
+        }
+        if(!ok || !next) break;
+
+        ok = browser_listing_emit(listing, next_record, selected, selected_idx);
+        browser_listing_reader_next(next);
+    }
+
+    free(readers);
+    return ok;
+}
+
+static void browser_listing_free_build(BrowserListing* listing) {
+    if(listing->runs) {
+        storage_file_close(listing->runs);
+        storage_file_free(listing->runs);
+        listing->runs = NULL;
+        storage_simply_remove(listing->storage, furi_string_get_cstr(listing->runs_path));
+    }
+
+    free(listing->pool);
+    listing->pool = NULL;
+    free(listing->entries);
+    listing->entries = NULL;
+    free(listing->writer.data);
+    listing->writer.data = NULL;
+}
+
+BrowserListing* browser_listing_alloc(uint32_t id) {
+    BrowserListing* listing = malloc(sizeof(BrowserListing));
+    listing->storage = furi_record_open(RECORD_STORAGE);
+    listing->listing_path =
+        furi_string_alloc_printf("%s/browser_%08lX.lst", BROWSER_LISTING_DIR, id);
+    listing->runs_path = furi_string_alloc_printf("%s/browser_%08lX.run", BROWSER_LISTING_DIR, id);
+    listing->file = storage_file_alloc(listing->storage);
+    BrowserListingIndex_init(listing->index);
+    return listing;
+}
+
+void browser_listing_free(BrowserListing* listing) {
+    furi_assert(listing);
+
+    browser_listing_reset(listing);
+
+    BrowserListingIndex_clear(listing->index);
+    storage_file_free(listing->file);
+    furi_string_free(listing->runs_path);
+    furi_string_free(listing->listing_path);
+    furi_record_close(RECORD_STORAGE);
+    free(listing);
+}
+
+void browser_listing_reset(BrowserListing* listing) {
+    furi_assert(listing);
+
+    browser_listing_free_build(listing);
+
+    if(storage_file_is_open(listing->file)) {
+        storage_file_close(listing->file);
+        storage_simply_remove(listing->storage, furi_string_get_cstr(listing->listing_path));
+    }
+
+    BrowserListingIndex_reset(listing->index);
+    listing->valid = false;
+    listing->count = 0;
+    listing->size = 0;
+}
+
+bool browser_listing_begin(BrowserListing* listing) {
+    furi_assert(listing);
+
+    browser_listing_reset(listing);
+
+    storage_simply_mkdir(listing->storage, BROWSER_LISTING_DIR);
+    if(!storage_file_open(
+           listing->file,
+           furi_string_get_cstr(listing->listing_path),
+           FSAM_READ_WRITE,
+           FSOM_CREATE_ALWAYS)) {
+        storage_file_close(listing->file);
+        return false;
+    }
+
+    listing->pool = malloc(BROWSER_LISTING_POOL_SIZE);
+    listing->pool_size = 0;
+    listing->entries = malloc(BROWSER_LISTING_POOL_ENTRIES * sizeof(uint16_t));
+    listing->entry_count = 0;
+    listing->run_count = 0;
+    listing->writer.data = malloc(BROWSER_LISTING_WRITE_BUFFER_SIZE);
+    listing->writer.size = 0;
+    listing->writer.offset = 0;
+
+    return true;
+}
+
+bool browser_listing_add(BrowserListing* listing, const char* name, bool is_dir) {
+    furi_assert(listing);
+    furi_assert(name);
+
+    if(!listing->pool) return false;
+
+    size_t len = strlen(name);
+    bool ok = len <= BROWSER_LISTING_NAME_LEN_MAX;
+    size_t size = BROWSER_LISTING_HEADER_SIZE + len;
+
+    if(ok && (listing->pool_size + size > BROWSER_LISTING_POOL_SIZE ||
+              listing->entry_count == BROWSER_LISTING_POOL_ENTRIES)) {
+        ok = browser_listing_flush_run(listing);
+    }
+
+    if(!ok) {
+        browser_listing_reset(listing);
+        return false;
+    }
+
+    uint8_t* record = listing->pool + listing->pool_size;
+    record[0] = is_dir ? BROWSER_LISTING_FLAG_DIR : 0;
+    record[1] = len;
+    memcpy(record + BROWSER_LISTING_HEADER_SIZE, name, len);
+    listing->entries[listing->entry_count++] = listing->pool_size;
+    listing->pool_size += size;
+
+    return true;
+}
+
+bool browser_listing_end(
+    BrowserListing* listing,
+    const char* selected,
+    int32_t* selected_idx,
+    uint32_t* count) {
+    furi_assert(listing);
+    furi_assert(selected_idx);
+    furi_assert(count);
+
+    *selected_idx = -1;
+    *count = 0;
+    if(!listing->pool) return false;
+
+    if(selected && selected[0] == '\0') selected = NULL;
+
+    bool ok = true;
+    if(listing->run_count == 0) {
+        // Everything fits in the pool, no runs needed
+        browser_listing_pool_sort(listing);
+        listing->writer.offset = 0;
+        for(size_t i = 0; ok && i < listing->entry_count; i++) {
+            const uint8_t* record = listing->pool + listing->entries[i];
+            ok = browser_listing_emit(listing, record, selected, selected_idx);
+        }
+    } else {
+        ok = browser_listing_flush_run(listing);
+        listing->writer.offset = 0;
+        ok = ok && browser_listing_merge(listing, selected, selected_idx);
+    }
+    ok = ok && browser_listing_writer_flush(&listing->writer, listing->file);
+    listing->size = listing->writer.offset;
+
+    browser_listing_free_build(listing);
+
+    if(!ok) {
+        FURI_LOG_E(TAG, "Build failed");
+        browser_listing_reset(listing);
+        *selected_idx = -1;
+        return false;
+    }
+
+    listing->valid = true;
+    *count = listing->count;
+    browser_listing_reader_init(&listing->reader, listing->reader_data, 0, listing->size);
+
+    return true;
+}
+
+bool browser_listing_is_valid(BrowserListing* listing) {
+    furi_assert(listing);
+    return listing->valid;
+}
+
+bool browser_listing_seek(BrowserListing* listing, uint32_t index) {
+    furi_assert(listing);
+
+    if(!listing->valid || index >= listing->count) return false;
+
+    uint32_t offset = *BrowserListingIndex_get(listing->index, index / BROWSER_LISTING_INDEX_STEP);
+    browser_listing_reader_init(&listing->reader, listing->reader_data, offset, listing->size);
+
+    for(uint32_t i = 0; i < index % BROWSER_LISTING_INDEX_STEP; i++) {
+        if(!browser_listing_reader_peek(&listing->reader, listing->file)) return false;
+        browser_listing_reader_next(&listing->reader);
+    }
+
+    return true;
+}
+
+bool browser_listing_read(BrowserListing* listing, FuriString* name, bool* is_dir) {
+    furi_assert(listing);
+    furi_assert(name);
+    furi_assert(is_dir);
+
+    if(!listing->valid) return false;
+
+    const uint8_t* record = browser_listing_reader_peek(&listing->reader, listing->file);
+    if(!record) return false;
+
+    furi_string_set_strn(name, (const char*)record + BROWSER_LISTING_HEADER_SIZE, record[1]);
+    *is_dir = record[0] & BROWSER_LISTING_FLAG_DIR;
+    browser_listing_reader_next(&listing->reader);
+
+    return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file file_browser_listing.h
+ * GUI: sorted folder listing kept on SD card
+ *
+ * Folders too large to be sorted in RAM are written to a temporary listing
+ * file in sorted order. Listing is built with external merge sort: entries
+ * are collected in a fixed RAM pool, which is sorted and written out as a
+ * run each time it fills up, then all runs are merged into the listing.
+ * Sparse index of record offsets is kept in RAM, so any window of the
+ * listing is read without going through the whole file.
+ */
+#pragma once
+
+#include <furi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BrowserListing BrowserListing;
+
+/** Allocate BrowserListing
+ *
+ * @param      id    unique id of the owner, used for temporary file names
+ *
+ * @return     BrowserListing instance
+ */
+BrowserListing* browser_listing_alloc(uint32_t id);
+
+/** Free BrowserListing, removes temporary files
+ *
+ * @param      listing  BrowserListing instance
+ */
+void browser_listing_free(BrowserListing* listing);
+
+/** Drop current listing
+ *
+ * @param      listing  BrowserListing instance
+ */
+void browser_listing_reset(BrowserListing* listing);
+
+/** Start building new listing, current one is dropped
+ *
+ * @param      listing  BrowserListing instance
+ *
+ * @return     true on success, false if SD card is not available
+ */
+bool browser_listing_begin(BrowserListing* listing);
+
+/** Add entry to the listing being built
+ *
+ * @param      listing  BrowserListing instance
+ * @param      name     entry name
+ * @param      is_dir   entry is a directory
+ *
+ * @return     true on success, listing is dropped on failure
+ */
+bool browser_listing_add(BrowserListing* listing, const char* name, bool is_dir);
+
+/** Finish building listing
+ *
+ * @param      listing       BrowserListing instance
+ * @param      selected      name to find index of, can be NULL
+ * @param[out] selected_idx  sorted index of selected name, -1 if not found
+ * @param[out] count         number of entries
+ *
+ * @return     true on success, listing is dropped on failure
+ */
+bool browser_listing_end(
+    BrowserListing* listing,
+    const char* selected,
+    int32_t* selected_idx,
+    uint32_t* count);
+
+/** Check if listing is built and can be read
+ *
+ * @param      listing  BrowserListing instance
+ *
+ * @return     true if valid
+ */
+bool browser_listing_is_valid(BrowserListing* listing);
+
+/** Move read position to sorted index
+ *
+ * @param      listing  BrowserListing instance
+ * @param      index    entry index
+ *
+ * @return     true on success
+ */
+bool browser_listing_seek(BrowserListing* listing, uint32_t index);
+
+/** Read entry at read position and advance it
+ *
+ * @param      listing  BrowserListing instance
+ * @param      name     entry name
+ * @param[out] is_dir   entry is a directory
+ *
+ * @return     true on success, false at the end of listing or on error
+ */
+bool browser_listing_read(BrowserListing* listing, FuriString* name, bool* is_dir);
+
+#ifdef __cplusplus
+}
+#endif
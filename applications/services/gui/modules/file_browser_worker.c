@@ -1,4 +1,5 @@
 #include "file_browser_worker.h"
+#include "file_browser_listing.h"
 
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
@@ -55,6 +56,13 @@ struct BrowserWorker {
     BrowserWorkerLongLoadCallback long_load_cb;
 
     bool keep_selection;
+
+    // Directory kept open between chunked loads, positioned after load_dir_pos items
+    File* load_dir;
+    uint32_t load_dir_pos;
+
+    // Sorted copy of current folder on SD, for folders too large to sort in RAM
+    BrowserListing* listing;
 };
 
 static bool browser_path_is_file(FuriString* path) {
@@ -154,6 +162,10 @@ static bool browser_folder_init(
     *item_cnt = 0;
     *file_idx = -1;
 
+    browser_listing_reset(browser->listing);
+    bool can_list = furi_string_start_with_str(path, STORAGE_EXT_PATH_PREFIX);
+    bool listing = false;
+
     if(storage_dir_open(directory, furi_string_get_cstr(path))) {
         state = true;
         while(1) {
@@ -164,13 +176,28 @@ static bool browser_folder_init(
                 total_files_cnt++;
                 furi_string_set(name_str, name_temp);
                 if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    if(!furi_string_empty(filename)) {
+                    if(listing) {
+                        listing = browser_listing_add(
+                            browser->listing, name_temp, file_info_is_dir(&file_info));
+                    } else if(!furi_string_empty(filename)) {
                         if(furi_string_cmp(name_str, filename) == 0) {
                             *file_idx = *item_cnt;
                         }
                     }
                     (*item_cnt)++;
                 }
+                if(can_list && !listing && *item_cnt == BROWSER_SORT_THRESHOLD + 1) {
+                    // Too many to sort in RAM, start over and build sorted listing instead
+                    can_list = false;
+                    if(browser_listing_begin(browser->listing) &&
+                       storage_dir_rewind(directory)) {
+                        listing = true;
+                        *item_cnt = 0;
+                        *file_idx = -1;
+                    } else {
+                        browser_listing_reset(browser->listing);
+                    }
+                }
                 if(total_files_cnt == LONG_LOAD_THRESHOLD) {
                     // There are too many files in folder and counting them will take some time - send callback to app
                     if(browser->long_load_cb) {
@@ -181,6 +208,19 @@ static bool browser_folder_init(
         }
     }
 
+    if(listing) {
+        // Index is only known after sorting, listing order is what the view gets
+        int32_t sorted_idx = -1;
+        uint32_t sorted_cnt = 0;
+        if(browser_listing_end(
+               browser->listing, furi_string_get_cstr(filename), &sorted_idx, &sorted_cnt) &&
+           sorted_cnt == *item_cnt) {
+            *file_idx = sorted_idx;
+        } else {
+            browser_listing_reset(browser->listing);
+        }
+    }
+
     furi_string_free(name_str);
 
     storage_dir_close(directory);
@@ -191,7 +231,29 @@ static bool browser_folder_init(
     return state;
 }
 
+static void browser_folder_cursor_close(BrowserWorker* browser) {
+    if(browser->load_dir) {
+        storage_dir_close(browser->load_dir);
+        storage_file_free(browser->load_dir);
+        furi_record_close(RECORD_STORAGE);
+        browser->load_dir = NULL;
+    }
+}
+
+static bool browser_folder_cursor_open(BrowserWorker* browser, FuriString* path) {
+    if(!browser->load_dir) {
+        browser->load_dir = storage_file_alloc(furi_record_open(RECORD_STORAGE));
+        browser->load_dir_pos = 0;
+        if(!storage_dir_open(browser->load_dir, furi_string_get_cstr(path))) {
+            browser_folder_cursor_close(browser);
+            return false;
+        }
+    }
+    return true;
+}
+
 // Load files list by chunks, like it was originally, not compatible with sorting, sorting needs to be disabled to use this
+// Directory stays open between calls, so scrolling down resumes where previous chunk ended
 static bool browser_folder_load_chunked(
     BrowserWorker* browser,
     FuriString* path,
@@ -199,9 +261,6 @@ static bool browser_folder_load_chunked(
     uint32_t count) {
     FileInfo file_info;
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* directory = storage_file_alloc(storage);
-
     char name_temp[FILE_NAME_LEN_MAX];
     FuriString* name_str;
     name_str = furi_string_alloc();
@@ -209,25 +268,34 @@ static bool browser_folder_load_chunked(
     uint32_t items_cnt = 0;
 
     do {
-        if(!storage_dir_open(directory, furi_string_get_cstr(path))) {
+        if(!browser_folder_cursor_open(browser, path)) {
             break;
         }
+        File* directory = browser->load_dir;
 
-        items_cnt = 0;
-        while(items_cnt < offset) {
+        // Going back needs a full rescan, there is no way to seek directory
+        if(offset < browser->load_dir_pos) {
+            if(!storage_dir_rewind(directory)) {
+                browser_folder_cursor_close(browser);
+                break;
+            }
+            browser->load_dir_pos = 0;
+        }
+
+        while(browser->load_dir_pos < offset) {
             if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
                 break;
             }
             if(storage_file_get_error(directory) == FSE_OK) {
                 furi_string_set(name_str, name_temp);
                 if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    items_cnt++;
+                    browser->load_dir_pos++;
                 }
             } else {
                 break;
             }
         }
-        if(items_cnt != offset) {
+        if(browser->load_dir_pos != offset) {
             break;
         }
 
@@ -249,6 +317,7 @@ static bool browser_folder_load_chunked(
                             browser->cb_ctx, name_str, file_info_is_dir(&file_info), false);
                     }
                     items_cnt++;
+                    browser->load_dir_pos++;
                 }
             } else {
                 break;
@@ -261,10 +330,42 @@ static bool browser_folder_load_chunked(
 
     furi_string_free(name_str);
 
-    storage_dir_close(directory);
-    storage_file_free(directory);
+    return (items_cnt == count);
+}
 
-    furi_record_close(RECORD_STORAGE);
+// Load files list from sorted listing, any chunk is read without rescanning directory
+static bool browser_folder_load_listing(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    FuriString* name_str;
+    name_str = furi_string_alloc();
+    FuriString* path_str;
+    path_str = furi_string_alloc();
+
+    uint32_t items_cnt = 0;
+    bool is_dir = false;
+
+    if(browser->list_load_cb) {
+        browser->list_load_cb(browser->cb_ctx, offset);
+    }
+    if(browser_listing_seek(browser->listing, offset)) {
+        while(items_cnt < count && browser_listing_read(browser->listing, name_str, &is_dir)) {
+            furi_string_printf(
+                path_str, "%s/%s", furi_string_get_cstr(path), furi_string_get_cstr(name_str));
+            if(browser->list_item_cb) {
+                browser->list_item_cb(browser->cb_ctx, path_str, is_dir, false);
+            }
+            items_cnt++;
+        }
+    }
+    if(browser->list_item_cb) {
+        browser->list_item_cb(browser->cb_ctx, NULL, false, true);
+    }
+
+    furi_string_free(path_str);
+    furi_string_free(name_str);
 
     return (items_cnt == count);
 }
@@ -337,6 +438,11 @@ static int32_t browser_worker(void* context) {
             furi_thread_flags_wait(WORKER_FLAGS_ALL, FuriFlagWaitAny, FuriWaitForever);
         furi_assert((flags & FuriFlagError) == 0);
 
+        // Folder contents or filter may change, next chunked load starts from scratch
+        if(flags & (WORKER_FLAGS_ALL & ~WorkerEvtLoad)) {
+            browser_folder_cursor_close(browser);
+        }
+
         if(flags & WorkerEvtConfigChange) {
             if(browser->keep_selection && furi_string_start_with(path, browser->path_next)) {
                 // New path is parent of current, keep prev selected in new view
@@ -437,7 +543,11 @@ static int32_t browser_worker(void* context) {
         if(flags & WorkerEvtLoad) {
             FURI_LOG_D(
                 TAG, "Load offset: %lu cnt: %lu", browser->load_offset, browser->load_count);
-            if(items_cnt > BROWSER_SORT_THRESHOLD) {
+            if(items_cnt > BROWSER_SORT_THRESHOLD &&
+               browser_listing_is_valid(browser->listing)) {
+                browser_folder_load_listing(
+                    browser, path, browser->load_offset, browser->load_count);
+            } else if(items_cnt > BROWSER_SORT_THRESHOLD) {
                 browser_folder_load_chunked(
                     browser, path, browser->load_offset, browser->load_count);
             } else {
@@ -477,6 +587,8 @@ BrowserWorker* file_browser_worker_alloc(
         furi_string_set_str(browser->path_start, base_path);
     }
 
+    browser->listing = browser_listing_alloc((uint32_t)browser);
+
     browser->thread = furi_thread_alloc_ex("BrowserWorker", 2048, browser_worker, browser);
     furi_thread_start(browser->thread);
 
@@ -490,6 +602,8 @@ void file_browser_worker_free(BrowserWorker* browser) {
     furi_thread_join(browser->thread);
     furi_thread_free(browser->thread);
 
+    browser_listing_free(browser->listing);
+
     furi_string_free(browser->filter_extension);
     furi_string_free(browser->path_next);
     furi_string_free(browser->path_current);
@@ -59,8 +59,16 @@ ARRAY_DEF(
      INIT_SET(API_6(SubmenuItem_init_set)),
      CLEAR(API_2(SubmenuItem_clear))))
 
+typedef struct {
+    uint32_t count;
+    SubmenuLabelCallback label_callback;
+    SubmenuItemCallback callback;
+    void* callback_context;
+} SubmenuVirtualItems;
+
 typedef struct {
     SubmenuItemArray_t items;
+    SubmenuVirtualItems virtual_items;
     FuriString* header;
     size_t position;
     size_t window_position;
@@ -77,6 +85,11 @@ static size_t submenu_items_on_screen(bool header, bool vertical) {
     return (header) ? res - 1 : res;
 }
 
+static size_t submenu_items_size(SubmenuModel* model) {
+    if(model->virtual_items.label_callback) return model->virtual_items.count;
+    return SubmenuItemArray_size(model->items);
+}
+
 static void submenu_view_draw_callback(Canvas* canvas, void* _model) {
     SubmenuModel* model = _model;
 
@@ -92,55 +105,60 @@ static void submenu_view_draw_callback(Canvas* canvas, void* _model) {
 
     canvas_set_font(canvas, FontSecondary);
 
-    size_t position = 0;
-    SubmenuItemArray_it_t it;
-    for(SubmenuItemArray_it(it, model->items); !SubmenuItemArray_end_p(it);
-        SubmenuItemArray_next(it)) {
-        const size_t item_position = position - model->window_position;
-        const size_t items_on_screen =
-            submenu_items_on_screen(!furi_string_empty(model->header), model->is_vertical);
-        uint8_t y_offset = furi_string_empty(model->header) ? 0 : item_height;
-
-        if(item_position < items_on_screen) {
-            if(position == model->position) {
-                canvas_set_color(canvas, ColorBlack);
-                elements_slightly_rounded_box(
-                    canvas,
-                    0,
-                    y_offset + (item_position * item_height) + 1,
-                    item_width,
-                    item_height - 2);
-                canvas_set_color(canvas, ColorWhite);
-            } else {
-                canvas_set_color(canvas, ColorBlack);
-            }
-
-            if(SubmenuItemArray_cref(it)->locked) {
-                canvas_draw_icon(
-                    canvas,
-                    item_width - 10,
-                    y_offset + (item_position * item_height) + item_height - 12,
-                    &I_Lock_7x8);
-            }
-
-            FuriString* disp_str;
-            disp_str = furi_string_alloc_set(SubmenuItemArray_cref(it)->label);
-            elements_string_fit_width(
-                canvas, disp_str, item_width - (SubmenuItemArray_cref(it)->locked ? 21 : 11));
+    const size_t items_size = submenu_items_size(model);
+    const size_t items_on_screen =
+        submenu_items_on_screen(!furi_string_empty(model->header), model->is_vertical);
+    uint8_t y_offset = furi_string_empty(model->header) ? 0 : item_height;
+    FuriString* disp_str = furi_string_alloc();
+
+    // Only items on screen are visited
+    for(size_t item_position = 0; item_position < items_on_screen; item_position++) {
+        const size_t position = model->window_position + item_position;
+        if(position >= items_size) break;
+
+        bool locked = false;
+        if(model->virtual_items.label_callback) {
+            furi_string_reset(disp_str);
+            model->virtual_items.label_callback(
+                model->virtual_items.callback_context, position, disp_str);
+        } else {
+            const SubmenuItem* item = SubmenuItemArray_cget(model->items, position);
+            furi_string_set(disp_str, item->label);
+            locked = item->locked;
+        }
 
-            canvas_draw_str(
+        if(position == model->position) {
+            canvas_set_color(canvas, ColorBlack);
+            elements_slightly_rounded_box(
                 canvas,
-                6,
-                y_offset + (item_position * item_height) + item_height - 4,
-                furi_string_get_cstr(disp_str));
+                0,
+                y_offset + (item_position * item_height) + 1,
+                item_width,
+                item_height - 2);
+            canvas_set_color(canvas, ColorWhite);
+        } else {
+            canvas_set_color(canvas, ColorBlack);
+        }
 
-            furi_string_free(disp_str);
+        if(locked) {
+            canvas_draw_icon(
+                canvas,
+                item_width - 10,
+                y_offset + (item_position * item_height) + item_height - 12,
+                &I_Lock_7x8);
         }
 
-        position++;
+        elements_string_fit_width(canvas, disp_str, item_width - (locked ? 21 : 11));
+
+        canvas_draw_str(
+            canvas,
+            6,
+            y_offset + (item_position * item_height) + item_height - 4,
+            furi_string_get_cstr(disp_str));
     }
 
-    elements_scrollbar(canvas, model->position, SubmenuItemArray_size(model->items));
+    furi_string_free(disp_str);
+    elements_scrollbar(canvas, model->position, items_size);
 
     if(model->locked_message_visible) {
         const uint8_t frame_x = 7;
@@ -321,6 +339,29 @@ void submenu_add_lockable_item(
         true);
 }
 
+void submenu_set_virtual_items(
+    Submenu* submenu,
+    uint32_t count,
+    SubmenuLabelCallback label_callback,
+    SubmenuItemCallback callback,
+    void* callback_context) {
+    furi_assert(submenu);
+    furi_assert(label_callback);
+
+    with_view_model(
+        submenu->view,
+        SubmenuModel * model,
+        {
+            model->virtual_items.count = count;
+            model->virtual_items.label_callback = label_callback;
+            model->virtual_items.callback = callback;
+            model->virtual_items.callback_context = callback_context;
+            model->position = 0;
+            model->window_position = 0;
+        },
+        true);
+}
+
 void submenu_reset(Submenu* submenu) {
     furi_assert(submenu);
     view_set_orientation(submenu->view, ViewOrientationHorizontal);
@@ -330,6 +371,7 @@ void submenu_reset(Submenu* submenu) {
         SubmenuModel * model,
         {
             SubmenuItemArray_reset(model->items);
+            memset(&model->virtual_items, 0, sizeof(SubmenuVirtualItems));
             model->position = 0;
             model->window_position = 0;
             model->is_vertical = false;
@@ -344,16 +386,20 @@ void submenu_set_selected_item(Submenu* submenu, uint32_t index) {
         SubmenuModel * model,
         {
             size_t position = 0;
-            SubmenuItemArray_it_t it;
-            for(SubmenuItemArray_it(it, model->items); !SubmenuItemArray_end_p(it);
-                SubmenuItemArray_next(it)) {
-                if(index == SubmenuItemArray_cref(it)->index) {
-                    break;
+            if(model->virtual_items.label_callback) {
+                position = index;
+            } else {
+                SubmenuItemArray_it_t it;
+                for(SubmenuItemArray_it(it, model->items); !SubmenuItemArray_end_p(it);
+                    SubmenuItemArray_next(it)) {
+                    if(index == SubmenuItemArray_cref(it)->index) {
+                        break;
+                    }
+                    position++;
                 }
-                position++;
             }
 
-            const size_t items_size = SubmenuItemArray_size(model->items);
+            const size_t items_size = submenu_items_size(model);
 
             if(position >= items_size) {
                 position = 0;
@@ -388,7 +434,7 @@ void submenu_process_up(Submenu* submenu) {
         {
             const size_t items_on_screen =
                 submenu_items_on_screen(!furi_string_empty(model->header), model->is_vertical);
-            const size_t items_size = SubmenuItemArray_size(model->items);
+            const size_t items_size = submenu_items_size(model);
 
             if(model->position > 0) {
                 model->position--;
@@ -412,7 +458,7 @@ void submenu_process_down(Submenu* submenu) {
         {
             const size_t items_on_screen =
                 submenu_items_on_screen(!furi_string_empty(model->header), model->is_vertical);
-            const size_t items_size = SubmenuItemArray_size(model->items);
+            const size_t items_size = submenu_items_size(model);
 
             if(model->position < items_size - 1) {
                 model->position++;
@@ -430,13 +476,18 @@ void submenu_process_down(Submenu* submenu) {
 
 void submenu_process_ok(Submenu* submenu) {
     SubmenuItem* item = NULL;
+    SubmenuVirtualItems virtual_items = {0};
+    size_t position = 0;
 
     with_view_model(
         submenu->view,
         SubmenuModel * model,
         {
-            const size_t items_size = SubmenuItemArray_size(model->items);
-            if(model->position < items_size) {
+            const size_t items_size = submenu_items_size(model);
+            if(model->virtual_items.label_callback) {
+                if(model->position < items_size) virtual_items = model->virtual_items;
+                position = model->position;
+            } else if(model->position < items_size) {
                 item = SubmenuItemArray_get(model->items, model->position);
             }
             if(item && item->locked) {
@@ -446,7 +497,9 @@ void submenu_process_ok(Submenu* submenu) {
         },
         true);
 
-    if(item && !item->locked && item->callback) {
+    if(virtual_items.callback) {
+        virtual_items.callback(virtual_items.callback_context, position);
+    } else if(item && !item->locked && item->callback) {
         item->callback(item->callback_context, item->index);
     }
 }
@@ -485,7 +538,7 @@ void submenu_set_orientation(Submenu* submenu, ViewOrientation orientation) {
             // Recalculating the position
             // Need if _set_orientation is called after _set_selected_item
             size_t position = model->position;
-            const size_t items_size = SubmenuItemArray_size(model->items);
+            const size_t items_size = submenu_items_size(model);
             const size_t items_on_screen =
                 submenu_items_on_screen(!furi_string_empty(model->header), model->is_vertical);
 
@@ -15,6 +15,14 @@ extern "C" {
 typedef struct Submenu Submenu;
 typedef void (*SubmenuItemCallback)(void* context, uint32_t index);
 
+/** Virtual item label callback
+ *
+ * @param      context  callback context
+ * @param      index    item position, from 0 to count - 1
+ * @param      label    string to fill with item label
+ */
+typedef void (*SubmenuLabelCallback)(void* context, uint32_t index, FuriString* label);
+
 /** Allocate and initialize submenu 
  * 
  * This submenu is used to select one option
@@ -73,6 +81,26 @@ void submenu_add_lockable_item(
     bool locked,
     const char* locked_message);
 
+/** Show virtual items instead of added ones
+ *
+ * Nothing is stored per item, labels are requested only for items that are
+ * on screen, so lists of any length take the same memory and setup time.
+ * Selected item position is passed to callback as index and
+ * submenu_set_selected_item() takes position too. Cleared by submenu_reset().
+ *
+ * @param      submenu           Submenu instance
+ * @param      count             items count
+ * @param      label_callback    item label callback
+ * @param      callback          item selection callback
+ * @param      callback_context  context for both callbacks
+ */
+void submenu_set_virtual_items(
+    Submenu* submenu,
+    uint32_t count,
+    SubmenuLabelCallback label_callback,
+    SubmenuItemCallback callback,
+    void* callback_context);
+
 /** Remove all items from submenu
  *
  * @param      submenu  Submenu instance
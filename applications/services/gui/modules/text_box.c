@@ -3,6 +3,13 @@
 #include <gui/elements.h>
 #include <furi.h>
 #include <stdint.h>
+#include <m-array.h>
+
+// Offsets of line starts in formatted text
+ARRAY_DEF(TextBoxLineArray, size_t, M_POD_OPLIST);
+
+#define TEXT_BOX_TEXT_WIDTH 120
+#define TEXT_BOX_LINES_ON_SCREEN 5
 
 struct TextBox {
     View* view;
@@ -12,8 +19,10 @@ struct TextBox {
 
 typedef struct {
     const char* text;
-    char* text_pos;
+    FuriString* text_pending;
     FuriString* text_formatted;
+    TextBoxLineArray_t lines;
+    size_t line_width;
     int32_t scroll_pos;
     int32_t scroll_num;
     TextBoxFont font;
@@ -28,19 +37,8 @@ static void text_box_process_down(TextBox* text_box, uint8_t lines) {
         {
             if(model->scroll_pos < model->scroll_num - lines) {
                 model->scroll_pos += lines;
-                for(uint8_t i = 0; i < lines; i++) {
-                    // Search next line start
-                    while(*model->text_pos++ != '\n')
-                        ;
-                }
             } else if(lines > 1) {
-                lines = model->scroll_num - model->scroll_pos - 1;
-                model->scroll_pos = model->scroll_num - 1;
-                for(uint8_t i = 0; i < lines; i++) {
-                    // Search next line start
-                    while(*model->text_pos++ != '\n')
-                        ;
-                }
+                model->scroll_pos = MAX(model->scroll_num - 1, 0L);
             }
         },
         true);
@@ -53,62 +51,51 @@ static void text_box_process_up(TextBox* text_box, uint8_t lines) {
         {
             if(model->scroll_pos > lines - 1) {
                 model->scroll_pos -= lines;
-                for(uint8_t i = 0; i < lines; i++) {
-                    // Reach last symbol of previous line
-                    model->text_pos--;
-                    // Search previous line start
-                    while((model->text_pos != model->text) && (*(--model->text_pos) != '\n'))
-                        ;
-                    if(*model->text_pos == '\n') {
-                        model->text_pos++;
-                    }
-                }
             } else if(lines > 1) {
-                lines = model->scroll_pos;
                 model->scroll_pos = 0;
-                model->text_pos = (char*)model->text;
             }
         },
         true);
 }
 
-static void text_box_insert_endline(Canvas* canvas, TextBoxModel* model) {
-    size_t i = 0;
-    size_t line_width = 0;
-    const char* str = model->text;
-    size_t line_num = 0;
+static void text_box_layout_reset(TextBoxModel* model) {
+    furi_string_reset(model->text_formatted);
+    TextBoxLineArray_reset(model->lines);
+    TextBoxLineArray_push_back(model->lines, 0);
+    model->line_width = 0;
+}
 
-    const size_t text_width = 120;
+// Lays out text after already formatted part, lines before it are not touched
+static void text_box_insert_endline(Canvas* canvas, TextBoxModel* model, const char* str) {
+    size_t i = 0;
 
     while(str[i] != '\0') {
         char symb = str[i++];
         if(symb != '\n') {
             size_t glyph_width = canvas_glyph_width(canvas, symb);
-            if(line_width + glyph_width > text_width) {
-                line_num++;
-                line_width = 0;
+            if(model->line_width + glyph_width > TEXT_BOX_TEXT_WIDTH) {
                 furi_string_push_back(model->text_formatted, '\n');
+                TextBoxLineArray_push_back(model->lines, furi_string_size(model->text_formatted));
+                model->line_width = 0;
             }
-            line_width += glyph_width;
+            model->line_width += glyph_width;
+            furi_string_push_back(model->text_formatted, symb);
         } else {
-            line_num++;
-            line_width = 0;
+            furi_string_push_back(model->text_formatted, symb);
+            TextBoxLineArray_push_back(model->lines, furi_string_size(model->text_formatted));
+            model->line_width = 0;
         }
-        furi_string_push_back(model->text_formatted, symb);
     }
-    line_num++;
-    model->text = furi_string_get_cstr(model->text_formatted);
-    model->text_pos = (char*)model->text;
-    if(model->focus == TextBoxFocusEnd && line_num > 5) {
+}
+
+static void text_box_update_scroll(TextBoxModel* model, bool reset_pos) {
+    int32_t line_num = TextBoxLineArray_size(model->lines);
+
+    model->scroll_num = MAX(line_num - (TEXT_BOX_LINES_ON_SCREEN - 1), 0L);
+    if(model->focus == TextBoxFocusEnd && line_num > TEXT_BOX_LINES_ON_SCREEN) {
         // Set text position to 5th line from the end
-        for(uint8_t i = 0; i < line_num - 5; i++) {
-            while(*model->text_pos++ != '\n') {
-            }
-        }
-        model->scroll_num = line_num - 4;
-        model->scroll_pos = line_num - 5;
-    } else {
-        model->scroll_num = MAX(line_num - 4, 0u);
+        model->scroll_pos = line_num - TEXT_BOX_LINES_ON_SCREEN;
+    } else if(reset_pos) {
         model->scroll_pos = 0;
     }
 }
@@ -124,12 +111,22 @@ static void text_box_view_draw_callback(Canvas* canvas, void* _model) {
     }
 
     if(!model->formatted) {
-        text_box_insert_endline(canvas, model);
+        text_box_layout_reset(model);
+        if(model->text) text_box_insert_endline(canvas, model, model->text);
         model->formatted = true;
+        text_box_update_scroll(model, true);
+    }
+    if(!furi_string_empty(model->text_pending)) {
+        text_box_insert_endline(canvas, model, furi_string_get_cstr(model->text_pending));
+        furi_string_reset(model->text_pending);
+        text_box_update_scroll(model, false);
     }
 
+    const char* text = furi_string_get_cstr(model->text_formatted);
+    text += *TextBoxLineArray_get(model->lines, model->scroll_pos);
+
     elements_slightly_rounded_frame(canvas, 0, 0, 124, 64);
-    elements_multiline_text(canvas, 3, 11, model->text_pos);
+    elements_multiline_text(canvas, 3, 11, text);
     elements_scrollbar(canvas, model->scroll_pos, model->scroll_num);
 }
 
@@ -177,7 +174,9 @@ TextBox* text_box_alloc() {
         TextBoxModel * model,
         {
             model->text = NULL;
+            model->text_pending = furi_string_alloc();
             model->text_formatted = furi_string_alloc_set("");
+            TextBoxLineArray_init(model->lines);
             model->formatted = false;
             model->font = TextBoxFontText;
         },
@@ -190,7 +189,14 @@ void text_box_free(TextBox* text_box) {
     furi_assert(text_box);
 
     with_view_model(
-        text_box->view, TextBoxModel * model, { furi_string_free(model->text_formatted); }, true);
+        text_box->view,
+        TextBoxModel * model,
+        {
+            furi_string_free(model->text_pending);
+            furi_string_free(model->text_formatted);
+            TextBoxLineArray_clear(model->lines);
+        },
+        true);
     view_free(text_box->view);
     free(text_box);
 }
@@ -208,7 +214,9 @@ void text_box_reset(TextBox* text_box) {
         TextBoxModel * model,
         {
             model->text = NULL;
+            furi_string_reset(model->text_pending);
             furi_string_set(model->text_formatted, "");
+            model->formatted = false;
             model->font = TextBoxFontText;
             model->focus = TextBoxFocusStart;
         },
@@ -224,6 +232,7 @@ void text_box_set_text(TextBox* text_box, const char* text) {
         TextBoxModel * model,
         {
             model->text = text;
+            furi_string_reset(model->text_pending);
             furi_string_reset(model->text_formatted);
             furi_string_reserve(model->text_formatted, strlen(text));
             model->formatted = false;
@@ -231,6 +240,17 @@ void text_box_set_text(TextBox* text_box, const char* text) {
         true);
 }
 
+void text_box_append_text(TextBox* text_box, const char* text) {
+    furi_assert(text_box);
+    furi_assert(text);
+
+    with_view_model(
+        text_box->view,
+        TextBoxModel * model,
+        { furi_string_cat_str(model->text_pending, text); },
+        true);
+}
+
 void text_box_set_font(TextBox* text_box, TextBoxFont font) {
     furi_assert(text_box);
 
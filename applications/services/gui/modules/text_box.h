@@ -57,6 +57,17 @@ void text_box_reset(TextBox* text_box);
  */
 void text_box_set_text(TextBox* text_box, const char* text);
 
+/** Append text to text_box
+ *
+ * Text is copied. Only appended part is laid out, lines before it are
+ * kept as they are, so streaming output doesn't get slower as it grows.
+ * With TextBoxFocusEnd view follows the end of text.
+ *
+ * @param      text_box  TextBox instance
+ * @param      text      text to append
+ */
+void text_box_append_text(TextBox* text_box, const char* text);
+
 /** Set TextBox font
  *
  * @param      text_box  TextBox instance
@@ -65,83 +65,80 @@ static void variable_item_list_draw_callback(Canvas* canvas, void* _model) {
 
     canvas_set_font(canvas, FontSecondary);
 
-    uint8_t position = 0;
-    VariableItemArray_it_t it;
-    for(VariableItemArray_it(it, model->items); !VariableItemArray_end_p(it);
-        VariableItemArray_next(it)) {
-        uint8_t item_position = position - model->window_position;
-        uint8_t items_on_screen =
-            variable_item_list_items_on_screen(!furi_string_empty(model->header));
-        uint8_t y_offset = furi_string_empty(model->header) ? 0 : item_height;
-
-        if(item_position < items_on_screen) {
-            const VariableItem* item = VariableItemArray_cref(it);
-            uint8_t item_y = y_offset + (item_position * item_height);
-            uint8_t item_text_y = item_y + item_height - 4;
-            size_t scroll_counter = 0;
-
-            if(position == model->position) {
-                canvas_set_color(canvas, ColorBlack);
-                elements_slightly_rounded_box(canvas, 0, item_y + 1, item_width, item_height - 2);
-                canvas_set_color(canvas, ColorWhite);
-                scroll_counter = model->scroll_counter;
-                if(scroll_counter < 1) {
-                    scroll_counter = 0;
-                } else {
-                    scroll_counter -= 1;
-                }
+    const size_t items_size = VariableItemArray_size(model->items);
+    uint8_t items_on_screen =
+        variable_item_list_items_on_screen(!furi_string_empty(model->header));
+    uint8_t y_offset = furi_string_empty(model->header) ? 0 : item_height;
+
+    // Only items on screen are visited
+    for(uint8_t item_position = 0; item_position < items_on_screen; item_position++) {
+        const size_t position = model->window_position + item_position;
+        if(position >= items_size) break;
+
+        const VariableItem* item = VariableItemArray_cget(model->items, position);
+        uint8_t item_y = y_offset + (item_position * item_height);
+        uint8_t item_text_y = item_y + item_height - 4;
+        size_t scroll_counter = 0;
+
+        if(position == model->position) {
+            canvas_set_color(canvas, ColorBlack);
+            elements_slightly_rounded_box(canvas, 0, item_y + 1, item_width, item_height - 2);
+            canvas_set_color(canvas, ColorWhite);
+            scroll_counter = model->scroll_counter;
+            if(scroll_counter < 1) {
+                scroll_counter = 0;
             } else {
-                canvas_set_color(canvas, ColorBlack);
+                scroll_counter -= 1;
             }
+        } else {
+            canvas_set_color(canvas, ColorBlack);
+        }
 
-            uint8_t temp_x_default = 73;
-            uint8_t temp_w_default = 66;
-            if(item->current_value_index == 0 && furi_string_empty(item->current_value_text)) {
-                // Only left text, no right text
-                canvas_draw_str(canvas, 6, item_text_y, furi_string_get_cstr(item->label));
-            } else {
-                if(furi_string_size(item->current_value_text) < (size_t)4) {
-                    temp_x_default = 80;
-                    temp_w_default = 71;
-                }
-                elements_scrollable_text_line_centered(
-                    canvas,
-                    6,
-                    item_text_y,
-                    temp_w_default,
-                    item->label,
-                    scroll_counter,
-                    false,
-                    false);
+        uint8_t temp_x_default = 73;
+        uint8_t temp_w_default = 66;
+        if(item->current_value_index == 0 && furi_string_empty(item->current_value_text)) {
+            // Only left text, no right text
+            canvas_draw_str(canvas, 6, item_text_y, furi_string_get_cstr(item->label));
+        } else {
+            if(furi_string_size(item->current_value_text) < (size_t)4) {
+                temp_x_default = 80;
+                temp_w_default = 71;
             }
+            elements_scrollable_text_line_centered(
+                canvas,
+                6,
+                item_text_y,
+                temp_w_default,
+                item->label,
+                scroll_counter,
+                false,
+                false);
+        }
 
-            if(item->locked) {
-                canvas_draw_icon(canvas, 110, item_text_y - 8, &I_Lock_7x8);
-            } else {
-                if(item->current_value_index > 0) {
-                    canvas_draw_str(canvas, temp_x_default, item_text_y, "<");
-                }
+        if(item->locked) {
+            canvas_draw_icon(canvas, 110, item_text_y - 8, &I_Lock_7x8);
+        } else {
+            if(item->current_value_index > 0) {
+                canvas_draw_str(canvas, temp_x_default, item_text_y, "<");
+            }
 
-                elements_scrollable_text_line_centered(
-                    canvas,
-                    (115 + temp_x_default) / 2 + 1,
-                    item_text_y,
-                    37,
-                    item->current_value_text,
-                    scroll_counter,
-                    false,
-                    true);
-
-                if(item->current_value_index < (item->values_count - 1)) {
-                    canvas_draw_str(canvas, 115, item_text_y, ">");
-                }
+            elements_scrollable_text_line_centered(
+                canvas,
+                (115 + temp_x_default) / 2 + 1,
+                item_text_y,
+                37,
+                item->current_value_text,
+                scroll_counter,
+                false,
+                true);
+
+            if(item->current_value_index < (item->values_count - 1)) {
+                canvas_draw_str(canvas, 115, item_text_y, ">");
             }
         }
-
-        position++;
     }
 
-    elements_scrollbar(canvas, model->position, VariableItemArray_size(model->items));
+    elements_scrollbar(canvas, model->position, items_size);
 
     if(model->locked_message_visible) {
         canvas_set_color(canvas, ColorWhite);
@@ -336,22 +333,8 @@ void variable_item_list_process_down(VariableItemList* variable_item_list) {
 }
 
 VariableItem* variable_item_list_get_selected_item(VariableItemListModel* model) {
-    VariableItem* item = NULL;
-
-    VariableItemArray_it_t it;
-    uint8_t position = 0;
-    for(VariableItemArray_it(it, model->items); !VariableItemArray_end_p(it);
-        VariableItemArray_next(it)) {
-        if(position == model->position) {
-            break;
-        }
-        position++;
-    }
-
-    item = VariableItemArray_ref(it);
-
-    furi_assert(item);
-    return item;
+    furi_assert(model->position < VariableItemArray_size(model->items));
+    return VariableItemArray_get(model->items, model->position);
 }
 
 void variable_item_list_process_left(VariableItemList* variable_item_list) {
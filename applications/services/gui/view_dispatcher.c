@@ -39,7 +39,8 @@ void view_dispatcher_free(ViewDispatcher* view_dispatcher) {
 void view_dispatcher_enable_queue(ViewDispatcher* view_dispatcher) {
     furi_assert(view_dispatcher);
     furi_assert(view_dispatcher->queue == NULL);
-    view_dispatcher->queue = furi_message_queue_alloc(16, sizeof(ViewDispatcherMessage));
+    // Input and events sent from dispatcher thread go first, see view_dispatcher_send_custom_event
+    view_dispatcher->queue = furi_message_queue_alloc_ex(16, 8, sizeof(ViewDispatcherMessage));
 }
 
 void view_dispatcher_set_event_callback_context(ViewDispatcher* view_dispatcher, void* context) {
@@ -79,6 +80,7 @@ void view_dispatcher_run(ViewDispatcher* view_dispatcher) {
 
     uint32_t tick_period = view_dispatcher->tick_period == 0 ? FuriWaitForever :
                                                                view_dispatcher->tick_period;
+    view_dispatcher->thread_id = furi_thread_get_current_id();
     ViewDispatcherMessage message;
     while(1) {
         if(furi_message_queue_get(view_dispatcher->queue, &message, tick_period) != FuriStatusOk) {
@@ -91,13 +93,23 @@ void view_dispatcher_run(ViewDispatcher* view_dispatcher) {
             view_dispatcher_handle_input(view_dispatcher, &message.input);
         } else if(message.type == ViewDispatcherMessageTypeCustomEvent) {
             view_dispatcher_handle_custom_event(view_dispatcher, message.custom_event);
+        } else if(message.type == ViewDispatcherMessageTypeCoalescedEvent) {
+            view_dispatcher_handle_coalesced_event(view_dispatcher, message.coalesced_slot);
         }
     }
 
+    FURI_LOG_D(
+        TAG,
+        "Queue depth max: %lu, coalesced events: %lu",
+        view_dispatcher->queue_depth_max,
+        view_dispatcher->coalesced_count);
+
     // Wait till all input events delivered
     while(view_dispatcher->ongoing_input) {
         furi_message_queue_get(view_dispatcher->queue, &message, FuriWaitForever);
-        if(message.type == ViewDispatcherMessageTypeInput) {
+        if(message.type == ViewDispatcherMessageTypeCoalescedEvent) {
+            view_dispatcher->coalesced[message.coalesced_slot].used = false;
+        } else if(message.type == ViewDispatcherMessageTypeInput) {
             uint8_t key_bit = (1 << message.input.key);
             if(message.input.type == InputTypePress) {
                 view_dispatcher->ongoing_input |= key_bit;
@@ -106,6 +118,7 @@ void view_dispatcher_run(ViewDispatcher* view_dispatcher) {
             }
         }
     }
+    view_dispatcher->thread_id = NULL;
 }
 
 void view_dispatcher_stop(ViewDispatcher* view_dispatcher) {
@@ -226,7 +239,7 @@ void view_dispatcher_input_callback(InputEvent* event, void* context) {
         message.type = ViewDispatcherMessageTypeInput;
         message.input = *event;
         furi_check(
-            furi_message_queue_put(view_dispatcher->queue, &message, FuriWaitForever) ==
+            furi_message_queue_put_urgent(view_dispatcher->queue, &message, FuriWaitForever) ==
             FuriStatusOk);
     } else {
         view_dispatcher_handle_input(view_dispatcher, event);
@@ -259,6 +272,9 @@ void view_dispatcher_handle_input(ViewDispatcher* view_dispatcher, InputEvent* e
     if(view_dispatcher->current_view &&
        view_dispatcher->ongoing_input_view == view_dispatcher->current_view) {
         // Dispatch input to current view
+        if(view_dispatcher->gui) {
+            gui_input_latency_record(view_dispatcher->gui, event, GuiProfilerSlotViewInput);
+        }
         bool is_consumed = view_input(view_dispatcher->current_view, event);
 
         // Navigate if input is not consumed
@@ -307,6 +323,23 @@ void view_dispatcher_handle_custom_event(ViewDispatcher* view_dispatcher, uint32
     }
 }
 
+void view_dispatcher_handle_coalesced_event(ViewDispatcher* view_dispatcher, uint32_t slot) {
+    furi_assert(slot < VIEW_DISPATCHER_COALESCED_SLOTS);
+
+    // Senders may still replace event until slot is released
+    FURI_CRITICAL_ENTER();
+    uint32_t event = view_dispatcher->coalesced[slot].event;
+    view_dispatcher->coalesced[slot].used = false;
+    FURI_CRITICAL_EXIT();
+
+    view_dispatcher_handle_custom_event(view_dispatcher, event);
+}
+
+static void view_dispatcher_update_queue_depth(ViewDispatcher* view_dispatcher) {
+    uint32_t depth = furi_message_queue_get_count(view_dispatcher->queue);
+    if(depth > view_dispatcher->queue_depth_max) view_dispatcher->queue_depth_max = depth;
+}
+
 void view_dispatcher_send_custom_event(ViewDispatcher* view_dispatcher, uint32_t event) {
     furi_assert(view_dispatcher);
     furi_assert(view_dispatcher->queue);
@@ -315,8 +348,75 @@ void view_dispatcher_send_custom_event(ViewDispatcher* view_dispatcher, uint32_t
     message.type = ViewDispatcherMessageTypeCustomEvent;
     message.custom_event = event;
 
+    // Events sent by handlers share the lane with input to keep their order,
+    // events from other threads can't delay input
+    FuriStatus status;
+    if(view_dispatcher->thread_id == furi_thread_get_current_id()) {
+        status = furi_message_queue_put_urgent(view_dispatcher->queue, &message, FuriWaitForever);
+    } else {
+        status = furi_message_queue_put(view_dispatcher->queue, &message, FuriWaitForever);
+    }
+    furi_check(status == FuriStatusOk);
+    view_dispatcher_update_queue_depth(view_dispatcher);
+}
+
+void view_dispatcher_send_custom_event_coalesced(
+    ViewDispatcher* view_dispatcher,
+    uint32_t event,
+    uint32_t type_mask) {
+    furi_assert(view_dispatcher);
+    furi_assert(view_dispatcher->queue);
+
+    // Events from dispatcher thread are urgent and never pile up, keep their order
+    if(view_dispatcher->thread_id == furi_thread_get_current_id()) {
+        view_dispatcher_send_custom_event(view_dispatcher, event);
+        return;
+    }
+
+    size_t free_slot = VIEW_DISPATCHER_COALESCED_SLOTS;
+    bool merged = false;
+
+    FURI_CRITICAL_ENTER();
+    for(size_t i = 0; i < VIEW_DISPATCHER_COALESCED_SLOTS; i++) {
+        ViewDispatcherCoalescedSlot* slot = &view_dispatcher->coalesced[i];
+        if(!slot->used) {
+            if(free_slot == VIEW_DISPATCHER_COALESCED_SLOTS) free_slot = i;
+        } else if(
+            slot->type_mask == type_mask && (slot->event & type_mask) == (event & type_mask)) {
+            slot->event = event;
+            view_dispatcher->coalesced_count++;
+            merged = true;
+            break;
+        }
+    }
+    if(!merged && free_slot < VIEW_DISPATCHER_COALESCED_SLOTS) {
+        view_dispatcher->coalesced[free_slot].used = true;
+        view_dispatcher->coalesced[free_slot].type_mask = type_mask;
+        view_dispatcher->coalesced[free_slot].event = event;
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(merged) return;
+
+    if(free_slot == VIEW_DISPATCHER_COALESCED_SLOTS) {
+        // All slots are taken by other event types, deliver as is
+        view_dispatcher_send_custom_event(view_dispatcher, event);
+        return;
+    }
+
+    ViewDispatcherMessage message;
+    message.type = ViewDispatcherMessageTypeCoalescedEvent;
+    message.coalesced_slot = free_slot;
     furi_check(
-        furi_message_queue_put(view_dispatcher->queue, &message, FuriWaitForever) == FuriStatusOk);
+        furi_message_queue_put(view_dispatcher->queue, &message, FuriWaitForever) ==
+        FuriStatusOk);
+    view_dispatcher_update_queue_depth(view_dispatcher);
+}
+
+uint32_t view_dispatcher_get_queue_depth(ViewDispatcher* view_dispatcher) {
+    furi_assert(view_dispatcher);
+    furi_assert(view_dispatcher->queue);
+    return furi_message_queue_get_count(view_dispatcher->queue);
 }
 
 static const ViewPortOrientation view_dispatcher_view_port_orientation_table[] = {
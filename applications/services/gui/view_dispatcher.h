@@ -59,6 +59,31 @@ void view_dispatcher_enable_queue(ViewDispatcher* view_dispatcher);
  */
 void view_dispatcher_send_custom_event(ViewDispatcher* view_dispatcher, uint32_t event);
 
+/** Send custom event, merging it with the same type event still waiting in queue
+ *
+ * Intended for progress and status updates posted by workers at high rate.
+ * Events are of the same type when their bits under type_mask are equal, the
+ * event sent last replaces the queued one, so only the latest value is
+ * delivered and stale ones don't fill the queue. Use UINT32_MAX as mask to
+ * merge identical events only.
+ *
+ * @param      view_dispatcher  ViewDispatcher instance
+ * @param[in]  event            The event
+ * @param[in]  type_mask        event bits that identify event type
+ */
+void view_dispatcher_send_custom_event_coalesced(
+    ViewDispatcher* view_dispatcher,
+    uint32_t event,
+    uint32_t type_mask);
+
+/** Get count of events waiting in queue
+ *
+ * @param      view_dispatcher  ViewDispatcher instance
+ *
+ * @return     messages in queue
+ */
+uint32_t view_dispatcher_get_queue_depth(ViewDispatcher* view_dispatcher);
+
 /** Set custom event handler
  *
  * Called on Custom Event, if it is not consumed by view
@@ -14,8 +14,18 @@
 
 DICT_DEF2(ViewDict, uint32_t, M_DEFAULT_OPLIST, View*, M_PTR_OPLIST)
 
+#define VIEW_DISPATCHER_COALESCED_SLOTS 4
+
+/** Coalesced event waiting in queue, in use while its message is queued */
+typedef struct {
+    bool used;
+    uint32_t type_mask;
+    uint32_t event;
+} ViewDispatcherCoalescedSlot;
+
 struct ViewDispatcher {
     FuriMessageQueue* queue;
+    FuriThreadId thread_id;
     Gui* gui;
     ViewPort* view_port;
     ViewDict_t views;
@@ -30,11 +40,16 @@ struct ViewDispatcher {
     ViewDispatcherTickEventCallback tick_event_callback;
     uint32_t tick_period;
     void* event_context;
+
+    ViewDispatcherCoalescedSlot coalesced[VIEW_DISPATCHER_COALESCED_SLOTS];
+    uint32_t coalesced_count;
+    uint32_t queue_depth_max;
 };
 
 typedef enum {
     ViewDispatcherMessageTypeInput,
     ViewDispatcherMessageTypeCustomEvent,
+    ViewDispatcherMessageTypeCoalescedEvent,
     ViewDispatcherMessageTypeStop,
 } ViewDispatcherMessageType;
 
@@ -43,6 +58,7 @@ typedef struct {
     union {
         InputEvent input;
         uint32_t custom_event;
+        uint32_t coalesced_slot;
     };
 } ViewDispatcherMessage;
 
@@ -61,6 +77,9 @@ void view_dispatcher_handle_tick_event(ViewDispatcher* view_dispatcher);
 /** Custom event handler */
 void view_dispatcher_handle_custom_event(ViewDispatcher* view_dispatcher, uint32_t event);
 
+/** Coalesced event handler, releases slot */
+void view_dispatcher_handle_coalesced_event(ViewDispatcher* view_dispatcher, uint32_t slot);
+
 /** Set current view, dispatches view enter and exit */
 void view_dispatcher_set_current_view(ViewDispatcher* view_dispatcher, View* view);
 
@@ -194,6 +194,13 @@ void view_port_gui_set(ViewPort* view_port, Gui* gui) {
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
+void view_port_set_max_fps(ViewPort* view_port, uint8_t fps) {
+    furi_assert(view_port);
+    furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
+    view_port->frame_interval = fps ? 1000 / fps : 0;
+    furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
+}
+
 void view_port_draw(ViewPort* view_port, Canvas* canvas) {
     furi_assert(view_port);
     furi_assert(canvas);
@@ -211,6 +218,11 @@ void view_port_draw(ViewPort* view_port, Canvas* canvas) {
         view_port->draw_callback(canvas, view_port->draw_callback_context);
     }
 
+    // Slowest ViewPort on screen sets the pace of the next frame
+    if(view_port->frame_interval > view_port->gui->frame_interval) {
+        view_port->gui->frame_interval = view_port->frame_interval;
+    }
+
     furi_mutex_release(view_port->mutex);
 }
 
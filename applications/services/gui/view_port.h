@@ -105,6 +105,16 @@ void view_port_update(ViewPort* view_port);
 void view_port_set_orientation(ViewPort* view_port, ViewPortOrientation orientation);
 ViewPortOrientation view_port_get_orientation(const ViewPort* view_port);
 
+/** Limit redraw rate while ViewPort is drawn
+ *
+ * Updates that come faster are merged into one frame. GUI caps rate at
+ * GUI_FRAME_RATE_MAX for all ViewPorts anyway, this sets a lower cap.
+ *
+ * @param      view_port  ViewPort instance
+ * @param      fps        maximum frames per second, 0 - GUI default
+ */
+void view_port_set_max_fps(ViewPort* view_port, uint8_t fps);
+
 #ifdef __cplusplus
 }
 #endif
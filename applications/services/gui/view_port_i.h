@@ -13,6 +13,7 @@ struct ViewPort {
     FuriMutex* mutex;
     bool is_enabled;
     ViewPortOrientation orientation;
+    uint32_t frame_interval;
 
     uint8_t width;
     uint8_t height;
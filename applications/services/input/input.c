@@ -1,4 +1,5 @@
 #include "input_i.h"
+#include <furi_hal_cortex.h>
 
 // #define INPUT_DEBUG
 
@@ -6,6 +7,11 @@
 
 static Input* input = NULL;
 
+static void input_event_publish(Input* input, InputEvent* event) {
+    // Event type is the topic, so that subscribers can skip ones they don't need
+    furi_pubsub_publish_topic(input->event_pubsub, FURI_PUBSUB_TOPIC(event->type), event);
+}
+
 void input_press_timer_callback(void* arg) {
     InputPinState* input_pin = arg;
     InputEvent event;
@@ -15,16 +21,52 @@ void input_press_timer_callback(void* arg) {
     input_pin->press_counter++;
     if(input_pin->press_counter == INPUT_LONG_PRESS_COUNTS) {
         event.type = InputTypeLong;
-        furi_pubsub_publish(input->event_pubsub, &event);
+        input_event_publish(input, &event);
     } else if(input_pin->press_counter > INPUT_LONG_PRESS_COUNTS) {
         input_pin->press_counter--;
         event.type = InputTypeRepeat;
-        furi_pubsub_publish(input->event_pubsub, &event);
+        input_event_publish(input, &event);
+    }
+}
+
+static void input_event_time_store(Input* input, const InputEvent* event, uint32_t time) {
+    FURI_CRITICAL_ENTER();
+    InputEventTime* item = &input->event_times[input->event_times_head];
+    item->sequence = event->sequence;
+    item->key = event->key;
+    item->type = event->type;
+    item->time = time;
+    input->event_times_head = (input->event_times_head + 1) % INPUT_EVENT_TIMES_COUNT;
+    FURI_CRITICAL_EXIT();
+}
+
+bool input_get_event_time(const InputEvent* event, uint32_t* time) {
+    furi_assert(event);
+    furi_assert(time);
+    if(!input || event->sequence_source != INPUT_SEQUENCE_SOURCE_HARDWARE) return false;
+
+    bool found = false;
+    FURI_CRITICAL_ENTER();
+    for(size_t i = 0; i < INPUT_EVENT_TIMES_COUNT; i++) {
+        const InputEventTime* item = &input->event_times[i];
+        if(item->sequence == event->sequence && item->key == event->key &&
+           item->type == event->type) {
+            *time = item->time;
+            found = true;
+            break;
+        }
     }
+    FURI_CRITICAL_EXIT();
+
+    return found;
 }
 
 void input_isr(void* _ctx) {
     UNUSED(_ctx);
+    if(!input->isr_pending) {
+        input->isr_time = DWT->CYCCNT;
+        input->isr_pending = true;
+    }
     furi_thread_flags_set(input->thread_id, INPUT_THREAD_FLAG_ISR);
 }
 
@@ -61,13 +103,13 @@ void input_fake_event(Input* input, InputKey key, InputType type) {
 
     if(wrap) {
         event.type = InputTypePress;
-        furi_pubsub_publish(input->event_pubsub, &event);
+        input_event_publish(input, &event);
     }
     event.type = type;
-    furi_pubsub_publish(input->event_pubsub, &event);
+    input_event_publish(input, &event);
     if(wrap) {
         event.type = InputTypeRelease;
-        furi_pubsub_publish(input->event_pubsub, &event);
+        input_event_publish(input, &event);
     }
 }
 
@@ -120,6 +162,7 @@ int32_t input_srv(void* p) {
                 InputEvent event;
                 event.sequence_source = INPUT_SEQUENCE_SOURCE_HARDWARE;
                 event.key = input->pin_states[i].pin->key;
+                uint32_t edge_time = input->isr_pending ? input->isr_time : DWT->CYCCNT;
 
                 // Short / Long / Repeat timer routine
                 if(state) {
@@ -134,14 +177,16 @@ int32_t input_srv(void* p) {
                         furi_delay_tick(1);
                     if(input->pin_states[i].press_counter < INPUT_LONG_PRESS_COUNTS) {
                         event.type = InputTypeShort;
-                        furi_pubsub_publish(input->event_pubsub, &event);
+                        input_event_time_store(input, &event, edge_time);
+                        input_event_publish(input, &event);
                     }
                     input->pin_states[i].press_counter = 0;
                 }
 
                 // Send Press/Release event
                 event.type = input->pin_states[i].state ? InputTypePress : InputTypeRelease;
-                furi_pubsub_publish(input->event_pubsub, &event);
+                input_event_time_store(input, &event, edge_time);
+                input_event_publish(input, &event);
             }
         }
 
@@ -154,6 +199,7 @@ int32_t input_srv(void* p) {
 #if INPUT_DEBUG
             furi_hal_gpio_write(&gpio_ext_pa4, 0);
 #endif
+            input->isr_pending = false;
             furi_thread_flags_wait(INPUT_THREAD_FLAG_ISR, FuriFlagWaitAny, FuriWaitForever);
         }
     }
@@ -52,6 +52,18 @@ const char* input_get_key_name(InputKey key);
  */
 const char* input_get_type_name(InputType type);
 
+/** Get time when hardware event's edge was caught by interrupt
+ *
+ * Only recent Press, Release and Short events are kept, so it must be called
+ * soon after the event is received. Used to measure input latency.
+ *
+ * @param      event  received event
+ * @param      time   DWT cycle counter value at the edge
+ *
+ * @return     true if event is known
+ */
+bool input_get_event_time(const InputEvent* event, uint32_t* time);
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,7 @@
 #define INPUT_PRESS_TICKS 150
 #define INPUT_LONG_PRESS_COUNTS 2
 #define INPUT_THREAD_FLAG_ISR 0x00000001
+#define INPUT_EVENT_TIMES_COUNT 8
 
 /** Input pin state */
 typedef struct {
@@ -29,6 +30,14 @@ typedef struct {
     volatile uint32_t counter;
 } InputPinState;
 
+/** Edge time of published event */
+typedef struct {
+    uint32_t sequence;
+    InputKey key;
+    InputType type;
+    uint32_t time;
+} InputEventTime;
+
 /** Input state */
 typedef struct {
     FuriThreadId thread_id;
@@ -36,6 +45,11 @@ typedef struct {
     InputPinState* pin_states;
     Cli* cli;
     volatile uint32_t counter;
+    // First edge since thread went idle, debounce takes a few ticks after it
+    volatile bool isr_pending;
+    volatile uint32_t isr_time;
+    InputEventTime event_times[INPUT_EVENT_TIMES_COUNT];
+    size_t event_times_head;
 } Input;
 
 /** Input press timer callback */
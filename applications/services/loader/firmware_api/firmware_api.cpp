@@ -23,14 +23,22 @@ constexpr HashtableApiInterface mock_elf_api_interface{
 
 const ElfApiInterface* const firmware_api_interface = &mock_elf_api_interface;
 #else
-constexpr HashtableApiInterface elf_api_interface{
+#define ELF_API_INDEX_BITS 10
+
+constexpr auto elf_api_index = create_hashtable_index<ELF_API_INDEX_BITS>(elf_api_table);
+
+constexpr IndexedHashtableApiInterface elf_api_interface{
     {
-        .api_version_major = (elf_api_version >> 16),
-        .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
+        {
+            .api_version_major = (elf_api_version >> 16),
+            .api_version_minor = (elf_api_version & 0xFFFF),
+            .resolver_callback = &elf_resolve_from_indexed_hashtable,
+        },
+        .table_cbegin = elf_api_index.table.cbegin(),
+        .table_cend = elf_api_index.table.cend(),
     },
-    .table_cbegin = elf_api_table.cbegin(),
-    .table_cend = elf_api_table.cend(),
+    .index = elf_api_index.index.data(),
+    .index_bits = ELF_API_INDEX_BITS,
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 #endif
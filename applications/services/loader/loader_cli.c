@@ -3,6 +3,8 @@
 #include <applications.h>
 #include <lib/toolbox/args.h>
 #include <notification/notification_messages.h>
+#include <flipper_application/flipper_application.h>
+#include <flipper_application/elf/elf_file.h>
 #include "loader.h"
 
 static void loader_cli_print_usage() {
@@ -11,7 +13,8 @@ static void loader_cli_print_usage() {
     printf("Cmd list:\r\n");
     printf("\tlist\t - List available applications\r\n");
     printf("\topen <Application Name:string>\t - Open application by name\r\n");
-    printf("\tinfo\t - Show loader state\r\n");
+    printf("\tinfo\t - Show loader state and startup profile of last application\r\n");
+    printf("\tstats\t - Show relocation stats of last loaded application\r\n");
 }
 
 static void loader_cli_list() {
@@ -28,6 +31,10 @@ static void loader_cli_list() {
     }
 }
 
+static uint32_t loader_cli_ticks_to_ms(uint32_t ticks) {
+    return ticks * 1000 / furi_kernel_get_tick_frequency();
+}
+
 static void loader_cli_info(Loader* loader) {
     if(!loader_is_locked(loader)) {
         printf("No application is running\r\n");
@@ -35,6 +42,43 @@ static void loader_cli_info(Loader* loader) {
         // TODO FL-3513: print application name ???
         printf("Application is running\r\n");
     }
+
+    FlipperApplicationLoadStats stats;
+    flipper_application_get_last_load_stats(&stats);
+    if(stats.name[0] == '\0') return;
+
+    printf("Last external application: %s\r\n", stats.name);
+    uint32_t total_duration = 0;
+    int32_t total_heap = 0;
+    for(size_t i = 0; i < FlipperApplicationLoadPhaseCount; i++) {
+        printf(
+            "\t%-18s %6lu ms %7ld bytes\r\n",
+            flipper_application_load_phase_to_string(i),
+            loader_cli_ticks_to_ms(stats.phases[i].duration),
+            stats.phases[i].heap);
+        total_duration += stats.phases[i].duration;
+        total_heap += stats.phases[i].heap;
+    }
+    printf(
+        "\t%-18s %6lu ms %7ld bytes\r\n",
+        "Total",
+        loader_cli_ticks_to_ms(total_duration),
+        total_heap);
+    if(loader_is_locked(loader) && stats.free_heap_at_entry) {
+        printf(
+            "Allocated by application since start: %ld bytes\r\n",
+            (int32_t)(stats.free_heap_at_entry - memmgr_get_free_heap()));
+    }
+}
+
+static void loader_cli_stats() {
+    ELFRelocationStats stats;
+    elf_file_get_relocation_stats(&stats);
+    printf("Relocations: %lu\r\n", stats.relocations);
+    printf("Symbol lookups: %lu\r\n", stats.symbol_lookups);
+    printf("Address cache hits: %lu\r\n", stats.cache_hits);
+    printf("Address cache size: %lu bytes\r\n", stats.cache_size);
+    printf("Trampolines: %lu\r\n", stats.trampolines);
 }
 
 static void loader_cli_open(FuriString* args, Loader* loader) {
@@ -97,6 +141,11 @@ static void loader_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "stats") == 0) {
+            loader_cli_stats();
+            break;
+        }
+
         loader_cli_print_usage();
     } while(false);
 
@@ -135,13 +135,6 @@ static void notification_reset_notification_layer(
     }
 }
 
-static void notification_apply_notification_leds(NotificationApp* app, const uint8_t* values) {
-    for(uint8_t i = 0; i < NOTIFICATION_LED_COUNT; i++) {
-        notification_apply_notification_led_layer(
-            &app->led[i], notification_settings_get_rgb_led_brightness(app, values[i]));
-    }
-}
-
 // settings
 uint8_t notification_settings_get_display_brightness(NotificationApp* app, uint8_t value) {
     return (value * app->settings.display_brightness);
@@ -190,198 +183,339 @@ static void notification_display_timer(void* ctx) {
     notification_message(app, &sequence_display_backlight_off);
 }
 
-// message processing
-static void notification_process_notification_message(
+// channels
+static bool
+    notification_player_claim(NotificationApp* app, NotificationPlayer* player, uint8_t mask) {
+    bool claimed = true;
+    for(size_t i = 0; i < NOTIFICATION_CHANNEL_COUNT; i++) {
+        if(!(mask & (1 << i))) continue;
+        NotificationPlayer* owner = app->channel_owners[i];
+        // Older sequence can't take channel back from newer one
+        if(owner && owner->serial > player->serial) {
+            claimed = false;
+        } else {
+            app->channel_owners[i] = player;
+        }
+    }
+    return claimed;
+}
+
+static void notification_player_apply_leds(
     NotificationApp* app,
-    NotificationAppMessage* message) {
-    uint32_t notification_message_index = 0;
-    bool force_volume = false;
-    bool force_vibro = false;
-    const NotificationMessage* notification_message;
-    notification_message = (*message->sequence)[notification_message_index];
+    NotificationPlayer* player,
+    const uint8_t* values) {
+    for(uint8_t i = 0; i < NOTIFICATION_LED_COUNT; i++) {
+        if(notification_player_claim(app, player, 1 << i)) {
+            notification_apply_notification_led_layer(
+                &app->led[i], notification_settings_get_rgb_led_brightness(app, values[i]));
+        }
+    }
+}
 
-    bool led_active = false;
-    uint8_t led_values[NOTIFICATION_LED_COUNT] = {0x00, 0x00, 0x00};
-    bool reset_notifications = true;
-    float speaker_volume_setting = app->settings.speaker_volume;
-    bool vibro_setting = app->settings.vibro_on;
-    float display_brightness_setting = app->settings.display_brightness;
+static void notification_player_wait(NotificationPlayer* player, uint32_t ms) {
+    player->wake_at = furi_get_tick() + furi_ms_to_ticks(ms);
+}
 
-    uint8_t reset_mask = 0;
+// message processing
+static void notification_player_start(NotificationApp* app, NotificationAppMessage* message) {
+    NotificationPlayer* player = NULL;
+    for(size_t i = 0; i < NOTIFICATION_PLAYER_COUNT; i++) {
+        if(app->players[i].state == NotificationPlayerStateIdle) {
+            player = &app->players[i];
+            break;
+        }
+    }
+    furi_check(player);
+
+    memset(player, 0, sizeof(NotificationPlayer));
+    player->message = *message;
+    player->state = NotificationPlayerStateRun;
+    player->serial = ++app->player_serial;
+    player->wake_at = furi_get_tick();
+    player->reset_notifications = true;
+    player->speaker_volume_setting = app->settings.speaker_volume;
+    player->vibro_setting = app->settings.vibro_on;
+    player->display_brightness_setting = app->settings.display_brightness;
+}
 
-    while(notification_message != NULL) {
-        switch(notification_message->type) {
-        case NotificationMessageTypeLedDisplayBacklight:
-            // if on - switch on and start timer
-            // if off - switch off and stop timer
-            // on timer - switch off
-            if(notification_message->data.led.value > 0x00) {
-                notification_apply_notification_led_layer(
-                    &app->display,
-                    notification_message->data.led.value * display_brightness_setting);
-                reset_mask |= reset_display_mask;
-            } else {
-                reset_mask &= ~reset_display_mask;
-                notification_reset_notification_led_layer(&app->display);
-                if(furi_timer_is_running(app->display_timer)) {
-                    furi_timer_stop(app->display_timer);
-                }
+static void notification_player_finish(NotificationApp* app, NotificationPlayer* player) {
+    uint8_t reset_mask = player->reset_mask & reset_display_mask;
+    for(size_t i = 0; i < NOTIFICATION_CHANNEL_COUNT; i++) {
+        if(app->channel_owners[i] == player) {
+            app->channel_owners[i] = NULL;
+            reset_mask |= player->reset_mask & (1 << i);
+        }
+    }
+
+    if(player->reset_notifications) {
+        notification_reset_notification_layer(
+            app, reset_mask, player->display_brightness_setting);
+    }
+
+    if(player->message.back_event != NULL) {
+        furi_event_flag_set(player->message.back_event, NOTIFICATION_EVENT_COMPLETE);
+    }
+    player->state = NotificationPlayerStateIdle;
+}
+
+// returns false when player has to wait
+static bool notification_player_process_message(
+    NotificationApp* app,
+    NotificationPlayer* player,
+    const NotificationMessage* notification_message) {
+    switch(notification_message->type) {
+    case NotificationMessageTypeLedDisplayBacklight:
+        // if on - switch on and start timer
+        // if off - switch off and stop timer
+        // on timer - switch off
+        if(notification_message->data.led.value > 0x00) {
+            notification_apply_notification_led_layer(
+                &app->display,
+                notification_message->data.led.value * player->display_brightness_setting);
+            player->reset_mask |= reset_display_mask;
+        } else {
+            player->reset_mask &= ~reset_display_mask;
+            notification_reset_notification_led_layer(&app->display);
+            if(furi_timer_is_running(app->display_timer)) {
+                furi_timer_stop(app->display_timer);
             }
-            break;
-        case NotificationMessageTypeLedDisplayBacklightEnforceOn:
-            furi_check(app->display_led_lock < UINT8_MAX);
-            app->display_led_lock++;
-            if(app->display_led_lock == 1) {
+        }
+        break;
+    case NotificationMessageTypeLedDisplayBacklightEnforceOn:
+        furi_check(app->display_led_lock < UINT8_MAX);
+        app->display_led_lock++;
+        if(app->display_led_lock == 1) {
+            notification_apply_internal_led_layer(
+                &app->display,
+                notification_message->data.led.value * player->display_brightness_setting);
+        }
+        break;
+    case NotificationMessageTypeLedDisplayBacklightEnforceAuto:
+        if(app->display_led_lock > 0) {
+            app->display_led_lock--;
+            if(app->display_led_lock == 0) {
                 notification_apply_internal_led_layer(
                     &app->display,
-                    notification_message->data.led.value * display_brightness_setting);
+                    notification_message->data.led.value * player->display_brightness_setting);
             }
-            break;
-        case NotificationMessageTypeLedDisplayBacklightEnforceAuto:
-            if(app->display_led_lock > 0) {
-                app->display_led_lock--;
-                if(app->display_led_lock == 0) {
-                    notification_apply_internal_led_layer(
-                        &app->display,
-                        notification_message->data.led.value * display_brightness_setting);
-                }
-            } else {
-                FURI_LOG_E(TAG, "Incorrect BacklightEnforce use");
-            }
-            break;
-        case NotificationMessageTypeLedRed:
-            // store and send on delay or after seq
-            led_active = true;
-            led_values[0] = notification_message->data.led.value;
-            app->led[0].value_last[LayerNotification] = led_values[0];
-            reset_mask |= reset_red_mask;
-            break;
-        case NotificationMessageTypeLedGreen:
-            // store and send on delay or after seq
-            led_active = true;
-            led_values[1] = notification_message->data.led.value;
-            app->led[1].value_last[LayerNotification] = led_values[1];
-            reset_mask |= reset_green_mask;
-            break;
-        case NotificationMessageTypeLedBlue:
-            // store and send on delay or after seq
-            led_active = true;
-            led_values[2] = notification_message->data.led.value;
-            app->led[2].value_last[LayerNotification] = led_values[2];
-            reset_mask |= reset_blue_mask;
-            break;
-        case NotificationMessageTypeLedBlinkStart:
-            // store and send on delay or after seq
-            led_active = true;
+        } else {
+            FURI_LOG_E(TAG, "Incorrect BacklightEnforce use");
+        }
+        break;
+    case NotificationMessageTypeLedRed:
+        // store and send on delay or after seq
+        player->led_active = true;
+        player->led_values[0] = notification_message->data.led.value;
+        app->led[0].value_last[LayerNotification] = player->led_values[0];
+        player->reset_mask |= reset_red_mask;
+        break;
+    case NotificationMessageTypeLedGreen:
+        // store and send on delay or after seq
+        player->led_active = true;
+        player->led_values[1] = notification_message->data.led.value;
+        app->led[1].value_last[LayerNotification] = player->led_values[1];
+        player->reset_mask |= reset_green_mask;
+        break;
+    case NotificationMessageTypeLedBlue:
+        // store and send on delay or after seq
+        player->led_active = true;
+        player->led_values[2] = notification_message->data.led.value;
+        app->led[2].value_last[LayerNotification] = player->led_values[2];
+        player->reset_mask |= reset_blue_mask;
+        break;
+    case NotificationMessageTypeLedBlinkStart:
+        // store and send on delay or after seq
+        player->led_active = true;
+        if(notification_player_claim(app, player, reset_blink_mask)) {
             furi_hal_light_blink_start(
                 notification_message->data.led_blink.color,
                 app->settings.led_brightness * 255,
                 notification_message->data.led_blink.on_time,
                 notification_message->data.led_blink.period);
-            reset_mask |= reset_blink_mask;
-            reset_mask |= reset_red_mask;
-            reset_mask |= reset_green_mask;
-            reset_mask |= reset_blue_mask;
-            break;
-        case NotificationMessageTypeLedBlinkColor:
-            led_active = true;
+        }
+        player->reset_mask |= reset_blink_mask;
+        player->reset_mask |= reset_red_mask;
+        player->reset_mask |= reset_green_mask;
+        player->reset_mask |= reset_blue_mask;
+        break;
+    case NotificationMessageTypeLedBlinkColor:
+        player->led_active = true;
+        if(notification_player_claim(app, player, reset_blink_mask)) {
             furi_hal_light_blink_set_color(notification_message->data.led_blink.color);
-            break;
-        case NotificationMessageTypeLedBlinkStop:
+        }
+        break;
+    case NotificationMessageTypeLedBlinkStop:
+        if(notification_player_claim(app, player, reset_blink_mask)) {
             furi_hal_light_blink_stop();
-            reset_mask &= ~reset_blink_mask;
-            reset_mask |= reset_red_mask;
-            reset_mask |= reset_green_mask;
-            reset_mask |= reset_blue_mask;
-            break;
-        case NotificationMessageTypeVibro:
+        }
+        player->reset_mask &= ~reset_blink_mask;
+        player->reset_mask |= reset_red_mask;
+        player->reset_mask |= reset_green_mask;
+        player->reset_mask |= reset_blue_mask;
+        break;
+    case NotificationMessageTypeVibro:
+        if(notification_player_claim(app, player, reset_vibro_mask)) {
             if(notification_message->data.vibro.on) {
-                if(vibro_setting) notification_vibro_on(force_vibro);
+                if(player->vibro_setting) notification_vibro_on(player->force_vibro);
             } else {
                 notification_vibro_off();
             }
-            reset_mask |= reset_vibro_mask;
-            break;
-        case NotificationMessageTypeSoundOn:
+        }
+        player->reset_mask |= reset_vibro_mask;
+        break;
+    case NotificationMessageTypeSoundOn:
+        if(notification_player_claim(app, player, reset_sound_mask)) {
             notification_sound_on(
                 notification_message->data.sound.frequency,
-                notification_message->data.sound.volume * speaker_volume_setting,
-                force_volume);
-            reset_mask |= reset_sound_mask;
-            break;
-        case NotificationMessageTypeSoundOff:
+                notification_message->data.sound.volume * player->speaker_volume_setting,
+                player->force_volume);
+        }
+        player->reset_mask |= reset_sound_mask;
+        break;
+    case NotificationMessageTypeSoundOff:
+        if(notification_player_claim(app, player, reset_sound_mask)) {
             notification_sound_off();
-            reset_mask |= reset_sound_mask;
-            break;
-        case NotificationMessageTypeDelay:
-            if(led_active) {
-                if(notification_is_any_led_layer_internal_and_not_empty(app)) {
-                    notification_apply_notification_leds(app, led_off_values);
-                    furi_delay_ms(minimal_delay);
-                }
-
-                led_active = false;
-
-                notification_apply_notification_leds(app, led_values);
-                reset_mask |= reset_red_mask;
-                reset_mask |= reset_green_mask;
-                reset_mask |= reset_blue_mask;
+        }
+        player->reset_mask |= reset_sound_mask;
+        break;
+    case NotificationMessageTypeDelay:
+        if(player->led_active) {
+            player->led_active = false;
+            if(notification_is_any_led_layer_internal_and_not_empty(app)) {
+                notification_player_apply_leds(app, player, led_off_values);
+                player->state = NotificationPlayerStateLedBlank;
+                player->delay = notification_message->data.delay.length;
+                notification_player_wait(player, minimal_delay);
+                return false;
             }
 
-            furi_delay_ms(notification_message->data.delay.length);
-            break;
-        case NotificationMessageTypeDoNotReset:
-            reset_notifications = false;
-            break;
-        case NotificationMessageTypeForceSpeakerVolumeSetting:
-            speaker_volume_setting = notification_message->data.forced_settings.speaker_volume;
-            force_volume = true;
-            break;
-        case NotificationMessageTypeForceVibroSetting:
-            vibro_setting = notification_message->data.forced_settings.vibro;
-            force_vibro = true;
-            break;
-        case NotificationMessageTypeForceDisplayBrightnessSetting:
-            display_brightness_setting =
-                notification_message->data.forced_settings.display_brightness;
-            break;
-        case NotificationMessageTypeLedBrightnessSettingApply:
-            led_active = true;
-            for(uint8_t i = 0; i < NOTIFICATION_LED_COUNT; i++) {
-                led_values[i] = app->led[i].value_last[LayerNotification];
-            }
-            reset_mask |= reset_red_mask;
-            reset_mask |= reset_green_mask;
-            reset_mask |= reset_blue_mask;
-            break;
-        case NotificationMessageTypeLcdContrastUpdate:
-            notification_apply_lcd_contrast(app);
-            break;
+            notification_player_apply_leds(app, player, player->led_values);
+            player->reset_mask |= reset_red_mask;
+            player->reset_mask |= reset_green_mask;
+            player->reset_mask |= reset_blue_mask;
         }
-        notification_message_index++;
-        notification_message = (*message->sequence)[notification_message_index];
+
+        notification_player_wait(player, notification_message->data.delay.length);
+        return false;
+    case NotificationMessageTypeDoNotReset:
+        player->reset_notifications = false;
+        break;
+    case NotificationMessageTypeForceSpeakerVolumeSetting:
+        player->speaker_volume_setting =
+            notification_message->data.forced_settings.speaker_volume;
+        player->force_volume = true;
+        break;
+    case NotificationMessageTypeForceVibroSetting:
+        player->vibro_setting = notification_message->data.forced_settings.vibro;
+        player->force_vibro = true;
+        break;
+    case NotificationMessageTypeForceDisplayBrightnessSetting:
+        player->display_brightness_setting =
+            notification_message->data.forced_settings.display_brightness;
+        break;
+    case NotificationMessageTypeLedBrightnessSettingApply:
+        player->led_active = true;
+        for(uint8_t i = 0; i < NOTIFICATION_LED_COUNT; i++) {
+            player->led_values[i] = app->led[i].value_last[LayerNotification];
+        }
+        player->reset_mask |= reset_red_mask;
+        player->reset_mask |= reset_green_mask;
+        player->reset_mask |= reset_blue_mask;
+        break;
+    case NotificationMessageTypeLcdContrastUpdate:
+        notification_apply_lcd_contrast(app);
+        break;
+    }
+
+    return true;
+}
+
+static void notification_player_run(NotificationApp* app, NotificationPlayer* player) {
+    switch(player->state) {
+    case NotificationPlayerStateLedBlank:
+        notification_player_apply_leds(app, player, player->led_values);
+        player->reset_mask |= reset_red_mask;
+        player->reset_mask |= reset_green_mask;
+        player->reset_mask |= reset_blue_mask;
+        player->state = NotificationPlayerStateRun;
+        notification_player_wait(player, player->delay);
+        return;
+    case NotificationPlayerStateEnd:
+        notification_player_finish(app, player);
+        return;
+    default:
+        break;
+    }
+
+    const NotificationMessage* notification_message;
+    while((notification_message = (*player->message.sequence)[player->index]) != NULL) {
+        player->index++;
+        if(!notification_player_process_message(app, player, notification_message)) return;
     }
 
     // send and do minimal delay
-    if(led_active) {
+    if(player->led_active) {
         bool need_minimal_delay = false;
         if(notification_is_any_led_layer_internal_and_not_empty(app)) {
             need_minimal_delay = true;
         }
 
-        notification_apply_notification_leds(app, led_values);
-        reset_mask |= reset_red_mask;
-        reset_mask |= reset_green_mask;
-        reset_mask |= reset_blue_mask;
+        notification_player_apply_leds(app, player, player->led_values);
+        player->reset_mask |= reset_red_mask;
+        player->reset_mask |= reset_green_mask;
+        player->reset_mask |= reset_blue_mask;
 
-        if((need_minimal_delay) && (reset_notifications)) {
-            notification_apply_notification_leds(app, led_off_values);
-            furi_delay_ms(minimal_delay);
+        if((need_minimal_delay) && (player->reset_notifications)) {
+            notification_player_apply_leds(app, player, led_off_values);
+            player->state = NotificationPlayerStateEnd;
+            notification_player_wait(player, minimal_delay);
+            return;
         }
     }
 
-    if(reset_notifications) {
-        notification_reset_notification_layer(app, reset_mask, display_brightness_setting);
+    notification_player_finish(app, player);
+}
+
+static void notification_players_run(NotificationApp* app) {
+    uint32_t now = furi_get_tick();
+    for(size_t i = 0; i < NOTIFICATION_PLAYER_COUNT; i++) {
+        NotificationPlayer* player = &app->players[i];
+        if(player->state != NotificationPlayerStateIdle && (int32_t)(now - player->wake_at) >= 0) {
+            notification_player_run(app, player);
+        }
+    }
+}
+
+static uint32_t notification_players_timeout(NotificationApp* app) {
+    uint32_t timeout = FuriWaitForever;
+    uint32_t now = furi_get_tick();
+    for(size_t i = 0; i < NOTIFICATION_PLAYER_COUNT; i++) {
+        NotificationPlayer* player = &app->players[i];
+        if(player->state == NotificationPlayerStateIdle) continue;
+        int32_t left = player->wake_at - now;
+        timeout = MIN(timeout, left > 0 ? (uint32_t)left : 0U);
+    }
+    return timeout;
+}
+
+static bool notification_players_full(NotificationApp* app) {
+    for(size_t i = 0; i < NOTIFICATION_PLAYER_COUNT; i++) {
+        if(app->players[i].state == NotificationPlayerStateIdle) return false;
+    }
+    return true;
+}
+
+// All players are busy, play the oldest one to the end the old way
+static void notification_players_complete_oldest(NotificationApp* app) {
+    NotificationPlayer* oldest = &app->players[0];
+    for(size_t i = 1; i < NOTIFICATION_PLAYER_COUNT; i++) {
+        if(app->players[i].serial < oldest->serial) oldest = &app->players[i];
+    }
+
+    while(oldest->state != NotificationPlayerStateIdle) {
+        int32_t left = oldest->wake_at - furi_get_tick();
+        if(left > 0) furi_delay_tick(left);
+        notification_player_run(app, oldest);
     }
 }
 
@@ -435,8 +569,8 @@ static void
     }
 }
 
-static bool notification_save_settings(NotificationApp* app) {
-    return saved_struct_save(
+static void notification_save_settings(NotificationApp* app) {
+    saved_struct_save_deferred(
         NOTIFICATION_SETTINGS_PATH,
         &app->settings,
         sizeof(NotificationSettings),
@@ -524,23 +658,29 @@ int32_t notification_srv(void* p) {
 
     NotificationAppMessage message;
     while(1) {
-        furi_check(furi_message_queue_get(app->queue, &message, FuriWaitForever) == FuriStatusOk);
+        uint32_t timeout = notification_players_timeout(app);
+        if(furi_message_queue_get(app->queue, &message, timeout) == FuriStatusOk) {
+            switch(message.type) {
+            case NotificationLayerMessage:
+                // Sequence completion is signaled by its player
+                if(notification_players_full(app)) notification_players_complete_oldest(app);
+                notification_player_start(app, &message);
+                message.back_event = NULL;
+                break;
+            case InternalLayerMessage:
+                notification_process_internal_message(app, &message);
+                break;
+            case SaveSettingsMessage:
+                notification_save_settings(app);
+                break;
+            }
 
-        switch(message.type) {
-        case NotificationLayerMessage:
-            notification_process_notification_message(app, &message);
-            break;
-        case InternalLayerMessage:
-            notification_process_internal_message(app, &message);
-            break;
-        case SaveSettingsMessage:
-            notification_save_settings(app);
-            break;
+            if(message.back_event != NULL) {
+                furi_event_flag_set(message.back_event, NOTIFICATION_EVENT_COMPLETE);
+            }
         }
 
-        if(message.back_event != NULL) {
-            furi_event_flag_set(message.back_event, NOTIFICATION_EVENT_COMPLETE);
-        }
+        notification_players_run(app);
     }
 
     return 0;
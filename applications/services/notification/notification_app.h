@@ -5,6 +5,8 @@
 
 #define NOTIFICATION_LED_COUNT 3
 #define NOTIFICATION_EVENT_COMPLETE 0x00000001U
+#define NOTIFICATION_PLAYER_COUNT 4
+#define NOTIFICATION_CHANNEL_COUNT 7
 
 typedef enum {
     NotificationLayerMessage,
@@ -46,6 +48,33 @@ typedef struct {
     bool vibro_on;
 } NotificationSettings;
 
+typedef enum {
+    NotificationPlayerStateIdle,
+    NotificationPlayerStateRun,
+    NotificationPlayerStateLedBlank,
+    NotificationPlayerStateEnd,
+} NotificationPlayerState;
+
+/** Sequence in progress, delays are waited by service loop instead of sleeping */
+typedef struct {
+    NotificationAppMessage message;
+    NotificationPlayerState state;
+    uint32_t serial;
+    uint32_t index;
+    uint32_t wake_at;
+    uint32_t delay;
+
+    bool led_active;
+    uint8_t led_values[NOTIFICATION_LED_COUNT];
+    bool reset_notifications;
+    bool force_volume;
+    bool force_vibro;
+    float speaker_volume_setting;
+    bool vibro_setting;
+    float display_brightness_setting;
+    uint8_t reset_mask;
+} NotificationPlayer;
+
 struct NotificationApp {
     FuriMessageQueue* queue;
     FuriPubSub* event_record;
@@ -56,6 +85,11 @@ struct NotificationApp {
     uint8_t display_led_lock;
 
     NotificationSettings settings;
+
+    NotificationPlayer players[NOTIFICATION_PLAYER_COUNT];
+    /* Newest sequence owns LED, vibro and speaker channels it touches */
+    NotificationPlayer* channel_owners[NOTIFICATION_CHANNEL_COUNT];
+    uint32_t player_serial;
 };
 
 void notification_message_save_settings(NotificationApp* app);
@@ -3,10 +3,16 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include <xtreme.h>
+#include <lib/toolbox/float_tools.h>
 
 #define POWER_OFF_TIMEOUT 90
 #define TAG "Power"
 
+/** Charge state is checked every tick, the rest only as often as it can matter */
+#define POWER_TICK_MS 1000
+#define POWER_FULL_SAMPLE_ACTIVE_MS 1000
+#define POWER_FULL_SAMPLE_IDLE_MS 5000
+
 void power_set_battery_icon_enabled(Power* power, bool is_enabled) {
     furi_assert(power);
 
@@ -276,6 +282,10 @@ static void power_auto_shutdown_arm(Power* power) {
         if(power->input_events_subscription == NULL) {
             power->input_events_subscription = furi_pubsub_subscribe(
                 power->input_events_pubsub, power_input_event_callback, power);
+            furi_pubsub_subscription_set_topics(
+                power->input_events_pubsub,
+                power->input_events_subscription,
+                FURI_PUBSUB_TOPIC(InputTypePress));
         }
         power_start_auto_shutdown_timer(power);
     }
@@ -365,6 +375,7 @@ Power* power_alloc() {
     //Auto shutdown timer
     power->auto_shutdown_timer =
         furi_timer_alloc(power_auto_shutdown_timer_callback, FuriTimerTypeOnce, power);
+    furi_timer_set_slack(power->auto_shutdown_timer, furi_ms_to_ticks(1000));
 
     return power;
 }
@@ -396,34 +407,61 @@ static void power_check_charging_state(Power* power) {
     }
 }
 
-static bool power_update_info(Power* power) {
-    PowerInfo info;
+static void power_publish_info(Power* power, const PowerInfo* info) {
+    // Readers never see odd sequence, they only retry if preempted while copying
+    FURI_CRITICAL_ENTER();
+    __atomic_add_fetch(&power->info_sequence, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    power->info = *info;
+    __atomic_add_fetch(&power->info_sequence, 1, __ATOMIC_RELEASE);
+    FURI_CRITICAL_EXIT();
+}
+
+static bool power_update_info(Power* power, bool full) {
+    // Every read is an I2C transaction shared with GPIO apps, keep the rest from last sample
+    PowerInfo info = power->info;
 
     info.is_charging = furi_hal_power_is_charging();
     info.gauge_is_ok = furi_hal_power_gauge_is_ok();
     info.is_shutdown_requested = furi_hal_power_is_shutdown_requested();
     info.charge = furi_hal_power_get_pct();
-    info.health = furi_hal_power_get_bat_health_pct();
-    info.capacity_remaining = furi_hal_power_get_battery_remaining_capacity();
-    info.capacity_full = furi_hal_power_get_battery_full_capacity();
-    info.current_charger = furi_hal_power_get_battery_current(FuriHalPowerICCharger);
-    info.current_gauge = furi_hal_power_get_battery_current(FuriHalPowerICFuelGauge);
-    info.voltage_battery_charge_limit = furi_hal_power_get_battery_charge_voltage_limit();
-    info.voltage_charger = furi_hal_power_get_battery_voltage(FuriHalPowerICCharger);
-    info.voltage_gauge = furi_hal_power_get_battery_voltage(FuriHalPowerICFuelGauge);
-    info.voltage_vbus = furi_hal_power_get_usb_voltage();
-    info.temperature_charger = furi_hal_power_get_battery_temperature(FuriHalPowerICCharger);
-    info.temperature_gauge = furi_hal_power_get_battery_temperature(FuriHalPowerICFuelGauge);
-
-    furi_mutex_acquire(power->api_mtx, FuriWaitForever);
+    if(full || info.is_shutdown_requested) {
+        info.voltage_vbus = furi_hal_power_get_usb_voltage();
+    }
+    if(full) {
+        info.health = furi_hal_power_get_bat_health_pct();
+        info.capacity_remaining = furi_hal_power_get_battery_remaining_capacity();
+        info.capacity_full = furi_hal_power_get_battery_full_capacity();
+        info.current_charger = furi_hal_power_get_battery_current(FuriHalPowerICCharger);
+        info.current_gauge = furi_hal_power_get_battery_current(FuriHalPowerICFuelGauge);
+        info.voltage_battery_charge_limit = furi_hal_power_get_battery_charge_voltage_limit();
+        info.voltage_charger = furi_hal_power_get_battery_voltage(FuriHalPowerICCharger);
+        info.voltage_gauge = furi_hal_power_get_battery_voltage(FuriHalPowerICFuelGauge);
+        info.temperature_charger = furi_hal_power_get_battery_temperature(FuriHalPowerICCharger);
+        info.temperature_gauge =
+            furi_hal_power_get_battery_temperature(FuriHalPowerICFuelGauge);
+    }
+
     bool need_refresh = power->info.charge != info.charge;
     need_refresh |= power->info.is_charging != info.is_charging;
-    power->info = info;
-    furi_mutex_release(power->api_mtx);
+    need_refresh |= !float_is_equal(
+        power->info.voltage_battery_charge_limit, info.voltage_battery_charge_limit);
+    power_publish_info(power, &info);
 
     return need_refresh;
 }
 
+static bool power_is_full_sample_due(Power* power) {
+    if((int32_t)(furi_get_tick() - power->full_sample_at) < 0) return false;
+
+    // Metrics change fast and are watched while charging, on OTG or near shutdown
+    bool active = power->info.is_charging || power->battery_low ||
+                  power->info.is_shutdown_requested || furi_hal_power_is_otg_enabled();
+    uint32_t period = active ? POWER_FULL_SAMPLE_ACTIVE_MS : POWER_FULL_SAMPLE_IDLE_MS;
+    power->full_sample_at = furi_get_tick() + furi_ms_to_ticks(period);
+    return true;
+}
+
 static void power_check_low_battery(Power* power) {
     if(!power->info.gauge_is_ok) {
         return;
@@ -509,13 +547,13 @@ int32_t power_srv(void* p) {
         power->shutdown_idle_delay_ms = 0;
     }
     power_auto_shutdown_arm(power);
-    power_update_info(power);
-    power->info.is_charge_capped = false; // default false
+    power->full_sample_at = furi_get_tick();
+    power_update_info(power, power_is_full_sample_due(power));
     furi_record_create(RECORD_POWER, power);
 
     while(1) {
         // Update data from gauge and charger
-        bool need_refresh = power_update_info(power);
+        bool need_refresh = power_update_info(power, power_is_full_sample_due(power));
 
         // Check low battery level
         power_check_low_battery(power);
@@ -539,7 +577,7 @@ int32_t power_srv(void* p) {
             furi_hal_power_check_otg_status();
         }
 
-        furi_delay_ms(1000);
+        furi_delay_ms(POWER_TICK_MS);
     }
 
     furi_crash("That was unexpected");
@@ -3,8 +3,10 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include <update_util/update_operation.h>
+#include <toolbox/saved_struct.h>
 
 void power_off(Power* power) {
+    saved_struct_flush();
     furi_hal_power_off();
     // Notify user if USB is plugged
     view_dispatcher_send_to_front(power->view_dispatcher);
@@ -14,6 +16,7 @@ void power_off(Power* power) {
 }
 
 void power_reboot(PowerBootMode mode) {
+    saved_struct_flush();
     if(mode == PowerBootModeNormal) {
         update_operation_disarm();
     } else if(mode == PowerBootModeDfu) {
@@ -28,9 +31,13 @@ void power_get_info(Power* power, PowerInfo* info) {
     furi_assert(power);
     furi_assert(info);
 
-    furi_mutex_acquire(power->api_mtx, FuriWaitForever);
-    memcpy(info, &power->info, sizeof(power->info));
-    furi_mutex_release(power->api_mtx);
+    // Snapshot is published with sequence bump, retry if it changed while copying
+    uint32_t sequence;
+    do {
+        sequence = __atomic_load_n(&power->info_sequence, __ATOMIC_ACQUIRE);
+        memcpy(info, &power->info, sizeof(power->info));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while(sequence != __atomic_load_n(&power->info_sequence, __ATOMIC_RELAXED));
 }
 
 FuriPubSub* power_get_pubsub(Power* power) {
@@ -45,11 +52,7 @@ FuriPubSub* power_get_settings_events_pubsub(Power* power) {
 
 bool power_is_battery_healthy(Power* power) {
     furi_assert(power);
-    bool is_healthy = false;
-    furi_mutex_acquire(power->api_mtx, FuriWaitForever);
-    is_healthy = power->info.health > POWER_BATTERY_HEALTHY_LEVEL;
-    furi_mutex_release(power->api_mtx);
-    return is_healthy;
+    return __atomic_load_n(&power->info.health, __ATOMIC_RELAXED) > POWER_BATTERY_HEALTHY_LEVEL;
 }
 
 void power_enable_low_battery_level_notification(Power* power, bool enable) {
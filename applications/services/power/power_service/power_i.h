@@ -35,7 +35,10 @@ struct Power {
     PowerEvent event;
 
     PowerState state;
+    /* Written by power thread only, readers use power_get_info() */
     PowerInfo info;
+    uint32_t info_sequence;
+    uint32_t full_sample_at;
 
     bool battery_low;
     bool show_low_bat_level_message;
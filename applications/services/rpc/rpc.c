@@ -27,6 +27,9 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+/** Fits screen frames and storage chunks */
+#define RPC_ENCODE_BUFFER_SIZE (1280)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -79,6 +82,7 @@ struct RpcSession {
     bool decode_error;
 
     FuriMutex* callbacks_mutex;
+    uint8_t* encode_buffer; // Guarded by callbacks mutex
     RpcSendBytesCallback send_bytes_callback;
     RpcBufferIsEmptyCallback buffer_is_empty_callback;
     RpcSessionClosedCallback closed_callback;
@@ -353,6 +357,7 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     }
     free(session->system_contexts);
     free(session->decoded_message);
+    free(session->encode_buffer);
     RpcHandlerDict_clear(session->handlers);
     furi_stream_buffer_free(session->stream);
 
@@ -448,32 +453,45 @@ void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #if SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
+
+    // Most messages fit reusable buffer, so they are encoded once and without allocation
+    if(!session->encode_buffer) {
+        session->encode_buffer = malloc(RPC_ENCODE_BUFFER_SIZE);
+    }
+    uint8_t* buffer = session->encode_buffer;
+    pb_ostream_t ostream = pb_ostream_from_buffer(buffer, RPC_ENCODE_BUFFER_SIZE);
+
+    if(!pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED)) {
+        ostream = (pb_ostream_t)PB_OSTREAM_SIZING;
+        bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+        furi_check(result && ostream.bytes_written);
 
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+        buffer = malloc(ostream.bytes_written);
+        ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
 
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+        pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    }
+    furi_check(ostream.bytes_written);
 
 #if SRV_RPC_DEBUG
     rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
 #endif
 
-    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
     if(session->send_bytes_callback) {
         session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
     }
-    furi_mutex_release(session->callbacks_mutex);
 
-    free(buffer);
+    if(buffer != session->encode_buffer) {
+        free(buffer);
+    }
+
+    furi_mutex_release(session->callbacks_mutex);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
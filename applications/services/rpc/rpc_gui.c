@@ -15,6 +15,11 @@ typedef enum {
 
 #define RPC_GUI_INPUT_RESET (0u)
 
+/** Frames are coalesced to this rate, BLE link is saturated by full frames otherwise */
+#define RPC_GUI_SCREEN_STREAM_BLE_MIN_INTERVAL_MS (200u)
+/** Unchanged frames are sent again after this time, so host can tell stream is alive */
+#define RPC_GUI_SCREEN_STREAM_KEYFRAME_INTERVAL_MS (5000u)
+
 typedef struct {
     RpcSession* session;
     Gui* gui;
@@ -26,6 +31,8 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    uint32_t transmit_min_interval;
+    uint32_t transmit_last_tick;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -56,9 +63,17 @@ static void rpc_system_gui_screen_stream_frame_callback(
 
     furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
 
+    // Skip redraws that didn't change anything
+    PB_Gui_ScreenOrientation pb_orientation = rpc_system_gui_screen_orientation_map[orientation];
+    if(rpc_gui->transmit_frame->content.gui_screen_frame.orientation == pb_orientation &&
+       memcmp(buffer, data, size) == 0 &&
+       furi_get_tick() - rpc_gui->transmit_last_tick <
+           furi_ms_to_ticks(RPC_GUI_SCREEN_STREAM_KEYFRAME_INTERVAL_MS)) {
+        return;
+    }
+
     memcpy(buffer, data, size);
-    rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
-        rpc_system_gui_screen_orientation_map[orientation];
+    rpc_gui->transmit_frame->content.gui_screen_frame.orientation = pb_orientation;
 
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
@@ -75,12 +90,17 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
 
         if(flags & RpcGuiWorkerFlagTransmit) {
             transmit_time = furi_get_tick();
+            rpc_gui->transmit_last_tick = transmit_time;
             rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
             transmit_time = furi_get_tick() - transmit_time;
 
             // Guaranteed bandwidth reserve
             uint32_t extra_delay = transmit_time / 20;
             if(extra_delay > 500) extra_delay = 500;
+            // Frames drawn in the meantime are merged into one
+            if(transmit_time + extra_delay < rpc_gui->transmit_min_interval) {
+                extra_delay = rpc_gui->transmit_min_interval - transmit_time;
+            }
             if(extra_delay) furi_delay_tick(extra_delay);
         }
 
@@ -117,6 +137,13 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
         rpc_gui->transmit_frame->content.gui_screen_frame.data =
             malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
         rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
+        rpc_gui->transmit_min_interval =
+            rpc_session_get_owner(session) == RpcOwnerBle ?
+                furi_ms_to_ticks(RPC_GUI_SCREEN_STREAM_BLE_MIN_INTERVAL_MS) :
+                0;
+        // First frame is always sent
+        rpc_gui->transmit_last_tick =
+            furi_get_tick() - furi_ms_to_ticks(RPC_GUI_SCREEN_STREAM_KEYFRAME_INTERVAL_MS);
         // Transmission thread for async TX
         rpc_gui->transmit_thread = furi_thread_alloc_ex(
             "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
@@ -242,7 +269,7 @@ static void
     // Submit event
     FuriPubSub* input_events = furi_record_open(RECORD_INPUT_EVENTS);
     furi_check(input_events);
-    furi_pubsub_publish(input_events, &event);
+    furi_pubsub_publish_topic(input_events, FURI_PUBSUB_TOPIC(event.type), &event);
     furi_record_close(RECORD_INPUT_EVENTS);
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
 }
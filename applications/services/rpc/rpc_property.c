@@ -3,6 +3,10 @@
 #include <furi_hal_info.h>
 #include <furi_hal_power.h>
 #include <core/core_defines.h>
+#include <core/memmgr_heap.h>
+#include <core/thread_stats.h>
+#include <toolbox/property.h>
+#include <toolbox/profiler.h>
 
 #include "rpc_i.h"
 
@@ -11,6 +15,12 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_HEAP_INFO "heapinfo"
+#define PROPERTY_CATEGORY_THREAD_INFO "threadinfo"
+#define PROPERTY_CATEGORY_PROFILER "profiler"
+
+#define PROPERTY_THREAD_INFO_THREADS_MAX 32
+#define PROPERTY_THREAD_INFO_SAMPLE_MS 1000
 
 typedef struct {
     RpcSession* session;
@@ -41,6 +51,139 @@ static void
     }
 }
 
+static void rpc_system_property_size_class_name(char* name, size_t name_size, size_t size_class) {
+    if(size_class < MEMMGR_HEAP_SIZE_CLASSES - 1) {
+        snprintf(name, name_size, "%u", MEMMGR_HEAP_SIZE_CLASS_LIMIT(size_class));
+    } else {
+        snprintf(name, name_size, "larger");
+    }
+}
+
+static void rpc_system_property_heap_info_get(PropertyValueCallback out, void* context) {
+    FuriString* value = furi_string_alloc();
+    FuriString* key = furi_string_alloc();
+    char name[16];
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+
+    MemmgrHeapFragmentation fragmentation;
+    memmgr_heap_get_fragmentation(&fragmentation);
+    property_value_out(&property_context, "%zu", 2, "heap", "free", fragmentation.free_bytes);
+    property_value_out(&property_context, "%zu", 2, "heap", "blocks", fragmentation.free_blocks);
+    property_value_out(
+        &property_context, "%zu", 2, "heap", "max_block", fragmentation.max_free_block);
+    property_value_out(
+        &property_context, "%zu", 2, "heap", "pool_free", fragmentation.slab_free_bytes);
+    for(size_t i = 0; i < MEMMGR_HEAP_SIZE_CLASSES; i++) {
+        rpc_system_property_size_class_name(name, sizeof(name), i);
+        property_value_out(
+            &property_context, "%lu", 3, "heap", "size", name, fragmentation.free_size_class[i]);
+    }
+
+    MemmgrHeapProfile* profile = malloc(sizeof(MemmgrHeapProfile));
+    memmgr_heap_get_profile(profile);
+    property_value_out(&property_context, "%u", 2, "profile", "enabled", profile->enabled);
+    property_value_out(&property_context, "%lu", 2, "profile", "allocs", profile->alloc_count);
+    property_value_out(&property_context, "%lu", 2, "profile", "frees", profile->free_count);
+    for(size_t i = 0; i < MEMMGR_HEAP_SIZE_CLASSES; i++) {
+        rpc_system_property_size_class_name(name, sizeof(name), i);
+        property_value_out(
+            &property_context, "%lu", 3, "profile", "alloc", name, profile->alloc_size_class[i]);
+        property_value_out(
+            &property_context, "%lu", 3, "profile", "free", name, profile->free_size_class[i]);
+    }
+    size_t site_count = 0;
+    for(; site_count < MEMMGR_HEAP_PROFILE_CALL_SITES; site_count++) {
+        const MemmgrHeapProfileCallSite* site = &profile->call_sites[site_count];
+        if(!site->count) break;
+        snprintf(name, sizeof(name), "%zu", site_count);
+        property_value_out(
+            &property_context, "0x%08lx", 3, "site", name, "address", (uint32_t)site->address);
+        property_value_out(&property_context, "%lu", 3, "site", name, "count", site->count);
+        property_value_out(&property_context, "%lu", 3, "site", name, "bytes", site->bytes);
+    }
+    property_context.last = true;
+    property_value_out(&property_context, "%zu", 2, "site", "count", site_count);
+
+    free(profile);
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
+static void rpc_system_property_thread_info_get(PropertyValueCallback out, void* context) {
+    FuriString* value = furi_string_alloc();
+    FuriString* key = furi_string_alloc();
+    char name[16];
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+
+    // Without background collection take a short sample
+    bool sampled = !furi_thread_stats_is_enabled();
+    if(sampled) {
+        furi_thread_stats_set_enabled(true);
+        furi_delay_ms(PROPERTY_THREAD_INFO_SAMPLE_MS);
+    }
+
+    FuriThreadStats* stats = malloc(sizeof(FuriThreadStats) * PROPERTY_THREAD_INFO_THREADS_MAX);
+    FuriThreadStatsTotal total;
+    size_t count = furi_thread_stats_get(stats, PROPERTY_THREAD_INFO_THREADS_MAX, &total);
+    if(sampled) {
+        furi_thread_stats_set_enabled(false);
+    }
+
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    property_value_out(
+        &property_context, "%lu", 1, "window_us", (uint32_t)(total.window / cycles_per_us));
+    property_value_out(
+        &property_context, "%lu", 1, "isr_us", (uint32_t)(total.isr / cycles_per_us));
+    property_value_out(&property_context, "%lu", 1, "switches", total.switches);
+    for(size_t i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "%zu", i);
+        property_value_out(
+            &property_context,
+            "%s",
+            3,
+            "thread",
+            name,
+            "name",
+            furi_thread_get_name(stats[i].thread_id));
+        property_value_out(
+            &property_context,
+            "%s",
+            3,
+            "thread",
+            name,
+            "appid",
+            furi_thread_get_appid(stats[i].thread_id));
+        property_value_out(
+            &property_context,
+            "%lu",
+            3,
+            "thread",
+            name,
+            "runtime_us",
+            (uint32_t)(stats[i].runtime / cycles_per_us));
+        property_value_out(
+            &property_context, "%lu", 3, "thread", name, "switches", stats[i].switches);
+        property_value_out(
+            &property_context,
+            "%lu",
+            3,
+            "thread",
+            name,
+            "latency_max_us",
+            stats[i].latency_max / cycles_per_us);
+    }
+    property_context.last = true;
+    property_value_out(&property_context, "%zu", 2, "thread", "count", count);
+
+    free(stats);
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
 static void rpc_system_property_get_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(request->which_content == PB_Main_property_get_request_tag);
@@ -81,6 +224,12 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_HEAP_INFO)) {
+        rpc_system_property_heap_info_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_THREAD_INFO)) {
+        rpc_system_property_thread_info_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_PROFILER)) {
+        profiler_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
@@ -2,6 +2,7 @@
 #include <core/common_defines.h>
 #include <core/memmgr.h>
 #include <core/record.h>
+#include <core/work_queue.h>
 #include "pb_decode.h"
 #include "rpc/rpc.h"
 #include "rpc_i.h"
@@ -10,6 +11,7 @@
 #include "storage/storage.h"
 #include <stdint.h>
 #include <lib/toolbox/md5_calc.h>
+#include <lib/toolbox/md5_cache.h>
 #include <lib/toolbox/path.h>
 #include <update_util/lfs_backup.h>
 
@@ -24,12 +26,26 @@ typedef enum {
     RpcStorageStateWriting,
 } RpcStorageState;
 
+typedef struct {
+    File* file;
+    const uint8_t* buffer;
+    size_t size;
+    bool success; /**< Cleared by the first failed write */
+} RpcStorageWriteBehind;
+
 typedef struct {
     RpcSession* session;
     Storage* api;
     File* file;
     RpcStorageState state;
     uint32_t current_command_id;
+
+    // Chunk is written by work queue while next message is decoded
+    FuriWork* write_work;
+    RpcStorageWriteBehind write_behind;
+    uint8_t* write_buffers[2];
+    size_t write_buffer_sizes[2];
+    size_t write_buffer_next;
 } RpcStorageSystem;
 
 static void rpc_system_storage_reset_state(
@@ -48,6 +64,7 @@ static void rpc_system_storage_reset_state(
         }
 
         if(rpc_storage->state == RpcStorageStateWriting) {
+            furi_work_wait(rpc_storage->write_work, FuriWaitForever);
             storage_file_close(rpc_storage->file);
             storage_file_free(rpc_storage->file);
             furi_record_close(RECORD_STORAGE);
@@ -294,6 +311,7 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     FuriString* md5 = furi_string_alloc();
     FuriString* md5_path = furi_string_alloc();
     File* file = storage_file_alloc(fs_api);
+    Md5Cache* md5_cache = include_md5 ? md5_cache_open(fs_api) : NULL;
 
     bool finish = false;
     int i = 0;
@@ -324,7 +342,8 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
                 if(include_md5 && !file_info_is_dir(&fileinfo)) {
                     furi_string_printf(md5_path, "%s/%s", list_request->path, name); //-V576
 
-                    if(md5_string_calc_file(file, furi_string_get_cstr(md5_path), md5, NULL)) {
+                    if(md5_cache_calc(
+                           md5_cache, file, furi_string_get_cstr(md5_path), md5, NULL)) {
                         char* md5sum = list->file[i].md5sum;
                         size_t md5sum_size = sizeof(list->file[i].md5sum);
                         snprintf(md5sum, md5sum_size, "%s", furi_string_get_cstr(md5));
@@ -345,6 +364,7 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     response.has_next = false;
     rpc_send_and_release(session, &response);
 
+    if(md5_cache) md5_cache_close(md5_cache);
     furi_string_free(md5);
     furi_string_free(md5_path);
     storage_dir_close(dir);
@@ -354,6 +374,25 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+typedef struct {
+    File* file;
+    pb_bytes_array_t* chunk;
+    size_t size;
+    bool success;
+} RpcStorageReadAhead;
+
+static void rpc_system_storage_read_chunk(void* context) {
+    RpcStorageReadAhead* read_ahead = context;
+
+    if(read_ahead->size) {
+        read_ahead->chunk->size =
+            storage_file_read(read_ahead->file, read_ahead->chunk->bytes, read_ahead->size);
+    } else {
+        read_ahead->chunk->size = 0;
+    }
+    read_ahead->success = read_ahead->chunk->size == read_ahead->size;
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -376,37 +415,53 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
-        do {
+
+        // Next chunk is read by work queue while current one is encoded and sent
+        pb_bytes_array_t* chunks[2];
+        for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+            chunks[i] = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE));
+        }
+        RpcStorageReadAhead read_ahead = {
+            .file = file,
+            .chunk = chunks[0],
+            .size = MIN(size_left, MAX_DATA_SIZE),
+        };
+        FuriWork* work = furi_work_alloc(rpc_system_storage_read_chunk, &read_ahead);
+
+        rpc_system_storage_read_chunk(&read_ahead);
+        fs_operation_success = read_ahead.success;
+        size_left -= read_ahead.chunk->size;
+
+        while(fs_operation_success) {
+            pb_bytes_array_t* chunk = read_ahead.chunk;
+            bool has_next = size_left > 0;
+            if(has_next) {
+                read_ahead.chunk = chunks[chunk == chunks[0] ? 1 : 0];
+                read_ahead.size = MIN(size_left, MAX_DATA_SIZE);
+                furi_work_submit(work, FuriWorkQueuePriorityNormal);
+            }
+
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
+            response->content.storage_read_response.has_file = true;
+            response->content.storage_read_response.file.data = chunk;
+            response->has_next = has_next;
+            // Chunk buffers are reused, so message is not released
+            rpc_send(session, response);
+            response->content.storage_read_response.file.data = NULL;
+
+            if(!has_next) break;
+
+            furi_work_wait(work, FuriWaitForever);
+            fs_operation_success = read_ahead.success;
+            size_left -= read_ahead.chunk->size;
+        }
 
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
-            }
-
-            if(fs_operation_success) {
-                rpc_send_and_release(session, response);
-            }
-        } while((size_left != 0) && fs_operation_success);
+        furi_work_free(work);
+        for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+            free(chunks[i]);
+        }
     }
 
     if(!fs_operation_success) {
@@ -421,6 +476,21 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+static void rpc_system_storage_write_chunk(void* context) {
+    RpcStorageWriteBehind* write_behind = context;
+
+    if(write_behind->success) {
+        size_t written_size =
+            storage_file_write(write_behind->file, write_behind->buffer, write_behind->size);
+        write_behind->success = (written_size == write_behind->size);
+    }
+}
+
+static bool rpc_system_storage_write_wait(RpcStorageSystem* rpc_storage) {
+    furi_work_wait(rpc_storage->write_work, FuriWaitForever);
+    return rpc_storage->write_behind.success;
+}
+
 static void rpc_system_storage_write_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -455,6 +525,8 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         const char* path = request->content.storage_write_request.path;
         fs_operation_success =
             storage_file_open(rpc_storage->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+        rpc_storage->write_behind.file = rpc_storage->file;
+        rpc_storage->write_behind.success = true;
     }
 
     File* file = rpc_storage->file;
@@ -464,13 +536,31 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         if(request->content.storage_write_request.has_file &&
            request->content.storage_write_request.file.data &&
            request->content.storage_write_request.file.data->size) {
-            uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
-            size_t buffer_size = request->content.storage_write_request.file.data->size;
-            size_t written_size = storage_file_write(file, buffer, buffer_size);
-            fs_operation_success = (written_size == buffer_size);
+            uint8_t* data = request->content.storage_write_request.file.data->bytes;
+            size_t data_size = request->content.storage_write_request.file.data->size;
+
+            // Request is released after return, keep a copy in the buffer not being written
+            size_t index = rpc_storage->write_buffer_next;
+            if(rpc_storage->write_buffer_sizes[index] < data_size) {
+                free(rpc_storage->write_buffers[index]);
+                rpc_storage->write_buffers[index] = malloc(data_size);
+                rpc_storage->write_buffer_sizes[index] = data_size;
+            }
+            memcpy(rpc_storage->write_buffers[index], data, data_size);
+
+            fs_operation_success = rpc_system_storage_write_wait(rpc_storage);
+            if(fs_operation_success) {
+                rpc_storage->write_behind.buffer = rpc_storage->write_buffers[index];
+                rpc_storage->write_behind.size = data_size;
+                furi_work_submit(rpc_storage->write_work, FuriWorkQueuePriorityNormal);
+                rpc_storage->write_buffer_next = index ? 0 : 1;
+            }
         }
 
         send_response = !request->has_next;
+        if(fs_operation_success && send_response) {
+            fs_operation_success = rpc_system_storage_write_wait(rpc_storage);
+        }
     }
 
     PB_CommandStatus command_status = PB_CommandStatus_OK;
@@ -609,8 +699,9 @@ static void rpc_system_storage_md5sum_process(const PB_Main* request, void* cont
     File* file = storage_file_alloc(fs_api);
     FuriString* md5 = furi_string_alloc();
     FS_Error file_error;
+    Md5Cache* md5_cache = md5_cache_open(fs_api);
 
-    if(md5_string_calc_file(file, filename, md5, &file_error)) {
+    if(md5_cache_calc(md5_cache, file, filename, md5, &file_error)) {
         PB_Main response = {
             .command_id = request->command_id,
             .command_status = PB_CommandStatus_OK,
@@ -628,6 +719,7 @@ static void rpc_system_storage_md5sum_process(const PB_Main* request, void* cont
             session, request->command_id, rpc_system_storage_get_error(file_error));
     }
 
+    md5_cache_close(md5_cache);
     furi_string_free(md5);
     storage_file_free(file);
 
@@ -715,6 +807,8 @@ void* rpc_system_storage_alloc(RpcSession* session) {
     rpc_storage->api = furi_record_open(RECORD_STORAGE);
     rpc_storage->session = session;
     rpc_storage->state = RpcStorageStateIdle;
+    rpc_storage->write_work =
+        furi_work_alloc(rpc_system_storage_write_chunk, &rpc_storage->write_behind);
 
     RpcHandler rpc_handler = {
         .message_handler = NULL,
@@ -768,5 +862,9 @@ void rpc_system_storage_free(void* context) {
     furi_assert(session);
 
     rpc_system_storage_reset_state(rpc_storage, session, false);
+    furi_work_free(rpc_storage->write_work);
+    for(size_t i = 0; i < COUNT_OF(rpc_storage->write_buffers); i++) {
+        free(rpc_storage->write_buffers[i]);
+    }
     free(rpc_storage);
 }
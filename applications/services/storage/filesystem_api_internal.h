@@ -20,6 +20,7 @@ struct File {
     FS_Error error_id; /**< Standard API error from FS_Error enum */
     int32_t internal_error_id; /**< Internal API error value */
     void* storage;
+    FuriMessageQueue* message_queue; /**< Queue of the worker serving this file */
 };
 
 /** File api structure
@@ -68,6 +69,12 @@ struct File {
  *      @param size how many bytes to allocate
  *      @return success flag
  * 
+ *  @var FS_File_Api::get_sector
+ *      @brief Get first sector of contiguous file, optional
+ *      @param file pointer to file object
+ *      @param sector pointer to first sector
+ *      @return success flag
+ * 
  *  @var FS_File_Api::truncate
  *      @brief Truncate file size to current r/w pointer position
  *      @param file pointer to file object
@@ -96,8 +103,8 @@ typedef struct {
         FS_AccessMode access_mode,
         FS_OpenMode open_mode);
     bool (*const close)(void* context, File* file);
-    uint16_t (*read)(void* context, File* file, void* buff, uint16_t bytes_to_read);
-    uint16_t (*write)(void* context, File* file, const void* buff, uint16_t bytes_to_write);
+    size_t (*read)(void* context, File* file, void* buff, size_t bytes_to_read);
+    size_t (*write)(void* context, File* file, const void* buff, size_t bytes_to_write);
     bool (*const seek)(void* context, File* file, uint32_t offset, bool from_start);
     uint64_t (*tell)(void* context, File* file);
     bool (*const truncate)(void* context, File* file);
@@ -106,6 +113,7 @@ typedef struct {
     bool (*const eof)(void* context, File* file);
 
     bool (*const expand)(void* context, File* file, uint64_t size);
+    bool (*const get_sector)(void* context, File* file, uint32_t* sector);
 } FS_File_Api;
 
 /** Dir api structure
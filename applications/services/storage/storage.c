@@ -8,6 +8,7 @@
 #include <assets_icons.h>
 
 #define STORAGE_TICK 1000
+#define STORAGE_INT_STACK_SIZE (3 * 1024)
 
 #define ICON_SD_MOUNTED &I_SDcardMounted_11x8
 #define ICON_SD_ERROR &I_SDcardFail_11x8
@@ -44,6 +45,10 @@ Storage* storage_app_alloc() {
 
 #ifndef FURI_RAM_EXEC
     storage_int_init(&app->storage[ST_INT]);
+
+    app->int_message_queue = furi_message_queue_alloc(8, sizeof(StorageMessage));
+    app->int_thread =
+        furi_thread_alloc_ex("StorageIntSrv", STORAGE_INT_STACK_SIZE, storage_int_srv, app);
 #endif
     storage_ext_init(&app->storage[ST_EXT]);
 
@@ -71,8 +76,9 @@ void storage_tick(Storage* app) {
         view_port_enabled_set(app->sd_gui.view_port, false);
 
         FURI_LOG_I(TAG, "SD card unmount");
+        storage_dir_cache_reset(app->storage[ST_EXT].dir_cache);
         StorageEvent event = {.type = StorageEventTypeCardUnmount};
-        furi_pubsub_publish(app->pubsub, &event);
+        furi_pubsub_publish_topic(app->pubsub, FURI_PUBSUB_TOPIC(event.type), &event);
     }
 
     // storage enabled (or in error state) but was not enabled (sd card mount)
@@ -88,13 +94,27 @@ void storage_tick(Storage* app) {
         if(app->storage[ST_EXT].status == StorageStatusOK) {
             FURI_LOG_I(TAG, "SD card mount");
             StorageEvent event = {.type = StorageEventTypeCardMount};
-            furi_pubsub_publish(app->pubsub, &event);
+            furi_pubsub_publish_topic(app->pubsub, FURI_PUBSUB_TOPIC(event.type), &event);
         } else {
             FURI_LOG_I(TAG, "SD card mount error");
             StorageEvent event = {.type = StorageEventTypeCardMountError};
-            furi_pubsub_publish(app->pubsub, &event);
+            furi_pubsub_publish_topic(app->pubsub, FURI_PUBSUB_TOPIC(event.type), &event);
+        }
+    }
+}
+
+static int32_t storage_int_srv(void* context) {
+    Storage* app = context;
+
+    StorageMessage message;
+    while(1) {
+        if(furi_message_queue_get(app->int_message_queue, &message, FuriWaitForever) ==
+           FuriStatusOk) {
+            storage_process_message(app, &message);
         }
     }
+
+    return 0;
 }
 
 int32_t storage_srv(void* p) {
@@ -102,6 +122,10 @@ int32_t storage_srv(void* p) {
     Storage* app = storage_app_alloc();
     furi_record_create(RECORD_STORAGE, app);
 
+    if(app->int_thread) {
+        furi_thread_start(app->int_thread);
+    }
+
     StorageMessage message;
     while(1) {
         if(furi_message_queue_get(app->message_queue, &message, STORAGE_TICK) == FuriStatusOk) {
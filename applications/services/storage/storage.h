@@ -55,6 +55,7 @@ typedef enum {
     StorageEventTypeCardMountError, /**< An error occurred during mounting of an SD card. */
     StorageEventTypeFileClose, /**< A file was closed. */
     StorageEventTypeDirClose, /**< A directory was closed. */
+    StorageEventTypeDirChange, /**< Entries of a directory were changed. */
 } StorageEventType;
 
 /**
@@ -62,12 +63,15 @@ typedef enum {
  */
 typedef struct {
     StorageEventType type; /**< Type of the event. */
+    const char* path; /**< Changed directory, for StorageEventTypeDirChange only. */
 } StorageEvent;
 
 /**
  * @brief Get the storage pubsub instance.
  *
- * Storage will send StorageEvent messages.
+ * Storage will send StorageEvent messages. They are published from the storage
+ * service thread, so callbacks must not call the storage API, and the event
+ * path is only valid during the callback.
  *
  * @param storage pointer to a storage API instance.
  * @return pointer to the pubsub instance.
@@ -137,6 +141,85 @@ size_t storage_file_read(File* file, void* buff, size_t bytes_to_read);
  */
 size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write);
 
+/** Buffer of a vectored read or write */
+typedef struct {
+    void* buff; /**< pointer to the buffer, only read from by writes */
+    size_t size; /**< size of the buffer in bytes */
+} StorageIoVec;
+
+/**
+ * @brief Read bytes from a file into several buffers with a single request.
+ *
+ * Buffers are filled one after another, as if by consecutive storage_file_read()
+ * calls, but the storage service is only woken up once for all of them.
+ *
+ * @param file pointer to the file instance to read from.
+ * @param iov pointer to the array of buffers to be filled with read data.
+ * @param iov_count number of buffers in the array.
+ * @return actual number of bytes read in total (may be fewer than requested).
+ */
+size_t storage_file_readv(File* file, const StorageIoVec* iov, size_t iov_count);
+
+/**
+ * @brief Write bytes from several buffers to a file with a single request.
+ *
+ * @param file pointer to the file instance to write into.
+ * @param iov pointer to the array of buffers containing the data to be written.
+ * @param iov_count number of buffers in the array.
+ * @return actual number of bytes written in total (may be fewer than requested).
+ */
+size_t storage_file_writev(File* file, const StorageIoVec* iov, size_t iov_count);
+
+/**
+ * @brief Completion callback of an asynchronous read or write.
+ *
+ * Called from the storage service thread, so it must be short and must not call
+ * any blocking storage API.
+ *
+ * @param context pointer to the context passed along with the request.
+ * @param bytes actual number of bytes read or written.
+ * @param error error of the request, FSE_OK on success.
+ */
+typedef void (*StorageAsyncCallback)(void* context, size_t bytes, FS_Error error);
+
+/**
+ * @brief Submit a request to read bytes from a file, without waiting for it.
+ *
+ * Requests are processed in submission order, so several of them may be kept
+ * outstanding to overlap processing of one buffer with reading of the next.
+ * The buffer must stay valid and the file open until the callback is called.
+ *
+ * @param file pointer to the file instance to read from.
+ * @param buff pointer to the buffer to be filled with read data.
+ * @param bytes_to_read number of bytes to read.
+ * @param callback function to be called once the request is complete, may be NULL.
+ * @param context pointer to be passed to the callback.
+ */
+void storage_file_read_async(
+    File* file,
+    void* buff,
+    size_t bytes_to_read,
+    StorageAsyncCallback callback,
+    void* context);
+
+/**
+ * @brief Submit a request to write bytes from a buffer to a file, without waiting for it.
+ *
+ * Same rules as for storage_file_read_async() apply.
+ *
+ * @param file pointer to the file instance to write into.
+ * @param buff pointer to the buffer containing the data to be written.
+ * @param bytes_to_write number of bytes to write.
+ * @param callback function to be called once the request is complete, may be NULL.
+ * @param context pointer to be passed to the callback.
+ */
+void storage_file_write_async(
+    File* file,
+    const void* buff,
+    size_t bytes_to_write,
+    StorageAsyncCallback callback,
+    void* context);
+
 /**
  * @brief Change the current access position in a file.
  *
@@ -164,6 +247,21 @@ uint64_t storage_file_tell(File* file);
  */
 bool storage_file_expand(File* file, uint64_t size);
 
+/**
+ * @brief Get SD card sector where file data starts.
+ *
+ * Succeeds only for SD card files stored in one contiguous run of clusters,
+ * like the ones made by storage_file_expand(). Data of such file can be
+ * accessed with storage_sd_read_sectors() and storage_sd_write_sectors(),
+ * bypassing the filesystem. Don't mix that with regular reads and writes of
+ * the same file while it is open.
+ *
+ * @param file pointer to the file instance to be mapped.
+ * @param[out] sector pointer to the first sector of file data.
+ * @return true if the file is contiguous, false otherwise.
+ */
+bool storage_file_get_contiguous_sector(File* file, uint32_t* sector);
+
 /**
  * @brief Truncate the file size to the current access position.
  *
@@ -531,6 +629,34 @@ FS_Error storage_sd_info(Storage* storage, SDInfo* info);
  */
 FS_Error storage_sd_status(Storage* storage);
 
+/**
+ * @brief Read SD card sectors directly, bypassing the filesystem.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param sector first sector to read.
+ * @param buffer pointer to a 4 byte aligned buffer of count * 512 bytes.
+ * @param count number of sectors to read.
+ * @return FSE_OK if the sectors were successfully read, any other error code on failure.
+ */
+FS_Error storage_sd_read_sectors(Storage* storage, uint32_t sector, void* buffer, uint32_t count);
+
+/**
+ * @brief Write SD card sectors directly, bypassing the filesystem.
+ *
+ * Only meant for sectors of a file mapped with storage_file_get_contiguous_sector().
+ *
+ * @param storage pointer to a storage API instance.
+ * @param sector first sector to write.
+ * @param buffer pointer to a 4 byte aligned buffer of count * 512 bytes.
+ * @param count number of sectors to write.
+ * @return FSE_OK if the sectors were successfully written, any other error code on failure.
+ */
+FS_Error storage_sd_write_sectors(
+    Storage* storage,
+    uint32_t sector,
+    const void* buffer,
+    uint32_t count);
+
 /******************* Internal LFS Functions *******************/
 
 typedef void (*Storage_name_converter)(FuriString*);
@@ -554,6 +680,24 @@ FS_Error storage_int_backup(Storage* storage, const char* dstname);
  */
 FS_Error storage_int_restore(Storage* api, const char* dstname, Storage_name_converter converter);
 
+/** Internal storage tuning and read statistics since boot */
+typedef struct {
+    uint32_t cache_size; /**< read and write cache size, bytes */
+    uint32_t lookahead_size; /**< free blocks lookahead size, bytes */
+    uint32_t device_reads; /**< flash reads that missed the cache */
+    uint32_t device_read_bytes; /**< bytes read from flash */
+    uint32_t file_read_bytes; /**< bytes read from files by applications */
+} StorageIntInfo;
+
+/**
+ * @brief Get internal storage information.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param info pointer to the info object to contain the requested information.
+ * @return FSE_OK if the info was successfully received, any other error code on failure.
+ */
+FS_Error storage_int_info(Storage* storage, StorageIntInfo* info);
+
 /***************** Simplified Functions ******************/
 
 /**
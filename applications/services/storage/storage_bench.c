@@ -0,0 +1,336 @@
+#include "storage_bench.h"
+
+#include <furi.h>
+#include <furi_hal.h>
+#include <flipper_format/flipper_format.h>
+
+#define TAG "StorageBench"
+
+#define STORAGE_BENCH_DIR ".bench"
+#define STORAGE_BENCH_FILE_SIZE_INT (64 * 1024)
+#define STORAGE_BENCH_FILE_SIZE_EXT (1024 * 1024)
+#define STORAGE_BENCH_SMALL_FILES_INT 16
+#define STORAGE_BENCH_SMALL_FILES_EXT 128
+#define STORAGE_BENCH_SMALL_FILE_SIZE 64
+#define STORAGE_BENCH_LIST_ROUNDS 4
+#define STORAGE_BENCH_FF_KEYS 16
+#define STORAGE_BENCH_FF_ROUNDS 8
+#define STORAGE_BENCH_RANDOM_SEED 0x12345678UL
+
+static const size_t storage_bench_block_sizes[] = {128, 512, 4096, 16384};
+#define STORAGE_BENCH_BLOCK_MAX 16384
+
+typedef struct {
+    Storage* storage;
+    File* file;
+    FuriString* dir;
+    FuriString* path;
+    uint8_t* buffer;
+    size_t file_size;
+    size_t small_files;
+    uint32_t random;
+
+    StorageBenchCallback callback;
+    void* context;
+} StorageBench;
+
+// Cycle counter wraps after a minute, test sizes keep every test well below
+static inline uint32_t storage_bench_time_start(void) {
+    return DWT->CYCCNT;
+}
+
+static bool storage_bench_report(
+    StorageBench* bench,
+    const char* name,
+    size_t block_size,
+    uint32_t ops,
+    uint64_t bytes,
+    uint32_t start) {
+    StorageBenchResult result = {
+        .name = name,
+        .block_size = block_size,
+        .ops = ops,
+        .bytes = bytes,
+        .time_us = (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond(),
+    };
+    return bench->callback(&result, bench->context);
+}
+
+static bool storage_bench_fail(StorageBench* bench, const char* name) {
+    FURI_LOG_E(TAG, "%s failed: %s", name, storage_file_get_error_desc(bench->file));
+    storage_file_close(bench->file);
+    return false;
+}
+
+static uint32_t storage_bench_random(StorageBench* bench) {
+    // Fixed sequence, so runs on different cards access the same offsets
+    uint32_t x = bench->random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bench->random = x;
+    return x;
+}
+
+static void storage_bench_file_path(StorageBench* bench, const char* name) {
+    furi_string_printf(bench->path, "%s/%s", furi_string_get_cstr(bench->dir), name);
+}
+
+static bool storage_bench_write_seq(StorageBench* bench, size_t block_size) {
+    const char* name = "seq_write";
+    uint32_t ops = bench->file_size / block_size;
+    uint32_t start = storage_bench_time_start();
+
+    if(!storage_file_open(
+           bench->file, furi_string_get_cstr(bench->path), FSAM_WRITE, FSOM_CREATE_ALWAYS))
+        return storage_bench_fail(bench, name);
+    for(uint32_t i = 0; i < ops; i++) {
+        if(storage_file_write(bench->file, bench->buffer, block_size) != block_size)
+            return storage_bench_fail(bench, name);
+    }
+    if(!storage_file_close(bench->file)) return storage_bench_fail(bench, name);
+
+    return storage_bench_report(bench, name, block_size, ops, ops * block_size, start);
+}
+
+static bool storage_bench_read_seq(StorageBench* bench, size_t block_size) {
+    const char* name = "seq_read";
+    uint32_t ops = bench->file_size / block_size;
+    uint32_t start = storage_bench_time_start();
+
+    if(!storage_file_open(
+           bench->file, furi_string_get_cstr(bench->path), FSAM_READ, FSOM_OPEN_EXISTING))
+        return storage_bench_fail(bench, name);
+    for(uint32_t i = 0; i < ops; i++) {
+        if(storage_file_read(bench->file, bench->buffer, block_size) != block_size)
+            return storage_bench_fail(bench, name);
+    }
+    storage_file_close(bench->file);
+
+    return storage_bench_report(bench, name, block_size, ops, ops * block_size, start);
+}
+
+static bool storage_bench_random_access(StorageBench* bench, size_t block_size, bool write) {
+    const char* name = write ? "rand_write" : "rand_read";
+    uint32_t blocks = bench->file_size / block_size;
+    uint32_t ops = blocks;
+    uint32_t start = storage_bench_time_start();
+
+    if(!storage_file_open(
+           bench->file,
+           furi_string_get_cstr(bench->path),
+           write ? FSAM_READ_WRITE : FSAM_READ,
+           FSOM_OPEN_EXISTING))
+        return storage_bench_fail(bench, name);
+    for(uint32_t i = 0; i < ops; i++) {
+        uint32_t offset = (storage_bench_random(bench) % blocks) * block_size;
+        if(!storage_file_seek(bench->file, offset, true)) return storage_bench_fail(bench, name);
+        size_t done = write ? storage_file_write(bench->file, bench->buffer, block_size) :
+                              storage_file_read(bench->file, bench->buffer, block_size);
+        if(done != block_size) return storage_bench_fail(bench, name);
+    }
+    if(!storage_file_close(bench->file)) return storage_bench_fail(bench, name);
+
+    return storage_bench_report(bench, name, block_size, ops, ops * block_size, start);
+}
+
+static bool storage_bench_blocks(StorageBench* bench) {
+    storage_bench_file_path(bench, "data.bin");
+
+    bool ret = true;
+    for(size_t i = 0; ret && i < COUNT_OF(storage_bench_block_sizes); i++) {
+        size_t block_size = storage_bench_block_sizes[i];
+        ret = storage_bench_write_seq(bench, block_size) &&
+              storage_bench_read_seq(bench, block_size) &&
+              storage_bench_random_access(bench, block_size, false) &&
+              storage_bench_random_access(bench, block_size, true);
+    }
+
+    storage_simply_remove(bench->storage, furi_string_get_cstr(bench->path));
+    return ret;
+}
+
+static void storage_bench_small_file_path(StorageBench* bench, size_t index) {
+    furi_string_printf(bench->path, "%s/f%04zu.bin", furi_string_get_cstr(bench->dir), index);
+}
+
+static bool storage_bench_small_files(StorageBench* bench) {
+    uint32_t start = storage_bench_time_start();
+    for(size_t i = 0; i < bench->small_files; i++) {
+        storage_bench_small_file_path(bench, i);
+        if(!storage_file_open(
+               bench->file, furi_string_get_cstr(bench->path), FSAM_WRITE, FSOM_CREATE_NEW) ||
+           storage_file_write(bench->file, bench->buffer, STORAGE_BENCH_SMALL_FILE_SIZE) !=
+               STORAGE_BENCH_SMALL_FILE_SIZE ||
+           !storage_file_close(bench->file))
+            return storage_bench_fail(bench, "create");
+    }
+    if(!storage_bench_report(bench, "create", 0, bench->small_files, 0, start)) return false;
+
+    FileInfo info;
+    start = storage_bench_time_start();
+    for(size_t i = 0; i < bench->small_files; i++) {
+        storage_bench_small_file_path(bench, i);
+        if(storage_common_stat(bench->storage, furi_string_get_cstr(bench->path), &info) !=
+           FSE_OK) {
+            FURI_LOG_E(TAG, "stat failed: %s", furi_string_get_cstr(bench->path));
+            return false;
+        }
+    }
+    if(!storage_bench_report(bench, "stat", 0, bench->small_files, 0, start)) return false;
+
+    char name[16];
+    uint32_t entries = 0;
+    start = storage_bench_time_start();
+    for(size_t round = 0; round < STORAGE_BENCH_LIST_ROUNDS; round++) {
+        if(!storage_dir_open(bench->file, furi_string_get_cstr(bench->dir)))
+            return storage_bench_fail(bench, "list");
+        while(storage_dir_read(bench->file, &info, name, sizeof(name))) {
+            entries++;
+        }
+        storage_dir_close(bench->file);
+    }
+    if(!storage_bench_report(bench, "list", 0, entries, 0, start)) return false;
+
+    start = storage_bench_time_start();
+    for(size_t i = 0; i < bench->small_files; i++) {
+        storage_bench_small_file_path(bench, i);
+        if(storage_common_remove(bench->storage, furi_string_get_cstr(bench->path)) != FSE_OK) {
+            FURI_LOG_E(TAG, "delete failed: %s", furi_string_get_cstr(bench->path));
+            return false;
+        }
+    }
+    return storage_bench_report(bench, "delete", 0, bench->small_files, 0, start);
+}
+
+static bool storage_bench_flipper_format(StorageBench* bench) {
+    storage_bench_file_path(bench, "data.txt");
+    const char* path = furi_string_get_cstr(bench->path);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(bench->storage);
+    FuriString* value = furi_string_alloc();
+    char key[16];
+
+    bool ret = flipper_format_file_open_always(flipper_format, path) &&
+               flipper_format_write_header_cstr(flipper_format, "Storage bench", 1);
+    for(size_t i = 0; ret && i < STORAGE_BENCH_FF_KEYS; i++) {
+        uint32_t number = i;
+        snprintf(key, sizeof(key), "Number_%zu", i);
+        ret = flipper_format_write_uint32(flipper_format, key, &number, 1);
+        snprintf(key, sizeof(key), "String_%zu", i);
+        ret = ret &&
+              flipper_format_write_string_cstr(flipper_format, key, "storage benchmark value");
+        snprintf(key, sizeof(key), "Hex_%zu", i);
+        ret = ret && flipper_format_write_hex(flipper_format, key, bench->buffer, 8);
+    }
+    flipper_format_file_close(flipper_format);
+
+    uint32_t start = storage_bench_time_start();
+    for(size_t round = 0; ret && round < STORAGE_BENCH_FF_ROUNDS; round++) {
+        uint32_t version = 0;
+        ret = flipper_format_file_open_existing(flipper_format, path) &&
+              flipper_format_read_header(flipper_format, value, &version);
+        for(size_t i = 0; ret && i < STORAGE_BENCH_FF_KEYS; i++) {
+            uint32_t number = 0;
+            snprintf(key, sizeof(key), "Number_%zu", i);
+            ret = flipper_format_read_uint32(flipper_format, key, &number, 1);
+            snprintf(key, sizeof(key), "String_%zu", i);
+            ret = ret && flipper_format_read_string(flipper_format, key, value);
+            snprintf(key, sizeof(key), "Hex_%zu", i);
+            ret = ret && flipper_format_read_hex(flipper_format, key, bench->buffer, 8);
+        }
+        flipper_format_file_close(flipper_format);
+    }
+
+    if(ret) {
+        ret = storage_bench_report(bench, "ff_parse", 0, STORAGE_BENCH_FF_ROUNDS, 0, start);
+    } else {
+        FURI_LOG_E(TAG, "ff_parse failed");
+    }
+
+    furi_string_free(value);
+    flipper_format_free(flipper_format);
+    storage_simply_remove(bench->storage, path);
+    return ret;
+}
+
+bool storage_bench_run(
+    Storage* storage,
+    const char* root,
+    StorageBenchCallback callback,
+    void* context) {
+    furi_assert(storage);
+    furi_assert(root);
+    furi_assert(callback);
+
+    bool is_int = !strcmp(root, STORAGE_INT_PATH_PREFIX);
+    uint64_t total_space = 0;
+    uint64_t free_space = 0;
+    if(storage_common_fs_info(storage, root, &total_space, &free_space) != FSE_OK) {
+        FURI_LOG_E(TAG, "No storage at %s", root);
+        return false;
+    }
+
+    StorageBench bench = {
+        .storage = storage,
+        .file = storage_file_alloc(storage),
+        .dir = furi_string_alloc_printf("%s/%s", root, STORAGE_BENCH_DIR),
+        .path = furi_string_alloc(),
+        .buffer = malloc(STORAGE_BENCH_BLOCK_MAX),
+        .small_files = is_int ? STORAGE_BENCH_SMALL_FILES_INT : STORAGE_BENCH_SMALL_FILES_EXT,
+        .random = STORAGE_BENCH_RANDOM_SEED,
+        .callback = callback,
+        .context = context,
+    };
+
+    // Leave most of free space alone, file size is a multiple of every block size
+    bench.file_size = is_int ? STORAGE_BENCH_FILE_SIZE_INT : STORAGE_BENCH_FILE_SIZE_EXT;
+    bench.file_size = MIN((uint64_t)bench.file_size, free_space / 4);
+    bench.file_size -= bench.file_size % STORAGE_BENCH_BLOCK_MAX;
+
+    for(size_t i = 0; i < STORAGE_BENCH_BLOCK_MAX; i++) {
+        bench.buffer[i] = i * 0x5A;
+    }
+
+    bool ret = false;
+    do {
+        if(!bench.file_size) {
+            FURI_LOG_E(TAG, "Not enough free space on %s", root);
+            break;
+        }
+
+        storage_simply_remove_recursive(storage, furi_string_get_cstr(bench.dir));
+        if(!storage_simply_mkdir(storage, furi_string_get_cstr(bench.dir))) {
+            FURI_LOG_E(TAG, "Unable to create %s", furi_string_get_cstr(bench.dir));
+            break;
+        }
+
+        ret = storage_bench_blocks(&bench) && storage_bench_small_files(&bench) &&
+              storage_bench_flipper_format(&bench);
+    } while(false);
+
+    storage_simply_remove_recursive(storage, furi_string_get_cstr(bench.dir));
+
+    free(bench.buffer);
+    furi_string_free(bench.path);
+    furi_string_free(bench.dir);
+    storage_file_free(bench.file);
+
+    return ret;
+}
+
+void storage_bench_print_result(const StorageBenchResult* result) {
+    furi_assert(result);
+
+    uint32_t time_us = MAX(result->time_us, (uint32_t)1);
+    printf("%-10s", result->name);
+    if(result->block_size) {
+        printf(" %5zu B", result->block_size);
+    } else {
+        printf("        ");
+    }
+    printf(" %7lu op/s", (uint32_t)((uint64_t)result->ops * 1000000 / time_us));
+    if(result->bytes) {
+        printf(" %6lu KiB/s", (uint32_t)(result->bytes * 1000000 / 1024 / time_us));
+    }
+    printf(" in %lu us\r\n", time_us);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "storage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char* name; /**< test name */
+    size_t block_size; /**< bytes per operation, 0 for metadata tests */
+    uint32_t ops; /**< operations done */
+    uint64_t bytes; /**< bytes transferred */
+    uint32_t time_us; /**< time taken */
+} StorageBenchResult;
+
+/** Called after every test
+ *
+ * @return     true to continue, false to stop benchmark
+ */
+typedef bool (*StorageBenchCallback)(const StorageBenchResult* result, void* context);
+
+/** Measure storage performance in temporary directory on given storage
+ *
+ * Runs sequential and random read and write at several block sizes, small
+ * file create, stat and delete, directory listing and FlipperFormat parsing.
+ * Amount of data is scaled down to fit free space.
+ *
+ * @param      storage   Storage instance
+ * @param      root      storage root, STORAGE_INT_PATH_PREFIX or STORAGE_EXT_PATH_PREFIX
+ * @param      callback  result callback
+ * @param      context   callback context
+ *
+ * @return     true if all tests passed, false on storage error or when stopped
+ */
+bool storage_bench_run(
+    Storage* storage,
+    const char* root,
+    StorageBenchCallback callback,
+    void* context);
+
+/** Print result line to stdout, to be used in result callbacks */
+void storage_bench_print_result(const StorageBenchResult* result);
+
+#ifdef __cplusplus
+}
+#endif
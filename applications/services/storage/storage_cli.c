@@ -4,9 +4,12 @@
 #include <cli/cli.h>
 #include <lib/toolbox/args.h>
 #include <lib/toolbox/md5_calc.h>
+#include <lib/toolbox/md5_cache.h>
 #include <lib/toolbox/dir_walk.h>
+#include <lib/toolbox/stream/buffered_file_stream.h>
 #include <storage/storage.h>
 #include <storage/storage_sd_api.h>
+#include <storage/storage_bench.h>
 #include <power/power_service/power.h>
 
 #define MAX_NAME_LENGTH 254
@@ -33,8 +36,10 @@ static void storage_cli_print_usage() {
         "\tmigrate\t - move folder to new path, renaming already present files by adding numbers to the end\r\n");
     printf("\tmkdir\t - creates a new directory\r\n");
     printf("\tmd5\t - md5 hash of the file\r\n");
+    printf("\tdiff\t - list manifest entries that differ, lines are <md5> <size> <path>\r\n");
     printf("\tstat\t - info about file or dir\r\n");
     printf("\ttimestamp\t - last modification timestamp\r\n");
+    printf("\tbench\t - measure storage performance, <path> must be /int or /ext\r\n");
 }
 
 static void storage_cli_print_error(FS_Error error) {
@@ -60,6 +65,18 @@ static void storage_cli_info(Cli* cli, FuriString* path) {
                 (uint32_t)(total_space / 1024),
                 (uint32_t)(free_space / 1024));
         }
+
+        StorageIntInfo int_info;
+        if(storage_int_info(api, &int_info) == FSE_OK) {
+            printf(
+                "Cache: %luB, lookahead: %luB\r\n"
+                "Flash reads: %lu, %luKiB\r\nFile reads: %luKiB\r\n",
+                int_info.cache_size,
+                int_info.lookahead_size,
+                int_info.device_reads,
+                int_info.device_read_bytes / 1024,
+                int_info.file_read_bytes / 1024);
+        }
     } else if(furi_string_cmp_str(path, STORAGE_EXT_PATH_PREFIX) == 0) {
         SDInfo sd_info;
         FS_Error error = storage_sd_info(api, &sd_info);
@@ -505,13 +522,15 @@ static void storage_cli_md5(Cli* cli, FuriString* path) {
     File* file = storage_file_alloc(api);
     FuriString* md5 = furi_string_alloc();
     FS_Error file_error;
+    Md5Cache* md5_cache = md5_cache_open(api);
 
-    if(md5_string_calc_file(file, furi_string_get_cstr(path), md5, &file_error)) {
+    if(md5_cache_calc(md5_cache, file, furi_string_get_cstr(path), md5, &file_error)) {
         printf("%s\r\n", furi_string_get_cstr(md5));
     } else {
         storage_cli_print_error(file_error);
     }
 
+    md5_cache_close(md5_cache);
     furi_string_free(md5);
     storage_file_close(file);
     storage_file_free(file);
@@ -519,6 +538,94 @@ static void storage_cli_md5(Cli* cli, FuriString* path) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static void storage_cli_diff(Cli* cli, FuriString* path) {
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    Stream* stream = buffered_file_stream_alloc(api);
+    File* file = storage_file_alloc(api);
+    FuriString* line = furi_string_alloc();
+    FuriString* hash = furi_string_alloc();
+    FuriString* md5 = furi_string_alloc();
+    Md5Cache* md5_cache = md5_cache_open(api);
+
+    if(buffered_file_stream_open(
+           stream, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint32_t line_number = 0;
+        uint32_t total = 0;
+        uint32_t differ = 0;
+
+        while(stream_read_line(stream, line)) {
+            if(cli_cmd_interrupt_received(cli)) break;
+            line_number++;
+
+            furi_string_trim(line);
+            if(furi_string_empty(line) || furi_string_get_char(line, 0) == '#') continue;
+
+            // Path is the rest of the line and may contain spaces
+            int size = 0;
+            if(!args_read_string_and_trim(line, hash) || !args_read_int_and_trim(line, &size) ||
+               furi_string_empty(line)) {
+                printf("Invalid manifest line %lu\r\n", line_number);
+                continue;
+            }
+            total++;
+
+            const char* entry = furi_string_get_cstr(line);
+            FileInfo fileinfo;
+            char status = '\0';
+            if(storage_common_stat(api, entry, &fileinfo) != FSE_OK ||
+               file_info_is_dir(&fileinfo)) {
+                status = 'N';
+            } else if(fileinfo.size != (uint64_t)size) {
+                status = 'M';
+            } else if(
+                !md5_cache_calc(md5_cache, file, entry, md5, NULL) ||
+                furi_string_cmpi(md5, hash) != 0) {
+                status = 'M';
+            }
+
+            if(status) {
+                differ++;
+                printf("[%c] %s\r\n", status, entry);
+            }
+        }
+
+        printf("%lu of %lu entries differ\r\n", differ, total);
+    } else {
+        storage_cli_print_error(buffered_file_stream_get_error(stream));
+    }
+
+    md5_cache_close(md5_cache);
+    furi_string_free(md5);
+    furi_string_free(hash);
+    furi_string_free(line);
+    storage_file_free(file);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+static bool storage_cli_bench_callback(const StorageBenchResult* result, void* context) {
+    Cli* cli = context;
+    storage_bench_print_result(result);
+    return !cli_cmd_interrupt_received(cli);
+}
+
+static void storage_cli_bench(Cli* cli, FuriString* path) {
+    if(furi_string_cmp_str(path, STORAGE_INT_PATH_PREFIX) &&
+       furi_string_cmp_str(path, STORAGE_EXT_PATH_PREFIX)) {
+        storage_cli_print_usage();
+        return;
+    }
+
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    printf("Benchmarking %s, press CTRL+C to stop...\r\n", furi_string_get_cstr(path));
+    if(!storage_bench_run(api, furi_string_get_cstr(path), storage_cli_bench_callback, cli)) {
+        printf("Benchmark failed or stopped, check logs\r\n");
+    }
+    furi_record_close(RECORD_STORAGE);
+}
+
 void storage_cli(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriString* cmd;
@@ -607,6 +714,11 @@ void storage_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "diff") == 0) {
+            storage_cli_diff(cli, path);
+            break;
+        }
+
         if(furi_string_cmp_str(cmd, "stat") == 0) {
             storage_cli_stat(cli, path);
             break;
@@ -617,6 +729,11 @@ void storage_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "bench") == 0) {
+            storage_cli_bench(cli, path);
+            break;
+        }
+
         storage_cli_print_usage();
     } while(false);
 
@@ -0,0 +1,415 @@
+#include "storage_dir_cache.h"
+
+#include <strings.h>
+
+// Listings kept at once
+#define STORAGE_DIR_CACHE_DIRS (4U)
+// Memory for all kept listings, bigger directories are never cached
+#define STORAGE_DIR_CACHE_SIZE (8192U)
+// Directories served or recorded at once, others are read from filesystem as is
+#define STORAGE_DIR_CACHE_READERS (4U)
+// Initial size of a recording buffer
+#define STORAGE_DIR_CACHE_RECORD_SIZE (256U)
+
+/** Entry header, followed by name without terminator. Not aligned in the listing. */
+typedef struct {
+    uint32_t size;
+    uint8_t flags;
+    uint8_t name_length;
+} StorageDirCacheEntry;
+
+typedef struct {
+    FuriString* path;
+    uint8_t* data;
+    size_t size;
+    uint32_t last_used;
+    uint8_t readers;
+    bool stale; // Dropped from the cache, freed when last reader is done
+} StorageDirCacheListing;
+
+typedef struct {
+    uint32_t file_id; // 0 if reader is not used
+    FuriString* path;
+
+    // Served listing
+    StorageDirCacheListing* listing;
+    size_t offset;
+
+    // Recorded listing
+    bool recording;
+    uint8_t* record;
+    size_t record_size;
+    size_t record_capacity;
+} StorageDirCacheReader;
+
+struct StorageDirCache {
+    StorageDirCacheListing* listings[STORAGE_DIR_CACHE_DIRS];
+    StorageDirCacheReader readers[STORAGE_DIR_CACHE_READERS];
+    uint32_t clock;
+};
+
+static void storage_dir_cache_normalize(FuriString* path) {
+    while(furi_string_search_str(path, "//") != FURI_STRING_FAILURE) {
+        furi_string_replace_all(path, "//", "/");
+    }
+    while(furi_string_end_with(path, "/")) {
+        furi_string_left(path, furi_string_size(path) - 1);
+    }
+}
+
+static void storage_dir_cache_listing_release(StorageDirCacheListing* listing) {
+    if(listing->readers == 0) {
+        furi_string_free(listing->path);
+        free(listing->data);
+        free(listing);
+    } else {
+        listing->stale = true;
+    }
+}
+
+static void storage_dir_cache_drop(StorageDirCache* cache, size_t index) {
+    StorageDirCacheListing* listing = cache->listings[index];
+    cache->listings[index] = NULL;
+    storage_dir_cache_listing_release(listing);
+}
+
+static void storage_dir_cache_record_stop(StorageDirCacheReader* reader) {
+    free(reader->record);
+    reader->record = NULL;
+    reader->record_size = 0;
+    reader->record_capacity = 0;
+    reader->recording = false;
+}
+
+static void storage_dir_cache_reader_detach(StorageDirCacheReader* reader) {
+    if(reader->listing) {
+        reader->listing->readers--;
+        if(reader->listing->stale) {
+            storage_dir_cache_listing_release(reader->listing);
+        }
+        reader->listing = NULL;
+    }
+    storage_dir_cache_record_stop(reader);
+}
+
+static StorageDirCacheReader*
+    storage_dir_cache_get_reader(StorageDirCache* cache, const File* file) {
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_READERS; i++) {
+        if(cache->readers[i].file_id && cache->readers[i].file_id == file->file_id) {
+            return &cache->readers[i];
+        }
+    }
+    return NULL;
+}
+
+static StorageDirCacheListing*
+    storage_dir_cache_find(StorageDirCache* cache, const FuriString* path) {
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        StorageDirCacheListing* listing = cache->listings[i];
+        if(listing && furi_string_equal(listing->path, path)) {
+            listing->last_used = ++cache->clock;
+            return listing;
+        }
+    }
+    return NULL;
+}
+
+/** Check whether a listing is affected by a change of a path: its entry, itself or above */
+static bool storage_dir_cache_is_affected(const FuriString* listing_path, const FuriString* path) {
+    const char* listing_cstr = furi_string_get_cstr(listing_path);
+    const char* path_cstr = furi_string_get_cstr(path);
+    size_t listing_size = furi_string_size(listing_path);
+    size_t path_size = furi_string_size(path);
+
+    // Listing is the path or below it
+    if(listing_size >= path_size && strncasecmp(listing_cstr, path_cstr, path_size) == 0 &&
+       (listing_cstr[path_size] == '\0' || listing_cstr[path_size] == '/')) {
+        return true;
+    }
+
+    // Listing is the parent of the path
+    const char* name = strrchr(path_cstr, '/');
+    return name && (size_t)(name - path_cstr) == listing_size &&
+           strncasecmp(listing_cstr, path_cstr, listing_size) == 0;
+}
+
+static void storage_dir_cache_store(StorageDirCache* cache, StorageDirCacheReader* reader) {
+    // Same listing might have been recorded by another reader meanwhile
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        if(cache->listings[i] && furi_string_equal(cache->listings[i]->path, reader->path)) {
+            storage_dir_cache_drop(cache, i);
+        }
+    }
+
+    // Evict least recently used listings until the new one fits
+    while(true) {
+        size_t used = reader->record_size;
+        size_t free_index = STORAGE_DIR_CACHE_DIRS;
+        size_t lru_index = STORAGE_DIR_CACHE_DIRS;
+        uint32_t lru_age = 0;
+
+        for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+            StorageDirCacheListing* listing = cache->listings[i];
+            if(!listing) {
+                free_index = i;
+                continue;
+            }
+            used += listing->size;
+            uint32_t age = cache->clock - listing->last_used;
+            if(lru_index == STORAGE_DIR_CACHE_DIRS || age > lru_age) {
+                lru_index = i;
+                lru_age = age;
+            }
+        }
+
+        if(used <= STORAGE_DIR_CACHE_SIZE && free_index != STORAGE_DIR_CACHE_DIRS) {
+            StorageDirCacheListing* listing = malloc(sizeof(StorageDirCacheListing));
+            listing->path = furi_string_alloc_set(reader->path);
+            // Recording buffer is handed over, trimmed to its content
+            listing->data = reader->record_size ? realloc(reader->record, reader->record_size) :
+                                                  NULL;
+            if(!listing->data) free(reader->record);
+            listing->size = reader->record_size;
+            listing->last_used = ++cache->clock;
+            listing->readers = 0;
+            listing->stale = false;
+            cache->listings[free_index] = listing;
+
+            reader->record = NULL;
+            break;
+        }
+
+        storage_dir_cache_drop(cache, lru_index);
+    }
+
+    storage_dir_cache_record_stop(reader);
+}
+
+StorageDirCache* storage_dir_cache_alloc(void) {
+    StorageDirCache* cache = malloc(sizeof(StorageDirCache));
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_READERS; i++) {
+        cache->readers[i].path = furi_string_alloc();
+    }
+    return cache;
+}
+
+void storage_dir_cache_free(StorageDirCache* cache) {
+    furi_assert(cache);
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_READERS; i++) {
+        storage_dir_cache_reader_detach(&cache->readers[i]);
+        furi_string_free(cache->readers[i].path);
+    }
+    storage_dir_cache_reset(cache);
+    free(cache);
+}
+
+void storage_dir_cache_open(StorageDirCache* cache, const File* file, const FuriString* path) {
+    furi_assert(cache);
+
+    StorageDirCacheReader* reader = NULL;
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_READERS; i++) {
+        if(!cache->readers[i].file_id) {
+            reader = &cache->readers[i];
+            break;
+        }
+    }
+    if(!reader) return;
+
+    reader->file_id = file->file_id;
+    furi_string_set(reader->path, path);
+    storage_dir_cache_normalize(reader->path);
+    storage_dir_cache_rewind(cache, file);
+}
+
+void storage_dir_cache_close(StorageDirCache* cache, const File* file) {
+    furi_assert(cache);
+
+    StorageDirCacheReader* reader = storage_dir_cache_get_reader(cache, file);
+    if(reader) {
+        storage_dir_cache_reader_detach(reader);
+        reader->file_id = 0;
+    }
+}
+
+void storage_dir_cache_rewind(StorageDirCache* cache, const File* file) {
+    furi_assert(cache);
+
+    StorageDirCacheReader* reader = storage_dir_cache_get_reader(cache, file);
+    if(!reader) return;
+
+    storage_dir_cache_reader_detach(reader);
+    reader->listing = storage_dir_cache_find(cache, reader->path);
+    if(reader->listing) {
+        reader->listing->readers++;
+        reader->offset = 0;
+    } else {
+        reader->recording = true;
+    }
+}
+
+bool storage_dir_cache_read(
+    StorageDirCache* cache,
+    File* file,
+    FileInfo* fileinfo,
+    char* name,
+    uint16_t name_length) {
+    furi_assert(cache);
+
+    StorageDirCacheReader* reader = storage_dir_cache_get_reader(cache, file);
+    if(!reader || !reader->listing) return false;
+
+    StorageDirCacheListing* listing = reader->listing;
+    StorageDirCacheEntry entry = {0};
+    const char* entry_name = "";
+
+    if(reader->offset < listing->size) {
+        memcpy(&entry, &listing->data[reader->offset], sizeof(StorageDirCacheEntry));
+        entry_name = (const char*)&listing->data[reader->offset + sizeof(StorageDirCacheEntry)];
+        reader->offset += sizeof(StorageDirCacheEntry) + entry.name_length;
+        file->error_id = FSE_OK;
+    } else {
+        file->error_id = FSE_NOT_EXIST;
+    }
+    file->internal_error_id = 0;
+
+    if(fileinfo) {
+        fileinfo->flags = entry.flags;
+        fileinfo->size = entry.size;
+    }
+
+    if(name && name_length) {
+        size_t length = MIN(entry.name_length, name_length - 1U);
+        memcpy(name, entry_name, length);
+        name[length] = '\0';
+    }
+
+    return true;
+}
+
+bool storage_dir_cache_is_recording(StorageDirCache* cache, const File* file) {
+    furi_assert(cache);
+
+    StorageDirCacheReader* reader = storage_dir_cache_get_reader(cache, file);
+    return reader && reader->recording;
+}
+
+void storage_dir_cache_record(
+    StorageDirCache* cache,
+    const File* file,
+    const FileInfo* fileinfo,
+    const char* name) {
+    furi_assert(cache);
+
+    StorageDirCacheReader* reader = storage_dir_cache_get_reader(cache, file);
+    if(!reader || !reader->recording) return;
+
+    if(file->error_id == FSE_NOT_EXIST) {
+        storage_dir_cache_store(cache, reader);
+        return;
+    }
+
+    size_t name_length = strlen(name);
+    size_t entry_size = sizeof(StorageDirCacheEntry) + name_length;
+
+    if(file->error_id != FSE_OK || fileinfo->size > UINT32_MAX || name_length > UINT8_MAX ||
+       reader->record_size + entry_size > STORAGE_DIR_CACHE_SIZE) {
+        storage_dir_cache_record_stop(reader);
+        return;
+    }
+
+    if(reader->record_size + entry_size > reader->record_capacity) {
+        size_t capacity = MAX(reader->record_capacity * 2, STORAGE_DIR_CACHE_RECORD_SIZE);
+        reader->record_capacity = MIN(capacity, STORAGE_DIR_CACHE_SIZE);
+        reader->record = realloc(reader->record, reader->record_capacity);
+    }
+
+    StorageDirCacheEntry entry = {
+        .size = fileinfo->size,
+        .flags = fileinfo->flags,
+        .name_length = name_length,
+    };
+    uint8_t* record = &reader->record[reader->record_size];
+    memcpy(record, &entry, sizeof(StorageDirCacheEntry));
+    memcpy(record + sizeof(StorageDirCacheEntry), name, name_length);
+    reader->record_size += entry_size;
+}
+
+bool storage_dir_cache_stat(StorageDirCache* cache, const FuriString* path, FileInfo* fileinfo) {
+    furi_assert(cache);
+
+    FuriString* dir_path = furi_string_alloc_set(path);
+    storage_dir_cache_normalize(dir_path);
+    FuriString* name = furi_string_alloc();
+
+    bool found = false;
+    do {
+        size_t name_pos = furi_string_search_rchar(dir_path, '/');
+        if(name_pos == FURI_STRING_FAILURE) break;
+
+        furi_string_set_n(name, dir_path, name_pos + 1, furi_string_size(dir_path) - name_pos - 1);
+        furi_string_left(dir_path, name_pos);
+
+        StorageDirCacheListing* listing = storage_dir_cache_find(cache, dir_path);
+        if(!listing) break;
+
+        // Only exact match is trusted, case differences are left for filesystem
+        for(size_t offset = 0; offset < listing->size;) {
+            StorageDirCacheEntry entry;
+            memcpy(&entry, &listing->data[offset], sizeof(StorageDirCacheEntry));
+            const uint8_t* entry_name = &listing->data[offset + sizeof(StorageDirCacheEntry)];
+            offset += sizeof(StorageDirCacheEntry) + entry.name_length;
+
+            if(entry.name_length == furi_string_size(name) &&
+               memcmp(entry_name, furi_string_get_cstr(name), entry.name_length) == 0) {
+                if(fileinfo) {
+                    fileinfo->flags = entry.flags;
+                    fileinfo->size = entry.size;
+                }
+                found = true;
+                break;
+            }
+        }
+    } while(false);
+
+    furi_string_free(name);
+    furi_string_free(dir_path);
+    return found;
+}
+
+void storage_dir_cache_invalidate(StorageDirCache* cache, const FuriString* path) {
+    furi_assert(cache);
+
+    FuriString* changed = furi_string_alloc_set(path);
+    storage_dir_cache_normalize(changed);
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        StorageDirCacheListing* listing = cache->listings[i];
+        if(listing && storage_dir_cache_is_affected(listing->path, changed)) {
+            storage_dir_cache_drop(cache, i);
+        }
+    }
+
+    // Listing being recorded may already miss the change
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_READERS; i++) {
+        StorageDirCacheReader* reader = &cache->readers[i];
+        if(reader->recording && storage_dir_cache_is_affected(reader->path, changed)) {
+            storage_dir_cache_record_stop(reader);
+        }
+    }
+
+    furi_string_free(changed);
+}
+
+void storage_dir_cache_reset(StorageDirCache* cache) {
+    furi_assert(cache);
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_DIRS; i++) {
+        if(cache->listings[i]) {
+            storage_dir_cache_drop(cache, i);
+        }
+    }
+
+    for(size_t i = 0; i < STORAGE_DIR_CACHE_READERS; i++) {
+        storage_dir_cache_record_stop(&cache->readers[i]);
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <furi.h>
+#include "filesystem_api_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Size of the name buffer to read directory entries with while they are recorded */
+#define STORAGE_DIR_CACHE_NAME_SIZE (256U)
+
+/**
+ * Cache of directory listings, owned by the storage service thread.
+ *
+ * Listing is recorded while a directory is read from the underlying filesystem,
+ * from the beginning up to the end, and served to the next readers of the same
+ * path. Paths are full paths with storage prefix, as processed by the service.
+ */
+typedef struct StorageDirCache StorageDirCache;
+
+StorageDirCache* storage_dir_cache_alloc(void);
+
+void storage_dir_cache_free(StorageDirCache* cache);
+
+/** Start serving or recording a directory that was just opened
+ *
+ * @param cache StorageDirCache instance
+ * @param file directory file instance
+ * @param path directory path
+ */
+void storage_dir_cache_open(StorageDirCache* cache, const File* file, const FuriString* path);
+
+/** Stop tracking a directory that is being closed */
+void storage_dir_cache_close(StorageDirCache* cache, const File* file);
+
+/** Restart serving or recording after the directory was rewound */
+void storage_dir_cache_rewind(StorageDirCache* cache, const File* file);
+
+/** Read next directory entry from the cache
+ *
+ * @param cache StorageDirCache instance
+ * @param file directory file instance, error is set on it if entry is served
+ * @param fileinfo entry info, can be NULL
+ * @param name entry name buffer, can be NULL
+ * @param name_length size of the name buffer
+ * @return true if read is served from the cache, false if filesystem should be read
+ */
+bool storage_dir_cache_read(
+    StorageDirCache* cache,
+    File* file,
+    FileInfo* fileinfo,
+    char* name,
+    uint16_t name_length);
+
+/** Check whether entries read from the filesystem should be recorded
+ *
+ * Entries to record must be read with full FileInfo and a name buffer of
+ * STORAGE_DIR_CACHE_NAME_SIZE.
+ *
+ * @param cache StorageDirCache instance
+ * @param file directory file instance
+ * @return true if entries of this directory are recorded
+ */
+bool storage_dir_cache_is_recording(StorageDirCache* cache, const File* file);
+
+/** Record the result of a directory read from the filesystem
+ *
+ * Listing is stored to the cache once the end of directory is read.
+ *
+ * @param cache StorageDirCache instance
+ * @param file directory file instance with the error of the read
+ * @param fileinfo entry info
+ * @param name entry name
+ */
+void storage_dir_cache_record(
+    StorageDirCache* cache,
+    const File* file,
+    const FileInfo* fileinfo,
+    const char* name);
+
+/** Get entry info from the cached listing of its parent directory
+ *
+ * @param cache StorageDirCache instance
+ * @param path entry path
+ * @param fileinfo entry info, can be NULL
+ * @return true if entry is found in the cache, false if filesystem should be asked
+ */
+bool storage_dir_cache_stat(StorageDirCache* cache, const FuriString* path, FileInfo* fileinfo);
+
+/** Drop listings affected by a change of a path
+ *
+ * This is the parent directory of the path, the path itself and everything
+ * below it. Paths are compared case-insensitively to account for FAT.
+ *
+ * @param cache StorageDirCache instance
+ * @param path changed path
+ */
+void storage_dir_cache_invalidate(StorageDirCache* cache, const FuriString* path);
+
+/** Drop all listings, e.g. when a filesystem is mounted or unmounted */
+void storage_dir_cache_reset(StorageDirCache* cache);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,12 +3,12 @@
 #include "storage.h"
 #include "storage_i.h"
 #include "storage_message.h"
-#include <toolbox/stream/file_stream.h>
 #include <toolbox/dir_walk.h>
 #include "toolbox/path.h"
 
 #define MAX_NAME_LENGTH 254
 #define FILE_BUFFER_SIZE 512
+#define COPY_BUFFER_SIZE_MAX (32U * 1024U)
 
 #define TAG "StorageApi"
 
@@ -18,10 +18,11 @@
     Storage* storage = file->storage; \
     furi_assert(storage);
 
-#define S_API_EPILOGUE                                                               \
-    furi_check(                                                                      \
-        furi_message_queue_put(storage->message_queue, &message, FuriWaitForever) == \
-        FuriStatusOk);                                                               \
+#define S_API_EPILOGUE                                                                  \
+    furi_check(                                                                         \
+        furi_message_queue_put(                                                         \
+            storage_get_message_queue(storage, &message), &message, FuriWaitForever) == \
+        FuriStatusOk);                                                                  \
     api_lock_wait_unlock_and_free(lock)
 
 #define S_API_MESSAGE(_command)      \
@@ -40,14 +41,94 @@
         }};
 
 #define S_RETURN_BOOL (return_data.bool_value);
-#define S_RETURN_UINT16 (return_data.uint16_value);
 #define S_RETURN_UINT64 (return_data.uint64_value);
+#define S_RETURN_SIZE (return_data.size_value);
 #define S_RETURN_ERROR (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
 
 typedef enum {
     StorageEventFlagFileClose = (1 << 0),
 } StorageEventFlag;
+
+static bool storage_path_has_prefix(const char* path, const char* prefix) {
+    size_t prefix_length = strlen(prefix);
+    return strncmp(path, prefix, prefix_length) == 0 &&
+           (path[prefix_length] == '\0' || path[prefix_length] == '/');
+}
+
+static bool storage_path_is_internal(Storage* storage, const char* path) {
+    if(storage_path_has_prefix(path, STORAGE_INT_PATH_PREFIX)) {
+        return true;
+    }
+
+    // Status can change meanwhile, the worker then resolves the path to its own storage
+    return storage_path_has_prefix(path, STORAGE_ANY_PATH_PREFIX) &&
+           storage->storage[ST_EXT].status != StorageStatusOK;
+}
+
+/** Route a request to the worker of internal storage or to the main storage thread
+ *
+ * Requests on internal storage are served by their own thread, so they don't
+ * wait for SD card ones. Workers never touch each other's storage.
+ */
+static FuriMessageQueue* storage_get_message_queue(Storage* storage, StorageMessage* message) {
+    const char* path = NULL;
+
+    switch(message->command) {
+    case StorageCommandFileOpen:
+        path = message->data->fopen.path;
+        break;
+    case StorageCommandDirOpen:
+        path = message->data->dopen.path;
+        break;
+    case StorageCommandCommonTimestamp:
+        path = message->data->ctimestamp.path;
+        break;
+    case StorageCommandCommonStat:
+        path = message->data->cstat.path;
+        break;
+    case StorageCommandCommonRemove:
+    case StorageCommandCommonMkDir:
+        path = message->data->path.path;
+        break;
+    case StorageCommandCommonRename:
+        path = message->data->rename.old;
+        break;
+    case StorageCommandCommonFSInfo:
+        path = message->data->cfsinfo.fs_path;
+        break;
+    case StorageCommandCommonEquivalentPath:
+        path = message->data->cequivpath.path1;
+        break;
+    case StorageCommandCommonResolvePath:
+    case StorageCommandSDFormat:
+    case StorageCommandSDUnmount:
+    case StorageCommandSDMount:
+    case StorageCommandSDInfo:
+    case StorageCommandSDStatus:
+    case StorageCommandSDReadSectors:
+    case StorageCommandSDWriteSectors:
+    case StorageCommandIntInfo:
+        return storage->message_queue;
+    default: {
+        // Data of all other requests starts with the file they are about
+        File* file = message->data->file.file;
+        return file->message_queue ? file->message_queue : storage->message_queue;
+    }
+    }
+
+    FuriMessageQueue* queue = storage->message_queue;
+    if(storage->int_message_queue && storage_path_is_internal(storage, path)) {
+        queue = storage->int_message_queue;
+    }
+
+    // Following requests on an opened file go to the same worker
+    if(message->command == StorageCommandFileOpen || message->command == StorageCommandDirOpen) {
+        message->data->file.file->message_queue = queue;
+    }
+
+    return queue;
+}
 /****************** FILE ******************/
 
 static bool storage_file_open_internal(
@@ -138,7 +219,7 @@ bool storage_file_close(File* file) {
     return S_RETURN_BOOL;
 }
 
-static uint16_t storage_file_read_underlying(File* file, void* buff, uint16_t bytes_to_read) {
+size_t storage_file_read(File* file, void* buff, size_t bytes_to_read) {
     if(bytes_to_read == 0) {
         return 0;
     }
@@ -155,11 +236,10 @@ static uint16_t storage_file_read_underlying(File* file, void* buff, uint16_t by
 
     S_API_MESSAGE(StorageCommandFileRead);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-static uint16_t
-    storage_file_write_underlying(File* file, const void* buff, uint16_t bytes_to_write) {
+size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write) {
     if(bytes_to_write == 0) {
         return 0;
     }
@@ -176,41 +256,98 @@ static uint16_t
 
     S_API_MESSAGE(StorageCommandFileWrite);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-size_t storage_file_read(File* file, void* buff, size_t to_read) {
-    size_t total = 0;
+static size_t storage_file_iovec(
+    File* file,
+    StorageCommand command,
+    const StorageIoVec* iov,
+    size_t iov_count) {
+    if(iov_count == 0) {
+        return 0;
+    }
 
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_read - total), max_chunk);
-        size_t read = storage_file_read_underlying(file, buff + total, chunk);
-        total += read;
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
 
-        if(storage_file_get_error(file) != FSE_OK || read != chunk) {
-            break;
-        }
-    } while(total != to_read);
+    SAData data = {
+        .fiovec = {
+            .file = file,
+            .iov = iov,
+            .iov_count = iov_count,
+        }};
 
-    return total;
+    S_API_MESSAGE(command);
+    S_API_EPILOGUE;
+    return S_RETURN_SIZE;
 }
 
-size_t storage_file_write(File* file, const void* buff, size_t to_write) {
-    size_t total = 0;
+size_t storage_file_readv(File* file, const StorageIoVec* iov, size_t iov_count) {
+    return storage_file_iovec(file, StorageCommandFileReadV, iov, iov_count);
+}
 
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_write - total), max_chunk);
-        size_t written = storage_file_write_underlying(file, buff + total, chunk);
-        total += written;
+size_t storage_file_writev(File* file, const StorageIoVec* iov, size_t iov_count) {
+    return storage_file_iovec(file, StorageCommandFileWriteV, iov, iov_count);
+}
 
-        if(storage_file_get_error(file) != FSE_OK || written != chunk) {
-            break;
-        }
-    } while(total != to_write);
+static void storage_file_request_async(
+    File* file,
+    StorageCommand command,
+    const SAData* data,
+    StorageAsyncCallback callback,
+    void* context) {
+    S_FILE_API_PROLOGUE;
+
+    StorageAsyncRequest* request = malloc(sizeof(StorageAsyncRequest));
+    request->data = *data;
+    request->callback = callback;
+    request->context = context;
+
+    StorageMessage message = {
+        .lock = NULL,
+        .command = command,
+        .data = &request->data,
+        .return_data = &request->return_data,
+        .request = request,
+    };
 
-    return total;
+    furi_check(
+        furi_message_queue_put(
+            storage_get_message_queue(storage, &message), &message, FuriWaitForever) ==
+        FuriStatusOk);
+}
+
+void storage_file_read_async(
+    File* file,
+    void* buff,
+    size_t bytes_to_read,
+    StorageAsyncCallback callback,
+    void* context) {
+    SAData data = {
+        .fread = {
+            .file = file,
+            .buff = buff,
+            .bytes_to_read = bytes_to_read,
+        }};
+
+    storage_file_request_async(file, StorageCommandFileRead, &data, callback, context);
+}
+
+void storage_file_write_async(
+    File* file,
+    const void* buff,
+    size_t bytes_to_write,
+    StorageAsyncCallback callback,
+    void* context) {
+    SAData data = {
+        .fwrite = {
+            .file = file,
+            .buff = buff,
+            .bytes_to_write = bytes_to_write,
+        }};
+
+    storage_file_request_async(file, StorageCommandFileWrite, &data, callback, context);
 }
 
 bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
@@ -253,6 +390,21 @@ bool storage_file_expand(File* file, uint64_t size) {
     return S_RETURN_BOOL;
 }
 
+bool storage_file_get_contiguous_sector(File* file, uint32_t* sector) {
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .fsector = {
+            .file = file,
+            .sector = sector,
+        }};
+
+    S_API_MESSAGE(StorageCommandFileGetSector);
+    S_API_EPILOGUE;
+    return S_RETURN_BOOL;
+}
+
 bool storage_file_truncate(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
@@ -586,8 +738,82 @@ FS_Error storage_common_move(Storage* storage, const char* old_path, const char*
     return error;
 }
 
-static FS_Error
-    storage_copy_recursive(Storage* storage, const char* old_path, const char* new_path) {
+/* Copy buffer is taken once per copy or merge operation and sized from the
+ * largest free heap block, leaving half of it to the rest of the system.
+ * Memory pool is tried first, so that the buffer doesn't fragment the heap */
+static uint8_t* storage_copy_buffer_alloc(size_t* size) {
+    size_t buffer_size = memmgr_heap_get_max_free_block() / 2;
+    buffer_size = CLAMP(buffer_size, COPY_BUFFER_SIZE_MAX, FILE_BUFFER_SIZE);
+    buffer_size -= buffer_size % FILE_BUFFER_SIZE;
+
+    *size = buffer_size;
+    return memmgr_alloc_transient(buffer_size);
+}
+
+static FS_Error storage_copy_file(
+    Storage* storage,
+    const char* old_path,
+    const char* new_path,
+    uint8_t* buffer,
+    size_t buffer_size) {
+    FS_Error error;
+    File* file_from = storage_file_alloc(storage);
+    File* file_to = storage_file_alloc(storage);
+
+    do {
+        if(!storage_file_open(file_from, old_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            error = storage_file_get_error(file_from);
+            break;
+        }
+
+        if(!storage_file_open(file_to, new_path, FSAM_WRITE, FSOM_CREATE_NEW)) {
+            error = storage_file_get_error(file_to);
+            break;
+        }
+
+        // Contiguous preallocation is optional, plain writes will allocate otherwise
+        uint64_t size = storage_file_size(file_from);
+        bool expanded = size && storage_file_expand(file_to, size);
+
+        error = FSE_OK;
+        while(size) {
+            size_t chunk_size = MIN(size, buffer_size);
+
+            if(storage_file_read(file_from, buffer, chunk_size) != chunk_size) {
+                error = storage_file_get_error(file_from);
+                break;
+            }
+
+            if(storage_file_write(file_to, buffer, chunk_size) != chunk_size) {
+                error = storage_file_get_error(file_to);
+                break;
+            }
+
+            size -= chunk_size;
+        }
+
+        if(error == FSE_OK && size) {
+            // Source ended before its reported size
+            error = FSE_INTERNAL;
+        }
+
+        // Cut preallocated space that was not written
+        if(expanded && size) {
+            storage_file_truncate(file_to);
+        }
+    } while(false);
+
+    storage_file_free(file_from);
+    storage_file_free(file_to);
+    return error;
+}
+
+static FS_Error storage_copy_recursive(
+    Storage* storage,
+    const char* old_path,
+    const char* new_path,
+    uint8_t* buffer,
+    size_t buffer_size) {
     if(storage_common_equivalent_path(storage, old_path, new_path, true)) {
         return FSE_INVALID_NAME;
     }
@@ -596,11 +822,9 @@ static FS_Error
     DirWalk* dir_walk = dir_walk_alloc(storage);
     FuriString* path;
     FuriString* tmp_new_path;
-    FuriString* tmp_old_path;
     FileInfo fileinfo;
     path = furi_string_alloc();
     tmp_new_path = furi_string_alloc();
-    tmp_old_path = furi_string_alloc();
 
     do {
         if(error != FSE_OK) break;
@@ -610,6 +834,7 @@ static FS_Error
             break;
         }
 
+        // Single pass over the whole tree, entries are taken as walk reports them
         while(1) {
             DirWalkResult res = dir_walk_read(dir_walk, path, &fileinfo);
 
@@ -619,17 +844,19 @@ static FS_Error
             } else if(res == DirWalkLast) {
                 break;
             } else {
-                furi_string_set(tmp_old_path, path);
-                furi_string_right(path, strlen(old_path));
-                furi_string_printf(tmp_new_path, "%s%s", new_path, furi_string_get_cstr(path));
+                const char* tmp_old_path = furi_string_get_cstr(path);
+                furi_string_printf(
+                    tmp_new_path, "%s%s", new_path, tmp_old_path + strlen(old_path));
 
                 if(file_info_is_dir(&fileinfo)) {
                     error = storage_common_mkdir(storage, furi_string_get_cstr(tmp_new_path));
                 } else {
-                    error = storage_common_copy(
+                    error = storage_copy_file(
                         storage,
-                        furi_string_get_cstr(tmp_old_path),
-                        furi_string_get_cstr(tmp_new_path));
+                        tmp_old_path,
+                        furi_string_get_cstr(tmp_new_path),
+                        buffer,
+                        buffer_size);
                 }
 
                 if(error != FSE_OK) break;
@@ -639,7 +866,6 @@ static FS_Error
     } while(false);
 
     furi_string_free(tmp_new_path);
-    furi_string_free(tmp_old_path);
     furi_string_free(path);
     dir_walk_free(dir_walk);
     return error;
@@ -652,38 +878,37 @@ FS_Error storage_common_copy(Storage* storage, const char* old_path, const char*
     error = storage_common_stat(storage, old_path, &fileinfo);
 
     if(error == FSE_OK) {
+        size_t buffer_size;
+        uint8_t* buffer = storage_copy_buffer_alloc(&buffer_size);
+
         if(file_info_is_dir(&fileinfo)) {
-            error = storage_copy_recursive(storage, old_path, new_path);
+            error = storage_copy_recursive(storage, old_path, new_path, buffer, buffer_size);
         } else {
-            Stream* stream_from = file_stream_alloc(storage);
-            Stream* stream_to = file_stream_alloc(storage);
-
-            do {
-                if(!file_stream_open(stream_from, old_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
-                if(!file_stream_open(stream_to, new_path, FSAM_WRITE, FSOM_CREATE_NEW)) break;
-                stream_copy_full(stream_from, stream_to);
-            } while(false);
-
-            error = file_stream_get_error(stream_from);
-            if(error == FSE_OK) {
-                error = file_stream_get_error(stream_to);
-            }
-
-            stream_free(stream_from);
-            stream_free(stream_to);
+            error = storage_copy_file(storage, old_path, new_path, buffer, buffer_size);
         }
+
+        free(buffer);
     }
 
     return error;
 }
 
-static FS_Error _storage_common_merge(Storage*, const char*, const char*, bool);
+static FS_Error storage_merge_entry(
+    Storage* storage,
+    const char* old_path,
+    const FileInfo* fileinfo,
+    const char* new_path,
+    bool copy,
+    uint8_t* buffer,
+    size_t buffer_size);
 
 static FS_Error storage_merge_recursive(
     Storage* storage,
     const char* old_path,
     const char* new_path,
-    bool copy) {
+    bool copy,
+    uint8_t* buffer,
+    size_t buffer_size) {
     FS_Error error = FSE_OK;
     DirWalk* dir_walk = dir_walk_alloc(storage);
     FuriString *path, *file_basename, *tmp_new_path;
@@ -713,20 +938,15 @@ static FS_Error storage_merge_recursive(
                 path_extract_basename(furi_string_get_cstr(path), file_basename);
                 path_concat(new_path, furi_string_get_cstr(file_basename), tmp_new_path);
 
-                if(file_info_is_dir(&fileinfo)) {
-                    if(storage_common_stat(
-                           storage, furi_string_get_cstr(tmp_new_path), &fileinfo) == FSE_OK) {
-                        if(file_info_is_dir(&fileinfo)) {
-                            error =
-                                storage_common_mkdir(storage, furi_string_get_cstr(tmp_new_path));
-                            if(error != FSE_OK && error != FSE_EXIST) {
-                                break;
-                            }
-                        }
-                    }
-                }
-                error = _storage_common_merge(
-                    storage, furi_string_get_cstr(path), furi_string_get_cstr(tmp_new_path), copy);
+                // Entry info comes from the walk, destination directory is made on merge
+                error = storage_merge_entry(
+                    storage,
+                    furi_string_get_cstr(path),
+                    &fileinfo,
+                    furi_string_get_cstr(tmp_new_path),
+                    copy,
+                    buffer,
+                    buffer_size);
 
                 if(error != FSE_OK) {
                     break;
@@ -743,84 +963,95 @@ static FS_Error storage_merge_recursive(
     return error;
 }
 
-static FS_Error
-    _storage_common_merge(Storage* storage, const char* old_path, const char* new_path, bool copy) {
-    FS_Error error;
+static FS_Error storage_merge_entry(
+    Storage* storage,
+    const char* old_path,
+    const FileInfo* fileinfo,
+    const char* new_path,
+    bool copy,
+    uint8_t* buffer,
+    size_t buffer_size) {
+    FS_Error error = FSE_OK;
     const char* new_path_tmp = NULL;
     FuriString* new_path_next = NULL;
     new_path_next = furi_string_alloc();
 
+    if(file_info_is_dir(fileinfo)) {
+        if(!copy) {
+            error = storage_common_rename(storage, old_path, new_path);
+        }
+        if(copy || error != FSE_OK) {
+            error =
+                storage_merge_recursive(storage, old_path, new_path, copy, buffer, buffer_size);
+        }
+    } else {
+        FileInfo new_fileinfo;
+        error = storage_common_stat(storage, new_path, &new_fileinfo);
+        if(error == FSE_OK) {
+            furi_string_set(new_path_next, new_path);
+            FuriString* dir_path = furi_string_alloc();
+            FuriString* filename = furi_string_alloc();
+            FuriString* file_ext = furi_string_alloc();
+
+            path_extract_filename(new_path_next, filename, true);
+            path_extract_dirname(new_path, dir_path);
+            path_extract_ext_str(new_path_next, file_ext);
+
+            storage_get_next_filename(
+                storage,
+                furi_string_get_cstr(dir_path),
+                furi_string_get_cstr(filename),
+                furi_string_get_cstr(file_ext),
+                new_path_next,
+                255);
+            furi_string_cat_printf(
+                dir_path,
+                "/%s%s",
+                furi_string_get_cstr(new_path_next),
+                furi_string_get_cstr(file_ext));
+            furi_string_set(new_path_next, dir_path);
+
+            furi_string_free(dir_path);
+            furi_string_free(filename);
+            furi_string_free(file_ext);
+            new_path_tmp = furi_string_get_cstr(new_path_next);
+        } else {
+            new_path_tmp = new_path;
+        }
+        if(copy) {
+            error = storage_copy_file(storage, old_path, new_path_tmp, buffer, buffer_size);
+        } else {
+            error = storage_common_rename(storage, old_path, new_path_tmp);
+        }
+    }
+
+    furi_string_free(new_path_next);
+
+    return error;
+}
+
+static FS_Error
+    _storage_common_merge(Storage* storage, const char* old_path, const char* new_path, bool copy) {
+    FS_Error error;
+
     FileInfo fileinfo;
     error = storage_common_stat(storage, old_path, &fileinfo);
 
     if(error == FSE_OK) {
-        if(file_info_is_dir(&fileinfo)) {
-            if(!copy) {
-                error = storage_common_rename(storage, old_path, new_path);
-            }
-            if(copy || error != FSE_OK) {
-                error = storage_merge_recursive(storage, old_path, new_path, copy);
-            }
-        } else {
-            error = storage_common_stat(storage, new_path, &fileinfo);
-            if(error == FSE_OK) {
-                furi_string_set(new_path_next, new_path);
-                FuriString* dir_path = furi_string_alloc();
-                FuriString* filename = furi_string_alloc();
-                FuriString* file_ext = furi_string_alloc();
-
-                path_extract_filename(new_path_next, filename, true);
-                path_extract_dirname(new_path, dir_path);
-                path_extract_ext_str(new_path_next, file_ext);
-
-                storage_get_next_filename(
-                    storage,
-                    furi_string_get_cstr(dir_path),
-                    furi_string_get_cstr(filename),
-                    furi_string_get_cstr(file_ext),
-                    new_path_next,
-                    255);
-                furi_string_cat_printf(
-                    dir_path,
-                    "/%s%s",
-                    furi_string_get_cstr(new_path_next),
-                    furi_string_get_cstr(file_ext));
-                furi_string_set(new_path_next, dir_path);
-
-                furi_string_free(dir_path);
-                furi_string_free(filename);
-                furi_string_free(file_ext);
-                new_path_tmp = furi_string_get_cstr(new_path_next);
-            } else {
-                new_path_tmp = new_path;
-            }
-            if(copy) {
-                Stream* stream_from = file_stream_alloc(storage);
-                Stream* stream_to = file_stream_alloc(storage);
-
-                do {
-                    if(!file_stream_open(stream_from, old_path, FSAM_READ, FSOM_OPEN_EXISTING))
-                        break;
-                    if(!file_stream_open(stream_to, new_path_tmp, FSAM_WRITE, FSOM_CREATE_NEW))
-                        break;
-                    stream_copy_full(stream_from, stream_to);
-                } while(false);
-
-                error = file_stream_get_error(stream_from);
-                if(error == FSE_OK) {
-                    error = file_stream_get_error(stream_to);
-                }
+        size_t buffer_size = 0;
+        uint8_t* buffer = NULL;
+        if(copy) {
+            buffer = storage_copy_buffer_alloc(&buffer_size);
+        }
 
-                stream_free(stream_from);
-                stream_free(stream_to);
-            } else {
-                error = storage_common_rename(storage, old_path, new_path_tmp);
-            }
+        error = storage_merge_entry(
+            storage, old_path, &fileinfo, new_path, copy, buffer, buffer_size);
+
+        if(buffer) {
+            free(buffer);
         }
     }
 
-    furi_string_free(new_path_next);
-
     return error;
 }
 
@@ -972,6 +1203,17 @@ FS_Error storage_sd_info(Storage* storage, SDInfo* info) {
     return S_RETURN_ERROR;
 }
 
+FS_Error storage_int_info(Storage* storage, StorageIntInfo* info) {
+    S_API_PROLOGUE;
+    SAData data = {
+        .intinfo = {
+            .info = info,
+        }};
+    S_API_MESSAGE(StorageCommandIntInfo);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
 FS_Error storage_sd_status(Storage* storage) {
     S_API_PROLOGUE;
     SAData data = {};
@@ -980,10 +1222,41 @@ FS_Error storage_sd_status(Storage* storage) {
     return S_RETURN_ERROR;
 }
 
+FS_Error storage_sd_read_sectors(Storage* storage, uint32_t sector, void* buffer, uint32_t count) {
+    S_API_PROLOGUE;
+    SAData data = {
+        .sdsectors = {
+            .sector = sector,
+            .buffer = buffer,
+            .count = count,
+        }};
+    S_API_MESSAGE(StorageCommandSDReadSectors);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
+FS_Error storage_sd_write_sectors(
+    Storage* storage,
+    uint32_t sector,
+    const void* buffer,
+    uint32_t count) {
+    S_API_PROLOGUE;
+    SAData data = {
+        .sdsectors = {
+            .sector = sector,
+            .buffer = (void*)buffer,
+            .count = count,
+        }};
+    S_API_MESSAGE(StorageCommandSDWriteSectors);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
 File* storage_file_alloc(Storage* storage) {
     File* file = malloc(sizeof(File));
     file->type = FileTypeClosed;
     file->storage = storage;
+    file->message_queue = NULL;
 
     FURI_LOG_T(TAG, "File/Dir %p alloc", (void*)((uint32_t)file - SRAM_BASE));
 
@@ -9,18 +9,21 @@ void storage_file_init(StorageFile* obj) {
     obj->file = NULL;
     obj->file_data = NULL;
     obj->path = furi_string_alloc();
+    obj->write = false;
 }
 
 void storage_file_init_set(StorageFile* obj, const StorageFile* src) {
     obj->file = src->file;
     obj->file_data = src->file_data;
     obj->path = furi_string_alloc_set(src->path);
+    obj->write = src->write;
 }
 
 void storage_file_set(StorageFile* obj, const StorageFile* src) { //-V524
     obj->file = src->file;
     obj->file_data = src->file_data;
     furi_string_set(obj->path, src->path);
+    obj->write = src->write;
 }
 
 void storage_file_clear(StorageFile* obj) {
@@ -33,6 +36,7 @@ void storage_data_init(StorageData* storage) {
     storage->data = NULL;
     storage->status = StorageStatusNotReady;
     StorageFileList_init(storage->files);
+    storage->dir_cache = storage_dir_cache_alloc();
 }
 
 StorageStatus storage_data_status(StorageData* storage) {
@@ -126,6 +130,10 @@ void* storage_get_storage_file_data(const File* file, StorageData* storage) {
     return storage_file_ref->file_data;
 }
 
+StorageFile* storage_get_storage_file(const File* file, StorageData* storage) {
+    return storage_get_file(file, storage);
+}
+
 void storage_push_storage_file(File* file, FuriString* path, StorageData* storage) {
     StorageFile* storage_file = StorageFileList_push_new(storage->files);
     file->file_id = (uint32_t)storage_file;
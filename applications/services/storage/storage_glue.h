@@ -2,6 +2,7 @@
 
 #include <furi.h>
 #include "filesystem_api_internal.h"
+#include "storage_dir_cache.h"
 #include <m-list.h>
 
 #ifdef __cplusplus
@@ -20,6 +21,7 @@ typedef struct {
     File* file;
     void* file_data;
     FuriString* path;
+    bool write; /**< file is open for writing, so its directory changes */
 } StorageFile;
 
 typedef enum {
@@ -57,6 +59,7 @@ struct StorageData {
     StorageStatus status;
     StorageFileList_t files;
     uint32_t timestamp;
+    StorageDirCache* dir_cache;
 };
 
 bool storage_has_file(const File* file, StorageData* storage_data);
@@ -64,6 +67,7 @@ bool storage_path_already_open(FuriString* path, StorageData* storage_data);
 
 void storage_set_storage_file_data(const File* file, void* file_data, StorageData* storage);
 void* storage_get_storage_file_data(const File* file, StorageData* storage);
+StorageFile* storage_get_storage_file(const File* file, StorageData* storage);
 
 void storage_push_storage_file(File* file, FuriString* path, StorageData* storage);
 bool storage_pop_storage_file(File* file, StorageData* storage);
@@ -25,6 +25,9 @@ struct Storage {
     StorageData storage[STORAGE_COUNT];
     StorageSDGui sd_gui;
     FuriPubSub* pubsub;
+    // Internal storage is served separately, so it doesn't wait for SD card
+    FuriMessageQueue* int_message_queue;
+    FuriThread* int_thread;
 };
 
 #ifdef __cplusplus
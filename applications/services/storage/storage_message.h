@@ -17,15 +17,21 @@ typedef struct {
 typedef struct {
     File* file;
     void* buff;
-    uint16_t bytes_to_read;
+    size_t bytes_to_read;
 } SADataFRead;
 
 typedef struct {
     File* file;
     const void* buff;
-    uint16_t bytes_to_write;
+    size_t bytes_to_write;
 } SADataFWrite;
 
+typedef struct {
+    File* file;
+    const StorageIoVec* iov;
+    size_t iov_count;
+} SADataFIoVec;
+
 typedef struct {
     File* file;
     uint32_t offset;
@@ -37,6 +43,11 @@ typedef struct {
     uint64_t size;
 } SADataFExpand;
 
+typedef struct {
+    File* file;
+    uint32_t* sector;
+} SADataFSector;
+
 typedef struct {
     File* file;
     const char* path;
@@ -104,12 +115,24 @@ typedef struct {
     SDInfo* info;
 } SAInfo;
 
+typedef struct {
+    StorageIntInfo* info;
+} SAIntInfo;
+
+typedef struct {
+    uint32_t sector;
+    void* buffer;
+    uint32_t count;
+} SASectors;
+
 typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
     SADataFWrite fwrite;
+    SADataFIoVec fiovec;
     SADataFSeek fseek;
     SADataFExpand fexpand;
+    SADataFSector fsector;
 
     SADataDOpen dopen;
     SADataDRead dread;
@@ -127,12 +150,15 @@ typedef union {
     SADataRename rename;
 
     SAInfo sdinfo;
+    SASectors sdsectors;
+    SAIntInfo intinfo;
 } SAData;
 
 typedef union {
     bool bool_value;
     uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
@@ -142,6 +168,8 @@ typedef enum {
     StorageCommandFileClose,
     StorageCommandFileRead,
     StorageCommandFileWrite,
+    StorageCommandFileReadV,
+    StorageCommandFileWriteV,
     StorageCommandFileSeek,
     StorageCommandFileTell,
     StorageCommandFileTruncate,
@@ -167,13 +195,25 @@ typedef enum {
 
     StorageCommandFileExpand,
     StorageCommandCommonRename,
+    StorageCommandFileGetSector,
+    StorageCommandSDReadSectors,
+    StorageCommandSDWriteSectors,
+    StorageCommandIntInfo,
 } StorageCommand;
 
 typedef struct {
-    FuriApiLock lock;
+    SAData data;
+    SAReturn return_data;
+    StorageAsyncCallback callback;
+    void* context;
+} StorageAsyncRequest;
+
+typedef struct {
+    FuriApiLock lock; /* NULL for asynchronous requests */
     StorageCommand command;
     SAData* data;
     SAReturn* return_data;
+    StorageAsyncRequest* request; /* Completed and freed after processing, if no lock */
 } StorageMessage;
 
 #ifdef __cplusplus
@@ -1,6 +1,7 @@
 #include "storage_processing.h"
 #include <m-list.h>
 #include <m-dict.h>
+#include <toolbox/path.h>
 
 #define STORAGE_PATH_PREFIX_LEN 4u
 _Static_assert(
@@ -23,16 +24,18 @@ static bool storage_type_is_valid(StorageType type) {
 #endif
 }
 
-static StorageData* get_storage_by_file(File* file, StorageData* storages) {
-    StorageData* storage_data = NULL;
-
-    for(uint8_t i = 0; i < STORAGE_COUNT; i++) {
-        if(storage_has_file(file, &storages[i])) {
-            storage_data = &storages[i];
-        }
+/** Get storage served by the current worker thread, see storage_get_message_queue() */
+static StorageType storage_get_worker_type(Storage* app) {
+    if(app->int_thread && furi_thread_get_current_id() == furi_thread_get_id(app->int_thread)) {
+        return ST_INT;
     }
+    return ST_EXT;
+}
 
-    return storage_data;
+static StorageData* get_storage_by_file(Storage* app, File* file) {
+    // Files of the other worker are never looked at, its list can change meanwhile
+    StorageData* storage_data = &app->storage[storage_get_worker_type(app)];
+    return storage_has_file(file, storage_data) ? storage_data : NULL;
 }
 
 static const char* cstr_path_without_vfs_prefix(FuriString* path) {
@@ -81,15 +84,16 @@ FS_Error storage_get_data(Storage* app, FuriString* path, StorageData** storage)
     StorageType type = storage_get_type_by_path(path);
 
     if(storage_type_is_valid(type)) {
+        // Request is routed by SD card status to the worker it resolves to
         if(type == ST_ANY) {
-            type = ST_INT;
-            if(storage_data_status(&app->storage[ST_EXT]) == StorageStatusOK) {
-                type = ST_EXT;
-            }
+            type = storage_get_worker_type(app);
             storage_path_change_to_real_storage(path, type);
         }
 
         furi_assert(type == ST_EXT || type == ST_INT);
+        if(type != storage_get_worker_type(app)) {
+            return FSE_INTERNAL;
+        }
         *storage = &app->storage[type];
 
         return FSE_OK;
@@ -104,6 +108,22 @@ static void storage_path_trim_trailing_slashes(FuriString* path) {
     }
 }
 
+/** Drop cached listings affected by a change of a path and notify about its directory */
+static void storage_process_dir_changed(Storage* app, StorageData* storage, FuriString* path) {
+    storage_dir_cache_invalidate(storage->dir_cache, path);
+
+    FuriString* dir_path = furi_string_alloc();
+    path_extract_dirname(furi_string_get_cstr(path), dir_path);
+
+    StorageEvent event = {
+        .type = StorageEventTypeDirChange,
+        .path = furi_string_get_cstr(dir_path),
+    };
+    furi_pubsub_publish_topic(app->pubsub, FURI_PUBSUB_TOPIC(event.type), &event);
+
+    furi_string_free(dir_path);
+}
+
 /******************* File Functions *******************/
 
 bool storage_process_file_open(
@@ -127,6 +147,11 @@ bool storage_process_file_open(
 
             const char* path_cstr_no_vfs = cstr_path_without_vfs_prefix(path);
             FS_CALL(storage, file.open(storage, file, path_cstr_no_vfs, access_mode, open_mode));
+
+            if(ret && (access_mode & FSAM_WRITE)) {
+                storage_get_storage_file(file, storage)->write = true;
+                storage_process_dir_changed(app, storage, path);
+            }
         }
     }
 
@@ -135,25 +160,31 @@ bool storage_process_file_open(
 
 bool storage_process_file_close(Storage* app, File* file) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
         FS_CALL(storage, file.close(storage, file));
+
+        // Size and timestamp of written file are only updated on close
+        StorageFile* storage_file = storage_get_storage_file(file, storage);
+        if(storage_file->write) {
+            storage_process_dir_changed(app, storage, storage_file->path);
+        }
         storage_pop_storage_file(file, storage);
 
         StorageEvent event = {.type = StorageEventTypeFileClose};
-        furi_pubsub_publish(app->pubsub, &event);
+        furi_pubsub_publish_topic(app->pubsub, FURI_PUBSUB_TOPIC(event.type), &event);
     }
 
     return ret;
 }
 
-static uint16_t
-    storage_process_file_read(Storage* app, File* file, void* buff, uint16_t const bytes_to_read) {
-    uint16_t ret = 0;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+static size_t
+    storage_process_file_read(Storage* app, File* file, void* buff, size_t const bytes_to_read) {
+    size_t ret = 0;
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -164,13 +195,13 @@ static uint16_t
     return ret;
 }
 
-static uint16_t storage_process_file_write(
+static size_t storage_process_file_write(
     Storage* app,
     File* file,
     const void* buff,
-    uint16_t const bytes_to_write) {
-    uint16_t ret = 0;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    size_t const bytes_to_write) {
+    size_t ret = 0;
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -182,13 +213,34 @@ static uint16_t storage_process_file_write(
     return ret;
 }
 
+static size_t storage_process_file_iovec(
+    Storage* app,
+    File* file,
+    const StorageIoVec* iov,
+    size_t iov_count,
+    bool write) {
+    size_t total = 0;
+
+    for(size_t i = 0; i < iov_count; i++) {
+        size_t done = write ? storage_process_file_write(app, file, iov[i].buff, iov[i].size) :
+                              storage_process_file_read(app, file, iov[i].buff, iov[i].size);
+        total += done;
+
+        if(file->error_id != FSE_OK || done != iov[i].size) {
+            break;
+        }
+    }
+
+    return total;
+}
+
 static bool storage_process_file_seek(
     Storage* app,
     File* file,
     const uint32_t offset,
     const bool from_start) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -201,7 +253,7 @@ static bool storage_process_file_seek(
 
 static uint64_t storage_process_file_tell(Storage* app, File* file) {
     uint64_t ret = 0;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -214,7 +266,7 @@ static uint64_t storage_process_file_tell(Storage* app, File* file) {
 
 static bool storage_process_file_expand(Storage* app, File* file, const uint64_t size) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -225,9 +277,24 @@ static bool storage_process_file_expand(Storage* app, File* file, const uint64_t
     return ret;
 }
 
+static bool storage_process_file_get_sector(Storage* app, File* file, uint32_t* sector) {
+    bool ret = false;
+    StorageData* storage = get_storage_by_file(app, file);
+
+    if(storage == NULL) {
+        file->error_id = FSE_INVALID_PARAMETER;
+    } else if(storage->fs_api->file.get_sector == NULL) {
+        file->error_id = FSE_NOT_IMPLEMENTED;
+    } else {
+        FS_CALL(storage, file.get_sector(storage, file, sector));
+    }
+
+    return ret;
+}
+
 static bool storage_process_file_truncate(Storage* app, File* file) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -241,7 +308,7 @@ static bool storage_process_file_truncate(Storage* app, File* file) {
 
 static bool storage_process_file_sync(Storage* app, File* file) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -255,7 +322,7 @@ static bool storage_process_file_sync(Storage* app, File* file) {
 
 static uint64_t storage_process_file_size(Storage* app, File* file) {
     uint64_t ret = 0;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -268,7 +335,7 @@ static uint64_t storage_process_file_size(Storage* app, File* file) {
 
 static bool storage_process_file_eof(Storage* app, File* file) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
@@ -292,6 +359,10 @@ bool storage_process_dir_open(Storage* app, File* file, FuriString* path) {
         } else {
             storage_push_storage_file(file, path, storage);
             FS_CALL(storage, dir.open(storage, file, cstr_path_without_vfs_prefix(path)));
+
+            if(ret) {
+                storage_dir_cache_open(storage->dir_cache, file, path);
+            }
         }
     }
 
@@ -300,16 +371,17 @@ bool storage_process_dir_open(Storage* app, File* file, FuriString* path) {
 
 bool storage_process_dir_close(Storage* app, File* file) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
         FS_CALL(storage, dir.close(storage, file));
+        storage_dir_cache_close(storage->dir_cache, file);
         storage_pop_storage_file(file, storage);
 
         StorageEvent event = {.type = StorageEventTypeDirClose};
-        furi_pubsub_publish(app->pubsub, &event);
+        furi_pubsub_publish_topic(app->pubsub, FURI_PUBSUB_TOPIC(event.type), &event);
     }
 
     return ret;
@@ -322,10 +394,30 @@ bool storage_process_dir_read(
     char* name,
     const uint16_t name_length) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
+    } else if(storage_dir_cache_read(storage->dir_cache, file, fileinfo, name, name_length)) {
+        ret = (file->error_id == FSE_OK);
+    } else if(storage_dir_cache_is_recording(storage->dir_cache, file)) {
+        // Entry is recorded in full, then given out as requested
+        FileInfo entry_info = {0};
+        char* entry_name = malloc(STORAGE_DIR_CACHE_NAME_SIZE);
+
+        FS_CALL(
+            storage,
+            dir.read(storage, file, &entry_info, entry_name, STORAGE_DIR_CACHE_NAME_SIZE));
+        storage_dir_cache_record(storage->dir_cache, file, &entry_info, entry_name);
+
+        if(fileinfo != NULL) {
+            *fileinfo = entry_info;
+        }
+        if(name != NULL) {
+            snprintf(name, name_length, "%s", entry_name);
+        }
+
+        free(entry_name);
     } else {
         FS_CALL(storage, dir.read(storage, file, fileinfo, name, name_length));
     }
@@ -335,12 +427,13 @@ bool storage_process_dir_read(
 
 bool storage_process_dir_rewind(Storage* app, File* file) {
     bool ret = false;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+    StorageData* storage = get_storage_by_file(app, file);
 
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
     } else {
         FS_CALL(storage, dir.rewind(storage, file));
+        storage_dir_cache_rewind(storage->dir_cache, file);
     }
 
     return ret;
@@ -364,7 +457,7 @@ static FS_Error storage_process_common_stat(Storage* app, FuriString* path, File
     StorageData* storage;
     FS_Error ret = storage_get_data(app, path, &storage);
 
-    if(ret == FSE_OK) {
+    if(ret == FSE_OK && !storage_dir_cache_stat(storage->dir_cache, path, fileinfo)) {
         FS_CALL(storage, common.stat(storage, cstr_path_without_vfs_prefix(path), fileinfo));
     }
 
@@ -385,6 +478,10 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
 
         storage_data_timestamp(storage);
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
+
+        if(ret == FSE_OK) {
+            storage_process_dir_changed(app, storage, path);
+        }
     } while(false);
 
     return ret;
@@ -419,6 +516,11 @@ static FS_Error storage_process_common_rename(Storage* app, FuriString* old, Fur
             storage,
             common.rename(
                 storage, cstr_path_without_vfs_prefix(old), cstr_path_without_vfs_prefix(new)));
+
+        if(ret == FSE_OK) {
+            storage_process_dir_changed(app, storage, old);
+            storage_process_dir_changed(app, storage, new);
+        }
     } while(false);
 
     return ret;
@@ -431,6 +533,10 @@ static FS_Error storage_process_common_mkdir(Storage* app, FuriString* path) {
     if(ret == FSE_OK) {
         storage_data_timestamp(storage);
         FS_CALL(storage, common.mkdir(storage, cstr_path_without_vfs_prefix(path)));
+
+        if(ret == FSE_OK) {
+            storage_process_dir_changed(app, storage, path);
+        }
     }
 
     return ret;
@@ -481,6 +587,7 @@ static bool
 /****************** Raw SD API ******************/
 // TODO FL-3521: think about implementing a custom storage API to split that kind of api linkage
 #include "storages/storage_ext.h"
+#include "storages/storage_int.h"
 
 static FS_Error storage_process_sd_format(Storage* app) {
     FS_Error ret = FSE_OK;
@@ -490,6 +597,7 @@ static FS_Error storage_process_sd_format(Storage* app) {
     } else {
         ret = sd_format_card(&app->storage[ST_EXT]);
         storage_data_timestamp(&app->storage[ST_EXT]);
+        storage_dir_cache_reset(app->storage[ST_EXT].dir_cache);
     }
 
     return ret;
@@ -512,6 +620,7 @@ static FS_Error storage_process_sd_unmount(Storage* app) {
 
         sd_unmount_card(storage);
         storage_data_timestamp(storage);
+        storage_dir_cache_reset(app->storage[ST_EXT].dir_cache);
     } while(false);
 
     return ret;
@@ -529,6 +638,7 @@ static FS_Error storage_process_sd_mount(Storage* app) {
 
         ret = sd_mount_card(storage, true);
         storage_data_timestamp(storage);
+        storage_dir_cache_reset(app->storage[ST_EXT].dir_cache);
     } while(false);
 
     return ret;
@@ -546,6 +656,34 @@ static FS_Error storage_process_sd_info(Storage* app, SDInfo* info) {
     return ret;
 }
 
+static FS_Error storage_process_int_info(Storage* app, StorageIntInfo* info) {
+    FS_Error ret = FSE_OK;
+
+    if(storage_data_status(&app->storage[ST_INT]) != StorageStatusOK) {
+        ret = FSE_NOT_READY;
+    } else {
+        ret = storage_int_get_info(&app->storage[ST_INT], info);
+    }
+
+    return ret;
+}
+
+static FS_Error storage_process_sd_sectors(Storage* app, SASectors* sectors, bool write) {
+    FS_Error ret = FSE_OK;
+
+    if(storage_data_status(&app->storage[ST_EXT]) != StorageStatusOK) {
+        ret = FSE_NOT_READY;
+    } else if(write) {
+        ret = sd_card_write_sectors(
+            &app->storage[ST_EXT], sectors->sector, sectors->buffer, sectors->count);
+    } else {
+        ret = sd_card_read_sectors(
+            &app->storage[ST_EXT], sectors->sector, sectors->buffer, sectors->count);
+    }
+
+    return ret;
+}
+
 static FS_Error storage_process_sd_status(Storage* app) {
     FS_Error ret;
     StorageStatus status = storage_data_status(&app->storage[ST_EXT]);
@@ -618,6 +756,21 @@ void storage_process_alias(
 
 /****************** API calls processing ******************/
 
+static void storage_process_async_complete(StorageMessage* message) {
+    StorageAsyncRequest* request = message->request;
+    furi_assert(request);
+
+    // Only file reads and writes are asynchronous
+    File* file = (message->command == StorageCommandFileRead) ? request->data.fread.file :
+                                                                request->data.fwrite.file;
+
+    if(request->callback) {
+        request->callback(request->context, request->return_data.size_value, file->error_id);
+    }
+
+    free(request);
+}
+
 void storage_process_message_internal(Storage* app, StorageMessage* message) {
     FuriString* path = NULL;
 
@@ -638,19 +791,28 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
             storage_process_file_close(app, message->data->fopen.file);
         break;
     case StorageCommandFileRead:
-        message->return_data->uint16_value = storage_process_file_read(
+        message->return_data->size_value = storage_process_file_read(
             app,
             message->data->fread.file,
             message->data->fread.buff,
             message->data->fread.bytes_to_read);
         break;
     case StorageCommandFileWrite:
-        message->return_data->uint16_value = storage_process_file_write(
+        message->return_data->size_value = storage_process_file_write(
             app,
             message->data->fwrite.file,
             message->data->fwrite.buff,
             message->data->fwrite.bytes_to_write);
         break;
+    case StorageCommandFileReadV:
+    case StorageCommandFileWriteV:
+        message->return_data->size_value = storage_process_file_iovec(
+            app,
+            message->data->fiovec.file,
+            message->data->fiovec.iov,
+            message->data->fiovec.iov_count,
+            message->command == StorageCommandFileWriteV);
+        break;
     case StorageCommandFileSeek:
         message->return_data->bool_value = storage_process_file_seek(
             app,
@@ -666,6 +828,10 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->bool_value = storage_process_file_expand(
             app, message->data->fexpand.file, message->data->fexpand.size);
         break;
+    case StorageCommandFileGetSector:
+        message->return_data->bool_value = storage_process_file_get_sector(
+            app, message->data->fsector.file, message->data->fsector.sector);
+        break;
     case StorageCommandFileTruncate:
         message->return_data->bool_value =
             storage_process_file_truncate(app, message->data->file.file);
@@ -784,13 +950,30 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
     case StorageCommandSDStatus:
         message->return_data->error_value = storage_process_sd_status(app);
         break;
+    case StorageCommandSDReadSectors:
+    case StorageCommandSDWriteSectors:
+        message->return_data->error_value = storage_process_sd_sectors(
+            app,
+            &message->data->sdsectors,
+            message->command == StorageCommandSDWriteSectors);
+        break;
+
+    // Internal storage operations
+    case StorageCommandIntInfo:
+        message->return_data->error_value =
+            storage_process_int_info(app, message->data->intinfo.info);
+        break;
     }
 
     if(path != NULL) { //-V547
         furi_string_free(path);
     }
 
-    api_lock_unlock(message->lock);
+    if(message->lock) {
+        api_lock_unlock(message->lock);
+    } else {
+        storage_process_async_complete(message);
+    }
 }
 
 void storage_process_message(Storage* app, StorageMessage* message) {
@@ -101,6 +101,8 @@ FS_Error sd_unmount_card(StorageData* storage) {
     error = FR_DISK_ERR;
 
     // TODO FL-3522: do i need to close the files?
+    // Write back cached sectors, unmounting doesn't sync the drive
+    disk_ioctl(sd_data->fs->drv, CTRL_SYNC, NULL);
     f_mount(0, sd_data->path, 0);
 
     return storage_ext_parse_error(error);
@@ -242,6 +244,23 @@ FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info) {
     return storage_ext_parse_error(error);
 }
 
+FS_Error
+    sd_card_read_sectors(StorageData* storage, uint32_t sector, void* buffer, uint32_t count) {
+    UNUSED(storage);
+    FuriStatus status = furi_hal_sd_read_blocks(buffer, sector, count);
+    return status == FuriStatusOk ? FSE_OK : FSE_INTERNAL;
+}
+
+FS_Error sd_card_write_sectors(
+    StorageData* storage,
+    uint32_t sector,
+    const void* buffer,
+    uint32_t count) {
+    UNUSED(storage);
+    FuriStatus status = furi_hal_sd_write_blocks(buffer, sector, count);
+    return status == FuriStatusOk ? FSE_OK : FSE_INTERNAL;
+}
+
 static void storage_ext_tick_internal(StorageData* storage, bool notify) {
     SDData* sd_data = storage->data;
 
@@ -350,19 +369,19 @@ static bool storage_ext_file_close(void* ctx, File* file) {
     return (file->error_id == FSE_OK);
 }
 
-static uint16_t
-    storage_ext_file_read(void* ctx, File* file, void* buff, uint16_t const bytes_to_read) {
+static size_t
+    storage_ext_file_read(void* ctx, File* file, void* buff, size_t const bytes_to_read) {
     StorageData* storage = ctx;
     SDFile* file_data = storage_get_storage_file_data(file, storage);
-    uint16_t bytes_read = 0;
+    UINT bytes_read = 0;
     file->internal_error_id = f_read(file_data, buff, bytes_to_read, &bytes_read);
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return bytes_read;
 }
 
-static uint16_t
-    storage_ext_file_write(void* ctx, File* file, const void* buff, uint16_t const bytes_to_write) {
-    uint16_t bytes_written = 0;
+static size_t
+    storage_ext_file_write(void* ctx, File* file, const void* buff, size_t const bytes_to_write) {
+    UINT bytes_written = 0;
 #ifdef FURI_RAM_EXEC
     UNUSED(ctx);
     UNUSED(file);
@@ -421,6 +440,47 @@ static bool storage_ext_file_expand(void* ctx, File* file, const uint64_t size)
     return (file->error_id == FSE_OK);
 }
 
+static bool storage_ext_file_get_sector(void* ctx, File* file, uint32_t* sector) {
+#ifdef FURI_RAM_EXEC
+    UNUSED(ctx);
+    UNUSED(file);
+    UNUSED(sector);
+    file->error_id = FSE_NOT_READY;
+#else
+    StorageData* storage = ctx;
+    SDFile* file_data = storage_get_storage_file_data(file, storage);
+
+    // Link map of contiguous file: map size, one fragment length and start, terminator
+    DWORD link_map[4] = {COUNT_OF(link_map)};
+
+    // Buffered sector must reach the card before it is accessed directly
+    file->internal_error_id = f_sync(file_data);
+    if(file->internal_error_id == FR_OK) {
+        file_data->cltbl = link_map;
+        file->internal_error_id = f_lseek(file_data, CREATE_LINKMAP);
+        // Fast seek mode can't grow the file, so it is left off
+        file_data->cltbl = NULL;
+    }
+
+    if(file->internal_error_id == FR_NOT_ENOUGH_CORE) {
+        // More than one fragment
+        file->error_id = FSE_DENIED;
+    } else {
+        file->error_id = storage_ext_parse_error(file->internal_error_id);
+        if(file->error_id == FSE_OK && link_map[1] == 0) {
+            // No clusters allocated
+            file->error_id = FSE_DENIED;
+        }
+    }
+
+    if(file->error_id == FSE_OK) {
+        FATFS* fs = file_data->obj.fs;
+        *sector = (link_map[2] - 2) * fs->csize + fs->database;
+    }
+#endif
+    return (file->error_id == FSE_OK);
+}
+
 static bool storage_ext_file_truncate(void* ctx, File* file) {
 #ifdef FURI_RAM_EXEC
     UNUSED(ctx);
@@ -645,6 +705,7 @@ static const FS_Api fs_api = {
             .seek = storage_ext_file_seek,
             .tell = storage_ext_file_tell,
             .expand = storage_ext_file_expand,
+            .get_sector = storage_ext_file_get_sector,
             .truncate = storage_ext_file_truncate,
             .size = storage_ext_file_size,
             .sync = storage_ext_file_sync,
@@ -12,6 +12,12 @@ FS_Error sd_mount_card(StorageData* storage, bool notify);
 FS_Error sd_unmount_card(StorageData* storage);
 FS_Error sd_format_card(StorageData* storage);
 FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info);
+FS_Error sd_card_read_sectors(StorageData* storage, uint32_t sector, void* buffer, uint32_t count);
+FS_Error sd_card_write_sectors(
+    StorageData* storage,
+    uint32_t sector,
+    const void* buffer,
+    uint32_t count);
 #ifdef __cplusplus
 }
 #endif
@@ -11,11 +11,22 @@
  * modification of non-dot files is restricted */
 #define LFS_RESERVED_PAGES_COUNT 3
 
+/* Cache and lookahead get 1/LFS_HEAP_BUDGET_DIVIDER of free heap at boot each,
+ * keep in mind that every open file takes its own cache_size buffer too */
+#define LFS_HEAP_BUDGET_DIVIDER 1024
+#define LFS_CACHE_SIZE_MIN 16
+#define LFS_CACHE_SIZE_MAX 128
+#define LFS_LOOKAHEAD_SIZE_MIN 16
+
 typedef struct {
     const size_t start_address;
     const size_t start_page;
     struct lfs_config config;
     lfs_t lfs;
+
+    uint32_t device_reads;
+    uint32_t device_read_bytes;
+    uint32_t file_read_bytes;
 } LFSData;
 
 typedef struct {
@@ -84,6 +95,10 @@ static int storage_int_device_read(
         size,
         (void*)address);
 
+    // Everything that got here missed littlefs caches
+    lfs_data->device_reads++;
+    lfs_data->device_read_bytes += size;
+
     memcpy(buffer, (void*)address, size);
 
     return 0;
@@ -124,6 +139,10 @@ static int storage_int_device_erase(const struct lfs_config* c, lfs_block_t bloc
 
     FURI_LOG_D(TAG, "Device erase: page %lu, translated page: %zx", block, page);
 
+    // Blocks are erased right after allocation, so next mount continues from here
+    furi_hal_rtc_set_register(
+        FuriHalRtcRegisterLfsAllocHint, (block + 1) % lfs_data->config.block_count);
+
     furi_hal_flash_erase(page);
     return 0;
 }
@@ -134,8 +153,27 @@ static int storage_int_device_sync(const struct lfs_config* c) {
     return 0;
 }
 
+static lfs_size_t storage_int_cache_size(size_t budget) {
+    // Must divide page size and be multiple of read and write sizes, powers of 2 do
+    lfs_size_t cache_size = LFS_CACHE_SIZE_MIN;
+    while(cache_size < LFS_CACHE_SIZE_MAX && cache_size * 2 <= budget) {
+        cache_size *= 2;
+    }
+    return cache_size;
+}
+
+static lfs_size_t storage_int_lookahead_size(size_t budget, lfs_size_t block_count) {
+    // One bit per block, with all blocks covered free blocks are found in one pass
+    lfs_size_t lookahead_size = lfs_alignup((block_count + 7) / 8, 8);
+    lfs_size_t lookahead_max = lfs_aligndown(MAX(budget, LFS_LOOKAHEAD_SIZE_MIN), 8);
+    return CLAMP(lookahead_size, lookahead_max, LFS_LOOKAHEAD_SIZE_MIN);
+}
+
 static LFSData* storage_int_lfs_data_alloc() {
     LFSData* lfs_data = malloc(sizeof(LFSData));
+    lfs_data->device_reads = 0;
+    lfs_data->device_read_bytes = 0;
+    lfs_data->file_read_bytes = 0;
 
     // Internal storage start address
     *(size_t*)(&lfs_data->start_address) = furi_hal_flash_get_free_page_start_address();
@@ -156,8 +194,11 @@ static LFSData* storage_int_lfs_data_alloc() {
     lfs_data->config.block_size = furi_hal_flash_get_page_size();
     lfs_data->config.block_count = furi_hal_flash_get_free_page_count();
     lfs_data->config.block_cycles = furi_hal_flash_get_cycles_count();
-    lfs_data->config.cache_size = 16;
-    lfs_data->config.lookahead_size = 16;
+
+    size_t budget = memmgr_get_free_heap() / LFS_HEAP_BUDGET_DIVIDER;
+    lfs_data->config.cache_size = storage_int_cache_size(budget);
+    lfs_data->config.lookahead_size =
+        storage_int_lookahead_size(budget, lfs_data->config.block_count);
 
     return lfs_data;
 }
@@ -235,6 +276,14 @@ static void storage_int_lfs_mount(LFSData* lfs_data, StorageData* storage) {
             }
         }
     }
+
+    if(storage->status == StorageStatusOK) {
+        // Mount starts allocation from random block, continue from the last one instead
+        uint32_t alloc_hint = furi_hal_rtc_get_register(FuriHalRtcRegisterLfsAllocHint);
+        if(alloc_hint < lfs_data->config.block_count) {
+            lfs->free.off = alloc_hint;
+        }
+    }
 }
 
 /****************** Common Functions ******************/
@@ -363,13 +412,13 @@ static bool storage_int_file_close(void* ctx, File* file) {
     return (file->error_id == FSE_OK);
 }
 
-static uint16_t
-    storage_int_file_read(void* ctx, File* file, void* buff, uint16_t const bytes_to_read) {
+static size_t
+    storage_int_file_read(void* ctx, File* file, void* buff, size_t const bytes_to_read) {
     StorageData* storage = ctx;
     lfs_t* lfs = lfs_get_from_storage(storage);
     LFSHandle* handle = storage_get_storage_file_data(file, storage);
 
-    uint16_t bytes_read = 0;
+    size_t bytes_read = 0;
 
     if(lfs_handle_is_open(handle)) {
         file->internal_error_id =
@@ -383,17 +432,18 @@ static uint16_t
     if(file->error_id == FSE_OK) {
         bytes_read = file->internal_error_id;
         file->internal_error_id = 0;
+        lfs_data_get_from_storage(storage)->file_read_bytes += bytes_read;
     }
     return bytes_read;
 }
 
-static uint16_t
-    storage_int_file_write(void* ctx, File* file, const void* buff, uint16_t const bytes_to_write) {
+static size_t
+    storage_int_file_write(void* ctx, File* file, const void* buff, size_t const bytes_to_write) {
     StorageData* storage = ctx;
     lfs_t* lfs = lfs_get_from_storage(storage);
     LFSHandle* handle = storage_get_storage_file_data(file, storage);
 
-    uint16_t bytes_written = 0;
+    size_t bytes_written = 0;
 
     if(lfs_handle_is_open(handle)) {
         file->internal_error_id =
@@ -752,9 +802,27 @@ void storage_int_init(StorageData* storage) {
         lfs_data->config.block_count,
         lfs_data->config.block_cycles);
 
+    FURI_LOG_I(
+        TAG,
+        "Cache %lu, lookahead %lu",
+        lfs_data->config.cache_size,
+        lfs_data->config.lookahead_size);
+
     storage_int_lfs_mount(lfs_data, storage);
 
     storage->data = lfs_data;
     storage->api.tick = NULL;
     storage->fs_api = &fs_api;
 }
+
+FS_Error storage_int_get_info(StorageData* storage, StorageIntInfo* info) {
+    LFSData* lfs_data = lfs_data_get_from_storage(storage);
+
+    info->cache_size = lfs_data->config.cache_size;
+    info->lookahead_size = lfs_data->config.lookahead_size;
+    info->device_reads = lfs_data->device_reads;
+    info->device_read_bytes = lfs_data->device_read_bytes;
+    info->file_read_bytes = lfs_data->file_read_bytes;
+
+    return FSE_OK;
+}
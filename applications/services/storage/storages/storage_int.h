@@ -1,6 +1,7 @@
 #pragma once
 #include <furi.h>
 #include "../storage_glue.h"
+#include "../storage.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -8,6 +9,8 @@ extern "C" {
 
 void storage_int_init(StorageData* storage);
 
+FS_Error storage_int_get_info(StorageData* storage, StorageIntInfo* info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,6 +9,8 @@
 #include <update_util/lfs_backup.h>
 #include <update_util/update_operation.h>
 
+#define TAG "UpdTask"
+
 static const char* update_task_stage_descr[] = {
     [UpdateTaskStageProgress] = "...",
     [UpdateTaskStageReadManifest] = "Loading update manifest",
@@ -179,7 +181,7 @@ static const struct {
         .stage = UpdateTaskStageFlashWrite,
         .percent_min = 0,
         .percent_max = 100,
-        .descr = "Flash write error",
+        .descr = "Flash write or compare error",
     },
     {
         .stage = UpdateTaskStageFlashValidate,
@@ -238,8 +240,9 @@ static const UpdateTaskStageGroupMap update_task_stage_progress[] = {
     [UpdateTaskStageOBValidation] = STAGE_DEF(UpdateTaskStageGroupOptionBytes, 2),
 
     [UpdateTaskStageValidateDFUImage] = STAGE_DEF(UpdateTaskStageGroupFirmware, 30),
-    [UpdateTaskStageFlashWrite] = STAGE_DEF(UpdateTaskStageGroupFirmware, 150),
-    [UpdateTaskStageFlashValidate] = STAGE_DEF(UpdateTaskStageGroupFirmware, 15),
+    /* Validation is done while writing */
+    [UpdateTaskStageFlashWrite] = STAGE_DEF(UpdateTaskStageGroupFirmware, 165),
+    [UpdateTaskStageFlashValidate] = STAGE_DEF(UpdateTaskStageGroupFirmware, 0),
 
     [UpdateTaskStageLfsRestore] = STAGE_DEF(UpdateTaskStageGroupPostUpdate, 5),
 
@@ -304,6 +307,17 @@ void update_task_set_progress(UpdateTask* update_task, UpdateTaskStage stage, ui
         } else {
             furi_string_set(update_task->state.status, update_task_stage_descr[stage]);
         }
+        /* Report how long previous stage took */
+        const uint32_t tick = furi_get_tick();
+        if((update_task->state.stage != UpdateTaskStageProgress) &&
+           (update_task->state.stage != stage)) {
+            FURI_LOG_I(
+                TAG,
+                "%s: %lu ms",
+                update_task_stage_descr[update_task->state.stage],
+                tick - update_task->stage_start_tick);
+        }
+        update_task->stage_start_tick = tick;
         /* Store stage update */
         update_task->state.stage = stage;
         /* If we are still alive, sum completed stages weights */
@@ -394,6 +408,7 @@ UpdateTask* update_task_alloc() {
     update_task->state.stage_progress = 0;
     update_task->state.overall_progress = 0;
     update_task->state.status = furi_string_alloc();
+    update_task->stage_start_tick = 0;
 
     update_task->manifest = update_manifest_alloc();
     update_task->storage = furi_record_open(RECORD_STORAGE);
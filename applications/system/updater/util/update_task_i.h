@@ -16,6 +16,7 @@ typedef struct UpdateTask {
     updateProgressCb status_change_cb;
     void* status_change_cb_state;
     FuriHalRtcBootMode boot_mode;
+    uint32_t stage_start_tick;
 } UpdateTask;
 
 void update_task_set_progress(UpdateTask* update_task, UpdateTaskStage stage, uint8_t progress);
@@ -12,9 +12,13 @@
 #include <update_util/resources/manifest.h>
 #include <toolbox/tar/tar_archive.h>
 #include <toolbox/crc32_calc.h>
+#include <m-array.h>
 
 #define XFWFIRSTBOOT_FLAG_PATH CFG_PATH("xfwfirstboot.flag")
 
+#define UPDATE_TASK_RESOURCES_MANIFEST_NAME "Manifest"
+#define UPDATE_TASK_RESOURCES_NEW_MANIFEST_NAME "Manifest.new"
+
 #define TAG "UpdWorkerBackup"
 
 static bool update_task_pre_update(UpdateTask* update_task) {
@@ -46,6 +50,86 @@ typedef enum {
 
 #define UPDATE_TASK_RESOURCES_FILE_TO_TOTAL_PERCENT 90
 
+/* Hashes of entry names in new resources, sorted */
+ARRAY_DEF(ResourceNameHashArray, uint32_t, M_POD_OPLIST)
+
+static uint32_t update_task_resource_name_hash(const char* name) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    while(*name) {
+        hash = (hash ^ (uint8_t)*name++) * 16777619UL;
+    }
+    return hash;
+}
+
+static int update_task_resource_name_hash_cmp(const void* a, const void* b) {
+    const uint32_t hash_a = *(const uint32_t*)a;
+    const uint32_t hash_b = *(const uint32_t*)b;
+    return (hash_a > hash_b) - (hash_a < hash_b);
+}
+
+static bool update_task_resource_is_kept(ResourceNameHashArray_t names, const char* name) {
+    const uint32_t hash = update_task_resource_name_hash(name);
+    const size_t count = ResourceNameHashArray_size(names);
+    if(!count) return false;
+    return bsearch(
+               &hash,
+               ResourceNameHashArray_cget(names, 0),
+               count,
+               sizeof(uint32_t),
+               update_task_resource_name_hash_cmp) != NULL;
+}
+
+/* Collects entries of the manifest from new resources, they are kept on cleanup and
+ * compared with the new data on unpacking, so unchanged files are not rewritten */
+static void update_task_load_new_resource_names(
+    UpdateTask* update_task,
+    TarArchive* archive,
+    ResourceNameHashArray_t names) {
+    FuriString* manifest_path = furi_string_alloc();
+    path_concat(
+        furi_string_get_cstr(update_task->update_path),
+        UPDATE_TASK_RESOURCES_NEW_MANIFEST_NAME,
+        manifest_path);
+    ResourceManifestReader* manifest_reader = resource_manifest_reader_alloc(update_task->storage);
+
+    do {
+        if(!tar_archive_unpack_file(
+               archive,
+               UPDATE_TASK_RESOURCES_MANIFEST_NAME,
+               furi_string_get_cstr(manifest_path))) {
+            FURI_LOG_W(TAG, "No manifest in resources");
+            break;
+        }
+        if(!resource_manifest_reader_open(manifest_reader, furi_string_get_cstr(manifest_path))) {
+            break;
+        }
+
+        ResourceManifestEntry* entry_ptr = NULL;
+        while((entry_ptr = resource_manifest_reader_next(manifest_reader))) {
+            if(entry_ptr->type == ResourceManifestEntryTypeFile ||
+               entry_ptr->type == ResourceManifestEntryTypeDirectory) {
+                ResourceNameHashArray_push_back(
+                    names, update_task_resource_name_hash(furi_string_get_cstr(entry_ptr->name)));
+            }
+        }
+    } while(false);
+
+    resource_manifest_reader_free(manifest_reader);
+    storage_common_remove(update_task->storage, furi_string_get_cstr(manifest_path));
+    furi_string_free(manifest_path);
+
+    const size_t count = ResourceNameHashArray_size(names);
+    if(count) {
+        qsort(
+            ResourceNameHashArray_get(names, 0),
+            count,
+            sizeof(uint32_t),
+            update_task_resource_name_hash_cmp);
+    }
+    FURI_LOG_I(TAG, "%zu entries in new manifest", count);
+}
+
 typedef struct {
     UpdateTask* update_task;
     int32_t total_files, processed_files;
@@ -66,7 +150,10 @@ static bool update_task_resource_unpack_cb(const char* name, bool is_directory,
     return true;
 }
 
-static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_t n_tar_entries) {
+static void update_task_cleanup_resources(
+    UpdateTask* update_task,
+    const uint32_t n_tar_entries,
+    ResourceNameHashArray_t kept_names) {
     ResourceManifestReader* manifest_reader = resource_manifest_reader_alloc(update_task->storage);
     do {
         FURI_LOG_D(TAG, "Cleaning up old manifest");
@@ -90,6 +177,11 @@ static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_
                     (n_processed_entries++ * UpdateTaskResourcesWeightsFileCleanup) /
                         n_approx_file_entries);
 
+                if(update_task_resource_is_kept(
+                       kept_names, furi_string_get_cstr(entry_ptr->name))) {
+                    continue;
+                }
+
                 FuriString* file_path = furi_string_alloc();
                 path_concat(
                     STORAGE_EXT_PATH_PREFIX, furi_string_get_cstr(entry_ptr->name), file_path);
@@ -121,6 +213,11 @@ static void update_task_cleanup_resources(UpdateTask* update_task, const uint32_
                         (n_processed_entries++ * UpdateTaskResourcesWeightsDirCleanup) /
                             n_dir_entries);
 
+                if(update_task_resource_is_kept(
+                       kept_names, furi_string_get_cstr(entry_ptr->name))) {
+                    continue;
+                }
+
                 FuriString* folder_path = furi_string_alloc();
 
                 do {
@@ -184,8 +281,14 @@ static bool update_task_post_update(UpdateTask* update_task) {
 
             progress.total_files = tar_archive_get_entries_count(archive);
             if(progress.total_files > 0) {
-                update_task_cleanup_resources(update_task, progress.total_files);
+                ResourceNameHashArray_t kept_names;
+                ResourceNameHashArray_init(kept_names);
+
+                update_task_load_new_resource_names(update_task, archive, kept_names);
+                update_task_cleanup_resources(update_task, progress.total_files, kept_names);
+                ResourceNameHashArray_clear(kept_names);
 
+                tar_archive_set_skip_unchanged(archive, true);
                 CHECK_RESULT(tar_archive_unpack_to(archive, STORAGE_EXT_PATH_PREFIX, NULL));
             }
         }
@@ -47,12 +47,13 @@ static bool check_address_boundaries(const size_t address) {
     return ((address >= min_allowed_address) && (address < max_allowed_address));
 }
 
+/* Page is verified right after programming, so image is read only once for both */
 static bool update_task_flash_program_page(
     const uint8_t i_page,
     const uint8_t* update_block,
     uint16_t update_block_len) {
     furi_hal_flash_program_page(i_page, update_block, update_block_len);
-    return true;
+    return page_task_compare_flash(i_page, update_block, update_block_len);
 }
 
 static bool update_task_write_dfu(UpdateTask* update_task) {
@@ -80,10 +81,6 @@ static bool update_task_write_dfu(UpdateTask* update_task) {
         update_task_set_progress(update_task, UpdateTaskStageFlashWrite, 0);
         CHECK_RESULT(dfu_file_process_targets(&page_task, update_task->file, valid_targets));
 
-        page_task.task_cb = &page_task_compare_flash;
-
-        update_task_set_progress(update_task, UpdateTaskStageFlashValidate, 0);
-        CHECK_RESULT(dfu_file_process_targets(&page_task, update_task->file, valid_targets));
         success = true;
     } while(false);
 
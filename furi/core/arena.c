@@ -0,0 +1,143 @@
+#include "arena.h"
+#include "check.h"
+#include "common_defines.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+/* Same alignment as heap blocks have */
+#define FURI_ARENA_ALIGNMENT 8U
+
+typedef struct FuriArenaChunk FuriArenaChunk;
+
+struct FuriArenaChunk {
+    FuriArenaChunk* next;
+    size_t size;
+    size_t used;
+    uint8_t data[];
+};
+
+struct FuriArena {
+    FuriArenaChunk* chunks;
+    size_t chunk_size;
+};
+
+static FuriArenaChunk* furi_arena_chunk_alloc(size_t size) {
+    // Extra space to align the first object
+    FuriArenaChunk* chunk = malloc(sizeof(FuriArenaChunk) + size + FURI_ARENA_ALIGNMENT - 1);
+    chunk->size = size;
+    return chunk;
+}
+
+static void* furi_arena_chunk_take(FuriArenaChunk* chunk, size_t size) {
+    uintptr_t start = (uintptr_t)chunk->data + chunk->used;
+    size_t padding = (FURI_ARENA_ALIGNMENT - start % FURI_ARENA_ALIGNMENT) % FURI_ARENA_ALIGNMENT;
+    if(chunk->used + padding + size > chunk->size + FURI_ARENA_ALIGNMENT - 1) return NULL;
+
+    chunk->used += padding + size;
+    return memset((void*)(start + padding), 0, size);
+}
+
+FuriArena* furi_arena_alloc(size_t chunk_size) {
+    furi_assert(chunk_size > 0);
+
+    FuriArena* arena = malloc(sizeof(FuriArena));
+    arena->chunk_size = chunk_size;
+
+    return arena;
+}
+
+void furi_arena_free(FuriArena* arena) {
+    furi_assert(arena);
+
+    while(arena->chunks) {
+        FuriArenaChunk* next = arena->chunks->next;
+        free(arena->chunks);
+        arena->chunks = next;
+    }
+
+    free(arena);
+}
+
+void* furi_arena_malloc(FuriArena* arena, size_t size) {
+    furi_assert(arena);
+
+    void* object = arena->chunks ? furi_arena_chunk_take(arena->chunks, size) : NULL;
+
+    if(!object) {
+        FuriArenaChunk* chunk = furi_arena_chunk_alloc(MAX(size, arena->chunk_size));
+        object = furi_arena_chunk_take(chunk, size);
+
+        if(arena->chunks && size > arena->chunk_size) {
+            // Keep filling the current chunk, the large object has its own
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        } else {
+            chunk->next = arena->chunks;
+            arena->chunks = chunk;
+        }
+    }
+
+    return object;
+}
+
+char* furi_arena_strdup(FuriArena* arena, const char* string) {
+    furi_assert(string);
+
+    size_t size = strlen(string) + 1;
+    char* copy = furi_arena_malloc(arena, size);
+    memcpy(copy, string, size);
+
+    return copy;
+}
+
+char* furi_arena_printf(FuriArena* arena, const char format[], ...) {
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    furi_check(length >= 0);
+
+    char* string = furi_arena_malloc(arena, length + 1);
+
+    va_start(args, format);
+    vsnprintf(string, length + 1, format, args);
+    va_end(args);
+
+    return string;
+}
+
+void furi_arena_reset(FuriArena* arena) {
+    furi_assert(arena);
+
+    FuriArenaChunk* kept = NULL;
+    while(arena->chunks) {
+        FuriArenaChunk* chunk = arena->chunks;
+        arena->chunks = chunk->next;
+
+        if(!kept && chunk->size == arena->chunk_size) {
+            kept = chunk;
+        } else {
+            free(chunk);
+        }
+    }
+
+    if(kept) {
+        kept->next = NULL;
+        kept->used = 0;
+    }
+    arena->chunks = kept;
+}
+
+size_t furi_arena_get_used(FuriArena* arena) {
+    furi_assert(arena);
+
+    size_t used = 0;
+    for(FuriArenaChunk* chunk = arena->chunks; chunk; chunk = chunk->next) {
+        used += chunk->used;
+    }
+
+    return used;
+}
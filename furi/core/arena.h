@@ -0,0 +1,90 @@
+/**
+ * @file arena.h
+ * Furi arena allocator.
+ *
+ * Objects with the same lifetime are bump allocated from chunks taken from
+ * the heap and released all at once. Allocation is a pointer increment, and
+ * no holes are left in the heap when objects are gone.
+ *
+ * ***NOTE***: Arena is not thread safe, use it from one thread or guard it
+ * externally.
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FuriArena FuriArena;
+
+/**
+ * @brief Allocate arena instance.
+ *
+ * Chunks are allocated on demand, nothing is taken from the heap here.
+ *
+ * @param chunk_size Size of a chunk in bytes. Larger objects get a chunk of
+ * their own.
+ * @return The arena instance.
+ */
+FuriArena* furi_arena_alloc(size_t chunk_size);
+
+/**
+ * @brief Free arena instance and all objects allocated from it.
+ *
+ * @param arena The arena instance.
+ */
+void furi_arena_free(FuriArena* arena);
+
+/**
+ * @brief Allocate zeroed object from the arena, same as malloc() crashes if
+ * there is not enough memory.
+ *
+ * @param arena The arena instance.
+ * @param size Object size in bytes.
+ * @return Pointer to the object, aligned same as malloc() does.
+ */
+void* furi_arena_malloc(FuriArena* arena, size_t size);
+
+/**
+ * @brief Copy string to the arena.
+ *
+ * @param arena The arena instance.
+ * @param string The string to copy.
+ * @return Pointer to the copy.
+ */
+char* furi_arena_strdup(FuriArena* arena, const char* string);
+
+/**
+ * @brief Format string to the arena.
+ *
+ * @param arena The arena instance.
+ * @param format The printf format string.
+ * @param ... The printf arguments.
+ * @return Pointer to the formatted string.
+ */
+char* furi_arena_printf(FuriArena* arena, const char format[], ...)
+    _ATTRIBUTE((__format__(__printf__, 2, 3)));
+
+/**
+ * @brief Release all objects allocated from the arena.
+ *
+ * One chunk is kept for the next allocations, others go back to the heap.
+ *
+ * @param arena The arena instance.
+ */
+void furi_arena_reset(FuriArena* arena);
+
+/**
+ * @brief Get number of bytes taken by the objects, alignment included.
+ *
+ * @param arena The arena instance.
+ * @return Used size in bytes.
+ */
+size_t furi_arena_get_used(FuriArena* arena);
+
+#ifdef __cplusplus
+}
+#endif
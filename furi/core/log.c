@@ -1,15 +1,56 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "semaphore.h"
+#include "thread.h"
 #include <furi_hal.h>
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+#define FURI_LOG_DEFERRED_RECORDS 64U
+#define FURI_LOG_DEFERRED_DATA_SIZE 44U
+#define FURI_LOG_DEFERRED_SPEC_SIZE 16U
+#define FURI_LOG_DEFERRED_STACK_SIZE 2048U
+
+/* Deferred record keeps arguments as they were passed, strings are copied */
+typedef struct {
+    volatile uint32_t sequence; // position while free, position + 1 once written
+    uint32_t timestamp;
+    const char* tag; // NULL for raw records
+    const char* format;
+    uint8_t level;
+    uint8_t size;
+    uint8_t data[FURI_LOG_DEFERRED_DATA_SIZE];
+} FuriLogRecord;
+
+/* Multi-producer single-consumer ring, producers race for the head with CAS */
+typedef struct {
+    FuriLogRecord records[FURI_LOG_DEFERRED_RECORDS];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+    // Set by consumer before going to sleep, cleared by whoever wakes it up
+    volatile bool consumer_waiting;
+    FuriSemaphore* wakeup;
+    FuriThread* thread;
+} FuriLogDeferred;
+
+typedef enum {
+    FuriLogArgNone,
+    FuriLogArgInt,
+    FuriLogArgLong,
+    FuriLogArgDouble,
+    FuriLogArgPointer,
+    FuriLogArgString,
+} FuriLogArg;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriLogPuts puts;
     FuriLogTimestamp timestamp;
     FuriMutex* mutex;
+    FuriLogDeferred* deferred;
+    volatile bool deferred_enabled;
 } FuriLogParams;
 
 static FuriLogParams furi_log;
@@ -37,38 +78,357 @@ void furi_log_init() {
     furi_log.mutex = furi_mutex_alloc(FuriMutexTypeNormal);
 }
 
+static const char* furi_log_get_color(FuriLogLevel level, const char** log_letter) {
+    const char* color = _FURI_LOG_CLR_RESET;
+    *log_letter = " ";
+    switch(level) {
+    case FuriLogLevelError:
+        color = _FURI_LOG_CLR_E;
+        *log_letter = "E";
+        break;
+    case FuriLogLevelWarn:
+        color = _FURI_LOG_CLR_W;
+        *log_letter = "W";
+        break;
+    case FuriLogLevelInfo:
+        color = _FURI_LOG_CLR_I;
+        *log_letter = "I";
+        break;
+    case FuriLogLevelDebug:
+        color = _FURI_LOG_CLR_D;
+        *log_letter = "D";
+        break;
+    case FuriLogLevelTrace:
+        color = _FURI_LOG_CLR_T;
+        *log_letter = "T";
+        break;
+    default:
+        break;
+    }
+    return color;
+}
+
+/* Parse printf conversion spec, format points past '%'. Returns pointer past the spec
+ * or NULL if it's not supported, arguments it takes are stored in order to args */
+static const char* furi_log_parse_spec(const char* format, FuriLogArg args[4]) {
+    size_t count = 0;
+
+    while(*format && strchr("-+ #0", *format)) format++;
+    if(*format == '*') {
+        args[count++] = FuriLogArgInt;
+        format++;
+    } else {
+        while(*format >= '0' && *format <= '9') format++;
+    }
+    if(*format == '.') {
+        format++;
+        if(*format == '*') {
+            args[count++] = FuriLogArgInt;
+            format++;
+        } else {
+            while(*format >= '0' && *format <= '9') format++;
+        }
+    }
+
+    size_t longs = 0;
+    bool wide = false;
+    while(*format && strchr("hlLqjzt", *format)) {
+        if(*format == 'l') longs++;
+        if(*format == 'q' || *format == 'j') longs = 2;
+        if((*format == 'z' || *format == 't') && sizeof(size_t) > sizeof(int)) wide = true;
+        format++;
+    }
+    wide = wide || (longs == 1 && sizeof(long) > sizeof(int)) || longs > 1;
+
+    switch(*format) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        args[count++] = wide ? FuriLogArgLong : FuriLogArgInt;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        args[count++] = FuriLogArgDouble;
+        break;
+    case 'p':
+        args[count++] = FuriLogArgPointer;
+        break;
+    case 's':
+        args[count++] = FuriLogArgString;
+        break;
+    default:
+        return NULL;
+    }
+
+    args[count] = FuriLogArgNone;
+    return format + 1;
+}
+
+static bool furi_log_deferred_store(FuriLogRecord* record, const void* value, size_t size) {
+    if(record->size + size > FURI_LOG_DEFERRED_DATA_SIZE) return false;
+    memcpy(&record->data[record->size], value, size);
+    record->size += size;
+    return true;
+}
+
+static void furi_log_deferred_capture(FuriLogRecord* record, const char* format, va_list args) {
+    record->size = 0;
+
+    while((format = strchr(format, '%'))) {
+        if(format[1] == '%') {
+            format += 2;
+            continue;
+        }
+
+        FuriLogArg spec[4];
+        format = furi_log_parse_spec(format + 1, spec);
+        if(!format) return;
+
+        for(FuriLogArg* arg = spec; *arg != FuriLogArgNone; arg++) {
+            bool stored = false;
+            if(*arg == FuriLogArgInt) {
+                int value = va_arg(args, int);
+                stored = furi_log_deferred_store(record, &value, sizeof(value));
+            } else if(*arg == FuriLogArgLong) {
+                long long value = va_arg(args, long long);
+                stored = furi_log_deferred_store(record, &value, sizeof(value));
+            } else if(*arg == FuriLogArgDouble) {
+                double value = va_arg(args, double);
+                stored = furi_log_deferred_store(record, &value, sizeof(value));
+            } else if(*arg == FuriLogArgPointer) {
+                void* value = va_arg(args, void*);
+                stored = furi_log_deferred_store(record, &value, sizeof(value));
+            } else {
+                // String may be gone by the time record is printed, keep as much as fits
+                const char* value = va_arg(args, const char*);
+                if(!value) value = "(null)";
+                size_t size = MIN(strlen(value), FURI_LOG_DEFERRED_DATA_SIZE - record->size);
+                if(size == FURI_LOG_DEFERRED_DATA_SIZE - record->size) {
+                    if(!size) return;
+                    size--;
+                }
+                memcpy(&record->data[record->size], value, size);
+                record->data[record->size + size] = '\0';
+                record->size += size + 1;
+                stored = true;
+            }
+            if(!stored) return;
+        }
+    }
+}
+
+static void furi_log_deferred_format(FuriString* string, const FuriLogRecord* record) {
+    const char* format = record->format;
+    size_t offset = 0;
+
+    while(*format) {
+        const char* spec_start = strchr(format, '%');
+        if(!spec_start) spec_start = format + strlen(format);
+        furi_string_cat_strn(string, format, spec_start - format);
+        format = spec_start;
+        if(!*format) break;
+
+        if(format[1] == '%') {
+            furi_string_push_back(string, '%');
+            format += 2;
+            continue;
+        }
+
+        FuriLogArg spec[4];
+        const char* spec_end = furi_log_parse_spec(format + 1, spec);
+        size_t spec_size = spec_end ? (size_t)(spec_end - format) : 0;
+        if(!spec_size || spec_size >= FURI_LOG_DEFERRED_SPEC_SIZE) break;
+
+        char spec_format[FURI_LOG_DEFERRED_SPEC_SIZE];
+        memcpy(spec_format, format, spec_size);
+        spec_format[spec_size] = '\0';
+
+        // Width and precision come first, value is the last one
+        int stars[2] = {0};
+        size_t star_count = 0;
+        FuriLogArg* arg = spec;
+        for(; arg[1] != FuriLogArgNone; arg++) {
+            if(offset + sizeof(int) > record->size) break;
+            memcpy(&stars[star_count++], &record->data[offset], sizeof(int));
+            offset += sizeof(int);
+        }
+        if(arg[1] != FuriLogArgNone) break;
+
+#define FURI_LOG_DEFERRED_CAT(value)                                                    \
+    (star_count == 2 ?                                                                  \
+         furi_string_cat_printf(string, spec_format, stars[0], stars[1], value) :       \
+     star_count == 1 ? furi_string_cat_printf(string, spec_format, stars[0], value) : \
+                       furi_string_cat_printf(string, spec_format, value))
+
+        if(*arg == FuriLogArgString) {
+            if(offset >= record->size) break;
+            const char* value = (const char*)&record->data[offset];
+            offset += strlen(value) + 1;
+            FURI_LOG_DEFERRED_CAT(value);
+        } else if(*arg == FuriLogArgInt) {
+            int value;
+            if(offset + sizeof(value) > record->size) break;
+            memcpy(&value, &record->data[offset], sizeof(value));
+            offset += sizeof(value);
+            FURI_LOG_DEFERRED_CAT(value);
+        } else if(*arg == FuriLogArgLong) {
+            long long value;
+            if(offset + sizeof(value) > record->size) break;
+            memcpy(&value, &record->data[offset], sizeof(value));
+            offset += sizeof(value);
+            FURI_LOG_DEFERRED_CAT(value);
+        } else if(*arg == FuriLogArgDouble) {
+            double value;
+            if(offset + sizeof(value) > record->size) break;
+            memcpy(&value, &record->data[offset], sizeof(value));
+            offset += sizeof(value);
+            FURI_LOG_DEFERRED_CAT(value);
+        } else {
+            void* value;
+            if(offset + sizeof(value) > record->size) break;
+            memcpy(&value, &record->data[offset], sizeof(value));
+            offset += sizeof(value);
+            FURI_LOG_DEFERRED_CAT(value);
+        }
+
+#undef FURI_LOG_DEFERRED_CAT
+
+        format = spec_end;
+    }
+
+    // Arguments that didn't fit into the record are left unformatted
+    if(*format) {
+        furi_string_cat_str(string, format);
+    }
+}
+
+static void furi_log_deferred_print(FuriLogDeferred* deferred, const FuriLogRecord* record) {
+    FuriString* string = furi_string_alloc();
+
+    if(record->tag) {
+        const char* log_letter;
+        const char* color = furi_log_get_color(record->level, &log_letter);
+        furi_string_printf(
+            string,
+            "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET,
+            record->timestamp,
+            color,
+            log_letter,
+            record->tag);
+    }
+    furi_log_deferred_format(string, record);
+    if(record->tag) {
+        furi_string_cat_str(string, "\r\n");
+    }
+
+    uint32_t dropped = __atomic_exchange_n(&deferred->dropped, 0, __ATOMIC_RELAXED);
+
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+    if(dropped) {
+        FuriString* message = furi_string_alloc_printf("%lu log records dropped\r\n", dropped);
+        furi_log.puts(furi_string_get_cstr(message));
+        furi_string_free(message);
+    }
+    furi_log.puts(furi_string_get_cstr(string));
+    furi_mutex_release(furi_log.mutex);
+
+    furi_string_free(string);
+}
+
+static int32_t furi_log_deferred_worker(void* context) {
+    FuriLogDeferred* deferred = context;
+
+    for(;;) {
+        uint32_t tail = deferred->tail;
+        FuriLogRecord* record = &deferred->records[tail % FURI_LOG_DEFERRED_RECORDS];
+
+        if(__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) != tail + 1) {
+            __atomic_store_n(&deferred->consumer_waiting, true, __ATOMIC_RELEASE);
+
+            // Producer may have written the record before it could see the flag
+            if(__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) != tail + 1) {
+                furi_semaphore_acquire(deferred->wakeup, FuriWaitForever);
+            }
+            deferred->consumer_waiting = false;
+            continue;
+        }
+
+        furi_log_deferred_print(deferred, record);
+
+        __atomic_store_n(&record->sequence, tail + FURI_LOG_DEFERRED_RECORDS, __ATOMIC_RELEASE);
+        __atomic_store_n(&deferred->tail, tail + 1, __ATOMIC_RELEASE);
+    }
+
+    return 0;
+}
+
+static void
+    furi_log_defer(FuriLogLevel level, const char* tag, const char* format, va_list args) {
+    FuriLogDeferred* deferred = furi_log.deferred;
+    FuriLogRecord* record;
+
+    uint32_t position = __atomic_load_n(&deferred->head, __ATOMIC_RELAXED);
+    for(;;) {
+        record = &deferred->records[position % FURI_LOG_DEFERRED_RECORDS];
+        int32_t diff =
+            (int32_t)(__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) - position);
+        if(diff == 0) {
+            if(__atomic_compare_exchange_n(
+                   &deferred->head,
+                   &position,
+                   position + 1,
+                   true,
+                   __ATOMIC_RELAXED,
+                   __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if(diff < 0) {
+            // Ring is full, consumer will report the loss
+            __atomic_add_fetch(&deferred->dropped, 1, __ATOMIC_RELAXED);
+            return;
+        } else {
+            position = __atomic_load_n(&deferred->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    record->timestamp = furi_log.timestamp();
+    record->tag = tag;
+    record->format = format;
+    record->level = level;
+    furi_log_deferred_capture(record, format, args);
+    __atomic_store_n(&record->sequence, position + 1, __ATOMIC_RELEASE);
+
+    // Only pay for kernel call when consumer is sleeping
+    if(__atomic_load_n(&deferred->consumer_waiting, __ATOMIC_ACQUIRE)) {
+        deferred->consumer_waiting = false;
+        furi_semaphore_release(deferred->wakeup);
+    }
+}
+
 void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+    if(level <= furi_log.log_level && furi_log.deferred_enabled) {
+        va_list args;
+        va_start(args, format);
+        furi_log_defer(level, tag, format, args);
+        va_end(args);
+    } else if(
+        level <= furi_log.log_level &&
+        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
         string = furi_string_alloc();
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
-            break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
-            break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
-            break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
-            break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
-            break;
-        default:
-            break;
-        }
+        const char* log_letter;
+        const char* color = furi_log_get_color(level, &log_letter);
 
         // Timestamp
         furi_string_printf(
@@ -96,8 +456,14 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 }
 
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+    if(level <= furi_log.log_level && furi_log.deferred_enabled) {
+        va_list args;
+        va_start(args, format);
+        furi_log_defer(level, NULL, format, args);
+        va_end(args);
+    } else if(
+        level <= furi_log.log_level &&
+        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
         string = furi_string_alloc();
         va_list args;
@@ -128,6 +494,29 @@ void furi_log_set_puts(FuriLogPuts puts) {
     furi_log.puts = puts;
 }
 
+void furi_log_set_deferred(bool deferred) {
+    furi_assert(!FURI_IS_IRQ_MODE());
+
+    if(deferred && !furi_log.deferred) {
+        FuriLogDeferred* instance = malloc(sizeof(FuriLogDeferred));
+        for(size_t i = 0; i < FURI_LOG_DEFERRED_RECORDS; i++) {
+            instance->records[i].sequence = i;
+        }
+        instance->wakeup = furi_semaphore_alloc(1, 0);
+        instance->thread = furi_thread_alloc_ex(
+            "LogDeferred", FURI_LOG_DEFERRED_STACK_SIZE, furi_log_deferred_worker, instance);
+        furi_thread_set_priority(instance->thread, FuriThreadPriorityLowest);
+        furi_thread_start(instance->thread);
+        furi_log.deferred = instance;
+    }
+
+    furi_log.deferred_enabled = deferred;
+}
+
+bool furi_log_is_deferred(void) {
+    return furi_log.deferred_enabled;
+}
+
 void furi_log_set_timestamp(FuriLogTimestamp timestamp) {
     furi_assert(timestamp);
     furi_log.timestamp = timestamp;
@@ -88,6 +88,27 @@ void furi_log_set_puts(FuriLogPuts puts);
  */
 void furi_log_set_timestamp(FuriLogTimestamp timestamp);
 
+/** Enable or disable deferred logging
+ *
+ * In deferred mode log call only copies timestamp, tag and format pointers
+ * and the arguments to a lock-free ring, formatting and output are done later
+ * by a low priority thread. Records don't take mutex and can be made from
+ * interrupts. Strings are copied too, record keeps up to 44 bytes of
+ * arguments and the rest of the format is printed as is. Records that find
+ * the ring full are dropped and the loss is reported with the next one.
+ *
+ * Ring and thread are allocated on first enable and kept afterwards.
+ *
+ * @param[in]  deferred  true to defer log records
+ */
+void furi_log_set_deferred(bool deferred);
+
+/** Check if logging is deferred
+ *
+ * @return     true if deferred logging is enabled
+ */
+bool furi_log_is_deferred(void);
+
 /** Log level to string
  *
  * @param[in]  level  The level
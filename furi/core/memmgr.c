@@ -4,36 +4,46 @@
 #include <furi_hal_memory.h>
 
 extern void* pvPortMalloc(size_t xSize);
+extern void* pvPortMallocFrom(size_t xSize, void* pvCaller);
 extern void vPortFree(void* pv);
 extern size_t xPortGetFreeHeapSize(void);
 extern size_t xPortGetTotalHeapSize(void);
 extern size_t xPortGetMinimumEverFreeHeapSize(void);
 
+static uint32_t memmgr_transient_allocs = 0;
+static uint32_t memmgr_transient_fallbacks = 0;
+
+static inline void memmgr_free(void* ptr) {
+    if(!furi_hal_memory_free_transient(ptr)) {
+        vPortFree(ptr);
+    }
+}
+
 void* malloc(size_t size) {
-    return pvPortMalloc(size);
+    return pvPortMallocFrom(size, __builtin_return_address(0));
 }
 
 void free(void* ptr) {
-    vPortFree(ptr);
+    memmgr_free(ptr);
 }
 
 void* realloc(void* ptr, size_t size) {
     if(size == 0) {
-        vPortFree(ptr);
+        memmgr_free(ptr);
         return NULL;
     }
 
-    void* p = pvPortMalloc(size);
+    void* p = pvPortMallocFrom(size, __builtin_return_address(0));
     if(ptr != NULL) {
         memcpy(p, ptr, size);
-        vPortFree(ptr);
+        memmgr_free(ptr);
     }
 
     return p;
 }
 
 void* calloc(size_t count, size_t size) {
-    return pvPortMalloc(count * size);
+    return pvPortMallocFrom(count * size, __builtin_return_address(0));
 }
 
 char* strdup(const char* s) {
@@ -41,7 +51,7 @@ char* strdup(const char* s) {
     furi_check(((uint32_t)s << 2) != 0);
 
     size_t siz = strlen(s) + 1;
-    char* y = pvPortMalloc(siz);
+    char* y = pvPortMallocFrom(siz, __builtin_return_address(0));
     memcpy(y, s, siz);
 
     return y;
@@ -66,7 +76,7 @@ void* __wrap__malloc_r(struct _reent* r, size_t size) {
 
 void __wrap__free_r(struct _reent* r, void* ptr) {
     UNUSED(r);
-    vPortFree(ptr);
+    memmgr_free(ptr);
 }
 
 void* __wrap__calloc_r(struct _reent* r, size_t count, size_t size) {
@@ -94,6 +104,29 @@ size_t memmgr_pool_get_max_block(void) {
     return furi_hal_memory_max_pool_block();
 }
 
+void* memmgr_alloc_transient(size_t size) {
+    __atomic_add_fetch(&memmgr_transient_allocs, 1, __ATOMIC_RELAXED);
+
+    void* p = furi_hal_memory_alloc_transient(size);
+    if(p == NULL) {
+        __atomic_add_fetch(&memmgr_transient_fallbacks, 1, __ATOMIC_RELAXED);
+        p = pvPortMallocFrom(size, __builtin_return_address(0));
+    }
+
+    return p;
+}
+
+void memmgr_pool_get_stats(MemmgrPoolStats* stats) {
+    furi_check(stats);
+
+    stats->free = furi_hal_memory_get_free();
+    stats->max_block = furi_hal_memory_max_pool_block();
+    stats->transient_used = furi_hal_memory_get_transient_used();
+    stats->transient_peak = furi_hal_memory_get_transient_peak();
+    stats->transient_allocs = __atomic_load_n(&memmgr_transient_allocs, __ATOMIC_RELAXED);
+    stats->transient_fallbacks = __atomic_load_n(&memmgr_transient_fallbacks, __ATOMIC_RELAXED);
+}
+
 void* aligned_malloc(size_t size, size_t alignment) {
     void* p1; // original block
     void** p2; // aligned block
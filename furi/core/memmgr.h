@@ -6,6 +6,7 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include "check.h"
@@ -72,6 +73,33 @@ size_t memmgr_pool_get_free(void);
  */
 size_t memmgr_pool_get_max_block(void);
 
+typedef struct {
+    size_t free; /**< free pool space */
+    size_t max_block; /**< largest free pool block */
+    size_t transient_used; /**< space taken by transient buffers */
+    size_t transient_peak; /**< largest transient_used since boot */
+    uint32_t transient_allocs; /**< memmgr_alloc_transient() calls */
+    uint32_t transient_fallbacks; /**< calls that were served from the heap */
+} MemmgrPoolStats;
+
+/**
+ * @brief Allocate zeroed short lived buffer, from memory pool if it has space or from heap
+ * 
+ * Meant for large buffers that live for the duration of an operation, like copy buffers.
+ * Pool is tried first, so the buffer doesn't fragment the heap. Free it with free().
+ * 
+ * @param size 
+ * @return void* 
+ */
+void* memmgr_alloc_transient(size_t size);
+
+/**
+ * @brief Get memory pool statistics
+ * 
+ * @param stats 
+ */
+void memmgr_pool_get_stats(MemmgrPoolStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
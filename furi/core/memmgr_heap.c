@@ -90,6 +90,32 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert);
  */
 static void prvHeapInit(void);
 
+/*
+ * Take a block of the wanted size from the list of free blocks and return its
+ * memory space, or NULL if no block is large enough. Must be called with the
+ * scheduler suspended.
+ */
+static void* prvHeapAlloc(size_t xWantedSize);
+
+/*
+ * Same as prvHeapAlloc(), but takes the block from the end of the highest
+ * free block that is large enough. Keeps long living blocks away from the
+ * start of the heap, where the first fit search takes blocks from.
+ */
+static void* prvHeapAllocHigh(size_t xWantedSize);
+
+/*
+ * Return an allocated block to the list of free blocks. Must be called with
+ * the scheduler suspended.
+ */
+static void prvHeapFree(BlockLink_t* pxLink);
+
+/*
+ * Same as pvPortMalloc(), with the return address of the allocation call
+ * for profiling.
+ */
+void* pvPortMallocFrom(size_t xWantedSize, void* pvCaller);
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -111,38 +137,279 @@ application.  When the bit is free the block is still part of the free heap
 space. */
 static size_t xBlockAllocatedBit = 0;
 
+/* Start of the heap, blocks follow each other from it up to pxEnd. */
+static uint8_t* pucHeapStart = NULL;
+
+/* Allocated blocks keep the owner tag in xBlockSize bits that are never used
+by the size itself: 0 for untraced allocations, slot of the traced thread or
+MEMMGR_HEAP_OWNER_SLAB_PAGE for slab pages. */
+#define MEMMGR_HEAP_OWNER_SHIFT 24U
+#define MEMMGR_HEAP_OWNER_MASK ((size_t)0x3F << MEMMGR_HEAP_OWNER_SHIFT)
+#define MEMMGR_HEAP_OWNER_SLAB_PAGE 0x3FU
+#define MEMMGR_HEAP_OWNER_SLOTS (MEMMGR_HEAP_OWNER_SLAB_PAGE - 1U)
+
+static inline size_t memmgr_heap_block_size(const BlockLink_t* pxLink) {
+    return pxLink->xBlockSize & ~(xBlockAllocatedBit | MEMMGR_HEAP_OWNER_MASK);
+}
+
+static inline size_t memmgr_heap_block_owner(const BlockLink_t* pxLink) {
+    return (pxLink->xBlockSize & MEMMGR_HEAP_OWNER_MASK) >> MEMMGR_HEAP_OWNER_SHIFT;
+}
+
+static inline void memmgr_heap_block_set_owner(BlockLink_t* pxLink, size_t owner) {
+    pxLink->xBlockSize &= ~MEMMGR_HEAP_OWNER_MASK;
+    pxLink->xBlockSize |= owner << MEMMGR_HEAP_OWNER_SHIFT;
+}
+
+/* Size-class pools
+
+Small allocations are served from slab pages: heap blocks split into objects
+of the same size. Objects keep the BlockLink_t header, allocated object has
+its page in pxNextFreeBlock, so vPortFree() tells it from the heap block that
+has NULL there. Free objects of the page are linked through the header too.
+
+Pages with free objects are kept in the list of their class. Page that has
+no allocated objects left goes back to the heap, unless it is the last one
+of its class: that spare page is kept to avoid alloc/free churn and released
+when the heap runs out of memory or the largest free block is requested. */
+
+#define MEMMGR_SLAB_PAGE_SIZE 1024U
+
+typedef struct MemmgrSlabPage MemmgrSlabPage;
+
+typedef struct {
+    size_t object_size; /*<< Object size, BlockLink_t header included. */
+    MemmgrSlabPage* pages; /*<< Pages with free objects. */
+} MemmgrSlabClass;
+
+struct MemmgrSlabPage {
+    MemmgrSlabPage* next;
+    MemmgrSlabPage* prev;
+    MemmgrSlabClass* slab_class;
+    BlockLink_t* free_objects;
+    size_t used;
+};
+
+#define MEMMGR_SLAB_PAGE_HEADER_SIZE \
+    ((sizeof(MemmgrSlabPage) + portBYTE_ALIGNMENT_MASK) & ~((size_t)portBYTE_ALIGNMENT_MASK))
+
+#define MEMMGR_SLAB_CLASS(size) {.object_size = (size) + sizeof(BlockLink_t)}
+
+static MemmgrSlabClass memmgr_slab_classes[] = {
+    MEMMGR_SLAB_CLASS(16),
+    MEMMGR_SLAB_CLASS(32),
+    MEMMGR_SLAB_CLASS(64),
+    MEMMGR_SLAB_CLASS(128),
+};
+
+#define MEMMGR_SLAB_CLASS_COUNT COUNT_OF(memmgr_slab_classes)
+
+/* Free bytes in slab pages, counted as free heap. Page is counted with its
+heap block size, objects are taken out of it with their size. */
+static size_t memmgr_slab_free_bytes = 0U;
+
+static size_t memmgr_slab_page_capacity(const MemmgrSlabClass* slab_class) {
+    return (MEMMGR_SLAB_PAGE_SIZE - MEMMGR_SLAB_PAGE_HEADER_SIZE) / slab_class->object_size;
+}
+
+static MemmgrSlabClass* memmgr_slab_get_class(size_t size) {
+    if(size == 0) return NULL;
+    for(size_t i = 0; i < MEMMGR_SLAB_CLASS_COUNT; i++) {
+        if(size + xHeapStructSize <= memmgr_slab_classes[i].object_size) {
+            return &memmgr_slab_classes[i];
+        }
+    }
+    return NULL;
+}
+
+static bool memmgr_slab_page_is_valid(const MemmgrSlabPage* page) {
+    if((uint8_t*)page < ucHeap || (uint8_t*)page >= (uint8_t*)pxEnd) return false;
+    if(((size_t)page & portBYTE_ALIGNMENT_MASK) != 0) return false;
+    return page->slab_class >= memmgr_slab_classes &&
+           page->slab_class < memmgr_slab_classes + MEMMGR_SLAB_CLASS_COUNT;
+}
+
+static void memmgr_slab_page_link(MemmgrSlabPage* page) {
+    MemmgrSlabClass* slab_class = page->slab_class;
+    page->prev = NULL;
+    page->next = slab_class->pages;
+    if(slab_class->pages) slab_class->pages->prev = page;
+    slab_class->pages = page;
+}
+
+static void memmgr_slab_page_unlink(MemmgrSlabPage* page) {
+    if(page->prev) {
+        page->prev->next = page->next;
+    } else {
+        page->slab_class->pages = page->next;
+    }
+    if(page->next) page->next->prev = page->prev;
+    page->next = NULL;
+    page->prev = NULL;
+}
+
+static MemmgrSlabPage* memmgr_slab_page_alloc(MemmgrSlabClass* slab_class) {
+    MemmgrSlabPage* page = prvHeapAllocHigh(MEMMGR_SLAB_PAGE_SIZE);
+    if(page == NULL) return NULL;
+
+    BlockLink_t* pxLink = (void*)((uint8_t*)page - xHeapStructSize);
+    memmgr_heap_block_set_owner(pxLink, MEMMGR_HEAP_OWNER_SLAB_PAGE);
+    memmgr_slab_free_bytes += memmgr_heap_block_size(pxLink);
+
+    page->slab_class = slab_class;
+    page->free_objects = NULL;
+    page->used = 0;
+
+    /* Link objects so that the lowest address is taken first. */
+    size_t count = memmgr_slab_page_capacity(slab_class);
+    uint8_t* objects = (uint8_t*)page + MEMMGR_SLAB_PAGE_HEADER_SIZE;
+    while(count > 0) {
+        count--;
+        BlockLink_t* object = (void*)(objects + count * slab_class->object_size);
+        object->xBlockSize = slab_class->object_size;
+        object->pxNextFreeBlock = page->free_objects;
+        page->free_objects = object;
+    }
+
+    memmgr_slab_page_link(page);
+    return page;
+}
+
+static void memmgr_slab_page_free(MemmgrSlabPage* page) {
+    memmgr_slab_page_unlink(page);
+
+    BlockLink_t* pxLink = (void*)((uint8_t*)page - xHeapStructSize);
+    memmgr_slab_free_bytes -= memmgr_heap_block_size(pxLink);
+    prvHeapFree(pxLink);
+}
+
+static void* memmgr_slab_alloc(MemmgrSlabClass* slab_class) {
+    MemmgrSlabPage* page = slab_class->pages;
+    if(page == NULL) {
+        page = memmgr_slab_page_alloc(slab_class);
+        if(page == NULL) return NULL;
+    }
+
+    BlockLink_t* object = page->free_objects;
+    page->free_objects = object->pxNextFreeBlock;
+    page->used++;
+    if(page->free_objects == NULL) {
+        memmgr_slab_page_unlink(page);
+    }
+
+    memmgr_slab_free_bytes -= slab_class->object_size;
+
+    object->xBlockSize = slab_class->object_size | xBlockAllocatedBit;
+    object->pxNextFreeBlock = (void*)page;
+    return (uint8_t*)object + xHeapStructSize;
+}
+
+static void memmgr_slab_free(BlockLink_t* object) {
+    MemmgrSlabPage* page = (MemmgrSlabPage*)object->pxNextFreeBlock;
+    furi_check(memmgr_slab_page_is_valid(page));
+    MemmgrSlabClass* slab_class = page->slab_class;
+    furi_check((object->xBlockSize & xBlockAllocatedBit) != 0);
+    furi_check(memmgr_heap_block_size(object) == slab_class->object_size);
+    furi_check(page->used > 0);
+
+    memset((uint8_t*)object + xHeapStructSize, 0, slab_class->object_size - xHeapStructSize);
+    memmgr_slab_free_bytes += slab_class->object_size;
+
+    if(page->free_objects == NULL) {
+        memmgr_slab_page_link(page);
+    }
+    object->xBlockSize = slab_class->object_size;
+    object->pxNextFreeBlock = page->free_objects;
+    page->free_objects = object;
+    page->used--;
+
+    if(page->used == 0 && (page->next || page->prev)) {
+        memmgr_slab_page_free(page);
+    }
+}
+
+/* Release spare pages, returns true if any memory was released */
+static bool memmgr_slab_release_spare_pages() {
+    bool released = false;
+    for(size_t i = 0; i < MEMMGR_SLAB_CLASS_COUNT; i++) {
+        MemmgrSlabPage* page = memmgr_slab_classes[i].pages;
+        while(page) {
+            MemmgrSlabPage* next = page->next;
+            if(page->used == 0) {
+                memmgr_slab_page_free(page);
+                released = true;
+            }
+            page = next;
+        }
+    }
+    return released;
+}
+
 /* Furi heap extension */
-#include <m-dict.h>
 
-/* Allocation tracking types */
-DICT_DEF2(MemmgrHeapAllocDict, uint32_t, uint32_t) //-V1048
+/* Thread allocation tracing storage, slot of the thread is its owner tag - 1 */
+static FuriThreadId memmgr_heap_trace_threads[MEMMGR_HEAP_OWNER_SLOTS] = {0};
+static size_t memmgr_heap_trace_count = 0;
+static FuriThreadId memmgr_heap_trace_last_thread = NULL;
+static size_t memmgr_heap_trace_last_owner = 0;
+static volatile size_t memmgr_heap_alloc_count = 0;
 
-DICT_DEF2( //-V1048
-    MemmgrHeapThreadDict,
-    uint32_t,
-    M_DEFAULT_OPLIST,
-    MemmgrHeapAllocDict_t,
-    DICT_OPLIST(MemmgrHeapAllocDict))
+static size_t memmgr_heap_find_owner(FuriThreadId thread_id) {
+    for(size_t i = 0; i < MEMMGR_HEAP_OWNER_SLOTS; i++) {
+        if(memmgr_heap_trace_threads[i] == thread_id) return i + 1;
+    }
+    return 0;
+}
 
-/* Thread allocation tracing storage */
-static MemmgrHeapThreadDict_t memmgr_heap_thread_dict = {0};
-static volatile uint32_t memmgr_heap_thread_trace_depth = 0;
+/* Walk all allocated blocks, sum sizes of the owner blocks and optionally
+untag them. Must be called with the scheduler suspended. */
+static size_t memmgr_heap_walk_owner(size_t owner, bool untag) {
+    size_t total = 0;
+    if(pucHeapStart == NULL) return total;
 
-/* Initialize tracing storage on start */
-void memmgr_heap_init() {
-    MemmgrHeapThreadDict_init(memmgr_heap_thread_dict);
+    for(uint8_t* puc = pucHeapStart; puc < (uint8_t*)pxEnd;) {
+        BlockLink_t* pxLink = (void*)puc;
+        size_t xBlockSize = memmgr_heap_block_size(pxLink);
+        furi_check(xBlockSize >= xHeapStructSize);
+
+        if((pxLink->xBlockSize & xBlockAllocatedBit) != 0) {
+            size_t block_owner = memmgr_heap_block_owner(pxLink);
+            if(block_owner == MEMMGR_HEAP_OWNER_SLAB_PAGE) {
+                MemmgrSlabPage* page = (void*)(puc + xHeapStructSize);
+                size_t object_size = page->slab_class->object_size;
+                size_t count = memmgr_slab_page_capacity(page->slab_class);
+                uint8_t* objects = (uint8_t*)page + MEMMGR_SLAB_PAGE_HEADER_SIZE;
+                for(size_t i = 0; i < count; i++) {
+                    BlockLink_t* object = (void*)(objects + i * object_size);
+                    if((object->xBlockSize & xBlockAllocatedBit) != 0 &&
+                       memmgr_heap_block_owner(object) == owner) {
+                        total += object_size;
+                        if(untag) memmgr_heap_block_set_owner(object, 0);
+                    }
+                }
+            } else if(block_owner == owner) {
+                total += xBlockSize;
+                if(untag) memmgr_heap_block_set_owner(pxLink, 0);
+            }
+        }
+
+        puc += xBlockSize;
+    }
+
+    return total;
 }
 
 void memmgr_heap_enable_thread_trace(FuriThreadId thread_id) {
     vTaskSuspendAll();
     {
-        memmgr_heap_thread_trace_depth++;
-        furi_check(MemmgrHeapThreadDict_get(memmgr_heap_thread_dict, (uint32_t)thread_id) == NULL);
-        MemmgrHeapAllocDict_t alloc_dict;
-        MemmgrHeapAllocDict_init(alloc_dict);
-        MemmgrHeapThreadDict_set_at(memmgr_heap_thread_dict, (uint32_t)thread_id, alloc_dict);
-        MemmgrHeapAllocDict_clear(alloc_dict);
-        memmgr_heap_thread_trace_depth--;
+        furi_check(memmgr_heap_find_owner(thread_id) == 0);
+        // Thread is not traced if all slots are taken
+        size_t owner = memmgr_heap_find_owner(NULL);
+        if(owner) {
+            memmgr_heap_trace_threads[owner - 1] = thread_id;
+            memmgr_heap_trace_count++;
+        }
+        memmgr_heap_trace_last_thread = NULL;
     }
     (void)xTaskResumeAll();
 }
@@ -150,9 +417,14 @@ void memmgr_heap_enable_thread_trace(FuriThreadId thread_id) {
 void memmgr_heap_disable_thread_trace(FuriThreadId thread_id) {
     vTaskSuspendAll();
     {
-        memmgr_heap_thread_trace_depth++;
-        furi_check(MemmgrHeapThreadDict_erase(memmgr_heap_thread_dict, (uint32_t)thread_id));
-        memmgr_heap_thread_trace_depth--;
+        size_t owner = memmgr_heap_find_owner(thread_id);
+        if(owner) {
+            // Leftovers must not be counted for the next thread in this slot
+            memmgr_heap_walk_owner(owner, true);
+            memmgr_heap_trace_threads[owner - 1] = NULL;
+            memmgr_heap_trace_count--;
+        }
+        memmgr_heap_trace_last_thread = NULL;
     }
     (void)xTaskResumeAll();
 }
@@ -161,29 +433,10 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
     size_t leftovers = MEMMGR_HEAP_UNKNOWN;
     vTaskSuspendAll();
     {
-        memmgr_heap_thread_trace_depth++;
-        MemmgrHeapAllocDict_t* alloc_dict =
-            MemmgrHeapThreadDict_get(memmgr_heap_thread_dict, (uint32_t)thread_id);
-        if(alloc_dict) {
-            leftovers = 0;
-            MemmgrHeapAllocDict_it_t alloc_dict_it;
-            for(MemmgrHeapAllocDict_it(alloc_dict_it, *alloc_dict);
-                !MemmgrHeapAllocDict_end_p(alloc_dict_it);
-                MemmgrHeapAllocDict_next(alloc_dict_it)) {
-                MemmgrHeapAllocDict_itref_t* data = MemmgrHeapAllocDict_ref(alloc_dict_it);
-                if(data->key != 0) {
-                    uint8_t* puc = (uint8_t*)data->key;
-                    puc -= xHeapStructSize;
-                    BlockLink_t* pxLink = (void*)puc;
-
-                    if((pxLink->xBlockSize & xBlockAllocatedBit) != 0 &&
-                       pxLink->pxNextFreeBlock == NULL) {
-                        leftovers += data->value;
-                    }
-                }
-            }
+        size_t owner = memmgr_heap_find_owner(thread_id);
+        if(owner) {
+            leftovers = memmgr_heap_walk_owner(owner, false);
         }
-        memmgr_heap_thread_trace_depth--;
     }
     (void)xTaskResumeAll();
     return leftovers;
@@ -191,33 +444,24 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
 
 #undef traceMALLOC
 static inline void traceMALLOC(void* pointer, size_t size) {
+    UNUSED(size);
+    if(pointer) memmgr_heap_alloc_count++;
+    if(pointer == NULL || memmgr_heap_trace_count == 0) return;
+
     FuriThreadId thread_id = furi_thread_get_current_id();
-    if(thread_id && memmgr_heap_thread_trace_depth == 0) {
-        memmgr_heap_thread_trace_depth++;
-        MemmgrHeapAllocDict_t* alloc_dict =
-            MemmgrHeapThreadDict_get(memmgr_heap_thread_dict, (uint32_t)thread_id);
-        if(alloc_dict) {
-            MemmgrHeapAllocDict_set_at(*alloc_dict, (uint32_t)pointer, (uint32_t)size);
-        }
-        memmgr_heap_thread_trace_depth--;
+    if(thread_id == NULL) return;
+
+    if(thread_id != memmgr_heap_trace_last_thread) {
+        memmgr_heap_trace_last_thread = thread_id;
+        memmgr_heap_trace_last_owner = memmgr_heap_find_owner(thread_id);
     }
+
+    BlockLink_t* pxLink = (void*)((uint8_t*)pointer - xHeapStructSize);
+    memmgr_heap_block_set_owner(pxLink, memmgr_heap_trace_last_owner);
 }
 
-#undef traceFREE
-static inline void traceFREE(void* pointer, size_t size) {
-    UNUSED(size);
-    FuriThreadId thread_id = furi_thread_get_current_id();
-    if(thread_id && memmgr_heap_thread_trace_depth == 0) {
-        memmgr_heap_thread_trace_depth++;
-        MemmgrHeapAllocDict_t* alloc_dict =
-            MemmgrHeapThreadDict_get(memmgr_heap_thread_dict, (uint32_t)thread_id);
-        if(alloc_dict) {
-            // In some cases thread may want to release memory that was not allocated by it
-            const bool res = MemmgrHeapAllocDict_erase(*alloc_dict, (uint32_t)pointer);
-            UNUSED(res);
-        }
-        memmgr_heap_thread_trace_depth--;
-    }
+size_t memmgr_heap_get_alloc_count() {
+    return memmgr_heap_alloc_count;
 }
 
 size_t memmgr_heap_get_max_free_block() {
@@ -225,6 +469,8 @@ size_t memmgr_heap_get_max_free_block() {
     BlockLink_t* pxBlock;
     vTaskSuspendAll();
 
+    memmgr_slab_release_spare_pages();
+
     pxBlock = xStart.pxNextFreeBlock;
     while(pxBlock->pxNextFreeBlock != NULL) {
         if(pxBlock->xBlockSize > max_free_size) {
@@ -237,6 +483,102 @@ size_t memmgr_heap_get_max_free_block() {
     return max_free_size;
 }
 
+/* Allocation profiling storage */
+static volatile bool memmgr_heap_profile_enabled = false;
+static MemmgrHeapProfile memmgr_heap_profile = {0};
+
+static size_t memmgr_heap_get_size_class(size_t size) {
+    size_t size_class = 0;
+    while(size_class < MEMMGR_HEAP_SIZE_CLASSES - 1 &&
+          size > MEMMGR_HEAP_SIZE_CLASS_LIMIT(size_class)) {
+        size_class++;
+    }
+    return size_class;
+}
+
+/* Count the call site, the least allocating one is replaced when the table is full and
+inherits its count, so frequent call sites are never lost. */
+static void memmgr_heap_profile_alloc(void* caller, size_t size) {
+    memmgr_heap_profile.alloc_count++;
+    memmgr_heap_profile.alloc_size_class[memmgr_heap_get_size_class(size)]++;
+
+    MemmgrHeapProfileCallSite* site = NULL;
+    MemmgrHeapProfileCallSite* least = &memmgr_heap_profile.call_sites[0];
+    for(size_t i = 0; i < MEMMGR_HEAP_PROFILE_CALL_SITES; i++) {
+        MemmgrHeapProfileCallSite* current = &memmgr_heap_profile.call_sites[i];
+        if(current->address == (uintptr_t)caller) {
+            site = current;
+            break;
+        }
+        if(current->count < least->count) least = current;
+    }
+
+    if(!site) {
+        site = least;
+        site->address = (uintptr_t)caller;
+        site->bytes = 0;
+    }
+    site->count++;
+    site->bytes += size;
+}
+
+static void memmgr_heap_profile_free(size_t size) {
+    memmgr_heap_profile.free_count++;
+    memmgr_heap_profile.free_size_class[memmgr_heap_get_size_class(size)]++;
+}
+
+void memmgr_heap_profile_start() {
+    vTaskSuspendAll();
+    memset(&memmgr_heap_profile, 0, sizeof(MemmgrHeapProfile));
+    memmgr_heap_profile_enabled = true;
+    (void)xTaskResumeAll();
+}
+
+void memmgr_heap_profile_stop() {
+    memmgr_heap_profile_enabled = false;
+}
+
+void memmgr_heap_get_profile(MemmgrHeapProfile* profile) {
+    furi_assert(profile);
+
+    vTaskSuspendAll();
+    *profile = memmgr_heap_profile;
+    profile->enabled = memmgr_heap_profile_enabled;
+    (void)xTaskResumeAll();
+
+    // Sort call sites by count
+    for(size_t i = 1; i < MEMMGR_HEAP_PROFILE_CALL_SITES; i++) {
+        MemmgrHeapProfileCallSite site = profile->call_sites[i];
+        size_t j = i;
+        while(j > 0 && profile->call_sites[j - 1].count < site.count) {
+            profile->call_sites[j] = profile->call_sites[j - 1];
+            j--;
+        }
+        profile->call_sites[j] = site;
+    }
+}
+
+void memmgr_heap_get_fragmentation(MemmgrHeapFragmentation* fragmentation) {
+    furi_assert(fragmentation);
+    memset(fragmentation, 0, sizeof(MemmgrHeapFragmentation));
+
+    vTaskSuspendAll();
+
+    memmgr_slab_release_spare_pages();
+
+    BlockLink_t* pxBlock = xStart.pxNextFreeBlock;
+    while(pxBlock->pxNextFreeBlock != NULL) {
+        fragmentation->free_bytes += pxBlock->xBlockSize;
+        fragmentation->free_blocks++;
+        fragmentation->max_free_block = MAX(fragmentation->max_free_block, pxBlock->xBlockSize);
+        fragmentation->free_size_class[memmgr_heap_get_size_class(pxBlock->xBlockSize)]++;
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+    fragmentation->slab_free_bytes = memmgr_slab_free_bytes;
+
+    (void)xTaskResumeAll();
+}
+
 void memmgr_heap_printf_free_blocks() {
     BlockLink_t* pxBlock;
     //TODO enable when we can do printf with a locked scheduler
@@ -337,9 +679,157 @@ static void print_heap_free(void* ptr) {
 #endif
 /*-----------------------------------------------------------*/
 
-void* pvPortMalloc(size_t xWantedSize) {
+static void* prvHeapAlloc(size_t xWantedSize) {
     BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
     void* pvReturn = NULL;
+
+    /* Check the requested block size is not so large that the top bit is
+    set.  The top bit of the block size member of the BlockLink_t structure
+    is used to determine who owns the block - the application or the
+    kernel, so it must be free. */
+    if((xWantedSize & xBlockAllocatedBit) == 0) {
+        /* The wanted size is increased so it can contain a BlockLink_t
+        structure in addition to the requested amount of bytes. */
+        if(xWantedSize > 0) {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+            of bytes. */
+            if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+                /* Byte alignment required. */
+                xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
+                configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
+            /* Traverse the list from the start (lowest address) block until
+            one of adequate size is found. */
+            pxPreviousBlock = &xStart;
+            pxBlock = xStart.pxNextFreeBlock;
+            while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
+                pxPreviousBlock = pxBlock;
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            /* If the end marker was reached then a block of adequate size
+            was not found. */
+            if(pxBlock != pxEnd) {
+                /* Return the memory space pointed to - jumping over the
+                BlockLink_t structure at its start. */
+                pvReturn =
+                    (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
+
+                /* This block is being returned for use so must be taken out
+                of the list of free blocks. */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+                /* If the block is larger than required it can be split into
+                two. */
+                if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+                    /* This block is to be split into two.  Create a new
+                    block following the number of bytes requested. The void
+                    cast is used to prevent byte alignment warnings from the
+                    compiler. */
+                    pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
+                    configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
+
+                    /* Calculate the sizes of two blocks split from the
+                    single block. */
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    /* Insert the new block into the list of free blocks. */
+                    prvInsertBlockIntoFreeList(pxNewBlockLink);
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The block is being returned - it is allocated and owned
+                by the application and has no "next" block. */
+                pxBlock->xBlockSize |= xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    } else {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void* prvHeapAllocHigh(size_t xWantedSize) {
+    BlockLink_t *pxBlock, *pxPreviousBlock = NULL, *pxIterator;
+    void* pvReturn = NULL;
+
+    xWantedSize += xHeapStructSize;
+    if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+        xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
+    }
+
+    if(xWantedSize <= xFreeBytesRemaining) {
+        /* Find the free block of adequate size with the highest address. */
+        for(pxIterator = &xStart; pxIterator->pxNextFreeBlock != pxEnd;
+            pxIterator = pxIterator->pxNextFreeBlock) {
+            if(pxIterator->pxNextFreeBlock->xBlockSize >= xWantedSize) {
+                pxPreviousBlock = pxIterator;
+            }
+        }
+
+        if(pxPreviousBlock != NULL) {
+            pxBlock = pxPreviousBlock->pxNextFreeBlock;
+
+            if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+                /* Leave the start of the block in the list of free blocks and
+                return its end. */
+                pxBlock->xBlockSize -= xWantedSize;
+                pxBlock = (void*)(((uint8_t*)pxBlock) + pxBlock->xBlockSize);
+                configASSERT((((size_t)pxBlock) & portBYTE_ALIGNMENT_MASK) == 0);
+                pxBlock->xBlockSize = xWantedSize;
+            } else {
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+            if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+                xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+            }
+
+            pxBlock->xBlockSize |= xBlockAllocatedBit;
+            pxBlock->pxNextFreeBlock = NULL;
+            pvReturn = (void*)(((uint8_t*)pxBlock) + xHeapStructSize);
+        }
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void* pvPortMalloc(size_t xWantedSize) {
+    return pvPortMallocFrom(xWantedSize, __builtin_return_address(0));
+}
+/*-----------------------------------------------------------*/
+
+void* pvPortMallocFrom(size_t xWantedSize, void* pvCaller) {
+    void* pvReturn = NULL;
     size_t to_wipe = xWantedSize;
 
     if(FURI_IS_IRQ_MODE()) {
@@ -360,7 +850,6 @@ void* pvPortMalloc(size_t xWantedSize) {
         vTaskSuspendAll();
         {
             prvHeapInit();
-            memmgr_heap_init();
         }
         (void)xTaskResumeAll();
     } else {
@@ -369,104 +858,39 @@ void* pvPortMalloc(size_t xWantedSize) {
 
     vTaskSuspendAll();
     {
-        /* Check the requested block size is not so large that the top bit is
-        set.  The top bit of the block size member of the BlockLink_t structure
-        is used to determine who owns the block - the application or the
-        kernel, so it must be free. */
-        if((xWantedSize & xBlockAllocatedBit) == 0) {
-            /* The wanted size is increased so it can contain a BlockLink_t
-            structure in addition to the requested amount of bytes. */
-            if(xWantedSize > 0) {
-                xWantedSize += xHeapStructSize;
-
-                /* Ensure that blocks are always aligned to the required number
-                of bytes. */
-                if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
-                    /* Byte alignment required. */
-                    xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
-                    configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
-            }
-
-            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
-                /* Traverse the list from the start (lowest address) block until
-                one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
-                while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
-                }
-
-                /* If the end marker was reached then a block of adequate size
-                was not found. */
-                if(pxBlock != pxEnd) {
-                    /* Return the memory space pointed to - jumping over the
-                    BlockLink_t structure at its start. */
-                    pvReturn =
-                        (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
-
-                    /* This block is being returned for use so must be taken out
-                    of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
-
-                    /* If the block is larger than required it can be split into
-                    two. */
-                    if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
-                        /* This block is to be split into two.  Create a new
-                        block following the number of bytes requested. The void
-                        cast is used to prevent byte alignment warnings from the
-                        compiler. */
-                        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
-                        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
-
-                        /* Calculate the sizes of two blocks split from the
-                        single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        prvInsertBlockIntoFreeList(pxNewBlockLink);
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+        MemmgrSlabClass* slab_class = memmgr_slab_get_class(xWantedSize);
+        if(slab_class) {
+            pvReturn = memmgr_slab_alloc(slab_class);
+        }
 
-                    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        /* Slab page may not fit in the fragmented heap while the object does. */
+        if(pvReturn == NULL) {
+            pvReturn = prvHeapAlloc(xWantedSize);
+        }
 
-                    /* The block is being returned - it is allocated and owned
-                    by the application and has no "next" block. */
-                    pxBlock->xBlockSize |= xBlockAllocatedBit;
-                    pxBlock->pxNextFreeBlock = NULL;
+        if(pvReturn == NULL && memmgr_slab_release_spare_pages()) {
+            pvReturn = prvHeapAlloc(xWantedSize);
+        }
 
+        size_t xBlockSize = 0;
+        if(pvReturn != NULL) {
+            BlockLink_t* pxLink = (void*)((uint8_t*)pvReturn - xHeapStructSize);
+            xBlockSize = memmgr_heap_block_size(pxLink);
 #ifdef HEAP_PRINT_DEBUG
-                    print_heap_block = pxBlock;
+            print_heap_block = pxLink;
 #endif
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        } else {
-            mtCOVERAGE_TEST_MARKER();
         }
 
-        traceMALLOC(pvReturn, xWantedSize);
+        traceMALLOC(pvReturn, xBlockSize);
+
+        if(pvReturn != NULL && memmgr_heap_profile_enabled) {
+            memmgr_heap_profile_alloc(pvCaller, xBlockSize);
+        }
     }
     (void)xTaskResumeAll();
 
 #ifdef HEAP_PRINT_DEBUG
-    print_heap_malloc(print_heap_block, print_heap_block->xBlockSize & ~xBlockAllocatedBit);
+    print_heap_malloc(print_heap_block, memmgr_heap_block_size(print_heap_block));
 #endif
 
 #if(configUSE_MALLOC_FAILED_HOOK == 1)
@@ -506,35 +930,29 @@ void vPortFree(void* pv) {
 
         /* Check the block is actually allocated. */
         configASSERT((pxLink->xBlockSize & xBlockAllocatedBit) != 0);
-        configASSERT(pxLink->pxNextFreeBlock == NULL);
 
         if((pxLink->xBlockSize & xBlockAllocatedBit) != 0) {
-            if(pxLink->pxNextFreeBlock == NULL) {
-                /* The block is being returned to the heap - it is no longer
-                allocated. */
-                pxLink->xBlockSize &= ~xBlockAllocatedBit;
-
 #ifdef HEAP_PRINT_DEBUG
-                print_heap_free(pxLink);
+            print_heap_free(pxLink);
 #endif
 
-                vTaskSuspendAll();
-                {
-                    furi_assert((size_t)pv >= SRAM_BASE);
-                    furi_assert((size_t)pv < SRAM_BASE + 1024 * 256);
-                    furi_assert(pxLink->xBlockSize >= xHeapStructSize);
-                    furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
-
-                    /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
-                    traceFREE(pv, pxLink->xBlockSize);
-                    memset(pv, 0, pxLink->xBlockSize - xHeapStructSize);
-                    prvInsertBlockIntoFreeList(((BlockLink_t*)pxLink));
+            vTaskSuspendAll();
+            {
+                furi_assert((size_t)pv >= SRAM_BASE);
+                furi_assert((size_t)pv < SRAM_BASE + 1024 * 256);
+
+                if(memmgr_heap_profile_enabled) {
+                    memmgr_heap_profile_free(memmgr_heap_block_size(pxLink));
+                }
+
+                /* Slab object has its page instead of the "next" block. */
+                if(pxLink->pxNextFreeBlock == NULL) {
+                    prvHeapFree(pxLink);
+                } else {
+                    memmgr_slab_free(pxLink);
                 }
-                (void)xTaskResumeAll();
-            } else {
-                mtCOVERAGE_TEST_MARKER();
             }
+            (void)xTaskResumeAll();
         } else {
             mtCOVERAGE_TEST_MARKER();
         }
@@ -546,13 +964,27 @@ void vPortFree(void* pv) {
 }
 /*-----------------------------------------------------------*/
 
+static void prvHeapFree(BlockLink_t* pxLink) {
+    /* The block is being returned to the heap - it is no longer allocated. */
+    pxLink->xBlockSize = memmgr_heap_block_size(pxLink);
+
+    furi_assert(pxLink->xBlockSize >= xHeapStructSize);
+    furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
+
+    /* Add this block to the list of free blocks. */
+    xFreeBytesRemaining += pxLink->xBlockSize;
+    memset((uint8_t*)pxLink + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize);
+    prvInsertBlockIntoFreeList(pxLink);
+}
+/*-----------------------------------------------------------*/
+
 size_t xPortGetTotalHeapSize(void) {
     return (size_t)&__heap_end__ - (size_t)&__heap_start__;
 }
 /*-----------------------------------------------------------*/
 
 size_t xPortGetFreeHeapSize(void) {
-    return xFreeBytesRemaining;
+    return xFreeBytesRemaining + memmgr_slab_free_bytes;
 }
 /*-----------------------------------------------------------*/
 
@@ -582,6 +1014,7 @@ static void prvHeapInit(void) {
     }
 
     pucAlignedHeap = (uint8_t*)uxAddress;
+    pucHeapStart = pucAlignedHeap;
 
     /* xStart is used to hold a pointer to the first item in the list of free
     blocks.  The void cast is used to prevent compiler warnings. */
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <core/thread.h>
 
 #ifdef __cplusplus
@@ -14,7 +15,43 @@ extern "C" {
 
 #define MEMMGR_HEAP_UNKNOWN 0xFFFFFFFF
 
+/** Number of block size classes in heap statistics */
+#define MEMMGR_HEAP_SIZE_CLASSES 12U
+
+/** Upper bound of block size class, header included, the last class has no bound */
+#define MEMMGR_HEAP_SIZE_CLASS_LIMIT(size_class) (16U << (size_class))
+
+/** Number of call sites tracked by allocation profile */
+#define MEMMGR_HEAP_PROFILE_CALL_SITES 16U
+
+typedef struct {
+    uintptr_t address; /**< return address of the allocation call */
+    uint32_t count; /**< allocations made, can be overestimated for rare call sites */
+    uint32_t bytes; /**< bytes allocated */
+} MemmgrHeapProfileCallSite;
+
+typedef struct {
+    bool enabled;
+    uint32_t alloc_count;
+    uint32_t free_count;
+    uint32_t alloc_size_class[MEMMGR_HEAP_SIZE_CLASSES];
+    uint32_t free_size_class[MEMMGR_HEAP_SIZE_CLASSES];
+    /** Most allocating call sites first, unused entries have zero count */
+    MemmgrHeapProfileCallSite call_sites[MEMMGR_HEAP_PROFILE_CALL_SITES];
+} MemmgrHeapProfile;
+
+typedef struct {
+    size_t free_bytes; /**< free bytes in heap blocks */
+    size_t free_blocks; /**< number of free heap blocks */
+    size_t max_free_block; /**< largest free heap block */
+    size_t slab_free_bytes; /**< free bytes in slab pages of small allocations */
+    uint32_t free_size_class[MEMMGR_HEAP_SIZE_CLASSES]; /**< free blocks by size */
+} MemmgrHeapFragmentation;
+
 /** Memmgr heap enable thread allocation tracking
+ *
+ * Allocations are tagged with the thread in the block header. Up to 62 threads
+ * can be tracked at once, others are left untracked.
  *
  * @param      thread_id  - thread id to track
  */
@@ -27,13 +64,23 @@ void memmgr_heap_enable_thread_trace(FuriThreadId taks_handle);
 void memmgr_heap_disable_thread_trace(FuriThreadId taks_handle);
 
 /** Memmgr heap get allocatred thread memory
+ *
+ * Walks the whole heap, don't call it in time critical code.
  *
  * @param      thread_id  - thread id to track
  *
- * @return     bytes allocated right now
+ * @return     bytes allocated right now or MEMMGR_HEAP_UNKNOWN if thread is not tracked
  */
 size_t memmgr_heap_get_thread_memory(FuriThreadId taks_handle);
 
+/** Memmgr heap get number of successful allocations since boot
+ *
+ * Difference between two calls gives allocations made in between, by all threads
+ *
+ * @return     allocations count
+ */
+size_t memmgr_heap_get_alloc_count();
+
 /** Memmgr heap get the max contiguous block size on the heap
  *
  * @return     size_t max contiguous block size
@@ -44,6 +91,29 @@ size_t memmgr_heap_get_max_free_block();
  */
 void memmgr_heap_printf_free_blocks();
 
+/** Memmgr heap start allocation profiling
+ *
+ * Resets collected profile. Profiling costs a few dozens of cycles per
+ * allocation and nothing when it is not running.
+ */
+void memmgr_heap_profile_start();
+
+/** Memmgr heap stop allocation profiling, collected profile is kept
+ */
+void memmgr_heap_profile_stop();
+
+/** Memmgr heap get allocation profile collected since start
+ *
+ * @param      profile  - profile copy
+ */
+void memmgr_heap_get_profile(MemmgrHeapProfile* profile);
+
+/** Memmgr heap get free blocks statistics
+ *
+ * @param      fragmentation  - statistics
+ */
+void memmgr_heap_get_fragmentation(MemmgrHeapFragmentation* fragmentation);
+
 #ifdef __cplusplus
 }
 #endif
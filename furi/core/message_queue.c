@@ -4,26 +4,55 @@
 
 #include <FreeRTOS.h>
 #include <queue.h>
+#include <semphr.h>
+#include <stdlib.h>
+
+typedef struct {
+    QueueHandle_t queue;
+    // Priority queue only: urgent messages and count of messages in both queues
+    QueueHandle_t urgent;
+    SemaphoreHandle_t count;
+} FuriMessageQueueInstance;
 
 FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size) {
+    return furi_message_queue_alloc_ex(msg_count, 0, msg_size);
+}
+
+FuriMessageQueue*
+    furi_message_queue_alloc_ex(uint32_t msg_count, uint32_t urgent_count, uint32_t msg_size) {
     furi_assert((furi_kernel_is_irq_or_masked() == 0U) && (msg_count > 0U) && (msg_size > 0U));
 
-    QueueHandle_t handle = xQueueCreate(msg_count, msg_size);
-    furi_check(handle);
+    FuriMessageQueueInstance* mq = malloc(sizeof(FuriMessageQueueInstance));
+    mq->queue = xQueueCreate(msg_count, msg_size);
+    furi_check(mq->queue);
+
+    if(urgent_count) {
+        mq->urgent = xQueueCreate(urgent_count, msg_size);
+        mq->count = xSemaphoreCreateCounting(msg_count + urgent_count, 0);
+        furi_check(mq->urgent && mq->count);
+    }
 
-    return ((FuriMessageQueue*)handle);
+    return ((FuriMessageQueue*)mq);
 }
 
 void furi_message_queue_free(FuriMessageQueue* instance) {
     furi_assert(furi_kernel_is_irq_or_masked() == 0U);
     furi_assert(instance);
 
-    vQueueDelete((QueueHandle_t)instance);
+    FuriMessageQueueInstance* mq = (FuriMessageQueueInstance*)instance;
+    if(mq->urgent) {
+        vQueueDelete(mq->urgent);
+        vSemaphoreDelete(mq->count);
+    }
+    vQueueDelete(mq->queue);
+    free(mq);
 }
 
-FuriStatus
-    furi_message_queue_put(FuriMessageQueue* instance, const void* msg_ptr, uint32_t timeout) {
-    QueueHandle_t hQueue = (QueueHandle_t)instance;
+static FuriStatus furi_message_queue_send(
+    FuriMessageQueueInstance* mq,
+    QueueHandle_t hQueue,
+    const void* msg_ptr,
+    uint32_t timeout) {
     FuriStatus stat;
     BaseType_t yield;
 
@@ -38,6 +67,8 @@ FuriStatus
             if(xQueueSendToBackFromISR(hQueue, msg_ptr, &yield) != pdTRUE) {
                 stat = FuriStatusErrorResource;
             } else {
+                // Count follows the message, so that receiver always finds one
+                if(mq->count) xSemaphoreGiveFromISR(mq->count, &yield);
                 portYIELD_FROM_ISR(yield);
             }
         }
@@ -51,6 +82,8 @@ FuriStatus
                 } else {
                     stat = FuriStatusErrorResource;
                 }
+            } else if(mq->count) {
+                xSemaphoreGive(mq->count);
             }
         }
     }
@@ -59,8 +92,61 @@ FuriStatus
     return (stat);
 }
 
+FuriStatus
+    furi_message_queue_put(FuriMessageQueue* instance, const void* msg_ptr, uint32_t timeout) {
+    FuriMessageQueueInstance* mq = (FuriMessageQueueInstance*)instance;
+    if(mq == NULL) return FuriStatusErrorParameter;
+
+    return furi_message_queue_send(mq, mq->queue, msg_ptr, timeout);
+}
+
+FuriStatus furi_message_queue_put_urgent(
+    FuriMessageQueue* instance,
+    const void* msg_ptr,
+    uint32_t timeout) {
+    FuriMessageQueueInstance* mq = (FuriMessageQueueInstance*)instance;
+    if(mq == NULL) return FuriStatusErrorParameter;
+    furi_check(mq->urgent);
+
+    return furi_message_queue_send(mq, mq->urgent, msg_ptr, timeout);
+}
+
+/* Priority queue receive: take the count first, then the message is there for sure */
+static FuriStatus
+    furi_message_queue_receive(FuriMessageQueueInstance* mq, void* msg_ptr, uint32_t timeout) {
+    FuriStatus stat = FuriStatusOk;
+    BaseType_t yield = pdFALSE;
+
+    if(furi_kernel_is_irq_or_masked() != 0U) {
+        if((msg_ptr == NULL) || (timeout != 0U)) {
+            stat = FuriStatusErrorParameter;
+        } else if(xSemaphoreTakeFromISR(mq->count, &yield) != pdPASS) {
+            stat = FuriStatusErrorResource;
+        } else {
+            if(xQueueReceiveFromISR(mq->urgent, msg_ptr, &yield) != pdPASS) {
+                furi_check(xQueueReceiveFromISR(mq->queue, msg_ptr, &yield) == pdPASS);
+            }
+            portYIELD_FROM_ISR(yield);
+        }
+    } else {
+        if(msg_ptr == NULL) {
+            stat = FuriStatusErrorParameter;
+        } else if(xSemaphoreTake(mq->count, (TickType_t)timeout) != pdPASS) {
+            stat = (timeout != 0U) ? FuriStatusErrorTimeout : FuriStatusErrorResource;
+        } else if(xQueueReceive(mq->urgent, msg_ptr, 0) != pdPASS) {
+            furi_check(xQueueReceive(mq->queue, msg_ptr, 0) == pdPASS);
+        }
+    }
+
+    return stat;
+}
+
 FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uint32_t timeout) {
-    QueueHandle_t hQueue = (QueueHandle_t)instance;
+    FuriMessageQueueInstance* mq = (FuriMessageQueueInstance*)instance;
+    if(mq == NULL) return FuriStatusErrorParameter;
+    if(mq->urgent) return furi_message_queue_receive(mq, msg_ptr, timeout);
+
+    QueueHandle_t hQueue = mq->queue;
     FuriStatus stat;
     BaseType_t yield;
 
@@ -96,15 +182,39 @@ FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uin
     return (stat);
 }
 
+uint32_t furi_message_queue_get_many(
+    FuriMessageQueue* instance,
+    void* msg_ptr,
+    uint32_t max_count,
+    uint32_t timeout) {
+    furi_assert(msg_ptr);
+
+    uint8_t* message = msg_ptr;
+    uint32_t msg_size = furi_message_queue_get_message_size(instance);
+    uint32_t count = 0;
+
+    // Only the first message is waited for, the rest is taken if it's already there
+    while(count < max_count &&
+          furi_message_queue_get(instance, message, count ? 0 : timeout) == FuriStatusOk) {
+        message += msg_size;
+        count++;
+    }
+
+    return count;
+}
+
 uint32_t furi_message_queue_get_capacity(FuriMessageQueue* instance) {
-    StaticQueue_t* mq = (StaticQueue_t*)instance;
+    FuriMessageQueueInstance* instance_mq = (FuriMessageQueueInstance*)instance;
     uint32_t capacity;
 
-    if(mq == NULL) {
+    if(instance_mq == NULL) {
         capacity = 0U;
     } else {
         /* capacity = pxQueue->uxLength */
-        capacity = mq->uxDummy4[1];
+        capacity = ((StaticQueue_t*)instance_mq->queue)->uxDummy4[1];
+        if(instance_mq->urgent) {
+            capacity += ((StaticQueue_t*)instance_mq->urgent)->uxDummy4[1];
+        }
     }
 
     /* Return maximum number of messages */
@@ -112,7 +222,8 @@ uint32_t furi_message_queue_get_capacity(FuriMessageQueue* instance) {
 }
 
 uint32_t furi_message_queue_get_message_size(FuriMessageQueue* instance) {
-    StaticQueue_t* mq = (StaticQueue_t*)instance;
+    StaticQueue_t* mq = instance ? (StaticQueue_t*)((FuriMessageQueueInstance*)instance)->queue :
+                                   NULL;
     uint32_t size;
 
     if(mq == NULL) {
@@ -127,15 +238,17 @@ uint32_t furi_message_queue_get_message_size(FuriMessageQueue* instance) {
 }
 
 uint32_t furi_message_queue_get_count(FuriMessageQueue* instance) {
-    QueueHandle_t hQueue = (QueueHandle_t)instance;
+    FuriMessageQueueInstance* mq = (FuriMessageQueueInstance*)instance;
     UBaseType_t count;
 
-    if(hQueue == NULL) {
+    if(mq == NULL) {
         count = 0U;
     } else if(furi_kernel_is_irq_or_masked() != 0U) {
-        count = uxQueueMessagesWaitingFromISR(hQueue);
+        count = uxQueueMessagesWaitingFromISR(mq->queue);
+        if(mq->urgent) count += uxQueueMessagesWaitingFromISR(mq->urgent);
     } else {
-        count = uxQueueMessagesWaiting(hQueue);
+        count = uxQueueMessagesWaiting(mq->queue);
+        if(mq->urgent) count += uxQueueMessagesWaiting(mq->urgent);
     }
 
     /* Return number of queued messages */
@@ -143,7 +256,8 @@ uint32_t furi_message_queue_get_count(FuriMessageQueue* instance) {
 }
 
 uint32_t furi_message_queue_get_space(FuriMessageQueue* instance) {
-    StaticQueue_t* mq = (StaticQueue_t*)instance;
+    StaticQueue_t* mq = instance ? (StaticQueue_t*)((FuriMessageQueueInstance*)instance)->queue :
+                                   NULL;
     uint32_t space;
     uint32_t isrm;
 
@@ -165,16 +279,20 @@ uint32_t furi_message_queue_get_space(FuriMessageQueue* instance) {
 }
 
 FuriStatus furi_message_queue_reset(FuriMessageQueue* instance) {
-    QueueHandle_t hQueue = (QueueHandle_t)instance;
+    FuriMessageQueueInstance* mq = (FuriMessageQueueInstance*)instance;
     FuriStatus stat;
 
     if(furi_kernel_is_irq_or_masked() != 0U) {
         stat = FuriStatusErrorISR;
-    } else if(hQueue == NULL) {
+    } else if(mq == NULL) {
         stat = FuriStatusErrorParameter;
     } else {
         stat = FuriStatusOk;
-        (void)xQueueReset(hQueue);
+        (void)xQueueReset(mq->queue);
+        if(mq->urgent) {
+            (void)xQueueReset(mq->urgent);
+            (void)xQueueReset(mq->count);
+        }
     }
 
     /* Return execution status */
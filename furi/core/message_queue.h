@@ -21,6 +21,21 @@ typedef void FuriMessageQueue;
  */
 FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size);
 
+/** Allocate furi message queue with urgent lane
+ *
+ * Messages put with furi_message_queue_put_urgent() are received before the
+ * ones put with furi_message_queue_put(), order within each lane is kept.
+ * With urgent_count set to 0 it is the same as furi_message_queue_alloc().
+ *
+ * @param[in]  msg_count     The message count
+ * @param[in]  urgent_count  The urgent message count
+ * @param[in]  msg_size      The message size
+ *
+ * @return     pointer to FuriMessageQueue instance
+ */
+FuriMessageQueue*
+    furi_message_queue_alloc_ex(uint32_t msg_count, uint32_t urgent_count, uint32_t msg_size);
+
 /** Free queue
  *
  * @param      instance  pointer to FuriMessageQueue instance
@@ -39,6 +54,22 @@ void furi_message_queue_free(FuriMessageQueue* instance);
 FuriStatus
     furi_message_queue_put(FuriMessageQueue* instance, const void* msg_ptr, uint32_t timeout);
 
+/** Put message into urgent lane of the queue
+ *
+ * Queue must be allocated with furi_message_queue_alloc_ex() and non-zero
+ * urgent count, crashes otherwise.
+ *
+ * @param      instance  pointer to FuriMessageQueue instance
+ * @param[in]  msg_ptr   The message pointer
+ * @param[in]  timeout   The timeout
+ *
+ * @return     The furi status.
+ */
+FuriStatus furi_message_queue_put_urgent(
+    FuriMessageQueue* instance,
+    const void* msg_ptr,
+    uint32_t timeout);
+
 /** Get message from queue
  *
  * @param      instance  pointer to FuriMessageQueue instance
@@ -50,6 +81,24 @@ FuriStatus
  */
 FuriStatus furi_message_queue_get(FuriMessageQueue* instance, void* msg_ptr, uint32_t timeout);
 
+/** Get several messages from queue
+ *
+ * Waits up to timeout for the first message, then takes the messages that are
+ * already in the queue without waiting.
+ *
+ * @param      instance   pointer to FuriMessageQueue instance
+ * @param      msg_ptr    array of max_count messages
+ * @param[in]  max_count  The maximum message count to get
+ * @param[in]  timeout    The timeout for the first message
+ *
+ * @return     Number of messages received, 0 on timeout
+ */
+uint32_t furi_message_queue_get_many(
+    FuriMessageQueue* instance,
+    void* msg_ptr,
+    uint32_t max_count,
+    uint32_t timeout);
+
 /** Get queue capacity
  *
  * @param      instance  pointer to FuriMessageQueue instance
@@ -2,12 +2,21 @@
 #include "memmgr.h"
 #include "check.h"
 #include "mutex.h"
+#include "message_queue.h"
 
+#include <string.h>
 #include <m-list.h>
 
 struct FuriPubSubSubscription {
     FuriPubSubCallback callback;
     void* callback_context;
+    uint32_t topics;
+    // Deferred dispatch only
+    FuriMessageQueue* queue;
+    void* message;
+    size_t message_size;
+    FuriThreadId thread_id;
+    uint32_t thread_flags;
 };
 
 LIST_DEF(FuriPubSubSubscriptionList, FuriPubSubSubscription, M_POD_OPLIST);
@@ -47,14 +56,76 @@ FuriPubSubSubscription*
     FuriPubSubSubscription* item = FuriPubSubSubscriptionList_push_raw(pubsub->items);
 
     // initialize item
+    memset(item, 0, sizeof(FuriPubSubSubscription));
     item->callback = callback;
     item->callback_context = callback_context;
+    item->topics = FURI_PUBSUB_TOPIC_ALL;
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
 
     return item;
 }
 
+FuriPubSubSubscription* furi_pubsub_subscribe_deferred(
+    FuriPubSub* pubsub,
+    FuriPubSubCallback callback,
+    void* callback_context,
+    size_t message_size,
+    size_t queue_size,
+    FuriThreadId thread_id,
+    uint32_t thread_flags) {
+    furi_assert(message_size);
+    furi_assert(queue_size);
+    furi_assert(thread_id);
+
+    // queue is ready before the first publish can reach it
+    FuriMessageQueue* queue = furi_message_queue_alloc(queue_size, message_size);
+    void* message = malloc(message_size);
+
+    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+    FuriPubSubSubscription* item = FuriPubSubSubscriptionList_push_raw(pubsub->items);
+
+    item->callback = callback;
+    item->callback_context = callback_context;
+    item->topics = FURI_PUBSUB_TOPIC_ALL;
+    item->queue = queue;
+    item->message = message;
+    item->message_size = message_size;
+    item->thread_id = thread_id;
+    item->thread_flags = thread_flags;
+
+    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+
+    return item;
+}
+
+void furi_pubsub_subscription_set_topics(
+    FuriPubSub* pubsub,
+    FuriPubSubSubscription* pubsub_subscription,
+    uint32_t topics) {
+    furi_assert(pubsub);
+    furi_assert(pubsub_subscription);
+
+    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+    pubsub_subscription->topics = topics;
+    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+}
+
+size_t furi_pubsub_subscription_dispatch(FuriPubSubSubscription* pubsub_subscription) {
+    furi_assert(pubsub_subscription);
+    furi_check(pubsub_subscription->queue);
+
+    size_t count = 0;
+    while(furi_message_queue_get(
+              pubsub_subscription->queue, pubsub_subscription->message, 0) == FuriStatusOk) {
+        pubsub_subscription->callback(
+            pubsub_subscription->message, pubsub_subscription->callback_context);
+        count++;
+    }
+
+    return count;
+}
+
 void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_subscription) {
     furi_assert(pubsub);
     furi_assert(pubsub_subscription);
@@ -70,6 +141,10 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
         // if the iterator is equal to our element
         if(item == pubsub_subscription) {
+            if(item->queue) {
+                furi_message_queue_free(item->queue);
+                free(item->message);
+            }
             FuriPubSubSubscriptionList_remove(pubsub->items, it);
             result = true;
             break;
@@ -81,6 +156,10 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 }
 
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
+    furi_pubsub_publish_topic(pubsub, FURI_PUBSUB_TOPIC_ALL, message);
+}
+
+void furi_pubsub_publish_topic(FuriPubSub* pubsub, uint32_t topic, void* message) {
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
 
     // iterate over subscribers
@@ -88,7 +167,16 @@ void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
     for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
         FuriPubSubSubscriptionList_next(it)) {
         const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
-        item->callback(message, item->callback_context);
+        if(!(item->topics & topic)) continue;
+
+        if(item->queue) {
+            // Copy goes to the subscriber thread, which runs the callback on dispatch
+            furi_check(
+                furi_message_queue_put(item->queue, message, FuriWaitForever) == FuriStatusOk);
+            furi_thread_flags_set(item->thread_id, item->thread_flags);
+        } else {
+            item->callback(message, item->callback_context);
+        }
     }
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
@@ -4,10 +4,18 @@
  */
 #pragma once
 
+#include "thread.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Topic mask that matches any topic */
+#define FURI_PUBSUB_TOPIC_ALL (0xFFFFFFFFU)
+
+/** Topic mask for enum value, values must be below 32 */
+#define FURI_PUBSUB_TOPIC(value) (1UL << (value))
+
 /** FuriPubSub Callback type */
 typedef void (*FuriPubSubCallback)(const void* message, void* context);
 
@@ -44,6 +52,62 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context);
 
+/** Subscribe to FuriPubSub with deferred dispatch
+ *
+ * Published messages are copied to the subscription queue and thread flags
+ * are set on the subscriber thread, which then calls
+ * furi_pubsub_subscription_dispatch() to run the callback. Publisher is not
+ * delayed by the callback, but waits for space if the queue is full. Only the
+ * message itself is copied, data it points to must outlive the dispatch.
+ *
+ * Threadsafe, Reentrable
+ *
+ * @param      pubsub            pointer to FuriPubSub instance
+ * @param[in]  callback          The callback
+ * @param      callback_context  The callback context
+ * @param[in]  message_size      The message size
+ * @param[in]  queue_size        The number of messages to hold
+ * @param[in]  thread_id         The subscriber thread
+ * @param[in]  thread_flags      The flags to set on the subscriber thread
+ *
+ * @return     pointer to FuriPubSubSubscription instance
+ */
+FuriPubSubSubscription* furi_pubsub_subscribe_deferred(
+    FuriPubSub* pubsub,
+    FuriPubSubCallback callback,
+    void* callback_context,
+    size_t message_size,
+    size_t queue_size,
+    FuriThreadId thread_id,
+    uint32_t thread_flags);
+
+/** Set topics the subscription receives
+ *
+ * Messages published with furi_pubsub_publish_topic() reach the callback only
+ * when topic matches the mask, messages published with furi_pubsub_publish()
+ * reach all subscriptions. New subscription receives all topics.
+ *
+ * Threadsafe, Reentrable
+ *
+ * @param      pubsub               pointer to FuriPubSub instance
+ * @param      pubsub_subscription  pointer to FuriPubSubSubscription instance
+ * @param[in]  topics               The topic mask
+ */
+void furi_pubsub_subscription_set_topics(
+    FuriPubSub* pubsub,
+    FuriPubSubSubscription* pubsub_subscription,
+    uint32_t topics);
+
+/** Run callback for messages queued on deferred subscription
+ *
+ * Call from the subscriber thread when its thread flags are set.
+ *
+ * @param      pubsub_subscription  pointer to deferred FuriPubSubSubscription
+ *
+ * @return     number of dispatched messages
+ */
+size_t furi_pubsub_subscription_dispatch(FuriPubSubSubscription* pubsub_subscription);
+
 /** Unsubscribe from FuriPubSub
  * 
  * No use of `pubsub_subscription` allowed after call of this method
@@ -63,6 +127,16 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
  */
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message);
 
+/** Publish message to subscriptions of the topic
+ *
+ * Threadsafe, Reentrable.
+ *
+ * @param      pubsub   pointer to FuriPubSub instance
+ * @param[in]  topic    The message topic, FURI_PUBSUB_TOPIC() of event type
+ * @param      message  message pointer to publish
+ */
+void furi_pubsub_publish_topic(FuriPubSub* pubsub, uint32_t topic, void* message);
+
 #ifdef __cplusplus
 }
 #endif
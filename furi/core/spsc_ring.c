@@ -0,0 +1,137 @@
+#include "spsc_ring.h"
+#include "check.h"
+#include "common_defines.h"
+#include "semaphore.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+struct FuriSpscRing {
+    uint8_t* data;
+    size_t record_size;
+    size_t mask;
+
+    // Written only by producer
+    volatile uint32_t head;
+    // Written only by consumer
+    volatile uint32_t tail;
+
+    // Set by consumer before going to sleep, cleared by whoever wakes it up
+    volatile bool consumer_waiting;
+    FuriSemaphore* wakeup;
+};
+
+FuriSpscRing* furi_spsc_ring_alloc(size_t record_size, size_t record_count) {
+    furi_assert(record_size > 0);
+    furi_assert(record_count > 0);
+    furi_check((record_count & (record_count - 1)) == 0);
+
+    FuriSpscRing* ring = malloc(sizeof(FuriSpscRing));
+    ring->data = malloc(record_size * record_count);
+    ring->record_size = record_size;
+    ring->mask = record_count - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->consumer_waiting = false;
+    ring->wakeup = furi_semaphore_alloc(1, 0);
+
+    return ring;
+}
+
+void furi_spsc_ring_free(FuriSpscRing* ring) {
+    furi_assert(ring);
+
+    furi_semaphore_free(ring->wakeup);
+    free(ring->data);
+    free(ring);
+}
+
+bool furi_spsc_ring_push(FuriSpscRing* ring, const void* record) {
+    furi_assert(ring);
+    furi_assert(record);
+
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if(head - tail > ring->mask) return false;
+
+    memcpy(&ring->data[(head & ring->mask) * ring->record_size], record, ring->record_size);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+    // Only pay for kernel call when consumer is sleeping
+    if(__atomic_load_n(&ring->consumer_waiting, __ATOMIC_ACQUIRE)) {
+        ring->consumer_waiting = false;
+        furi_semaphore_release(ring->wakeup);
+    }
+
+    return true;
+}
+
+static size_t furi_spsc_ring_pop_available(FuriSpscRing* ring, void* records, size_t max_count) {
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    size_t count = MIN((size_t)(head - tail), max_count);
+    if(count == 0) return 0;
+
+    size_t capacity = ring->mask + 1;
+    size_t start = tail & ring->mask;
+    size_t first = MIN(count, capacity - start);
+
+    uint8_t* output = records;
+    memcpy(output, &ring->data[start * ring->record_size], first * ring->record_size);
+    if(first < count) {
+        memcpy(
+            &output[first * ring->record_size], ring->data, (count - first) * ring->record_size);
+    }
+
+    __atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+size_t furi_spsc_ring_pop(FuriSpscRing* ring, void* records, size_t max_count, uint32_t timeout) {
+    furi_assert(ring);
+    furi_assert(records);
+    furi_assert(!FURI_IS_IRQ_MODE() || (timeout == 0));
+
+    size_t count = 0;
+
+    for(;;) {
+        count = furi_spsc_ring_pop_available(ring, records, max_count);
+        if(count || (timeout == 0)) break;
+
+        __atomic_store_n(&ring->consumer_waiting, true, __ATOMIC_RELEASE);
+
+        // Producer may have pushed before it could see the flag
+        if(furi_spsc_ring_get_count(ring)) {
+            ring->consumer_waiting = false;
+            continue;
+        }
+
+        furi_semaphore_acquire(ring->wakeup, timeout);
+        ring->consumer_waiting = false;
+
+        count = furi_spsc_ring_pop_available(ring, records, max_count);
+        if(count || (timeout != FuriWaitForever)) break;
+    }
+
+    return count;
+}
+
+size_t furi_spsc_ring_get_count(FuriSpscRing* ring) {
+    furi_assert(ring);
+
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+void furi_spsc_ring_reset(FuriSpscRing* ring) {
+    furi_assert(ring);
+
+    ring->tail = ring->head;
+    ring->consumer_waiting = false;
+    // Drop pending wakeup, if any
+    furi_semaphore_acquire(ring->wakeup, 0);
+}
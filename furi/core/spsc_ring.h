@@ -0,0 +1,82 @@
+/**
+ * @file spsc_ring.h
+ * Furi single-producer single-consumer ring primitive.
+ *
+ * Lock-free ring of fixed-size records, intended for ISR to thread pipes
+ * with high record rate (radio, IR and RFID capture).
+ * Push is a couple of memory accesses and never enters critical section,
+ * consumer is woken up only if it is actually waiting for data.
+ *
+ * ***NOTE***: Ring implementation assumes there is only one task or
+ * interrupt that pushes records (the producer), and only one task
+ * that pops records (the consumer).
+ */
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FuriSpscRing FuriSpscRing;
+
+/**
+ * @brief Allocate ring instance.
+ *
+ * @param record_size Size of one record in bytes.
+ * @param record_count Ring capacity in records, must be a power of 2.
+ * @return The ring instance.
+ */
+FuriSpscRing* furi_spsc_ring_alloc(size_t record_size, size_t record_count);
+
+/**
+ * @brief Free ring instance.
+ *
+ * @param ring The ring instance.
+ */
+void furi_spsc_ring_free(FuriSpscRing* ring);
+
+/**
+ * @brief Push one record to the ring. Never blocks, safe to call from ISR.
+ * Wakes up the consumer if it is waiting for data.
+ *
+ * @param ring The ring instance.
+ * @param record Pointer to the record, record_size bytes will be copied.
+ * @return true if record was pushed, false if ring is full.
+ */
+bool furi_spsc_ring_push(FuriSpscRing* ring, const void* record);
+
+/**
+ * @brief Pop up to max_count records from the ring.
+ * Can't be called from ISR if timeout is not zero.
+ *
+ * @param ring The ring instance.
+ * @param records Buffer for max_count records.
+ * @param max_count Maximum number of records to pop.
+ * @param timeout The maximum amount of time to wait for at least one record.
+ * Will return immediately if timeout is zero.
+ * Setting timeout to FuriWaitForever will cause the task to wait indefinitely.
+ * @return Number of records copied to the buffer, 0 on timeout.
+ */
+size_t furi_spsc_ring_pop(FuriSpscRing* ring, void* records, size_t max_count, uint32_t timeout);
+
+/**
+ * @brief Get number of records currently stored in the ring.
+ *
+ * @param ring The ring instance.
+ * @return Number of records.
+ */
+size_t furi_spsc_ring_get_count(FuriSpscRing* ring);
+
+/**
+ * @brief Drop all records. Must not be called while producer is active.
+ *
+ * @param ring The ring instance.
+ */
+void furi_spsc_ring_reset(FuriSpscRing* ring);
+
+#ifdef __cplusplus
+}
+#endif
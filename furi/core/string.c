@@ -1,8 +1,23 @@
 #include "string.h"
+#include "check.h"
+#include "common_defines.h"
 #include <m-string.h>
+#include <ctype.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Strings up to this size, final null char included, are stored in FuriString
+ * itself, so that short strings never take a separate heap block */
+#define FURI_STRING_INLINE_SIZE 24U
 
 struct FuriString {
-    string_t string;
+    size_t size;
+    size_t capacity; // heap buffer size, 0 while string is inline
+    union {
+        char* ptr;
+        char buffer[FURI_STRING_INLINE_SIZE];
+    };
 };
 
 #undef furi_string_alloc_set
@@ -22,23 +37,105 @@ struct FuriString {
 #undef furi_string_trim
 #undef furi_string_cat
 
+static inline char* furi_string_data(FuriString* s) {
+    return s->capacity ? s->ptr : s->buffer;
+}
+
+static inline const char* furi_string_cdata(const FuriString* s) {
+    return s->capacity ? s->ptr : s->buffer;
+}
+
+static inline size_t furi_string_capacity(const FuriString* s) {
+    return s->capacity ? s->capacity : FURI_STRING_INLINE_SIZE;
+}
+
+static void furi_string_init(FuriString* s) {
+    s->size = 0;
+    s->capacity = 0;
+    s->buffer[0] = '\0';
+}
+
+/* Make room for size characters and final null char, keeps content */
+static char* furi_string_fit(FuriString* s, size_t size) {
+    size_t capacity = furi_string_capacity(s);
+    if(size < capacity) return furi_string_data(s);
+
+    // Grow by half at least, so that appending char by char stays linear
+    capacity = MAX(size + 1, capacity + capacity / 2);
+    if(s->capacity) {
+        s->ptr = realloc(s->ptr, capacity); //-V701
+    } else {
+        char* ptr = malloc(capacity);
+        memcpy(ptr, s->buffer, s->size + 1);
+        s->ptr = ptr;
+    }
+    s->capacity = capacity;
+
+    return s->ptr;
+}
+
+/* Replace len characters at pos with size bytes of data, data may point into the string */
+static void
+    furi_string_splice(FuriString* s, size_t pos, size_t len, const char* data, size_t size) {
+    furi_check(pos <= s->size);
+    len = MIN(len, s->size - pos);
+
+    char* copy = NULL;
+    const char* current = furi_string_cdata(s);
+    if(size && data >= current && data <= current + s->size) {
+        copy = malloc(size);
+        memcpy(copy, data, size);
+        data = copy;
+    }
+
+    size_t new_size = s->size - len + size;
+    char* ptr = furi_string_fit(s, new_size);
+    memmove(ptr + pos + size, ptr + pos + len, s->size - pos - len + 1);
+    if(size) memcpy(ptr + pos, data, size);
+    s->size = new_size;
+
+    free(copy);
+}
+
+static int
+    furi_string_vprintf_at(FuriString* s, size_t pos, const char format[], va_list args) {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    char* ptr = furi_string_data(s);
+    int size = vsnprintf(ptr + pos, furi_string_capacity(s) - pos, format, args_copy);
+    va_end(args_copy);
+
+    if(size < 0) {
+        ptr[pos] = '\0';
+        s->size = pos;
+    } else {
+        if(pos + size >= furi_string_capacity(s)) {
+            ptr = furi_string_fit(s, pos + size);
+            vsnprintf(ptr + pos, size + 1, format, args);
+        }
+        s->size = pos + size;
+    }
+
+    return size;
+}
+
 FuriString* furi_string_alloc() {
     FuriString* string = malloc(sizeof(FuriString));
-    string_init(string->string);
+    furi_string_init(string);
     return string;
 }
 
 FuriString* furi_string_alloc_set(const FuriString* s) {
-    FuriString* string = malloc(sizeof(FuriString)); //-V799
-    string_init_set(string->string, s->string);
+    FuriString* string = furi_string_alloc();
+    furi_string_splice(string, 0, 0, furi_string_cdata(s), s->size);
     return string;
-} //-V773
+}
 
 FuriString* furi_string_alloc_set_str(const char cstr[]) {
-    FuriString* string = malloc(sizeof(FuriString)); //-V799
-    string_init_set(string->string, cstr);
+    FuriString* string = furi_string_alloc();
+    furi_string_splice(string, 0, 0, cstr, strlen(cstr));
     return string;
-} //-V773
+}
 
 FuriString* furi_string_alloc_printf(const char format[], ...) {
     va_list args;
@@ -49,107 +146,143 @@ FuriString* furi_string_alloc_printf(const char format[], ...) {
 }
 
 FuriString* furi_string_alloc_vprintf(const char format[], va_list args) {
-    FuriString* string = malloc(sizeof(FuriString));
-    string_init_vprintf(string->string, format, args);
+    FuriString* string = furi_string_alloc();
+    furi_string_vprintf_at(string, 0, format, args);
     return string;
 }
 
 FuriString* furi_string_alloc_move(FuriString* s) {
     FuriString* string = malloc(sizeof(FuriString));
-    string_init_move(string->string, s->string);
+    *string = *s;
     free(s);
     return string;
 }
 
 void furi_string_free(FuriString* s) {
-    string_clear(s->string);
+    if(s->capacity) free(s->ptr);
     free(s);
 }
 
 void furi_string_reserve(FuriString* s, size_t alloc) {
-    string_reserve(s->string, alloc);
+    alloc = MAX(alloc, s->size + 1);
+
+    if(alloc <= FURI_STRING_INLINE_SIZE) {
+        if(s->capacity) {
+            char* ptr = s->ptr;
+            memcpy(s->buffer, ptr, s->size + 1);
+            s->capacity = 0;
+            free(ptr);
+        }
+    } else if(alloc != s->capacity) {
+        if(s->capacity) {
+            s->ptr = realloc(s->ptr, alloc); //-V701
+        } else {
+            char* ptr = malloc(alloc);
+            memcpy(ptr, s->buffer, s->size + 1);
+            s->ptr = ptr;
+        }
+        s->capacity = alloc;
+    }
 }
 
 void furi_string_reset(FuriString* s) {
-    string_reset(s->string);
+    s->size = 0;
+    furi_string_data(s)[0] = '\0';
 }
 
 void furi_string_swap(FuriString* v1, FuriString* v2) {
-    string_swap(v1->string, v2->string);
+    FuriString tmp = *v1;
+    *v1 = *v2;
+    *v2 = tmp;
 }
 
 void furi_string_move(FuriString* v1, FuriString* v2) {
-    string_clear(v1->string);
-    string_init_move(v1->string, v2->string);
+    if(v1->capacity) free(v1->ptr);
+    *v1 = *v2;
     free(v2);
 }
 
 size_t furi_string_hash(const FuriString* v) {
-    return string_hash(v->string);
+    return m_core_hash(furi_string_cdata(v), v->size);
 }
 
 char furi_string_get_char(const FuriString* v, size_t index) {
-    return string_get_char(v->string, index);
+    furi_check(index < v->size);
+    return furi_string_cdata(v)[index];
 }
 
 const char* furi_string_get_cstr(const FuriString* s) {
-    return string_get_cstr(s->string);
+    return furi_string_cdata(s);
 }
 
 void furi_string_set(FuriString* s, FuriString* source) {
-    string_set(s->string, source->string);
+    furi_string_splice(s, 0, s->size, furi_string_cdata(source), source->size);
 }
 
 void furi_string_set_str(FuriString* s, const char cstr[]) {
-    string_set(s->string, cstr);
+    furi_string_splice(s, 0, s->size, cstr, strlen(cstr));
 }
 
 void furi_string_set_strn(FuriString* s, const char str[], size_t n) {
-    string_set_strn(s->string, str, n);
+    const char* end = memchr(str, '\0', n);
+    furi_string_splice(s, 0, s->size, str, end ? (size_t)(end - str) : n);
 }
 
 void furi_string_set_char(FuriString* s, size_t index, const char c) {
-    string_set_char(s->string, index, c);
+    furi_check(index < s->size);
+    furi_string_data(s)[index] = c;
 }
 
 int furi_string_cmp(const FuriString* s1, const FuriString* s2) {
-    return string_cmp(s1->string, s2->string);
+    return strcmp(furi_string_cdata(s1), furi_string_cdata(s2));
 }
 
 int furi_string_cmp_str(const FuriString* s1, const char str[]) {
-    return string_cmp(s1->string, str);
+    return strcmp(furi_string_cdata(s1), str);
 }
 
 int furi_string_cmpi(const FuriString* v1, const FuriString* v2) {
-    return string_cmpi(v1->string, v2->string);
+    return furi_string_cmpi_str(v1, furi_string_cdata(v2));
 }
 
 int furi_string_cmpi_str(const FuriString* v1, const char p2[]) {
-    return string_cmpi_str(v1->string, p2);
+    const char* p1 = furi_string_cdata(v1);
+    int c1, c2;
+    do {
+        c1 = toupper((unsigned char)*p1++);
+        c2 = toupper((unsigned char)*p2++);
+    } while(c1 == c2 && c1 != '\0');
+    return c1 - c2;
 }
 
 size_t furi_string_search(const FuriString* v, const FuriString* needle, size_t start) {
-    return string_search(v->string, needle->string, start);
+    return furi_string_search_str(v, furi_string_cdata(needle), start);
 }
 
 size_t furi_string_search_str(const FuriString* v, const char needle[], size_t start) {
-    return string_search(v->string, needle, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* ptr = furi_string_cdata(v);
+    const char* found = strstr(ptr + start, needle);
+    return found ? (size_t)(found - ptr) : FURI_STRING_FAILURE;
 }
 
 bool furi_string_equal(const FuriString* v1, const FuriString* v2) {
-    return string_equal_p(v1->string, v2->string);
+    return v1->size == v2->size &&
+           memcmp(furi_string_cdata(v1), furi_string_cdata(v2), v1->size) == 0;
 }
 
 bool furi_string_equal_str(const FuriString* v1, const char v2[]) {
-    return string_equal_p(v1->string, v2);
+    return strcmp(furi_string_cdata(v1), v2) == 0;
 }
 
 void furi_string_push_back(FuriString* v, char c) {
-    string_push_back(v->string, c);
+    char* ptr = furi_string_fit(v, v->size + 1);
+    ptr[v->size++] = c;
+    ptr[v->size] = '\0';
 }
 
 size_t furi_string_size(const FuriString* s) {
-    return string_size(s->string);
+    return s->size;
 }
 
 int furi_string_printf(FuriString* v, const char format[], ...) {
@@ -161,7 +294,7 @@ int furi_string_printf(FuriString* v, const char format[], ...) {
 }
 
 int furi_string_vprintf(FuriString* v, const char format[], va_list args) {
-    return string_vprintf(v->string, format, args);
+    return furi_string_vprintf_at(v, 0, format, args);
 }
 
 int furi_string_cat_printf(FuriString* v, const char format[], ...) {
@@ -173,96 +306,168 @@ int furi_string_cat_printf(FuriString* v, const char format[], ...) {
 }
 
 int furi_string_cat_vprintf(FuriString* v, const char format[], va_list args) {
-    FuriString* string = furi_string_alloc();
-    int ret = furi_string_vprintf(string, format, args);
-    furi_string_cat(v, string);
-    furi_string_free(string);
-    return ret;
+    return furi_string_vprintf_at(v, v->size, format, args);
 }
 
 bool furi_string_empty(const FuriString* v) {
-    return string_empty_p(v->string);
+    return v->size == 0;
 }
 
 void furi_string_replace_at(FuriString* v, size_t pos, size_t len, const char str2[]) {
-    string_replace_at(v->string, pos, len, str2);
+    furi_string_splice(v, pos, len, str2, strlen(str2));
 }
 
 size_t
     furi_string_replace(FuriString* string, FuriString* needle, FuriString* replace, size_t start) {
-    return string_replace(string->string, needle->string, replace->string, start);
+    return furi_string_replace_str(
+        string, furi_string_cdata(needle), furi_string_cdata(replace), start);
 }
 
 size_t furi_string_replace_str(FuriString* v, const char str1[], const char str2[], size_t start) {
-    return string_replace_str(v->string, str1, str2, start);
+    size_t i = furi_string_search_str(v, str1, start);
+    if(i != FURI_STRING_FAILURE) {
+        furi_string_splice(v, i, strlen(str1), str2, strlen(str2));
+    }
+    return i;
 }
 
 void furi_string_replace_all_str(FuriString* v, const char str1[], const char str2[]) {
-    string_replace_all_str(v->string, str1, str2);
+    size_t str1_size = strlen(str1);
+    size_t str2_size = strlen(str2);
+    if(!str1_size) return;
+
+    for(size_t i = furi_string_search_str(v, str1, 0); i != FURI_STRING_FAILURE;
+        i = furi_string_search_str(v, str1, i + str2_size)) {
+        furi_string_splice(v, i, str1_size, str2, str2_size);
+    }
 }
 
 void furi_string_replace_all(FuriString* v, const FuriString* str1, const FuriString* str2) {
-    string_replace_all(v->string, str1->string, str2->string);
+    furi_string_replace_all_str(v, furi_string_cdata(str1), furi_string_cdata(str2));
 }
 
 bool furi_string_start_with(const FuriString* v, const FuriString* v2) {
-    return string_start_with_string_p(v->string, v2->string);
+    return v->size >= v2->size &&
+           memcmp(furi_string_cdata(v), furi_string_cdata(v2), v2->size) == 0;
 }
 
 bool furi_string_start_with_str(const FuriString* v, const char str[]) {
-    return string_start_with_str_p(v->string, str);
+    return strncmp(furi_string_cdata(v), str, strlen(str)) == 0;
 }
 
 bool furi_string_end_with(const FuriString* v, const FuriString* v2) {
-    return string_end_with_string_p(v->string, v2->string);
+    return v->size >= v2->size &&
+           memcmp(furi_string_cdata(v) + v->size - v2->size, furi_string_cdata(v2), v2->size) ==
+               0;
 }
 
 bool furi_string_end_with_str(const FuriString* v, const char str[]) {
-    return string_end_with_str_p(v->string, str);
+    size_t size = strlen(str);
+    return v->size >= size && memcmp(furi_string_cdata(v) + v->size - size, str, size) == 0;
 }
 
 size_t furi_string_search_char(const FuriString* v, char c, size_t start) {
-    return string_search_char(v->string, c, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* ptr = furi_string_cdata(v);
+    const char* found = strchr(ptr + start, c);
+    return found ? (size_t)(found - ptr) : FURI_STRING_FAILURE;
 }
 
 size_t furi_string_search_rchar(const FuriString* v, char c, size_t start) {
-    return string_search_rchar(v->string, c, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* ptr = furi_string_cdata(v);
+    const char* found = strrchr(ptr + start, c);
+    return found ? (size_t)(found - ptr) : FURI_STRING_FAILURE;
 }
 
 void furi_string_left(FuriString* v, size_t index) {
-    string_left(v->string, index);
+    if(index < v->size) {
+        furi_string_data(v)[index] = '\0';
+        v->size = index;
+    }
 }
 
 void furi_string_right(FuriString* v, size_t index) {
-    string_right(v->string, index);
+    furi_string_splice(v, 0, index, NULL, 0);
 }
 
 void furi_string_mid(FuriString* v, size_t index, size_t size) {
-    string_mid(v->string, index, size);
+    furi_string_right(v, index);
+    furi_string_left(v, size);
 }
 
 void furi_string_trim(FuriString* v, const char charac[]) {
-    string_strim(v->string, charac);
+    const char* ptr = furi_string_cdata(v);
+    size_t end = v->size;
+    while(end > 0 && strchr(charac, ptr[end - 1])) {
+        end--;
+    }
+    furi_string_left(v, end);
+
+    size_t begin = 0;
+    while(begin < end && strchr(charac, ptr[begin])) {
+        begin++;
+    }
+    furi_string_right(v, begin);
 }
 
 void furi_string_cat(FuriString* v, const FuriString* v2) {
-    string_cat(v->string, v2->string);
+    furi_string_splice(v, v->size, 0, furi_string_cdata(v2), v2->size);
 }
 
 void furi_string_cat_str(FuriString* v, const char str[]) {
-    string_cat(v->string, str);
+    furi_string_splice(v, v->size, 0, str, strlen(str));
+}
+
+void furi_string_cat_strn(FuriString* v, const char str[], size_t n) {
+    furi_string_splice(v, v->size, 0, str, n);
 }
 
 void furi_string_set_n(FuriString* v, const FuriString* ref, size_t offset, size_t length) {
-    string_set_n(v->string, ref->string, offset, length);
+    furi_check(offset <= ref->size);
+    length = MIN(length, ref->size - offset);
+    furi_string_splice(v, 0, v->size, furi_string_cdata(ref) + offset, length);
 }
 
 size_t furi_string_utf8_length(FuriString* str) {
-    return string_length_u(str->string);
+    size_t length = 0;
+    FuriStringUTF8State state = FuriStringUTF8StateStarting;
+    FuriStringUnicodeValue unicode = 0;
+
+    for(const char* ptr = furi_string_cdata(str); *ptr; ptr++) {
+        furi_string_utf8_decode(*ptr, &state, &unicode);
+        if(state == FuriStringUTF8StateError) return SIZE_MAX;
+        if(state == FuriStringUTF8StateStarting) length++;
+    }
+
+    return length;
 }
 
 void furi_string_utf8_push(FuriString* str, FuriStringUnicodeValue u) {
-    string_push_u(str->string, u);
+    char buffer[4];
+    size_t size;
+
+    if(u < 0x80) {
+        buffer[0] = u;
+        size = 1;
+    } else if(u < 0x800) {
+        buffer[0] = 0xC0 | (u >> 6);
+        buffer[1] = 0x80 | (u & 0x3F);
+        size = 2;
+    } else if(u < 0x10000) {
+        buffer[0] = 0xE0 | (u >> 12);
+        buffer[1] = 0x80 | ((u >> 6) & 0x3F);
+        buffer[2] = 0x80 | (u & 0x3F);
+        size = 3;
+    } else {
+        buffer[0] = 0xF0 | (u >> 18);
+        buffer[1] = 0x80 | ((u >> 12) & 0x3F);
+        buffer[2] = 0x80 | ((u >> 6) & 0x3F);
+        buffer[3] = 0x80 | (u & 0x3F);
+        size = 4;
+    }
+
+    furi_string_splice(str, str->size, 0, buffer, size);
 }
 
 static m_str1ng_utf8_state_e furi_state_to_state(FuriStringUTF8State state) {
@@ -254,6 +254,14 @@ void furi_string_cat(FuriString* string_1, const FuriString* string_2);
  */
 void furi_string_cat_str(FuriString* string_1, const char cstring_2[]);
 
+/**
+ * @brief Append the n first characters of the C string to the string.
+ * @param string 
+ * @param cstring 
+ * @param length 
+ */
+void furi_string_cat_strn(FuriString* string, const char cstring[], size_t length);
+
 /**
  * @brief Append to the string the formatted string of the given printf format.
  * @param string 
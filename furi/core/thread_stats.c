@@ -0,0 +1,204 @@
+#include "thread_stats.h"
+#include "common_defines.h"
+
+#include <string.h>
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Threads beyond this are not accounted, slot is kept in the TCB task number */
+#define FURI_THREAD_STATS_SLOTS 40
+
+typedef struct {
+    TaskHandle_t task;
+    uint64_t runtime;
+    uint32_t switches;
+    uint32_t latency_max;
+    uint32_t ready_at;
+    bool ready;
+} FuriThreadStatsSlot;
+
+typedef struct {
+    volatile bool enabled;
+    FuriThreadStatsSlot slots[FURI_THREAD_STATS_SLOTS];
+
+    // Scheduler hooks only, run with kernel interrupts masked
+    TaskHandle_t current;
+    uint32_t switched_in_at;
+    uint32_t switched_in_isr;
+    uint32_t start_tick;
+    uint32_t switches;
+    uint64_t isr_total;
+
+    // Interrupt hooks, wraps around, consumed by scheduler hooks
+    volatile uint32_t isr;
+    uint32_t isr_nesting;
+    uint32_t isr_start;
+} FuriThreadStatsState;
+
+static FuriThreadStatsState furi_thread_stats = {0};
+
+static inline FuriThreadStatsSlot* furi_thread_stats_slot(void* task) {
+    UBaseType_t number = uxTaskGetTaskNumber((TaskHandle_t)task);
+    if(number == 0 || number > FURI_THREAD_STATS_SLOTS) return NULL;
+    return &furi_thread_stats.slots[number - 1];
+}
+
+void furi_thread_stats_task_create(void* task) {
+    vTaskSetTaskNumber(task, 0);
+    for(size_t i = 0; i < FURI_THREAD_STATS_SLOTS; i++) {
+        FuriThreadStatsSlot* slot = &furi_thread_stats.slots[i];
+        if(slot->task == NULL) {
+            memset(slot, 0, sizeof(FuriThreadStatsSlot));
+            slot->task = task;
+            vTaskSetTaskNumber(task, i + 1);
+            break;
+        }
+    }
+}
+
+void furi_thread_stats_task_delete(void* task) {
+    FuriThreadStatsSlot* slot = furi_thread_stats_slot(task);
+    if(slot) {
+        slot->task = NULL;
+        vTaskSetTaskNumber(task, 0);
+    }
+}
+
+void furi_thread_stats_task_ready(void* task) {
+    if(!furi_thread_stats.enabled) return;
+
+    FuriThreadStatsSlot* slot = furi_thread_stats_slot(task);
+    if(slot && !slot->ready) {
+        slot->ready_at = DWT->CYCCNT;
+        slot->ready = true;
+    }
+}
+
+void furi_thread_stats_switched_out(void* task) {
+    if(!furi_thread_stats.enabled) return;
+
+    uint32_t now = DWT->CYCCNT;
+    uint32_t isr = furi_thread_stats.isr;
+    uint32_t isr_time = isr - furi_thread_stats.switched_in_isr;
+    uint32_t time = now - furi_thread_stats.switched_in_at;
+    furi_thread_stats.isr_total += isr_time;
+
+    FuriThreadStatsSlot* slot = furi_thread_stats_slot(task);
+    if(slot) {
+        slot->runtime += time - MIN(time, isr_time);
+    }
+
+    furi_thread_stats.switched_in_at = now;
+    furi_thread_stats.switched_in_isr = isr;
+}
+
+void furi_thread_stats_switched_in(void* task) {
+    if(!furi_thread_stats.enabled) return;
+
+    uint32_t now = DWT->CYCCNT;
+    FuriThreadStatsSlot* slot = furi_thread_stats_slot(task);
+
+    if(slot) {
+        if(slot->ready) {
+            slot->latency_max = MAX(slot->latency_max, now - slot->ready_at);
+            slot->ready = false;
+        }
+        if(task != furi_thread_stats.current) {
+            slot->switches++;
+        }
+    }
+    if(task != furi_thread_stats.current) {
+        furi_thread_stats.switches++;
+        furi_thread_stats.current = task;
+    }
+
+    // Interrupt time keeps counting from switch out, so that none is lost
+    furi_thread_stats.switched_in_at = now;
+}
+
+void furi_thread_stats_isr_enter(void) {
+    if(!furi_thread_stats.enabled) return;
+
+    // Nested interrupts of any priority share the counters
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if(furi_thread_stats.isr_nesting++ == 0) {
+        furi_thread_stats.isr_start = DWT->CYCCNT;
+    }
+    __set_PRIMASK(primask);
+}
+
+void furi_thread_stats_isr_exit(void) {
+    if(!furi_thread_stats.enabled) return;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    // Collection could be enabled while this interrupt was running
+    if(furi_thread_stats.isr_nesting && --furi_thread_stats.isr_nesting == 0) {
+        furi_thread_stats.isr += DWT->CYCCNT - furi_thread_stats.isr_start;
+    }
+    __set_PRIMASK(primask);
+}
+
+void furi_thread_stats_set_enabled(bool enabled) {
+    if(enabled) {
+        furi_thread_stats_reset();
+    }
+    furi_thread_stats.enabled = enabled;
+}
+
+bool furi_thread_stats_is_enabled(void) {
+    return furi_thread_stats.enabled;
+}
+
+void furi_thread_stats_reset(void) {
+    FURI_CRITICAL_ENTER();
+
+    for(size_t i = 0; i < FURI_THREAD_STATS_SLOTS; i++) {
+        FuriThreadStatsSlot* slot = &furi_thread_stats.slots[i];
+        slot->runtime = 0;
+        slot->switches = 0;
+        slot->latency_max = 0;
+        slot->ready = false;
+    }
+
+    // Called from thread, so no interrupt is in progress
+    furi_thread_stats.isr_nesting = 0;
+    furi_thread_stats.current = xTaskGetCurrentTaskHandle();
+    furi_thread_stats.switched_in_at = DWT->CYCCNT;
+    furi_thread_stats.switched_in_isr = furi_thread_stats.isr;
+    furi_thread_stats.start_tick = xTaskGetTickCount();
+    furi_thread_stats.switches = 0;
+    furi_thread_stats.isr_total = 0;
+
+    FURI_CRITICAL_EXIT();
+}
+
+size_t
+    furi_thread_stats_get(FuriThreadStats* stats, size_t max_count, FuriThreadStatsTotal* total) {
+    size_t count = 0;
+
+    FURI_CRITICAL_ENTER();
+
+    for(size_t i = 0; i < FURI_THREAD_STATS_SLOTS && count < max_count; i++) {
+        const FuriThreadStatsSlot* slot = &furi_thread_stats.slots[i];
+        if(slot->task == NULL) continue;
+
+        stats[count].thread_id = (FuriThreadId)slot->task;
+        stats[count].runtime = slot->runtime;
+        stats[count].switches = slot->switches;
+        stats[count].latency_max = slot->latency_max;
+        count++;
+    }
+
+    if(total) {
+        uint32_t ticks = xTaskGetTickCount() - furi_thread_stats.start_tick;
+        total->window = (uint64_t)ticks * (SystemCoreClock / configTICK_RATE_HZ);
+        total->isr = furi_thread_stats.isr_total;
+        total->switches = furi_thread_stats.switches;
+    }
+
+    FURI_CRITICAL_EXIT();
+
+    return count;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file thread_stats.h
+ * Furi thread run-time statistics
+ *
+ * Counts CPU time, context switches and wakeup latency of every thread with
+ * the DWT cycle counter from scheduler hooks, and time spent in interrupts
+ * dispatched by furi_hal_interrupt. Collection is off by default, hooks cost
+ * one branch until it is enabled.
+ *
+ * Cycle counter stops in deep sleep, so idle thread shows awake idle time
+ * only and the rest of the window is sleep. Thread time excludes interrupts
+ * serviced while it was running.
+ */
+#pragma once
+
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Thread statistics, times are in CPU cycles */
+typedef struct {
+    FuriThreadId thread_id;
+    uint64_t runtime; /**< Time spent running */
+    uint32_t switches; /**< Number of times the thread was switched in */
+    uint32_t latency_max; /**< Longest time from becoming ready to running */
+} FuriThreadStats;
+
+/** System statistics, times are in CPU cycles */
+typedef struct {
+    uint64_t window; /**< Time since collection start, sleep included */
+    uint64_t isr; /**< Time spent in interrupts */
+    uint32_t switches; /**< Number of context switches */
+} FuriThreadStatsTotal;
+
+/** Enable or disable collection, enabling resets collected statistics
+ *
+ * @param[in]  enabled  true to enable
+ */
+void furi_thread_stats_set_enabled(bool enabled);
+
+/** Check if collection is enabled
+ *
+ * @return     true if enabled
+ */
+bool furi_thread_stats_is_enabled(void);
+
+/** Reset collected statistics and start new window */
+void furi_thread_stats_reset(void);
+
+/** Get statistics collected since the last reset
+ *
+ * @param      stats      array for max_count thread statistics
+ * @param[in]  max_count  The maximum number of threads to get
+ * @param      total      system statistics, can be NULL
+ *
+ * @return     number of threads written to stats
+ */
+size_t
+    furi_thread_stats_get(FuriThreadStats* stats, size_t max_count, FuriThreadStatsTotal* total);
+
+/** Interrupt dispatcher hook, call on interrupt entry */
+void furi_thread_stats_isr_enter(void);
+
+/** Interrupt dispatcher hook, call on interrupt exit */
+void furi_thread_stats_isr_exit(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,8 +12,35 @@ const char* current_timer_name = NULL;
 typedef struct {
     FuriTimerCallback func;
     void* context;
+    FuriTimerType type;
+    uint32_t slack;
+    uint32_t period;
+    uint32_t deadline;
 } TimerCallback_t;
 
+static TimerCallback_t* furi_timer_get_callback(TimerHandle_t hTimer) {
+    /* Remove dynamic allocation flag */
+    return (TimerCallback_t*)((uint32_t)pvTimerGetTimerID(hTimer) & ~1U);
+}
+
+/* Round deadline up to the largest power of two grid that fits in slack, so that
+ * timers with slack expire on the same ticks and share wakeups */
+static uint32_t furi_timer_align(uint32_t deadline, uint32_t slack) {
+    uint32_t grid = 1U << (31 - __builtin_clz(slack + 1));
+    return (deadline + grid - 1) & ~(grid - 1);
+}
+
+/* Get period that makes timer expire on aligned deadline */
+static uint32_t furi_timer_get_aligned_period(TimerCallback_t* callb, uint32_t ticks) {
+    // Period is kept only while timer is aligned
+    callb->period = callb->slack ? ticks : 0;
+    if(!callb->period) return ticks;
+
+    uint32_t now = xTaskGetTickCount();
+    callb->deadline = now + ticks;
+    return furi_timer_align(callb->deadline, callb->slack) - now;
+}
+
 const char* furi_timer_get_current_name() {
     return current_timer_name;
 }
@@ -28,6 +55,18 @@ static void TimerCallback(TimerHandle_t hTimer) {
     callb = (TimerCallback_t*)((uint32_t)callb & ~1U);
 
     if(callb != NULL) {
+        if(callb->period && callb->type == FuriTimerTypePeriodic) {
+            // Timer is reloaded already, move its next expiry if reload missed the grid.
+            // Done before the callback, so that stop issued by it comes last.
+            callb->deadline += callb->period;
+            uint32_t now = xTaskGetTickCount();
+            uint32_t expiry = furi_timer_align(callb->deadline, callb->slack);
+            if(expiry != xTimerGetExpiryTime(hTimer) && (int32_t)(expiry - now) > 0) {
+                // Timer keeps its reload if queue is full, it only misses the grid
+                xTimerChangePeriod(hTimer, expiry - now, 0);
+            }
+        }
+
         current_timer_name = pcTimerGetName(hTimer);
         callb->func(callb->context);
         current_timer_name = NULL;
@@ -49,6 +88,7 @@ FuriTimer* furi_timer_alloc(FuriTimerCallback func, FuriTimerType type, void* co
 
     callb->func = func;
     callb->context = context;
+    callb->type = type;
 
     if(type == FuriTimerTypeOnce) {
         reload = pdFALSE;
@@ -100,7 +140,8 @@ FuriStatus furi_timer_start(FuriTimer* instance, uint32_t ticks) {
     TimerHandle_t hTimer = (TimerHandle_t)instance;
     FuriStatus stat;
 
-    if(xTimerChangePeriod(hTimer, ticks, portMAX_DELAY) == pdPASS) {
+    uint32_t period = furi_timer_get_aligned_period(furi_timer_get_callback(hTimer), ticks);
+    if(xTimerChangePeriod(hTimer, period, portMAX_DELAY) == pdPASS) {
         stat = FuriStatusOk;
     } else {
         stat = FuriStatusErrorResource;
@@ -118,7 +159,8 @@ FuriStatus furi_timer_restart(FuriTimer* instance, uint32_t ticks) {
     TimerHandle_t hTimer = (TimerHandle_t)instance;
     FuriStatus stat;
 
-    if(xTimerChangePeriod(hTimer, ticks, portMAX_DELAY) == pdPASS &&
+    uint32_t period = furi_timer_get_aligned_period(furi_timer_get_callback(hTimer), ticks);
+    if(xTimerChangePeriod(hTimer, period, portMAX_DELAY) == pdPASS &&
        xTimerReset(hTimer, portMAX_DELAY) == pdPASS) {
         stat = FuriStatusOk;
     } else {
@@ -140,6 +182,15 @@ FuriStatus furi_timer_stop(FuriTimer* instance) {
     return FuriStatusOk;
 }
 
+void furi_timer_set_slack(FuriTimer* instance, uint32_t slack) {
+    furi_assert(!furi_kernel_is_irq_or_masked());
+    furi_assert(instance);
+    furi_assert(slack < portMAX_DELAY);
+
+    TimerHandle_t hTimer = (TimerHandle_t)instance;
+    furi_timer_get_callback(hTimer)->slack = slack;
+}
+
 uint32_t furi_timer_is_running(FuriTimer* instance) {
     furi_assert(!furi_kernel_is_irq_or_masked());
     furi_assert(instance);
@@ -66,6 +66,20 @@ FuriStatus furi_timer_restart(FuriTimer* instance, uint32_t ticks);
  */
 FuriStatus furi_timer_stop(FuriTimer* instance);
 
+/** Set timer slack
+ *
+ * Timer with slack may expire up to slack ticks later than requested. Expiry
+ * is rounded up to a grid shared by all timers with slack, so that they fire
+ * on the same ticks and the system wakes up from idle less often. Periodic
+ * timer is kept on the grid at every expiration without accumulating delay.
+ *
+ * @warning    Slack is applied on next furi_timer_start or furi_timer_restart
+ *
+ * @param      instance  The pointer to FuriTimer instance
+ * @param[in]  slack     The tolerated delay in ticks, 0 to disable
+ */
+void furi_timer_set_slack(FuriTimer* instance, uint32_t slack);
+
 /** Is timer running
  *
  * @warning    This cal may and will return obsolete timer state if timer
@@ -0,0 +1,266 @@
+#include "work_queue.h"
+#include "check.h"
+#include "memmgr.h"
+#include "mutex.h"
+#include "semaphore.h"
+#include "event_flag.h"
+#include "thread.h"
+
+#define FURI_WORK_QUEUE_STACK_SIZE 2048
+#define FURI_WORK_QUEUE_IDLE_TIMEOUT_MS 5000
+#define FURI_WORK_FLAG_DONE (0x1)
+
+typedef enum {
+    FuriWorkStateIdle,
+    FuriWorkStateQueued,
+    FuriWorkStateRunning,
+} FuriWorkState;
+
+struct FuriWork {
+    FuriWorkCallback callback;
+    void* context;
+    FuriWorkCompleteCallback complete_callback;
+    void* complete_context;
+
+    // Guarded by work queue mutex
+    FuriWork* next;
+    FuriWorkQueuePriority priority;
+    FuriWorkState state;
+    bool completing;
+    volatile bool cancelled;
+
+    FuriEventFlag* done;
+};
+
+typedef struct {
+    FuriThread* thread;
+    FuriSemaphore* wakeup;
+    FuriWork* head;
+    FuriWork* tail;
+    bool active;
+} FuriWorkQueueWorker;
+
+typedef struct {
+    FuriMutex* mutex;
+    FuriWorkQueueWorker workers[FuriWorkQueuePriorityCount];
+} FuriWorkQueue;
+
+static FuriWorkQueue* furi_work_queue = NULL;
+
+static const struct {
+    const char* name;
+    FuriThreadPriority priority;
+} furi_work_queue_worker_config[FuriWorkQueuePriorityCount] = {
+    [FuriWorkQueuePriorityLow] = {"WorkQueueLow", FuriThreadPriorityLow},
+    [FuriWorkQueuePriorityNormal] = {"WorkQueueNormal", FuriThreadPriorityNormal},
+    [FuriWorkQueuePriorityHigh] = {"WorkQueueHigh", FuriThreadPriorityHigh},
+};
+
+static void furi_work_queue_lock() {
+    furi_check(furi_mutex_acquire(furi_work_queue->mutex, FuriWaitForever) == FuriStatusOk);
+}
+
+static void furi_work_queue_unlock() {
+    furi_check(furi_mutex_release(furi_work_queue->mutex) == FuriStatusOk);
+}
+
+static FuriWork* furi_work_queue_pop(FuriWorkQueueWorker* worker) {
+    FuriWork* work = worker->head;
+    if(work) {
+        worker->head = work->next;
+        if(!worker->head) worker->tail = NULL;
+        work->next = NULL;
+        work->state = FuriWorkStateRunning;
+    }
+    return work;
+}
+
+static void furi_work_complete(FuriWork* work, bool cancelled) {
+    if(work->complete_callback) {
+        work->completing = true;
+        work->complete_callback(cancelled, work->complete_context);
+    }
+
+    furi_work_queue_lock();
+    work->completing = false;
+    // Completion callback may have submitted it again
+    if(work->state != FuriWorkStateQueued) {
+        work->state = FuriWorkStateIdle;
+        furi_event_flag_set(work->done, FURI_WORK_FLAG_DONE);
+    }
+    furi_work_queue_unlock();
+}
+
+static int32_t furi_work_queue_worker(void* context) {
+    FuriWorkQueueWorker* worker = context;
+
+    while(true) {
+        furi_work_queue_lock();
+        FuriWork* work = furi_work_queue_pop(worker);
+        furi_work_queue_unlock();
+
+        if(work) {
+            if(!work->cancelled) {
+                work->callback(work->context);
+            }
+            furi_work_complete(work, work->cancelled);
+        } else if(
+            furi_semaphore_acquire(worker->wakeup, FURI_WORK_QUEUE_IDLE_TIMEOUT_MS) !=
+            FuriStatusOk) {
+            // Give the stack back, next submit starts the thread again
+            furi_work_queue_lock();
+            bool idle = worker->head == NULL;
+            if(idle) worker->active = false;
+            furi_work_queue_unlock();
+            if(idle) break;
+        }
+    }
+
+    return 0;
+}
+
+void furi_work_queue_init() {
+    furi_work_queue = malloc(sizeof(FuriWorkQueue));
+    furi_work_queue->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+
+    for(size_t i = 0; i < FuriWorkQueuePriorityCount; i++) {
+        FuriWorkQueueWorker* worker = &furi_work_queue->workers[i];
+        worker->thread = furi_thread_alloc_ex(
+            furi_work_queue_worker_config[i].name,
+            FURI_WORK_QUEUE_STACK_SIZE,
+            furi_work_queue_worker,
+            worker);
+        furi_thread_set_priority(worker->thread, furi_work_queue_worker_config[i].priority);
+        worker->wakeup = furi_semaphore_alloc(1, 0);
+    }
+}
+
+FuriWork* furi_work_alloc(FuriWorkCallback callback, void* context) {
+    furi_assert(callback);
+
+    FuriWork* work = malloc(sizeof(FuriWork));
+    work->callback = callback;
+    work->context = context;
+    work->done = furi_event_flag_alloc();
+    furi_event_flag_set(work->done, FURI_WORK_FLAG_DONE);
+
+    return work;
+}
+
+void furi_work_free(FuriWork* work) {
+    furi_assert(work);
+
+    // Worker sets done flag under the lock, wait for it to let go of the job
+    furi_work_queue_lock();
+    furi_check(work->state == FuriWorkStateIdle);
+    furi_work_queue_unlock();
+
+    furi_event_flag_free(work->done);
+    free(work);
+}
+
+void furi_work_set_complete_callback(
+    FuriWork* work,
+    FuriWorkCompleteCallback callback,
+    void* context) {
+    furi_assert(work);
+    furi_check(work->state == FuriWorkStateIdle);
+
+    work->complete_callback = callback;
+    work->complete_context = context;
+}
+
+void furi_work_submit(FuriWork* work, FuriWorkQueuePriority priority) {
+    furi_assert(work);
+    furi_check(priority < FuriWorkQueuePriorityCount);
+    furi_assert(furi_work_queue);
+
+    FuriWorkQueueWorker* worker = &furi_work_queue->workers[priority];
+
+    furi_work_queue_lock();
+    // Running job can only be submitted again from its completion callback
+    furi_check(
+        work->state == FuriWorkStateIdle ||
+        (work->state == FuriWorkStateRunning && work->completing));
+
+    work->state = FuriWorkStateQueued;
+    work->priority = priority;
+    work->cancelled = false;
+    furi_event_flag_clear(work->done, FURI_WORK_FLAG_DONE);
+
+    if(worker->tail) {
+        worker->tail->next = work;
+    } else {
+        worker->head = work;
+    }
+    worker->tail = work;
+
+    bool start = !worker->active;
+    worker->active = true;
+    furi_work_queue_unlock();
+
+    if(start) {
+        // Previous run may still be releasing its task
+        furi_thread_join(worker->thread);
+        furi_thread_start(worker->thread);
+    } else {
+        furi_semaphore_release(worker->wakeup);
+    }
+}
+
+bool furi_work_cancel(FuriWork* work) {
+    furi_assert(work);
+
+    bool removed = false;
+
+    furi_work_queue_lock();
+    if(work->state == FuriWorkStateQueued) {
+        FuriWorkQueueWorker* worker = &furi_work_queue->workers[work->priority];
+        FuriWork* prev = NULL;
+        for(FuriWork* item = worker->head; item; prev = item, item = item->next) {
+            if(item != work) continue;
+
+            if(prev) {
+                prev->next = work->next;
+            } else {
+                worker->head = work->next;
+            }
+            if(worker->tail == work) worker->tail = prev;
+            work->next = NULL;
+            break;
+        }
+        work->state = FuriWorkStateRunning;
+        removed = true;
+    }
+    work->cancelled = true;
+    furi_work_queue_unlock();
+
+    if(removed) {
+        furi_work_complete(work, true);
+    }
+
+    return removed;
+}
+
+bool furi_work_is_cancelled(FuriWork* work) {
+    furi_assert(work);
+    return work->cancelled;
+}
+
+bool furi_work_is_busy(FuriWork* work) {
+    furi_assert(work);
+
+    furi_work_queue_lock();
+    bool busy = work->state != FuriWorkStateIdle;
+    furi_work_queue_unlock();
+
+    return busy;
+}
+
+bool furi_work_wait(FuriWork* work, uint32_t timeout) {
+    furi_assert(work);
+
+    uint32_t flags =
+        furi_event_flag_wait(work->done, FURI_WORK_FLAG_DONE, FuriFlagNoClear, timeout);
+    return !(flags & FuriFlagError) && (flags & FURI_WORK_FLAG_DONE);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file work_queue.h
+ * Furi: shared work queue
+ *
+ * Runs short jobs on a few shared worker threads, one per priority, instead
+ * of allocating a thread for every job. Worker is started on the first job
+ * and exits after some idle time, so its stack is only held while there is
+ * work. Jobs of the same priority run one after another in submission order.
+ *
+ * Job must not block for long, long running loops still need own thread.
+ * Application must cancel and wait for its jobs before exiting.
+ */
+#pragma once
+
+#include "base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Work queue priority, selects the worker thread */
+typedef enum {
+    FuriWorkQueuePriorityLow, /**< Background jobs, FuriThreadPriorityLow */
+    FuriWorkQueuePriorityNormal, /**< FuriThreadPriorityNormal */
+    FuriWorkQueuePriorityHigh, /**< Jobs user is waiting for, FuriThreadPriorityHigh */
+    FuriWorkQueuePriorityCount, /**< Special value */
+} FuriWorkQueuePriority;
+
+/** FuriWork anonymous structure */
+typedef struct FuriWork FuriWork;
+
+/** Job callback, runs on worker thread */
+typedef void (*FuriWorkCallback)(void* context);
+
+/** Completion callback, runs on worker thread, or on the thread that
+ * cancelled the job before it started
+ *
+ * @param      cancelled  true if job was cancelled
+ * @param      context    completion callback context
+ */
+typedef void (*FuriWorkCompleteCallback)(bool cancelled, void* context);
+
+/** Initialize work queue. For internal use only. */
+void furi_work_queue_init();
+
+/** Allocate work item
+ *
+ * @param[in]  callback  The job callback
+ * @param      context   The job callback context
+ *
+ * @return     pointer to FuriWork instance
+ */
+FuriWork* furi_work_alloc(FuriWorkCallback callback, void* context);
+
+/** Free work item, it must not be queued or running
+ *
+ * @param      work  FuriWork instance
+ */
+void furi_work_free(FuriWork* work);
+
+/** Set completion callback
+ *
+ * Callback is called once for every submission, the work item can be
+ * submitted again from it, but not freed.
+ *
+ * @param      work      FuriWork instance
+ * @param[in]  callback  The completion callback
+ * @param      context   The completion callback context
+ */
+void furi_work_set_complete_callback(
+    FuriWork* work,
+    FuriWorkCompleteCallback callback,
+    void* context);
+
+/** Submit work item, it must not be queued or running unless called from
+ * its completion callback
+ *
+ * @param      work      FuriWork instance
+ * @param[in]  priority  The priority to run at
+ */
+void furi_work_submit(FuriWork* work, FuriWorkQueuePriority priority);
+
+/** Cancel work item
+ *
+ * Queued job is removed and its completion callback is called right away.
+ * Running job is only marked, it should check furi_work_is_cancelled() and
+ * return early.
+ *
+ * @param      work  FuriWork instance
+ *
+ * @return     true if job was removed from the queue before it started
+ */
+bool furi_work_cancel(FuriWork* work);
+
+/** Check if work item was cancelled, for use from the job
+ *
+ * @param      work  FuriWork instance
+ *
+ * @return     true if cancelled
+ */
+bool furi_work_is_cancelled(FuriWork* work);
+
+/** Check if work item is queued or running
+ *
+ * @param      work  FuriWork instance
+ *
+ * @return     true if busy
+ */
+bool furi_work_is_busy(FuriWork* work);
+
+/** Wait until work item is neither queued nor running
+ *
+ * @param      work     FuriWork instance
+ * @param[in]  timeout  The timeout
+ *
+ * @return     true if work item is done, false on timeout
+ */
+bool furi_work_wait(FuriWork* work, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
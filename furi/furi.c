@@ -10,6 +10,7 @@ void furi_init() {
 
     furi_log_init();
     furi_record_init();
+    furi_work_queue_init();
 }
 
 void furi_run() {
@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 
+#include "core/arena.h"
 #include "core/check.h"
 #include "core/common_defines.h"
 #include "core/event_flag.h"
@@ -14,8 +15,11 @@
 #include "core/pubsub.h"
 #include "core/record.h"
 #include "core/semaphore.h"
+#include "core/spsc_ring.h"
 #include "core/thread.h"
+#include "core/thread_stats.h"
 #include "core/timer.h"
+#include "core/work_queue.h"
 #include "core/string.h"
 #include "core/stream_buffer.h"
 
@@ -64,6 +64,11 @@ struct DigitalSequence {
     DigitalSequenceRingBuffer timer_buf;
     DigitalSequenceSignalBank signals;
     DigitalSequenceState state;
+
+    /* Periods of the whole sequence, see digital_sequence_precompile() */
+    uint32_t* compiled;
+    uint32_t compiled_size; /* 0 if not compiled or outdated */
+    uint32_t compiled_max_size;
 };
 
 DigitalSequence* digital_sequence_alloc(uint32_t size, const GpioPin* gpio) {
@@ -107,6 +112,7 @@ DigitalSequence* digital_sequence_alloc(uint32_t size, const GpioPin* gpio) {
 void digital_sequence_free(DigitalSequence* sequence) {
     furi_assert(sequence);
 
+    free(sequence->compiled);
     free(sequence->data);
     free(sequence);
 }
@@ -120,6 +126,7 @@ void digital_sequence_register_signal(
     furi_assert(signal_index < DIGITAL_SEQUENCE_BANK_SIZE);
 
     sequence->signals[signal_index] = signal;
+    sequence->compiled_size = 0;
 }
 
 void digital_sequence_add_signal(DigitalSequence* sequence, uint8_t signal_index) {
@@ -128,6 +135,7 @@ void digital_sequence_add_signal(DigitalSequence* sequence, uint8_t signal_index
     furi_assert(sequence->size < sequence->max_size);
 
     sequence->data[sequence->size++] = signal_index;
+    sequence->compiled_size = 0;
 }
 
 static inline void digital_sequence_start_dma(DigitalSequence* sequence) {
@@ -279,6 +287,96 @@ static inline void digital_sequence_timer_buffer_reset(DigitalSequence* sequence
     sequence->timer_buf.write_pos = 0;
 }
 
+/* Same period merging as digital_sequence_transmit(), only counts periods if output is NULL */
+static uint32_t digital_sequence_compile_periods(DigitalSequence* sequence, uint32_t* periods) {
+    const DigitalSignal* signal_current = sequence->signals[sequence->data[0]];
+
+    int32_t remainder_ticks = 0;
+    uint32_t reload_value_carry = 0;
+    uint32_t next_signal_index = 1;
+    uint32_t count = 0;
+
+    for(;;) {
+        const DigitalSignal* signal_next =
+            (next_signal_index < sequence->size) ?
+                sequence->signals[sequence->data[next_signal_index++]] :
+                NULL;
+
+        for(uint32_t i = 0; i < signal_current->size; i++) {
+            const bool is_last_value = (i == signal_current->size - 1);
+            const uint32_t reload_value = signal_current->data[i] + reload_value_carry;
+
+            reload_value_carry = 0;
+
+            if(is_last_value) {
+                if(signal_next != NULL) {
+                    const bool end_level = signal_current->start_level ^
+                                           ((signal_current->size % 2) == 0);
+                    if(end_level == signal_next->start_level) {
+                        reload_value_carry = reload_value;
+                    }
+                } else {
+                    reload_value_carry = 1;
+                }
+            }
+
+            if(reload_value_carry == 0) {
+                if(periods) periods[count] = reload_value;
+                count++;
+            }
+        }
+
+        if(signal_next == NULL) break;
+
+        remainder_ticks += signal_current->remainder;
+        if(remainder_ticks >= DIGITAL_SIGNAL_T_TIM_DIV2) {
+            remainder_ticks -= DIGITAL_SIGNAL_T_TIM;
+            reload_value_carry += 1;
+        }
+
+        signal_current = signal_next;
+    }
+
+    return count;
+}
+
+void digital_sequence_precompile(DigitalSequence* sequence) {
+    furi_assert(sequence);
+    furi_assert(sequence->size);
+
+    /* One more for the end of transmission marker */
+    const uint32_t size = digital_sequence_compile_periods(sequence, NULL) + 1;
+
+    if(size > sequence->compiled_max_size) {
+        free(sequence->compiled);
+        sequence->compiled = malloc(size * sizeof(uint32_t));
+        sequence->compiled_max_size = size;
+    }
+
+    digital_sequence_compile_periods(sequence, sequence->compiled);
+    sequence->compiled[size - 1] = DIGITAL_SEQUENCE_TIMER_MAX;
+    sequence->compiled_size = size;
+}
+
+static void digital_sequence_transmit_compiled(DigitalSequence* sequence) {
+    /* Whole sequence is in memory, so DMA just runs through it once */
+    LL_DMA_InitTypeDef dma_config_timer = sequence->dma_config_timer;
+    dma_config_timer.MemoryOrM2MDstAddress = (uint32_t)sequence->compiled;
+    dma_config_timer.Mode = LL_DMA_MODE_NORMAL;
+    dma_config_timer.NbData = sequence->compiled_size;
+
+    LL_DMA_Init(DMA1, LL_DMA_CHANNEL_1, &sequence->dma_config_gpio);
+    LL_DMA_Init(DMA1, LL_DMA_CHANNEL_2, &dma_config_timer);
+
+    LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_1);
+    LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_2);
+
+    digital_sequence_start_timer();
+    sequence->state = DigitalSequenceStateActive;
+
+    digital_sequence_finish(sequence);
+}
+
 void digital_sequence_transmit(DigitalSequence* sequence) {
     furi_assert(sequence);
     furi_assert(sequence->size);
@@ -296,6 +394,15 @@ void digital_sequence_transmit(DigitalSequence* sequence) {
 
     digital_sequence_init_gpio_buffer(sequence, signal_current);
 
+    if(sequence->compiled_size) {
+        digital_sequence_transmit_compiled(sequence);
+
+        FURI_CRITICAL_EXIT();
+
+        sequence->state = DigitalSequenceStateIdle;
+        return;
+    }
+
     int32_t remainder_ticks = 0;
     uint32_t reload_value_carry = 0;
     uint32_t next_signal_index = 1;
@@ -378,4 +485,5 @@ void digital_sequence_clear(DigitalSequence* sequence) {
     furi_assert(sequence);
 
     sequence->size = 0;
+    sequence->compiled_size = 0;
 }
@@ -97,6 +97,20 @@ void digital_sequence_add_signal(DigitalSequence* sequence, uint8_t signal_index
  */
 void digital_sequence_transmit(DigitalSequence* sequence);
 
+/**
+ * @brief Convert the sequence into a ready to transmit timer buffer.
+ *
+ * Following digital_sequence_transmit() calls replay the buffer, so only DMA setup is left
+ * before the first edge. Useful for fixed responses that have to be sent with tight timing.
+ * The buffer is dropped when the sequence or its signals are changed, but the contents of the
+ * registered signals must not be changed meanwhile.
+ *
+ * Takes 4 bytes of memory for each period of the sequence.
+ *
+ * @param[in,out] sequence pointer to the instance to be precompiled.
+ */
+void digital_sequence_precompile(DigitalSequence* sequence);
+
 /**
  * @brief Clear the signal sequence in a DigitalSequence instance.
  *
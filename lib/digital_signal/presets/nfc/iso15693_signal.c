@@ -2,6 +2,8 @@
 
 #include <digital_signal/digital_sequence.h>
 
+#include <string.h>
+
 #define BITS_IN_BYTE (8U)
 
 #define ISO15693_SIGNAL_COEFF_HI (1U)
@@ -28,9 +30,19 @@ typedef enum {
 
 typedef DigitalSignal* Iso15693SignalBank[Iso15693SignalIndexNum];
 
+typedef struct {
+    DigitalSequence* sequence;
+    Iso15693SignalDataRate data_rate;
+    size_t size;
+    uint8_t data[ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX];
+} Iso15693SignalCacheEntry;
+
 struct Iso15693Signal {
+    const GpioPin* pin;
     DigitalSequence* tx_sequence;
     Iso15693SignalBank banks[Iso15693SignalDataRateNum];
+    Iso15693SignalCacheEntry cache[ISO15693_SIGNAL_CACHE_SIZE];
+    size_t cache_next;
 };
 
 // Add an unmodulated signal for the length of Fc / 256 * k (where k = 1 or 4)
@@ -85,30 +97,30 @@ static inline uint32_t
 }
 
 static inline void
-    iso15693_add_byte(Iso15693Signal* instance, Iso15693SignalDataRate data_rate, uint8_t byte) {
+    iso15693_add_byte(DigitalSequence* sequence, Iso15693SignalDataRate data_rate, uint8_t byte) {
     for(size_t i = 0; i < BITS_IN_BYTE; i++) {
         const uint8_t bit = byte & (1U << i);
         digital_sequence_add_signal(
-            instance->tx_sequence,
+            sequence,
             iso15693_get_sequence_index(
                 bit ? Iso15693SignalIndexOne : Iso15693SignalIndexZero, data_rate));
     }
 }
 
 static inline void iso15693_signal_encode(
-    Iso15693Signal* instance,
+    DigitalSequence* sequence,
     Iso15693SignalDataRate data_rate,
     const uint8_t* tx_data,
     size_t tx_data_size) {
     digital_sequence_add_signal(
-        instance->tx_sequence, iso15693_get_sequence_index(Iso15693SignalIndexSof, data_rate));
+        sequence, iso15693_get_sequence_index(Iso15693SignalIndexSof, data_rate));
 
     for(size_t i = 0; i < tx_data_size; i++) {
-        iso15693_add_byte(instance, data_rate, tx_data[i]);
+        iso15693_add_byte(sequence, data_rate, tx_data[i]);
     }
 
     digital_sequence_add_signal(
-        instance->tx_sequence, iso15693_get_sequence_index(Iso15693SignalIndexEof, data_rate));
+        sequence, iso15693_get_sequence_index(Iso15693SignalIndexEof, data_rate));
 }
 
 static void iso15693_signal_bank_fill(Iso15693Signal* instance, Iso15693SignalDataRate data_rate) {
@@ -136,14 +148,29 @@ static void
     }
 }
 
-static void
-    iso15693_signal_bank_register(Iso15693Signal* instance, Iso15693SignalDataRate data_rate) {
+static void iso15693_signal_bank_register(
+    Iso15693Signal* instance,
+    DigitalSequence* sequence,
+    Iso15693SignalDataRate data_rate) {
     for(uint32_t i = 0; i < Iso15693SignalIndexNum; ++i) {
         digital_sequence_register_signal(
-            instance->tx_sequence,
-            iso15693_get_sequence_index(i, data_rate),
-            instance->banks[data_rate][i]);
+            sequence, iso15693_get_sequence_index(i, data_rate), instance->banks[data_rate][i]);
+    }
+}
+
+static Iso15693SignalCacheEntry* iso15693_signal_cache_find(
+    Iso15693Signal* instance,
+    Iso15693SignalDataRate data_rate,
+    const uint8_t* tx_data,
+    size_t tx_data_size) {
+    for(size_t i = 0; i < ISO15693_SIGNAL_CACHE_SIZE; i++) {
+        Iso15693SignalCacheEntry* entry = &instance->cache[i];
+        if(entry->sequence && entry->size == tx_data_size && entry->data_rate == data_rate &&
+           memcmp(entry->data, tx_data, tx_data_size) == 0) {
+            return entry;
+        }
     }
+    return NULL;
 }
 
 Iso15693Signal* iso15693_signal_alloc(const GpioPin* pin) {
@@ -151,11 +178,12 @@ Iso15693Signal* iso15693_signal_alloc(const GpioPin* pin) {
 
     Iso15693Signal* instance = malloc(sizeof(Iso15693Signal));
 
+    instance->pin = pin;
     instance->tx_sequence = digital_sequence_alloc(BITS_IN_BYTE * 255 + 2, pin);
 
     for(uint32_t i = 0; i < Iso15693SignalDataRateNum; ++i) {
         iso15693_signal_bank_fill(instance, i);
-        iso15693_signal_bank_register(instance, i);
+        iso15693_signal_bank_register(instance, instance->tx_sequence, i);
     }
 
     return instance;
@@ -166,6 +194,10 @@ void iso15693_signal_free(Iso15693Signal* instance) {
 
     digital_sequence_free(instance->tx_sequence);
 
+    for(size_t i = 0; i < ISO15693_SIGNAL_CACHE_SIZE; i++) {
+        if(instance->cache[i].sequence) digital_sequence_free(instance->cache[i].sequence);
+    }
+
     for(uint32_t i = 0; i < Iso15693SignalDataRateNum; ++i) {
         iso15693_signal_bank_clear(instance, i);
     }
@@ -182,14 +214,55 @@ void iso15693_signal_tx(
     furi_assert(data_rate < Iso15693SignalDataRateNum);
     furi_assert(tx_data);
 
+    // Cache hit leaves only DMA setup before the first edge
+    Iso15693SignalCacheEntry* entry =
+        iso15693_signal_cache_find(instance, data_rate, tx_data, tx_data_size);
+
     FURI_CRITICAL_ENTER();
-    digital_sequence_clear(instance->tx_sequence);
-    iso15693_signal_encode(instance, data_rate, tx_data, tx_data_size);
-    digital_sequence_transmit(instance->tx_sequence);
+    if(entry) {
+        digital_sequence_transmit(entry->sequence);
+    } else {
+        digital_sequence_clear(instance->tx_sequence);
+        iso15693_signal_encode(instance->tx_sequence, data_rate, tx_data, tx_data_size);
+        digital_sequence_transmit(instance->tx_sequence);
+    }
 
     FURI_CRITICAL_EXIT();
 }
 
+void iso15693_signal_cache_frame(
+    Iso15693Signal* instance,
+    Iso15693SignalDataRate data_rate,
+    const uint8_t* tx_data,
+    size_t tx_data_size) {
+    furi_assert(instance);
+    furi_assert(data_rate < Iso15693SignalDataRateNum);
+    furi_assert(tx_data);
+
+    if(tx_data_size > ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX) return;
+    if(iso15693_signal_cache_find(instance, data_rate, tx_data, tx_data_size)) return;
+
+    // Replace the oldest entry when full
+    Iso15693SignalCacheEntry* entry = &instance->cache[instance->cache_next];
+    instance->cache_next = (instance->cache_next + 1) % ISO15693_SIGNAL_CACHE_SIZE;
+
+    if(!entry->sequence) {
+        entry->sequence = digital_sequence_alloc(
+            BITS_IN_BYTE * ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX + 2, instance->pin);
+        for(uint32_t i = 0; i < Iso15693SignalDataRateNum; ++i) {
+            iso15693_signal_bank_register(instance, entry->sequence, i);
+        }
+    }
+
+    digital_sequence_clear(entry->sequence);
+    iso15693_signal_encode(entry->sequence, data_rate, tx_data, tx_data_size);
+    digital_sequence_precompile(entry->sequence);
+
+    entry->data_rate = data_rate;
+    entry->size = tx_data_size;
+    memcpy(entry->data, tx_data, tx_data_size);
+}
+
 void iso15693_signal_tx_sof(Iso15693Signal* instance, Iso15693SignalDataRate data_rate) {
     furi_assert(instance);
     furi_assert(data_rate < Iso15693SignalDataRateNum);
@@ -14,6 +14,11 @@
 extern "C" {
 #endif
 
+/** Frames that can be cached, think of inventory response */
+#define ISO15693_SIGNAL_CACHE_SIZE (2U)
+/** Cached frame size limit in bytes, CRC included */
+#define ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX (16U)
+
 typedef struct Iso15693Signal Iso15693Signal;
 
 /**
@@ -57,6 +62,26 @@ void iso15693_signal_tx(
     const uint8_t* tx_data,
     size_t tx_data_size);
 
+/**
+ * @brief Precompile a frame, so following transmissions of it only need DMA setup.
+ * @see iso15693_signal_tx
+ *
+ * Cache holds ISO15693_SIGNAL_CACHE_SIZE frames, the oldest one is replaced when it is full.
+ * Frames larger than ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX are ignored. Takes about 7 KiB
+ * of memory for a 12 byte frame at high data rate, so only use it for the frames that are
+ * sent over and over again and have to be fast.
+ *
+ * @param[in,out] instance pointer to the instance to be used.
+ * @param[in] data_rate data rate the frame is transmitted at.
+ * @param[in] tx_data pointer to the frame data.
+ * @param[in] tx_data_size size of the frame data in bytes.
+ */
+void iso15693_signal_cache_frame(
+    Iso15693Signal* instance,
+    Iso15693SignalDataRate data_rate,
+    const uint8_t* tx_data,
+    size_t tx_data_size);
+
 /**
  * @brief Transmit Start of Frame using an Iso15693Signal instance.
  * @see Iso15693SignalDataRate
@@ -1,6 +1,7 @@
 #include "cc1101.h"
 #include <assert.h>
 #include <string.h>
+#include <furi.h>
 #include <furi_hal_cortex.h>
 
 static bool cc1101_spi_trx(FuriHalSpiBusHandle* handle, uint8_t* tx, uint8_t* rx, uint8_t size) {
@@ -112,15 +113,121 @@ uint32_t cc1101_set_frequency(FuriHalSpiBusHandle* handle, uint32_t value) {
     // Sanity check
     assert((real_value & CC1101_FMASK) == real_value);
 
-    cc1101_write_reg(handle, CC1101_FREQ2, (real_value >> 16) & 0xFF);
-    cc1101_write_reg(handle, CC1101_FREQ1, (real_value >> 8) & 0xFF);
-    cc1101_write_reg(handle, CC1101_FREQ0, (real_value >> 0) & 0xFF);
+    // FREQ2, FREQ1 and FREQ0 are consecutive, write them in one burst
+    uint8_t tx[4] = {
+        CC1101_FREQ2 | CC1101_BURST,
+        (real_value >> 16) & 0xFF,
+        (real_value >> 8) & 0xFF,
+        (real_value >> 0) & 0xFF,
+    };
+    CC1101Status rx[4] = {0};
+    rx[0].CHIP_RDYn = 1;
+    rx[3].CHIP_RDYn = 1;
+
+    cc1101_spi_trx(handle, tx, (uint8_t*)rx, sizeof(rx));
+
+    assert((rx[0].CHIP_RDYn | rx[3].CHIP_RDYn) == 0);
 
     uint64_t real_frequency = real_value * CC1101_QUARTZ / CC1101_FDIV;
 
     return (uint32_t)real_frequency;
 }
 
+float cc1101_rssi_to_dbm(uint8_t rssi) {
+    float value = rssi;
+    if(rssi >= 128) {
+        value = ((value - 256.0f) / 2.0f) - 74.0f;
+    } else {
+        value = (value / 2.0f) - 74.0f;
+    }
+    return value;
+}
+
+static void cc1101_sweep_calibration_write(
+    FuriHalSpiBusHandle* handle,
+    const CC1101SweepCalibration* calibration) {
+    uint8_t tx[4] = {CC1101_FSCAL3 | CC1101_BURST};
+    uint8_t rx[4] = {0};
+    memcpy(&tx[1], calibration->fscal, sizeof(calibration->fscal));
+    cc1101_spi_trx(handle, tx, rx, sizeof(tx));
+}
+
+static void cc1101_sweep_calibration_read(
+    FuriHalSpiBusHandle* handle,
+    CC1101SweepCalibration* calibration) {
+    uint8_t tx[4] = {CC1101_FSCAL3 | CC1101_READ | CC1101_BURST};
+    uint8_t rx[4] = {0};
+    cc1101_spi_trx(handle, tx, rx, sizeof(tx));
+    memcpy(calibration->fscal, &rx[1], sizeof(calibration->fscal));
+    calibration->valid = true;
+}
+
+static uint32_t cc1101_sweep_tune(
+    FuriHalSpiBusHandle* handle,
+    uint32_t value,
+    CC1101SweepCalibration* calibration) {
+    cc1101_switch_to_idle(handle);
+    uint32_t real_frequency = cc1101_set_frequency(handle, value);
+
+    if(calibration && calibration->valid) {
+        cc1101_sweep_calibration_write(handle, calibration);
+    } else {
+        cc1101_calibrate(handle);
+        FuriHalCortexTimer timer = furi_hal_cortex_timer_get(CC1101_TIMEOUT * 1000);
+        while(cc1101_get_status(handle).STATE != CC1101StateIDLE) {
+            if(furi_hal_cortex_timer_is_expired(timer)) break;
+        }
+        if(calibration) cc1101_sweep_calibration_read(handle, calibration);
+    }
+
+    cc1101_switch_to_rx(handle);
+    return real_frequency;
+}
+
+void cc1101_sweep_calibrated(
+    FuriHalSpiBusHandle* handle,
+    CC1101SweepPoint* points,
+    CC1101SweepCalibration* calibrations,
+    size_t count,
+    uint32_t settle_us) {
+    assert(points);
+    if(!count) return;
+
+    // Points are calibrated explicitly, automatic calibration on IDLE to RX would only double it
+    uint8_t mcsm0 = 0;
+    furi_hal_spi_acquire(handle);
+    cc1101_read_reg(handle, CC1101_MCSM0, &mcsm0);
+    cc1101_write_reg(handle, CC1101_MCSM0, mcsm0 & ~0x30);
+    points[0].frequency =
+        cc1101_sweep_tune(handle, points[0].frequency, calibrations ? &calibrations[0] : NULL);
+    furi_hal_spi_release(handle);
+
+    for(size_t i = 0; i < count; i++) {
+        // Let other bus users in while RSSI settles, sleep instead of spinning if possible
+        furi_delay_ms(settle_us / 1000);
+        furi_delay_us(settle_us % 1000);
+
+        // Read current point and retune to the next one within one acquisition
+        furi_hal_spi_acquire(handle);
+        points[i].rssi = cc1101_rssi_to_dbm(cc1101_get_rssi(handle));
+        if(i + 1 < count) {
+            points[i + 1].frequency = cc1101_sweep_tune(
+                handle, points[i + 1].frequency, calibrations ? &calibrations[i + 1] : NULL);
+        } else {
+            cc1101_write_reg(handle, CC1101_MCSM0, mcsm0);
+        }
+        furi_hal_spi_release(handle);
+    }
+}
+
+void cc1101_sweep(
+    FuriHalSpiBusHandle* handle,
+    CC1101SweepPoint* points,
+    size_t count,
+    uint32_t settle_us) {
+    cc1101_sweep_calibrated(handle, points, NULL, count, settle_us);
+}
+
 uint32_t cc1101_set_intermediate_frequency(FuriHalSpiBusHandle* handle, uint32_t value) {
     uint64_t real_value = value * CC1101_IFDIV / CC1101_QUARTZ;
     assert((real_value & 0xFF) == real_value);
@@ -3,6 +3,7 @@
 #include "cc1101_regs.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <furi_hal_spi.h>
 
@@ -10,6 +11,18 @@
 extern "C" {
 #endif
 
+/** Sweep point, see cc1101_sweep */
+typedef struct {
+    uint32_t frequency; /**< Requested frequency on input, synthesized one on output */
+    float rssi; /**< Measured RSSI in dBm */
+} CC1101SweepPoint;
+
+/** Frequency synthesizer calibration of a sweep point, see cc1101_sweep_calibrated */
+typedef struct {
+    uint8_t fscal[3]; /**< FSCAL3, FSCAL2 and FSCAL1 captured after calibration */
+    bool valid; /**< Set once captured, clear to calibrate again */
+} CC1101SweepCalibration;
+
 /* Low level API */
 
 /** Strobe command to the device
@@ -91,6 +104,14 @@ uint8_t cc1101_get_version(FuriHalSpiBusHandle* handle);
  */
 uint8_t cc1101_get_rssi(FuriHalSpiBusHandle* handle);
 
+/** Convert raw RSSI register value to dBm
+ *
+ * @param      rssi    - raw rssi value
+ *
+ * @return     rssi in dBm
+ */
+float cc1101_rssi_to_dbm(uint8_t rssi);
+
 /** Calibrate oscillator
  *
  * @param      handle  - pointer to FuriHalSpiHandle
@@ -144,6 +165,44 @@ CC1101Status cc1101_flush_tx(FuriHalSpiBusHandle* handle);
  */
 uint32_t cc1101_set_frequency(FuriHalSpiBusHandle* handle, uint32_t value);
 
+/** Measure RSSI on a batch of frequencies
+ *
+ * Unlike other functions this one acquires and releases the bus itself: bus
+ * is held only while the chip is retuned and released during settle time.
+ * RSSI of a point is read and the next point is tuned within one acquisition.
+ * Chip must be configured for RX and be in IDLE or RX state, stays in RX.
+ *
+ * @param      handle     - pointer to FuriHalSpiHandle
+ * @param      points     - frequencies to measure, filled with results
+ * @param      count      - points count
+ * @param      settle_us  - time to wait in RX before reading RSSI, microseconds
+ */
+void cc1101_sweep(
+    FuriHalSpiBusHandle* handle,
+    CC1101SweepPoint* points,
+    size_t count,
+    uint32_t settle_us);
+
+/** Measure RSSI on a batch of frequencies, reusing calibration of previous sweeps
+ *
+ * Same as cc1101_sweep, but each point is calibrated only once: results are
+ * stored in calibrations and programmed back in one burst on later sweeps, so
+ * retuning skips the synthesizer calibration. Calibrations must be cleared
+ * when point frequencies or temperature change.
+ *
+ * @param      handle        - pointer to FuriHalSpiHandle
+ * @param      points        - frequencies to measure, filled with results
+ * @param      calibrations  - calibration of each point, same count as points
+ * @param      count         - points count
+ * @param      settle_us     - time to wait in RX before reading RSSI, microseconds
+ */
+void cc1101_sweep_calibrated(
+    FuriHalSpiBusHandle* handle,
+    CC1101SweepPoint* points,
+    CC1101SweepCalibration* calibrations,
+    size_t count,
+    uint32_t settle_us);
+
 /** Set Intermediate Frequency
  *
  * @param      handle  - pointer to FuriHalSpiHandle
@@ -87,7 +87,7 @@ void rgb_backlight_save_settings() {
     if(!rgb_state.settings_loaded) return;
     furi_check(furi_mutex_acquire(rgb_state.mutex, FuriWaitForever) == FuriStatusOk);
 
-    saved_struct_save(
+    saved_struct_save_deferred(
         RGB_BACKLIGHT_SETTINGS_PATH,
         &rgb_settings,
         sizeof(rgb_settings),
@@ -16,7 +16,7 @@ typedef unsigned __int64 QWORD;
 
 /* These types MUST be 16-bit or 32-bit */
 typedef int16_t INT;
-typedef uint16_t UINT;
+typedef uint32_t UINT; /* 32-bit, so a single f_read/f_write can transfer more than 64K */
 
 /* This type MUST be 8-bit */
 typedef uint8_t BYTE;
@@ -5,24 +5,20 @@
 
 #define TAG "ApiHashtable"
 
-bool elf_resolve_from_hashtable(
-    const ElfApiInterface* interface,
+static bool elf_resolve_from_range(
+    const sym_entry* table_cbegin,
+    const sym_entry* table_cend,
     uint32_t hash,
     Elf32_Addr* address) {
     bool result = false;
-    const HashtableApiInterface* hashtable_interface =
-        static_cast<const HashtableApiInterface*>(interface);
 
     sym_entry key = {
         .hash = hash,
         .address = 0,
     };
 
-    auto find_res =
-        std::lower_bound(hashtable_interface->table_cbegin, hashtable_interface->table_cend, key);
-    if((find_res == hashtable_interface->table_cend || (find_res->hash != hash))) {
-        FURI_LOG_W(
-            TAG, "Can't find symbol with hash %lx @ %p!", hash, hashtable_interface->table_cbegin);
+    auto find_res = std::lower_bound(table_cbegin, table_cend, key);
+    if((find_res == table_cend || (find_res->hash != hash))) {
         result = false;
     } else {
         result = true;
@@ -32,6 +28,46 @@ bool elf_resolve_from_hashtable(
     return result;
 }
 
+bool elf_resolve_from_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    const HashtableApiInterface* hashtable_interface =
+        static_cast<const HashtableApiInterface*>(interface);
+
+    bool result = elf_resolve_from_range(
+        hashtable_interface->table_cbegin, hashtable_interface->table_cend, hash, address);
+    if(!result) {
+        FURI_LOG_W(
+            TAG, "Can't find symbol with hash %lx @ %p!", hash, hashtable_interface->table_cbegin);
+    }
+
+    return result;
+}
+
+bool elf_resolve_from_indexed_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    const IndexedHashtableApiInterface* hashtable_interface =
+        static_cast<const IndexedHashtableApiInterface*>(interface);
+
+    // Only entries of the hash bucket need to be searched
+    uint32_t bucket = api_hashtable_bucket(hash, hashtable_interface->index_bits);
+    const sym_entry* bucket_cbegin =
+        hashtable_interface->table_cbegin + hashtable_interface->index[bucket];
+    const sym_entry* bucket_cend =
+        hashtable_interface->table_cbegin + hashtable_interface->index[bucket + 1];
+
+    bool result = elf_resolve_from_range(bucket_cbegin, bucket_cend, hash, address);
+    if(!result) {
+        FURI_LOG_W(
+            TAG, "Can't find symbol with hash %lx @ %p!", hash, hashtable_interface->table_cbegin);
+    }
+
+    return result;
+}
+
 uint32_t elf_symbolname_hash(const char* s) {
     return elf_gnu_hash(s);
 }
\ No newline at end of file
@@ -28,6 +28,18 @@ bool elf_resolve_from_hashtable(
     uint32_t hash,
     Elf32_Addr* address);
 
+/**
+ * @brief Resolver for API entries using a pre-sorted table with hashes and bucket index
+ * @param interface pointer to IndexedHashtableApiInterface
+ * @param hash gnu hash of function name
+ * @param address output for function address
+ * @return true if the table contains a function
+ */
+bool elf_resolve_from_indexed_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address);
+
 uint32_t elf_symbolname_hash(const char* s);
 
 #ifdef __cplusplus
@@ -45,6 +57,37 @@ struct HashtableApiInterface : public ElfApiInterface {
     const sym_entry *table_cbegin, *table_cend;
 };
 
+/**
+ * @brief  IndexedHashtableApiInterface is a HashtableApiInterface
+ * with an index of hash buckets, so lookup only searches a few entries.
+ * table_cbegin and table_cend must point to an array grouped by bucket and
+ * sorted by hash within each bucket, index[bucket] is the position of its
+ * first entry and index[bucket + 1] is the end of it.
+ * Use create_hashtable_index() to build both at compile time.
+ */
+struct IndexedHashtableApiInterface : public HashtableApiInterface {
+    const uint16_t* index;
+    uint8_t index_bits;
+};
+
+/**
+ * @brief Get index bucket of a hash
+ * GNU hash of names with common prefix differ mostly in low bits,
+ * so the hash is mixed before taking top bits.
+ * @param hash symbol hash
+ * @param bits index size
+ * @return bucket number
+ */
+constexpr uint32_t api_hashtable_bucket(uint32_t hash, uint8_t bits) {
+    return (uint32_t)(hash * 0x9E3779B1UL) >> (32 - bits);
+}
+
+template <std::size_t Bits, std::size_t N>
+struct HashtableIndex {
+    std::array<sym_entry, N> table;
+    std::array<uint16_t, (1U << Bits) + 1> index;
+};
+
 #define API_METHOD(x, ret_type, args_type)                                                     \
     sym_entry {                                                                                \
         .hash = elf_gnu_hash(#x), .address = (uint32_t)(static_cast<ret_type(*) args_type>(x)) \
@@ -72,6 +115,33 @@ constexpr uint32_t elf_gnu_hash(const char* s) {
     return h;
 }
 
+/* Compile-time bucket index for a sorted API table, entries are regrouped by bucket.
+ * Usage: constexpr auto api_index = create_hashtable_index<10>(api_methods);
+ */
+template <std::size_t Bits, std::size_t N>
+constexpr auto create_hashtable_index(const std::array<sym_entry, N>& api_methods) {
+    static_assert(Bits > 0 && Bits < 16, "Unsupported index size");
+    static_assert(N <= UINT16_MAX, "Table is too large for the index");
+
+    HashtableIndex<Bits, N> result{};
+
+    // Counting sort is stable, so each bucket stays sorted by hash
+    for(std::size_t i = 0; i < N; ++i) {
+        ++result.index[api_hashtable_bucket(api_methods[i].hash, Bits) + 1];
+    }
+    for(std::size_t bucket = 1; bucket < result.index.size(); ++bucket) {
+        result.index[bucket] += result.index[bucket - 1];
+    }
+
+    std::array<uint16_t, (1U << Bits)> fill{};
+    for(std::size_t i = 0; i < N; ++i) {
+        uint32_t bucket = api_hashtable_bucket(api_methods[i].hash, Bits);
+        result.table[result.index[bucket] + fill[bucket]++] = api_methods[i];
+    }
+
+    return result;
+}
+
 /* Compile-time check for hash collisions in API table.
  * Usage: static_assert(!has_hash_collisions(api_methods), "Hash collision detected"); 
  */
@@ -0,0 +1,207 @@
+#include "application_meta_cache.h"
+
+#define TAG "FapMetaCache"
+
+#define FLIPPER_APPLICATION_META_CACHE_PATH CFG_PATH(".fap_meta.cache")
+#define FLIPPER_APPLICATION_META_CACHE_MAGIC 0x4D504146
+#define FLIPPER_APPLICATION_META_CACHE_VERSION 1
+
+/** Open addressing hash table, file is preallocated so lookup is one seek and read */
+#define FLIPPER_APPLICATION_META_CACHE_SLOTS 1024
+#define FLIPPER_APPLICATION_META_CACHE_PROBES 8
+#define FLIPPER_APPLICATION_META_CACHE_BUFFER_SIZE 512
+
+#define FLIPPER_APPLICATION_META_CACHE_FLAG_USED (1 << 0)
+#define FLIPPER_APPLICATION_META_CACHE_FLAG_LOADED (1 << 1)
+#define FLIPPER_APPLICATION_META_CACHE_FLAG_HAS_ICON (1 << 2)
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slots;
+} FlipperApplicationMetaCacheHeader;
+
+typedef struct {
+    FlipperApplicationMetaCacheKey key;
+    uint8_t flags;
+    char name[FAP_MANIFEST_MAX_APP_NAME_LENGTH];
+    uint8_t icon[FAP_MANIFEST_MAX_ICON_SIZE];
+} FlipperApplicationMetaCacheRecord;
+
+#pragma pack(pop)
+
+#define FLIPPER_APPLICATION_META_CACHE_FILE_SIZE    \
+    (sizeof(FlipperApplicationMetaCacheHeader) + \
+     FLIPPER_APPLICATION_META_CACHE_SLOTS * sizeof(FlipperApplicationMetaCacheRecord))
+
+static const FlipperApplicationMetaCacheHeader flipper_application_meta_cache_header = {
+    .magic = FLIPPER_APPLICATION_META_CACHE_MAGIC,
+    .version = FLIPPER_APPLICATION_META_CACHE_VERSION,
+    .slots = FLIPPER_APPLICATION_META_CACHE_SLOTS,
+};
+
+static uint32_t flipper_application_meta_cache_hash(const char* str, uint32_t hash) {
+    // FNV-1a
+    while(*str) {
+        hash = (hash ^ (uint8_t)*str++) * 16777619UL;
+    }
+    return hash;
+}
+
+static size_t flipper_application_meta_cache_slot_offset(uint32_t slot) {
+    return sizeof(FlipperApplicationMetaCacheHeader) +
+           (slot % FLIPPER_APPLICATION_META_CACHE_SLOTS) *
+               sizeof(FlipperApplicationMetaCacheRecord);
+}
+
+static bool flipper_application_meta_cache_header_check(File* file) {
+    FlipperApplicationMetaCacheHeader header;
+    if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) return false;
+    return memcmp(&header, &flipper_application_meta_cache_header, sizeof(header)) == 0 &&
+           storage_file_size(file) == FLIPPER_APPLICATION_META_CACHE_FILE_SIZE;
+}
+
+static bool flipper_application_meta_cache_create(File* file) {
+    bool success = false;
+    uint8_t* zeroes = malloc(FLIPPER_APPLICATION_META_CACHE_BUFFER_SIZE);
+
+    do {
+        if(!storage_file_seek(file, 0, true)) break;
+        if(!storage_file_truncate(file)) break;
+        if(storage_file_write(
+               file,
+               &flipper_application_meta_cache_header,
+               sizeof(flipper_application_meta_cache_header)) !=
+           sizeof(flipper_application_meta_cache_header))
+            break;
+
+        // All slots start empty
+        size_t left =
+            FLIPPER_APPLICATION_META_CACHE_FILE_SIZE - sizeof(FlipperApplicationMetaCacheHeader);
+        while(left) {
+            size_t to_write = MIN(left, (size_t)FLIPPER_APPLICATION_META_CACHE_BUFFER_SIZE);
+            if(storage_file_write(file, zeroes, to_write) != to_write) break;
+            left -= to_write;
+        }
+        success = left == 0;
+    } while(false);
+
+    free(zeroes);
+    if(!success) FURI_LOG_E(TAG, "Failed to create cache");
+    return success;
+}
+
+static bool flipper_application_meta_cache_read_slot(
+    File* file,
+    uint32_t slot,
+    FlipperApplicationMetaCacheRecord* record) {
+    return storage_file_seek(file, flipper_application_meta_cache_slot_offset(slot), true) &&
+           storage_file_read(file, record, sizeof(*record)) == sizeof(*record);
+}
+
+bool flipper_application_meta_cache_key(
+    Storage* storage,
+    const char* path,
+    FlipperApplicationMetaCacheKey* key) {
+    furi_assert(path);
+    furi_assert(key);
+
+    FileInfo file_info;
+    if(storage_common_stat(storage, path, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, path, &key->timestamp) != FSE_OK) return false;
+
+    key->hash = flipper_application_meta_cache_hash(path, 2166136261UL);
+    // Second hash with different seed, lowers the chance of mixing up two paths
+    key->check = flipper_application_meta_cache_hash(path, key->hash ^ strlen(path));
+    key->size = file_info.size;
+    return true;
+}
+
+bool flipper_application_meta_cache_get(
+    Storage* storage,
+    const FlipperApplicationMetaCacheKey* key,
+    FlipperApplicationMetaCacheEntry* entry) {
+    furi_assert(key);
+    furi_assert(entry);
+
+    bool found = false;
+    File* file = storage_file_alloc(storage);
+    FlipperApplicationMetaCacheRecord* record = malloc(sizeof(FlipperApplicationMetaCacheRecord));
+
+    do {
+        if(!storage_file_open(
+               file, FLIPPER_APPLICATION_META_CACHE_PATH, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+        if(!flipper_application_meta_cache_header_check(file)) break;
+
+        for(uint32_t i = 0; i < FLIPPER_APPLICATION_META_CACHE_PROBES; i++) {
+            if(!flipper_application_meta_cache_read_slot(file, key->hash + i, record)) break;
+            if(!(record->flags & FLIPPER_APPLICATION_META_CACHE_FLAG_USED)) break;
+            if(record->key.hash != key->hash || record->key.check != key->check) continue;
+
+            // Same file, but it was changed since
+            found = memcmp(&record->key, key, sizeof(*key)) == 0;
+            break;
+        }
+        if(!found) break;
+
+        entry->loaded = record->flags & FLIPPER_APPLICATION_META_CACHE_FLAG_LOADED;
+        entry->has_icon = record->flags & FLIPPER_APPLICATION_META_CACHE_FLAG_HAS_ICON;
+        memcpy(entry->name, record->name, sizeof(entry->name));
+        memcpy(entry->icon, record->icon, sizeof(entry->icon));
+    } while(false);
+
+    free(record);
+    storage_file_free(file);
+    return found;
+}
+
+void flipper_application_meta_cache_put(
+    Storage* storage,
+    const FlipperApplicationMetaCacheKey* key,
+    const FlipperApplicationMetaCacheEntry* entry) {
+    furi_assert(key);
+    furi_assert(entry);
+
+    File* file = storage_file_alloc(storage);
+    FlipperApplicationMetaCacheRecord* record = malloc(sizeof(FlipperApplicationMetaCacheRecord));
+
+    do {
+        // Cache may be in use by another thread, skip storing then
+        if(!storage_file_open(
+               file, FLIPPER_APPLICATION_META_CACHE_PATH, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS))
+            break;
+        if(!flipper_application_meta_cache_header_check(file) &&
+           !flipper_application_meta_cache_create(file))
+            break;
+
+        // Reuse slot of the same file or first free one, evict home slot when all are taken
+        uint32_t slot = key->hash;
+        for(uint32_t i = 0; i < FLIPPER_APPLICATION_META_CACHE_PROBES; i++) {
+            if(!flipper_application_meta_cache_read_slot(file, key->hash + i, record)) break;
+            if(!(record->flags & FLIPPER_APPLICATION_META_CACHE_FLAG_USED) ||
+               (record->key.hash == key->hash && record->key.check == key->check)) {
+                slot = key->hash + i;
+                break;
+            }
+        }
+
+        memset(record, 0, sizeof(FlipperApplicationMetaCacheRecord));
+        record->key = *key;
+        record->flags = FLIPPER_APPLICATION_META_CACHE_FLAG_USED;
+        if(entry->loaded) record->flags |= FLIPPER_APPLICATION_META_CACHE_FLAG_LOADED;
+        if(entry->has_icon) record->flags |= FLIPPER_APPLICATION_META_CACHE_FLAG_HAS_ICON;
+        memcpy(record->name, entry->name, sizeof(record->name));
+        memcpy(record->icon, entry->icon, sizeof(record->icon));
+
+        if(!storage_file_seek(file, flipper_application_meta_cache_slot_offset(slot), true) ||
+           storage_file_write(file, record, sizeof(*record)) != sizeof(*record)) {
+            FURI_LOG_E(TAG, "Failed to store entry");
+        }
+    } while(false);
+
+    free(record);
+    storage_file_free(file);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file application_meta_cache.h
+ * Flipper application name and icon cache
+ *
+ * Keeps manifest name and icon of recently seen applications on SD card, so
+ * menus and browsers don't need to parse ELF file on every visit. Entries are
+ * validated with file size and modification time.
+ */
+#pragma once
+
+#include "application_manifest.h"
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t hash;
+    uint32_t check;
+    uint32_t timestamp;
+    uint32_t size;
+} FlipperApplicationMetaCacheKey;
+
+typedef struct {
+    bool loaded;
+    bool has_icon;
+    char name[FAP_MANIFEST_MAX_APP_NAME_LENGTH];
+    uint8_t icon[FAP_MANIFEST_MAX_ICON_SIZE];
+} FlipperApplicationMetaCacheEntry;
+
+/** Build cache key for application file
+ *
+ * @param      storage  Storage instance
+ * @param      path     application path
+ * @param[out] key      cache key
+ *
+ * @return     true on success, false if file can't be stat'ed
+ */
+bool flipper_application_meta_cache_key(
+    Storage* storage,
+    const char* path,
+    FlipperApplicationMetaCacheKey* key);
+
+/** Find cached entry
+ *
+ * @param      storage  Storage instance
+ * @param      key      cache key
+ * @param[out] entry    cached entry
+ *
+ * @return     true if entry is found and up to date
+ */
+bool flipper_application_meta_cache_get(
+    Storage* storage,
+    const FlipperApplicationMetaCacheKey* key,
+    FlipperApplicationMetaCacheEntry* entry);
+
+/** Store entry, replaces older entry for the same file
+ *
+ * @param      storage  Storage instance
+ * @param      key      cache key
+ * @param      entry    entry to store
+ */
+void flipper_application_meta_cache_put(
+    Storage* storage,
+    const FlipperApplicationMetaCacheKey* key,
+    const FlipperApplicationMetaCacheEntry* entry);
+
+#ifdef __cplusplus
+}
+#endif
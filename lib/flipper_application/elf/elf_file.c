@@ -11,6 +11,9 @@
 #define SECTION_OFFSET(e, n) ((e)->section_table + (n) * sizeof(Elf32_Shdr))
 #define IS_FLAGS_SET(v, m) (((v) & (m)) == (m))
 #define RESOLVER_THREAD_YIELD_STEP 30
+#define RELOCATION_READ_BLOCK 32
+#define SECTION_HEADERS_CACHE_MAX 4096
+#define SECTION_NAMES_CACHE_MAX 2048
 #define FAST_RELOCATION_VERSION 1
 
 // #define ELF_DEBUG_LOG 1
@@ -21,6 +24,9 @@
 #endif
 
 #define ELF_INVALID_ADDRESS 0xFFFFFFFF
+#define ELF_UNCACHED_ADDRESS 0xFFFFFFFE
+
+#define RELOCATION_CACHE_MAX_COUNT 2048
 
 #define TRAMPOLINE_CODE_SIZE 6
 
@@ -40,6 +46,37 @@ typedef struct {
 /********************************************* Caches *********************************************/
 /**************************************************************************************************/
 
+static ELFRelocationStats elf_relocation_stats = {0};
+
+static void relocation_cache_alloc(ELFFile* elf) {
+    // Symbols above the limit are resolved every time, peak heap use stays bounded
+    elf->relocation_cache_count = MIN(elf->symbol_count, (size_t)RELOCATION_CACHE_MAX_COUNT);
+    elf->relocation_cache = malloc(sizeof(Elf32_Addr) * elf->relocation_cache_count);
+    for(size_t i = 0; i < elf->relocation_cache_count; i++) {
+        elf->relocation_cache[i] = ELF_UNCACHED_ADDRESS;
+    }
+    elf->relocation_stats.cache_size = sizeof(Elf32_Addr) * elf->relocation_cache_count;
+}
+
+static void relocation_cache_free(ELFFile* elf) {
+    free(elf->relocation_cache);
+    elf->relocation_cache = NULL;
+    elf->relocation_cache_count = 0;
+}
+
+static bool relocation_cache_get(ELFFile* elf, int symEntry, Elf32_Addr* symAddr) {
+    if(symEntry < 0 || (size_t)symEntry >= elf->relocation_cache_count) return false;
+    if(elf->relocation_cache[symEntry] == ELF_UNCACHED_ADDRESS) return false;
+    *symAddr = elf->relocation_cache[symEntry];
+    elf->relocation_stats.cache_hits++;
+    return true;
+}
+
+static void relocation_cache_put(ELFFile* elf, int symEntry, Elf32_Addr symAddr) {
+    if(symEntry < 0 || (size_t)symEntry >= elf->relocation_cache_count) return;
+    elf->relocation_cache[symEntry] = symAddr;
+}
+
 static bool address_cache_get(AddressCache_t cache, int symEntry, Elf32_Addr* symAddr) {
     Elf32_Addr* addr = AddressCache_get(cache, symEntry);
     if(addr) {
@@ -58,11 +95,20 @@ static void address_cache_put(AddressCache_t cache, int symEntry, Elf32_Addr sym
 /********************************************** ELF ***********************************************/
 /**************************************************************************************************/
 
+static void elf_file_release_section_cache(ELFFile* elf) {
+    free(elf->section_headers);
+    elf->section_headers = NULL;
+    free(elf->section_names);
+    elf->section_names = NULL;
+    elf->section_names_size = 0;
+}
+
 static void elf_file_maybe_release_fd(ELFFile* elf) {
     if(elf->fd) {
         storage_file_free(elf->fd);
         elf->fd = NULL;
     }
+    elf_file_release_section_cache(elf);
 }
 
 static ELFSection* elf_file_get_section(ELFFile* elf, const char* name) {
@@ -118,6 +164,12 @@ static bool elf_read_string_from_offset(ELFFile* elf, off_t offset, FuriString*
 }
 
 static bool elf_read_section_name(ELFFile* elf, off_t offset, FuriString* name) {
+    if(elf->section_names) {
+        if(offset < 0 || (size_t)offset >= elf->section_names_size) return false;
+        // Table is kept zero terminated
+        furi_string_cat(name, elf->section_names + offset);
+        return true;
+    }
     return elf_read_string_from_offset(elf, elf->section_table_strings + offset, name);
 }
 
@@ -126,6 +178,12 @@ static bool elf_read_symbol_name(ELFFile* elf, off_t offset, FuriString* name) {
 }
 
 static bool elf_read_section_header(ELFFile* elf, size_t section_idx, Elf32_Shdr* section_header) {
+    if(elf->section_headers) {
+        if(section_idx >= elf->sections_count) return false;
+        *section_header = elf->section_headers[section_idx];
+        return true;
+    }
+
     off_t offset = SECTION_OFFSET(elf, section_idx);
     return storage_file_seek(elf->fd, offset, true) &&
            storage_file_read(elf->fd, section_header, sizeof(Elf32_Shdr)) == sizeof(Elf32_Shdr);
@@ -165,6 +223,11 @@ static bool elf_read_symbol(ELFFile* elf, int n, Elf32_Sym* sym, FuriString* nam
 }
 
 static ELFSection* elf_section_of(ELFFile* elf, int index) {
+    if(elf->section_index) {
+        return (index >= 0 && (size_t)index < elf->sections_count) ? elf->section_index[index] :
+                                                                      NULL;
+    }
+
     ELFSectionDict_it_t it;
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -322,6 +385,7 @@ static void elf_relocate_mov(Elf32_Addr relAddr, int type, Elf32_Addr symAddr) {
 }
 
 static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf32_Addr symAddr) {
+    elf->relocation_stats.relocations++;
     switch(type) {
     case R_ARM_TARGET1:
     case R_ARM_ABS32:
@@ -352,27 +416,41 @@ static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf3
 
 static bool elf_relocate(ELFFile* elf, ELFSection* s) {
     if(s->data) {
-        Elf32_Rel rel;
         size_t relEntries = s->rel_count;
         size_t relCount;
-        (void)storage_file_seek(elf->fd, s->rel_offset, true);
         FURI_LOG_D(TAG, " Offset   Info     Type             Name");
 
         int relocate_result = true;
         FuriString* symbol_name;
         symbol_name = furi_string_alloc();
 
+        // Relocations are read in blocks, a storage request per entry is what makes this slow
+        Elf32_Rel* rels = malloc(sizeof(Elf32_Rel) * RELOCATION_READ_BLOCK);
+        if(!elf->relocation_cache) {
+            relocation_cache_alloc(elf);
+        }
+
         for(relCount = 0; relCount < relEntries; relCount++) {
             if(relCount % RESOLVER_THREAD_YIELD_STEP == 0) {
                 FURI_LOG_D(TAG, "  reloc YIELD");
                 furi_delay_tick(1);
             }
 
-            if(storage_file_read(elf->fd, &rel, sizeof(Elf32_Rel)) != sizeof(Elf32_Rel)) {
-                FURI_LOG_E(TAG, "  reloc read fail");
-                furi_string_free(symbol_name);
-                return false;
+            size_t block_pos = relCount % RELOCATION_READ_BLOCK;
+            if(block_pos == 0) {
+                size_t block_size =
+                    sizeof(Elf32_Rel) * MIN(relEntries - relCount, RELOCATION_READ_BLOCK);
+                // Symbol reads in between move file position
+                if(!storage_file_seek(
+                       elf->fd, s->rel_offset + relCount * sizeof(Elf32_Rel), true) ||
+                   storage_file_read(elf->fd, rels, block_size) != block_size) {
+                    FURI_LOG_E(TAG, "  reloc read fail");
+                    free(rels);
+                    furi_string_free(symbol_name);
+                    return false;
+                }
             }
+            const Elf32_Rel rel = rels[block_pos];
 
             Elf32_Addr symAddr;
 
@@ -380,11 +458,12 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
             int relType = ELF32_R_TYPE(rel.r_info);
             Elf32_Addr relAddr = ((Elf32_Addr)s->data) + rel.r_offset;
 
-            if(!address_cache_get(elf->relocation_cache, symEntry, &symAddr)) {
+            if(!relocation_cache_get(elf, symEntry, &symAddr)) {
                 Elf32_Sym sym;
                 furi_string_reset(symbol_name);
                 if(!elf_read_symbol(elf, symEntry, &sym, symbol_name)) {
                     FURI_LOG_E(TAG, "  symbol read fail");
+                    free(rels);
                     furi_string_free(symbol_name);
                     return false;
                 }
@@ -398,7 +477,8 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                     furi_string_get_cstr(symbol_name));
 
                 symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
-                address_cache_put(elf->relocation_cache, symEntry, symAddr);
+                elf->relocation_stats.symbol_lookups++;
+                relocation_cache_put(elf, symEntry, symAddr);
             }
 
             if(symAddr != ELF_INVALID_ADDRESS) {
@@ -415,6 +495,7 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                 relocate_result = false;
             }
         }
+        free(rels);
         furi_string_free(symbol_name);
 
         return relocate_result;
@@ -682,6 +763,7 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
             }
         } else {
             address = elf_address_of_by_hash(elf, hash_or_section_index);
+            elf->relocation_stats.symbol_lookups++;
         }
 
         if(address == ELF_INVALID_ADDRESS) {
@@ -807,6 +889,7 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    relocation_cache_free(elf);
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
@@ -827,6 +910,25 @@ bool elf_file_open(ELFFile* elf, const char* path) {
     elf->sections_count = h.e_shnum;
     elf->section_table = h.e_shoff;
     elf->section_table_strings = sH.sh_offset;
+
+    // Every section is looked up by name, read headers and names in two requests
+    // instead of a few per section. Falls back to reading from file if they don't fit.
+    elf_file_release_section_cache(elf);
+    size_t headers_size = elf->sections_count * sizeof(Elf32_Shdr);
+    if(headers_size <= SECTION_HEADERS_CACHE_MAX && sH.sh_size <= SECTION_NAMES_CACHE_MAX) {
+        elf->section_headers = malloc(headers_size);
+        elf->section_names = malloc(sH.sh_size + 1);
+        elf->section_names_size = sH.sh_size;
+        if(!storage_file_seek(elf->fd, elf->section_table, true) ||
+           storage_file_read(elf->fd, elf->section_headers, headers_size) != headers_size ||
+           !storage_file_seek(elf->fd, elf->section_table_strings, true) ||
+           storage_file_read(elf->fd, elf->section_names, sH.sh_size) != sH.sh_size) {
+            elf_file_release_section_cache(elf);
+        } else {
+            elf->section_names[sH.sh_size] = '\0';
+        }
+    }
+
     return true;
 }
 
@@ -902,7 +1004,17 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     ELFFileLoadStatus status = ELFFileLoadStatusSuccess;
     ELFSectionDict_it_t it;
 
-    AddressCache_init(elf->relocation_cache);
+    memset(&elf->relocation_stats, 0, sizeof(ELFRelocationStats));
+
+    // Every relocation record looks up its target section, don't walk the dict for each one
+    elf->section_index = malloc(sizeof(ELFSection*) * elf->sections_count);
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+        if(itref->value.sec_idx < elf->sections_count &&
+           !elf->section_index[itref->value.sec_idx]) {
+            elf->section_index[itref->value.sec_idx] = &itref->value;
+        }
+    }
 
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -925,9 +1037,13 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
         }
     }
 
-    FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
-    FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
-    AddressCache_clear(elf->relocation_cache);
+    elf->relocation_stats.trampolines = AddressCache_size(elf->trampoline_cache);
+    FURI_LOG_D(TAG, "Relocation cache size: %lu", elf->relocation_stats.cache_size);
+    FURI_LOG_D(TAG, "Trampoline cache size: %lu", elf->relocation_stats.trampolines);
+    relocation_cache_free(elf);
+    elf_relocation_stats = elf->relocation_stats;
+    free(elf->section_index);
+    elf->section_index = NULL;
 
     {
         size_t total_size = 0;
@@ -943,6 +1059,11 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     return status;
 }
 
+void elf_file_get_relocation_stats(ELFRelocationStats* stats) {
+    furi_assert(stats);
+    *stats = elf_relocation_stats;
+}
+
 void elf_file_call_init(ELFFile* elf) {
     furi_check(!elf->init_array_called);
     elf_file_call_section_list(elf->preinit_array, false);
@@ -45,6 +45,14 @@ typedef enum {
 
 typedef bool(ElfProcessSection)(File* file, size_t offset, size_t size, void* context);
 
+typedef struct {
+    uint32_t relocations;
+    uint32_t symbol_lookups;
+    uint32_t cache_hits;
+    uint32_t cache_size;
+    uint32_t trampolines;
+} ELFRelocationStats;
+
 /**
  * @brief Allocate ELFFile instance
  * @param storage 
@@ -146,6 +154,12 @@ ElfProcessSectionResult elf_process_section(
     ElfProcessSection* process_section,
     void* context);
 
+/**
+ * @brief Get relocation statistics of the last loaded ELF file
+ * @param stats 
+ */
+void elf_file_get_relocation_stats(ELFRelocationStats* stats);
+
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
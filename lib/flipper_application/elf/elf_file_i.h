@@ -32,14 +32,23 @@ struct ELFFile {
     size_t sections_count;
     off_t section_table;
     off_t section_table_strings;
+    // Section headers and names read at once, NULL if too large to keep in RAM
+    Elf32_Shdr* section_headers;
+    char* section_names;
+    size_t section_names_size;
 
     size_t symbol_count;
     off_t symbol_table;
     off_t symbol_table_strings;
     off_t entry;
     ELFSectionDict_t sections;
+    // Section lookup by index, only valid while sections are being relocated
+    ELFSection** section_index;
 
-    AddressCache_t relocation_cache;
+    // Symbol addresses by symbol index, allocated only for sections without fast relocation
+    Elf32_Addr* relocation_cache;
+    size_t relocation_cache_count;
+    ELFRelocationStats relocation_stats;
     AddressCache_t trampoline_cache;
 
     File* fd;
@@ -2,6 +2,7 @@
 #include "elf/elf_file.h"
 #include <notification/notification_messages.h>
 #include "application_assets.h"
+#include "application_meta_cache.h"
 #include <loader/firmware_api/firmware_api.h>
 #include <storage/storage_processing.h>
 
@@ -15,8 +16,33 @@ struct FlipperApplication {
     ELFFile* elf;
     FuriThread* thread;
     void* ep_thread_args;
+
+    FlipperApplicationLoadStats load_stats;
+    uint32_t load_phase_tick;
+    size_t load_phase_free_heap;
 };
 
+/****************************** Load profiling *******************************/
+
+// Applications started as threads, plugins and manifest reads don't overwrite it
+static FlipperApplicationLoadStats flipper_application_last_load_stats = {0};
+static const FlipperApplication* flipper_application_last_load_app = NULL;
+
+static void flipper_application_load_phase_begin(FlipperApplication* app) {
+    app->load_phase_tick = furi_get_tick();
+    app->load_phase_free_heap = memmgr_get_free_heap();
+}
+
+static void flipper_application_load_phase_end(
+    FlipperApplication* app,
+    FlipperApplicationLoadPhase phase) {
+    FlipperApplicationLoadPhaseStats* stats = &app->load_stats.phases[phase];
+    stats->duration = furi_get_tick() - app->load_phase_tick;
+    stats->heap = (int32_t)(app->load_phase_free_heap - memmgr_get_free_heap());
+    // Next phase starts where this one ended
+    flipper_application_load_phase_begin(app);
+}
+
 /********************** Debugger access to loader state **********************/
 
 LIST_DEF(FlipperApplicationList, const FlipperApplication*, M_POD_OPLIST);
@@ -150,9 +176,12 @@ static bool flipper_application_process_assets_section(
 
 static FlipperApplicationPreloadStatus
     flipper_application_load(FlipperApplication* app, const char* path, bool load_full) {
+    flipper_application_load_phase_begin(app);
+
     if(!elf_file_open(app->elf, path)) {
         return FlipperApplicationPreloadStatusInvalidFile;
     }
+    flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseOpen);
 
     // if we are loading full file
     if(load_full) {
@@ -160,6 +189,7 @@ static FlipperApplicationPreloadStatus
         if(!elf_file_load_section_table(app->elf)) {
             return FlipperApplicationPreloadStatusInvalidFile;
         }
+        flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseSectionTable);
 
         // load assets section
         FlipperApplicationPreloadAssetsContext preload_context = {.path = path};
@@ -170,6 +200,7 @@ static FlipperApplicationPreloadStatus
                &preload_context) == ElfProcessSectionResultCannotProcess) {
             return FlipperApplicationPreloadStatusInvalidFile;
         }
+        flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseAssets);
     }
 
     // load manifest section
@@ -178,6 +209,7 @@ static FlipperApplicationPreloadStatus
        ElfProcessSectionResultSuccess) {
         return FlipperApplicationPreloadStatusInvalidFile;
     }
+    flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseManifest);
 
     return flipper_application_validate_manifest(app);
 }
@@ -199,7 +231,9 @@ const FlipperApplicationManifest* flipper_application_get_manifest(FlipperApplic
 }
 
 FlipperApplicationLoadStatus flipper_application_map_to_memory(FlipperApplication* app) {
+    flipper_application_load_phase_begin(app);
     ELFFileLoadStatus status = elf_file_load_sections(app->elf);
+    flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseRelocate);
 
     switch(status) {
     case ELFFileLoadStatusSuccess:
@@ -219,7 +253,13 @@ static int32_t flipper_application_thread(void* context) {
     furi_assert(context);
     FlipperApplication* app = (FlipperApplication*)context;
 
+    flipper_application_load_phase_begin(app);
     elf_file_call_init(app->elf);
+    flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseInit);
+    app->load_stats.free_heap_at_entry = memmgr_get_free_heap();
+    if(flipper_application_last_load_app == app) {
+        flipper_application_last_load_stats = app->load_stats;
+    }
 
     FlipperApplicationEntryPoint entry_point = elf_file_get_entry_point(app->elf);
     int32_t ret_code = entry_point(app->ep_thread_args);
@@ -252,12 +292,40 @@ FuriThread* flipper_application_alloc_thread(FlipperApplication* app, const char
     }
 
     const FlipperApplicationManifest* manifest = flipper_application_get_manifest(app);
+    flipper_application_load_phase_begin(app);
     app->thread = furi_thread_alloc_ex(
         manifest->name, manifest->stack_size, flipper_application_thread, app);
+    flipper_application_load_phase_end(app, FlipperApplicationLoadPhaseThread);
+
+    strlcpy(app->load_stats.name, manifest->name, sizeof(app->load_stats.name));
+    flipper_application_last_load_stats = app->load_stats;
+    flipper_application_last_load_app = app;
 
     return app->thread;
 }
 
+static const char* load_phase_strings[] = {
+    [FlipperApplicationLoadPhaseOpen] = "Open",
+    [FlipperApplicationLoadPhaseSectionTable] = "Section table",
+    [FlipperApplicationLoadPhaseAssets] = "Assets",
+    [FlipperApplicationLoadPhaseManifest] = "Manifest",
+    [FlipperApplicationLoadPhaseRelocate] = "Load and relocate",
+    [FlipperApplicationLoadPhaseThread] = "Thread alloc",
+    [FlipperApplicationLoadPhaseInit] = "Init arrays",
+};
+
+const char* flipper_application_load_phase_to_string(FlipperApplicationLoadPhase phase) {
+    if(phase >= COUNT_OF(load_phase_strings) || load_phase_strings[phase] == NULL) {
+        return "Unknown";
+    }
+    return load_phase_strings[phase];
+}
+
+void flipper_application_get_last_load_stats(FlipperApplicationLoadStats* stats) {
+    furi_assert(stats);
+    *stats = flipper_application_last_load_stats;
+}
+
 static const char* preload_status_strings[] = {
     [FlipperApplicationPreloadStatusSuccess] = "Success",
     [FlipperApplicationPreloadStatusUnspecifiedError] = "Unknown error",
@@ -330,7 +398,28 @@ bool flipper_application_load_name_and_icon(
         load_success = false;
     }
 
-    if(load_success) {
+    FlipperApplicationMetaCacheKey cache_key;
+    FlipperApplicationMetaCacheEntry* cache_entry = NULL;
+    bool cached = false;
+    if(load_success &&
+       flipper_application_meta_cache_key(storage, furi_string_get_cstr(path), &cache_key)) {
+        cache_entry = malloc(sizeof(FlipperApplicationMetaCacheEntry));
+        if(flipper_application_meta_cache_get(storage, &cache_key, cache_entry)) {
+            if(cache_entry->has_icon && icon_ptr != NULL && *icon_ptr != NULL) {
+                memcpy(*icon_ptr, cache_entry->icon, FAP_MANIFEST_MAX_ICON_SIZE);
+            }
+            if(cache_entry->loaded) {
+                furi_string_set_strn(
+                    item_name,
+                    cache_entry->name,
+                    strnlen(cache_entry->name, FAP_MANIFEST_MAX_APP_NAME_LENGTH));
+            }
+            load_success = cache_entry->loaded;
+            cached = true;
+        }
+    }
+
+    if(load_success && !cached) {
         load_success = false;
 
         FlipperApplication* app = flipper_application_alloc(storage, firmware_api_interface);
@@ -347,12 +436,25 @@ bool flipper_application_load_name_and_icon(
             }
             furi_string_set(item_name, manifest->name);
             load_success = true;
+
+            if(cache_entry) {
+                cache_entry->loaded = true;
+                cache_entry->has_icon = manifest->has_icon;
+                strncpy(cache_entry->name, manifest->name, sizeof(cache_entry->name));
+                memcpy(cache_entry->icon, manifest->icon, sizeof(cache_entry->icon));
+            }
         } else {
             FURI_LOG_E(TAG, "Failed to preload %s", furi_string_get_cstr(path));
         }
 
+        // Remember broken files too, unless it failed for reasons other than file contents
+        if(cache_entry && preload_res != FlipperApplicationPreloadStatusUnspecifiedError) {
+            flipper_application_meta_cache_put(storage, &cache_key, cache_entry);
+        }
+
         flipper_application_free(app);
     }
+    free(cache_entry);
 
     if(!load_success) {
         size_t offset = furi_string_search_rchar(path, '/');
@@ -47,6 +47,41 @@ const char* flipper_application_preload_status_to_string(FlipperApplicationPrelo
  */
 const char* flipper_application_load_status_to_string(FlipperApplicationLoadStatus status);
 
+typedef enum {
+    FlipperApplicationLoadPhaseOpen,
+    FlipperApplicationLoadPhaseSectionTable,
+    FlipperApplicationLoadPhaseAssets,
+    FlipperApplicationLoadPhaseManifest,
+    FlipperApplicationLoadPhaseRelocate,
+    FlipperApplicationLoadPhaseThread,
+    FlipperApplicationLoadPhaseInit,
+    FlipperApplicationLoadPhaseCount,
+} FlipperApplicationLoadPhase;
+
+typedef struct {
+    uint32_t duration; /**< Phase duration in ticks */
+    int32_t heap; /**< Bytes allocated during phase, negative if freed */
+} FlipperApplicationLoadPhaseStats;
+
+typedef struct {
+    char name[FAP_MANIFEST_MAX_APP_NAME_LENGTH];
+    FlipperApplicationLoadPhaseStats phases[FlipperApplicationLoadPhaseCount];
+    size_t free_heap_at_entry; /**< Free heap when entry point was called, 0 if not yet */
+} FlipperApplicationLoadStats;
+
+/**
+ * @brief Get text description of load phase
+ * @param phase Load phase
+ * @return String pointer to description
+ */
+const char* flipper_application_load_phase_to_string(FlipperApplicationLoadPhase phase);
+
+/**
+ * @brief Get load profile of the last application thread allocated
+ * @param stats Output for load profile
+ */
+void flipper_application_get_last_load_stats(FlipperApplicationLoadStats* stats);
+
 typedef struct FlipperApplication FlipperApplication;
 
 typedef struct {
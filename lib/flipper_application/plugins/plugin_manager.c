@@ -1,4 +1,5 @@
 #include "plugin_manager.h"
+#include "composite_resolver.h"
 
 #include <loader/firmware_api/firmware_api.h>
 #include <storage/storage.h>
@@ -16,39 +17,84 @@
 ARRAY_DEF(FlipperApplicationList, FlipperApplication*, M_PTR_OPLIST)
 #define M_OPL_FlipperApplicationList_t() ARRAY_OPLIST(FlipperApplicationList, M_PTR_OPLIST)
 
+typedef struct {
+    FuriString* path;
+    FlipperApplication* app;
+    uint32_t ref_count;
+} PluginLibrary;
+
+ARRAY_DEF(PluginLibraryList, PluginLibrary*, M_PTR_OPLIST)
+#define M_OPL_PluginLibraryList_t() ARRAY_OPLIST(PluginLibraryList, M_PTR_OPLIST)
+
 struct PluginManager {
     const char* application_id;
     uint32_t api_version;
     Storage* storage;
     FlipperApplicationList_t libs;
     const ElfApiInterface* api_interface;
+    // Created on first shared library load, chains api_interface with libraries' APIs
+    CompositeApiResolver* resolver;
+    PluginLibraryList_t shared_libs;
 };
 
-PluginManager* plugin_manager_alloc(
-    const char* application_id,
-    uint32_t api_version,
-    const ElfApiInterface* api_interface) {
-    PluginManager* manager = malloc(sizeof(PluginManager));
-    manager->application_id = application_id;
-    manager->api_version = api_version;
-    manager->api_interface = api_interface ? api_interface : firmware_api_interface;
-    manager->storage = furi_record_open(RECORD_STORAGE);
-    FlipperApplicationList_init(manager->libs);
-    return manager;
-}
+// Shared libraries loaded by all managers
+static FuriMutex* plugin_library_mutex = NULL;
+static PluginLibraryList_t plugin_library_list;
 
-void plugin_manager_free(PluginManager* manager) {
-    for
-        M_EACH(loaded_lib, manager->libs, FlipperApplicationList_t) {
-            flipper_application_free(*loaded_lib);
+static void plugin_library_lock() {
+    if(!plugin_library_mutex) {
+        FuriMutex* mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        bool used = false;
+        FURI_CRITICAL_ENTER();
+        if(!plugin_library_mutex) {
+            plugin_library_mutex = mutex;
+            used = true;
         }
-    FlipperApplicationList_clear(manager->libs);
-    furi_record_close(RECORD_STORAGE);
-    free(manager);
+        FURI_CRITICAL_EXIT();
+        if(used) {
+            PluginLibraryList_init(plugin_library_list);
+        } else {
+            furi_mutex_free(mutex);
+        }
+    }
+    furi_check(furi_mutex_acquire(plugin_library_mutex, FuriWaitForever) == FuriStatusOk);
 }
 
-PluginManagerError plugin_manager_load_single(PluginManager* manager, const char* path) {
-    FlipperApplication* lib = flipper_application_alloc(manager->storage, manager->api_interface);
+static void plugin_library_unlock() {
+    furi_check(furi_mutex_release(plugin_library_mutex) == FuriStatusOk);
+}
+
+static PluginManagerError plugin_manager_check_descriptor(
+    const FlipperAppPluginDescriptor* app_descriptor,
+    const char* path,
+    const char* application_id,
+    uint32_t api_version) {
+    if(!app_descriptor) {
+        FURI_LOG_E(TAG, "Failed to get descriptor %s", path);
+        return PluginManagerErrorLoaderError;
+    }
+
+    if(strcmp(app_descriptor->appid, application_id) != 0) {
+        FURI_LOG_E(TAG, "Application id mismatch %s", path);
+        return PluginManagerErrorApplicationIdMismatch;
+    }
+
+    if(app_descriptor->ep_api_version != api_version) {
+        FURI_LOG_E(TAG, "API version mismatch %s", path);
+        return PluginManagerErrorAPIVersionMismatch;
+    }
+
+    return PluginManagerErrorNone;
+}
+
+static PluginManagerError plugin_manager_load_plugin(
+    Storage* storage,
+    const ElfApiInterface* api_interface,
+    const char* path,
+    const char* application_id,
+    uint32_t api_version,
+    FlipperApplication** plugin) {
+    FlipperApplication* lib = flipper_application_alloc(storage, api_interface);
 
     PluginManagerError error = PluginManagerErrorNone;
     do {
@@ -73,37 +119,170 @@ PluginManagerError plugin_manager_load_single(PluginManager* manager, const char
             break;
         }
 
-        const FlipperAppPluginDescriptor* app_descriptor =
-            flipper_application_plugin_get_descriptor(lib);
+        error = plugin_manager_check_descriptor(
+            flipper_application_plugin_get_descriptor(lib), path, application_id, api_version);
+    } while(false);
 
-        if(!app_descriptor) {
-            FURI_LOG_E(TAG, "Failed to get descriptor %s", path);
-            error = PluginManagerErrorLoaderError;
-            break;
+    if(error != PluginManagerErrorNone) {
+        flipper_application_free(lib);
+    } else {
+        *plugin = lib;
+    }
+
+    return error;
+}
+
+static PluginManagerError plugin_library_acquire(
+    Storage* storage,
+    const char* path,
+    const char* library_id,
+    uint32_t api_version,
+    PluginLibrary** library) {
+    PluginManagerError error = PluginManagerErrorNone;
+    PluginLibrary* found = NULL;
+
+    plugin_library_lock();
+    for
+        M_EACH(item, plugin_library_list, PluginLibraryList_t) {
+            if(furi_string_cmp_str((*item)->path, path) == 0) {
+                found = *item;
+                break;
+            }
         }
 
-        if(strcmp(app_descriptor->appid, manager->application_id) != 0) {
-            FURI_LOG_E(TAG, "Application id mismatch %s", path);
-            error = PluginManagerErrorApplicationIdMismatch;
-            break;
+    if(found) {
+        error = plugin_manager_check_descriptor(
+            flipper_application_plugin_get_descriptor(found->app), path, library_id, api_version);
+        if(error == PluginManagerErrorNone) found->ref_count++;
+    } else {
+        FlipperApplication* app = NULL;
+        error = plugin_manager_load_plugin(
+            storage, firmware_api_interface, path, library_id, api_version, &app);
+        if(error == PluginManagerErrorNone) {
+            found = malloc(sizeof(PluginLibrary));
+            found->path = furi_string_alloc_set(path);
+            found->app = app;
+            found->ref_count = 1;
+            PluginLibraryList_push_back(plugin_library_list, found);
+            FURI_LOG_I(TAG, "Loaded shared library %s", path);
         }
+    }
+    plugin_library_unlock();
 
-        if(app_descriptor->ep_api_version != manager->api_version) {
-            FURI_LOG_E(TAG, "API version mismatch %s", path);
-            error = PluginManagerErrorAPIVersionMismatch;
-            break;
+    if(error == PluginManagerErrorNone) *library = found;
+    return error;
+}
+
+static void plugin_library_release(PluginLibrary* library) {
+    plugin_library_lock();
+    furi_check(library->ref_count > 0);
+    if(--library->ref_count == 0) {
+        PluginLibraryList_it_t it;
+        for(PluginLibraryList_it(it, plugin_library_list); !PluginLibraryList_end_p(it);
+            PluginLibraryList_next(it)) {
+            if(*PluginLibraryList_ref(it) == library) {
+                PluginLibraryList_remove(plugin_library_list, it);
+                break;
+            }
         }
+        FURI_LOG_I(TAG, "Unloaded shared library %s", furi_string_get_cstr(library->path));
+        flipper_application_free(library->app);
+        furi_string_free(library->path);
+        free(library);
+    }
+    plugin_library_unlock();
+}
 
-        FlipperApplicationList_push_back(manager->libs, lib);
-    } while(false);
+PluginManager* plugin_manager_alloc(
+    const char* application_id,
+    uint32_t api_version,
+    const ElfApiInterface* api_interface) {
+    PluginManager* manager = malloc(sizeof(PluginManager));
+    manager->application_id = application_id;
+    manager->api_version = api_version;
+    manager->api_interface = api_interface ? api_interface : firmware_api_interface;
+    manager->storage = furi_record_open(RECORD_STORAGE);
+    FlipperApplicationList_init(manager->libs);
+    PluginLibraryList_init(manager->shared_libs);
+    return manager;
+}
 
-    if(error != PluginManagerErrorNone) {
-        flipper_application_free(lib);
+void plugin_manager_free(PluginManager* manager) {
+    for
+        M_EACH(loaded_lib, manager->libs, FlipperApplicationList_t) {
+            flipper_application_free(*loaded_lib);
+        }
+    FlipperApplicationList_clear(manager->libs);
+    // Plugins may call into shared libraries, release them only after plugins are gone
+    for
+        M_EACH(shared_lib, manager->shared_libs, PluginLibraryList_t) {
+            plugin_library_release(*shared_lib);
+        }
+    PluginLibraryList_clear(manager->shared_libs);
+    if(manager->resolver) {
+        composite_api_resolver_free(manager->resolver);
+    }
+    furi_record_close(RECORD_STORAGE);
+    free(manager);
+}
+
+PluginManagerError plugin_manager_load_single(PluginManager* manager, const char* path) {
+    FlipperApplication* lib = NULL;
+    PluginManagerError error = plugin_manager_load_plugin(
+        manager->storage,
+        manager->api_interface,
+        path,
+        manager->application_id,
+        manager->api_version,
+        &lib);
+
+    if(error == PluginManagerErrorNone) {
+        FlipperApplicationList_push_back(manager->libs, lib);
     }
 
     return error;
 }
 
+PluginManagerError plugin_manager_load_library(
+    PluginManager* manager,
+    const char* path,
+    const char* library_id,
+    uint32_t api_version) {
+    furi_assert(manager);
+    furi_assert(path);
+    furi_assert(library_id);
+
+    for
+        M_EACH(shared_lib, manager->shared_libs, PluginLibraryList_t) {
+            if(furi_string_cmp_str((*shared_lib)->path, path) == 0) {
+                return PluginManagerErrorNone;
+            }
+        }
+
+    PluginLibrary* library = NULL;
+    PluginManagerError error =
+        plugin_library_acquire(manager->storage, path, library_id, api_version, &library);
+    if(error != PluginManagerErrorNone) return error;
+
+    const ElfApiInterface* library_api =
+        flipper_application_plugin_get_descriptor(library->app)->entry_point;
+    if(!library_api || !library_api->resolver_callback) {
+        FURI_LOG_E(TAG, "Not a library %s", path);
+        plugin_library_release(library);
+        return PluginManagerErrorLoaderError;
+    }
+
+    if(!manager->resolver) {
+        manager->resolver = composite_api_resolver_alloc();
+        composite_api_resolver_add(manager->resolver, manager->api_interface);
+        manager->api_interface = composite_api_resolver_get(manager->resolver);
+    }
+    composite_api_resolver_add(manager->resolver, library_api);
+    PluginLibraryList_push_back(manager->shared_libs, library);
+
+    return PluginManagerErrorNone;
+}
+
 PluginManagerError plugin_manager_load_all(PluginManager* manager, const char* path) {
     File* directory = storage_file_alloc(manager->storage);
     char file_name_buffer[MAX_NAME_LEN];
@@ -46,6 +46,23 @@ void plugin_manager_free(PluginManager* manager);
  */
 PluginManagerError plugin_manager_load_single(PluginManager* manager, const char* path);
 
+/**
+ * @brief Loads shared library and makes its API available to plugins loaded after it
+ * Library is a plugin with ElfApiInterface* as entry point, exporting its symbols.
+ * It is loaded once and shared by all PluginManager instances using the same path,
+ * so it must not keep per-user state. Library's own imports are resolved with firmware API.
+ * @param manager PluginManager instance
+ * @param path Path to library
+ * @param library_id Library ID, must match library's appid
+ * @param api_version Library API version, must match library's ep_api_version
+ * @return Error code
+ */
+PluginManagerError plugin_manager_load_library(
+    PluginManager* manager,
+    const char* path,
+    const char* library_id,
+    uint32_t api_version);
+
 /**
  * @brief Loads all plugins from specified directory
  * @param manager PluginManager instance
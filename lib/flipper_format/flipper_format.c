@@ -1,4 +1,5 @@
 #include <core/check.h>
+#include <core/arena.h>
 #include <toolbox/stream/stream.h>
 #include <toolbox/stream/string_stream.h>
 #include <toolbox/stream/file_stream.h>
@@ -7,11 +8,35 @@
 #include "flipper_format_i.h"
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
+#include "flipper_format_binary_i.h"
+#include <m-array.h>
+#include <string.h>
+
+#define FLIPPER_FORMAT_INDEX_MAX_KEYS 128U
+#define FLIPPER_FORMAT_INDEX_MAX_ENTRIES 1024U
+#define FLIPPER_FORMAT_INDEX_KEYS_CHUNK_SIZE 256U
 
 /********************************** Private **********************************/
+typedef struct {
+    uint32_t offset;
+    uint16_t key_id;
+} FlipperFormatIndexEntry;
+
+ARRAY_DEF(FlipperFormatIndexEntryArray, FlipperFormatIndexEntry, M_POD_OPLIST);
+ARRAY_DEF(FlipperFormatIndexKeyArray, const char*, M_PTR_OPLIST);
+
+typedef struct {
+    FuriArena* keys_arena;
+    FlipperFormatIndexKeyArray_t keys;
+    FlipperFormatIndexEntryArray_t entries;
+} FlipperFormatIndex;
+
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    FlipperFormatIndex* index;
+    FlipperFormatEncoding encoding;
+    bool binary;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
@@ -21,6 +46,152 @@ Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
     return flipper_format->stream;
 }
 
+static void flipper_format_index_reset(FlipperFormat* flipper_format) {
+    FlipperFormatIndex* index = flipper_format->index;
+    if(!index) return;
+
+    FlipperFormatIndexKeyArray_clear(index->keys);
+    furi_arena_free(index->keys_arena);
+    FlipperFormatIndexEntryArray_clear(index->entries);
+    free(index);
+    flipper_format->index = NULL;
+}
+
+static bool flipper_format_index_add(const FuriString* key, size_t offset, void* context) {
+    FlipperFormatIndex* index = context;
+
+    if(FlipperFormatIndexEntryArray_size(index->entries) >= FLIPPER_FORMAT_INDEX_MAX_ENTRIES) {
+        return false;
+    }
+
+    size_t key_id = 0;
+    const size_t key_count = FlipperFormatIndexKeyArray_size(index->keys);
+    while(key_id < key_count &&
+          !furi_string_equal_str(key, *FlipperFormatIndexKeyArray_get(index->keys, key_id))) {
+        key_id++;
+    }
+
+    if(key_id == key_count) {
+        if(key_count >= FLIPPER_FORMAT_INDEX_MAX_KEYS) return false;
+        FlipperFormatIndexKeyArray_push_back(
+            index->keys, furi_arena_strdup(index->keys_arena, furi_string_get_cstr(key)));
+    }
+
+    FlipperFormatIndexEntry* entry = FlipperFormatIndexEntryArray_push_new(index->entries);
+    entry->offset = offset;
+    entry->key_id = key_id;
+    return true;
+}
+
+/**
+ * Move the RW pointer to the key line that search from the current position would stop at.
+ * Without index the RW pointer is left as is for search to run.
+ * @return false if search would not find the key, RW pointer is at the end then
+ */
+static bool flipper_format_index_seek(FlipperFormat* flipper_format, const char* key) {
+    FlipperFormatIndex* index = flipper_format->index;
+    if(!index) return true;
+
+    const size_t key_count = FlipperFormatIndexKeyArray_size(index->keys);
+    size_t key_id = 0;
+    while(key_id < key_count &&
+          strcmp(*FlipperFormatIndexKeyArray_get(index->keys, key_id), key)) {
+        key_id++;
+    }
+
+    // first key at or after the current position
+    const size_t position = stream_tell(flipper_format->stream);
+    const size_t entry_count = FlipperFormatIndexEntryArray_size(index->entries);
+    size_t low = 0;
+    size_t high = entry_count;
+    while(low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if(FlipperFormatIndexEntryArray_get(index->entries, middle)->offset < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    // strict search stops at the first key, any other at the first matching one
+    for(size_t i = low; i < entry_count; i++) {
+        const FlipperFormatIndexEntry* entry = FlipperFormatIndexEntryArray_get(index->entries, i);
+        if(flipper_format->strict_mode || entry->key_id == key_id) {
+            return stream_seek(flipper_format->stream, entry->offset, StreamOffsetFromStart);
+        }
+    }
+
+    stream_seek(flipper_format->stream, 0, StreamOffsetFromEnd);
+    return false;
+}
+
+static bool flipper_format_read_value_line(
+    FlipperFormat* flipper_format,
+    const char* key,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size) {
+    if(!flipper_format_index_seek(flipper_format, key)) return false;
+
+    if(flipper_format->binary) {
+        return flipper_format_binary_read_value_line(
+            flipper_format->stream, key, type, data, data_size, flipper_format->strict_mode);
+    } else {
+        return flipper_format_stream_read_value_line(
+            flipper_format->stream, key, type, data, data_size, flipper_format->strict_mode);
+    }
+}
+
+static bool
+    flipper_format_write_value_line(FlipperFormat* flipper_format, FlipperStreamWriteData* data) {
+    flipper_format_index_reset(flipper_format);
+    if(flipper_format->binary) {
+        return flipper_format_binary_write_value_line(flipper_format->stream, data);
+    } else {
+        return flipper_format_stream_write_value_line(flipper_format->stream, data);
+    }
+}
+
+static bool flipper_format_delete_key_and_write(
+    FlipperFormat* flipper_format,
+    FlipperStreamWriteData* data) {
+    flipper_format_index_reset(flipper_format);
+    if(flipper_format->binary) {
+        return flipper_format_binary_delete_key_and_write(
+            flipper_format->stream, data, flipper_format->strict_mode);
+    } else {
+        return flipper_format_stream_delete_key_and_write(
+            flipper_format->stream, data, flipper_format->strict_mode);
+    }
+}
+
+static bool flipper_format_seek_to_key(FlipperFormat* flipper_format, const char* key) {
+    if(flipper_format->binary) {
+        return flipper_format_binary_seek_to_key(flipper_format->stream, key, false);
+    } else {
+        return flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+    }
+}
+
+/** Pick up encoding of the opened file, new files get the one of the instance */
+static bool flipper_format_open_encoding(FlipperFormat* flipper_format, bool opened) {
+    flipper_format->binary = false;
+    if(!opened) return false;
+
+    if(stream_size(flipper_format->stream) == 0) {
+        if(flipper_format->encoding == FlipperFormatEncodingBinary) {
+            flipper_format->binary = true;
+            return flipper_format_binary_write_magic(flipper_format->stream);
+        }
+    } else {
+        const size_t position = stream_tell(flipper_format->stream);
+        flipper_format->binary = flipper_format_binary_detect(flipper_format->stream);
+        return stream_seek(flipper_format->stream, position, StreamOffsetFromStart);
+    }
+
+    return true;
+}
+
 /********************************** Public **********************************/
 
 FlipperFormat* flipper_format_string_alloc() {
@@ -31,38 +202,59 @@ FlipperFormat* flipper_format_string_alloc() {
 }
 
 FlipperFormat* flipper_format_file_alloc(Storage* storage) {
+    return flipper_format_file_alloc_ex(storage, FlipperFormatEncodingText);
+}
+
+FlipperFormat* flipper_format_file_alloc_ex(Storage* storage, FlipperFormatEncoding encoding) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->encoding = encoding;
     return flipper_format;
 }
 
 FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
+    return flipper_format_buffered_file_alloc_ex(storage, FlipperFormatEncodingText);
+}
+
+FlipperFormat*
+    flipper_format_buffered_file_alloc_ex(Storage* storage, FlipperFormatEncoding encoding) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = buffered_file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->encoding = encoding;
     return flipper_format;
 }
 
 bool flipper_format_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
-    return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    flipper_format_index_reset(flipper_format);
+    return flipper_format_open_encoding(
+        flipper_format,
+        file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
 }
 
 bool flipper_format_buffered_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
-    return buffered_file_stream_open(
-        flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    flipper_format_index_reset(flipper_format);
+    return flipper_format_open_encoding(
+        flipper_format,
+        buffered_file_stream_open(
+            flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
 }
 
 bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_index_reset(flipper_format);
 
-    bool result =
-        file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_APPEND);
+    bool result = flipper_format_open_encoding(
+        flipper_format,
+        file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_APPEND));
 
-    // Add EOL if it is not there
-    if(stream_size(flipper_format->stream) >= 1) {
+    if(!result || flipper_format->binary) {
+        stream_seek(flipper_format->stream, 0, StreamOffsetFromEnd);
+    } else if(stream_size(flipper_format->stream) >= 1) {
+        // Add EOL if it is not there
         do {
             char last_char;
             result = false;
@@ -88,32 +280,46 @@ bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char*
 
 bool flipper_format_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
-    return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
+    flipper_format_index_reset(flipper_format);
+    return flipper_format_open_encoding(
+        flipper_format,
+        file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
 }
 
 bool flipper_format_buffered_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
-    return buffered_file_stream_open(
-        flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
+    flipper_format_index_reset(flipper_format);
+    return flipper_format_open_encoding(
+        flipper_format,
+        buffered_file_stream_open(
+            flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
 }
 
 bool flipper_format_file_open_new(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
-    return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_NEW);
+    flipper_format_index_reset(flipper_format);
+    return flipper_format_open_encoding(
+        flipper_format,
+        file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_NEW));
 }
 
 bool flipper_format_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_reset(flipper_format);
+    flipper_format->binary = false;
     return file_stream_close(flipper_format->stream);
 }
 
 bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_reset(flipper_format);
+    flipper_format->binary = false;
     return buffered_file_stream_close(flipper_format->stream);
 }
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_reset(flipper_format);
     stream_free(flipper_format->stream);
     free(flipper_format);
 }
@@ -122,6 +328,37 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+bool flipper_format_build_index(FlipperFormat* flipper_format) {
+    furi_assert(flipper_format);
+    flipper_format_index_reset(flipper_format);
+
+    FlipperFormatIndex* index = malloc(sizeof(FlipperFormatIndex));
+    index->keys_arena = furi_arena_alloc(FLIPPER_FORMAT_INDEX_KEYS_CHUNK_SIZE);
+    FlipperFormatIndexKeyArray_init(index->keys);
+    FlipperFormatIndexEntryArray_init(index->entries);
+    flipper_format->index = index;
+
+    const size_t position = stream_tell(flipper_format->stream);
+    bool result = stream_rewind(flipper_format->stream);
+    if(result && flipper_format->binary) {
+        result = flipper_format_binary_read_keys(
+            flipper_format->stream, flipper_format_index_add, index);
+    } else if(result) {
+        result = flipper_format_stream_read_keys(
+            flipper_format->stream, flipper_format_index_add, index);
+    }
+
+    if(!stream_seek(flipper_format->stream, position, StreamOffsetFromStart)) {
+        result = false;
+    }
+
+    if(!result) {
+        flipper_format_index_reset(flipper_format);
+    }
+
+    return result;
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -135,7 +372,12 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
-    bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+    // lookup is not strict, regardless of the mode
+    const bool strict_mode = flipper_format->strict_mode;
+    flipper_format->strict_mode = false;
+    bool result = flipper_format_index_seek(flipper_format, key) &&
+                  flipper_format_seek_to_key(flipper_format, key);
+    flipper_format->strict_mode = strict_mode;
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
     return result;
@@ -174,14 +416,27 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_assert(flipper_format);
-    return flipper_format_stream_get_value_count(
-        flipper_format->stream, key, count, flipper_format->strict_mode);
+    const size_t position = stream_tell(flipper_format->stream);
+    bool result = flipper_format_index_seek(flipper_format, key);
+    if(result && flipper_format->binary) {
+        result = flipper_format_binary_get_value_count(
+            flipper_format->stream, key, count, flipper_format->strict_mode);
+    } else if(result) {
+        result = flipper_format_stream_get_value_count(
+            flipper_format->stream, key, count, flipper_format->strict_mode);
+    }
+
+    // value count lookup does not move the RW pointer
+    if(!stream_seek(flipper_format->stream, position, StreamOffsetFromStart)) {
+        result = false;
+    }
+
+    return result;
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
+    return flipper_format_read_value_line(flipper_format, key, FlipperStreamValueStr, data, 1);
 }
 
 bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
@@ -192,7 +447,7 @@ bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key,
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -207,7 +462,7 @@ bool flipper_format_write_string_cstr(
         .data = data,
         .data_size = 1,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -217,13 +472,12 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
+    return flipper_format_read_value_line(
+        flipper_format,
         key,
         FlipperStreamValueHexUint64,
         data,
-        data_size,
-        flipper_format->strict_mode);
+        data_size);
 }
 
 bool flipper_format_write_hex_uint64(
@@ -238,7 +492,7 @@ bool flipper_format_write_hex_uint64(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -248,13 +502,12 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
+    return flipper_format_read_value_line(
+        flipper_format,
         key,
         FlipperStreamValueUint32,
         data,
-        data_size,
-        flipper_format->strict_mode);
+        data_size);
 }
 
 bool flipper_format_write_uint32(
@@ -269,7 +522,7 @@ bool flipper_format_write_uint32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -278,13 +531,12 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
+    return flipper_format_read_value_line(
+        flipper_format,
         key,
         FlipperStreamValueInt32,
         data,
-        data_size,
-        flipper_format->strict_mode);
+        data_size);
 }
 
 bool flipper_format_write_int32(
@@ -299,7 +551,7 @@ bool flipper_format_write_int32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -308,13 +560,12 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
+    return flipper_format_read_value_line(
+        flipper_format,
         key,
         FlipperStreamValueBool,
         data,
-        data_size,
-        flipper_format->strict_mode);
+        data_size);
 }
 
 bool flipper_format_write_bool(
@@ -329,7 +580,7 @@ bool flipper_format_write_bool(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -338,13 +589,12 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
+    return flipper_format_read_value_line(
+        flipper_format,
         key,
         FlipperStreamValueFloat,
         data,
-        data_size,
-        flipper_format->strict_mode);
+        data_size);
 }
 
 bool flipper_format_write_float(
@@ -359,7 +609,7 @@ bool flipper_format_write_float(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -368,13 +618,12 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream,
+    return flipper_format_read_value_line(
+        flipper_format,
         key,
         FlipperStreamValueHex,
         data,
-        data_size,
-        flipper_format->strict_mode);
+        data_size);
 }
 
 bool flipper_format_write_hex(
@@ -389,7 +638,7 @@ bool flipper_format_write_hex(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -400,7 +649,12 @@ bool flipper_format_write_comment(FlipperFormat* flipper_format, FuriString* dat
 
 bool flipper_format_write_comment_cstr(FlipperFormat* flipper_format, const char* data) {
     furi_assert(flipper_format);
-    return flipper_format_stream_write_comment_cstr(flipper_format->stream, data);
+    flipper_format_index_reset(flipper_format);
+    if(flipper_format->binary) {
+        return flipper_format_binary_write_comment_cstr(flipper_format->stream, data);
+    } else {
+        return flipper_format_stream_write_comment_cstr(flipper_format->stream, data);
+    }
 }
 
 bool flipper_format_delete_key(FlipperFormat* flipper_format, const char* key) {
@@ -411,8 +665,7 @@ bool flipper_format_delete_key(FlipperFormat* flipper_format, const char* key) {
         .data = NULL,
         .data_size = 0,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -424,8 +677,7 @@ bool flipper_format_update_string(FlipperFormat* flipper_format, const char* key
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -440,8 +692,7 @@ bool flipper_format_update_string_cstr(
         .data = data,
         .data_size = 1,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -457,8 +708,7 @@ bool flipper_format_update_uint32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -473,8 +723,7 @@ bool flipper_format_update_int32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -489,8 +738,7 @@ bool flipper_format_update_bool(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -505,8 +753,7 @@ bool flipper_format_update_float(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -521,8 +768,7 @@ bool flipper_format_update_hex(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -642,3 +888,309 @@ bool flipper_format_insert_or_update_hex(
 
     return result;
 }
+
+/**
+ * Write text value in the encoding of destination. For binary the value gets
+ * the first type that writes back to the same text, so every read of it gives
+ * the same result as on the text file. Values of no such type stay strings.
+ */
+static bool flipper_format_convert_text_value(
+    FlipperFormat* destination,
+    const char* key,
+    FuriString* value) {
+    static const FlipperStreamValue types[] = {
+        FlipperStreamValueBool,
+        FlipperStreamValueHex,
+        FlipperStreamValueHexUint64,
+        FlipperStreamValueUint32,
+        FlipperStreamValueInt32,
+#ifndef FLIPPER_STREAM_LITE
+        FlipperStreamValueFloat,
+#endif
+    };
+
+    FlipperStreamWriteData write_data = {
+        .key = key,
+        .type = FlipperStreamValueStr,
+        .data = furi_string_get_cstr(value),
+        .data_size = 1,
+    };
+
+    void* data = NULL;
+    uint32_t count = 0;
+    Stream* text = NULL;
+    Stream* check = NULL;
+    FuriString* check_value = NULL;
+
+    if(destination->binary) {
+        text = string_stream_alloc();
+        check = string_stream_alloc();
+        check_value = furi_string_alloc();
+
+        if(flipper_format_stream_write_value_line(text, &write_data) && stream_rewind(text) &&
+           flipper_format_stream_get_value_count(text, key, &count, false) &&
+           count <= UINT16_MAX) {
+            data = malloc(count * sizeof(uint64_t));
+        }
+    }
+
+    for(size_t i = 0; data && i < COUNT_OF(types); i++) {
+        FlipperStreamWriteData typed_data = {
+            .key = key,
+            .type = types[i],
+            .data = data,
+            .data_size = count,
+        };
+
+        stream_clean(check);
+        if(stream_rewind(text) &&
+           flipper_format_stream_read_value_line(text, key, types[i], data, count, false) &&
+           flipper_format_stream_write_value_line(check, &typed_data) && stream_rewind(check) &&
+           flipper_format_stream_read_value_line(
+               check, key, FlipperStreamValueStr, check_value, 1, false) &&
+           furi_string_equal(check_value, value)) {
+            write_data = typed_data;
+            break;
+        }
+    }
+
+    bool result = flipper_format_write_value_line(destination, &write_data);
+
+    free(data);
+    if(check_value) furi_string_free(check_value);
+    if(check) stream_free(check);
+    if(text) stream_free(text);
+
+    return result;
+}
+
+bool flipper_format_convert(FlipperFormat* source, FlipperFormat* destination) {
+    furi_assert(source);
+    furi_assert(destination);
+
+    FuriString* key = furi_string_alloc();
+    bool result = stream_rewind(source->stream);
+
+    if(source->binary) {
+        FlipperStreamWriteData write_data;
+        while(result && flipper_format_binary_read_next(source->stream, key, &write_data)) {
+            result = flipper_format_write_value_line(destination, &write_data);
+            free((void*)write_data.data);
+        }
+    } else {
+        FuriString* value = furi_string_alloc();
+        while(result && flipper_format_stream_read_next(source->stream, key, value)) {
+            result = flipper_format_convert_text_value(
+                destination, furi_string_get_cstr(key), value);
+        }
+        furi_string_free(value);
+    }
+
+    // reading stops early on broken records
+    if(!stream_eof(source->stream)) result = false;
+
+    furi_string_free(key);
+    return result;
+}
+
+struct FlipperFormatArrayReader {
+    FlipperFormat* flipper_format;
+    FuriString* key;
+    FlipperStreamValue type;
+    bool join_lines;
+    bool in_line;
+    // binary record read right from the file
+    uint32_t remaining;
+    size_t record_end;
+    // text line of binary record of other type
+    Stream* text;
+    bool text_line;
+};
+
+FlipperFormatArrayReader* flipper_format_array_reader_alloc(FlipperFormat* flipper_format) {
+    furi_assert(flipper_format);
+    FlipperFormatArrayReader* reader = malloc(sizeof(FlipperFormatArrayReader));
+    reader->flipper_format = flipper_format;
+    reader->key = furi_string_alloc();
+    reader->text = string_stream_alloc();
+    return reader;
+}
+
+/** Move RW pointer past the binary record that is not read to the end */
+static void flipper_format_array_reader_leave(FlipperFormatArrayReader* reader) {
+    if(reader->in_line && reader->flipper_format->binary && !reader->text_line) {
+        stream_seek(reader->flipper_format->stream, reader->record_end, StreamOffsetFromStart);
+    }
+
+    reader->in_line = false;
+}
+
+void flipper_format_array_reader_free(FlipperFormatArrayReader* reader) {
+    furi_assert(reader);
+    flipper_format_array_reader_leave(reader);
+    stream_free(reader->text);
+    furi_string_free(reader->key);
+    free(reader);
+}
+
+/** Seek to the values of the key line, stream of the line set by text_line */
+static bool
+    flipper_format_array_reader_seek(FlipperFormatArrayReader* reader, bool strict_mode) {
+    FlipperFormat* flipper_format = reader->flipper_format;
+    const char* key = furi_string_get_cstr(reader->key);
+
+    reader->remaining = 0;
+    reader->text_line = false;
+
+    if(flipper_format->binary) {
+        reader->in_line = flipper_format_binary_array_start(
+            flipper_format->stream,
+            key,
+            strict_mode,
+            reader->type,
+            &reader->remaining,
+            &reader->record_end,
+            reader->text);
+        reader->text_line = stream_size(reader->text) != 0;
+    } else {
+        reader->in_line =
+            flipper_format_stream_seek_to_key(flipper_format->stream, key, strict_mode);
+    }
+
+    return reader->in_line;
+}
+
+static bool flipper_format_array_reader_start(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    FlipperStreamValue type,
+    bool join_lines) {
+    furi_assert(reader);
+    flipper_format_array_reader_leave(reader);
+
+    furi_string_set(reader->key, key);
+    reader->type = type;
+
+    const bool result =
+        flipper_format_index_seek(reader->flipper_format, key) &&
+        flipper_format_array_reader_seek(reader, reader->flipper_format->strict_mode);
+    reader->join_lines = join_lines && result;
+
+    return result;
+}
+
+static bool flipper_format_array_reader_read(
+    FlipperFormatArrayReader* reader,
+    void* data,
+    size_t element_size,
+    size_t data_size,
+    size_t* count) {
+    furi_assert(reader);
+    Stream* stream = reader->flipper_format->stream;
+    bool result = true;
+
+    *count = 0;
+    while(*count < data_size) {
+        if(!reader->in_line) {
+            if(!reader->join_lines) break;
+
+            // next line continues the array only if it is right after and has the same key
+            const size_t position = stream_tell(stream);
+            if(!flipper_format_array_reader_seek(reader, true)) {
+                stream_seek(stream, position, StreamOffsetFromStart);
+                break;
+            }
+        }
+
+        uint8_t* chunk = (uint8_t*)data + *count * element_size;
+        const size_t chunk_size = data_size - *count;
+        size_t chunk_count = 0;
+
+        if(reader->flipper_format->binary && !reader->text_line) {
+            chunk_count = MIN(chunk_size, reader->remaining);
+            result = flipper_format_binary_array_read(stream, reader->type, chunk, chunk_count);
+            reader->remaining -= chunk_count;
+            if(reader->remaining == 0) reader->in_line = false;
+        } else {
+            result = flipper_format_stream_read_array(
+                reader->text_line ? reader->text : stream,
+                reader->type,
+                chunk,
+                chunk_size,
+                &chunk_count);
+            if(chunk_count < chunk_size) reader->in_line = false;
+        }
+
+        *count += chunk_count;
+        if(!result) {
+            flipper_format_array_reader_leave(reader);
+            break;
+        }
+    }
+
+    return result;
+}
+
+bool flipper_format_array_reader_start_int32(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines) {
+    return flipper_format_array_reader_start(reader, key, FlipperStreamValueInt32, join_lines);
+}
+
+bool flipper_format_array_reader_read_int32(
+    FlipperFormatArrayReader* reader,
+    int32_t* data,
+    size_t data_size,
+    size_t* count) {
+    furi_check(reader->type == FlipperStreamValueInt32);
+    return flipper_format_array_reader_read(reader, data, sizeof(int32_t), data_size, count);
+}
+
+bool flipper_format_array_reader_start_uint32(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines) {
+    return flipper_format_array_reader_start(reader, key, FlipperStreamValueUint32, join_lines);
+}
+
+bool flipper_format_array_reader_read_uint32(
+    FlipperFormatArrayReader* reader,
+    uint32_t* data,
+    size_t data_size,
+    size_t* count) {
+    furi_check(reader->type == FlipperStreamValueUint32);
+    return flipper_format_array_reader_read(reader, data, sizeof(uint32_t), data_size, count);
+}
+
+bool flipper_format_array_reader_start_float(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines) {
+    return flipper_format_array_reader_start(reader, key, FlipperStreamValueFloat, join_lines);
+}
+
+bool flipper_format_array_reader_read_float(
+    FlipperFormatArrayReader* reader,
+    float* data,
+    size_t data_size,
+    size_t* count) {
+    furi_check(reader->type == FlipperStreamValueFloat);
+    return flipper_format_array_reader_read(reader, data, sizeof(float), data_size, count);
+}
+
+bool flipper_format_array_reader_start_hex(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines) {
+    return flipper_format_array_reader_start(reader, key, FlipperStreamValueHex, join_lines);
+}
+
+bool flipper_format_array_reader_read_hex(
+    FlipperFormatArrayReader* reader,
+    uint8_t* data,
+    size_t data_size,
+    size_t* count) {
+    furi_check(reader->type == FlipperStreamValueHex);
+    return flipper_format_array_reader_read(reader, data, sizeof(uint8_t), data_size, count);
+}
@@ -108,6 +108,12 @@ typedef struct FlipperFormat FlipperFormat;
  */
 FlipperFormat* flipper_format_string_alloc();
 
+/** Encoding of the files written by FlipperFormat */
+typedef enum {
+    FlipperFormatEncodingText, /**< Human readable text, default */
+    FlipperFormatEncodingBinary, /**< Compact binary records, for files only read by apps */
+} FlipperFormatEncoding;
+
 /**
  * Allocate FlipperFormat as file.
  * @return FlipperFormat* pointer to a FlipperFormat instance
@@ -120,6 +126,28 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage);
  */
 FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage);
 
+/**
+ * Allocate FlipperFormat as file, with encoding of new files.
+ * Existing files are read and updated in their own encoding, whatever it is,
+ * so text and binary files are handled the same way by every instance.
+ * Binary files are smaller and faster to read, but not human readable.
+ * Reads of a type other than the written one are slower on binary files.
+ * @param storage Storage instance
+ * @param encoding encoding of files created, or of existing files when empty
+ * @return FlipperFormat* pointer to a FlipperFormat instance
+ */
+FlipperFormat* flipper_format_file_alloc_ex(Storage* storage, FlipperFormatEncoding encoding);
+
+/**
+ * Allocate FlipperFormat as file, buffered mode, with encoding of new files.
+ * See flipper_format_file_alloc_ex().
+ * @param storage Storage instance
+ * @param encoding encoding of files created, or of existing files when empty
+ * @return FlipperFormat* pointer to a FlipperFormat instance
+ */
+FlipperFormat*
+    flipper_format_buffered_file_alloc_ex(Storage* storage, FlipperFormatEncoding encoding);
+
 /**
  * Open existing file. 
  * Use only if FlipperFormat allocated as a file.
@@ -203,6 +231,30 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/**
+ * Build index of the keys to speed up reads of files with many keys.
+ * Reads and key lookups jump straight to the key line instead of scanning the
+ * stream, the results are the same as without index. Index is dropped on any
+ * write, on open and on close, so it is meant for files that are only read.
+ * Building fails for files with more than 1024 keys or 128 distinct keys.
+ * RW pointer is not moved.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @return True on success, reads work without index otherwise
+ */
+bool flipper_format_build_index(FlipperFormat* flipper_format);
+
+/**
+ * Copy all keys from source to destination, in the encoding of destination.
+ * Use it to convert files between text and binary encodings. Text values are
+ * stored with the type they are written by, or as strings if unclear.
+ * Comments are not copied. Source is read from the beginning, destination is
+ * written at the RW pointer.
+ * @param source Pointer to a FlipperFormat instance to read
+ * @param destination Pointer to a FlipperFormat instance to write
+ * @return True on success
+ */
+bool flipper_format_convert(FlipperFormat* source, FlipperFormat* destination);
+
 /**
  * Rewind the RW pointer.
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -679,6 +731,137 @@ bool flipper_format_insert_or_update_hex(
     const uint8_t* data,
     const uint16_t data_size);
 
+/** Array reader, reads values of a key in chunks */
+typedef struct FlipperFormatArrayReader FlipperFormatArrayReader;
+
+/**
+ * Allocate array reader.
+ * Reads big arrays chunk by chunk, without counting values first and without
+ * buffer for the whole array. Reader reads from the RW pointer of FlipperFormat
+ * instance, so other reads should not be done in between reader calls.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @return FlipperFormatArrayReader* pointer to an array reader instance
+ */
+FlipperFormatArrayReader* flipper_format_array_reader_alloc(FlipperFormat* flipper_format);
+
+/**
+ * Free array reader. RW pointer is moved past the array line being read.
+ * @param reader Pointer to an array reader instance
+ */
+void flipper_format_array_reader_free(FlipperFormatArrayReader* reader);
+
+/**
+ * Find the key and start reading its values as int32.
+ * Key is searched the same way as by flipper_format_read_int32().
+ * @param reader Pointer to an array reader instance
+ * @param key Key
+ * @param join_lines True to read values of the lines right after the found
+ * one that have the same key, as the continuation of the array
+ * @return True if the key is found
+ */
+bool flipper_format_array_reader_start_int32(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines);
+
+/**
+ * Read next chunk of int32 values.
+ * @param reader Pointer to an array reader instance
+ * @param data Values
+ * @param data_size Maximum number of values to read
+ * @param count Number of values read, less than data_size at the end of array
+ * @return False if a value can't be parsed
+ */
+bool flipper_format_array_reader_read_int32(
+    FlipperFormatArrayReader* reader,
+    int32_t* data,
+    size_t data_size,
+    size_t* count);
+
+/**
+ * Find the key and start reading its values as uint32.
+ * See flipper_format_array_reader_start_int32().
+ * @param reader Pointer to an array reader instance
+ * @param key Key
+ * @param join_lines True to read the following lines of the same key too
+ * @return True if the key is found
+ */
+bool flipper_format_array_reader_start_uint32(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines);
+
+/**
+ * Read next chunk of uint32 values.
+ * See flipper_format_array_reader_read_int32().
+ * @param reader Pointer to an array reader instance
+ * @param data Values
+ * @param data_size Maximum number of values to read
+ * @param count Number of values read, less than data_size at the end of array
+ * @return False if a value can't be parsed
+ */
+bool flipper_format_array_reader_read_uint32(
+    FlipperFormatArrayReader* reader,
+    uint32_t* data,
+    size_t data_size,
+    size_t* count);
+
+/**
+ * Find the key and start reading its values as float.
+ * See flipper_format_array_reader_start_int32().
+ * @param reader Pointer to an array reader instance
+ * @param key Key
+ * @param join_lines True to read the following lines of the same key too
+ * @return True if the key is found
+ */
+bool flipper_format_array_reader_start_float(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines);
+
+/**
+ * Read next chunk of float values.
+ * See flipper_format_array_reader_read_int32().
+ * @param reader Pointer to an array reader instance
+ * @param data Values
+ * @param data_size Maximum number of values to read
+ * @param count Number of values read, less than data_size at the end of array
+ * @return False if a value can't be parsed
+ */
+bool flipper_format_array_reader_read_float(
+    FlipperFormatArrayReader* reader,
+    float* data,
+    size_t data_size,
+    size_t* count);
+
+/**
+ * Find the key and start reading its values as hex bytes.
+ * See flipper_format_array_reader_start_int32().
+ * @param reader Pointer to an array reader instance
+ * @param key Key
+ * @param join_lines True to read the following lines of the same key too
+ * @return True if the key is found
+ */
+bool flipper_format_array_reader_start_hex(
+    FlipperFormatArrayReader* reader,
+    const char* key,
+    bool join_lines);
+
+/**
+ * Read next chunk of hex bytes.
+ * See flipper_format_array_reader_read_int32().
+ * @param reader Pointer to an array reader instance
+ * @param data Values
+ * @param data_size Maximum number of values to read
+ * @param count Number of values read, less than data_size at the end of array
+ * @return False if a value can't be parsed
+ */
+bool flipper_format_array_reader_read_hex(
+    FlipperFormatArrayReader* reader,
+    uint8_t* data,
+    size_t data_size,
+    size_t* count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,819 @@
+#include <core/check.h>
+#include <toolbox/stream/string_stream.h>
+#include "flipper_format_binary_i.h"
+
+#define FLIPPER_FORMAT_BINARY_BUFFER_SIZE 64U
+#define FLIPPER_FORMAT_BINARY_VARINT_SIZE 5U
+
+static const uint8_t flipper_format_binary_magic[FLIPPER_FORMAT_BINARY_MAGIC_SIZE] =
+    {0xFF, 'F', 'F', 'B', 0x01};
+
+/** Record types as stored in files, do not change the values */
+typedef enum {
+    FlipperFormatBinaryTypeComment = 0x00,
+    FlipperFormatBinaryTypeStr = 0x01,
+    FlipperFormatBinaryTypeHex = 0x02,
+    FlipperFormatBinaryTypeFloat = 0x03,
+    FlipperFormatBinaryTypeInt32 = 0x04,
+    FlipperFormatBinaryTypeUint32 = 0x05,
+    FlipperFormatBinaryTypeHexUint64 = 0x06,
+    FlipperFormatBinaryTypeBool = 0x07,
+} FlipperFormatBinaryType;
+
+typedef struct {
+    uint8_t type;
+    size_t start;
+    uint32_t key_size;
+    uint32_t value_size;
+} FlipperFormatBinaryRecord;
+
+typedef struct {
+    Stream* stream;
+    uint8_t buffer[FLIPPER_FORMAT_BINARY_BUFFER_SIZE];
+    size_t size;
+    size_t position;
+    bool error;
+} FlipperFormatBinaryBuffer;
+
+static bool flipper_format_binary_get_type(FlipperStreamValue value, uint8_t* type) {
+    switch(value) {
+    case FlipperStreamValueStr:
+        *type = FlipperFormatBinaryTypeStr;
+        break;
+    case FlipperStreamValueHex:
+        *type = FlipperFormatBinaryTypeHex;
+        break;
+#ifndef FLIPPER_STREAM_LITE
+    case FlipperStreamValueFloat:
+        *type = FlipperFormatBinaryTypeFloat;
+        break;
+#endif
+    case FlipperStreamValueInt32:
+        *type = FlipperFormatBinaryTypeInt32;
+        break;
+    case FlipperStreamValueUint32:
+        *type = FlipperFormatBinaryTypeUint32;
+        break;
+    case FlipperStreamValueHexUint64:
+        *type = FlipperFormatBinaryTypeHexUint64;
+        break;
+    case FlipperStreamValueBool:
+        *type = FlipperFormatBinaryTypeBool;
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+static bool flipper_format_binary_get_value(uint8_t type, FlipperStreamValue* value) {
+    switch(type) {
+    case FlipperFormatBinaryTypeStr:
+        *value = FlipperStreamValueStr;
+        break;
+    case FlipperFormatBinaryTypeHex:
+        *value = FlipperStreamValueHex;
+        break;
+#ifndef FLIPPER_STREAM_LITE
+    case FlipperFormatBinaryTypeFloat:
+        *value = FlipperStreamValueFloat;
+        break;
+#endif
+    case FlipperFormatBinaryTypeInt32:
+        *value = FlipperStreamValueInt32;
+        break;
+    case FlipperFormatBinaryTypeUint32:
+        *value = FlipperStreamValueUint32;
+        break;
+    case FlipperFormatBinaryTypeHexUint64:
+        *value = FlipperStreamValueHexUint64;
+        break;
+    case FlipperFormatBinaryTypeBool:
+        *value = FlipperStreamValueBool;
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+static size_t flipper_format_binary_element_size(FlipperStreamValue type) {
+    switch(type) {
+    case FlipperStreamValueHex:
+        return sizeof(uint8_t);
+    case FlipperStreamValueFloat:
+        return sizeof(float);
+    case FlipperStreamValueInt32:
+        return sizeof(int32_t);
+    case FlipperStreamValueUint32:
+        return sizeof(uint32_t);
+    case FlipperStreamValueHexUint64:
+        return sizeof(uint64_t);
+    case FlipperStreamValueBool:
+        return sizeof(bool);
+    default:
+        furi_crash("Unknown FF type");
+    }
+}
+
+static inline uint32_t flipper_format_binary_zigzag_encode(int32_t value) {
+    return ((uint32_t)value << 1) ^ -((uint32_t)value >> 31);
+}
+
+static inline int32_t flipper_format_binary_zigzag_decode(uint32_t value) {
+    return (int32_t)((value >> 1) ^ -(value & 1));
+}
+
+static size_t flipper_format_binary_varint_size(uint32_t value) {
+    size_t size = 1;
+    while(value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+/******************************** Reader **********************************/
+
+static void flipper_format_binary_reader_init(FlipperFormatBinaryBuffer* reader, Stream* stream) {
+    reader->stream = stream;
+    reader->size = 0;
+    reader->position = 0;
+    reader->error = false;
+}
+
+static size_t flipper_format_binary_reader_tell(FlipperFormatBinaryBuffer* reader) {
+    return stream_tell(reader->stream) - (reader->size - reader->position);
+}
+
+/** Give back data read past the reader position */
+static bool flipper_format_binary_reader_finish(FlipperFormatBinaryBuffer* reader) {
+    const size_t unread = reader->size - reader->position;
+    reader->size = 0;
+    reader->position = 0;
+    return unread == 0 || stream_seek(reader->stream, -(int32_t)unread, StreamOffsetFromCurrent);
+}
+
+static bool flipper_format_binary_reader_read(
+    FlipperFormatBinaryBuffer* reader,
+    void* data,
+    size_t size) {
+    uint8_t* out = data;
+
+    while(size) {
+        if(reader->position == reader->size) {
+            if(size >= FLIPPER_FORMAT_BINARY_BUFFER_SIZE) {
+                // large blocks go straight to the destination
+                return stream_read(reader->stream, out, size) == size;
+            }
+
+            reader->size =
+                stream_read(reader->stream, reader->buffer, FLIPPER_FORMAT_BINARY_BUFFER_SIZE);
+            reader->position = 0;
+            if(reader->size == 0) return false;
+        }
+
+        const size_t chunk = MIN(size, reader->size - reader->position);
+        memcpy(out, &reader->buffer[reader->position], chunk);
+        reader->position += chunk;
+        out += chunk;
+        size -= chunk;
+    }
+
+    return true;
+}
+
+static bool flipper_format_binary_reader_skip(FlipperFormatBinaryBuffer* reader, size_t size) {
+    const size_t buffered = reader->size - reader->position;
+    if(size <= buffered) {
+        reader->position += size;
+        return true;
+    }
+
+    reader->position = reader->size;
+    const size_t offset = size - buffered;
+    return (stream_tell(reader->stream) + offset <= stream_size(reader->stream)) &&
+           stream_seek(reader->stream, offset, StreamOffsetFromCurrent);
+}
+
+static bool
+    flipper_format_binary_reader_varint(FlipperFormatBinaryBuffer* reader, uint32_t* value) {
+    uint32_t result = 0;
+
+    for(size_t i = 0; i < FLIPPER_FORMAT_BINARY_VARINT_SIZE; i++) {
+        uint8_t byte;
+        if(!flipper_format_binary_reader_read(reader, &byte, 1)) return false;
+
+        result |= (uint32_t)(byte & 0x7F) << (i * 7);
+        if(!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool flipper_format_binary_reader_string(
+    FlipperFormatBinaryBuffer* reader,
+    size_t size,
+    FuriString* string) {
+    char chunk[16];
+
+    while(size) {
+        const size_t chunk_size = MIN(size, sizeof(chunk));
+        if(!flipper_format_binary_reader_read(reader, chunk, chunk_size)) return false;
+        furi_string_cat_strn(string, chunk, chunk_size);
+        size -= chunk_size;
+    }
+
+    return true;
+}
+
+static bool flipper_format_binary_reader_key_equal(
+    FlipperFormatBinaryBuffer* reader,
+    size_t size,
+    const char* key,
+    bool* equal) {
+    *equal = (strlen(key) == size);
+    if(!*equal) return flipper_format_binary_reader_skip(reader, size);
+
+    char chunk[16];
+    for(size_t done = 0; done < size;) {
+        const size_t chunk_size = MIN(size - done, sizeof(chunk));
+        if(!flipper_format_binary_reader_read(reader, chunk, chunk_size)) return false;
+        if(memcmp(chunk, key + done, chunk_size) != 0) *equal = false;
+        done += chunk_size;
+    }
+
+    return true;
+}
+
+static bool flipper_format_binary_reader_elements(
+    FlipperFormatBinaryBuffer* reader,
+    FlipperStreamValue type,
+    void* _data,
+    size_t count) {
+    switch(type) {
+    case FlipperStreamValueHex:
+    case FlipperStreamValueFloat:
+    case FlipperStreamValueHexUint64:
+        // little endian, same as in memory
+        return flipper_format_binary_reader_read(
+            reader, _data, count * flipper_format_binary_element_size(type));
+    case FlipperStreamValueBool: {
+        bool* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            uint8_t byte;
+            if(!flipper_format_binary_reader_read(reader, &byte, 1)) return false;
+            data[i] = (byte != 0);
+        }
+    }; break;
+    case FlipperStreamValueUint32: {
+        uint32_t* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            if(!flipper_format_binary_reader_varint(reader, &data[i])) return false;
+        }
+    }; break;
+    case FlipperStreamValueInt32: {
+        int32_t* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            uint32_t value;
+            if(!flipper_format_binary_reader_varint(reader, &value)) return false;
+            data[i] = flipper_format_binary_zigzag_decode(value);
+        }
+    }; break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/** Read record header, reader is left at the key */
+static bool flipper_format_binary_reader_header(
+    FlipperFormatBinaryBuffer* reader,
+    FlipperFormatBinaryRecord* record) {
+    record->start = flipper_format_binary_reader_tell(reader);
+    return flipper_format_binary_reader_read(reader, &record->type, 1) &&
+           flipper_format_binary_reader_varint(reader, &record->key_size);
+}
+
+static bool flipper_format_binary_skip_magic(Stream* stream) {
+    return stream_tell(stream) >= FLIPPER_FORMAT_BINARY_MAGIC_SIZE ||
+           stream_seek(stream, FLIPPER_FORMAT_BINARY_MAGIC_SIZE, StreamOffsetFromStart);
+}
+
+/** Find the record of the key, RW pointer is moved to its value */
+static bool flipper_format_binary_find(
+    Stream* stream,
+    const char* key,
+    bool strict_mode,
+    FlipperFormatBinaryRecord* record) {
+    if(!flipper_format_binary_skip_magic(stream)) return false;
+
+    FlipperFormatBinaryBuffer reader;
+    flipper_format_binary_reader_init(&reader, stream);
+    bool found = false;
+
+    while(flipper_format_binary_reader_header(&reader, record)) {
+        bool equal = false;
+        if(!flipper_format_binary_reader_key_equal(&reader, record->key_size, key, &equal)) break;
+        if(!flipper_format_binary_reader_varint(&reader, &record->value_size)) break;
+
+        if(record->type != FlipperFormatBinaryTypeComment) {
+            if(equal) {
+                found = true;
+                break;
+            } else if(strict_mode) {
+                break;
+            }
+        }
+
+        if(!flipper_format_binary_reader_skip(&reader, record->value_size)) break;
+    }
+
+    if(!flipper_format_binary_reader_finish(&reader)) found = false;
+    return found;
+}
+
+/** Read the value of the found record to allocated write data, type and size */
+static bool flipper_format_binary_read_data(
+    Stream* stream,
+    const FlipperFormatBinaryRecord* record,
+    FlipperStreamValue type,
+    FlipperStreamWriteData* write_data) {
+    FlipperFormatBinaryBuffer reader;
+    flipper_format_binary_reader_init(&reader, stream);
+    bool result = false;
+    void* data = NULL;
+    uint32_t count = 1;
+
+    if(type == FlipperStreamValueStr) {
+        if(record->value_size <= stream_size(stream) - stream_tell(stream)) {
+            char* string = malloc(record->value_size + 1);
+            result = flipper_format_binary_reader_read(&reader, string, record->value_size);
+            string[record->value_size] = '\0';
+            data = string;
+        }
+    } else if(flipper_format_binary_reader_varint(&reader, &count)) {
+        // every element takes at least a byte, writes are limited to uint16 sizes
+        if(count <= record->value_size && count <= UINT16_MAX) {
+            data = malloc(MAX(count, 1U) * flipper_format_binary_element_size(type));
+            result = flipper_format_binary_reader_elements(&reader, type, data, count);
+        }
+    }
+
+    if(!flipper_format_binary_reader_finish(&reader)) result = false;
+
+    if(!result) {
+        free(data);
+        data = NULL;
+    }
+
+    write_data->type = type;
+    write_data->data = data;
+    write_data->data_size = count;
+    return result;
+}
+
+/** Write the found record to the text stream as a text line, text is rewound */
+static bool flipper_format_binary_record_to_text(
+    Stream* stream,
+    const FlipperFormatBinaryRecord* record,
+    const char* key,
+    Stream* text) {
+    FlipperStreamValue record_type;
+    if(!flipper_format_binary_get_value(record->type, &record_type)) return false;
+
+    FlipperStreamWriteData write_data = {.key = key};
+    bool result = flipper_format_binary_read_data(stream, record, record_type, &write_data) &&
+                  flipper_format_stream_write_value_line(text, &write_data) &&
+                  stream_rewind(text);
+
+    free((void*)write_data.data);
+    return result;
+}
+
+/** Read the value of the found record through its text encoding */
+static bool flipper_format_binary_read_as_text(
+    Stream* stream,
+    const FlipperFormatBinaryRecord* record,
+    const char* key,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size,
+    uint32_t* count) {
+    Stream* text = string_stream_alloc();
+    bool result = flipper_format_binary_record_to_text(stream, record, key, text);
+
+    if(result) {
+        if(count) {
+            result = flipper_format_stream_get_value_count(text, key, count, false);
+        } else {
+            result =
+                flipper_format_stream_read_value_line(text, key, type, data, data_size, false);
+        }
+    }
+
+    stream_free(text);
+    return result;
+}
+
+/******************************** Writer **********************************/
+
+static void flipper_format_binary_writer_flush(FlipperFormatBinaryBuffer* writer) {
+    if(writer->size && !writer->error) {
+        writer->error = stream_write(writer->stream, writer->buffer, writer->size) != writer->size;
+    }
+    writer->size = 0;
+}
+
+static void flipper_format_binary_writer_put(
+    FlipperFormatBinaryBuffer* writer,
+    const void* data,
+    size_t size) {
+    const uint8_t* in = data;
+
+    while(size) {
+        if(writer->size == 0 && size >= FLIPPER_FORMAT_BINARY_BUFFER_SIZE) {
+            // large blocks go straight to the stream
+            if(!writer->error) writer->error = stream_write(writer->stream, in, size) != size;
+            return;
+        }
+
+        const size_t chunk = MIN(size, FLIPPER_FORMAT_BINARY_BUFFER_SIZE - writer->size);
+        memcpy(&writer->buffer[writer->size], in, chunk);
+        writer->size += chunk;
+        in += chunk;
+        size -= chunk;
+
+        if(writer->size == FLIPPER_FORMAT_BINARY_BUFFER_SIZE) {
+            flipper_format_binary_writer_flush(writer);
+        }
+    }
+}
+
+static void
+    flipper_format_binary_writer_varint(FlipperFormatBinaryBuffer* writer, uint32_t value) {
+    uint8_t bytes[FLIPPER_FORMAT_BINARY_VARINT_SIZE];
+    size_t size = 0;
+
+    do {
+        bytes[size] = value & 0x7F;
+        value >>= 7;
+        if(value) bytes[size] |= 0x80;
+        size++;
+    } while(value);
+
+    flipper_format_binary_writer_put(writer, bytes, size);
+}
+
+static size_t
+    flipper_format_binary_elements_size(FlipperStreamValue type, const void* _data, size_t count) {
+    size_t size = 0;
+
+    if(type == FlipperStreamValueUint32) {
+        const uint32_t* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            size += flipper_format_binary_varint_size(data[i]);
+        }
+    } else if(type == FlipperStreamValueInt32) {
+        const int32_t* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            const uint32_t value = flipper_format_binary_zigzag_encode(data[i]);
+            size += flipper_format_binary_varint_size(value);
+        }
+    } else if(type == FlipperStreamValueBool) {
+        size = count;
+    } else {
+        size = count * flipper_format_binary_element_size(type);
+    }
+
+    return size;
+}
+
+static void flipper_format_binary_writer_elements(
+    FlipperFormatBinaryBuffer* writer,
+    FlipperStreamValue type,
+    const void* _data,
+    size_t count) {
+    if(type == FlipperStreamValueUint32) {
+        const uint32_t* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            flipper_format_binary_writer_varint(writer, data[i]);
+        }
+    } else if(type == FlipperStreamValueInt32) {
+        const int32_t* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            flipper_format_binary_writer_varint(
+                writer, flipper_format_binary_zigzag_encode(data[i]));
+        }
+    } else if(type == FlipperStreamValueBool) {
+        const bool* data = _data;
+        for(size_t i = 0; i < count; i++) {
+            const uint8_t byte = data[i] ? 1 : 0;
+            flipper_format_binary_writer_put(writer, &byte, 1);
+        }
+    } else {
+        // little endian, same as in memory
+        flipper_format_binary_writer_put(
+            writer, _data, count * flipper_format_binary_element_size(type));
+    }
+}
+
+static bool flipper_format_binary_write_record(
+    Stream* stream,
+    uint8_t type,
+    const char* key,
+    FlipperStreamValue value_type,
+    const void* data,
+    size_t data_size) {
+    FlipperFormatBinaryBuffer writer;
+    writer.stream = stream;
+    writer.size = 0;
+    writer.error = false;
+
+    const size_t key_size = strlen(key);
+    flipper_format_binary_writer_put(&writer, &type, 1);
+    flipper_format_binary_writer_varint(&writer, key_size);
+    flipper_format_binary_writer_put(&writer, key, key_size);
+
+    if(value_type == FlipperStreamValueStr) {
+        const size_t size = strlen(data);
+        flipper_format_binary_writer_varint(&writer, size);
+        flipper_format_binary_writer_put(&writer, data, size);
+    } else {
+        const size_t size = flipper_format_binary_varint_size(data_size) +
+                            flipper_format_binary_elements_size(value_type, data, data_size);
+        flipper_format_binary_writer_varint(&writer, size);
+        flipper_format_binary_writer_varint(&writer, data_size);
+        flipper_format_binary_writer_elements(&writer, value_type, data, data_size);
+    }
+
+    flipper_format_binary_writer_flush(&writer);
+    return !writer.error;
+}
+
+/******************************** Public **********************************/
+
+bool flipper_format_binary_detect(Stream* stream) {
+    uint8_t magic[FLIPPER_FORMAT_BINARY_MAGIC_SIZE];
+
+    bool result = stream_rewind(stream) &&
+                  stream_read(stream, magic, sizeof(magic)) == sizeof(magic) &&
+                  memcmp(magic, flipper_format_binary_magic, sizeof(magic)) == 0;
+    stream_rewind(stream);
+
+    return result;
+}
+
+bool flipper_format_binary_write_magic(Stream* stream) {
+    return stream_write(stream, flipper_format_binary_magic, FLIPPER_FORMAT_BINARY_MAGIC_SIZE) ==
+           FLIPPER_FORMAT_BINARY_MAGIC_SIZE;
+}
+
+bool flipper_format_binary_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
+    FlipperFormatBinaryRecord record;
+    return flipper_format_binary_find(stream, key, strict_mode, &record);
+}
+
+bool flipper_format_binary_read_keys(
+    Stream* stream,
+    FlipperFormatStreamKeyCallback callback,
+    void* context) {
+    if(!flipper_format_binary_skip_magic(stream)) return false;
+
+    FlipperFormatBinaryBuffer reader;
+    flipper_format_binary_reader_init(&reader, stream);
+    FlipperFormatBinaryRecord record;
+    FuriString* key = furi_string_alloc();
+    bool result = true;
+
+    while(flipper_format_binary_reader_header(&reader, &record)) {
+        furi_string_reset(key);
+        if(!flipper_format_binary_reader_string(&reader, record.key_size, key) ||
+           !flipper_format_binary_reader_varint(&reader, &record.value_size)) {
+            result = false;
+            break;
+        }
+
+        if(record.type != FlipperFormatBinaryTypeComment &&
+           !callback(key, record.start, context)) {
+            result = false;
+            break;
+        }
+
+        if(!flipper_format_binary_reader_skip(&reader, record.value_size)) {
+            result = false;
+            break;
+        }
+    }
+
+    if(!flipper_format_binary_reader_finish(&reader)) result = false;
+    furi_string_free(key);
+
+    return result;
+}
+
+bool flipper_format_binary_write_value_line(Stream* stream, FlipperStreamWriteData* write_data) {
+    if(write_data->type == FlipperStreamValueIgnore) return true;
+
+    uint8_t type;
+    if(!flipper_format_binary_get_type(write_data->type, &type)) furi_crash("Unknown FF type");
+
+    return flipper_format_binary_write_record(
+        stream, type, write_data->key, write_data->type, write_data->data, write_data->data_size);
+}
+
+bool flipper_format_binary_read_value_line(
+    Stream* stream,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode) {
+    FlipperFormatBinaryRecord record;
+    if(!flipper_format_binary_find(stream, key, strict_mode, &record)) return false;
+
+    const size_t value_end = stream_tell(stream) + record.value_size;
+    FlipperStreamValue record_type;
+    bool result = false;
+
+    if(!flipper_format_binary_get_value(record.type, &record_type)) {
+        // unknown record type
+    } else if(record_type != type) {
+        result = flipper_format_binary_read_as_text(
+            stream, &record, key, type, _data, data_size, NULL);
+    } else {
+        FlipperFormatBinaryBuffer reader;
+        flipper_format_binary_reader_init(&reader, stream);
+
+        if(type == FlipperStreamValueStr) {
+            FuriString* data = _data;
+            furi_string_reset(data);
+            result = flipper_format_binary_reader_string(&reader, record.value_size, data) &&
+                     furi_string_size(data) != 0;
+        } else {
+            uint32_t count;
+            result = flipper_format_binary_reader_varint(&reader, &count) &&
+                     count >= data_size &&
+                     flipper_format_binary_reader_elements(&reader, type, _data, data_size);
+        }
+    }
+
+    // next search starts from the next record
+    if(!stream_seek(stream, value_end, StreamOffsetFromStart)) result = false;
+
+    return result;
+}
+
+bool flipper_format_binary_get_value_count(
+    Stream* stream,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode) {
+    const size_t position = stream_tell(stream);
+    FlipperFormatBinaryRecord record;
+    bool result = false;
+
+    if(flipper_format_binary_find(stream, key, strict_mode, &record)) {
+        if(record.type == FlipperFormatBinaryTypeStr) {
+            result = flipper_format_binary_read_as_text(
+                stream, &record, key, FlipperStreamValueStr, NULL, 0, count);
+        } else {
+            FlipperFormatBinaryBuffer reader;
+            flipper_format_binary_reader_init(&reader, stream);
+            result = flipper_format_binary_reader_varint(&reader, count);
+        }
+    }
+
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) {
+        result = false;
+    }
+
+    return result;
+}
+
+bool flipper_format_binary_delete_key_and_write(
+    Stream* stream,
+    FlipperStreamWriteData* write_data,
+    bool strict_mode) {
+    bool result = false;
+    FlipperFormatBinaryRecord record;
+
+    do {
+        if(!stream_rewind(stream)) break;
+        if(!flipper_format_binary_find(stream, write_data->key, strict_mode, &record)) break;
+
+        const size_t end_position = stream_tell(stream) + record.value_size;
+        if(!stream_seek(stream, record.start, StreamOffsetFromStart)) break;
+        if(!stream_delete_and_insert(
+               stream,
+               end_position - record.start,
+               (StreamWriteCB)flipper_format_binary_write_value_line,
+               write_data))
+            break;
+
+        result = true;
+    } while(false);
+
+    return result;
+}
+
+bool flipper_format_binary_array_start(
+    Stream* stream,
+    const char* key,
+    bool strict_mode,
+    FlipperStreamValue type,
+    uint32_t* count,
+    size_t* end,
+    Stream* text) {
+    FlipperFormatBinaryRecord record;
+    if(!flipper_format_binary_find(stream, key, strict_mode, &record)) return false;
+
+    *end = stream_tell(stream) + record.value_size;
+    *count = 0;
+    stream_clean(text);
+
+    uint8_t record_type;
+    if(flipper_format_binary_get_type(type, &record_type) && record.type == record_type) {
+        // elements are read right from the file
+        FlipperFormatBinaryBuffer reader;
+        flipper_format_binary_reader_init(&reader, stream);
+        return flipper_format_binary_reader_varint(&reader, count) &&
+               flipper_format_binary_reader_finish(&reader);
+    }
+
+    bool result = flipper_format_binary_record_to_text(stream, &record, key, text) &&
+                  flipper_format_stream_seek_to_key(text, key, false);
+
+    if(!stream_seek(stream, *end, StreamOffsetFromStart)) result = false;
+
+    return result;
+}
+
+bool flipper_format_binary_array_read(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* data,
+    size_t count) {
+    FlipperFormatBinaryBuffer reader;
+    flipper_format_binary_reader_init(&reader, stream);
+
+    bool result = flipper_format_binary_reader_elements(&reader, type, data, count);
+    if(!flipper_format_binary_reader_finish(&reader)) result = false;
+
+    return result;
+}
+
+bool flipper_format_binary_write_comment_cstr(Stream* stream, const char* data) {
+    return flipper_format_binary_write_record(
+        stream, FlipperFormatBinaryTypeComment, "", FlipperStreamValueStr, data, 1);
+}
+
+bool flipper_format_binary_read_next(
+    Stream* stream,
+    FuriString* key,
+    FlipperStreamWriteData* write_data) {
+    if(!flipper_format_binary_skip_magic(stream)) return false;
+
+    FlipperFormatBinaryBuffer reader;
+    flipper_format_binary_reader_init(&reader, stream);
+    FlipperFormatBinaryRecord record;
+    bool found = false;
+
+    while(flipper_format_binary_reader_header(&reader, &record)) {
+        furi_string_reset(key);
+        if(!flipper_format_binary_reader_string(&reader, record.key_size, key) ||
+           !flipper_format_binary_reader_varint(&reader, &record.value_size))
+            break;
+
+        if(record.type != FlipperFormatBinaryTypeComment) {
+            found = true;
+            break;
+        }
+
+        if(!flipper_format_binary_reader_skip(&reader, record.value_size)) break;
+    }
+
+    if(!flipper_format_binary_reader_finish(&reader) || !found) return false;
+
+    const size_t value_end = stream_tell(stream) + record.value_size;
+    FlipperStreamValue type;
+    write_data->key = furi_string_get_cstr(key);
+    write_data->data = NULL;
+
+    bool result = flipper_format_binary_get_value(record.type, &type) &&
+                  flipper_format_binary_read_data(stream, &record, type, write_data);
+
+    if(!stream_seek(stream, value_end, StreamOffsetFromStart)) {
+        free((void*)write_data->data);
+        write_data->data = NULL;
+        result = false;
+    }
+
+    return result;
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include "flipper_format_stream.h"
+#include "flipper_format_stream_i.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Binary encoding of FlipperFormat files.
+ *
+ * File starts with a magic, followed by records:
+ * type (1 byte), key length (varint), key, value length (varint), value.
+ * String value holds the string bytes, array value holds the element count
+ * (varint) and the elements: hex and bool as bytes, uint32 as varint, int32
+ * as zigzag varint, float and uint64 as little endian raw values.
+ * Value length allows to skip records without parsing them.
+ *
+ * Functions mirror flipper_format_stream ones and have the same semantics.
+ * Reads of a type other than the stored one go through the text encoding of
+ * the record, so they give the same result as on the text file.
+ */
+
+/** Size of the magic at the beginning of binary file */
+#define FLIPPER_FORMAT_BINARY_MAGIC_SIZE 5U
+
+/**
+ * Check if stream holds binary file, RW pointer is moved to the start
+ * @param stream
+ * @return true if stream starts with the binary magic
+ */
+bool flipper_format_binary_detect(Stream* stream);
+
+/**
+ * Write the binary magic at the current position
+ * @param stream
+ * @return true on success
+ */
+bool flipper_format_binary_write_magic(Stream* stream);
+
+/**
+ * Seek to the value of the key, see flipper_format_stream_seek_to_key()
+ * @param stream
+ * @param key
+ * @param strict_mode
+ * @return true if key is found
+ */
+bool flipper_format_binary_seek_to_key(Stream* stream, const char* key, bool strict_mode);
+
+/**
+ * Read all keys from the current position, see flipper_format_stream_read_keys()
+ * Offset passed to callback is the offset of the record.
+ * @param stream
+ * @param callback
+ * @param context
+ * @return true all keys are read
+ */
+bool flipper_format_binary_read_keys(
+    Stream* stream,
+    FlipperFormatStreamKeyCallback callback,
+    void* context);
+
+bool flipper_format_binary_write_value_line(Stream* stream, FlipperStreamWriteData* write_data);
+
+bool flipper_format_binary_read_value_line(
+    Stream* stream,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode);
+
+bool flipper_format_binary_get_value_count(
+    Stream* stream,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode);
+
+bool flipper_format_binary_delete_key_and_write(
+    Stream* stream,
+    FlipperStreamWriteData* write_data,
+    bool strict_mode);
+
+/**
+ * Seek to the elements of the key record for reading them in chunks
+ * If record type is not the requested one, its text line is written to the
+ * text stream, which is left at the values, and RW pointer is moved past the
+ * record. Count is 0 then.
+ * @param stream
+ * @param key
+ * @param strict_mode
+ * @param type requested type, other than string
+ * @param count number of elements in the record
+ * @param end offset of the record end
+ * @param text string stream for the text line
+ * @return true if record is found
+ */
+bool flipper_format_binary_array_start(
+    Stream* stream,
+    const char* key,
+    bool strict_mode,
+    FlipperStreamValue type,
+    uint32_t* count,
+    size_t* end,
+    Stream* text);
+
+/**
+ * Read elements of the record at the current position
+ * @param stream
+ * @param type record type
+ * @param data elements
+ * @param count number of elements to read, no more than left in the record
+ * @return true on success
+ */
+bool flipper_format_binary_array_read(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* data,
+    size_t count);
+
+bool flipper_format_binary_write_comment_cstr(Stream* stream, const char* data);
+
+/**
+ * Read next record from the current position, comments are skipped
+ * @param stream
+ * @param key record key
+ * @param write_data record data, key points to the key string and data is
+ * allocated, free it with free() once done
+ * @return true if record is read, false at the end of file or on error
+ */
+bool flipper_format_binary_read_next(
+    Stream* stream,
+    FuriString* key,
+    FlipperStreamWriteData* write_data);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,9 +1,14 @@
 #include <inttypes.h>
+#include <strings.h>
 #include <toolbox/hex.h>
 #include <core/check.h>
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
 
+#define FLIPPER_FORMAT_READ_BUFFER_SIZE 64U
+/** Longest value to parse as a number, with the terminator */
+#define FLIPPER_FORMAT_TOKEN_SIZE 64U
+
 static inline bool flipper_format_stream_is_space(char c) {
     return c == ' ' || c == '\t' || c == flipper_format_eolr;
 }
@@ -121,6 +126,30 @@ bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool str
     return found;
 }
 
+bool flipper_format_stream_read_keys(
+    Stream* stream,
+    FlipperFormatStreamKeyCallback callback,
+    void* context) {
+    bool result = true;
+    FuriString* read_key;
+
+    read_key = furi_string_alloc();
+
+    while(!stream_eof(stream)) {
+        if(flipper_format_stream_read_valid_key(stream, read_key)) {
+            // stream is at the delimiter right after the key
+            size_t offset = stream_tell(stream) - furi_string_size(read_key);
+            if(!callback(read_key, offset, context)) {
+                result = false;
+                break;
+            }
+        }
+    }
+    furi_string_free(read_key);
+
+    return result;
+}
+
 static bool flipper_format_stream_read_value(Stream* stream, FuriString* value, bool* last) {
     enum { LeadingSpace, ReadValue, TrailingSpace } state = LeadingSpace;
     const size_t buffer_size = 32;
@@ -226,6 +255,19 @@ static bool flipper_format_stream_read_line(Stream* stream, FuriString* str_resu
     return furi_string_size(str_result) != 0;
 }
 
+bool flipper_format_stream_read_next(Stream* stream, FuriString* key, FuriString* value) {
+    while(!stream_eof(stream)) {
+        if(flipper_format_stream_read_valid_key(stream, key)) {
+            if(!stream_seek(stream, 2, StreamOffsetFromCurrent)) break;
+
+            flipper_format_stream_read_line(stream, value);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static bool flipper_format_stream_seek_to_next_line(Stream* stream) {
     const size_t buffer_size = 32;
     uint8_t buffer[buffer_size];
@@ -335,6 +377,175 @@ bool flipper_format_stream_write_value_line(Stream* stream, FlipperStreamWriteDa
     return result;
 }
 
+typedef struct {
+    uint8_t buffer[FLIPPER_FORMAT_READ_BUFFER_SIZE];
+    size_t size;
+    size_t position;
+} FlipperFormatStreamReader;
+
+static bool flipper_format_stream_reader_get(
+    Stream* stream,
+    FlipperFormatStreamReader* reader,
+    uint8_t* data) {
+    if(reader->position == reader->size) {
+        reader->size = stream_read(stream, reader->buffer, FLIPPER_FORMAT_READ_BUFFER_SIZE);
+        reader->position = 0;
+        if(reader->size == 0) return false;
+    }
+
+    *data = reader->buffer[reader->position++];
+    return true;
+}
+
+/**
+ * Read next value of the line to the token buffer, same rules as flipper_format_stream_read_value.
+ * Token is truncated to the buffer size, length is the full one.
+ */
+static bool flipper_format_stream_read_token(
+    Stream* stream,
+    FlipperFormatStreamReader* reader,
+    char* token,
+    size_t* length,
+    bool* last) {
+    enum { LeadingSpace, ReadValue, TrailingSpace } state = LeadingSpace;
+    uint8_t data;
+
+    *length = 0;
+
+    while(true) {
+        if(!flipper_format_stream_reader_get(stream, reader, &data)) {
+            if(state == LeadingSpace || !stream_eof(stream)) return false;
+            *last = true;
+            break;
+        }
+
+        if(state == LeadingSpace) {
+            if(flipper_format_stream_is_space(data)) {
+                continue;
+            } else if(data == flipper_format_eoln) {
+                reader->position--;
+                return false;
+            } else {
+                state = ReadValue;
+            }
+        }
+
+        if(state == ReadValue) {
+            if(flipper_format_stream_is_space(data)) {
+                state = TrailingSpace;
+            } else if(data == flipper_format_eoln) {
+                reader->position--;
+                *last = true;
+                break;
+            } else {
+                if(*length < FLIPPER_FORMAT_TOKEN_SIZE - 1) token[*length] = data;
+                (*length)++;
+            }
+        } else if(!flipper_format_stream_is_space(data)) {
+            reader->position--;
+            *last = (data == flipper_format_eoln);
+            break;
+        }
+    }
+
+    token[MIN(*length, FLIPPER_FORMAT_TOKEN_SIZE - 1)] = '\0';
+    return true;
+}
+
+static bool flipper_format_stream_parse_value(
+    FlipperStreamValue type,
+    void* _data,
+    size_t i,
+    const char* token,
+    size_t length) {
+    // numbers must fit the token buffer
+    const bool complete = length < FLIPPER_FORMAT_TOKEN_SIZE;
+    char* end_char = NULL;
+    bool result = false;
+
+    switch(type) {
+    case FlipperStreamValueHex: {
+        uint8_t* data = _data;
+        result = (length >= 2) && hex_char_to_uint8(token[0], token[1], &data[i]);
+    }; break;
+#ifndef FLIPPER_STREAM_LITE
+    case FlipperStreamValueFloat: {
+        float* data = _data;
+        // newlib-nano does not have sscanf for floats
+        data[i] = strtof(token, &end_char);
+        result = complete && (*end_char == 0);
+    }; break;
+#endif
+    case FlipperStreamValueInt32: {
+        int32_t* data = _data;
+        // base 0 matches the "%i" conversion used before
+        data[i] = (int32_t)strtol(token, &end_char, 0);
+        result = complete && (end_char != token);
+    }; break;
+    case FlipperStreamValueUint32: {
+        uint32_t* data = _data;
+        data[i] = (uint32_t)strtoul(token, &end_char, 10);
+        result = complete && (end_char != token);
+    }; break;
+    case FlipperStreamValueHexUint64: {
+        uint64_t* data = _data;
+        result = (length >= 16) && hex_chars_to_uint64(token, &data[i]);
+    }; break;
+    case FlipperStreamValueBool: {
+        bool* data = _data;
+        data[i] = !strcasecmp(token, "true");
+        result = true;
+    }; break;
+    default:
+        furi_crash("Unknown FF type");
+    }
+
+    return result;
+}
+
+bool flipper_format_stream_read_array(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size,
+    size_t* count) {
+    // values are parsed in place from a block read from the stream
+    FlipperFormatStreamReader reader = {.size = 0, .position = 0};
+    char token[FLIPPER_FORMAT_TOKEN_SIZE];
+    size_t length;
+    bool last = false;
+    bool result = true;
+
+    *count = 0;
+    while(*count < data_size && !last) {
+        if(!flipper_format_stream_read_token(stream, &reader, token, &length, &last)) break;
+        if(!flipper_format_stream_parse_value(type, data, *count, token, length)) {
+            result = false;
+            break;
+        }
+        (*count)++;
+    }
+
+    // give back data read past the values
+    if(reader.position != reader.size &&
+       !stream_seek(
+           stream, (int32_t)reader.position - (int32_t)reader.size, StreamOffsetFromCurrent)) {
+        result = false;
+    }
+
+    return result;
+}
+
+static bool flipper_format_stream_read_values(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size) {
+    size_t count;
+    return flipper_format_stream_read_array(stream, type, data, data_size, &count) &&
+           (count == data_size);
+}
+
 bool flipper_format_stream_read_value_line(
     Stream* stream,
     const char* key,
@@ -354,82 +565,7 @@ bool flipper_format_stream_read_value_line(
                 break;
             }
         } else {
-            result = true;
-            FuriString* value;
-            value = furi_string_alloc();
-
-            for(size_t i = 0; i < data_size; i++) {
-                bool last = false;
-                result = flipper_format_stream_read_value(stream, value, &last);
-                if(result) {
-                    int scan_values = 0;
-
-                    switch(type) {
-                    case FlipperStreamValueHex: {
-                        uint8_t* data = _data;
-                        if(furi_string_size(value) >= 2) {
-                            // sscanf "%02X" does not work here
-                            if(hex_char_to_uint8(
-                                   furi_string_get_char(value, 0),
-                                   furi_string_get_char(value, 1),
-                                   &data[i])) {
-                                scan_values = 1;
-                            }
-                        }
-                    }; break;
-#ifndef FLIPPER_STREAM_LITE
-                    case FlipperStreamValueFloat: {
-                        float* data = _data;
-                        // newlib-nano does not have sscanf for floats
-                        // scan_values = sscanf(furi_string_get_cstr(value), "%f", &data[i]);
-                        char* end_char;
-                        data[i] = strtof(furi_string_get_cstr(value), &end_char);
-                        if(*end_char == 0) {
-                            // most likely ok
-                            scan_values = 1;
-                        }
-                    }; break;
-#endif
-                    case FlipperStreamValueInt32: {
-                        int32_t* data = _data;
-                        scan_values = sscanf(furi_string_get_cstr(value), "%" PRIi32, &data[i]);
-                    }; break;
-                    case FlipperStreamValueUint32: {
-                        uint32_t* data = _data;
-                        scan_values = sscanf(furi_string_get_cstr(value), "%" PRIu32, &data[i]);
-                    }; break;
-                    case FlipperStreamValueHexUint64: {
-                        uint64_t* data = _data;
-                        if(furi_string_size(value) >= 16) {
-                            if(hex_chars_to_uint64(furi_string_get_cstr(value), &data[i])) {
-                                scan_values = 1;
-                            }
-                        }
-                    }; break;
-                    case FlipperStreamValueBool: {
-                        bool* data = _data;
-                        data[i] = !furi_string_cmpi(value, "true");
-                        scan_values = 1;
-                    }; break;
-                    default:
-                        furi_crash("Unknown FF type");
-                    }
-
-                    if(scan_values != 1) {
-                        result = false;
-                        break;
-                    }
-                } else {
-                    break;
-                }
-
-                if(last && ((i + 1) != data_size)) {
-                    result = false;
-                    break;
-                }
-            }
-
-            furi_string_free(value);
+            result = flipper_format_stream_read_values(stream, type, _data, data_size);
         }
     } while(false);
 
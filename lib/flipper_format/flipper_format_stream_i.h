@@ -29,6 +29,49 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+typedef bool (
+    *FlipperFormatStreamKeyCallback)(const FuriString* key, size_t offset, void* context);
+
+/**
+ * Read all keys from the current position of the stream to the end.
+ * Keys are the ones flipper_format_stream_seek_to_key() would find, in the same order.
+ * @param stream 
+ * @param callback called with every key and its offset, stops reading if returns false
+ * @param context 
+ * @return true all keys are read
+ * @return false callback stopped reading or stream error
+ */
+bool flipper_format_stream_read_keys(
+    Stream* stream,
+    FlipperFormatStreamKeyCallback callback,
+    void* context);
+
+/**
+ * Read values of the line from the current position, up to the end of line.
+ * RW pointer is left right after the last value read.
+ * @param stream 
+ * @param type value type, other than string
+ * @param data values
+ * @param data_size maximum number of values to read
+ * @param count number of values read, less than data_size at the end of line
+ * @return false if a value can't be parsed
+ */
+bool flipper_format_stream_read_array(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* data,
+    size_t data_size,
+    size_t* count);
+
+/**
+ * Read next key and its value line from the current position.
+ * @param stream 
+ * @param key key of the line
+ * @param value value line, as flipper_format_stream_read_value_line() reads a string
+ * @return true if key is read, false at the end of stream
+ */
+bool flipper_format_stream_read_next(Stream* stream, FuriString* key, FuriString* value);
+
 #ifdef __cplusplus
 }
 #endif
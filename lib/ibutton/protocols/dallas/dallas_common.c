@@ -28,6 +28,19 @@ bool dallas_common_skip_rom(OneWireHost* host) {
     return true;
 }
 
+bool dallas_common_overdrive_skip_rom(OneWireHost* host) {
+    onewire_host_write(host, DALLAS_COMMON_CMD_OVERDRIVE_SKIP_ROM);
+    onewire_host_set_overdrive(host, true);
+
+    // Devices without overdrive stay at standard speed and don't answer a short reset
+    if(onewire_host_reset(host)) {
+        return dallas_common_skip_rom(host);
+    }
+
+    onewire_host_set_overdrive(host, false);
+    return onewire_host_reset(host) && dallas_common_skip_rom(host);
+}
+
 bool dallas_common_read_rom(OneWireHost* host, DallasCommonRomData* rom_data) {
     onewire_host_write(host, DALLAS_COMMON_CMD_READ_ROM);
     onewire_host_read_bytes(host, rom_data->bytes, sizeof(DallasCommonRomData));
@@ -140,43 +153,41 @@ bool dallas_common_write_mem(
     return i == data_size;
 }
 
-bool dallas_common_emulate_search_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data) {
-    for(size_t i = 0; i < sizeof(DallasCommonRomData); i++) {
-        for(size_t j = 0; j < BITS_IN_BYTE; j++) {
-            bool bit = (rom_data->bytes[i] >> j) & 0x01;
-
-            if(!onewire_slave_send_bit(bus, bit)) return false;
-            if(!onewire_slave_send_bit(bus, !bit)) return false;
-
-            onewire_slave_receive_bit(bus);
-            // TODO FL-3530: check for errors and return if any
-        }
-    }
-
-    return true;
+void dallas_common_emulate_search_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data) {
+    onewire_slave_search(bus, rom_data->bytes, sizeof(DallasCommonRomData));
 }
 
-bool dallas_common_emulate_read_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data) {
-    return onewire_slave_send(bus, rom_data->bytes, sizeof(DallasCommonRomData));
+void dallas_common_emulate_read_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data) {
+    onewire_slave_send(bus, rom_data->bytes, sizeof(DallasCommonRomData));
 }
 
-bool dallas_common_emulate_read_mem(OneWireSlave* bus, const uint8_t* data, size_t data_size) {
-    bool success = false;
+static bool dallas_common_emulate_read_mem_callback(void* context) {
+    DallasCommonEmulateMemory* memory = context;
+    const uint16_t address = memory->address[0] | (memory->address[1] << 8);
 
-    union {
-        uint8_t bytes[sizeof(uint16_t)];
-        uint16_t word;
-    } address;
-
-    do {
-        if(!onewire_slave_receive(bus, address.bytes, sizeof(address))) break;
-        if(address.word >= data_size) break;
-        if(!onewire_slave_send(bus, data + address.word, data_size - address.word)) break;
+    if(address < memory->data_size) {
+        onewire_slave_send(memory->bus, memory->data + address, memory->data_size - address);
+    }
 
-        success = true;
-    } while(false);
+    // Memory is read until the next reset
+    return false;
+}
 
-    return success;
+void dallas_common_emulate_read_mem(
+    DallasCommonEmulateMemory* memory,
+    OneWireSlave* bus,
+    const uint8_t* data,
+    size_t data_size) {
+    memory->bus = bus;
+    memory->data = data;
+    memory->data_size = data_size;
+
+    onewire_slave_receive(
+        bus,
+        memory->address,
+        sizeof(memory->address),
+        dallas_common_emulate_read_mem_callback,
+        memory);
 }
 
 bool dallas_common_save_rom_data(FlipperFormat* ff, const DallasCommonRomData* rom_data) {
@@ -22,6 +22,13 @@
 #define DALLAS_COMMON_CMD_OVERDRIVE_SKIP_ROM 0x3CU
 #define DALLAS_COMMON_CMD_OVERDRIVE_MATCH_ROM 0x69U
 
+typedef struct {
+    OneWireSlave* bus;
+    const uint8_t* data;
+    size_t data_size;
+    uint8_t address[sizeof(uint16_t)];
+} DallasCommonEmulateMemory;
+
 typedef enum {
     DallasCommonCommandStateIdle,
     DallasCommonCommandStateRomCmd,
@@ -49,6 +56,10 @@ typedef union {
 /* Standard(ish) iButton commands */
 bool dallas_common_skip_rom(OneWireHost* host);
 
+/* Selects the device at overdrive speed if it supports one, at standard speed otherwise.
+ * Host is left at the chosen speed, set it back to standard when done. */
+bool dallas_common_overdrive_skip_rom(OneWireHost* host);
+
 bool dallas_common_read_rom(OneWireHost* host, DallasCommonRomData* rom_data);
 
 bool dallas_common_write_scratchpad(
@@ -79,11 +90,16 @@ bool dallas_common_write_mem(
     size_t data_size);
 
 /* Emulation */
-bool dallas_common_emulate_search_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data);
+void dallas_common_emulate_search_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data);
 
-bool dallas_common_emulate_read_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data);
+void dallas_common_emulate_read_rom(OneWireSlave* bus, const DallasCommonRomData* rom_data);
 
-bool dallas_common_emulate_read_mem(OneWireSlave* bus, const uint8_t* data, size_t data_size);
+/* Memory state is used after the command callback returns, so it can't be on its stack */
+void dallas_common_emulate_read_mem(
+    DallasCommonEmulateMemory* memory,
+    OneWireSlave* bus,
+    const uint8_t* data,
+    size_t data_size);
 
 /* Save & Load */
 bool dallas_common_save_rom_data(FlipperFormat* ff, const DallasCommonRomData* rom_data);
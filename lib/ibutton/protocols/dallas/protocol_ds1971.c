@@ -22,6 +22,7 @@
 typedef struct {
     OneWireSlave* bus;
     DallasCommonCommandState command_state;
+    DallasCommonEmulateMemory memory;
 } DS1971ProtocolState;
 
 typedef struct {
@@ -43,7 +44,11 @@ static void dallas_ds1971_get_editable_data(iButtonEditableData*, iButtonProtoco
 static void dallas_ds1971_apply_edits(iButtonProtocolData*);
 static bool
     dallas_ds1971_read_mem(OneWireHost* host, uint8_t address, uint8_t* data, size_t data_size);
-static bool ds1971_emulate_read_mem(OneWireSlave* bus, const uint8_t* data, size_t data_size);
+static void ds1971_emulate_read_mem(
+    DallasCommonEmulateMemory* memory,
+    OneWireSlave* bus,
+    const uint8_t* data,
+    size_t data_size);
 
 const iButtonProtocolDallasBase ibutton_protocol_ds1971 = {
     .family_code = DS1971_FAMILY_CODE,
@@ -135,11 +140,13 @@ static bool dallas_ds1971_command_callback(uint8_t command, void* context) {
     case DALLAS_COMMON_CMD_SEARCH_ROM:
         if(data->state.command_state == DallasCommonCommandStateIdle) {
             data->state.command_state = DallasCommonCommandStateRomCmd;
-            return dallas_common_emulate_search_rom(bus, &data->rom_data);
+            dallas_common_emulate_search_rom(bus, &data->rom_data);
+            return true;
 
         } else if(data->state.command_state == DallasCommonCommandStateRomCmd) {
             data->state.command_state = DallasCommonCommandStateMemCmd;
-            ds1971_emulate_read_mem(bus, data->eeprom_data, DS1971_EEPROM_DATA_SIZE);
+            ds1971_emulate_read_mem(
+                &data->state.memory, bus, data->eeprom_data, DS1971_EEPROM_DATA_SIZE);
             return false;
 
         } else {
@@ -149,7 +156,8 @@ static bool dallas_ds1971_command_callback(uint8_t command, void* context) {
     case DALLAS_COMMON_CMD_READ_ROM:
         if(data->state.command_state == DallasCommonCommandStateIdle) {
             data->state.command_state = DallasCommonCommandStateRomCmd;
-            return dallas_common_emulate_read_rom(bus, &data->rom_data);
+            dallas_common_emulate_read_rom(bus, &data->rom_data);
+            return true;
         } else {
             return false;
         }
@@ -260,17 +268,26 @@ bool dallas_ds1971_read_mem(OneWireHost* host, uint8_t address, uint8_t* data, s
     return true;
 }
 
-bool ds1971_emulate_read_mem(OneWireSlave* bus, const uint8_t* data, size_t data_size) {
-    bool success = false;
+static bool ds1971_emulate_read_mem_callback(void* context) {
+    DallasCommonEmulateMemory* memory = context;
+    const uint8_t address = memory->address[0];
 
-    do {
-        uint8_t address;
-        if(!onewire_slave_receive(bus, &address, sizeof(address))) break;
-        if(address >= data_size) break;
-        if(!onewire_slave_send(bus, data + address, data_size - address)) break;
+    if(address < memory->data_size) {
+        onewire_slave_send(memory->bus, memory->data + address, memory->data_size - address);
+    }
 
-        success = true;
-    } while(false);
+    return false;
+}
 
-    return success;
+void ds1971_emulate_read_mem(
+    DallasCommonEmulateMemory* memory,
+    OneWireSlave* bus,
+    const uint8_t* data,
+    size_t data_size) {
+    memory->bus = bus;
+    memory->data = data;
+    memory->data_size = data_size;
+
+    // Single byte address
+    onewire_slave_receive(bus, memory->address, 1, ds1971_emulate_read_mem_callback, memory);
 }
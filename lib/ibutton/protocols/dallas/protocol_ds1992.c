@@ -22,6 +22,7 @@
 typedef struct {
     OneWireSlave* bus;
     DallasCommonCommandState command_state;
+    DallasCommonEmulateMemory memory;
 } DS1992ProtocolState;
 
 typedef struct {
@@ -67,8 +68,13 @@ const iButtonProtocolDallasBase ibutton_protocol_ds1992 = {
 
 bool dallas_ds1992_read(OneWireHost* host, iButtonProtocolData* protocol_data) {
     DS1992ProtocolData* data = protocol_data;
-    return onewire_host_reset(host) && dallas_common_read_rom(host, &data->rom_data) &&
-           dallas_common_read_mem(host, 0, data->sram_data, DS1992_SRAM_DATA_SIZE);
+    const bool success =
+        onewire_host_reset(host) && dallas_common_read_rom(host, &data->rom_data) &&
+        onewire_host_reset(host) && dallas_common_overdrive_skip_rom(host) &&
+        dallas_common_read_mem(host, 0, data->sram_data, DS1992_SRAM_DATA_SIZE);
+
+    onewire_host_set_overdrive(host, false);
+    return success;
 }
 
 bool dallas_ds1992_write_blank(OneWireHost* host, iButtonProtocolData* protocol_data) {
@@ -108,11 +114,13 @@ static bool dallas_ds1992_command_callback(uint8_t command, void* context) {
     case DALLAS_COMMON_CMD_SEARCH_ROM:
         if(data->state.command_state == DallasCommonCommandStateIdle) {
             data->state.command_state = DallasCommonCommandStateRomCmd;
-            return dallas_common_emulate_search_rom(bus, &data->rom_data);
+            dallas_common_emulate_search_rom(bus, &data->rom_data);
+            return true;
 
         } else if(data->state.command_state == DallasCommonCommandStateRomCmd) {
             data->state.command_state = DallasCommonCommandStateMemCmd;
-            dallas_common_emulate_read_mem(bus, data->sram_data, DS1992_SRAM_DATA_SIZE);
+            dallas_common_emulate_read_mem(
+                &data->state.memory, bus, data->sram_data, DS1992_SRAM_DATA_SIZE);
             return false;
 
         } else {
@@ -122,7 +130,8 @@ static bool dallas_ds1992_command_callback(uint8_t command, void* context) {
     case DALLAS_COMMON_CMD_READ_ROM:
         if(data->state.command_state == DallasCommonCommandStateIdle) {
             data->state.command_state = DallasCommonCommandStateRomCmd;
-            return dallas_common_emulate_read_rom(bus, &data->rom_data);
+            dallas_common_emulate_read_rom(bus, &data->rom_data);
+            return true;
         } else {
             return false;
         }
@@ -20,6 +20,7 @@
 typedef struct {
     OneWireSlave* bus;
     DallasCommonCommandState command_state;
+    DallasCommonEmulateMemory memory;
 } DS1996ProtocolState;
 
 typedef struct {
@@ -69,9 +70,7 @@ bool dallas_ds1996_read(OneWireHost* host, iButtonProtocolData* protocol_data) {
         if(!onewire_host_reset(host)) break;
         if(!dallas_common_read_rom(host, &data->rom_data)) break;
         if(!onewire_host_reset(host)) break;
-
-        onewire_host_write(host, DALLAS_COMMON_CMD_OVERDRIVE_SKIP_ROM);
-        onewire_host_set_overdrive(host, true);
+        if(!dallas_common_overdrive_skip_rom(host)) break;
 
         if(!dallas_common_read_mem(host, 0, data->sram_data, DS1996_SRAM_DATA_SIZE)) break;
         success = true;
@@ -87,9 +86,7 @@ bool dallas_ds1996_write_copy(OneWireHost* host, iButtonProtocolData* protocol_d
 
     do {
         if(!onewire_host_reset(host)) break;
-
-        onewire_host_write(host, DALLAS_COMMON_CMD_OVERDRIVE_SKIP_ROM);
-        onewire_host_set_overdrive(host, true);
+        if(!dallas_common_overdrive_skip_rom(host)) break;
 
         if(!dallas_common_write_mem(
                host,
@@ -122,11 +119,14 @@ static bool dallas_ds1996_command_callback(uint8_t command, void* context) {
     case DALLAS_COMMON_CMD_SEARCH_ROM:
         if(data->state.command_state == DallasCommonCommandStateIdle) {
             data->state.command_state = DallasCommonCommandStateRomCmd;
-            return dallas_common_emulate_search_rom(bus, &data->rom_data);
+            dallas_common_emulate_search_rom(bus, &data->rom_data);
+            return true;
 
         } else if(data->state.command_state == DallasCommonCommandStateRomCmd) {
             data->state.command_state = DallasCommonCommandStateMemCmd;
-            return dallas_common_emulate_read_mem(bus, data->sram_data, DS1996_SRAM_DATA_SIZE);
+            dallas_common_emulate_read_mem(
+                &data->state.memory, bus, data->sram_data, DS1996_SRAM_DATA_SIZE);
+            return false;
 
         } else {
             return false;
@@ -135,7 +135,8 @@ static bool dallas_ds1996_command_callback(uint8_t command, void* context) {
     case DALLAS_COMMON_CMD_READ_ROM:
         if(data->state.command_state == DallasCommonCommandStateIdle) {
             data->state.command_state = DallasCommonCommandStateRomCmd;
-            return dallas_common_emulate_read_rom(bus, &data->rom_data);
+            dallas_common_emulate_read_rom(bus, &data->rom_data);
+            return true;
         } else {
             return false;
         }
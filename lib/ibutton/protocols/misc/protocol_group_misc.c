@@ -116,6 +116,7 @@ static bool ibutton_protocol_group_misc_read(
         }
 
         if(ret > 0) {
+            // Every edge goes to Cyfral and Metakom decoders at once, first complete one wins
             ProtocolId decoded_index = protocol_dict_decoders_feed(
                 group->dict, level_duration_get_level(level), level_duration_get_duration(level));
 
@@ -130,6 +131,7 @@ static bool ibutton_protocol_group_misc_read(
                 protocol_dict_get_data_size(group->dict, decoded_index));
 
             result = true;
+            break;
         }
     }
 
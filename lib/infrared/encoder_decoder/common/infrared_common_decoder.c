@@ -229,6 +229,17 @@ InfraredMessage*
     }
     decoder->level = level; // start with low level (Space timing)
 
+    /* Idle decoder only waits for its preamble mark, anything else would be dropped by
+     * infrared_check_preamble() anyway. Most edges are rejected here by all but one spec. */
+    if((decoder->state == InfraredCommonDecoderStateWaitPreamble) &&
+       (decoder->timings_cnt == 0) && decoder->protocol->timings.preamble_mark) {
+        const InfraredTimings* timings = &decoder->protocol->timings;
+        if(!level ||
+           !MATCH_TIMING(duration, timings->preamble_mark, timings->preamble_tolerance)) {
+            return NULL;
+        }
+    }
+
     decoder->timings[decoder->timings_cnt] = duration;
     decoder->timings_cnt++;
     furi_check(decoder->timings_cnt <= sizeof(decoder->timings));
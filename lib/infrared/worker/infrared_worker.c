@@ -9,6 +9,10 @@
 #include <notification/notification_messages.h>
 
 #define INFRARED_WORKER_RX_TIMEOUT INFRARED_RAW_RX_TIMING_DELAY_US
+/* Captured edges are drained from HAL DMA buffer in batches of this size */
+#define INFRARED_WORKER_RX_BATCH_SIZE 64
+/* Drain period while signal is being received, so decoded messages are not delayed */
+#define INFRARED_WORKER_RX_POLL_PERIOD_MS 10
 
 #define INFRARED_WORKER_RX_RECEIVED 0x01
 #define INFRARED_WORKER_RX_TIMEOUT_RECEIVED 0x02
@@ -33,6 +37,7 @@ typedef enum {
     InfraredWorkerStateWaitTxEnd,
     InfraredWorkerStateStopTx,
     InfraredWorkerStateStartTx,
+    InfraredWorkerStateWaitPrerenderedTxEnd,
 } InfraredWorkerState;
 
 struct InfraredWorkerSignal {
@@ -60,6 +65,7 @@ struct InfraredWorker {
     NotificationApp* notification;
     bool blink_enable;
     bool decode_enable;
+    bool prerender_enable;
 
     union {
         struct {
@@ -72,11 +78,17 @@ struct InfraredWorker {
             uint32_t tx_raw_cnt;
             bool need_reinitialization;
             bool steady_signal_sent;
+            bool prerender; /* Cleared if signal is too long to pre-render */
+            size_t prerender_messages;
+            size_t prerendered_messages;
         } tx;
         struct {
             InfraredWorkerReceivedSignalCallback received_signal_callback;
             void* received_signal_context;
             bool overrun;
+            bool receiving;
+            /* Set before worker thread exits, HAL may still call back until RX is stopped */
+            volatile bool stopping;
         } rx;
     };
 };
@@ -99,19 +111,13 @@ static void infrared_worker_rx_timeout_callback(void* context) {
     furi_check(flags_set & INFRARED_WORKER_RX_TIMEOUT_RECEIVED);
 }
 
-static void infrared_worker_rx_callback(void* context, bool level, uint32_t duration) {
+static void infrared_worker_rx_dma_callback(void* context) {
     InfraredWorker* instance = context;
+    if(instance->rx.stopping) return;
 
-    furi_assert(duration != 0);
-    LevelDuration level_duration = level_duration_make(level, duration);
-
-    size_t ret =
-        furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
-    uint32_t events = (ret == sizeof(LevelDuration)) ? INFRARED_WORKER_RX_RECEIVED :
-                                                       INFRARED_WORKER_OVERRUN;
-
-    uint32_t flags_set = furi_thread_flags_set(furi_thread_get_id(instance->thread), events);
-    furi_check(flags_set & events);
+    uint32_t flags_set = furi_thread_flags_set(
+        furi_thread_get_id(instance->thread), INFRARED_WORKER_RX_RECEIVED);
+    furi_check(flags_set & INFRARED_WORKER_RX_RECEIVED);
 }
 
 static void infrared_worker_process_timeout(InfraredWorker* instance) {
@@ -161,14 +167,41 @@ static void
     }
 }
 
+static void infrared_worker_rx_drain(InfraredWorker* instance) {
+    uint32_t durations[INFRARED_WORKER_RX_BATCH_SIZE];
+    bool overrun;
+
+    for(;;) {
+        size_t count = furi_hal_infrared_async_rx_dma_read(
+            durations, INFRARED_WORKER_RX_BATCH_SIZE, &overrun);
+        if(overrun) {
+            furi_thread_flags_set(furi_thread_get_id(instance->thread), INFRARED_WORKER_OVERRUN);
+            continue;
+        } else if(count == 0) {
+            break;
+        }
+
+        /* Levels alternate starting from space */
+        for(size_t i = 0; (i < count) && !instance->rx.overrun; ++i) {
+            infrared_worker_process_timings(instance, durations[i], i % 2);
+        }
+    }
+}
+
 static int32_t infrared_worker_rx_thread(void* thread_context) {
     InfraredWorker* instance = thread_context;
     uint32_t events = 0;
-    LevelDuration level_duration;
     uint32_t last_blink_time = 0;
 
     while(1) {
-        events = furi_thread_flags_wait(INFRARED_WORKER_ALL_RX_EVENTS, 0, FuriWaitForever);
+        events = furi_thread_flags_wait(
+            INFRARED_WORKER_ALL_RX_EVENTS,
+            0,
+            instance->rx.receiving ? INFRARED_WORKER_RX_POLL_PERIOD_MS : FuriWaitForever);
+        if(events == (uint32_t)FuriFlagErrorTimeout) {
+            /* Periodic drain of a signal in progress */
+            events = INFRARED_WORKER_RX_RECEIVED;
+        }
         furi_check(events & INFRARED_WORKER_ALL_RX_EVENTS); /* at least one caught */
 
         if(events & INFRARED_WORKER_RX_RECEIVED) {
@@ -177,17 +210,10 @@ static int32_t infrared_worker_rx_thread(void* thread_context) {
                 last_blink_time = furi_get_tick();
                 notification_message(instance->notification, &sequence_blink_blue_10);
             }
-            if(instance->signal.timings_cnt == 0)
+            if(!instance->rx.receiving)
                 notification_message(instance->notification, &sequence_display_backlight_on);
-            while(sizeof(LevelDuration) ==
-                  furi_stream_buffer_receive(
-                      instance->stream, &level_duration, sizeof(LevelDuration), 0)) {
-                if(!instance->rx.overrun) {
-                    bool level = level_duration_get_level(level_duration);
-                    uint32_t duration = level_duration_get_duration(level_duration);
-                    infrared_worker_process_timings(instance, duration, level);
-                }
-            }
+            instance->rx.receiving = true;
+            infrared_worker_rx_drain(instance);
         }
         if(events & INFRARED_WORKER_OVERRUN) {
             printf("#");
@@ -197,6 +223,9 @@ static int32_t infrared_worker_rx_thread(void* thread_context) {
                 notification_message(instance->notification, &sequence_set_red_255);
         }
         if(events & INFRARED_WORKER_RX_TIMEOUT_RECEIVED) {
+            /* Last edges of the signal may still be in HAL buffer */
+            infrared_worker_rx_drain(instance);
+            instance->rx.receiving = false;
             if(instance->rx.overrun) {
                 printf("\nOVERRUN, max samples: %d\n", MAX_TIMINGS_AMOUNT);
                 instance->rx.overrun = false;
@@ -235,6 +264,7 @@ InfraredWorker* infrared_worker_alloc() {
     instance->infrared_encoder = infrared_alloc_encoder();
     instance->blink_enable = false;
     instance->decode_enable = true;
+    instance->prerender_enable = false;
     instance->notification = furi_record_open(RECORD_NOTIFICATION);
     instance->state = InfraredWorkerStateIdle;
 
@@ -258,18 +288,18 @@ void infrared_worker_rx_start(InfraredWorker* instance) {
     furi_assert(instance);
     furi_assert(instance->state == InfraredWorkerStateIdle);
 
-    furi_stream_set_trigger_level(instance->stream, sizeof(LevelDuration));
+    instance->rx.overrun = false;
+    instance->rx.receiving = false;
+    instance->rx.stopping = false;
 
     furi_thread_set_callback(instance->thread, infrared_worker_rx_thread);
     furi_thread_start(instance->thread);
 
-    furi_hal_infrared_async_rx_set_capture_isr_callback(infrared_worker_rx_callback, instance);
     furi_hal_infrared_async_rx_set_timeout_isr_callback(
         infrared_worker_rx_timeout_callback, instance);
-    furi_hal_infrared_async_rx_start();
+    furi_hal_infrared_async_rx_dma_start(infrared_worker_rx_dma_callback, instance);
     furi_hal_infrared_async_rx_set_timeout(INFRARED_WORKER_RX_TIMEOUT);
 
-    instance->rx.overrun = false;
     instance->state = InfraredWorkerStateRunRx;
 }
 
@@ -277,16 +307,13 @@ void infrared_worker_rx_stop(InfraredWorker* instance) {
     furi_assert(instance);
     furi_assert(instance->state == InfraredWorkerStateRunRx);
 
+    /* Worker drains HAL buffer, so it must be gone before RX is stopped */
     furi_hal_infrared_async_rx_set_timeout_isr_callback(NULL, NULL);
-    furi_hal_infrared_async_rx_set_capture_isr_callback(NULL, NULL);
-    furi_hal_infrared_async_rx_stop();
-
+    instance->rx.stopping = true;
     furi_thread_flags_set(furi_thread_get_id(instance->thread), INFRARED_WORKER_EXIT);
     furi_thread_join(instance->thread);
 
-    FuriStatus status = furi_stream_buffer_reset(instance->stream);
-    furi_assert(status == FuriStatusOk);
-    (void)status;
+    furi_hal_infrared_async_rx_stop();
 
     instance->state = InfraredWorkerStateIdle;
 }
@@ -323,6 +350,11 @@ void infrared_worker_rx_enable_signal_decoding(InfraredWorker* instance, bool en
     instance->decode_enable = enable;
 }
 
+void infrared_worker_tx_enable_prerender(InfraredWorker* instance, bool enable) {
+    furi_assert(instance);
+    instance->prerender_enable = enable;
+}
+
 void infrared_worker_tx_start(InfraredWorker* instance) {
     furi_assert(instance);
     furi_assert(instance->state == InfraredWorkerStateIdle);
@@ -335,6 +367,7 @@ void infrared_worker_tx_start(InfraredWorker* instance) {
 
     instance->tx.steady_signal_sent = false;
     instance->tx.need_reinitialization = false;
+    instance->tx.prerender = instance->prerender_enable;
     furi_hal_infrared_async_tx_set_data_isr_callback(
         infrared_worker_furi_hal_data_isr_callback, instance);
     furi_hal_infrared_async_tx_set_signal_sent_isr_callback(
@@ -421,6 +454,28 @@ static bool infrared_get_new_signal(InfraredWorker* instance) {
     return new_signal_obtained;
 }
 
+static InfraredStatus
+    infrared_worker_tx_encode(InfraredWorker* instance, uint32_t* duration, bool* level) {
+    InfraredStatus status;
+
+    if(instance->signal.decoded) {
+        status = infrared_encode(instance->infrared_encoder, duration, level);
+    } else {
+        *duration = instance->signal.raw.timings[instance->tx.tx_raw_cnt];
+        /* raw always starts from Mark, but we fill it with space delay at start */
+        *level = (instance->tx.tx_raw_cnt % 2);
+        ++instance->tx.tx_raw_cnt;
+        if(instance->tx.tx_raw_cnt >= instance->signal.timings_cnt) {
+            instance->tx.tx_raw_cnt = 0;
+            status = InfraredStatusDone;
+        } else {
+            status = InfraredStatusOk;
+        }
+    }
+
+    return status;
+}
+
 static bool infrared_worker_tx_fill_buffer(InfraredWorker* instance) {
     bool new_data_available = true;
     InfraredWorkerTiming timing;
@@ -428,20 +483,7 @@ static bool infrared_worker_tx_fill_buffer(InfraredWorker* instance) {
 
     while(!furi_stream_buffer_is_full(instance->stream) && !instance->tx.need_reinitialization &&
           new_data_available) {
-        if(instance->signal.decoded) {
-            status = infrared_encode(instance->infrared_encoder, &timing.duration, &timing.level);
-        } else {
-            timing.duration = instance->signal.raw.timings[instance->tx.tx_raw_cnt];
-            /* raw always starts from Mark, but we fill it with space delay at start */
-            timing.level = (instance->tx.tx_raw_cnt % 2);
-            ++instance->tx.tx_raw_cnt;
-            if(instance->tx.tx_raw_cnt >= instance->signal.timings_cnt) {
-                instance->tx.tx_raw_cnt = 0;
-                status = InfraredStatusDone;
-            } else {
-                status = InfraredStatusOk;
-            }
-        }
+        status = infrared_worker_tx_encode(instance, &timing.duration, &timing.level);
 
         if(status == InfraredStatusError) {
             new_data_available = false;
@@ -467,6 +509,57 @@ static bool infrared_worker_tx_fill_buffer(InfraredWorker* instance) {
     return new_data_available;
 }
 
+/* Called from worker thread while HAL pre-renders the signal */
+static FuriHalInfraredTxGetDataState
+    infrared_worker_prerender_data_callback(void* context, uint32_t* duration, bool* level) {
+    furi_assert(context);
+    furi_assert(duration);
+    furi_assert(level);
+
+    InfraredWorker* instance = context;
+    FuriHalInfraredTxGetDataState state = FuriHalInfraredTxGetDataStateOk;
+    InfraredStatus status = infrared_worker_tx_encode(instance, duration, level);
+
+    if(status == InfraredStatusDone) {
+        ++instance->tx.prerendered_messages;
+        state = (instance->tx.prerendered_messages < instance->tx.prerender_messages) ?
+                    FuriHalInfraredTxGetDataStateDone :
+                    FuriHalInfraredTxGetDataStateLastDone;
+    } else if(status != InfraredStatusOk) {
+        furi_crash();
+    }
+
+    return state;
+}
+
+/* Signal that is too long to pre-render is rewound to be sent as usual */
+static bool infrared_worker_tx_start_prerendered(InfraredWorker* instance) {
+    instance->tx.prerender_messages =
+        instance->signal.decoded ?
+            infrared_get_protocol_min_repeat_count(instance->signal.message.protocol) :
+            1;
+    instance->tx.prerender_messages = MAX(instance->tx.prerender_messages, 1U);
+    instance->tx.prerendered_messages = 0;
+
+    furi_hal_infrared_async_tx_set_data_isr_callback(
+        infrared_worker_prerender_data_callback, instance);
+    bool started = furi_hal_infrared_async_tx_start_prerendered(
+        instance->tx.frequency, instance->tx.duty_cycle);
+
+    if(!started) {
+        instance->tx.prerender = false;
+        if(instance->signal.decoded) {
+            infrared_reset_encoder(instance->infrared_encoder, &instance->signal.message);
+        } else {
+            instance->tx.tx_raw_cnt = 0;
+        }
+        furi_hal_infrared_async_tx_set_data_isr_callback(
+            infrared_worker_furi_hal_data_isr_callback, instance);
+    }
+
+    return started;
+}
+
 static int32_t infrared_worker_tx_thread(void* thread_context) {
     InfraredWorker* instance = thread_context;
     furi_assert(instance->state == InfraredWorkerStateStartTx);
@@ -486,6 +579,11 @@ static int32_t infrared_worker_tx_thread(void* thread_context) {
     while(running) {
         switch(instance->state) {
         case InfraredWorkerStateStartTx:
+            if(instance->tx.prerender && infrared_worker_tx_start_prerendered(instance)) {
+                instance->state = InfraredWorkerStateWaitPrerenderedTxEnd;
+                break;
+            }
+
             --repeats_left; /* The first message does not result in TX_MESSAGE_SENT event for some reason */
             instance->tx.need_reinitialization = false;
             const bool new_data_available = infrared_worker_tx_fill_buffer(instance);
@@ -514,6 +612,25 @@ static int32_t infrared_worker_tx_thread(void* thread_context) {
                 break;
             }
 
+            break;
+        case InfraredWorkerStateWaitPrerenderedTxEnd:
+            furi_hal_infrared_async_tx_wait_termination();
+            furi_thread_flags_clear(INFRARED_WORKER_TX_MESSAGE_SENT);
+
+            if(instance->tx.message_sent_callback) {
+                for(size_t i = 0; i < instance->tx.prerendered_messages; i++) {
+                    instance->tx.message_sent_callback(instance->tx.message_sent_context);
+                }
+            }
+
+            /* Pre-rendered part covers minimal amount of repeats, exit right away */
+            events = furi_thread_flags_get();
+            if((events & INFRARED_WORKER_EXIT) || !infrared_get_new_signal(instance)) {
+                running = false;
+            } else {
+                instance->state = InfraredWorkerStateStartTx;
+            }
+
             break;
         case InfraredWorkerStateRunTx:
             events = furi_thread_flags_wait(
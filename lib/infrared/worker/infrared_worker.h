@@ -127,6 +127,21 @@ void infrared_worker_tx_set_signal_sent_callback(
     InfraredWorkerMessageSentCallback callback,
     void* context);
 
+/** Enable pre-rendering of transmitted signal.
+ *
+ * Signal with its minimal amount of repeats is converted to timer periods
+ * before transmission starts, so timings don't depend on worker thread
+ * latency. While signal keeps being requested, next repeats are pre-rendered
+ * and sent the same way. Message sent callback is called after each
+ * pre-rendered part, once per message in it. Signals too long to pre-render
+ * are sent as usual.
+ *
+ * @param[in]   instance - InfraredWorker instance
+ * @param[in]   enable - true if you want to enable pre-rendering
+ *                       false otherwise
+ */
+void infrared_worker_tx_enable_prerender(InfraredWorker* instance, bool enable);
+
 /** Callback to pass to infrared_worker_tx_set_get_signal_callback() if signal
  * is steady and will not be changed between infrared_worker start and stop.
  * Before starting transmission, desired steady signal must be set with
@@ -9,8 +9,11 @@
 #define EMULATE_BUFFER_SIZE 1024
 #define RFID_DATA_BUFFER_SIZE 2048
 #define READ_DATA_BUFFER_COUNT 4
+// Capture buffers are merged into blocks of this size before hitting the SD
+#define READ_WRITE_BLOCK_SIZE 4096
 
 #define TAG_EMULATE "RawEmulate"
+#define TAG_READ "RawRead"
 
 // emulate mode
 typedef struct {
@@ -37,6 +40,28 @@ typedef struct {
     VarintPair* pair;
 } LFRFIDRawWorkerReadData;
 
+typedef enum {
+    LFRFIDRawWriterFlagWrite = (1 << 0),
+    LFRFIDRawWriterFlagStop = (1 << 1),
+} LFRFIDRawWriterFlag;
+
+// Double-buffered block writer, SD latency is taken by a low priority thread
+// while read thread keeps draining capture buffers into the other block
+typedef struct {
+    LFRFIDRawFile* file;
+    FuriThread* thread;
+    // Taken while back block is owned by writer thread
+    FuriSemaphore* back_free;
+    volatile bool write_failed;
+
+    uint8_t block[2][READ_WRITE_BLOCK_SIZE];
+    size_t length;
+    uint8_t active;
+
+    uint8_t pending;
+    size_t pending_length;
+} LFRFIDRawWriter;
+
 // main worker
 struct LFRFIDRawWorker {
     FuriString* file_path;
@@ -49,6 +74,9 @@ struct LFRFIDRawWorker {
 
     float frequency;
     float duty_cycle;
+
+    volatile size_t capture_overrun_count;
+    volatile size_t write_overrun_count;
 };
 
 typedef enum {
@@ -91,6 +119,8 @@ void lfrfid_raw_worker_start_read(
     worker->duty_cycle = duty_cycle;
     worker->read_callback = callback;
     worker->context = context;
+    worker->capture_overrun_count = 0;
+    worker->write_overrun_count = 0;
 
     furi_thread_set_callback(worker->thread, lfrfid_raw_read_worker_thread);
 
@@ -110,6 +140,14 @@ void lfrfid_raw_worker_start_emulate(
     furi_thread_start(worker->thread);
 }
 
+void lfrfid_raw_worker_get_read_stats(LFRFIDRawWorker* worker, LFRFIDRawWorkerReadStats* stats) {
+    furi_assert(worker);
+    furi_assert(stats);
+
+    stats->capture_overrun_count = worker->capture_overrun_count;
+    stats->write_overrun_count = worker->write_overrun_count;
+}
+
 void lfrfid_raw_worker_stop(LFRFIDRawWorker* worker) {
     worker->emulate_callback = NULL;
     worker->context = NULL;
@@ -130,6 +168,96 @@ static void lfrfid_raw_worker_capture(bool level, uint32_t duration, void* conte
     }
 }
 
+static int32_t lfrfid_raw_writer_thread(void* context) {
+    LFRFIDRawWriter* writer = context;
+
+    for(;;) {
+        uint32_t flags = furi_thread_flags_wait(
+            LFRFIDRawWriterFlagWrite | LFRFIDRawWriterFlagStop, FuriFlagWaitAny, FuriWaitForever);
+
+        if(flags & LFRFIDRawWriterFlagWrite) {
+            if(!lfrfid_raw_file_write_buffer(
+                   writer->file, writer->block[writer->pending], writer->pending_length)) {
+                writer->write_failed = true;
+            }
+            furi_semaphore_release(writer->back_free);
+        }
+
+        if(flags & LFRFIDRawWriterFlagStop) break;
+    }
+
+    return 0;
+}
+
+static LFRFIDRawWriter* lfrfid_raw_writer_alloc(LFRFIDRawFile* file) {
+    LFRFIDRawWriter* writer = malloc(sizeof(LFRFIDRawWriter));
+    writer->file = file;
+    writer->back_free = furi_semaphore_alloc(1, 1);
+
+    writer->thread =
+        furi_thread_alloc_ex("LfrfidRawWriter", 1024, lfrfid_raw_writer_thread, writer);
+    furi_thread_set_priority(writer->thread, FuriThreadPriorityLow);
+    furi_thread_start(writer->thread);
+
+    return writer;
+}
+
+/** Hand active block over to writer thread
+ *
+ * @param writer LFRFIDRawWriter instance
+ * @param wait wait for previous block to be written instead of dropping this one
+ * @return false if block was dropped
+ */
+static bool lfrfid_raw_writer_flush(LFRFIDRawWriter* writer, bool wait) {
+    if(writer->length == 0) return true;
+
+    if(furi_semaphore_acquire(writer->back_free, wait ? FuriWaitForever : 0) != FuriStatusOk) {
+        writer->length = 0;
+        return false;
+    }
+
+    writer->pending = writer->active;
+    writer->pending_length = writer->length;
+    writer->active ^= 1;
+    writer->length = 0;
+    furi_thread_flags_set(furi_thread_get_id(writer->thread), LFRFIDRawWriterFlagWrite);
+
+    return true;
+}
+
+static void lfrfid_raw_writer_free(LFRFIDRawWriter* writer) {
+    lfrfid_raw_writer_flush(writer, true);
+
+    // Wait for the last write
+    furi_semaphore_acquire(writer->back_free, FuriWaitForever);
+    furi_thread_flags_set(furi_thread_get_id(writer->thread), LFRFIDRawWriterFlagStop);
+    furi_thread_join(writer->thread);
+    furi_thread_free(writer->thread);
+
+    furi_semaphore_free(writer->back_free);
+    free(writer);
+}
+
+/** Append capture buffer to active block
+ *
+ * @param writer LFRFIDRawWriter instance
+ * @param data buffer data, whole varint pairs only
+ * @param size buffer size, up to RFID_DATA_BUFFER_SIZE
+ * @return false if a block was dropped because SD is behind
+ */
+static bool lfrfid_raw_writer_add(LFRFIDRawWriter* writer, const uint8_t* data, size_t size) {
+    bool result = true;
+
+    if(writer->length + size > READ_WRITE_BLOCK_SIZE) {
+        result = lfrfid_raw_writer_flush(writer, false);
+    }
+
+    memcpy(&writer->block[writer->active][writer->length], data, size);
+    writer->length += size;
+
+    return result;
+}
+
 static int32_t lfrfid_raw_read_worker_thread(void* thread_context) {
     LFRFIDRawWorker* worker = (LFRFIDRawWorker*)thread_context;
 
@@ -146,10 +274,13 @@ static int32_t lfrfid_raw_read_worker_thread(void* thread_context) {
     if(file_valid) {
         // write header
         file_valid = lfrfid_raw_file_write_header(
-            file, worker->frequency, worker->duty_cycle, RFID_DATA_BUFFER_SIZE);
+            file, worker->frequency, worker->duty_cycle, READ_WRITE_BLOCK_SIZE);
     }
 
     if(file_valid) {
+        LFRFIDRawWriter* writer = lfrfid_raw_writer_alloc(file);
+        size_t overrun_count_reported = 0;
+
         // setup carrier
         furi_hal_rfid_tim_read_start(worker->frequency, worker->duty_cycle);
 
@@ -163,11 +294,17 @@ static int32_t lfrfid_raw_read_worker_thread(void* thread_context) {
             Buffer* buffer = buffer_stream_receive(data->stream, 100);
 
             if(buffer != NULL) {
-                file_valid = lfrfid_raw_file_write_buffer(
-                    file, buffer_get_data(buffer), buffer_get_size(buffer));
+                if(!lfrfid_raw_writer_add(
+                       writer, buffer_get_data(buffer), buffer_get_size(buffer))) {
+                    worker->write_overrun_count++;
+                }
                 buffer_reset(buffer);
             }
 
+            if(writer->write_failed) {
+                file_valid = false;
+            }
+
             if(!file_valid) {
                 if(worker->read_callback != NULL) {
                     // message file_error to worker
@@ -176,9 +313,11 @@ static int32_t lfrfid_raw_read_worker_thread(void* thread_context) {
                 break;
             }
 
-            if(buffer_stream_get_overrun_count(data->stream) > 0 &&
-               worker->read_callback != NULL) {
+            worker->capture_overrun_count = buffer_stream_get_overrun_count(data->stream);
+            size_t overrun_count = worker->capture_overrun_count + worker->write_overrun_count;
+            if(overrun_count != overrun_count_reported && worker->read_callback != NULL) {
                 // message overrun to worker
+                overrun_count_reported = overrun_count;
                 worker->read_callback(LFRFIDWorkerReadRawOverrun, worker->context);
             }
 
@@ -190,6 +329,16 @@ static int32_t lfrfid_raw_read_worker_thread(void* thread_context) {
 
         furi_hal_rfid_tim_read_capture_stop();
         furi_hal_rfid_tim_read_stop();
+
+        lfrfid_raw_writer_free(writer);
+
+        if(worker->capture_overrun_count || worker->write_overrun_count) {
+            FURI_LOG_E(
+                TAG_READ,
+                "overruns: capture %zu, write %zu",
+                worker->capture_overrun_count,
+                worker->write_overrun_count);
+        }
     } else {
         if(worker->read_callback != NULL) {
             // message file_error to worker
@@ -10,6 +10,11 @@ extern "C" {
 
 typedef struct LFRFIDRawWorker LFRFIDRawWorker;
 
+typedef struct {
+    size_t capture_overrun_count; /**< capture buffers lost, decoder thread was behind */
+    size_t write_overrun_count; /**< blocks lost, SD card was behind */
+} LFRFIDRawWorkerReadStats;
+
 /**
  * @brief Allocate a new LFRFIDRawWorker instance
  * 
@@ -56,6 +61,14 @@ void lfrfid_raw_worker_start_emulate(
     LFRFIDWorkerEmulateRawCallback callback,
     void* context);
 
+/**
+ * @brief Get overrun counters of current or last read
+ * 
+ * @param worker LFRFIDRawWorker instance
+ * @param stats where counters will be stored
+ */
+void lfrfid_raw_worker_get_read_stats(LFRFIDRawWorker* worker, LFRFIDRawWorkerReadStats* stats);
+
 /**
  * @brief Stop worker
  * 
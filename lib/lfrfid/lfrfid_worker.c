@@ -28,6 +28,7 @@ LFRFIDWorker* lfrfid_worker_alloc(ProtocolDict* dict) {
     worker->cb_ctx = NULL;
     worker->raw_filename = NULL;
     worker->mode_storage = NULL;
+    worker->write_speed = LFRFIDT5577SpeedDefault;
 
     worker->thread = furi_thread_alloc_ex("LfrfidWorker", 2048, lfrfid_worker_thread, worker);
 
@@ -69,6 +70,11 @@ void lfrfid_worker_write_start(
     furi_thread_flags_set(furi_thread_get_id(worker->thread), LFRFIDEventWrite);
 }
 
+void lfrfid_worker_set_write_speed(LFRFIDWorker* worker, LFRFIDT5577Speed speed) {
+    furi_assert(worker->mode_index == LFRFIDWorkerIdle);
+    worker->write_speed = speed;
+}
+
 void lfrfid_worker_emulate_start(LFRFIDWorker* worker, LFRFIDProtocol protocol) {
     furi_assert(worker->mode_index == LFRFIDWorkerIdle);
     worker->protocol = protocol;
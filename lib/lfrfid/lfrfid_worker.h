@@ -106,6 +106,14 @@ void lfrfid_worker_write_start(
     LFRFIDWorkerWriteCallback callback,
     void* context);
 
+/**
+ * @brief Set T5577 timing profile for next write modes
+ * 
+ * @param worker 
+ * @param speed 
+ */
+void lfrfid_worker_set_write_speed(LFRFIDWorker* worker, LFRFIDT5577Speed speed);
+
 /**
  * Start emulate mode
  * @param worker 
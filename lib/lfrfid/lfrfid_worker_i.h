@@ -47,6 +47,7 @@ struct LFRFIDWorker {
 
     ProtocolDict* protocols;
     LFRFIDProtocol protocol;
+    LFRFIDT5577Speed write_speed;
 };
 
 extern const LFRFIDWorkerModeType lfrfid_worker_modes[];
@@ -94,13 +94,30 @@ typedef enum {
     LFRFIDWorkerReadTimeout,
 } LFRFIDWorkerReadState;
 
+/** Read until a protocol is validated
+ *
+ * @param worker LFRFIDWorker instance
+ * @param feature demodulation to set up
+ * @param target protocol to decode, PROTOCOL_NO to decode every protocol of the feature
+ * @param timeout time without decoded frames before giving up
+ * @param result_protocol validated protocol
+ */
 static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     LFRFIDWorker* worker,
     LFRFIDFeature feature,
+    ProtocolId target,
     uint32_t timeout,
     ProtocolId* result_protocol) {
     LFRFIDWorkerReadState state = LFRFIDWorkerReadTimeout;
 
+    // Carrier can only be set up for one demodulation at a time, but in auto mode
+    // edge stream is decoded by both ASK and PSK decoders, so a tag that shows up
+    // on the current carrier is caught without waiting for the next switch
+    uint32_t decode_feature = feature;
+    if(worker->read_type == LFRFIDWorkerReadTypeAuto) {
+        decode_feature = LFRFIDFeatureASK | LFRFIDFeaturePSK;
+    }
+
     if(feature & LFRFIDFeatureASK) {
         furi_hal_rfid_tim_read_start(125000, 0.5);
         FURI_LOG_D(TAG, "Start ASK");
@@ -220,11 +237,20 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
 
                 ProtocolId protocol = PROTOCOL_NO;
 
-                protocol = protocol_dict_decoders_feed_by_feature(
-                    worker->protocols, feature, true, pulse);
-                if(protocol == PROTOCOL_NO) {
+                if(target != PROTOCOL_NO) {
+                    protocol =
+                        protocol_dict_decoders_feed_by_id(worker->protocols, target, true, pulse);
+                    if(protocol == PROTOCOL_NO) {
+                        protocol = protocol_dict_decoders_feed_by_id(
+                            worker->protocols, target, false, duration - pulse);
+                    }
+                } else {
                     protocol = protocol_dict_decoders_feed_by_feature(
-                        worker->protocols, feature, false, duration - pulse);
+                        worker->protocols, decode_feature, true, pulse);
+                    if(protocol == PROTOCOL_NO) {
+                        protocol = protocol_dict_decoders_feed_by_feature(
+                            worker->protocols, decode_feature, false, duration - pulse);
+                    }
                 }
 
                 if(protocol != PROTOCOL_NO) {
@@ -346,7 +372,7 @@ static void lfrfid_worker_mode_read_process(LFRFIDWorker* worker) {
         while(1) {
             // read for a while
             state = lfrfid_worker_read_internal(
-                worker, feature, LFRFID_WORKER_READ_SWITCH_TIME_MS, &read_result);
+                worker, feature, PROTOCOL_NO, LFRFID_WORKER_READ_SWITCH_TIME_MS, &read_result);
 
             if(state == LFRFIDWorkerReadOK || state == LFRFIDWorkerReadExit) {
                 break;
@@ -364,10 +390,11 @@ static void lfrfid_worker_mode_read_process(LFRFIDWorker* worker) {
     } else {
         while(1) {
             if(worker->read_type == LFRFIDWorkerReadTypeASKOnly) {
-                state = lfrfid_worker_read_internal(worker, feature, UINT32_MAX, &read_result);
+                state = lfrfid_worker_read_internal(
+                    worker, feature, PROTOCOL_NO, UINT32_MAX, &read_result);
             } else {
                 state = lfrfid_worker_read_internal(
-                    worker, feature, LFRFID_WORKER_READ_SWITCH_TIME_MS, &read_result);
+                    worker, feature, PROTOCOL_NO, LFRFID_WORKER_READ_SWITCH_TIME_MS, &read_result);
             }
 
             if(state == LFRFIDWorkerReadOK || state == LFRFIDWorkerReadExit) {
@@ -515,12 +542,14 @@ static void lfrfid_worker_mode_write_process(LFRFIDWorker* worker) {
     if(can_be_written) {
         while(!lfrfid_worker_check_for_stop(worker)) {
             FURI_LOG_D(TAG, "Data write");
-            t5577_write(&request->t5577);
+            t5577_write_ex(&request->t5577, worker->write_speed);
 
+            // Only the written protocol can be a successful verify, don't run other decoders
             ProtocolId read_result = PROTOCOL_NO;
             LFRFIDWorkerReadState state = lfrfid_worker_read_internal(
                 worker,
                 protocol_dict_get_features(worker->protocols, protocol),
+                protocol,
                 LFRFID_WORKER_WRITE_VERIFY_TIME_MS,
                 &read_result);
 
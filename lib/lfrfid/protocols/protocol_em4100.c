@@ -21,6 +21,10 @@ typedef uint64_t EM4100DecodedData;
 #define EM_HEADER_AND_STOP_MASK (EM_HEADER_MASK | EM_STOP_MASK)
 #define EM_HEADER_AND_STOP_DATA (EM_HEADER_MASK)
 
+// Last received bits are a full header, next one is expected a frame later
+#define EM_SYNC_MASK (0x1FFLLU)
+#define EM_SYNC_FRAME_BITS (64)
+
 #define EM4100_DECODED_DATA_SIZE (5)
 #define EM4100_ENCODED_DATA_SIZE (sizeof(EM4100DecodedData))
 
@@ -43,6 +47,7 @@ typedef struct {
     bool encoded_polarity;
 
     ManchesterState decoder_manchester_state;
+    uint8_t decoder_sync_bits;
 } ProtocolEM4100;
 
 ProtocolEM4100* protocol_em4100_alloc(void) {
@@ -133,6 +138,7 @@ static bool em4100_can_be_decoded(const uint8_t* encoded_data, const uint8_t enc
 void protocol_em4100_decoder_start(ProtocolEM4100* proto) {
     memset(proto->data, 0, EM4100_DECODED_DATA_SIZE);
     proto->encoded_data = 0;
+    proto->decoder_sync_bits = 0;
     manchester_advance(
         proto->decoder_manchester_state,
         ManchesterEventReset,
@@ -159,7 +165,9 @@ bool protocol_em4100_decoder_feed(ProtocolEM4100* proto, bool level, uint32_t du
         }
     }
 
-    if(event != ManchesterEventReset) {
+    if(event == ManchesterEventReset) {
+        proto->decoder_sync_bits = 0;
+    } else {
         bool data;
         bool data_ok = manchester_advance(
             proto->decoder_manchester_state, event, &proto->decoder_manchester_state, &data);
@@ -167,6 +175,14 @@ bool protocol_em4100_decoder_feed(ProtocolEM4100* proto, bool level, uint32_t du
         if(data_ok) {
             proto->encoded_data = (proto->encoded_data << 1) | data;
 
+            if(proto->decoder_sync_bits) {
+                proto->decoder_sync_bits--;
+            }
+            // Row parity keeps nine ones in a row out of the data
+            if((proto->encoded_data & EM_SYNC_MASK) == EM_SYNC_MASK) {
+                proto->decoder_sync_bits = EM_SYNC_FRAME_BITS;
+            }
+
             if(em4100_can_be_decoded((uint8_t*)&proto->encoded_data, sizeof(EM4100DecodedData))) {
                 em4100_decode(
                     (uint8_t*)&proto->encoded_data,
@@ -181,6 +197,10 @@ bool protocol_em4100_decoder_feed(ProtocolEM4100* proto, bool level, uint32_t du
     return result;
 };
 
+bool protocol_em4100_decoder_is_synced(ProtocolEM4100* proto) {
+    return proto->decoder_sync_bits > 0;
+}
+
 static void em4100_write_nibble(bool low_nibble, uint8_t data, EM4100DecodedData* encoded_data) {
     uint8_t parity_sum = 0;
     uint8_t start = 0;
@@ -289,6 +309,8 @@ const ProtocolBase protocol_em4100 = {
         {
             .start = (ProtocolDecoderStart)protocol_em4100_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_em4100_decoder_feed,
+            .is_synced = (ProtocolDecoderIsSynced)protocol_em4100_decoder_is_synced,
+            .duration_min = EM_READ_SHORT_TIME_LOW,
         },
     .encoder =
         {
@@ -15,8 +15,16 @@
 #define H10301_BIT_SIZE (sizeof(uint32_t) * 8)
 #define H10301_BIT_MAX_SIZE (H10301_BIT_SIZE * H10301_DECODED_DATA_SIZE)
 
+#define H10301_PREAMBLE (0x1D)
+// Frame repeats back to back, next preamble is expected a frame later
+#define H10301_SYNC_FRAME_BITS (H10301_BIT_SIZE * H10301_ENCODED_DATA_SIZE_U32)
+// Pulses without a demodulated bit after which the lock is dropped
+#define H10301_SYNC_IDLE_PULSES (64)
+
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t sync_bits;
+    uint8_t sync_idle;
 } ProtocolH10301Decoder;
 
 typedef struct {
@@ -52,6 +60,8 @@ uint8_t* protocol_h10301_get_data(ProtocolH10301* protocol) {
 
 void protocol_h10301_decoder_start(ProtocolH10301* protocol) {
     memset(protocol->encoded_data, 0, sizeof(uint32_t) * 3);
+    protocol->decoder.sync_bits = 0;
+    protocol->decoder.sync_idle = 0;
 };
 
 static void protocol_h10301_decoder_store_data(ProtocolH10301* protocol, bool data) {
@@ -193,9 +203,24 @@ bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t
     bool result = false;
 
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
+    if(count == 0) {
+        if(protocol->decoder.sync_bits &&
+           ++protocol->decoder.sync_idle >= H10301_SYNC_IDLE_PULSES) {
+            protocol->decoder.sync_bits = 0;
+        }
+    } else {
+        protocol->decoder.sync_idle = 0;
         for(size_t i = 0; i < count; i++) {
             protocol_h10301_decoder_store_data(protocol, value);
+
+            if(protocol->decoder.sync_bits) {
+                protocol->decoder.sync_bits--;
+            }
+            // Preamble can't appear inside manchester coded data
+            if((protocol->encoded_data[2] & 0xFF) == H10301_PREAMBLE) {
+                protocol->decoder.sync_bits = H10301_SYNC_FRAME_BITS;
+            }
+
             if(protocol_h10301_can_be_decoded(protocol->encoded_data)) {
                 protocol_h10301_decode(protocol->encoded_data, protocol->data);
                 result = true;
@@ -207,6 +232,10 @@ bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t
     return result;
 };
 
+bool protocol_h10301_decoder_is_synced(ProtocolH10301* protocol) {
+    return protocol->decoder.sync_bits > 0;
+}
+
 static void protocol_h10301_write_raw_bit(bool bit, uint8_t position, uint32_t* card_data) {
     if(bit) {
         card_data[position / H10301_BIT_SIZE] |=
@@ -378,6 +407,7 @@ const ProtocolBase protocol_h10301 = {
         {
             .start = (ProtocolDecoderStart)protocol_h10301_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_h10301_decoder_feed,
+            .is_synced = (ProtocolDecoderIsSynced)protocol_h10301_decoder_is_synced,
         },
     .encoder =
         {
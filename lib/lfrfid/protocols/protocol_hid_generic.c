@@ -20,8 +20,15 @@
 
 #define HID_PREAMBLE 0x1D
 
+// Frame repeats back to back, next preamble is expected a frame later
+#define HID_SYNC_FRAME_BITS ((HID_PREAMBLE_SIZE + HID_DATA_SIZE) * 8)
+// Pulses without a demodulated bit after which the lock is dropped
+#define HID_SYNC_IDLE_PULSES 64
+
 typedef struct {
     FSKDemod* fsk_demod;
+    uint8_t sync_bits;
+    uint8_t sync_idle;
 } ProtocolHIDDecoder;
 
 typedef struct {
@@ -57,6 +64,8 @@ uint8_t* protocol_hid_generic_get_data(ProtocolHID* protocol) {
 
 void protocol_hid_generic_decoder_start(ProtocolHID* protocol) {
     memset(protocol->encoded_data, 0, HID_ENCODED_DATA_SIZE);
+    protocol->decoder.sync_bits = 0;
+    protocol->decoder.sync_idle = 0;
 };
 
 static bool protocol_hid_generic_can_be_decoded(const uint8_t* data) {
@@ -131,9 +140,24 @@ bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32
     bool result = false;
 
     fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
+    if(count == 0) {
+        if(protocol->decoder.sync_bits &&
+           ++protocol->decoder.sync_idle >= HID_SYNC_IDLE_PULSES) {
+            protocol->decoder.sync_bits = 0;
+        }
+    } else {
+        protocol->decoder.sync_idle = 0;
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
+
+            if(protocol->decoder.sync_bits) {
+                protocol->decoder.sync_bits--;
+            }
+            // Preamble can't appear inside manchester coded data
+            if(protocol->encoded_data[HID_ENCODED_DATA_SIZE - 1] == HID_PREAMBLE) {
+                protocol->decoder.sync_bits = HID_SYNC_FRAME_BITS;
+            }
+
             if(protocol_hid_generic_can_be_decoded(protocol->encoded_data)) {
                 protocol_hid_generic_decode(protocol->encoded_data, protocol->data);
                 result = true;
@@ -144,6 +168,10 @@ bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32
     return result;
 };
 
+bool protocol_hid_generic_decoder_is_synced(ProtocolHID* protocol) {
+    return protocol->decoder.sync_bits > 0;
+}
+
 static void protocol_hid_generic_encode(ProtocolHID* protocol) {
     protocol->encoded_data[0] = HID_PREAMBLE;
 
@@ -276,6 +304,7 @@ const ProtocolBase protocol_hid_generic = {
         {
             .start = (ProtocolDecoderStart)protocol_hid_generic_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_hid_generic_decoder_feed,
+            .is_synced = (ProtocolDecoderIsSynced)protocol_hid_generic_decoder_is_synced,
         },
     .encoder =
         {
@@ -2,17 +2,42 @@
 #include <furi.h>
 #include <furi_hal_rfid.h>
 
-#define T5577_TIMING_WAIT_TIME 400
-#define T5577_TIMING_START_GAP 30
-#define T5577_TIMING_WRITE_GAP 18
-#define T5577_TIMING_DATA_0 24
-#define T5577_TIMING_DATA_1 56
-#define T5577_TIMING_PROGRAM 700
-
 #define T5577_OPCODE_PAGE_0 0b10
 #define T5577_OPCODE_PAGE_1 0b11
 #define T5577_OPCODE_RESET 0b00
 
+// All times are in carrier periods (8us)
+typedef struct {
+    uint16_t wait_time;
+    uint16_t start_gap;
+    uint16_t write_gap;
+    uint16_t data_0;
+    uint16_t data_1;
+    uint16_t program;
+} T5577Timing;
+
+static const T5577Timing t5577_timings[] = {
+    [LFRFIDT5577SpeedDefault] =
+        {
+            .wait_time = 400,
+            .start_gap = 30,
+            .write_gap = 18,
+            .data_0 = 24,
+            .data_1 = 56,
+            .program = 700,
+        },
+    // Typical datasheet gaps and shorter settle time, programming time is kept
+    [LFRFIDT5577SpeedFast] =
+        {
+            .wait_time = 200,
+            .start_gap = 15,
+            .write_gap = 10,
+            .data_0 = 24,
+            .data_1 = 56,
+            .program = 700,
+        },
+};
+
 static void t5577_start() {
     furi_hal_rfid_tim_read_start(125000, 0.5);
 
@@ -31,88 +56,93 @@ static void t5577_write_gap(uint32_t gap_time) {
     furi_hal_rfid_tim_read_continue();
 }
 
-static void t5577_write_bit(bool value) {
+static void t5577_write_bit(const T5577Timing* timing, bool value) {
     if(value) {
-        furi_delay_us(T5577_TIMING_DATA_1 * 8);
+        furi_delay_us(timing->data_1 * 8);
     } else {
-        furi_delay_us(T5577_TIMING_DATA_0 * 8);
+        furi_delay_us(timing->data_0 * 8);
     }
-    t5577_write_gap(T5577_TIMING_WRITE_GAP);
+    t5577_write_gap(timing->write_gap);
 }
 
-static void t5577_write_opcode(uint8_t value) {
-    t5577_write_bit((value >> 1) & 1);
-    t5577_write_bit((value >> 0) & 1);
+static void t5577_write_opcode(const T5577Timing* timing, uint8_t value) {
+    t5577_write_bit(timing, (value >> 1) & 1);
+    t5577_write_bit(timing, (value >> 0) & 1);
 }
 
-static void t5577_write_reset() {
-    t5577_write_gap(T5577_TIMING_START_GAP);
-    t5577_write_bit(1);
-    t5577_write_bit(0);
+static void t5577_write_reset(const T5577Timing* timing) {
+    t5577_write_gap(timing->start_gap);
+    t5577_write_bit(timing, 1);
+    t5577_write_bit(timing, 0);
 }
 
 static void t5577_write_block_pass(
+    const T5577Timing* timing,
     uint8_t block,
     bool lock_bit,
     uint32_t data,
     bool with_pass,
     uint32_t password) {
-    furi_delay_us(T5577_TIMING_WAIT_TIME * 8);
+    furi_delay_us(timing->wait_time * 8);
 
     // start gap
-    t5577_write_gap(T5577_TIMING_START_GAP);
+    t5577_write_gap(timing->start_gap);
 
     // opcode for page 0
-    t5577_write_opcode(T5577_OPCODE_PAGE_0);
+    t5577_write_opcode(timing, T5577_OPCODE_PAGE_0);
 
     // password
     if(with_pass) {
         for(uint8_t i = 0; i < 32; i++) {
-            t5577_write_bit((password >> (31 - i)) & 1);
+            t5577_write_bit(timing, (password >> (31 - i)) & 1);
         }
     }
 
     // lock bit
-    t5577_write_bit(lock_bit);
+    t5577_write_bit(timing, lock_bit);
 
     // data
     for(uint8_t i = 0; i < 32; i++) {
-        t5577_write_bit((data >> (31 - i)) & 1);
+        t5577_write_bit(timing, (data >> (31 - i)) & 1);
     }
 
     // block address
-    t5577_write_bit((block >> 2) & 1);
-    t5577_write_bit((block >> 1) & 1);
-    t5577_write_bit((block >> 0) & 1);
+    t5577_write_bit(timing, (block >> 2) & 1);
+    t5577_write_bit(timing, (block >> 1) & 1);
+    t5577_write_bit(timing, (block >> 0) & 1);
 
-    furi_delay_us(T5577_TIMING_PROGRAM * 8);
+    furi_delay_us(timing->program * 8);
 
-    furi_delay_us(T5577_TIMING_WAIT_TIME * 8);
-    t5577_write_reset();
+    furi_delay_us(timing->wait_time * 8);
+    t5577_write_reset(timing);
 }
 
-static void t5577_write_block_simple(uint8_t block, bool lock_bit, uint32_t data) {
-    t5577_write_block_pass(block, lock_bit, data, false, 0);
-}
+static void t5577_write_blocks(
+    LFRFIDT5577* data,
+    LFRFIDT5577Speed speed,
+    bool with_pass,
+    uint32_t password) {
+    furi_check(speed < COUNT_OF(t5577_timings));
+    const T5577Timing* timing = &t5577_timings[speed];
 
-void t5577_write(LFRFIDT5577* data) {
     t5577_start();
     FURI_CRITICAL_ENTER();
     for(size_t i = 0; i < data->blocks_to_write; i++) {
-        t5577_write_block_simple(i, false, data->block[i]);
+        t5577_write_block_pass(timing, i, false, data->block[i], with_pass, password);
     }
-    t5577_write_reset();
+    t5577_write_reset(timing);
     FURI_CRITICAL_EXIT();
     t5577_stop();
 }
 
+void t5577_write(LFRFIDT5577* data) {
+    t5577_write_blocks(data, LFRFIDT5577SpeedDefault, false, 0);
+}
+
+void t5577_write_ex(LFRFIDT5577* data, LFRFIDT5577Speed speed) {
+    t5577_write_blocks(data, speed, false, 0);
+}
+
 void t5577_write_with_pass(LFRFIDT5577* data, uint32_t password) {
-    t5577_start();
-    FURI_CRITICAL_ENTER();
-    for(size_t i = 0; i < data->blocks_to_write; i++) {
-        t5577_write_block_pass(i, false, data->block[i], true, password);
-    }
-    t5577_write_reset();
-    FURI_CRITICAL_EXIT();
-    t5577_stop();
+    t5577_write_blocks(data, LFRFIDT5577SpeedDefault, true, password);
 }
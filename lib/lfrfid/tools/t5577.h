@@ -44,6 +44,11 @@ typedef struct {
     uint32_t blocks_to_write;
 } LFRFIDT5577;
 
+typedef enum {
+    LFRFIDT5577SpeedDefault, /**< Conservative timings, works with most clones */
+    LFRFIDT5577SpeedFast, /**< Typical datasheet timings, for bulk programming */
+} LFRFIDT5577Speed;
+
 /**
  * @brief Write T5577 tag data to tag
  * 
@@ -51,6 +56,14 @@ typedef struct {
  */
 void t5577_write(LFRFIDT5577* data);
 
+/**
+ * @brief Write T5577 tag data to tag using given timing profile
+ * 
+ * @param data 
+ * @param speed timing profile
+ */
+void t5577_write_ex(LFRFIDT5577* data, LFRFIDT5577Speed speed);
+
 void t5577_write_with_pass(LFRFIDT5577* data, uint32_t password);
 
 #ifdef __cplusplus
@@ -1243,22 +1243,13 @@ static void bits2int(uECC_word_t *native,
     }
 }
 
-static int uECC_sign_with_k_internal(const uint8_t *private_key,
-                            const uint8_t *message_hash,
-                            unsigned hash_size,
-                            uECC_word_t *k,
-                            uint8_t *signature,
-                            uECC_Curve curve) {
-
+/* Computes r = (k * G).x and k = 1 / k, the costly part that doesn't depend on the message */
+static int uECC_sign_prepare_k(uECC_word_t *k, uECC_word_t *r, uECC_Curve curve) {
     uECC_word_t tmp[uECC_MAX_WORDS];
     uECC_word_t s[uECC_MAX_WORDS];
     uECC_word_t *k2[2] = {tmp, s};
     uECC_word_t *initial_Z = 0;
-#if uECC_VLI_NATIVE_LITTLE_ENDIAN
-    uECC_word_t *p = (uECC_word_t *)signature;
-#else
     uECC_word_t p[uECC_MAX_WORDS * 2];
-#endif
     uECC_word_t carry;
     wordcount_t num_words = curve->num_words;
     wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
@@ -1298,9 +1289,23 @@ static int uECC_sign_with_k_internal(const uint8_t *private_key,
     uECC_vli_modInv(k, k, curve->n, num_n_words);       /* k = 1 / k' */
     uECC_vli_modMult(k, k, tmp, curve->n, num_n_words); /* k = 1 / k */
 
-#if uECC_VLI_NATIVE_LITTLE_ENDIAN == 0
-    uECC_vli_nativeToBytes(signature, curve->num_bytes, p); /* store r */
-#endif
+    uECC_vli_set(r, p, num_words);
+    return 1;
+}
+
+static int uECC_sign_finish(const uint8_t *private_key,
+                            const uint8_t *message_hash,
+                            unsigned hash_size,
+                            const uECC_word_t *k_inv,
+                            const uECC_word_t *r,
+                            uint8_t *signature,
+                            uECC_Curve curve) {
+    uECC_word_t tmp[uECC_MAX_WORDS];
+    uECC_word_t s[uECC_MAX_WORDS];
+    wordcount_t num_words = curve->num_words;
+    wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+    uECC_vli_nativeToBytes(signature, curve->num_bytes, r); /* store r */
 
 #if uECC_VLI_NATIVE_LITTLE_ENDIAN
     bcopy((uint8_t *) tmp, private_key, BITS_TO_BYTES(curve->num_n_bits));
@@ -1309,12 +1314,12 @@ static int uECC_sign_with_k_internal(const uint8_t *private_key,
 #endif
 
     s[num_n_words - 1] = 0;
-    uECC_vli_set(s, p, num_words);
+    uECC_vli_set(s, r, num_words);
     uECC_vli_modMult(s, tmp, s, curve->n, num_n_words); /* s = r*d */
 
     bits2int(tmp, message_hash, hash_size, curve);
     uECC_vli_modAdd(s, tmp, s, curve->n, num_n_words); /* s = e + r*d */
-    uECC_vli_modMult(s, s, k, curve->n, num_n_words);  /* s = (e + r*d) / k */
+    uECC_vli_modMult(s, s, k_inv, curve->n, num_n_words);  /* s = (e + r*d) / k */
     if (uECC_vli_numBits(s, num_n_words) > (bitcount_t)curve->num_bytes * 8) {
         return 0;
     }
@@ -1326,6 +1331,20 @@ static int uECC_sign_with_k_internal(const uint8_t *private_key,
     return 1;
 }
 
+static int uECC_sign_with_k_internal(const uint8_t *private_key,
+                            const uint8_t *message_hash,
+                            unsigned hash_size,
+                            uECC_word_t *k,
+                            uint8_t *signature,
+                            uECC_Curve curve) {
+    uECC_word_t r[uECC_MAX_WORDS];
+
+    if (!uECC_sign_prepare_k(k, r, curve)) {
+        return 0;
+    }
+    return uECC_sign_finish(private_key, message_hash, hash_size, k, r, signature, curve);
+}
+
 /* For testing - sign with an explicitly specified k value */
 int uECC_sign_with_k(const uint8_t *private_key,
                             const uint8_t *message_hash,
@@ -1358,6 +1377,55 @@ int uECC_sign(const uint8_t *private_key,
     return 0;
 }
 
+int uECC_sign_precompute(uECC_SignPrecomp *precomp, uECC_Curve curve) {
+    uECC_word_t k[uECC_MAX_WORDS];
+    uECC_word_t r[uECC_MAX_WORDS];
+    uECC_word_t tries;
+
+    precomp->curve = 0;
+    for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
+        if (!uECC_generate_random_int(k, curve->n, BITS_TO_WORDS(curve->num_n_bits))) {
+            return 0;
+        }
+
+        if (uECC_sign_prepare_k(k, r, curve)) {
+            uECC_vli_nativeToBytes(precomp->r, curve->num_bytes, r);
+            uECC_vli_nativeToBytes(precomp->k_inv, BITS_TO_BYTES(curve->num_n_bits), k);
+            precomp->curve = curve;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int uECC_sign_precomputed(const uint8_t *private_key,
+                          const uint8_t *message_hash,
+                          unsigned hash_size,
+                          uECC_SignPrecomp *precomp,
+                          uint8_t *signature,
+                          uECC_Curve curve) {
+    uECC_word_t k[uECC_MAX_WORDS];
+    uECC_word_t r[uECC_MAX_WORDS];
+    unsigned i;
+    int result;
+
+    if (precomp->curve != curve) {
+        return 0;
+    }
+    uECC_vli_bytesToNative(r, precomp->r, curve->num_bytes);
+    uECC_vli_bytesToNative(k, precomp->k_inv, BITS_TO_BYTES(curve->num_n_bits));
+
+    /* Never reuse k, it would reveal the private key */
+    precomp->curve = 0;
+    for (i = 0; i < sizeof(precomp->k_inv); ++i) {
+        precomp->k_inv[i] = 0;
+    }
+
+    result = uECC_sign_finish(private_key, message_hash, hash_size, k, r, signature, curve);
+    uECC_vli_clear(k, BITS_TO_WORDS(curve->num_n_bits));
+    return result;
+}
+
 /* Compute an HMAC using K as a key (as in RFC 6979). Note that K is always
    the same size as the hash result size. */
 static void HMAC_init(const uECC_HashContext *hash_context, const uint8_t *K) {
@@ -263,6 +263,41 @@ int uECC_sign(const uint8_t *private_key,
               uint8_t *signature,
               uECC_Curve curve);
 
+/* uECC_SignPrecomp structure.
+Holds the part of an ECDSA signature that doesn't depend on the message: r and the inverse of
+the random k. Finding it takes the scalar multiplication, which is almost all of the signing
+time, so it can be done ahead with uECC_sign_precompute() while the device is idle.
+Contents are as secret as the private key. */
+typedef struct uECC_SignPrecomp {
+    uint8_t r[32];
+    uint8_t k_inv[32];
+    uECC_Curve curve; /* 0 if empty */
+} uECC_SignPrecomp;
+
+/* uECC_sign_precompute() function.
+Prepare a random k for a future uECC_sign_precomputed() call.
+
+Outputs:
+    precomp - Will be filled in with the precomputed values.
+
+Returns 1 if successful, 0 if an error occurred.
+*/
+int uECC_sign_precompute(uECC_SignPrecomp *precomp, uECC_Curve curve);
+
+/* uECC_sign_precomputed() function.
+Generate an ECDSA signature like uECC_sign(), using values prepared by uECC_sign_precompute().
+The precomputed values are cleared, so they are never used for two signatures.
+
+Returns 1 if the signature generated successfully, 0 if an error occurred or if precomp is
+empty or was computed for another curve.
+*/
+int uECC_sign_precomputed(const uint8_t *private_key,
+                          const uint8_t *message_hash,
+                          unsigned hash_size,
+                          uECC_SignPrecomp *precomp,
+                          uint8_t *signature,
+                          uECC_Curve curve);
+
 /* uECC_HashContext structure.
 This is used to pass in an arbitrary hash function to uECC_sign_deterministic().
 The structure will be used for multiple hash computations; each time a new hash
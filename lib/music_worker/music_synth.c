@@ -0,0 +1,253 @@
+#include "music_synth.h"
+
+#include <furi_hal.h>
+#include <furi.h>
+
+#include <stm32wbxx_ll_tim.h>
+#include <stm32wbxx_ll_dma.h>
+
+#include <math.h>
+
+#define TAG "MusicSynth"
+
+#define MUSIC_SYNTH_PWM_TIMER TIM16
+#define MUSIC_SYNTH_PWM_CHANNEL LL_TIM_CHANNEL_CH1
+#define MUSIC_SYNTH_SAMPLE_TIMER TIM2
+#define MUSIC_SYNTH_DMA DMA1, LL_DMA_CHANNEL_1
+
+/** 256 samples per half, 8ms at 32kHz */
+#define MUSIC_SYNTH_BUFFER_SIZE 512
+/** Decay is applied in steps, per sample multiplication is not worth it */
+#define MUSIC_SYNTH_DECAY_PERIOD 32
+#define MUSIC_SYNTH_Q16_ONE (1UL << 16)
+
+typedef struct {
+    uint32_t phase;
+    uint32_t step;
+    uint32_t volume;
+    uint32_t decay;
+    MusicSynthWave wave;
+} MusicSynthVoice;
+
+struct MusicSynth {
+    MusicSynthVoice voices[MUSIC_SYNTH_VOICES];
+    uint16_t* buffer;
+
+    MusicSynthSequencer sequencer;
+    void* sequencer_context;
+    bool sequencer_active;
+    uint32_t sequencer_countdown;
+
+    uint32_t decay_counter;
+    bool running;
+};
+
+static inline int32_t music_synth_voice_sample(const MusicSynthVoice* voice) {
+    switch(voice->wave) {
+    case MusicSynthWaveTriangle: {
+        uint32_t position = voice->phase >> 15;
+        int32_t value = position < 0x10000 ? position : 0x1FFFF - position;
+        return value - 0x8000;
+    }
+    case MusicSynthWaveSawtooth:
+        return (int32_t)(voice->phase >> 16) - 0x8000;
+    default:
+        return (voice->phase & 0x80000000UL) ? -0x7FFF : 0x7FFF;
+    }
+}
+
+static void music_synth_render_chunk(MusicSynth* synth, uint16_t* buffer, size_t count) {
+    MusicSynthVoice* voices = synth->voices;
+
+    for(size_t i = 0; i < count; i++) {
+        int32_t mix = 0;
+        for(size_t v = 0; v < MUSIC_SYNTH_VOICES; v++) {
+            if(!voices[v].volume) continue;
+            mix += (music_synth_voice_sample(&voices[v]) * (int32_t)voices[v].volume) >> 16;
+            voices[v].phase += voices[v].step;
+        }
+
+        mix = (mix >> 8) + 128;
+        if(mix < 0) mix = 0;
+        if(mix > UINT8_MAX) mix = UINT8_MAX;
+        buffer[i] = mix;
+
+        if(++synth->decay_counter == MUSIC_SYNTH_DECAY_PERIOD) {
+            synth->decay_counter = 0;
+            for(size_t v = 0; v < MUSIC_SYNTH_VOICES; v++) {
+                voices[v].volume = ((uint64_t)voices[v].volume * voices[v].decay) >> 16;
+            }
+        }
+    }
+}
+
+static void music_synth_render(MusicSynth* synth, uint16_t* buffer, size_t count) {
+    while(count) {
+        // Sequencer events split the block, so notes start exactly where they should
+        if(synth->sequencer_active && !synth->sequencer_countdown) {
+            synth->sequencer_countdown = synth->sequencer(synth, synth->sequencer_context);
+            synth->sequencer_active = synth->sequencer_countdown > 0;
+        }
+
+        size_t chunk = count;
+        if(synth->sequencer_active) {
+            chunk = MIN(chunk, (size_t)synth->sequencer_countdown);
+            synth->sequencer_countdown -= chunk;
+        }
+
+        music_synth_render_chunk(synth, buffer, chunk);
+        buffer += chunk;
+        count -= chunk;
+    }
+}
+
+static void music_synth_dma_isr(void* context) {
+    MusicSynth* synth = context;
+
+    if(LL_DMA_IsActiveFlag_HT1(DMA1)) {
+        LL_DMA_ClearFlag_HT1(DMA1);
+        music_synth_render(synth, synth->buffer, MUSIC_SYNTH_BUFFER_SIZE / 2);
+    }
+
+    if(LL_DMA_IsActiveFlag_TC1(DMA1)) {
+        LL_DMA_ClearFlag_TC1(DMA1);
+        music_synth_render(
+            synth, synth->buffer + MUSIC_SYNTH_BUFFER_SIZE / 2, MUSIC_SYNTH_BUFFER_SIZE / 2);
+    }
+}
+
+MusicSynth* music_synth_alloc() {
+    MusicSynth* synth = malloc(sizeof(MusicSynth));
+    synth->buffer = malloc(MUSIC_SYNTH_BUFFER_SIZE * sizeof(uint16_t));
+    for(size_t v = 0; v < MUSIC_SYNTH_VOICES; v++) {
+        synth->voices[v].decay = MUSIC_SYNTH_Q16_ONE;
+    }
+    return synth;
+}
+
+void music_synth_free(MusicSynth* synth) {
+    furi_assert(synth);
+    furi_assert(!synth->running);
+    free(synth->buffer);
+    free(synth);
+}
+
+void music_synth_set_sequencer(MusicSynth* synth, MusicSynthSequencer callback, void* context) {
+    furi_assert(synth);
+    furi_assert(!synth->running);
+    synth->sequencer = callback;
+    synth->sequencer_context = context;
+}
+
+void music_synth_start(MusicSynth* synth) {
+    furi_assert(synth);
+    furi_assert(!synth->running);
+    furi_check(furi_hal_speaker_is_mine());
+
+    synth->sequencer_active = synth->sequencer != NULL;
+    synth->sequencer_countdown = 0;
+    synth->decay_counter = 0;
+    music_synth_render(synth, synth->buffer, MUSIC_SYNTH_BUFFER_SIZE);
+
+    // Speaker timer as 8-bit PWM, CCR1 is reloaded by DMA on every sample timer update
+    LL_TIM_InitTypeDef tim_init = {0};
+    tim_init.Prescaler = 1;
+    tim_init.Autoreload = UINT8_MAX;
+    LL_TIM_Init(MUSIC_SYNTH_PWM_TIMER, &tim_init);
+
+    LL_TIM_OC_InitTypeDef tim_oc_init = {0};
+    tim_oc_init.OCMode = LL_TIM_OCMODE_PWM1;
+    tim_oc_init.OCState = LL_TIM_OCSTATE_ENABLE;
+    tim_oc_init.CompareValue = UINT8_MAX / 2;
+    LL_TIM_OC_Init(MUSIC_SYNTH_PWM_TIMER, MUSIC_SYNTH_PWM_CHANNEL, &tim_oc_init);
+
+    furi_hal_bus_enable(FuriHalBusTIM2);
+    tim_init.Prescaler = 0;
+    tim_init.Autoreload = SystemCoreClock / MUSIC_SYNTH_SAMPLE_RATE - 1;
+    LL_TIM_Init(MUSIC_SYNTH_SAMPLE_TIMER, &tim_init);
+
+    LL_DMA_ConfigAddresses(
+        MUSIC_SYNTH_DMA,
+        (uint32_t)synth->buffer,
+        (uint32_t) & (MUSIC_SYNTH_PWM_TIMER->CCR1),
+        LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetDataLength(MUSIC_SYNTH_DMA, MUSIC_SYNTH_BUFFER_SIZE);
+    LL_DMA_SetPeriphRequest(MUSIC_SYNTH_DMA, LL_DMAMUX_REQ_TIM2_UP);
+    LL_DMA_SetDataTransferDirection(MUSIC_SYNTH_DMA, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetChannelPriorityLevel(MUSIC_SYNTH_DMA, LL_DMA_PRIORITY_VERYHIGH);
+    LL_DMA_SetMode(MUSIC_SYNTH_DMA, LL_DMA_MODE_CIRCULAR);
+    LL_DMA_SetPeriphIncMode(MUSIC_SYNTH_DMA, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(MUSIC_SYNTH_DMA, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(MUSIC_SYNTH_DMA, LL_DMA_PDATAALIGN_HALFWORD);
+    LL_DMA_SetMemorySize(MUSIC_SYNTH_DMA, LL_DMA_MDATAALIGN_HALFWORD);
+    LL_DMA_EnableIT_TC(MUSIC_SYNTH_DMA);
+    LL_DMA_EnableIT_HT(MUSIC_SYNTH_DMA);
+
+    synth->running = true;
+    furi_hal_interrupt_set_isr(FuriHalInterruptIdDma1Ch1, music_synth_dma_isr, synth);
+    LL_DMA_EnableChannel(MUSIC_SYNTH_DMA);
+    LL_TIM_EnableDMAReq_UPDATE(MUSIC_SYNTH_SAMPLE_TIMER);
+
+    LL_TIM_EnableAllOutputs(MUSIC_SYNTH_PWM_TIMER);
+    LL_TIM_EnableCounter(MUSIC_SYNTH_PWM_TIMER);
+    LL_TIM_EnableCounter(MUSIC_SYNTH_SAMPLE_TIMER);
+}
+
+void music_synth_stop(MusicSynth* synth) {
+    furi_assert(synth);
+    if(!synth->running) return;
+
+    LL_TIM_DisableCounter(MUSIC_SYNTH_SAMPLE_TIMER);
+    LL_TIM_DisableDMAReq_UPDATE(MUSIC_SYNTH_SAMPLE_TIMER);
+    LL_DMA_DisableChannel(MUSIC_SYNTH_DMA);
+    furi_hal_interrupt_set_isr(FuriHalInterruptIdDma1Ch1, NULL, NULL);
+    furi_hal_bus_disable(FuriHalBusTIM2);
+
+    LL_TIM_DisableAllOutputs(MUSIC_SYNTH_PWM_TIMER);
+    LL_TIM_DisableCounter(MUSIC_SYNTH_PWM_TIMER);
+
+    synth->running = false;
+}
+
+bool music_synth_is_running(MusicSynth* synth) {
+    furi_assert(synth);
+    return synth->running;
+}
+
+void music_synth_note_on(
+    MusicSynth* synth,
+    uint8_t voice,
+    float frequency,
+    float volume,
+    MusicSynthWave wave) {
+    furi_assert(synth);
+    furi_assert(voice < MUSIC_SYNTH_VOICES);
+
+    volume = CLAMP(volume, 1.0f, 0.0f);
+    volume = volume * volume * volume;
+    frequency = CLAMP(frequency, MUSIC_SYNTH_SAMPLE_RATE / 2.0f, 0.0f);
+
+    MusicSynthVoice* synth_voice = &synth->voices[voice];
+    FURI_CRITICAL_ENTER();
+    synth_voice->phase = 0;
+    synth_voice->step = frequency * (4294967296.0f / MUSIC_SYNTH_SAMPLE_RATE);
+    synth_voice->volume = volume * MUSIC_SYNTH_Q16_ONE;
+    synth_voice->wave = wave;
+    FURI_CRITICAL_EXIT();
+}
+
+void music_synth_note_off(MusicSynth* synth, uint8_t voice) {
+    furi_assert(synth);
+    furi_assert(voice < MUSIC_SYNTH_VOICES);
+    synth->voices[voice].volume = 0;
+}
+
+void music_synth_set_decay(MusicSynth* synth, uint8_t voice, float per_second) {
+    furi_assert(synth);
+    furi_assert(voice < MUSIC_SYNTH_VOICES);
+
+    per_second = CLAMP(per_second, 1.0f, 0.0f);
+    float per_period =
+        powf(per_second, (float)MUSIC_SYNTH_DECAY_PERIOD / (float)MUSIC_SYNTH_SAMPLE_RATE);
+    synth->voices[voice].decay = per_period * MUSIC_SYNTH_Q16_ONE;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file music_synth.h
+ * Fixed-point multi-voice synthesizer with DMA driven PWM output
+ *
+ * Voices are mixed into sample blocks from DMA interrupt and played through
+ * speaker timer as 8-bit PWM, so note timing is sample accurate and doesn't
+ * depend on thread scheduling. Speaker must be acquired by the caller.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MUSIC_SYNTH_SAMPLE_RATE 32000
+#define MUSIC_SYNTH_VOICES 4
+
+typedef enum {
+    MusicSynthWaveSquare,
+    MusicSynthWaveTriangle,
+    MusicSynthWaveSawtooth,
+} MusicSynthWave;
+
+typedef struct MusicSynth MusicSynth;
+
+/** Sequencer callback, called from interrupt at exact sample positions
+ *
+ * Use it to change notes with music_synth_note_on and music_synth_note_off.
+ *
+ * @param      synth    MusicSynth instance
+ * @param      context  callback context
+ *
+ * @return     samples till next call, 0 to stop calling sequencer
+ */
+typedef uint32_t (*MusicSynthSequencer)(MusicSynth* synth, void* context);
+
+MusicSynth* music_synth_alloc();
+
+void music_synth_free(MusicSynth* synth);
+
+/** Set sequencer callback, must be called before music_synth_start */
+void music_synth_set_sequencer(MusicSynth* synth, MusicSynthSequencer callback, void* context);
+
+/** Start output, speaker must be acquired by current thread */
+void music_synth_start(MusicSynth* synth);
+
+/** Stop output, speaker stays acquired */
+void music_synth_stop(MusicSynth* synth);
+
+bool music_synth_is_running(MusicSynth* synth);
+
+/** Start note on voice, safe to call from sequencer
+ *
+ * @param      synth      MusicSynth instance
+ * @param      voice      voice index, less than MUSIC_SYNTH_VOICES
+ * @param      frequency  note frequency in Hz
+ * @param      volume     0..1, same curve as furi_hal_speaker
+ * @param      wave       waveform
+ */
+void music_synth_note_on(
+    MusicSynth* synth,
+    uint8_t voice,
+    float frequency,
+    float volume,
+    MusicSynthWave wave);
+
+/** Silence voice, safe to call from sequencer */
+void music_synth_note_off(MusicSynth* synth, uint8_t voice);
+
+/** Set amplitude decay of voice
+ *
+ * @param      synth       MusicSynth instance
+ * @param      voice       voice index, less than MUSIC_SYNTH_VOICES
+ * @param      per_second  part of amplitude left after one second, 1 to disable decay
+ */
+void music_synth_set_decay(MusicSynth* synth, uint8_t voice, float per_second);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,5 @@
 #include "music_worker.h"
+#include "music_synth.h"
 
 #include <furi_hal.h>
 #include <furi.h>
@@ -20,6 +21,11 @@
 #define NOTE_C4_SEMITONE (4.0f * 12.0f)
 #define TWO_POW_TWELTH_ROOT 1.059463094359f
 
+/** Volume was multiplied by 0.9945679 every 2ms, this is the same for amplitude */
+#define NOTE_DECAY_PER_SECOND 0.0003f
+#define NOTE_QUEUE_SIZE 8
+#define SONG_LOOP_PAUSE_SAMPLES (MUSIC_SYNTH_SAMPLE_RATE / 100)
+
 typedef struct {
     uint8_t semitone;
     uint8_t duration;
@@ -32,6 +38,10 @@ struct MusicWorker {
     FuriThread* thread;
     bool should_work;
 
+    MusicSynth* synth;
+    FuriMessageQueue* queue;
+    size_t position;
+
     MusicWorkerCallback callback;
     void* callback_context;
 
@@ -42,58 +52,77 @@ struct MusicWorker {
     NoteBlockArray_t notes;
 };
 
+static uint32_t music_worker_sequencer(MusicSynth* synth, void* context) {
+    MusicWorker* instance = context;
+
+    if(instance->position >= NoteBlockArray_size(instance->notes)) {
+        // Short silence before song starts over
+        instance->position = 0;
+        music_synth_note_off(synth, 0);
+        return SONG_LOOP_PAUSE_SAMPLES;
+    }
+
+    const NoteBlock* note_block = NoteBlockArray_cget(instance->notes, instance->position);
+    if(note_block->semitone == SEMITONE_PAUSE) {
+        music_synth_note_off(synth, 0);
+    } else {
+        float note_from_a4 = (float)note_block->semitone - NOTE_C4_SEMITONE;
+        float frequency = NOTE_C4 * powf(TWO_POW_TWELTH_ROOT, note_from_a4);
+        music_synth_note_on(synth, 0, frequency, instance->volume, MusicSynthWaveSquare);
+    }
+
+    float duration = 60.0f * MUSIC_SYNTH_SAMPLE_RATE * 4 / MAX(instance->bpm, 1UL) /
+                     note_block->duration;
+    uint32_t dots = note_block->dots;
+    while(dots > 0) {
+        duration += duration / 2;
+        dots--;
+    }
+
+    // Callback is not interrupt safe, worker thread will call it
+    furi_message_queue_put(instance->queue, &instance->position, 0);
+    instance->position++;
+
+    return MAX((uint32_t)duration, 1UL);
+}
+
 static int32_t music_worker_thread_callback(void* context) {
     furi_assert(context);
     MusicWorker* instance = context;
 
-    NoteBlockArray_it_t it;
-    NoteBlockArray_it(it, instance->notes);
     if(furi_hal_speaker_acquire(1000)) {
+        instance->position = 0;
+        music_synth_set_decay(instance->synth, 0, NOTE_DECAY_PER_SECOND);
+        music_synth_start(instance->synth);
+
+        size_t position = 0;
         while(instance->should_work) {
-            if(NoteBlockArray_end_p(it)) {
-                NoteBlockArray_it(it, instance->notes);
-                furi_delay_ms(10);
-            } else {
-                NoteBlock* note_block = NoteBlockArray_ref(it);
-
-                float note_from_a4 = (float)note_block->semitone - NOTE_C4_SEMITONE;
-                float frequency = NOTE_C4 * powf(TWO_POW_TWELTH_ROOT, note_from_a4);
-                float duration = 60.0 * furi_kernel_get_tick_frequency() * 4 / instance->bpm /
-                                 note_block->duration;
-                uint32_t dots = note_block->dots;
-                while(dots > 0) {
-                    duration += duration / 2;
-                    dots--;
-                }
-                uint32_t next_tick = furi_get_tick() + duration;
-                float volume = instance->volume;
-
-                if(instance->callback) {
-                    instance->callback(
-                        note_block->semitone,
-                        note_block->dots,
-                        note_block->duration,
-                        0.0,
-                        instance->callback_context);
-                }
-
-                furi_hal_speaker_stop();
-                furi_hal_speaker_start(frequency, volume);
-                while(instance->should_work && furi_get_tick() < next_tick) {
-                    volume *= 0.9945679;
-                    furi_hal_speaker_set_volume(volume);
-                    furi_delay_ms(2);
-                }
-                NoteBlockArray_next(it);
+            if(furi_message_queue_get(instance->queue, &position, FuriWaitForever) !=
+               FuriStatusOk) {
+                continue;
+            }
+            // Stop request or notes were changed
+            if(position >= NoteBlockArray_size(instance->notes)) continue;
+
+            if(instance->callback) {
+                const NoteBlock* note_block = NoteBlockArray_cget(instance->notes, position);
+                instance->callback(
+                    note_block->semitone,
+                    note_block->dots,
+                    note_block->duration,
+                    0.0,
+                    instance->callback_context);
             }
         }
 
-        furi_hal_speaker_stop();
+        music_synth_stop(instance->synth);
         furi_hal_speaker_release();
     } else {
         FURI_LOG_E(TAG, "Speaker system is busy with another process.");
     }
 
+    furi_message_queue_reset(instance->queue);
+
     return 0;
 }
 
@@ -102,6 +131,10 @@ MusicWorker* music_worker_alloc() {
 
     NoteBlockArray_init(instance->notes);
 
+    instance->synth = music_synth_alloc();
+    music_synth_set_sequencer(instance->synth, music_worker_sequencer, instance);
+    instance->queue = furi_message_queue_alloc(NOTE_QUEUE_SIZE, sizeof(size_t));
+
     instance->thread =
         furi_thread_alloc_ex("MusicWorker", 1024, music_worker_thread_callback, instance);
 
@@ -117,6 +150,8 @@ void music_worker_clear(MusicWorker* instance) {
 void music_worker_free(MusicWorker* instance) {
     furi_assert(instance);
     furi_thread_free(instance->thread);
+    furi_message_queue_free(instance->queue);
+    music_synth_free(instance->synth);
     NoteBlockArray_clear(instance->notes);
     free(instance);
 }
@@ -498,6 +533,9 @@ void music_worker_stop(MusicWorker* instance) {
     furi_assert(instance->should_work == true);
 
     instance->should_work = false;
+    // Wake up thread waiting for next note
+    size_t stop = SIZE_MAX;
+    furi_message_queue_put(instance->queue, &stop, 0);
     furi_thread_join(instance->thread);
 }
 
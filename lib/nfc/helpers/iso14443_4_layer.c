@@ -62,3 +62,17 @@ bool iso14443_4_layer_decode_block(
 
     return ret;
 }
+
+bool iso14443_4_layer_decode_block_in_place(Iso14443_4Layer* instance, BitBuffer* block_data) {
+    furi_assert(instance);
+
+    bool ret = false;
+
+    do {
+        if(!bit_buffer_starts_with_byte(block_data, instance->pcb_prev)) break;
+        bit_buffer_trim_left(block_data, 1);
+        ret = true;
+    } while(false);
+
+    return ret;
+}
@@ -24,6 +24,8 @@ bool iso14443_4_layer_decode_block(
     BitBuffer* output_data,
     const BitBuffer* block_data);
 
+bool iso14443_4_layer_decode_block_in_place(Iso14443_4Layer* instance, BitBuffer* block_data);
+
 #ifdef __cplusplus
 }
 #endif
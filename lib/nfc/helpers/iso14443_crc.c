@@ -5,8 +5,7 @@
 #define ISO14443_3A_CRC_INIT (0x6363U)
 #define ISO14443_3B_CRC_INIT (0xFFFFU)
 
-static uint16_t
-    iso14443_crc_calculate(Iso14443CrcType type, const uint8_t* data, size_t data_size) {
+uint16_t iso14443_crc_calculate(Iso14443CrcType type, const uint8_t* data, size_t data_size) {
     uint16_t crc;
 
     if(type == Iso14443CrcTypeA) {
@@ -16,6 +16,8 @@ typedef enum {
     Iso14443CrcTypeB,
 } Iso14443CrcType;
 
+uint16_t iso14443_crc_calculate(Iso14443CrcType type, const uint8_t* data, size_t data_size);
+
 void iso14443_crc_append(Iso14443CrcType type, BitBuffer* buf);
 
 bool iso14443_crc_check(Iso14443CrcType type, const BitBuffer* buf);
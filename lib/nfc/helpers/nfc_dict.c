@@ -10,11 +10,43 @@
 
 #define TAG "NfcDict"
 
+// Filter bits per key, gives ~5% false positives with 2 hashes
+#define NFC_DICT_FILTER_BITS_PER_KEY (8)
+#define NFC_DICT_FILTER_BITS_MIN (1024)
+#define NFC_DICT_FILTER_BITS_MAX (65536)
+
+// "NFCD" as read from file
+#define NFC_DICT_PACKED_MAGIC (0x4443464EUL)
+#define NFC_DICT_PACKED_VERSION (1)
+// Keys read from packed dictionary at once
+#define NFC_DICT_PACKED_CHUNK_KEYS (64)
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t reserved;
+    // Timestamp of the text dictionary packed file was made from
+    uint32_t source_timestamp;
+} NfcDictPackedHeader;
+
 struct NfcDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     uint32_t total_keys;
+
+    // Bloom filter over keys, NULL until first lookup.
+    // Miss is definite, hit is confirmed by scanning the file.
+    uint32_t* filter;
+    uint32_t filter_mask;
+
+    // Packed dictionary read buffer, NULL for text dictionary
+    uint8_t* chunk;
+    size_t chunk_count;
+    size_t chunk_pos;
+    // Index of the key that will be read next
+    uint32_t key_index;
 };
 
 typedef struct {
@@ -57,6 +89,29 @@ NfcDict* nfc_dict_alloc(const char* path, NfcDictMode mode, size_t key_size) {
             break;
         }
 
+        // Packed dictionary is recognized by its header
+        NfcDictPackedHeader header = {};
+        if(stream_read(instance->stream, (uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+           header.magic == NFC_DICT_PACKED_MAGIC) {
+            if(header.version != NFC_DICT_PACKED_VERSION || header.key_size != key_size) {
+                FURI_LOG_E(TAG, "Unsupported packed dictionary");
+                break;
+            }
+            size_t data_size = stream_size(instance->stream) - sizeof(header);
+            if(data_size % key_size) {
+                FURI_LOG_E(TAG, "Packed dictionary is truncated");
+                break;
+            }
+            instance->total_keys = data_size / key_size;
+            instance->chunk = malloc(NFC_DICT_PACKED_CHUNK_KEYS * key_size);
+            nfc_dict_rewind(instance);
+
+            dict_loaded = true;
+            FURI_LOG_I(TAG, "Loaded packed dictionary with %lu keys", instance->total_keys);
+            break;
+        }
+        if(!stream_rewind(instance->stream)) break;
+
         // Check for new line ending
         if(!stream_eof(instance->stream)) {
             if(!stream_seek(instance->stream, -1, StreamOffsetFromEnd)) break;
@@ -108,6 +163,8 @@ void nfc_dict_free(NfcDict* instance) {
 
     buffered_file_stream_close(instance->stream);
     stream_free(instance->stream);
+    free(instance->filter);
+    free(instance->chunk);
     free(instance);
 }
 
@@ -139,9 +196,30 @@ bool nfc_dict_rewind(NfcDict* instance) {
     furi_assert(instance);
     furi_assert(instance->stream);
 
+    if(instance->chunk) {
+        instance->chunk_count = 0;
+        instance->chunk_pos = 0;
+        instance->key_index = 0;
+        return stream_seek(instance->stream, sizeof(NfcDictPackedHeader), StreamOffsetFromStart);
+    }
     return stream_rewind(instance->stream);
 }
 
+static bool nfc_dict_get_next_key_packed(NfcDict* instance, uint8_t* key) {
+    if(instance->chunk_pos == instance->chunk_count) {
+        size_t bytes_read = stream_read(
+            instance->stream, instance->chunk, NFC_DICT_PACKED_CHUNK_KEYS * instance->key_size);
+        instance->chunk_count = bytes_read / instance->key_size;
+        instance->chunk_pos = 0;
+        if(instance->chunk_count == 0) return false;
+    }
+
+    memcpy(key, &instance->chunk[instance->chunk_pos * instance->key_size], instance->key_size);
+    instance->chunk_pos++;
+    instance->key_index++;
+    return true;
+}
+
 static bool nfc_dict_get_next_key_str(NfcDict* instance, FuriString* key) {
     furi_assert(instance);
     furi_assert(instance->stream);
@@ -164,6 +242,8 @@ bool nfc_dict_get_next_key(NfcDict* instance, uint8_t* key, size_t key_size) {
     furi_assert(instance->stream);
     furi_assert(instance->key_size == key_size);
 
+    if(instance->chunk) return nfc_dict_get_next_key_packed(instance, key);
+
     FuriString* temp_key = furi_string_alloc();
     uint64_t key_int = 0;
     bool key_read = nfc_dict_get_next_key_str(instance, temp_key);
@@ -175,6 +255,57 @@ bool nfc_dict_get_next_key(NfcDict* instance, uint8_t* key, size_t key_size) {
     return key_read;
 }
 
+static void nfc_dict_filter_hash(NfcDict* instance, uint64_t key, uint32_t bits[2]) {
+    uint64_t hash = key * 0x9E3779B97F4A7C15ULL;
+    bits[0] = (uint32_t)(hash >> 32) & instance->filter_mask;
+    bits[1] = (uint32_t)(hash >> 8) & instance->filter_mask;
+}
+
+static void nfc_dict_filter_add(NfcDict* instance, uint64_t key) {
+    uint32_t bits[2];
+    nfc_dict_filter_hash(instance, key, bits);
+    for(size_t i = 0; i < COUNT_OF(bits); i++) {
+        instance->filter[bits[i] / 32] |= 1UL << (bits[i] % 32);
+    }
+}
+
+static bool nfc_dict_filter_check(NfcDict* instance, uint64_t key) {
+    uint32_t bits[2];
+    nfc_dict_filter_hash(instance, key, bits);
+    for(size_t i = 0; i < COUNT_OF(bits); i++) {
+        if(!(instance->filter[bits[i] / 32] & (1UL << (bits[i] % 32)))) return false;
+    }
+    return true;
+}
+
+static void nfc_dict_filter_build(NfcDict* instance) {
+    uint32_t filter_bits = NFC_DICT_FILTER_BITS_MIN;
+    while(filter_bits < NFC_DICT_FILTER_BITS_MAX &&
+          filter_bits < instance->total_keys * NFC_DICT_FILTER_BITS_PER_KEY) {
+        filter_bits <<= 1;
+    }
+    instance->filter = malloc(filter_bits / 8);
+    instance->filter_mask = filter_bits - 1;
+
+    uint8_t key[sizeof(uint64_t)];
+    nfc_dict_rewind(instance);
+    while(nfc_dict_get_next_key(instance, key, instance->key_size)) {
+        nfc_dict_filter_add(instance, nfc_util_bytes2num(key, instance->key_size));
+    }
+    nfc_dict_rewind(instance);
+
+    FURI_LOG_D(TAG, "Built %lu bit filter", filter_bits);
+}
+
+/** Check key against filter, building it on first use
+ *
+ * @return false if key is definitely not present
+ */
+static bool nfc_dict_filter_may_contain(NfcDict* instance, const uint8_t* key) {
+    if(!instance->filter) nfc_dict_filter_build(instance);
+    return nfc_dict_filter_check(instance, nfc_util_bytes2num(key, instance->key_size));
+}
+
 static bool nfc_dict_is_key_present_str(NfcDict* instance, FuriString* key) {
     furi_assert(instance);
     furi_assert(instance->stream);
@@ -203,6 +334,17 @@ bool nfc_dict_is_key_present(NfcDict* instance, const uint8_t* key, size_t key_s
     furi_assert(instance->stream);
     furi_assert(instance->key_size == key_size);
 
+    if(!nfc_dict_filter_may_contain(instance, key)) return false;
+
+    if(instance->chunk) {
+        uint8_t temp_key[sizeof(uint64_t)];
+        nfc_dict_rewind(instance);
+        while(nfc_dict_get_next_key_packed(instance, temp_key)) {
+            if(memcmp(temp_key, key, key_size) == 0) return true;
+        }
+        return false;
+    }
+
     FuriString* temp_key = furi_string_alloc();
     nfc_dict_int_to_str(instance, key, temp_key);
     bool key_found = nfc_dict_is_key_present_str(instance, temp_key);
@@ -235,10 +377,27 @@ bool nfc_dict_add_key(NfcDict* instance, const uint8_t* key, size_t key_size) {
     furi_assert(instance->stream);
     furi_assert(instance->key_size == key_size);
 
-    FuriString* temp_key = furi_string_alloc();
-    nfc_dict_int_to_str(instance, key, temp_key);
-    bool key_added = nfc_dict_add_key_str(instance, temp_key);
-    furi_string_free(temp_key);
+    bool key_added = false;
+    if(instance->chunk) {
+        // Position is at the end now, same as for text dictionary
+        instance->chunk_count = 0;
+        instance->chunk_pos = 0;
+        instance->key_index = instance->total_keys;
+        if(stream_seek(instance->stream, 0, StreamOffsetFromEnd) &&
+           stream_write(instance->stream, key, key_size) == key_size) {
+            instance->total_keys++;
+            key_added = true;
+        }
+    } else {
+        FuriString* temp_key = furi_string_alloc();
+        nfc_dict_int_to_str(instance, key, temp_key);
+        key_added = nfc_dict_add_key_str(instance, temp_key);
+        furi_string_free(temp_key);
+    }
+
+    if(key_added && instance->filter) {
+        nfc_dict_filter_add(instance, nfc_util_bytes2num(key, key_size));
+    }
 
     return key_added;
 }
@@ -249,6 +408,9 @@ bool nfc_dict_delete_key(NfcDict* instance, const uint8_t* key, size_t key_size)
     furi_assert(key);
     furi_assert(instance->key_size == key_size);
 
+    // Deleted keys stay in filter, they only cost a confirming scan
+    if(!nfc_dict_filter_may_contain(instance, key)) return false;
+
     bool key_removed = false;
     uint8_t* temp_key = malloc(key_size);
 
@@ -256,9 +418,17 @@ bool nfc_dict_delete_key(NfcDict* instance, const uint8_t* key, size_t key_size)
     while(!key_removed) {
         if(!nfc_dict_get_next_key(instance, temp_key, key_size)) break;
         if(memcmp(temp_key, key, key_size) == 0) {
-            int32_t offset = (-1) * (instance->key_size_symbols);
-            stream_seek(instance->stream, offset, StreamOffsetFromCurrent);
-            if(!stream_delete(instance->stream, instance->key_size_symbols)) break;
+            if(instance->chunk) {
+                // Stream is ahead of the key by the rest of the chunk
+                size_t offset =
+                    sizeof(NfcDictPackedHeader) + (instance->key_index - 1) * key_size;
+                stream_seek(instance->stream, offset, StreamOffsetFromStart);
+                if(!stream_delete(instance->stream, key_size)) break;
+            } else {
+                int32_t offset = (-1) * (instance->key_size_symbols);
+                stream_seek(instance->stream, offset, StreamOffsetFromCurrent);
+                if(!stream_delete(instance->stream, instance->key_size_symbols)) break;
+            }
             instance->total_keys--;
             key_removed = true;
         }
@@ -268,3 +438,116 @@ bool nfc_dict_delete_key(NfcDict* instance, const uint8_t* key, size_t key_size)
 
     return key_removed;
 }
+
+static bool nfc_dict_packed_is_up_to_date(
+    Storage* storage,
+    const char* packed_path,
+    size_t key_size,
+    uint32_t source_timestamp) {
+    File* file = storage_file_alloc(storage);
+    NfcDictPackedHeader header = {};
+
+    bool up_to_date = false;
+    if(storage_file_open(file, packed_path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+       storage_file_read(file, &header, sizeof(header)) == sizeof(header)) {
+        up_to_date = header.magic == NFC_DICT_PACKED_MAGIC &&
+                     header.version == NFC_DICT_PACKED_VERSION &&
+                     header.key_size == key_size &&
+                     header.source_timestamp == source_timestamp;
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    return up_to_date;
+}
+
+static bool nfc_dict_packed_write(
+    Storage* storage,
+    NfcDict* dict,
+    const char* packed_path,
+    uint32_t source_timestamp,
+    size_t record_size,
+    NfcDictPackedRecordCallback callback,
+    void* context) {
+    File* file = storage_file_alloc(storage);
+    uint8_t* chunk = malloc(NFC_DICT_PACKED_CHUNK_KEYS * record_size);
+
+    bool packed = false;
+    do {
+        if(!storage_file_open(file, packed_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+
+        NfcDictPackedHeader header = {
+            .magic = NFC_DICT_PACKED_MAGIC,
+            .version = NFC_DICT_PACKED_VERSION,
+            .key_size = record_size,
+            .source_timestamp = source_timestamp,
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        size_t count = 0;
+        nfc_dict_rewind(dict);
+        while(true) {
+            uint8_t* record = &chunk[count * record_size];
+            bool key_read = nfc_dict_get_next_key(dict, record, dict->key_size);
+            if(key_read) {
+                if(callback) callback(record, record, context);
+                count++;
+            }
+            if(count == NFC_DICT_PACKED_CHUNK_KEYS || (!key_read && count)) {
+                size_t chunk_size = count * record_size;
+                if(storage_file_write(file, chunk, chunk_size) != chunk_size) break;
+                count = 0;
+            }
+            if(!key_read) {
+                packed = true;
+                break;
+            }
+        }
+    } while(false);
+
+    storage_file_close(file);
+    free(chunk);
+    storage_file_free(file);
+    return packed;
+}
+
+bool nfc_dict_update_packed(const char* path, const char* packed_path, size_t key_size) {
+    return nfc_dict_update_packed_ex(path, packed_path, key_size, key_size, NULL, NULL);
+}
+
+bool nfc_dict_update_packed_ex(
+    const char* path,
+    const char* packed_path,
+    size_t key_size,
+    size_t record_size,
+    NfcDictPackedRecordCallback callback,
+    void* context) {
+    furi_assert(path);
+    furi_assert(packed_path);
+    furi_assert(record_size >= key_size);
+    furi_assert(record_size <= UINT8_MAX);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    bool packed = false;
+    do {
+        uint32_t timestamp = 0;
+        if(storage_common_timestamp(storage, path, &timestamp) != FSE_OK) break;
+
+        packed = nfc_dict_packed_is_up_to_date(storage, packed_path, record_size, timestamp);
+        if(packed) break;
+
+        NfcDict* dict = nfc_dict_alloc(path, NfcDictModeOpenExisting, key_size);
+        if(!dict) break;
+        packed = nfc_dict_packed_write(
+            storage, dict, packed_path, timestamp, record_size, callback, context);
+        FURI_LOG_I(TAG, "Packed %lu keys to %s", nfc_dict_get_total_keys(dict), packed_path);
+        nfc_dict_free(dict);
+
+        if(!packed) storage_simply_remove(storage, packed_path);
+    } while(false);
+
+    furi_record_close(RECORD_STORAGE);
+
+    return packed;
+}
@@ -57,6 +57,8 @@ uint32_t nfc_dict_get_total_keys(NfcDict* instance);
 bool nfc_dict_rewind(NfcDict* instance);
 
 /** Check if key is present in dictionary
+ * First call builds in-memory key filter, so absent keys are rejected without
+ * reading the file. Stream position is undefined after this call.
  *
  * @param instance  - NfcDict dictionary instance
  * @param key       - key to check
@@ -98,6 +100,51 @@ bool nfc_dict_add_key(NfcDict* instance, const uint8_t* key, size_t key_size);
 */
 bool nfc_dict_delete_key(NfcDict* instance, const uint8_t* key, size_t key_size);
 
+/** Make packed binary copy of text dictionary
+ * Packed dictionary stores raw keys after a header and can be opened with
+ * nfc_dict_alloc() like a text one, but keys are read without parsing.
+ * Copy is only rewritten if it is missing or was made from another version
+ * of the text dictionary.
+ *
+ * @param path          - text dictionary path
+ * @param packed_path   - packed dictionary path
+ * @param key_size      - size of key in bytes
+ *
+ * @return true if packed dictionary is up to date, false otherwise
+*/
+bool nfc_dict_update_packed(const char* path, const char* packed_path, size_t key_size);
+
+/** Packed record callback, makes record from text dictionary key
+ *
+ * @param key       - key read from text dictionary
+ * @param record    - record to fill, starts with key copy
+ * @param context   - callback context
+*/
+typedef void (*NfcDictPackedRecordCallback)(const uint8_t* key, uint8_t* record, void* context);
+
+/** Make packed binary copy of text dictionary with data computed for each key
+ * Same as nfc_dict_update_packed(), but each key is stored in a record of
+ * record_size bytes, that starts with the key and is followed by data filled
+ * by callback. Opened with nfc_dict_alloc() records are read as keys of
+ * record_size. Use it to keep per key precomputations out of attack loops.
+ *
+ * @param path          - text dictionary path
+ * @param packed_path   - packed dictionary path
+ * @param key_size      - size of key in bytes
+ * @param record_size   - size of record in bytes, no less than key_size, up to 255
+ * @param callback      - record callback, called for each key
+ * @param context       - callback context
+ *
+ * @return true if packed dictionary is up to date, false otherwise
+*/
+bool nfc_dict_update_packed_ex(
+    const char* path,
+    const char* packed_path,
+    size_t key_size,
+    size_t record_size,
+    NfcDictPackedRecordCallback callback,
+    void* context);
+
 #ifdef __cplusplus
 }
 #endif
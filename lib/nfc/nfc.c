@@ -144,7 +144,9 @@ static int32_t nfc_worker_listener(void* context) {
             furi_hal_nfc_listener_rx(
                 instance->rx_buffer, sizeof(instance->rx_buffer), &instance->rx_bits);
             bit_buffer_copy_bits(event_data.buffer, instance->rx_buffer, instance->rx_bits);
+            FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointCallbackStart, nfc_event.type);
             command = instance->callback(nfc_event, instance->context);
+            FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointCallbackEnd, command);
             if(command == NfcCommandStop) {
                 break;
             } else if(command == NfcCommandReset) {
@@ -179,7 +181,9 @@ bool nfc_worker_poller_ready_handler(Nfc* instance) {
     NfcCommand command = NfcCommandContinue;
 
     NfcEvent event = {.type = NfcEventTypePollerReady};
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointCallbackStart, event.type);
     command = instance->callback(event, instance->context);
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointCallbackEnd, command);
     if(command == NfcCommandReset) {
         instance->poller_state = NfcPollerStateReset;
     } else if(command == NfcCommandStop) {
@@ -646,4 +650,15 @@ NfcError nfc_iso15693_listener_tx_sof(Nfc* instance) {
     return ret;
 }
 
+NfcError nfc_iso15693_listener_cache_frame(Nfc* instance, const BitBuffer* tx_buffer) {
+    furi_assert(instance);
+    furi_assert(tx_buffer);
+
+    FuriHalNfcError error = furi_hal_nfc_iso15693_listener_cache_frame(
+        bit_buffer_get_data(tx_buffer), bit_buffer_get_size(tx_buffer));
+    NfcError ret = nfc_process_hal_error(error);
+
+    return ret;
+}
+
 #endif // APP_UNIT_TESTS
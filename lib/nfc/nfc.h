@@ -359,6 +359,17 @@ NfcError nfc_iso14443a_listener_set_col_res_data(
  */
 NfcError nfc_iso15693_listener_tx_sof(Nfc* instance);
 
+/**
+ * @brief Precompile ISO15693 response frame, so that sending it later takes no time
+ *
+ * Must be called after the instance was configured in listener mode.
+ *
+ * @param[in,out] instance pointer to the instance to be used.
+ * @param[in] tx_buffer pointer to the response frame, CRC included.
+ * @returns NfcErrorNone on success, any other error code on failure.
+ */
+NfcError nfc_iso15693_listener_cache_frame(Nfc* instance, const BitBuffer* tx_buffer);
+
 #ifdef __cplusplus
 }
 #endif
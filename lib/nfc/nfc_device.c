@@ -5,6 +5,7 @@
 
 #include "nfc_common.h"
 #include "protocols/nfc_device_defs.h"
+#include "protocols/mf_classic/mf_classic.h"
 
 #define NFC_FILE_HEADER "Flipper NFC device"
 #define NFC_DEV_TYPE_ERROR "Protocol type mismatch"
@@ -14,6 +15,32 @@
 
 #define NFC_DEVICE_UID_MAX_LEN (10U)
 
+#define NFC_DEVICE_CACHE_EXTENSION ".bin"
+#define NFC_DEVICE_CACHE_MAGIC (0x4E464342U) // "NFCB"
+#define NFC_DEVICE_CACHE_VERSION (1U)
+
+/**
+ * Binary companion of a .nfc file, written next to it after the first successful load.
+ * Cache is valid only while timestamp and size of the source file match.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t timestamp;
+    uint32_t protocol;
+    uint64_t source_size;
+    uint32_t data_size;
+} NfcDeviceCacheHeader;
+
+typedef struct {
+    Iso14443_3aData iso14443_3a_data;
+    MfClassicType type;
+    uint32_t block_read_mask[MF_CLASSIC_READ_MASK_SIZE];
+    uint64_t key_a_mask;
+    uint64_t key_b_mask;
+    MfClassicBlock block[MF_CLASSIC_TOTAL_BLOCKS_MAX];
+} NfcDeviceCacheMfClassic;
+
 NfcDevice* nfc_device_alloc() {
     NfcDevice* instance = malloc(sizeof(NfcDevice));
     instance->protocol = NfcProtocolInvalid;
@@ -147,6 +174,129 @@ void nfc_device_set_loading_callback(
     instance->loading_callback_context = context;
 }
 
+static bool nfc_device_cache_is_supported(NfcProtocol protocol) {
+    // Only protocols with flat data, DESFire and others with dynamic arrays are parsed as usual
+    return protocol == NfcProtocolMfClassic;
+}
+
+static bool nfc_device_cache_get_header(
+    Storage* storage,
+    const char* path,
+    NfcProtocol protocol,
+    NfcDeviceCacheHeader* header) {
+    bool header_ready = false;
+    // Header is compared as a whole, padding must be deterministic
+    memset(header, 0, sizeof(NfcDeviceCacheHeader));
+
+    do {
+        FileInfo file_info;
+        if(storage_common_stat(storage, path, &file_info) != FSE_OK) break;
+        uint32_t timestamp = 0;
+        if(storage_common_timestamp(storage, path, &timestamp) != FSE_OK) break;
+
+        header->magic = NFC_DEVICE_CACHE_MAGIC;
+        header->version = NFC_DEVICE_CACHE_VERSION;
+        header->timestamp = timestamp;
+        header->protocol = protocol;
+        header->source_size = file_info.size;
+        header->data_size = sizeof(NfcDeviceCacheMfClassic);
+
+        header_ready = true;
+    } while(false);
+
+    return header_ready;
+}
+
+static void nfc_device_cache_remove(Storage* storage, const char* path) {
+    FuriString* cache_path = furi_string_alloc_printf("%s%s", path, NFC_DEVICE_CACHE_EXTENSION);
+    storage_simply_remove(storage, furi_string_get_cstr(cache_path));
+    furi_string_free(cache_path);
+}
+
+static void nfc_device_cache_save(NfcDevice* instance, Storage* storage, const char* path) {
+    if(!nfc_device_cache_is_supported(instance->protocol)) return;
+
+    FuriString* cache_path = furi_string_alloc_printf("%s%s", path, NFC_DEVICE_CACHE_EXTENSION);
+    File* file = storage_file_alloc(storage);
+    NfcDeviceCacheMfClassic* cache = malloc(sizeof(NfcDeviceCacheMfClassic));
+    bool saved = false;
+
+    do {
+        NfcDeviceCacheHeader header;
+        if(!nfc_device_cache_get_header(storage, path, instance->protocol, &header)) break;
+
+        const MfClassicData* data = instance->protocol_data;
+        cache->iso14443_3a_data = *data->iso14443_3a_data;
+        cache->type = data->type;
+        memcpy(cache->block_read_mask, data->block_read_mask, sizeof(data->block_read_mask));
+        cache->key_a_mask = data->key_a_mask;
+        cache->key_b_mask = data->key_b_mask;
+        memcpy(cache->block, data->block, sizeof(data->block));
+
+        const char* cache_path_str = furi_string_get_cstr(cache_path);
+        if(!storage_file_open(file, cache_path_str, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write(file, cache, sizeof(*cache)) != sizeof(*cache)) break;
+
+        saved = true;
+    } while(false);
+
+    storage_file_close(file);
+    if(!saved) {
+        storage_simply_remove(storage, furi_string_get_cstr(cache_path));
+    }
+
+    free(cache);
+    storage_file_free(file);
+    furi_string_free(cache_path);
+}
+
+static bool nfc_device_cache_load(NfcDevice* instance, Storage* storage, const char* path) {
+    FuriString* cache_path = furi_string_alloc_printf("%s%s", path, NFC_DEVICE_CACHE_EXTENSION);
+    File* file = storage_file_alloc(storage);
+    NfcDeviceCacheMfClassic* cache = NULL;
+    bool loaded = false;
+
+    do {
+        const char* cache_path_str = furi_string_get_cstr(cache_path);
+        if(!storage_file_open(file, cache_path_str, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        NfcDeviceCacheHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.protocol >= NfcProtocolNum) break;
+        if(!nfc_device_cache_is_supported(header.protocol)) break;
+
+        NfcDeviceCacheHeader expected;
+        if(!nfc_device_cache_get_header(storage, path, header.protocol, &expected)) break;
+        if(memcmp(&header, &expected, sizeof(header)) != 0) break;
+
+        cache = malloc(sizeof(NfcDeviceCacheMfClassic));
+        if(storage_file_read(file, cache, sizeof(*cache)) != sizeof(*cache)) break;
+        if(cache->type >= MfClassicTypeNum) break;
+
+        nfc_device_clear(instance);
+        instance->protocol = header.protocol;
+        instance->protocol_data = nfc_devices[header.protocol]->alloc();
+
+        MfClassicData* data = instance->protocol_data;
+        *data->iso14443_3a_data = cache->iso14443_3a_data;
+        data->type = cache->type;
+        memcpy(data->block_read_mask, cache->block_read_mask, sizeof(data->block_read_mask));
+        data->key_a_mask = cache->key_a_mask;
+        data->key_b_mask = cache->key_b_mask;
+        memcpy(data->block, cache->block, sizeof(data->block));
+
+        loaded = true;
+    } while(false);
+
+    if(cache) free(cache);
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_string_free(cache_path);
+
+    return loaded;
+}
+
 bool nfc_device_save(NfcDevice* instance, const char* path) {
     furi_assert(instance);
     furi_assert(instance->protocol < NfcProtocolNum);
@@ -161,6 +311,9 @@ bool nfc_device_save(NfcDevice* instance, const char* path) {
         instance->loading_callback(instance->loading_callback_context, true);
     }
 
+    // Cache is keyed by timestamp, which may not change within the same second
+    nfc_device_cache_remove(storage, path);
+
     do {
         // Open file
         if(!flipper_format_buffered_file_open_always(ff, path)) break;
@@ -328,7 +481,14 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
     }
 
     do {
+        if(nfc_device_cache_load(instance, storage, path)) {
+            loaded = true;
+            break;
+        }
+
         if(!flipper_format_buffered_file_open_existing(ff, path)) break;
+        // Protocol loaders look keys up out of order, index saves full file scans
+        flipper_format_build_index(ff);
 
         // Read and verify file header
         uint32_t version = 0;
@@ -342,6 +502,10 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
                      nfc_device_load_legacy(instance, ff, version) :
                      nfc_device_load_unified(instance, ff, version);
 
+        if(loaded) {
+            flipper_format_buffered_file_close(ff);
+            nfc_device_cache_save(instance, storage, path);
+        }
     } while(false);
 
     if(instance->loading_callback) {
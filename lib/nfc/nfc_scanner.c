@@ -2,6 +2,7 @@
 #include "nfc_poller.h"
 
 #include <nfc/protocols/nfc_poller_defs.h>
+#include <nfc/protocols/iso14443_3a/iso14443_3a.h>
 
 #include <furi/furi.h>
 
@@ -23,6 +24,12 @@ typedef enum {
     NfcScannerSessionStateStopRequest,
 } NfcScannerSessionState;
 
+typedef enum {
+    NfcScannerProbeRequired, /**< Protocol must be detected by polling the card. */
+    NfcScannerProbeDetected, /**< Protocol is detected from anticollision data. */
+    NfcScannerProbeSkipped, /**< Protocol can't be present, polling is skipped. */
+} NfcScannerProbe;
+
 struct NfcScanner {
     Nfc* nfc;
     NfcScannerState state;
@@ -51,6 +58,11 @@ struct NfcScanner {
 
     NfcProtocol current_protocol;
 
+    // ISO14443-3A anticollision result, shared by all ISO14443-3A children
+    bool iso14443_3a_data_valid;
+    bool iso14443_3a_exclusive_detected;
+    Iso14443_3aData* iso14443_3a_data;
+
     FuriThread* scan_worker;
 };
 
@@ -65,6 +77,76 @@ static void nfc_scanner_reset(NfcScanner* instance) {
     instance->detected_base_protocols_num = 0;
 
     instance->current_protocol = 0;
+
+    instance->iso14443_3a_data_valid = false;
+    instance->iso14443_3a_exclusive_detected = false;
+}
+
+// MfUltralight and MfClassic answer the same anticollision with mutually exclusive commands
+static bool nfc_scanner_is_iso14443_3a_exclusive(NfcProtocol protocol) {
+    return (protocol == NfcProtocolMfUltralight) || (protocol == NfcProtocolMfClassic);
+}
+
+static NfcScannerProbe nfc_scanner_get_probe(NfcScanner* instance, NfcProtocol protocol) {
+    NfcScannerProbe probe = NfcScannerProbeRequired;
+
+    do {
+        if(!instance->iso14443_3a_data_valid) break;
+        if(!nfc_protocol_has_parent(protocol, NfcProtocolIso14443_3a)) break;
+
+        // ISO14443-4A poller detects the protocol by SAK only, no need to restart the field
+        bool iso14443_4_supported = iso14443_3a_supports_iso14443_4(instance->iso14443_3a_data);
+        if(protocol == NfcProtocolIso14443_4a) {
+            probe = iso14443_4_supported ? NfcScannerProbeDetected : NfcScannerProbeSkipped;
+        } else if(nfc_protocol_has_parent(protocol, NfcProtocolIso14443_4a)) {
+            if(!iso14443_4_supported) probe = NfcScannerProbeSkipped;
+        } else if(nfc_scanner_is_iso14443_3a_exclusive(protocol)) {
+            if(instance->iso14443_3a_exclusive_detected) probe = NfcScannerProbeSkipped;
+        }
+    } while(false);
+
+    return probe;
+}
+
+static uint8_t nfc_scanner_get_probe_rank(NfcScanner* instance, NfcProtocol protocol) {
+    // Lower rank is probed first
+    uint8_t rank = 2;
+
+    do {
+        if(!instance->iso14443_3a_data_valid) break;
+        if(!nfc_protocol_has_parent(protocol, NfcProtocolIso14443_3a)) break;
+
+        uint8_t sak = iso14443_3a_get_sak(instance->iso14443_3a_data);
+        if(nfc_scanner_get_probe(instance, protocol) != NfcScannerProbeRequired) {
+            rank = 0;
+        } else if(protocol == NfcProtocolMfUltralight) {
+            rank = (sak == 0x00) ? 1 : 3;
+        } else if(protocol == NfcProtocolMfClassic) {
+            rank = (sak & 0x09) ? 1 : 3;
+        }
+    } while(false);
+
+    return rank;
+}
+
+static void nfc_scanner_sort_children_protocols(NfcScanner* instance) {
+    uint8_t ranks[NfcProtocolNum];
+    for(size_t i = 0; i < instance->children_protocols_num; i++) {
+        ranks[i] = nfc_scanner_get_probe_rank(instance, instance->children_protocols[i]);
+    }
+
+    // Stable insertion sort, protocol tree order is kept within the same rank
+    for(size_t i = 1; i < instance->children_protocols_num; i++) {
+        NfcProtocol protocol = instance->children_protocols[i];
+        uint8_t rank = ranks[i];
+        size_t j = i;
+        for(; j > 0 && ranks[j - 1] > rank; j--) {
+            instance->children_protocols[j] = instance->children_protocols[j - 1];
+            ranks[j] = ranks[j - 1];
+        }
+        instance->children_protocols[j] = protocol;
+        ranks[j] = rank;
+    }
 }
 
 typedef void (*NfcScannerStateHandler)(NfcScanner* instance);
@@ -94,6 +176,10 @@ void nfc_scanner_state_handler_try_base_pollers(NfcScanner* instance) {
 
         NfcPoller* poller = nfc_poller_alloc(instance->nfc, instance->current_protocol);
         bool protocol_detected = nfc_poller_detect(poller);
+        if(protocol_detected && (instance->current_protocol == NfcProtocolIso14443_3a)) {
+            iso14443_3a_copy(instance->iso14443_3a_data, nfc_poller_get_data(poller));
+            instance->iso14443_3a_data_valid = true;
+        }
         nfc_poller_free(poller);
 
         if(protocol_detected) {
@@ -127,6 +213,7 @@ void nfc_scanner_state_handler_find_children_protocols(NfcScanner* instance) {
     }
 
     if(instance->children_protocols_num > 0) {
+        nfc_scanner_sort_children_protocols(instance);
         instance->state = NfcScannerStateDetectChildrenProtocols;
     } else {
         instance->state = NfcScannerStateComplete;
@@ -139,14 +226,23 @@ void nfc_scanner_state_handler_detect_children_protocols(NfcScanner* instance) {
 
     instance->current_protocol = instance->children_protocols[instance->children_protocols_idx];
 
-    NfcPoller* poller = nfc_poller_alloc(instance->nfc, instance->current_protocol);
-    bool protocol_detected = nfc_poller_detect(poller);
-    nfc_poller_free(poller);
+    NfcScannerProbe probe = nfc_scanner_get_probe(instance, instance->current_protocol);
+    bool protocol_detected = (probe == NfcScannerProbeDetected);
+
+    if(probe == NfcScannerProbeRequired) {
+        NfcPoller* poller = nfc_poller_alloc(instance->nfc, instance->current_protocol);
+        protocol_detected = nfc_poller_detect(poller);
+        nfc_poller_free(poller);
+    }
 
     if(protocol_detected) {
         instance->detected_protocols[instance->detected_protocols_num] =
             instance->current_protocol;
         instance->detected_protocols_num++;
+
+        if(nfc_scanner_is_iso14443_3a_exclusive(instance->current_protocol)) {
+            instance->iso14443_3a_exclusive_detected = true;
+        }
     }
 
     instance->children_protocols_idx++;
@@ -222,6 +318,7 @@ NfcScanner* nfc_scanner_alloc(Nfc* nfc) {
 
     NfcScanner* instance = malloc(sizeof(NfcScanner));
     instance->nfc = nfc;
+    instance->iso14443_3a_data = iso14443_3a_alloc();
 
     return instance;
 }
@@ -229,6 +326,7 @@ NfcScanner* nfc_scanner_alloc(Nfc* nfc) {
 void nfc_scanner_free(NfcScanner* instance) {
     furi_assert(instance);
 
+    iso14443_3a_free(instance->iso14443_3a_data);
     free(instance);
 }
 
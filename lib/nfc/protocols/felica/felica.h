@@ -9,6 +9,7 @@ extern "C" {
 
 #define FELICA_IDM_SIZE (8U)
 #define FELICA_PMM_SIZE (8U)
+#define FELICA_BLOCK_SIZE (16U)
 
 #define FELICA_GUARD_TIME_US (20000U)
 #define FELICA_FDT_POLL_FC (10000U)
@@ -46,6 +47,10 @@ typedef struct {
     FelicaPMm pmm;
 } FelicaData;
 
+typedef struct {
+    uint8_t data[FELICA_BLOCK_SIZE];
+} FelicaBlock;
+
 extern const NfcDeviceBase nfc_device_felica;
 
 FelicaData* felica_alloc();
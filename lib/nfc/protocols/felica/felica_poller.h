@@ -53,6 +53,58 @@ typedef struct {
  */
 FelicaError felica_poller_activate(FelicaPoller* instance, FelicaData* data);
 
+/**
+ * @brief Get codes of the systems present on the card.
+ *
+ * Must ONLY be used inside the callback function.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[out] system_codes pointer to the array to be filled with system codes.
+ * @param[in, out] count system_codes array size on input, system count on output.
+ * @return FelicaErrorNone on success, an error code on failure.
+ */
+FelicaError felica_poller_request_system_codes(
+    FelicaPoller* instance,
+    uint16_t* system_codes,
+    size_t* count);
+
+/**
+ * @brief Make following commands address another system of the card.
+ *
+ * Must ONLY be used inside the callback function.
+ *
+ * Each system has its own IDm, so the card is polled with the system code.
+ * The card data is not changed, the IDm is only used for following reads.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[in] system_code code of the system to be selected.
+ * @return FelicaErrorNone on success, an error code on failure.
+ */
+FelicaError felica_poller_select_system(FelicaPoller* instance, uint16_t system_code);
+
+/**
+ * @brief Read blocks of a service without encryption.
+ *
+ * Must ONLY be used inside the callback function.
+ *
+ * Blocks are requested in batches as large as the card accepts, the limit is
+ * found out by the first reads and kept for the rest of the session, so
+ * walking several services takes as few commands as possible.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[in] service_code code of the service to be read.
+ * @param[in] block_start number of the first block to be read.
+ * @param[in] block_count number of blocks to be read.
+ * @param[out] blocks pointer to the array of at least block_count blocks.
+ * @return FelicaErrorNone on success, an error code on failure.
+ */
+FelicaError felica_poller_read_blocks(
+    FelicaPoller* instance,
+    uint16_t service_code,
+    uint16_t block_start,
+    uint16_t block_count,
+    FelicaBlock* blocks);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,8 @@
 
 #include <nfc/helpers/felica_crc.h>
 
+#include <furi.h>
+
 #define TAG "FelicaPoller"
 
 static FelicaError felica_poller_process_error(NfcError error) {
@@ -121,8 +123,214 @@ FelicaError felica_poller_activate(FelicaPoller* instance, FelicaData* data) {
 
         data->idm = polling_resp.idm;
         data->pmm = polling_resp.pmm;
+        instance->system_idm = polling_resp.idm;
+        instance->read_blocks_max = FELICA_POLLER_READ_BLOCKS_MAX;
         instance->state = FelicaPollerStateActivated;
     } while(false);
 
     return ret;
 }
+
+// Maximum response time as announced in PMm: 256 * 16 / fc * ((B + 1) * n + A + 1) * 4 ^ E
+static uint32_t felica_poller_get_fwt(FelicaPoller* instance, size_t pmm_index, size_t count) {
+    const uint8_t param = instance->data->pmm.data[pmm_index];
+    const uint32_t a = param & 0x07;
+    const uint32_t b = (param >> 3) & 0x07;
+    const uint32_t e = param >> 6;
+
+    return ((256U * 16U) * ((b + 1) * count + a + 1) << (2 * e)) + FELICA_FDT_POLL_FC;
+}
+
+static void felica_poller_prepare_command(FelicaPoller* instance, uint8_t command) {
+    bit_buffer_reset(instance->tx_buffer);
+    // Frame length is set when the frame is complete
+    bit_buffer_append_byte(instance->tx_buffer, 0);
+    bit_buffer_append_byte(instance->tx_buffer, command);
+    bit_buffer_append_bytes(instance->tx_buffer, instance->system_idm.data, sizeof(FelicaIDm));
+}
+
+static FelicaError
+    felica_poller_send_command(FelicaPoller* instance, uint8_t response_code, uint32_t fwt) {
+    bit_buffer_set_byte(
+        instance->tx_buffer, 0, bit_buffer_get_size_bytes(instance->tx_buffer) + FELICA_CRC_SIZE);
+
+    FelicaError error =
+        felica_poller_frame_exchange(instance, instance->tx_buffer, instance->rx_buffer, fwt);
+
+    do {
+        if(error != FelicaErrorNone) break;
+
+        // Length, response code and IDm
+        if(bit_buffer_get_size_bytes(instance->rx_buffer) < 2 + sizeof(FelicaIDm) ||
+           bit_buffer_get_byte(instance->rx_buffer, 1) != response_code) {
+            error = FelicaErrorProtocol;
+            break;
+        }
+        const uint8_t* idm = bit_buffer_get_data(instance->rx_buffer) + 2;
+        if(memcmp(idm, instance->system_idm.data, sizeof(FelicaIDm)) != 0) {
+            error = FelicaErrorProtocol;
+        }
+    } while(false);
+
+    return error;
+}
+
+FelicaError felica_poller_request_system_codes(
+    FelicaPoller* instance,
+    uint16_t* system_codes,
+    size_t* count) {
+    furi_assert(instance);
+    furi_assert(system_codes);
+    furi_assert(count);
+
+    felica_poller_prepare_command(instance, FELICA_POLLER_CMD_REQUEST_SYSTEM_CODE_REQ_CODE);
+
+    FelicaError error = felica_poller_send_command(
+        instance,
+        FELICA_POLLER_CMD_REQUEST_SYSTEM_CODE_RESP_CODE,
+        felica_poller_get_fwt(instance, FELICA_POLLER_PMM_OTHER_TIMEOUT_INDEX, 0));
+
+    do {
+        if(error != FelicaErrorNone) break;
+
+        const size_t header_size = 2 + sizeof(FelicaIDm);
+        const size_t rx_size = bit_buffer_get_size_bytes(instance->rx_buffer);
+        if(rx_size < header_size + 1) {
+            error = FelicaErrorProtocol;
+            break;
+        }
+
+        const size_t system_count = bit_buffer_get_byte(instance->rx_buffer, header_size);
+        if(rx_size < header_size + 1 + system_count * sizeof(uint16_t)) {
+            error = FelicaErrorProtocol;
+            break;
+        }
+
+        *count = MIN(*count, system_count);
+        for(size_t i = 0; i < *count; i++) {
+            const size_t offset = header_size + 1 + i * sizeof(uint16_t);
+            // System codes are big endian, unlike service codes
+            system_codes[i] = (bit_buffer_get_byte(instance->rx_buffer, offset) << 8) |
+                              bit_buffer_get_byte(instance->rx_buffer, offset + 1);
+        }
+    } while(false);
+
+    return error;
+}
+
+FelicaError felica_poller_select_system(FelicaPoller* instance, uint16_t system_code) {
+    furi_assert(instance);
+
+    // Sent as is, system code goes big endian on the wire
+    const FelicaPollerPollingCommand polling_cmd = {
+        .system_code = (uint16_t)((system_code >> 8) | (system_code << 8)),
+        .request_code = 0,
+        .time_slot = FELICA_TIME_SLOT_1,
+    };
+    FelicaPollerPollingResponse polling_resp = {};
+
+    FelicaError error = felica_poller_polling(instance, &polling_cmd, &polling_resp);
+    if(error == FelicaErrorNone) {
+        instance->system_idm = polling_resp.idm;
+    }
+
+    return error;
+}
+
+static FelicaError felica_poller_read_batch(
+    FelicaPoller* instance,
+    uint16_t service_code,
+    uint16_t block_start,
+    uint8_t block_count,
+    FelicaBlock* blocks) {
+    felica_poller_prepare_command(instance, FELICA_POLLER_CMD_READ_REQ_CODE);
+
+    // Single service, little endian code
+    bit_buffer_append_byte(instance->tx_buffer, 1);
+    bit_buffer_append_byte(instance->tx_buffer, service_code & 0xFF);
+    bit_buffer_append_byte(instance->tx_buffer, service_code >> 8);
+
+    bit_buffer_append_byte(instance->tx_buffer, block_count);
+    for(uint8_t i = 0; i < block_count; i++) {
+        const uint16_t block = block_start + i;
+        if(block <= UINT8_MAX) {
+            // Two byte element: length flag and service index 0, block number
+            bit_buffer_append_byte(instance->tx_buffer, 0x80);
+            bit_buffer_append_byte(instance->tx_buffer, block);
+        } else {
+            bit_buffer_append_byte(instance->tx_buffer, 0x00);
+            bit_buffer_append_byte(instance->tx_buffer, block & 0xFF);
+            bit_buffer_append_byte(instance->tx_buffer, block >> 8);
+        }
+    }
+
+    FelicaError error = felica_poller_send_command(
+        instance,
+        FELICA_POLLER_CMD_READ_RESP_CODE,
+        felica_poller_get_fwt(instance, FELICA_POLLER_PMM_READ_TIMEOUT_INDEX, block_count));
+
+    do {
+        if(error != FelicaErrorNone) break;
+
+        // Header, status flags, then block count and data on success
+        const size_t status_offset = 2 + sizeof(FelicaIDm);
+        const size_t rx_size = bit_buffer_get_size_bytes(instance->rx_buffer);
+        if(rx_size < status_offset + 2) {
+            error = FelicaErrorProtocol;
+            break;
+        }
+        if(bit_buffer_get_byte(instance->rx_buffer, status_offset) != 0) {
+            FURI_LOG_D(
+                TAG,
+                "Read %04X failed: %02X %02X",
+                service_code,
+                bit_buffer_get_byte(instance->rx_buffer, status_offset),
+                bit_buffer_get_byte(instance->rx_buffer, status_offset + 1));
+            error = FelicaErrorProtocol;
+            break;
+        }
+
+        const size_t data_offset = status_offset + 3;
+        if(rx_size < data_offset + block_count * FELICA_BLOCK_SIZE ||
+           bit_buffer_get_byte(instance->rx_buffer, status_offset + 2) != block_count) {
+            error = FelicaErrorProtocol;
+            break;
+        }
+
+        bit_buffer_write_bytes_mid(
+            instance->rx_buffer, blocks, data_offset, block_count * FELICA_BLOCK_SIZE);
+    } while(false);
+
+    return error;
+}
+
+FelicaError felica_poller_read_blocks(
+    FelicaPoller* instance,
+    uint16_t service_code,
+    uint16_t block_start,
+    uint16_t block_count,
+    FelicaBlock* blocks) {
+    furi_assert(instance);
+    furi_assert(blocks);
+
+    FelicaError error = FelicaErrorNone;
+
+    while(block_count) {
+        const uint8_t batch = MIN(block_count, (uint16_t)instance->read_blocks_max);
+        error = felica_poller_read_batch(instance, service_code, block_start, batch, blocks);
+
+        if(error == FelicaErrorProtocol && batch > 1) {
+            // Card rejects batches this large or the service ends within the batch,
+            // retry with smaller ones and keep the limit for following reads
+            instance->read_blocks_max = batch / 2;
+            continue;
+        }
+        if(error != FelicaErrorNone) break;
+
+        block_start += batch;
+        block_count -= batch;
+        blocks += batch;
+    }
+
+    return error;
+}
@@ -14,6 +14,18 @@ extern "C" {
 
 #define FELICA_POLLER_CMD_POLLING_REQ_CODE (0x00U)
 #define FELICA_POLLER_CMD_POLLING_RESP_CODE (0x01U)
+#define FELICA_POLLER_CMD_READ_REQ_CODE (0x06U)
+#define FELICA_POLLER_CMD_READ_RESP_CODE (0x07U)
+#define FELICA_POLLER_CMD_REQUEST_SYSTEM_CODE_REQ_CODE (0x0CU)
+#define FELICA_POLLER_CMD_REQUEST_SYSTEM_CODE_RESP_CODE (0x0DU)
+
+/** Largest batch that fits the frame, cards often accept less */
+#define FELICA_POLLER_READ_BLOCKS_MAX (15U)
+
+/** PMm byte with maximum response time parameters of Read Without Encryption */
+#define FELICA_POLLER_PMM_READ_TIMEOUT_INDEX (5U)
+/** Other commands, Request System Code included */
+#define FELICA_POLLER_PMM_OTHER_TIMEOUT_INDEX (7U)
 
 typedef enum {
     FelicaPollerStateIdle,
@@ -27,6 +39,9 @@ struct FelicaPoller {
     BitBuffer* tx_buffer;
     BitBuffer* rx_buffer;
 
+    FelicaIDm system_idm;
+    uint8_t read_blocks_max;
+
     NfcGenericEvent general_event;
     FelicaPollerEvent felica_event;
     FelicaPollerEventData felica_event_data;
@@ -80,6 +80,27 @@ Iso14443_3aError iso14443_3a_poller_send_standard_frame(
     BitBuffer* rx_buffer,
     uint32_t fwt);
 
+/**
+ * @brief Transmit and receive Iso14443_3a standard frames in poller mode without copying tx data.
+ *
+ * Must ONLY be used inside the callback function.
+ *
+ * Same as iso14443_3a_poller_send_standard_frame(), but the CRC is appended directly
+ * to tx_buffer and removed after transmission, so tx_buffer must have capacity for
+ * two more bytes. tx_buffer and rx_buffer must be different instances.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[in, out] tx_buffer pointer to the buffer containing the data to be transmitted.
+ * @param[out] rx_buffer pointer to the buffer to be filled with received data.
+ * @param[in] fwt frame wait time (response timeout), in carrier cycles.
+ * @return Iso14443_3aErrorNone on success, an error code on failure.
+ */
+Iso14443_3aError iso14443_3a_poller_send_standard_frame_in_place(
+    Iso14443_3aPoller* instance,
+    BitBuffer* tx_buffer,
+    BitBuffer* rx_buffer,
+    uint32_t fwt);
+
 /**
  * @brief Transmit and receive Iso14443_3a frames with custom parity bits in poller mode.
  *
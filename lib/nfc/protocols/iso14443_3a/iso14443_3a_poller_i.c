@@ -35,15 +35,14 @@ static Iso14443_3aError iso14443_3a_poller_standard_frame_exchange(
     Iso14443_3aError ret = Iso14443_3aErrorNone;
 
     do {
-        NfcError error =
-            nfc_poller_trx(instance->nfc, instance->tx_buffer, instance->rx_buffer, fwt);
+        // Receive straight into the caller buffer, CRC is checked and trimmed there
+        NfcError error = nfc_poller_trx(instance->nfc, instance->tx_buffer, rx_buffer, fwt);
         if(error != NfcErrorNone) {
             ret = iso14443_3a_poller_process_error(error);
             break;
         }
 
-        bit_buffer_copy(rx_buffer, instance->rx_buffer);
-        if(!iso14443_crc_check(Iso14443CrcTypeA, instance->rx_buffer)) {
+        if(!iso14443_crc_check(Iso14443CrcTypeA, rx_buffer)) {
             ret = Iso14443_3aErrorWrongCrc;
             break;
         }
@@ -290,3 +289,36 @@ Iso14443_3aError iso14443_3a_poller_send_standard_frame(
 
     return ret;
 }
+
+Iso14443_3aError iso14443_3a_poller_send_standard_frame_in_place(
+    Iso14443_3aPoller* instance,
+    BitBuffer* tx_buffer,
+    BitBuffer* rx_buffer,
+    uint32_t fwt) {
+    furi_assert(instance);
+    furi_assert(tx_buffer);
+    furi_assert(rx_buffer);
+    furi_assert(tx_buffer != rx_buffer);
+
+    iso14443_crc_append(Iso14443CrcTypeA, tx_buffer);
+    NfcError error = nfc_poller_trx(instance->nfc, tx_buffer, rx_buffer, fwt);
+    iso14443_crc_trim(tx_buffer);
+
+    Iso14443_3aError ret = Iso14443_3aErrorNone;
+
+    do {
+        if(error != NfcErrorNone) {
+            ret = iso14443_3a_poller_process_error(error);
+            break;
+        }
+
+        if(!iso14443_crc_check(Iso14443CrcTypeA, rx_buffer)) {
+            ret = Iso14443_3aErrorWrongCrc;
+            break;
+        }
+
+        iso14443_crc_trim(rx_buffer);
+    } while(false);
+
+    return ret;
+}
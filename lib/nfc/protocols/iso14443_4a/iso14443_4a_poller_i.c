@@ -61,19 +61,30 @@ Iso14443_4aError iso14443_4a_poller_send_block(
 
     Iso14443_4aError error = Iso14443_4aErrorNone;
 
+    // Receive straight into the caller buffer if it can hold any block we could receive,
+    // the block header is then dropped without copying the payload
+    const bool in_place = bit_buffer_get_capacity_bytes(rx_buffer) >=
+                          bit_buffer_get_capacity_bytes(instance->rx_buffer);
+    BitBuffer* block_buffer = in_place ? rx_buffer : instance->rx_buffer;
+
     do {
-        Iso14443_3aError iso14443_3a_error = iso14443_3a_poller_send_standard_frame(
+        Iso14443_3aError iso14443_3a_error = iso14443_3a_poller_send_standard_frame_in_place(
             instance->iso14443_3a_poller,
             instance->tx_buffer,
-            instance->rx_buffer,
+            block_buffer,
             iso14443_4a_get_fwt_fc_max(instance->data));
 
         if(iso14443_3a_error != Iso14443_3aErrorNone) {
             error = iso14443_4a_process_error(iso14443_3a_error);
             break;
+        }
 
-        } else if(!iso14443_4_layer_decode_block(
-                      instance->iso14443_4_layer, rx_buffer, instance->rx_buffer)) {
+        bool block_valid =
+            in_place ?
+                iso14443_4_layer_decode_block_in_place(instance->iso14443_4_layer, rx_buffer) :
+                iso14443_4_layer_decode_block(
+                    instance->iso14443_4_layer, rx_buffer, instance->rx_buffer);
+        if(!block_valid) {
             error = Iso14443_4aErrorProtocol;
             break;
         }
@@ -27,6 +27,14 @@ Iso15693_3Listener* iso15693_3_listener_alloc(Nfc* nfc, Iso15693_3Data* data) {
     nfc_set_fdt_listen_fc(instance->nfc, ISO15693_3_FDT_LISTEN_FC);
     nfc_config(instance->nfc, NfcModeListener, NfcTechIso15693);
 
+    // Inventory response never changes, readers poll with it and some are picky about timing
+    bit_buffer_append_byte(instance->tx_buffer, ISO15693_3_RESP_FLAG_NONE);
+    bit_buffer_append_byte(instance->tx_buffer, instance->data->system_info.dsfid);
+    iso15693_3_append_uid(instance->data, instance->tx_buffer);
+    iso13239_crc_append(Iso13239CrcTypeDefault, instance->tx_buffer);
+    nfc_iso15693_listener_cache_frame(instance->nfc, instance->tx_buffer);
+    bit_buffer_reset(instance->tx_buffer);
+
     return instance;
 }
 
@@ -98,17 +98,17 @@ bool mf_classic_verify(MfClassicData* data, const FuriString* device_type) {
 
 static void mf_classic_parse_block(FuriString* block_str, MfClassicData* data, uint8_t block_num) {
     furi_string_trim(block_str);
+    const char* block_cstr = furi_string_get_cstr(block_str);
+    size_t block_len = furi_string_size(block_str);
     MfClassicBlock block_tmp = {};
     bool is_sector_trailer = mf_classic_is_sector_trailer(block_num);
     uint8_t sector_num = mf_classic_get_sector_by_block(block_num);
     uint16_t block_unknown_bytes_mask = 0;
 
-    furi_string_trim(block_str);
     for(size_t i = 0; i < MF_CLASSIC_BLOCK_SIZE; i++) {
-        char hi = furi_string_get_char(block_str, 3 * i);
-        char low = furi_string_get_char(block_str, 3 * i + 1);
         uint8_t byte = 0;
-        if(hex_char_to_uint8(hi, low, &byte)) {
+        if((3 * i + 1 < block_len) &&
+           hex_char_to_uint8(block_cstr[3 * i], block_cstr[3 * i + 1], &byte)) {
             block_tmp.data[i] = byte;
         } else {
             FURI_BIT_SET(block_unknown_bytes_mask, i);
@@ -180,11 +180,12 @@ bool mf_classic_load(MfClassicData* data, FlipperFormat* ff, uint32_t version) {
 
         // Read Mifare Classic blocks
         bool block_read = true;
+        char block_key[16];
         FuriString* block_str = furi_string_alloc();
         uint16_t blocks_total = mf_classic_get_total_block_num(data->type);
         for(size_t i = 0; i < blocks_total; i++) {
-            furi_string_printf(temp_str, "Block %d", i);
-            if(!flipper_format_read_string(ff, furi_string_get_cstr(temp_str), block_str)) {
+            snprintf(block_key, sizeof(block_key), "Block %zu", i);
+            if(!flipper_format_read_string(ff, block_key, block_str)) {
                 block_read = false;
                 break;
             }
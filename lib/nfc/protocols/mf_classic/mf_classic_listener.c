@@ -22,8 +22,102 @@ typedef struct {
     MfClassicListenerCommandHandler* handler;
 } MfClassicListenerCmd;
 
+static uint8_t mf_classic_listener_get_read_access(
+    MfClassicListener* instance,
+    uint8_t block_num,
+    MfClassicKeyType key_type) {
+    uint8_t read_access = 0;
+
+    if(mf_classic_is_sector_trailer(block_num)) {
+        if(mf_classic_is_allowed_access(
+               instance->data, block_num, key_type, MfClassicActionKeyARead)) {
+            read_access |= MfClassicListenerReadAccessKeyA;
+        }
+        if(mf_classic_is_allowed_access(
+               instance->data, block_num, key_type, MfClassicActionKeyBRead)) {
+            read_access |= MfClassicListenerReadAccessKeyB;
+        }
+        if(mf_classic_is_allowed_access(
+               instance->data, block_num, key_type, MfClassicActionACRead)) {
+            read_access |= MfClassicListenerReadAccessAC;
+        }
+    } else if(mf_classic_is_allowed_access(
+                  instance->data, block_num, key_type, MfClassicActionDataRead)) {
+        read_access |= MfClassicListenerReadAccessData;
+    }
+
+    return read_access;
+}
+
+static void mf_classic_listener_get_read_block(
+    MfClassicListener* instance,
+    uint8_t block_num,
+    uint8_t read_access,
+    MfClassicBlock* block) {
+    *block = instance->data->block[block_num];
+
+    if(mf_classic_is_sector_trailer(block_num)) {
+        MfClassicSectorTrailer* sec_tr = (MfClassicSectorTrailer*)block;
+        if(!(read_access & MfClassicListenerReadAccessKeyA)) {
+            memset(sec_tr->key_a.data, 0, sizeof(MfClassicKey));
+        }
+        if(!(read_access & MfClassicListenerReadAccessKeyB)) {
+            memset(sec_tr->key_b.data, 0, sizeof(MfClassicKey));
+        }
+        if(!(read_access & MfClassicListenerReadAccessAC)) {
+            memset(sec_tr->access_bits.data, 0, sizeof(MfClassicAccessBits));
+        }
+    }
+}
+
+static void
+    mf_classic_listener_update_block_cache(MfClassicListener* instance, uint8_t block_num) {
+    MfClassicListenerBlockCache* cache = &instance->block_cache[block_num];
+    const MfClassicKeyType key_types[] = {MfClassicKeyTypeA, MfClassicKeyTypeB};
+
+    for(size_t i = 0; i < COUNT_OF(key_types); i++) {
+        MfClassicKeyType key_type = key_types[i];
+        cache->read_access[key_type] =
+            mf_classic_listener_get_read_access(instance, block_num, key_type);
+
+        MfClassicBlock block;
+        mf_classic_listener_get_read_block(
+            instance, block_num, cache->read_access[key_type], &block);
+        cache->crc[key_type] =
+            iso14443_crc_calculate(Iso14443CrcTypeA, block.data, sizeof(MfClassicBlock));
+    }
+}
+
+static void
+    mf_classic_listener_update_sector_cache(MfClassicListener* instance, uint8_t sector_num) {
+    MfClassicListenerSectorCache* cache = &instance->sector_cache[sector_num];
+    MfClassicSectorTrailer* sec_tr =
+        mf_classic_get_sector_trailer_by_sector(instance->data, sector_num);
+
+    crypto1_init(
+        &cache->key_state[MfClassicKeyTypeA],
+        nfc_util_bytes2num(sec_tr->key_a.data, sizeof(MfClassicKey)));
+    crypto1_init(
+        &cache->key_state[MfClassicKeyTypeB],
+        nfc_util_bytes2num(sec_tr->key_b.data, sizeof(MfClassicKey)));
+
+    // Access bits affect every block of the sector
+    uint8_t first_block = mf_classic_get_first_block_num_of_sector(sector_num);
+    uint8_t blocks_num = mf_classic_get_blocks_num_in_sector(sector_num);
+    for(uint8_t i = 0; i < blocks_num; i++) {
+        mf_classic_listener_update_block_cache(instance, first_block + i);
+    }
+}
+
 static void mf_classic_listener_prepare_emulation(MfClassicListener* instance) {
     instance->total_block_num = mf_classic_get_total_block_num(instance->data->type);
+
+    uint8_t total_sectors_num = mf_classic_get_total_sectors_num(instance->data->type);
+    for(uint8_t i = 0; i < total_sectors_num; i++) {
+        mf_classic_listener_update_sector_cache(instance, i);
+    }
+
+    furi_hal_random_fill_buf(instance->nt_next.data, sizeof(MfClassicNt));
 }
 
 static void mf_classic_listener_reset_state(MfClassicListener* instance) {
@@ -64,20 +158,15 @@ static MfClassicListenerCommand mf_classic_listener_auth_first_part_handler(
         }
 
         uint8_t sector_num = mf_classic_get_sector_by_block(block_num);
-
-        MfClassicSectorTrailer* sec_tr =
-            mf_classic_get_sector_trailer_by_sector(instance->data, sector_num);
-        MfClassicKey* key = (key_type == MfClassicKeyTypeA) ? &sec_tr->key_a : &sec_tr->key_b;
-        uint64_t key_num = nfc_util_bytes2num(key->data, sizeof(MfClassicKey));
         uint32_t cuid = iso14443_3a_get_cuid(instance->data->iso14443_3a_data);
 
         instance->auth_context.key_type = key_type;
         instance->auth_context.block_num = block_num;
 
-        furi_hal_random_fill_buf(instance->auth_context.nt.data, sizeof(MfClassicNt));
+        instance->auth_context.nt = instance->nt_next;
         uint32_t nt_num = nfc_util_bytes2num(instance->auth_context.nt.data, sizeof(MfClassicNt));
 
-        crypto1_init(instance->crypto, key_num);
+        *instance->crypto = instance->sector_cache[sector_num].key_state[key_type];
         if(instance->comm_state == MfClassicListenerCommStatePlain) {
             crypto1_word(instance->crypto, nt_num ^ cuid, 0);
             bit_buffer_copy_bytes(
@@ -103,6 +192,9 @@ static MfClassicListenerCommand mf_classic_listener_auth_first_part_handler(
             command = MfClassicListenerCommandProcessed;
         }
 
+        // Nonce is already sent, prepare the next one
+        furi_hal_random_fill_buf(instance->nt_next.data, sizeof(MfClassicNt));
+
         instance->cmd_in_progress = true;
         instance->current_cmd_handler_idx++;
     } while(false);
@@ -196,30 +288,22 @@ static MfClassicListenerCommand
         uint8_t auth_sector_num = mf_classic_get_sector_by_block(auth_ctx->block_num);
         if(sector_num != auth_sector_num) break;
 
-        MfClassicBlock access_block = instance->data->block[block_num];
-
-        if(mf_classic_is_sector_trailer(block_num)) {
-            MfClassicSectorTrailer* access_sec_tr = (MfClassicSectorTrailer*)&access_block;
-            if(!mf_classic_is_allowed_access(
-                   instance->data, block_num, auth_ctx->key_type, MfClassicActionKeyARead)) {
-                memset(access_sec_tr->key_a.data, 0, sizeof(MfClassicKey));
-            }
-            if(!mf_classic_is_allowed_access(
-                   instance->data, block_num, auth_ctx->key_type, MfClassicActionKeyBRead)) {
-                memset(access_sec_tr->key_b.data, 0, sizeof(MfClassicKey));
-            }
-            if(!mf_classic_is_allowed_access(
-                   instance->data, block_num, auth_ctx->key_type, MfClassicActionACRead)) {
-                memset(access_sec_tr->access_bits.data, 0, sizeof(MfClassicAccessBits));
-            }
-        } else if(!mf_classic_is_allowed_access(
-                      instance->data, block_num, auth_ctx->key_type, MfClassicActionDataRead)) {
+        const MfClassicListenerBlockCache* cache = &instance->block_cache[block_num];
+        uint8_t read_access = cache->read_access[auth_ctx->key_type];
+        if(!mf_classic_is_sector_trailer(block_num) &&
+           !(read_access & MfClassicListenerReadAccessData)) {
             break;
         }
 
+        MfClassicBlock access_block;
+        mf_classic_listener_get_read_block(instance, block_num, read_access, &access_block);
+
         bit_buffer_copy_bytes(
             instance->tx_plain_buffer, access_block.data, sizeof(MfClassicBlock));
-        iso14443_crc_append(Iso14443CrcTypeA, instance->tx_plain_buffer);
+        bit_buffer_append_bytes(
+            instance->tx_plain_buffer,
+            (const uint8_t*)&cache->crc[auth_ctx->key_type],
+            ISO14443_CRC_SIZE);
         crypto1_encrypt(
             instance->crypto, NULL, instance->tx_plain_buffer, instance->tx_encrypted_buffer);
         iso14443_3a_listener_tx_with_custom_parity(
@@ -295,6 +379,12 @@ static MfClassicListenerCommand mf_classic_listener_write_block_second_part_hand
         }
 
         instance->data->block[block_num] = block;
+        if(mf_classic_is_sector_trailer(block_num)) {
+            mf_classic_listener_update_sector_cache(
+                instance, mf_classic_get_sector_by_block(block_num));
+        } else {
+            mf_classic_listener_update_block_cache(instance, block_num);
+        }
         command = MfClassicListenerCommandAck;
     } while(false);
 
@@ -410,6 +500,7 @@ static MfClassicListenerCommand
 
         mf_classic_value_to_block(
             instance->transfer_value, block_num, &instance->data->block[block_num]);
+        mf_classic_listener_update_block_cache(instance, block_num);
         instance->transfer_value = 0;
 
         command = MfClassicListenerCommandAck;
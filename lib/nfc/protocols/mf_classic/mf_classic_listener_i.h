@@ -27,6 +27,24 @@ typedef enum {
     MfClassicListenerCommStateEncrypted,
 } MfClassicListenerCommState;
 
+typedef enum {
+    MfClassicListenerReadAccessData = (1U << 0),
+    MfClassicListenerReadAccessKeyA = (1U << 1),
+    MfClassicListenerReadAccessKeyB = (1U << 2),
+    MfClassicListenerReadAccessAC = (1U << 3),
+} MfClassicListenerReadAccess;
+
+typedef struct {
+    // Crypto1 state with sector key loaded, per key type
+    Crypto1 key_state[2];
+} MfClassicListenerSectorCache;
+
+typedef struct {
+    // Read response CRC and MfClassicListenerReadAccess flags, per key type
+    uint16_t crc[2];
+    uint8_t read_access[2];
+} MfClassicListenerBlockCache;
+
 struct MfClassicListener {
     Iso14443_3aListener* iso14443_3a_listener;
     MfClassicListenerState state;
@@ -55,6 +73,11 @@ struct MfClassicListener {
     size_t current_cmd_handler_idx;
 
     size_t total_block_num;
+
+    // Precomputed at emulation start to keep reader response latency low
+    MfClassicNt nt_next;
+    MfClassicListenerSectorCache sector_cache[MF_CLASSIC_TOTAL_SECTORS_MAX];
+    MfClassicListenerBlockCache block_cache[MF_CLASSIC_TOTAL_BLOCKS_MAX];
 };
 
 #ifdef __cplusplus
@@ -61,6 +61,30 @@ static NfcCommand mf_classic_poller_handle_data_update(MfClassicPoller* instance
     return instance->callback(instance->general_event, instance->context);
 }
 
+static MfClassicError mf_classic_poller_dict_attack_auth(
+    MfClassicPoller* instance,
+    uint8_t block_num,
+    MfClassicKey* key,
+    MfClassicKeyType key_type) {
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    // Batch mode keeps session after successful authentication, skip tag reactivation
+    if(dict_attack_ctx->batch_mode && (instance->auth_state == MfClassicAuthStatePassed)) {
+        return mf_classic_poller_auth_nested(instance, block_num, key, key_type, NULL);
+    }
+
+    return mf_classic_poller_auth(instance, block_num, key, key_type, NULL);
+}
+
+static void mf_classic_poller_dict_attack_end_session(MfClassicPoller* instance) {
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    if(!dict_attack_ctx->batch_mode) {
+        mf_classic_poller_halt(instance);
+    }
+    dict_attack_ctx->auth_passed = false;
+}
+
 static void mf_classic_poller_check_key_b_is_readable(
     MfClassicPoller* instance,
     uint8_t block_num,
@@ -119,12 +143,15 @@ NfcCommand mf_classic_poller_handler_start(MfClassicPoller* instance) {
     instance->mfc_event.type = MfClassicPollerEventTypeRequestMode;
     command = instance->callback(instance->general_event, instance->context);
 
-    if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeDictAttack) {
+    MfClassicPollerMode mode = instance->mfc_event_data.poller_mode.mode;
+    if((mode == MfClassicPollerModeDictAttack) || (mode == MfClassicPollerModeDictAttackBatch)) {
         mf_classic_copy(instance->data, instance->mfc_event_data.poller_mode.data);
+        instance->mode_ctx.dict_attack_ctx.batch_mode =
+            (mode == MfClassicPollerModeDictAttackBatch);
         instance->state = MfClassicPollerStateRequestKey;
-    } else if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeRead) {
+    } else if(mode == MfClassicPollerModeRead) {
         instance->state = MfClassicPollerStateRequestReadSector;
-    } else if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeWrite) {
+    } else if(mode == MfClassicPollerModeWrite) {
         instance->state = MfClassicPollerStateRequestSectorTrailer;
     } else {
         furi_crash("Invalid mode selected");
@@ -504,10 +531,51 @@ NfcCommand mf_classic_poller_handler_request_read_sector_blocks(MfClassicPoller*
     return command;
 }
 
+static NfcCommand mf_classic_poller_handler_request_key_batch(MfClassicPoller* instance) {
+    NfcCommand command = NfcCommandContinue;
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    if(dict_attack_ctx->batch_pos == dict_attack_ctx->batch_count) {
+        MfClassicPollerEventDataKeyBatchRequest* batch_data =
+            &instance->mfc_event_data.key_batch_request_data;
+        batch_data->keys_provided = 0;
+        instance->mfc_event.type = MfClassicPollerEventTypeRequestKeyBatch;
+        command = instance->callback(instance->general_event, instance->context);
+
+        dict_attack_ctx->batch_count =
+            MIN(batch_data->keys_provided, MF_CLASSIC_POLLER_KEY_BATCH_SIZE);
+        dict_attack_ctx->batch_pos = 0;
+        memcpy(
+            dict_attack_ctx->batch_keys,
+            batch_data->keys,
+            dict_attack_ctx->batch_count * sizeof(MfClassicKey));
+    }
+
+    if(dict_attack_ctx->batch_pos < dict_attack_ctx->batch_count) {
+        dict_attack_ctx->current_key = dict_attack_ctx->batch_keys[dict_attack_ctx->batch_pos++];
+        instance->state = MfClassicPollerStateAuthKeyA;
+    } else {
+        instance->state = MfClassicPollerStateNextSector;
+    }
+
+    return command;
+}
+
+static void mf_classic_poller_reset_key_batch(MfClassicPoller* instance) {
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    dict_attack_ctx->batch_count = 0;
+    dict_attack_ctx->batch_pos = 0;
+}
+
 NfcCommand mf_classic_poller_handler_request_key(MfClassicPoller* instance) {
     NfcCommand command = NfcCommandContinue;
     MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
 
+    if(dict_attack_ctx->batch_mode) {
+        return mf_classic_poller_handler_request_key_batch(instance);
+    }
+
     instance->mfc_event.type = MfClassicPollerEventTypeRequestKey;
     command = instance->callback(instance->general_event, instance->context);
     if(instance->mfc_event_data.key_request_data.key_provided) {
@@ -532,8 +600,8 @@ NfcCommand mf_classic_poller_handler_auth_a(MfClassicPoller* instance) {
         uint64_t key = nfc_util_bytes2num(dict_attack_ctx->current_key.data, sizeof(MfClassicKey));
         FURI_LOG_D(TAG, "Auth to block %d with key A: %06llx", block, key);
 
-        MfClassicError error = mf_classic_poller_auth(
-            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeA, NULL);
+        MfClassicError error = mf_classic_poller_dict_attack_auth(
+            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeA);
         if(error == MfClassicErrorNone) {
             FURI_LOG_I(TAG, "Key A found");
             mf_classic_set_key_found(
@@ -570,8 +638,8 @@ NfcCommand mf_classic_poller_handler_auth_b(MfClassicPoller* instance) {
         uint64_t key = nfc_util_bytes2num(dict_attack_ctx->current_key.data, sizeof(MfClassicKey));
         FURI_LOG_D(TAG, "Auth to block %d with key B: %06llx", block, key);
 
-        MfClassicError error = mf_classic_poller_auth(
-            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeB, NULL);
+        MfClassicError error = mf_classic_poller_dict_attack_auth(
+            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeB);
         if(error == MfClassicErrorNone) {
             FURI_LOG_I(TAG, "Key B found");
             mf_classic_set_key_found(
@@ -603,6 +671,7 @@ NfcCommand mf_classic_poller_handler_next_sector(MfClassicPoller* instance) {
         instance->mfc_event.type = MfClassicPollerEventTypeNextSector;
         instance->mfc_event_data.next_sector_data.current_sector = dict_attack_ctx->current_sector;
         command = instance->callback(instance->general_event, instance->context);
+        mf_classic_poller_reset_key_batch(instance);
         instance->state = MfClassicPollerStateRequestKey;
     }
 
@@ -621,12 +690,11 @@ NfcCommand mf_classic_poller_handler_read_sector(MfClassicPoller* instance) {
         if(mf_classic_is_block_read(instance->data, block_num)) break;
 
         if(!dict_attack_ctx->auth_passed) {
-            error = mf_classic_poller_auth(
+            error = mf_classic_poller_dict_attack_auth(
                 instance,
                 block_num,
                 &dict_attack_ctx->current_key,
-                dict_attack_ctx->current_key_type,
-                NULL);
+                dict_attack_ctx->current_key_type);
             if(error != MfClassicErrorNone) {
                 instance->state = MfClassicPollerStateNextSector;
                 FURI_LOG_W(TAG, "Failed to re-auth. Go to next sector");
@@ -654,9 +722,7 @@ NfcCommand mf_classic_poller_handler_read_sector(MfClassicPoller* instance) {
     dict_attack_ctx->current_block++;
     if(dict_attack_ctx->current_block > sec_tr_block_num) {
         mf_classic_poller_handle_data_update(instance);
-
-        mf_classic_poller_halt(instance);
-        dict_attack_ctx->auth_passed = false;
+        mf_classic_poller_dict_attack_end_session(instance);
 
         if(dict_attack_ctx->current_sector == instance->sectors_total) {
             instance->state = MfClassicPollerStateNextSector;
@@ -685,6 +751,7 @@ NfcCommand mf_classic_poller_handler_key_reuse_start(MfClassicPoller* instance)
         if(dict_attack_ctx->reuse_key_sector == instance->sectors_total) {
             instance->mfc_event.type = MfClassicPollerEventTypeKeyAttackStop;
             command = instance->callback(instance->general_event, instance->context);
+            mf_classic_poller_reset_key_batch(instance);
             instance->state = MfClassicPollerStateRequestKey;
         } else {
             instance->mfc_event.type = MfClassicPollerEventTypeKeyAttackStart;
@@ -713,8 +780,8 @@ NfcCommand mf_classic_poller_handler_key_reuse_auth_key_a(MfClassicPoller* insta
         uint64_t key = nfc_util_bytes2num(dict_attack_ctx->current_key.data, sizeof(MfClassicKey));
         FURI_LOG_D(TAG, "Key attack auth to block %d with key A: %06llx", block, key);
 
-        MfClassicError error = mf_classic_poller_auth(
-            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeA, NULL);
+        MfClassicError error = mf_classic_poller_dict_attack_auth(
+            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeA);
         if(error == MfClassicErrorNone) {
             FURI_LOG_I(TAG, "Key A found");
             mf_classic_set_key_found(
@@ -748,8 +815,8 @@ NfcCommand mf_classic_poller_handler_key_reuse_auth_key_b(MfClassicPoller* insta
         uint64_t key = nfc_util_bytes2num(dict_attack_ctx->current_key.data, sizeof(MfClassicKey));
         FURI_LOG_D(TAG, "Key attack auth to block %d with key B: %06llx", block, key);
 
-        MfClassicError error = mf_classic_poller_auth(
-            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeB, NULL);
+        MfClassicError error = mf_classic_poller_dict_attack_auth(
+            instance, block, &dict_attack_ctx->current_key, MfClassicKeyTypeB);
         if(error == MfClassicErrorNone) {
             FURI_LOG_I(TAG, "Key B found");
             mf_classic_set_key_found(
@@ -783,12 +850,11 @@ NfcCommand mf_classic_poller_handler_key_reuse_read_sector(MfClassicPoller* inst
         if(mf_classic_is_block_read(instance->data, block_num)) break;
 
         if(!dict_attack_ctx->auth_passed) {
-            error = mf_classic_poller_auth(
+            error = mf_classic_poller_dict_attack_auth(
                 instance,
                 block_num,
                 &dict_attack_ctx->current_key,
-                dict_attack_ctx->current_key_type,
-                NULL);
+                dict_attack_ctx->current_key_type);
             if(error != MfClassicErrorNone) {
                 instance->state = MfClassicPollerStateKeyReuseStart;
                 break;
@@ -814,9 +880,7 @@ NfcCommand mf_classic_poller_handler_key_reuse_read_sector(MfClassicPoller* inst
         mf_classic_get_sector_trailer_num_by_sector(dict_attack_ctx->reuse_key_sector);
     dict_attack_ctx->current_block++;
     if(dict_attack_ctx->current_block > sec_tr_block_num) {
-        mf_classic_poller_halt(instance);
-        dict_attack_ctx->auth_passed = false;
-
+        mf_classic_poller_dict_attack_end_session(instance);
         mf_classic_poller_handle_data_update(instance);
         instance->state = MfClassicPollerStateKeyReuseStart;
     }
@@ -7,6 +7,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of keys provided with one batch key request.
+ */
+#define MF_CLASSIC_POLLER_KEY_BATCH_SIZE (16)
+
 /**
  * @brief MfClassicPoller opaque type definition.
  */
@@ -36,6 +41,8 @@ typedef enum {
     MfClassicPollerEventTypeCardLost, /**< Poller lost card. */
     MfClassicPollerEventTypeSuccess, /**< Poller succeeded. */
     MfClassicPollerEventTypeFail, /**< Poller failed. */
+
+    MfClassicPollerEventTypeRequestKeyBatch, /**< Poller requests block of keys for sector authentication. */
 } MfClassicPollerEventType;
 
 /**
@@ -45,6 +52,7 @@ typedef enum {
     MfClassicPollerModeRead, /**< Poller reading mode. */
     MfClassicPollerModeWrite, /**< Poller writing mode. */
     MfClassicPollerModeDictAttack, /**< Poller dictionary attack mode. */
+    MfClassicPollerModeDictAttackBatch, /**< Poller dictionary attack mode with batch key requests. */
 } MfClassicPollerMode;
 
 /**
@@ -89,6 +97,18 @@ typedef struct {
     bool key_provided; /**< Flag indicating if key is provided. */
 } MfClassicPollerEventDataKeyRequest;
 
+/**
+ * @brief MfClassic poller batch key request event data.
+ *
+ * The instance of this structure must be filled on MfClassicPollerEventTypeRequestKeyBatch event.
+ * Poller tries all provided keys for current sector and requests next block only when
+ * all of them are used. Zero keys_provided means that dictionary is exhausted.
+ */
+typedef struct {
+    MfClassicKey keys[MF_CLASSIC_POLLER_KEY_BATCH_SIZE]; /**< Keys to be used by poller. */
+    uint8_t keys_provided; /**< Number of provided keys. */
+} MfClassicPollerEventDataKeyBatchRequest;
+
 /**
  * @brief MfClassic poller read sector request event data.
  *
@@ -141,6 +161,7 @@ typedef union {
     MfClassicPollerEventDataRequestMode poller_mode; /**< Poller mode context. */
     MfClassicPollerEventDataDictAttackNextSector next_sector_data; /**< Next sector context. */
     MfClassicPollerEventDataKeyRequest key_request_data; /**< Key request context. */
+    MfClassicPollerEventDataKeyBatchRequest key_batch_request_data; /**< Batch key request context. */
     MfClassicPollerEventDataUpdate data_update; /**< Data update context. */
     MfClassicPollerEventDataReadSectorRequest
         read_sector_request_data; /**< Read sector request context. */
@@ -200,6 +221,28 @@ MfClassicError mf_classic_poller_auth(
     MfClassicKeyType key_type,
     MfClassicAuthContext* data);
 
+/**
+ * @brief Perform nested authentication.
+ *
+ * Must ONLY be used inside the callback function.
+ *
+ * Perform authentication inside of already established encrypted session. Saves tag
+ * reactivation compared to mf_classic_poller_auth(). Session is lost if authentication fails.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[in] block_num block number for authentication.
+ * @param[in] key key to be used for authentication.
+ * @param[in] key_type key type to be used for authentication.
+ * @param[out] data pointer to MfClassicAuthContext structure to be filled with authentication data.
+ * @return MfClassicErrorNone on success, an error code on failure.
+ */
+MfClassicError mf_classic_poller_auth_nested(
+    MfClassicPoller* instance,
+    uint8_t block_num,
+    MfClassicKey* key,
+    MfClassicKeyType key_type,
+    MfClassicAuthContext* data);
+
 /**
  * @brief Halt the tag.
  *
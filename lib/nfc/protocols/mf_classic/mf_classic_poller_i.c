@@ -130,6 +130,92 @@ MfClassicError mf_classic_poller_auth(
     return ret;
 }
 
+MfClassicError mf_classic_poller_auth_nested(
+    MfClassicPoller* instance,
+    uint8_t block_num,
+    MfClassicKey* key,
+    MfClassicKeyType key_type,
+    MfClassicAuthContext* data) {
+    MfClassicError ret = MfClassicErrorNone;
+    Iso14443_3aError error = Iso14443_3aErrorNone;
+
+    do {
+        uint8_t auth_type = (key_type == MfClassicKeyTypeB) ? MF_CLASSIC_CMD_AUTH_KEY_B :
+                                                              MF_CLASSIC_CMD_AUTH_KEY_A;
+        uint8_t auth_cmd[2] = {auth_type, block_num};
+        bit_buffer_copy_bytes(instance->tx_plain_buffer, auth_cmd, sizeof(auth_cmd));
+        iso14443_crc_append(Iso14443CrcTypeA, instance->tx_plain_buffer);
+
+        crypto1_encrypt(
+            instance->crypto, NULL, instance->tx_plain_buffer, instance->tx_encrypted_buffer);
+        error = iso14443_3a_poller_txrx_custom_parity(
+            instance->iso14443_3a_poller,
+            instance->tx_encrypted_buffer,
+            instance->rx_encrypted_buffer,
+            MF_CLASSIC_FWT_FC);
+        if(error != Iso14443_3aErrorNone) {
+            ret = mf_classic_process_error(error);
+            break;
+        }
+        if(bit_buffer_get_size_bytes(instance->rx_encrypted_buffer) != sizeof(MfClassicNt)) {
+            ret = MfClassicErrorProtocol;
+            break;
+        }
+
+        // Tag nonce is encrypted with the new key
+        uint32_t cuid = iso14443_3a_get_cuid(instance->data->iso14443_3a_data);
+        uint64_t key_num = nfc_util_bytes2num(key->data, sizeof(MfClassicKey));
+        uint32_t nt_enc = nfc_util_bytes2num(
+            bit_buffer_get_data(instance->rx_encrypted_buffer), sizeof(MfClassicNt));
+        crypto1_init(instance->crypto, key_num);
+        uint32_t nt_num = crypto1_word(instance->crypto, nt_enc ^ cuid, 1) ^ nt_enc;
+
+        MfClassicNt nt = {};
+        nfc_util_num2bytes(nt_num, sizeof(MfClassicNt), nt.data);
+        if(data) {
+            data->nt = nt;
+        }
+
+        // Cipher is initialized again with plain nonce, state is the same as after decryption
+        MfClassicNr nr = {};
+        furi_hal_random_fill_buf(nr.data, sizeof(MfClassicNr));
+        crypto1_encrypt_reader_nonce(
+            instance->crypto, key_num, cuid, nt.data, nr.data, instance->tx_encrypted_buffer);
+        error = iso14443_3a_poller_txrx_custom_parity(
+            instance->iso14443_3a_poller,
+            instance->tx_encrypted_buffer,
+            instance->rx_encrypted_buffer,
+            MF_CLASSIC_FWT_FC);
+
+        if(error != Iso14443_3aErrorNone) {
+            ret = mf_classic_process_error(error);
+            break;
+        }
+        if(bit_buffer_get_size_bytes(instance->rx_encrypted_buffer) != 4) {
+            ret = MfClassicErrorAuth;
+            break;
+        }
+
+        crypto1_word(instance->crypto, 0, 0);
+        instance->auth_state = MfClassicAuthStatePassed;
+
+        if(data) {
+            data->nr = nr;
+            const uint8_t* nr_ar = bit_buffer_get_data(instance->tx_encrypted_buffer);
+            memcpy(data->ar.data, &nr_ar[4], sizeof(MfClassicAr));
+            bit_buffer_write_bytes(
+                instance->rx_encrypted_buffer, data->at.data, sizeof(MfClassicAt));
+        }
+    } while(false);
+
+    if(ret != MfClassicErrorNone) {
+        instance->auth_state = MfClassicAuthStateIdle;
+        iso14443_3a_poller_halt(instance->iso14443_3a_poller);
+    }
+
+    return ret;
+}
+
 MfClassicError mf_classic_poller_halt(MfClassicPoller* instance) {
     MfClassicError ret = MfClassicErrorNone;
     Iso14443_3aError error = Iso14443_3aErrorNone;
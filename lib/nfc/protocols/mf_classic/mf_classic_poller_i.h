@@ -70,6 +70,10 @@ typedef struct {
     bool auth_passed;
     uint16_t current_block;
     uint8_t reuse_key_sector;
+    bool batch_mode;
+    MfClassicKey batch_keys[MF_CLASSIC_POLLER_KEY_BATCH_SIZE];
+    uint8_t batch_count;
+    uint8_t batch_pos;
 } MfClassicPollerDictAttackContext;
 
 typedef struct {
@@ -4,6 +4,8 @@
 
 #define MF_DESFIRE_PROTOCOL_NAME "Mifare DESFire"
 
+#define MF_DESFIRE_LOAD_ARENA_CHUNK_SIZE (512U)
+
 const NfcDeviceBase nfc_device_mf_desfire = {
     .protocol_name = MF_DESFIRE_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)mf_desfire_alloc,
@@ -79,7 +81,8 @@ bool mf_desfire_verify(MfDesfireData* data, const FuriString* device_type) {
 bool mf_desfire_load(MfDesfireData* data, FlipperFormat* ff, uint32_t version) {
     furi_assert(data);
 
-    FuriString* prefix = furi_string_alloc();
+    // Keys of one application at most are kept at a time
+    FuriArena* arena = furi_arena_alloc(MF_DESFIRE_LOAD_ARENA_CHUNK_SIZE);
 
     bool success = false;
 
@@ -101,11 +104,13 @@ bool mf_desfire_load(MfDesfireData* data, FlipperFormat* ff, uint32_t version) {
                    simple_array_get(data->master_key_versions, i),
                    MF_DESFIRE_FFF_PICC_PREFIX,
                    i,
+                   arena,
                    ff))
                 break;
         }
 
         if(i != master_key_version_count) break;
+        furi_arena_reset(arena);
 
         uint32_t application_count;
         if(!mf_desfire_application_count_load(&application_count, ff)) break;
@@ -119,8 +124,8 @@ bool mf_desfire_load(MfDesfireData* data, FlipperFormat* ff, uint32_t version) {
             simple_array_init(data->applications, application_count);
             for(i = 0; i < application_count; ++i) {
                 const MfDesfireApplicationId* app_id = simple_array_cget(data->application_ids, i);
-                furi_string_printf(
-                    prefix,
+                const char* prefix = furi_arena_printf(
+                    arena,
                     "%s %02x%02x%02x",
                     MF_DESFIRE_FFF_APP_PREFIX,
                     app_id->data[0],
@@ -128,8 +133,10 @@ bool mf_desfire_load(MfDesfireData* data, FlipperFormat* ff, uint32_t version) {
                     app_id->data[2]);
 
                 if(!mf_desfire_application_load(
-                       simple_array_get(data->applications, i), furi_string_get_cstr(prefix), ff))
+                       simple_array_get(data->applications, i), prefix, arena, ff))
                     break;
+
+                furi_arena_reset(arena);
             }
 
             if(i != application_count) break;
@@ -138,7 +145,7 @@ bool mf_desfire_load(MfDesfireData* data, FlipperFormat* ff, uint32_t version) {
         success = true;
     } while(false);
 
-    furi_string_free(prefix);
+    furi_arena_free(arena);
     return success;
 }
 
@@ -335,34 +335,35 @@ bool mf_desfire_key_version_load(
     MfDesfireKeyVersion* data,
     const char* prefix,
     uint32_t index,
+    FuriArena* arena,
     FlipperFormat* ff) {
-    FuriString* key = furi_string_alloc_printf(
+    const char* key = furi_arena_printf(
+        arena,
         "%s %s %lu %s",
         prefix,
         MF_DESFIRE_FFF_KEY_SUB_PREFIX,
         index,
         MF_DESFIRE_FFF_KEY_VERSION_KEY);
-    const bool success = flipper_format_read_hex(ff, furi_string_get_cstr(key), data, 1);
-    furi_string_free(key);
-    return success;
+    return flipper_format_read_hex(ff, key, data, 1);
 }
 
-bool mf_desfire_file_count_load(uint32_t* data, const char* prefix, FlipperFormat* ff) {
-    FuriString* key = furi_string_alloc_printf("%s %s", prefix, MF_DESFIRE_FFF_FILE_IDS_KEY);
-    const bool success = flipper_format_get_value_count(ff, furi_string_get_cstr(key), data);
-    furi_string_free(key);
-    return success;
+bool mf_desfire_file_count_load(
+    uint32_t* data,
+    const char* prefix,
+    FuriArena* arena,
+    FlipperFormat* ff) {
+    const char* key = furi_arena_printf(arena, "%s %s", prefix, MF_DESFIRE_FFF_FILE_IDS_KEY);
+    return flipper_format_get_value_count(ff, key, data);
 }
 
 bool mf_desfire_file_ids_load(
     MfDesfireFileId* data,
     uint32_t count,
     const char* prefix,
+    FuriArena* arena,
     FlipperFormat* ff) {
-    FuriString* key = furi_string_alloc_printf("%s %s", prefix, MF_DESFIRE_FFF_FILE_IDS_KEY);
-    const bool success = flipper_format_read_hex(ff, furi_string_get_cstr(key), data, count);
-    furi_string_free(key);
-    return success;
+    const char* key = furi_arena_printf(arena, "%s %s", prefix, MF_DESFIRE_FFF_FILE_IDS_KEY);
+    return flipper_format_read_hex(ff, key, data, count);
 }
 
 bool mf_desfire_file_settings_load(
@@ -471,8 +472,11 @@ bool mf_desfire_application_ids_load(
         ff, MF_DESFIRE_FFF_APPLICATION_IDS_KEY, data->data, count * sizeof(MfDesfireApplicationId));
 }
 
-bool mf_desfire_application_load(MfDesfireApplication* data, const char* prefix, FlipperFormat* ff) {
-    FuriString* sub_prefix = furi_string_alloc();
+bool mf_desfire_application_load(
+    MfDesfireApplication* data,
+    const char* prefix,
+    FuriArena* arena,
+    FlipperFormat* ff) {
     bool success = false;
 
     do {
@@ -483,17 +487,19 @@ bool mf_desfire_application_load(MfDesfireApplication* data, const char* prefix,
 
         uint32_t i;
         for(i = 0; i < key_version_count; ++i) {
-            if(!mf_desfire_key_version_load(simple_array_get(data->key_versions, i), prefix, i, ff))
+            if(!mf_desfire_key_version_load(
+                   simple_array_get(data->key_versions, i), prefix, i, arena, ff))
                 break;
         }
 
         if(i != key_version_count) break;
 
         uint32_t file_count;
-        if(!mf_desfire_file_count_load(&file_count, prefix, ff)) break;
+        if(!mf_desfire_file_count_load(&file_count, prefix, arena, ff)) break;
 
         simple_array_init(data->file_ids, file_count);
-        if(!mf_desfire_file_ids_load(simple_array_get_data(data->file_ids), file_count, prefix, ff))
+        if(!mf_desfire_file_ids_load(
+               simple_array_get_data(data->file_ids), file_count, prefix, arena, ff))
             break;
 
         simple_array_init(data->file_settings, file_count);
@@ -501,15 +507,14 @@ bool mf_desfire_application_load(MfDesfireApplication* data, const char* prefix,
 
         for(i = 0; i < file_count; ++i) {
             const MfDesfireFileId* file_id = simple_array_cget(data->file_ids, i);
-            furi_string_printf(
-                sub_prefix, "%s %s %u", prefix, MF_DESFIRE_FFF_FILE_SUB_PREFIX, *file_id);
+            const char* sub_prefix = furi_arena_printf(
+                arena, "%s %s %u", prefix, MF_DESFIRE_FFF_FILE_SUB_PREFIX, *file_id);
 
             MfDesfireFileSettings* file_settings = simple_array_get(data->file_settings, i);
-            if(!mf_desfire_file_settings_load(file_settings, furi_string_get_cstr(sub_prefix), ff))
-                break;
+            if(!mf_desfire_file_settings_load(file_settings, sub_prefix, ff)) break;
 
             MfDesfireFileData* file_data = simple_array_get(data->file_data, i);
-            if(!mf_desfire_file_data_load(file_data, furi_string_get_cstr(sub_prefix), ff)) break;
+            if(!mf_desfire_file_data_load(file_data, sub_prefix, ff)) break;
         }
 
         if(i != file_count) break;
@@ -517,7 +522,6 @@ bool mf_desfire_application_load(MfDesfireApplication* data, const char* prefix,
         success = true;
     } while(false);
 
-    furi_string_free(sub_prefix);
     return success;
 }
 
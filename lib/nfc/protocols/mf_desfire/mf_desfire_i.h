@@ -2,6 +2,8 @@
 
 #include "mf_desfire.h"
 
+#include <core/arena.h>
+
 #define MF_DESFIRE_FFF_PICC_PREFIX "PICC"
 #define MF_DESFIRE_FFF_APP_PREFIX "Application"
 
@@ -64,18 +66,26 @@ bool mf_desfire_key_settings_load(
     const char* prefix,
     FlipperFormat* ff);
 
+// Functions that take arena allocate keys from it, reset it once done with the loaded entity
+
 bool mf_desfire_key_version_load(
     MfDesfireKeyVersion* data,
     const char* prefix,
     uint32_t index,
+    FuriArena* arena,
     FlipperFormat* ff);
 
-bool mf_desfire_file_count_load(uint32_t* data, const char* prefix, FlipperFormat* ff);
+bool mf_desfire_file_count_load(
+    uint32_t* data,
+    const char* prefix,
+    FuriArena* arena,
+    FlipperFormat* ff);
 
 bool mf_desfire_file_ids_load(
     MfDesfireFileId* data,
     uint32_t count,
     const char* prefix,
+    FuriArena* arena,
     FlipperFormat* ff);
 
 bool mf_desfire_file_settings_load(
@@ -92,7 +102,11 @@ bool mf_desfire_application_ids_load(
     uint32_t count,
     FlipperFormat* ff);
 
-bool mf_desfire_application_load(MfDesfireApplication* data, const char* prefix, FlipperFormat* ff);
+bool mf_desfire_application_load(
+    MfDesfireApplication* data,
+    const char* prefix,
+    FuriArena* arena,
+    FlipperFormat* ff);
 
 // Save internal MFDesfire structures
 
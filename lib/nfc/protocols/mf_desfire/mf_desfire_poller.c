@@ -6,9 +6,6 @@
 
 #define TAG "MfDesfirePoller"
 
-#define MF_DESFIRE_BUF_SIZE (64U)
-#define MF_DESFIRE_RESULT_BUF_SIZE (512U)
-
 typedef NfcCommand (*MfDesfirePollerReadHandler)(MfDesfirePoller* instance);
 
 const MfDesfireData* mf_desfire_poller_get_data(MfDesfirePoller* instance) {
@@ -22,7 +19,7 @@ static MfDesfirePoller* mf_desfire_poller_alloc(Iso14443_4aPoller* iso14443_4a_p
     instance->iso14443_4a_poller = iso14443_4a_poller;
     instance->data = mf_desfire_alloc();
     instance->tx_buffer = bit_buffer_alloc(MF_DESFIRE_BUF_SIZE);
-    instance->rx_buffer = bit_buffer_alloc(MF_DESFIRE_BUF_SIZE);
+    instance->rx_buffer = bit_buffer_alloc(MF_DESFIRE_FRAME_BUF_SIZE);
     instance->input_buffer = bit_buffer_alloc(MF_DESFIRE_BUF_SIZE);
     instance->result_buffer = bit_buffer_alloc(MF_DESFIRE_RESULT_BUF_SIZE);
 
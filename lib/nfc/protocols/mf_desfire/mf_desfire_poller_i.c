@@ -33,24 +33,28 @@ MfDesfireError mf_desfire_send_chunks(
     MfDesfireError error = MfDesfireErrorNone;
 
     do {
-        Iso14443_4aError iso14443_4a_error = iso14443_4a_poller_send_block(
-            instance->iso14443_4a_poller, tx_buffer, instance->rx_buffer);
+        // First frame goes straight to the result, status byte is dropped without copying
+        Iso14443_4aError iso14443_4a_error =
+            iso14443_4a_poller_send_block(instance->iso14443_4a_poller, tx_buffer, rx_buffer);
 
         if(iso14443_4a_error != Iso14443_4aErrorNone) {
             error = mf_desfire_process_error(iso14443_4a_error);
             break;
         }
 
-        bit_buffer_reset(instance->tx_buffer);
-        bit_buffer_append_byte(instance->tx_buffer, MF_DESFIRE_FLAG_HAS_NEXT);
-
-        if(bit_buffer_get_size_bytes(instance->rx_buffer) > sizeof(uint8_t)) {
-            bit_buffer_copy_right(rx_buffer, instance->rx_buffer, sizeof(uint8_t));
+        bool has_next = bit_buffer_starts_with_byte(rx_buffer, MF_DESFIRE_FLAG_HAS_NEXT);
+        if(bit_buffer_get_size_bytes(rx_buffer) > sizeof(uint8_t)) {
+            bit_buffer_trim_left(rx_buffer, sizeof(uint8_t));
         } else {
             bit_buffer_reset(rx_buffer);
         }
 
-        while(bit_buffer_starts_with_byte(instance->rx_buffer, MF_DESFIRE_FLAG_HAS_NEXT)) {
+        if(has_next) {
+            bit_buffer_reset(instance->tx_buffer);
+            bit_buffer_append_byte(instance->tx_buffer, MF_DESFIRE_FLAG_HAS_NEXT);
+        }
+
+        while(has_next) {
             Iso14443_4aError iso14443_4a_error = iso14443_4a_poller_send_block(
                 instance->iso14443_4a_poller, instance->tx_buffer, instance->rx_buffer);
 
@@ -59,6 +63,9 @@ MfDesfireError mf_desfire_send_chunks(
                 break;
             }
 
+            has_next = bit_buffer_starts_with_byte(instance->rx_buffer, MF_DESFIRE_FLAG_HAS_NEXT);
+            if(bit_buffer_get_size_bytes(instance->rx_buffer) <= sizeof(uint8_t)) continue;
+
             const size_t rx_size = bit_buffer_get_size_bytes(instance->rx_buffer);
             const size_t rx_capacity_remaining =
                 bit_buffer_get_capacity_bytes(rx_buffer) - bit_buffer_get_size_bytes(rx_buffer);
@@ -323,6 +330,47 @@ MfDesfireError mf_desfire_poller_read_file_data(
     return error;
 }
 
+static MfDesfireError mf_desfire_poller_read_file_data_chunked(
+    MfDesfirePoller* instance,
+    MfDesfireFileId id,
+    size_t size,
+    MfDesfireFileData* data) {
+    if(size <= MF_DESFIRE_READ_CHUNK_SIZE) {
+        return mf_desfire_poller_read_file_data(instance, id, 0, size, data);
+    }
+
+    // Allocate whole file once from the declared size, chunks are written in place
+    simple_array_init(data->data, size);
+    uint8_t* file_data = simple_array_get_data(data->data);
+
+    MfDesfireError error = MfDesfireErrorNone;
+
+    for(size_t offset = 0; offset < size;) {
+        const size_t chunk_size = MIN(size - offset, MF_DESFIRE_READ_CHUNK_SIZE);
+
+        bit_buffer_reset(instance->input_buffer);
+        bit_buffer_append_byte(instance->input_buffer, MF_DESFIRE_CMD_READ_DATA);
+        bit_buffer_append_byte(instance->input_buffer, id);
+        bit_buffer_append_bytes(instance->input_buffer, (const uint8_t*)&offset, 3);
+        bit_buffer_append_bytes(instance->input_buffer, (const uint8_t*)&chunk_size, 3);
+
+        error = mf_desfire_send_chunks(instance, instance->input_buffer, instance->result_buffer);
+        if(error != MfDesfireErrorNone) break;
+
+        if(bit_buffer_get_size_bytes(instance->result_buffer) != chunk_size) {
+            // No access to the file is not an error, partial file is
+            if(offset > 0) error = MfDesfireErrorProtocol;
+            simple_array_reset(data->data);
+            break;
+        }
+
+        bit_buffer_write_bytes(instance->result_buffer, &file_data[offset], chunk_size);
+        offset += chunk_size;
+    }
+
+    return error;
+}
+
 MfDesfireError mf_desfire_poller_read_file_value(
     MfDesfirePoller* instance,
     MfDesfireFileId id,
@@ -400,8 +448,8 @@ MfDesfireError mf_desfire_poller_read_file_data_multi(
         MfDesfireFileData* file_data = simple_array_get(data, i);
 
         if(file_type == MfDesfireFileTypeStandard || file_type == MfDesfireFileTypeBackup) {
-            error = mf_desfire_poller_read_file_data(
-                instance, file_id, 0, file_settings_cur->data.size, file_data);
+            error = mf_desfire_poller_read_file_data_chunked(
+                instance, file_id, file_settings_cur->data.size, file_data);
         } else if(file_type == MfDesfireFileTypeValue) {
             error = mf_desfire_poller_read_file_value(instance, file_id, file_data);
         } else if(
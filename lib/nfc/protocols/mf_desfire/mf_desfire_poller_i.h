@@ -8,6 +8,13 @@
 extern "C" {
 #endif
 
+#define MF_DESFIRE_BUF_SIZE (64U)
+// Large enough for ISO14443-4A poller to receive frames in place
+#define MF_DESFIRE_FRAME_BUF_SIZE (256U)
+#define MF_DESFIRE_RESULT_BUF_SIZE (512U)
+// Longest read that fits into result buffer, status byte is not stored
+#define MF_DESFIRE_READ_CHUNK_SIZE (MF_DESFIRE_RESULT_BUF_SIZE - 1)
+
 typedef enum {
     MfDesfirePollerStateIdle,
     MfDesfirePollerStateReadVersion,
@@ -172,7 +172,7 @@ MfUltralightPoller* mf_ultralight_poller_alloc(Iso14443_3aPoller* iso14443_3a_po
     MfUltralightPoller* instance = malloc(sizeof(MfUltralightPoller));
     instance->iso14443_3a_poller = iso14443_3a_poller;
     instance->tx_buffer = bit_buffer_alloc(MF_ULTRALIGHT_MAX_BUFF_SIZE);
-    instance->rx_buffer = bit_buffer_alloc(MF_ULTRALIGHT_MAX_BUFF_SIZE);
+    instance->rx_buffer = bit_buffer_alloc(MF_ULTRALIGHT_POLLER_RX_BUFF_SIZE);
     instance->data = mf_ultralight_alloc();
 
     instance->mfu_event.data = &instance->mfu_event_data;
@@ -224,6 +224,7 @@ static NfcCommand mf_ultralight_poller_handler_idle(MfUltralightPoller* instance
     instance->tearing_flag_read = 0;
     instance->tearing_flag_total = 3;
     instance->pages_read = 0;
+    instance->fast_read_failed = false;
     instance->state = MfUltralightPollerStateReadVersion;
 
     return NfcCommandContinue;
@@ -417,7 +418,50 @@ static NfcCommand mf_ultralight_poller_handler_auth(MfUltralightPoller* instance
     return command;
 }
 
+static bool mf_ultralight_poller_read_pages_fast(MfUltralightPoller* instance) {
+    bool success = false;
+
+    do {
+        if(instance->fast_read_failed) break;
+        if(MF_ULTRALIGHT_IS_NTAG_I2C(instance->data->type)) break;
+        if(!mf_ultralight_support_feature(
+               instance->feature_set, MfUltralightFeatureSupportFastRead))
+            break;
+
+        uint16_t start_page = instance->pages_read;
+        uint16_t pages_count =
+            MIN(instance->pages_total - start_page, MF_ULTRALIGHT_POLLER_FAST_READ_MAX_PAGES);
+        instance->error = mf_ultralight_poller_fast_read_pages(
+            instance, start_page, start_page + pages_count - 1, &instance->data->page[start_page]);
+        if(instance->error != MfUltralightErrorNone) {
+            FURI_LOG_D(TAG, "Fast read from page %d failed, fall back to read", start_page);
+            instance->fast_read_failed = true;
+            // Card goes to idle state after NAK, wake it up to continue with plain reads
+            if(iso14443_3a_poller_activate(instance->iso14443_3a_poller, NULL) ==
+                   Iso14443_3aErrorNone &&
+               instance->auth_context.auth_success) {
+                mf_ultralight_poller_auth_pwd(instance, &instance->auth_context);
+            }
+            break;
+        }
+
+        FURI_LOG_D(TAG, "Fast read pages %d-%d success", start_page, start_page + pages_count - 1);
+        instance->pages_read += pages_count;
+        instance->data->pages_read = instance->pages_read;
+        success = true;
+    } while(false);
+
+    return success;
+}
+
 static NfcCommand mf_ultralight_poller_handler_read_pages(MfUltralightPoller* instance) {
+    if(mf_ultralight_poller_read_pages_fast(instance)) {
+        if(instance->pages_read == instance->pages_total) {
+            instance->state = MfUltralightPollerStateReadCounters;
+        }
+        return NfcCommandContinue;
+    }
+
     MfUltralightPageReadCommandData data = {};
     uint16_t start_page = instance->pages_read;
     if(MF_ULTRALIGHT_IS_NTAG_I2C(instance->data->type)) {
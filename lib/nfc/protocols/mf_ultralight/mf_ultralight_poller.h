@@ -113,6 +113,26 @@ MfUltralightError mf_ultralight_poller_read_page_from_sector(
     uint8_t tag,
     MfUltralightPageReadCommandData* data);
 
+/**
+ * @brief Read range of pages from card with FAST_READ command.
+ *
+ * Must ONLY be used inside the callback function.
+ *
+ * The card must support MfUltralightFeatureSupportFastRead. Range must not exceed
+ * 63 pages, which is the longest response that fits into NFC rx buffer.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[in] start_page first page to be read.
+ * @param[in] end_page last page to be read, inclusive.
+ * @param[out] data pointer to the array of MfUltralightPage structures to be filled with page data.
+ * @return MfUltralightErrorNone on success, an error code on failure.
+ */
+MfUltralightError mf_ultralight_poller_fast_read_pages(
+    MfUltralightPoller* instance,
+    uint8_t start_page,
+    uint8_t end_page,
+    MfUltralightPage* data);
+
 /**
  * @brief Write page to card.
  *
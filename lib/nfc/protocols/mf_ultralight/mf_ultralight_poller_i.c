@@ -158,6 +158,40 @@ MfUltralightError mf_ultralight_poller_read_page(
     return ret;
 }
 
+MfUltralightError mf_ultralight_poller_fast_read_pages(
+    MfUltralightPoller* instance,
+    uint8_t start_page,
+    uint8_t end_page,
+    MfUltralightPage* data) {
+    furi_assert(end_page >= start_page);
+    furi_assert(end_page - start_page < MF_ULTRALIGHT_POLLER_FAST_READ_MAX_PAGES);
+
+    MfUltralightError ret = MfUltralightErrorNone;
+    Iso14443_3aError error = Iso14443_3aErrorNone;
+
+    do {
+        const size_t data_size = (end_page - start_page + 1) * MF_ULTRALIGHT_PAGE_SIZE;
+        uint8_t fast_read_cmd[3] = {MF_ULTRALIGHT_CMD_FAST_READ, start_page, end_page};
+        bit_buffer_copy_bytes(instance->tx_buffer, fast_read_cmd, sizeof(fast_read_cmd));
+        error = iso14443_3a_poller_send_standard_frame(
+            instance->iso14443_3a_poller,
+            instance->tx_buffer,
+            instance->rx_buffer,
+            MF_ULTRALIGHT_POLLER_STANDARD_FWT_FC);
+        if(error != Iso14443_3aErrorNone) {
+            ret = mf_ultralight_process_error(error);
+            break;
+        }
+        if(bit_buffer_get_size_bytes(instance->rx_buffer) != data_size) {
+            ret = MfUltralightErrorProtocol;
+            break;
+        }
+        bit_buffer_write_bytes(instance->rx_buffer, data, data_size);
+    } while(false);
+
+    return ret;
+}
+
 MfUltralightError mf_ultralight_poller_write_page(
     MfUltralightPoller* instance,
     uint8_t page,
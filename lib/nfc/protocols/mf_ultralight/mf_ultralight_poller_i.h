@@ -10,6 +10,10 @@ extern "C" {
 
 #define MF_ULTRALIGHT_POLLER_STANDARD_FWT_FC (60000)
 #define MF_ULTRALIGHT_MAX_BUFF_SIZE (64)
+// FAST_READ response with CRC must fit into NFC HAL rx buffer
+#define MF_ULTRALIGHT_POLLER_RX_BUFF_SIZE (256)
+#define MF_ULTRALIGHT_POLLER_FAST_READ_MAX_PAGES \
+    ((MF_ULTRALIGHT_POLLER_RX_BUFF_SIZE - 2) / MF_ULTRALIGHT_PAGE_SIZE)
 
 #define MF_ULTRALIGHT_DEFAULT_PASSWORD (0xffffffffUL)
 
@@ -75,6 +79,7 @@ struct MfUltralightPoller {
     uint32_t feature_set;
     uint16_t pages_read;
     uint16_t pages_total;
+    bool fast_read_failed;
     uint8_t counters_read;
     uint8_t counters_total;
     uint8_t tearing_flag_read;
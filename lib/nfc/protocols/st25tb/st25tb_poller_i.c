@@ -117,6 +117,46 @@ St25tbError st25tb_poller_initiate(St25tbPoller* instance, uint8_t* chip_id) {
     return ret;
 }
 
+// Reads system block and all data blocks back to back, then retries only the failed ones
+static St25tbError st25tb_poller_read_all(St25tbPoller* instance, St25tbData* data) {
+    const uint8_t block_count = st25tb_get_block_count(data->type);
+    // Last bit is system block
+    uint32_t pending[(ST25TB_MAX_BLOCKS + 1 + 31) / 32] = {};
+    for(size_t i = 0; i <= block_count; i++) {
+        pending[i / 32] |= 1UL << (i % 32);
+    }
+
+    nfc_set_fdt_poll_fc(instance->nfc, ST25TB_POLLER_READ_FDT_FC);
+
+    St25tbError ret = St25tbErrorNone;
+    for(size_t attempt = 0; attempt < ST25TB_POLLER_READ_ATTEMPTS; attempt++) {
+        ret = St25tbErrorNone;
+
+        for(size_t i = 0; i <= block_count; i++) {
+            if(!(pending[i / 32] & (1UL << (i % 32)))) continue;
+
+            uint32_t* block = (i == block_count) ? &data->system_otp_block : &data->blocks[i];
+            const uint8_t block_number = (i == block_count) ? ST25TB_SYSTEM_OTP_BLOCK : i;
+            St25tbError error = st25tb_poller_read_block(instance, block, block_number);
+
+            if(error == St25tbErrorNone) {
+                pending[i / 32] &= ~(1UL << (i % 32));
+            } else {
+                ret = error;
+                // Card is gone, no point in going on
+                if(error == St25tbErrorNotPresent) break;
+            }
+        }
+
+        if(ret == St25tbErrorNone || ret == St25tbErrorNotPresent) break;
+        FURI_LOG_D(TAG, "Retrying failed blocks, attempt %zu", attempt + 1);
+    }
+
+    nfc_set_fdt_poll_fc(instance->nfc, ST25TB_FDT_FC);
+
+    return ret;
+}
+
 St25tbError st25tb_poller_activate(St25tbPoller* instance, St25tbData* data) {
     furi_assert(instance);
     furi_assert(instance->nfc);
@@ -169,18 +209,7 @@ St25tbError st25tb_poller_activate(St25tbPoller* instance, St25tbData* data) {
         }
         data->type = st25tb_get_type_from_uid(data->uid);
 
-        bool read_blocks = true;
-        for(uint8_t i = 0; i < st25tb_get_block_count(data->type); i++) {
-            ret = st25tb_poller_read_block(instance, &data->blocks[i], i);
-            if(ret != St25tbErrorNone) {
-                read_blocks = false;
-                break;
-            }
-        }
-        if(!read_blocks) {
-            break;
-        }
-        ret = st25tb_poller_read_block(instance, &data->system_otp_block, ST25TB_SYSTEM_OTP_BLOCK);
+        ret = st25tb_poller_read_all(instance, data);
     } while(false);
 
     return ret;
@@ -9,6 +9,11 @@ extern "C" {
 
 #define ST25TB_POLLER_MAX_BUFFER_SIZE (16U)
 
+// Gap before next Read_block, twice the 10 etu ISO14443-3B minimum instead of full FDT
+#define ST25TB_POLLER_READ_FDT_FC (2560U)
+// Passes over blocks that failed to read
+#define ST25TB_POLLER_READ_ATTEMPTS (3U)
+
 typedef enum {
     St25tbPollerStateIdle,
     St25tbPollerStateInitiateInProgress,
@@ -0,0 +1,338 @@
+#include "nmea_parser.h"
+
+#include <furi.h>
+#include <math.h>
+
+#define NMEA_PARSER_VALUE_MAX ((INT32_MAX - 9) / 10)
+/** 5 decimals of minutes is below 2cm, receivers don't report more */
+#define NMEA_PARSER_SCALE_MAX 100000
+
+#define NMEA_PARSER_ADDRESS_MASK 0xFFFFFFUL
+#define NMEA_PARSER_ADDRESS(a, b, c) (((uint32_t)(a) << 16) | ((uint32_t)(b) << 8) | (c))
+
+typedef enum {
+    NmeaParserStateIdle,
+    NmeaParserStateBody,
+    NmeaParserStateChecksum,
+} NmeaParserState;
+
+typedef enum {
+    NmeaRmcFieldTime = 1,
+    NmeaRmcFieldStatus,
+    NmeaRmcFieldLatitude,
+    NmeaRmcFieldLatitudeHemisphere,
+    NmeaRmcFieldLongitude,
+    NmeaRmcFieldLongitudeHemisphere,
+    NmeaRmcFieldSpeed,
+    NmeaRmcFieldCourse,
+} NmeaRmcField;
+
+typedef enum {
+    NmeaGgaFieldTime = 1,
+    NmeaGgaFieldLatitude,
+    NmeaGgaFieldLatitudeHemisphere,
+    NmeaGgaFieldLongitude,
+    NmeaGgaFieldLongitudeHemisphere,
+    NmeaGgaFieldFixQuality,
+    NmeaGgaFieldSatellites,
+    NmeaGgaFieldHdop,
+    NmeaGgaFieldAltitude,
+    NmeaGgaFieldAltitudeUnits,
+} NmeaGgaField;
+
+struct NmeaParser {
+    NmeaParserState state;
+    uint32_t sentence;
+    uint8_t field;
+    uint8_t checksum;
+    uint8_t checksum_received;
+    uint8_t checksum_digits;
+    uint32_t address;
+
+    // Field being read, numbers are kept as value / scale
+    int32_t value;
+    int32_t scale;
+    bool fraction;
+    bool negative;
+    bool empty;
+    char symbol;
+
+    NmeaFix pending;
+
+    uint32_t fix_sequence;
+    NmeaFix fix;
+};
+
+static void nmea_parser_publish(NmeaParser* parser) {
+    // Readers never see odd sequence, they only retry if preempted while copying
+    FURI_CRITICAL_ENTER();
+    __atomic_add_fetch(&parser->fix_sequence, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    parser->fix = parser->pending;
+    __atomic_add_fetch(&parser->fix_sequence, 1, __ATOMIC_RELEASE);
+    FURI_CRITICAL_EXIT();
+}
+
+static void nmea_parser_field_reset(NmeaParser* parser) {
+    parser->value = 0;
+    parser->scale = 1;
+    parser->fraction = false;
+    parser->negative = false;
+    parser->empty = true;
+    parser->symbol = '\0';
+}
+
+static void nmea_parser_field_char(NmeaParser* parser, char c) {
+    parser->empty = false;
+
+    if(c >= '0' && c <= '9') {
+        if(parser->value > NMEA_PARSER_VALUE_MAX) return;
+        if(parser->fraction) {
+            if(parser->scale >= NMEA_PARSER_SCALE_MAX) return;
+            parser->scale *= 10;
+        }
+        parser->value = parser->value * 10 + (c - '0');
+    } else if(c == '.') {
+        parser->fraction = true;
+    } else if(c == '-') {
+        parser->negative = true;
+    } else if(!parser->symbol) {
+        parser->symbol = c;
+    }
+}
+
+static uint8_t nmea_parser_field_integer(const NmeaParser* parser) {
+    return parser->value / parser->scale;
+}
+
+static float nmea_parser_field_float(const NmeaParser* parser) {
+    if(parser->empty) return NAN;
+    float value = (float)parser->value / parser->scale;
+    return parser->negative ? -value : value;
+}
+
+static float nmea_parser_field_coordinate(const NmeaParser* parser) {
+    if(parser->empty) return NAN;
+    // [d]ddmm.mmmm
+    int32_t degrees_scale = parser->scale * 100;
+    int32_t degrees = parser->value / degrees_scale;
+    float minutes = (float)(parser->value - degrees * degrees_scale) / parser->scale;
+    return degrees + minutes / 60.0f;
+}
+
+static void nmea_parser_field_time(NmeaParser* parser) {
+    if(parser->empty) return;
+    // hhmmss.sss
+    uint32_t time = parser->value / parser->scale;
+    parser->pending.hours = time / 10000;
+    parser->pending.minutes = (time / 100) % 100;
+    parser->pending.seconds = time % 100;
+}
+
+static void nmea_parser_rmc_field(NmeaParser* parser) {
+    NmeaFix* fix = &parser->pending;
+
+    switch(parser->field) {
+    case NmeaRmcFieldTime:
+        nmea_parser_field_time(parser);
+        break;
+    case NmeaRmcFieldStatus:
+        fix->valid = parser->symbol == 'A';
+        break;
+    case NmeaRmcFieldLatitude:
+        fix->latitude = nmea_parser_field_coordinate(parser);
+        break;
+    case NmeaRmcFieldLatitudeHemisphere:
+        if(parser->symbol == 'S') fix->latitude = -fix->latitude;
+        break;
+    case NmeaRmcFieldLongitude:
+        fix->longitude = nmea_parser_field_coordinate(parser);
+        break;
+    case NmeaRmcFieldLongitudeHemisphere:
+        if(parser->symbol == 'W') fix->longitude = -fix->longitude;
+        break;
+    case NmeaRmcFieldSpeed:
+        fix->speed = nmea_parser_field_float(parser);
+        break;
+    case NmeaRmcFieldCourse:
+        fix->course = nmea_parser_field_float(parser);
+        break;
+    default:
+        break;
+    }
+}
+
+static void nmea_parser_gga_field(NmeaParser* parser) {
+    NmeaFix* fix = &parser->pending;
+
+    switch(parser->field) {
+    case NmeaGgaFieldTime:
+        nmea_parser_field_time(parser);
+        break;
+    case NmeaGgaFieldLatitude:
+        fix->latitude = nmea_parser_field_coordinate(parser);
+        break;
+    case NmeaGgaFieldLatitudeHemisphere:
+        if(parser->symbol == 'S') fix->latitude = -fix->latitude;
+        break;
+    case NmeaGgaFieldLongitude:
+        fix->longitude = nmea_parser_field_coordinate(parser);
+        break;
+    case NmeaGgaFieldLongitudeHemisphere:
+        if(parser->symbol == 'W') fix->longitude = -fix->longitude;
+        break;
+    case NmeaGgaFieldFixQuality:
+        fix->fix_quality = nmea_parser_field_integer(parser);
+        break;
+    case NmeaGgaFieldSatellites:
+        fix->satellites = nmea_parser_field_integer(parser);
+        break;
+    case NmeaGgaFieldAltitude:
+        fix->altitude = nmea_parser_field_float(parser);
+        break;
+    case NmeaGgaFieldAltitudeUnits:
+        fix->altitude_units = parser->symbol;
+        break;
+    default:
+        break;
+    }
+}
+
+static void nmea_parser_field_end(NmeaParser* parser) {
+    if(parser->field == 0) {
+        // Talker is ignored, GP, GN and others report the same fields
+        switch(parser->address & NMEA_PARSER_ADDRESS_MASK) {
+        case NMEA_PARSER_ADDRESS('R', 'M', 'C'):
+            parser->sentence = NmeaSentenceRmc;
+            break;
+        case NMEA_PARSER_ADDRESS('G', 'G', 'A'):
+            parser->sentence = NmeaSentenceGga;
+            break;
+        default:
+            parser->sentence = 0;
+            break;
+        }
+        // Only this thread writes the fix, no need for snapshot here
+        if(parser->sentence) parser->pending = parser->fix;
+    } else if(parser->sentence == NmeaSentenceRmc) {
+        nmea_parser_rmc_field(parser);
+    } else if(parser->sentence == NmeaSentenceGga) {
+        nmea_parser_gga_field(parser);
+    }
+
+    if(parser->field < UINT8_MAX) parser->field++;
+    nmea_parser_field_reset(parser);
+}
+
+static uint32_t nmea_parser_sentence_end(NmeaParser* parser) {
+    bool complete = false;
+
+    if(parser->state == NmeaParserStateBody) {
+        nmea_parser_field_end(parser);
+        complete = true;
+    } else {
+        complete = parser->checksum_digits == 2 &&
+                   parser->checksum_received == parser->checksum;
+    }
+    parser->state = NmeaParserStateIdle;
+
+    if(!complete || !parser->sentence) return 0;
+    nmea_parser_publish(parser);
+    return parser->sentence;
+}
+
+static int8_t nmea_parser_hex(char c) {
+    if(c >= '0' && c <= '9') return c - '0';
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+NmeaParser* nmea_parser_alloc(void) {
+    NmeaParser* parser = malloc(sizeof(NmeaParser));
+    nmea_parser_reset(parser);
+    return parser;
+}
+
+void nmea_parser_free(NmeaParser* parser) {
+    furi_assert(parser);
+    free(parser);
+}
+
+void nmea_parser_reset(NmeaParser* parser) {
+    furi_assert(parser);
+
+    parser->state = NmeaParserStateIdle;
+    parser->sentence = 0;
+    memset(&parser->pending, 0, sizeof(NmeaFix));
+    parser->pending.latitude = NAN;
+    parser->pending.longitude = NAN;
+    parser->pending.altitude_units = ' ';
+    nmea_parser_publish(parser);
+}
+
+uint32_t nmea_parser_feed(NmeaParser* parser, const uint8_t* data, size_t size) {
+    furi_assert(parser);
+    furi_assert(data);
+    uint32_t applied = 0;
+
+    for(size_t i = 0; i < size; i++) {
+        char c = data[i];
+
+        if(c == '$') {
+            parser->state = NmeaParserStateBody;
+            parser->sentence = 0;
+            parser->field = 0;
+            parser->checksum = 0;
+            parser->address = 0;
+            nmea_parser_field_reset(parser);
+            continue;
+        }
+
+        if(parser->state == NmeaParserStateIdle) continue;
+
+        if(c == '\r' || c == '\n') {
+            applied |= nmea_parser_sentence_end(parser);
+        } else if(c < ' ' || c > '~') {
+            // Noise or baudrate mismatch
+            parser->state = NmeaParserStateIdle;
+        } else if(parser->state == NmeaParserStateChecksum) {
+            int8_t digit = nmea_parser_hex(c);
+            if(digit < 0 || parser->checksum_digits == 2) {
+                parser->state = NmeaParserStateIdle;
+            } else {
+                parser->checksum_received = (parser->checksum_received << 4) | digit;
+                parser->checksum_digits++;
+            }
+        } else if(c == '*') {
+            nmea_parser_field_end(parser);
+            parser->state = NmeaParserStateChecksum;
+            parser->checksum_received = 0;
+            parser->checksum_digits = 0;
+        } else {
+            parser->checksum ^= c;
+            if(c == ',') {
+                nmea_parser_field_end(parser);
+            } else if(parser->field == 0) {
+                parser->address = (parser->address << 8) | c;
+            } else if(parser->sentence) {
+                nmea_parser_field_char(parser, c);
+            }
+        }
+    }
+
+    return applied;
+}
+
+void nmea_parser_get_fix(NmeaParser* parser, NmeaFix* fix) {
+    furi_assert(parser);
+    furi_assert(fix);
+
+    // Snapshot is published with sequence bump, retry if it changed while copying
+    uint32_t sequence;
+    do {
+        sequence = __atomic_load_n(&parser->fix_sequence, __ATOMIC_ACQUIRE);
+        memcpy(fix, &parser->fix, sizeof(NmeaFix));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while(sequence != __atomic_load_n(&parser->fix_sequence, __ATOMIC_RELAXED));
+}
@@ -0,0 +1,70 @@
+/**
+ * @file nmea_parser.h
+ * Incremental NMEA 0183 parser
+ *
+ * Bytes are consumed as they come from UART, in chunks of any size, fields are
+ * decoded in place so sentences are never buffered or copied. Only RMC and GGA
+ * are decoded, everything else is skipped after the address field. A sentence
+ * is applied when its checksum matches, sentences without checksum are taken
+ * as is.
+ *
+ * Latest fix is published as snapshot that can be read from any thread
+ * without locking the feeding one.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    NmeaSentenceRmc = (1 << 0),
+    NmeaSentenceGga = (1 << 1),
+} NmeaSentence;
+
+typedef struct {
+    bool valid; /**< RMC status is active */
+    float latitude; /**< degrees, NAN if not known */
+    float longitude; /**< degrees, NAN if not known */
+    float speed; /**< knots */
+    float course; /**< degrees */
+    float altitude;
+    char altitude_units;
+    uint8_t fix_quality;
+    uint8_t satellites;
+    uint8_t hours;
+    uint8_t minutes;
+    uint8_t seconds;
+} NmeaFix;
+
+typedef struct NmeaParser NmeaParser;
+
+NmeaParser* nmea_parser_alloc(void);
+
+void nmea_parser_free(NmeaParser* parser);
+
+/** Drop partial sentence and clear fix */
+void nmea_parser_reset(NmeaParser* parser);
+
+/** Parse received bytes
+ *
+ * Not reentrant, feed from one thread only.
+ *
+ * @param      parser  NmeaParser instance
+ * @param      data    received bytes
+ * @param      size    bytes count
+ *
+ * @return     NmeaSentence bits of sentences applied to fix
+ */
+uint32_t nmea_parser_feed(NmeaParser* parser, const uint8_t* data, size_t size);
+
+/** Copy latest fix, safe to call from any thread */
+void nmea_parser_get_fix(NmeaParser* parser, NmeaFix* fix);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,5 @@
 #include <furi.h>
+#include <furi_hal_cortex.h>
 
 /**
  * Timings based on Application Note 126:
@@ -55,6 +56,17 @@ struct OneWireHost {
     bool last_device_flag;
 };
 
+/** Slot phases are timed from the slot start, so time spent on GPIO access and
+ * calls doesn't add up and stretch short overdrive slots */
+static inline FuriHalCortexTimer onewire_host_slot_start(void) {
+    return furi_hal_cortex_timer_get(0);
+}
+
+static inline void onewire_host_slot_wait(FuriHalCortexTimer* slot, uint16_t duration_us) {
+    slot->value += duration_us * furi_hal_cortex_instructions_per_microsecond();
+    furi_hal_cortex_timer_wait(*slot);
+}
+
 OneWireHost* onewire_host_alloc(const GpioPin* gpio_pin) {
     OneWireHost* host = malloc(sizeof(OneWireHost));
     host->gpio_pin = gpio_pin;
@@ -82,19 +94,20 @@ bool onewire_host_reset(OneWireHost* host) {
     } while(!furi_hal_gpio_read(host->gpio_pin));
 
     // pre delay
-    furi_delay_us(timings->g);
+    FuriHalCortexTimer slot = onewire_host_slot_start();
+    onewire_host_slot_wait(&slot, timings->g);
 
     // drive low
     furi_hal_gpio_write(host->gpio_pin, false);
-    furi_delay_us(timings->h);
+    onewire_host_slot_wait(&slot, timings->h);
 
     // release
     furi_hal_gpio_write(host->gpio_pin, true);
-    furi_delay_us(timings->i);
+    onewire_host_slot_wait(&slot, timings->i);
 
     // read and post delay
     r = !furi_hal_gpio_read(host->gpio_pin);
-    furi_delay_us(timings->j);
+    onewire_host_slot_wait(&slot, timings->j);
 
     return r;
 }
@@ -105,16 +118,17 @@ bool onewire_host_read_bit(OneWireHost* host) {
     const OneWireHostTimings* timings = host->timings;
 
     // drive low
+    FuriHalCortexTimer slot = onewire_host_slot_start();
     furi_hal_gpio_write(host->gpio_pin, false);
-    furi_delay_us(timings->a);
+    onewire_host_slot_wait(&slot, timings->a);
 
     // release
     furi_hal_gpio_write(host->gpio_pin, true);
-    furi_delay_us(timings->e);
+    onewire_host_slot_wait(&slot, timings->e);
 
     // read and post delay
     result = furi_hal_gpio_read(host->gpio_pin);
-    furi_delay_us(timings->f);
+    onewire_host_slot_wait(&slot, timings->f);
 
     return result;
 }
@@ -140,22 +154,24 @@ void onewire_host_read_bytes(OneWireHost* host, uint8_t* buffer, uint16_t count)
 void onewire_host_write_bit(OneWireHost* host, bool value) {
     const OneWireHostTimings* timings = host->timings;
 
+    FuriHalCortexTimer slot = onewire_host_slot_start();
+
     if(value) {
         // drive low
         furi_hal_gpio_write(host->gpio_pin, false);
-        furi_delay_us(timings->a);
+        onewire_host_slot_wait(&slot, timings->a);
 
         // release
         furi_hal_gpio_write(host->gpio_pin, true);
-        furi_delay_us(timings->b);
+        onewire_host_slot_wait(&slot, timings->b);
     } else {
         // drive low
         furi_hal_gpio_write(host->gpio_pin, false);
-        furi_delay_us(timings->c);
+        onewire_host_slot_wait(&slot, timings->c);
 
         // release
         furi_hal_gpio_write(host->gpio_pin, true);
-        furi_delay_us(timings->d);
+        onewire_host_slot_wait(&slot, timings->d);
     }
 }
 
@@ -6,12 +6,11 @@
 #define TH_TIMEOUT_MAX 15000 /* Maximum time before general timeout */
 
 typedef enum {
-    OneWireSlaveErrorNone = 0,
-    OneWireSlaveErrorResetInProgress,
-    OneWireSlaveErrorPresenceConflict,
-    OneWireSlaveErrorInvalidCommand,
-    OneWireSlaveErrorTimeout,
-} OneWireSlaveError;
+    OneWireSlaveStateIdle, /* Waiting for reset */
+    OneWireSlaveStateReceive, /* Receiving bytes */
+    OneWireSlaveStateSend, /* Sending bytes */
+    OneWireSlaveStateSearch, /* Sending bits and their complements, checking master choice */
+} OneWireSlaveState;
 
 typedef struct {
     uint16_t trstl_min; /* Minimum Reset Low time */
@@ -31,18 +30,31 @@ typedef struct {
 struct OneWireSlave {
     const GpioPin* gpio_pin;
     const OneWireSlaveTimings* timings;
-    OneWireSlaveError error;
 
-    bool is_first_reset;
-    bool is_short_reset;
+    OneWireSlaveState state;
+    bool level; /* Bus level after the last handled edge */
+    uint32_t edge_time; /* DWT->CYCCNT value at the last handled edge */
+
+    union {
+        const uint8_t* send;
+        uint8_t* receive;
+    } data;
+    size_t data_bits;
+    size_t bit_index;
+    uint8_t search_step;
+
+    uint8_t command;
+    bool is_next_command; /* Receive another command when current operation is over */
 
     OneWireSlaveResetCallback reset_callback;
     OneWireSlaveCommandCallback command_callback;
     OneWireSlaveResultCallback result_callback;
+    OneWireSlaveReceiveCallback receive_callback;
 
     void* reset_callback_context;
     void* result_callback_context;
     void* command_callback_context;
+    void* receive_callback_context;
 };
 
 static const OneWireSlaveTimings onewire_slave_timings_normal = {
@@ -77,6 +89,17 @@ static const OneWireSlaveTimings onewire_slave_timings_overdrive = {
 
 /*********************** PRIVATE ***********************/
 
+/*
+ * The slave is a state machine driven by bus edges. Each edge is timestamped with
+ * the cycle counter in the EXTI interrupt, rising edges end the low pulses the master
+ * uses to encode resets and write slots. Falling edges start time slots, and the only
+ * time the line is held in the interrupt is for sending a zero bit, presence pulse
+ * included. The CPU is free between slots at standard speed.
+ *
+ * Overdrive slots are shorter than interrupt latency, so while an overdrive
+ * transaction is active the same state machine is fed by polling the line.
+ */
+
 static bool
     onewire_slave_wait_while_gpio_is(OneWireSlave* bus, uint32_t time_us, const bool pin_value) {
     const uint32_t time_start = DWT->CYCCNT;
@@ -96,8 +119,6 @@ static bool
 
 static inline bool onewire_slave_show_presence(OneWireSlave* bus) {
     const OneWireSlaveTimings* timings = bus->timings;
-    // wait until the bus is high (might return immediately)
-    onewire_slave_wait_while_gpio_is(bus, timings->trstl_max, false);
     // wait while master delay presence check
     furi_delay_us(timings->tpdh_typ);
 
@@ -110,97 +131,223 @@ static inline bool onewire_slave_show_presence(OneWireSlave* bus) {
     const uint32_t wait_low_time = timings->tpdl_max - timings->tpdl_min;
 
     // so we will wait
-    if(!onewire_slave_wait_while_gpio_is(bus, wait_low_time, false)) {
-        bus->error = OneWireSlaveErrorPresenceConflict;
-        return false;
+    return onewire_slave_wait_while_gpio_is(bus, wait_low_time, false);
+}
+
+static inline bool onewire_slave_current_bit(OneWireSlave* bus) {
+    return (bus->data.send[bus->bit_index / 8] >> (bus->bit_index % 8)) & 0x01;
+}
+
+static bool onewire_slave_command_received(void* context) {
+    OneWireSlave* bus = context;
+    furi_assert(bus->command_callback);
+    return bus->command_callback(bus->command, bus->command_callback_context);
+}
+
+static void onewire_slave_expect_command(OneWireSlave* bus) {
+    onewire_slave_receive(
+        bus, &bus->command, sizeof(bus->command), onewire_slave_command_received, bus);
+}
+
+static void onewire_slave_operation_done(OneWireSlave* bus) {
+    bus->state = OneWireSlaveStateIdle;
+
+    if(bus->receive_callback) {
+        const OneWireSlaveReceiveCallback callback = bus->receive_callback;
+        bus->receive_callback = NULL;
+        bus->is_next_command = callback(bus->receive_callback_context);
     }
 
-    return true;
+    // Callback has already started the next operation
+    if(bus->state != OneWireSlaveStateIdle) return;
+
+    if(bus->is_next_command) {
+        onewire_slave_expect_command(bus);
+    } else if(bus->result_callback) {
+        bus->result_callback(bus->result_callback_context);
+    }
 }
 
-static inline bool onewire_slave_receive_and_process_command(OneWireSlave* bus) {
-    /* Reset condition detected, send a presence pulse and reset protocol state */
-    if(bus->error == OneWireSlaveErrorResetInProgress) {
-        if(!bus->is_first_reset) {
-            /* Guess the reset type */
-            bus->is_short_reset = onewire_slave_wait_while_gpio_is(
-                bus,
-                onewire_slave_timings_overdrive.trstl_max -
-                    onewire_slave_timings_overdrive.tslot_max,
-                false);
-        } else {
-            bus->is_first_reset = false;
+static void onewire_slave_reset(OneWireSlave* bus, bool is_short) {
+    bus->state = OneWireSlaveStateIdle;
+    bus->receive_callback = NULL;
+
+    furi_assert(bus->reset_callback);
+
+    if(bus->reset_callback(is_short, bus->reset_callback_context)) {
+        if(onewire_slave_show_presence(bus)) {
+            bus->edge_time = DWT->CYCCNT;
+            onewire_slave_expect_command(bus);
         }
+    }
+}
 
-        furi_assert(bus->reset_callback);
+static void onewire_slave_falling_edge(OneWireSlave* bus, uint32_t time, bool is_in_time) {
+    const uint32_t timeout_ticks = TH_TIMEOUT_MAX * furi_hal_cortex_instructions_per_microsecond();
 
-        if(bus->reset_callback(bus->is_short_reset, bus->reset_callback_context)) {
-            if(onewire_slave_show_presence(bus)) {
-                bus->error = OneWireSlaveErrorNone;
-                return true;
-            }
+    // Master gave up on the transaction, it has to start over with a reset
+    if(time - bus->edge_time > timeout_ticks) {
+        bus->state = OneWireSlaveStateIdle;
+    }
+
+    bus->edge_time = time;
+
+    // Too late to answer this slot, master has already sampled the line
+    if(!is_in_time) return;
+
+    bool is_zero = false;
+
+    if(bus->state == OneWireSlaveStateSend) {
+        is_zero = !onewire_slave_current_bit(bus);
+    } else if(bus->state == OneWireSlaveStateSearch && bus->search_step < 2) {
+        // Bit first, then its complement
+        is_zero = onewire_slave_current_bit(bus) == (bus->search_step == 1);
+    }
+
+    if(is_zero) {
+        furi_hal_gpio_write(bus->gpio_pin, false);
+        furi_delay_us(bus->timings->trl_tmsr_max);
+        furi_hal_gpio_write(bus->gpio_pin, true);
+    }
+}
+
+static void onewire_slave_rising_edge(OneWireSlave* bus, uint32_t time) {
+    const uint32_t pulse_length =
+        (time - bus->edge_time) / furi_hal_cortex_instructions_per_microsecond();
+    bus->edge_time = time;
+
+    if(pulse_length > onewire_slave_timings_normal.trstl_max) {
+        bus->state = OneWireSlaveStateIdle;
+        return;
+    }
+
+    if(bus->state == OneWireSlaveStateIdle) {
+        /* Any reset is accepted when idle, the callback chooses speed mode if supported */
+        if(pulse_length >= onewire_slave_timings_overdrive.trstl_min) {
+            onewire_slave_reset(bus, pulse_length <= onewire_slave_timings_overdrive.trstl_max);
+        }
+        return;
+    }
+
+    if(pulse_length >= bus->timings->tslot_max) {
+        onewire_slave_reset(bus, pulse_length <= onewire_slave_timings_overdrive.trstl_max);
+        return;
+    }
+
+    const bool bit = pulse_length <= bus->timings->tw1l_max;
+
+    switch(bus->state) {
+    case OneWireSlaveStateReceive: {
+        uint8_t* data_byte = &bus->data.receive[bus->bit_index / 8];
+        const uint8_t bit_mask = 1U << (bus->bit_index % 8);
+
+        if(bit) {
+            *data_byte |= bit_mask;
+        } else {
+            *data_byte &= ~bit_mask;
         }
 
-    } else if(bus->error == OneWireSlaveErrorNone) {
-        uint8_t command;
-        if(onewire_slave_receive(bus, &command, sizeof(command))) {
-            furi_assert(bus->command_callback);
-            if(bus->command_callback(command, bus->command_callback_context)) {
-                return true;
+        if(++bus->bit_index == bus->data_bits) {
+            onewire_slave_operation_done(bus);
+        }
+    } break;
+
+    case OneWireSlaveStateSend:
+        if(++bus->bit_index == bus->data_bits) {
+            onewire_slave_operation_done(bus);
+        }
+        break;
+
+    case OneWireSlaveStateSearch:
+        if(bus->search_step < 2) {
+            ++bus->search_step;
+        } else if(bit != onewire_slave_current_bit(bus)) {
+            // Master has chosen another device, wait for the next reset
+            bus->state = OneWireSlaveStateIdle;
+        } else {
+            bus->search_step = 0;
+            if(++bus->bit_index == bus->data_bits) {
+                onewire_slave_operation_done(bus);
             }
         }
+        break;
 
-        return (bus->error == OneWireSlaveErrorResetInProgress);
+    default:
+        break;
     }
+}
 
-    return false;
+static void onewire_slave_edge(OneWireSlave* bus, bool level, uint32_t time, bool is_in_time) {
+    bus->level = level;
+
+    if(level) {
+        onewire_slave_rising_edge(bus, time);
+    } else {
+        onewire_slave_falling_edge(bus, time, is_in_time);
+    }
 }
 
-static inline bool onewire_slave_bus_start(OneWireSlave* bus) {
+/* Follow the line until it settles, edges caused or missed while handling are not reported */
+static void onewire_slave_follow(OneWireSlave* bus) {
+    for(bool level = furi_hal_gpio_read(bus->gpio_pin); level != bus->level;
+        level = furi_hal_gpio_read(bus->gpio_pin)) {
+        onewire_slave_edge(bus, level, DWT->CYCCNT, true);
+    }
+}
+
+static void onewire_slave_poll(OneWireSlave* bus) {
+    const uint32_t timeout_ticks = TH_TIMEOUT_MAX * furi_hal_cortex_instructions_per_microsecond();
+
     FURI_CRITICAL_ENTER();
-    furi_hal_gpio_init(bus->gpio_pin, GpioModeOutputOpenDrain, GpioPullNo, GpioSpeedLow);
 
-    while(onewire_slave_receive_and_process_command(bus))
-        ;
+    while(bus->timings == &onewire_slave_timings_overdrive &&
+          bus->state != OneWireSlaveStateIdle) {
+        const uint32_t time = DWT->CYCCNT;
+        const bool level = furi_hal_gpio_read(bus->gpio_pin);
 
-    const bool result = (bus->error == OneWireSlaveErrorNone);
+        if(level != bus->level) {
+            onewire_slave_edge(bus, level, time, true);
+        } else if(time - bus->edge_time > timeout_ticks) {
+            bus->state = OneWireSlaveStateIdle;
+        }
+    }
 
-    furi_hal_gpio_init(bus->gpio_pin, GpioModeInterruptRiseFall, GpioPullNo, GpioSpeedLow);
     FURI_CRITICAL_EXIT();
-
-    return result;
 }
 
 static void onewire_slave_exti_callback(void* context) {
     OneWireSlave* bus = context;
 
-    const volatile bool input_state = furi_hal_gpio_read(bus->gpio_pin);
-    static uint32_t pulse_start = 0;
+    const uint32_t time = DWT->CYCCNT;
+    const bool level = furi_hal_gpio_read(bus->gpio_pin);
 
-    if(input_state) {
-        const uint32_t pulse_length =
-            (DWT->CYCCNT - pulse_start) / furi_hal_cortex_instructions_per_microsecond();
+    if(level == bus->level) {
+        /* A whole pulse went by unseen, its length is unknown */
+        onewire_slave_edge(bus, !level, time, false);
+    }
+
+    onewire_slave_edge(bus, level, time, true);
+    onewire_slave_follow(bus);
+    onewire_slave_poll(bus);
+};
 
-        if((pulse_length >= onewire_slave_timings_overdrive.trstl_min) &&
-           (pulse_length <= onewire_slave_timings_normal.trstl_max)) {
-            /* Start in reset state in order to send a presence pulse immediately */
-            bus->error = OneWireSlaveErrorResetInProgress;
-            /* Determine reset type (chooses speed mode if supported by the emulated device) */
-            bus->is_short_reset = pulse_length <= onewire_slave_timings_overdrive.trstl_max;
-            /* Initial reset allows going directly into overdrive mode */
-            bus->is_first_reset = true;
+static void onewire_slave_start_operation(
+    OneWireSlave* bus,
+    OneWireSlaveState state,
+    size_t data_size,
+    OneWireSlaveReceiveCallback callback,
+    void* context) {
+    furi_assert(data_size);
 
-            const bool result = onewire_slave_bus_start(bus);
+    bus->data_bits = data_size * 8;
+    bus->bit_index = 0;
+    bus->search_step = 0;
 
-            if(result && bus->result_callback != NULL) {
-                bus->result_callback(bus->result_callback_context);
-            }
-        }
+    bus->receive_callback = callback;
+    bus->receive_callback_context = context;
 
-    } else {
-        pulse_start = DWT->CYCCNT;
-    }
-};
+    bus->state = state;
+}
 
 /*********************** PUBLIC ***********************/
 
@@ -209,7 +356,7 @@ OneWireSlave* onewire_slave_alloc(const GpioPin* gpio_pin) {
 
     bus->gpio_pin = gpio_pin;
     bus->timings = &onewire_slave_timings_normal;
-    bus->error = OneWireSlaveErrorNone;
+    bus->state = OneWireSlaveStateIdle;
 
     return bus;
 }
@@ -220,15 +367,23 @@ void onewire_slave_free(OneWireSlave* bus) {
 }
 
 void onewire_slave_start(OneWireSlave* bus) {
+    bus->state = OneWireSlaveStateIdle;
+    bus->level = true;
+    bus->edge_time = DWT->CYCCNT;
+
     furi_hal_gpio_add_int_callback(bus->gpio_pin, onewire_slave_exti_callback, bus);
     furi_hal_gpio_write(bus->gpio_pin, true);
+    furi_hal_gpio_init(bus->gpio_pin, GpioModeOutputOpenDrain, GpioPullNo, GpioSpeedLow);
     furi_hal_gpio_init(bus->gpio_pin, GpioModeInterruptRiseFall, GpioPullNo, GpioSpeedLow);
+    /* Drive the line from the interrupt without reconfiguring it, open drain is kept from above */
+    LL_GPIO_SetPinMode(bus->gpio_pin->port, bus->gpio_pin->pin, LL_GPIO_MODE_OUTPUT);
 }
 
 void onewire_slave_stop(OneWireSlave* bus) {
     furi_hal_gpio_write(bus->gpio_pin, true);
     furi_hal_gpio_init(bus->gpio_pin, GpioModeAnalog, GpioPullNo, GpioSpeedLow);
     furi_hal_gpio_remove_int_callback(bus->gpio_pin);
+    bus->state = OneWireSlaveStateIdle;
 }
 
 void onewire_slave_set_reset_callback(
@@ -255,103 +410,27 @@ void onewire_slave_set_result_callback(
     bus->result_callback_context = context;
 }
 
-bool onewire_slave_receive_bit(OneWireSlave* bus) {
-    const OneWireSlaveTimings* timings = bus->timings;
-    // wait while bus is low
-    if(!onewire_slave_wait_while_gpio_is(bus, timings->tslot_max, false)) {
-        bus->error = OneWireSlaveErrorResetInProgress;
-        return false;
-    }
-
-    // wait while bus is high
-    if(!onewire_slave_wait_while_gpio_is(bus, TH_TIMEOUT_MAX, true)) {
-        bus->error = OneWireSlaveErrorTimeout;
-        return false;
-    }
-
-    // wait a time of zero
-    return onewire_slave_wait_while_gpio_is(bus, timings->tw1l_max, false);
-}
-
-bool onewire_slave_send_bit(OneWireSlave* bus, bool value) {
-    const OneWireSlaveTimings* timings = bus->timings;
-    // wait while bus is low
-    if(!onewire_slave_wait_while_gpio_is(bus, timings->tslot_max, false)) {
-        bus->error = OneWireSlaveErrorResetInProgress;
-        return false;
-    }
-
-    // wait while bus is high
-    if(!onewire_slave_wait_while_gpio_is(bus, TH_TIMEOUT_MAX, true)) {
-        bus->error = OneWireSlaveErrorTimeout;
-        return false;
-    }
-
-    // choose write time
-    uint32_t time;
-
-    if(!value) {
-        furi_hal_gpio_write(bus->gpio_pin, false);
-        time = timings->trl_tmsr_max;
-    } else {
-        time = timings->tslot_min;
-    }
-
-    // hold line for ZERO or ONE time
-    furi_delay_us(time);
-    furi_hal_gpio_write(bus->gpio_pin, true);
-
-    return true;
+void onewire_slave_send(OneWireSlave* bus, const uint8_t* data, size_t data_size) {
+    bus->data.send = data;
+    onewire_slave_start_operation(bus, OneWireSlaveStateSend, data_size, NULL, NULL);
 }
 
-bool onewire_slave_send(OneWireSlave* bus, const uint8_t* data, size_t data_size) {
-    furi_hal_gpio_write(bus->gpio_pin, true);
-
-    size_t bytes_sent = 0;
-
-    // bytes loop
-    for(; bytes_sent < data_size; ++bytes_sent) {
-        const uint8_t data_byte = data[bytes_sent];
-
-        // bit loop
-        for(uint8_t bit_mask = 0x01; bit_mask != 0; bit_mask <<= 1) {
-            if(!onewire_slave_send_bit(bus, bit_mask & data_byte)) {
-                return false;
-            }
-        }
-    }
-    return true;
+void onewire_slave_receive(
+    OneWireSlave* bus,
+    uint8_t* data,
+    size_t data_size,
+    OneWireSlaveReceiveCallback callback,
+    void* context) {
+    bus->data.receive = data;
+    onewire_slave_start_operation(bus, OneWireSlaveStateReceive, data_size, callback, context);
 }
 
-bool onewire_slave_receive(OneWireSlave* bus, uint8_t* data, size_t data_size) {
-    furi_hal_gpio_write(bus->gpio_pin, true);
-
-    size_t bytes_received = 0;
-
-    for(; bytes_received < data_size; ++bytes_received) {
-        uint8_t value = 0;
-
-        for(uint8_t bit_mask = 0x01; bit_mask != 0; bit_mask <<= 1) {
-            if(onewire_slave_receive_bit(bus)) {
-                value |= bit_mask;
-            }
-
-            if(bus->error != OneWireSlaveErrorNone) {
-                return false;
-            }
-        }
-
-        data[bytes_received] = value;
-    }
-    return true;
+void onewire_slave_search(OneWireSlave* bus, const uint8_t* data, size_t data_size) {
+    bus->data.send = data;
+    onewire_slave_start_operation(bus, OneWireSlaveStateSearch, data_size, NULL, NULL);
 }
 
 void onewire_slave_set_overdrive(OneWireSlave* bus, bool set) {
-    const OneWireSlaveTimings* new_timings = set ? &onewire_slave_timings_overdrive :
-                                                   &onewire_slave_timings_normal;
-    if(bus->timings != new_timings) {
-        /* Prevent erroneous reset by waiting for the previous time slot to finish */
-        onewire_slave_wait_while_gpio_is(bus, bus->timings->tslot_max, false);
-        bus->timings = new_timings;
-    }
+    /* Called on rising edges only, so no time slot is cut short by the switch */
+    bus->timings = set ? &onewire_slave_timings_overdrive : &onewire_slave_timings_normal;
 }
@@ -21,6 +21,7 @@ typedef struct OneWireSlave OneWireSlave;
 typedef bool (*OneWireSlaveResetCallback)(bool is_short, void* context);
 typedef bool (*OneWireSlaveCommandCallback)(uint8_t command, void* context);
 typedef void (*OneWireSlaveResultCallback)(void* context);
+typedef bool (*OneWireSlaveReceiveCallback)(void* context);
 
 /**
  * Allocate OneWireSlave instance
@@ -47,38 +48,46 @@ void onewire_slave_start(OneWireSlave* bus);
  */
 void onewire_slave_stop(OneWireSlave* bus);
 
-/**
- * Receive one bit
- * @param [in] bus pointer to OneWireSlave instance
- * @return received bit value
+/*
+ * Bus operations are driven by bus edges in interrupt context. They are meant to be
+ * started from within callbacks, only one at a time and only the last one started
+ * counts. Data buffers must stay valid until the operation is over.
+ * An operation is aborted by a reset, and once it is over, a new command is received
+ * if the callback that started it returned true, or the result callback is called.
  */
-bool onewire_slave_receive_bit(OneWireSlave* bus);
 
 /**
- * Send one bit
- * @param [in] bus pointer to OneWireSlave instance
- * @param [in] value bit value to send
- * @return true on success, false on failure
- */
-bool onewire_slave_send_bit(OneWireSlave* bus, bool value);
-
-/**
- * Send one or more bytes of data
+ * Start sending one or more bytes of data
  * @param [in] bus pointer to OneWireSlave instance
  * @param [in] data pointer to the data to send
  * @param [in] data_size size of the data to send
- * @return true on success, false on failure
  */
-bool onewire_slave_send(OneWireSlave* bus, const uint8_t* data, size_t data_size);
+void onewire_slave_send(OneWireSlave* bus, const uint8_t* data, size_t data_size);
 
 /**
- * Receive one or more bytes of data
+ * Start receiving one or more bytes of data
  * @param [in] bus pointer to OneWireSlave instance
  * @param [out] data pointer to the receive buffer
  * @param [in] data_size number of bytes to receive
- * @return true on success, false on failure
+ * @param [in] callback function to call once data is received, its return value
+ *                      replaces the one of the callback that started receiving
+ * @param [in] context additional parameter to be passed to the callback
+ */
+void onewire_slave_receive(
+    OneWireSlave* bus,
+    uint8_t* data,
+    size_t data_size,
+    OneWireSlaveReceiveCallback callback,
+    void* context);
+
+/**
+ * Start Search ROM answer: each bit of data is sent along with its complement, then
+ * master choice is received. Search is aborted as soon as master chooses another device.
+ * @param [in] bus pointer to OneWireSlave instance
+ * @param [in] data pointer to the ROM data
+ * @param [in] data_size size of the ROM data
  */
-bool onewire_slave_receive(OneWireSlave* bus, uint8_t* data, size_t data_size);
+void onewire_slave_search(OneWireSlave* bus, const uint8_t* data, size_t data_size);
 
 /**
  * Enable overdrive mode
@@ -105,8 +114,8 @@ void onewire_slave_set_reset_callback(
 
 /**
  * Set a callback function to be called on each command.
- * The return value of the callback determines whether further operation
- * is possible. As a rule of thumb, return true unless a critical error happened.
+ * The return value of the callback determines whether another command is expected
+ * after the operation started by the callback, if any, is over.
  *
  * @param [in] bus pointer to OneWireSlave instance
  * @param [in] callback pointer to a callback function
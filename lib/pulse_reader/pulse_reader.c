@@ -182,48 +182,55 @@ void pulse_reader_start(PulseReader* signal) {
     LL_DMA_EnableChannel(DMA1, signal->dma_channel + 1);
 }
 
+static inline uint32_t pulse_reader_get_dma_pos(PulseReader* signal) {
+    /* get the DMA's next write position by reading "remaining length" register */
+    return signal->size - (uint32_t)LL_DMA_GetDataLength(DMA1, signal->dma_channel);
+}
+
+/* consume the edge at the read position, must only be called if the DMA has advanced */
+static uint32_t pulse_reader_next(PulseReader* signal) {
+    /* timer is free running over the full 32 bits, so differences wrap properly */
+    uint32_t delta = signal->timer_buffer[signal->pos] - signal->timer_value;
+    uint32_t last_gpio_value = signal->gpio_value;
+
+    signal->gpio_value = signal->gpio_buffer[signal->pos];
+
+    /* check if the GPIO really toggled. if not, we lost an edge :( */
+    if(((last_gpio_value ^ signal->gpio_value) & signal->gpio_mask) != signal->gpio_mask) {
+        signal->gpio_value ^= signal->gpio_mask;
+        return PULSE_READER_LOST_EDGE;
+    }
+    signal->timer_value = signal->timer_buffer[signal->pos];
+
+    signal->pos++;
+    signal->pos %= signal->size;
+
+    uint32_t delta_unit = 0;
+
+    /* probably larger values, so choose a wider data type */
+    if(signal->unit_divider > 1) {
+        delta_unit =
+            (uint32_t)((uint64_t)delta * (uint64_t)signal->unit_multiplier / signal->unit_divider);
+    } else {
+        delta_unit = delta * signal->unit_multiplier;
+    }
+
+    /* if to be scaled to bit times, save a few instructions. should be faster */
+    if(signal->bit_time > 1) {
+        return (delta_unit + signal->bit_time / 2) / signal->bit_time;
+    }
+
+    return delta_unit;
+}
+
 uint32_t pulse_reader_receive(PulseReader* signal, int timeout_us) {
     uint32_t start_time = DWT->CYCCNT;
     uint32_t timeout_ticks = timeout_us * (F_TIM2 / 1000000);
 
     do {
-        /* get the DMA's next write position by reading "remaining length" register */
-        uint32_t dma_pos =
-            signal->size - (uint32_t)LL_DMA_GetDataLength(DMA1, signal->dma_channel);
-
         /* the DMA has advanced in the ringbuffer */
-        if(dma_pos != signal->pos) {
-            uint32_t delta = signal->timer_buffer[signal->pos] - signal->timer_value;
-            uint32_t last_gpio_value = signal->gpio_value;
-
-            signal->gpio_value = signal->gpio_buffer[signal->pos];
-
-            /* check if the GPIO really toggled. if not, we lost an edge :( */
-            if(((last_gpio_value ^ signal->gpio_value) & signal->gpio_mask) != signal->gpio_mask) {
-                signal->gpio_value ^= signal->gpio_mask;
-                return PULSE_READER_LOST_EDGE;
-            }
-            signal->timer_value = signal->timer_buffer[signal->pos];
-
-            signal->pos++;
-            signal->pos %= signal->size;
-
-            uint32_t delta_unit = 0;
-
-            /* probably larger values, so choose a wider data type */
-            if(signal->unit_divider > 1) {
-                delta_unit =
-                    (uint32_t)((uint64_t)delta * (uint64_t)signal->unit_multiplier / signal->unit_divider);
-            } else {
-                delta_unit = delta * signal->unit_multiplier;
-            }
-
-            /* if to be scaled to bit times, save a few instructions. should be faster */
-            if(signal->bit_time > 1) {
-                return (delta_unit + signal->bit_time / 2) / signal->bit_time;
-            }
-
-            return delta_unit;
+        if(pulse_reader_get_dma_pos(signal) != signal->pos) {
+            return pulse_reader_next(signal);
         }
 
         /* check for timeout */
@@ -234,3 +241,18 @@ uint32_t pulse_reader_receive(PulseReader* signal, int timeout_us) {
         }
     } while(true);
 }
+
+size_t pulse_reader_receive_batch(PulseReader* signal, uint32_t* pulses, size_t count) {
+    furi_assert(signal);
+    furi_assert(pulses);
+
+    /* edges captured after this point are left for the next call */
+    uint32_t dma_pos = pulse_reader_get_dma_pos(signal);
+    size_t received = 0;
+
+    while(received < count && dma_pos != signal->pos) {
+        pulses[received++] = pulse_reader_next(signal);
+    }
+
+    return received;
+}
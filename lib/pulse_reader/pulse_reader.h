@@ -75,6 +75,19 @@ void pulse_reader_stop(PulseReader* signal);
  */
 uint32_t pulse_reader_receive(PulseReader* signal, int timeout_us);
 
+/** Receive all pending samples from ringbuffer
+ *
+ * Does not wait. Each written value is scaled the same way as by pulse_reader_receive(),
+ * a lost edge is reported with PULSE_READER_LOST_EDGE in place.
+ *
+ * @param[in]  signal  previously allocated PulseReader object.
+ * @param[out] pulses  array to store the values in
+ * @param[in]  count   size of the array
+ *
+ * @returns the number of values written
+ */
+size_t pulse_reader_receive_batch(PulseReader* signal, uint32_t* pulses, size_t count);
+
 /** Get available samples
  *
  * Get the number of available samples in the ringbuffer
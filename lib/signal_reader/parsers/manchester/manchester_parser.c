@@ -0,0 +1,186 @@
+#include "manchester_parser.h"
+
+#include <toolbox/bit_buffer.h>
+
+#include <furi/furi.h>
+
+#define MANCHESTER_PARSER_SIGNAL_READER_BUFF_SIZE (2)
+#define MANCHESTER_PARSER_PAIRS_PER_BYTE (4)
+
+#define TAG "ManchesterParser"
+
+typedef enum {
+    ManchesterParserStateReceive,
+    ManchesterParserStateDone,
+    ManchesterParserStateFail,
+} ManchesterParserState;
+
+struct ManchesterParser {
+    volatile ManchesterParserState state;
+    ManchesterParserConvention convention;
+
+    SignalReader* signal_reader;
+
+    /* Low nibble is 4 decoded bits, high nibble is count of valid sample pairs */
+    uint8_t decode_table[256];
+
+    BitBuffer* parsed_frame;
+
+    ManchesterParserCallback callback;
+    void* context;
+};
+
+static void manchester_parser_build_table(ManchesterParser* instance) {
+    // Earlier sample is the lower bit of a pair
+    const uint8_t pair_high_low = 0x01;
+    const uint8_t pair_low_high = 0x02;
+    const uint8_t pair_one = (instance->convention == ManchesterParserConventionIeee) ?
+                                 pair_low_high :
+                                 pair_high_low;
+
+    for(size_t i = 0; i < COUNT_OF(instance->decode_table); i++) {
+        uint8_t data = 0;
+        uint8_t count = 0;
+        for(; count < MANCHESTER_PARSER_PAIRS_PER_BYTE; count++) {
+            const uint8_t pair = (i >> (count * 2)) & 0x03;
+            if(pair != pair_high_low && pair != pair_low_high) break;
+            if(pair == pair_one) data |= 1U << count;
+        }
+        instance->decode_table[i] = (count << 4) | data;
+    }
+}
+
+ManchesterParser*
+    manchester_parser_alloc(const GpioPin* pin, uint32_t half_bit_period, size_t max_frame_size) {
+    ManchesterParser* instance = malloc(sizeof(ManchesterParser));
+    instance->parsed_frame = bit_buffer_alloc(max_frame_size);
+
+    instance->signal_reader = signal_reader_alloc(pin, MANCHESTER_PARSER_SIGNAL_READER_BUFF_SIZE);
+    signal_reader_set_sample_rate(
+        instance->signal_reader, SignalReaderTimeUnit64Mhz, half_bit_period);
+    signal_reader_set_pull(instance->signal_reader, GpioPullDown);
+    signal_reader_set_polarity(instance->signal_reader, SignalReaderPolarityNormal);
+    signal_reader_set_trigger(instance->signal_reader, SignalReaderTriggerRisingFallingEdge);
+
+    instance->convention = ManchesterParserConventionIeee;
+    manchester_parser_build_table(instance);
+
+    return instance;
+}
+
+void manchester_parser_free(ManchesterParser* instance) {
+    furi_assert(instance);
+
+    bit_buffer_free(instance->parsed_frame);
+    signal_reader_free(instance->signal_reader);
+    free(instance);
+}
+
+void manchester_parser_set_convention(
+    ManchesterParser* instance,
+    ManchesterParserConvention convention) {
+    furi_assert(instance);
+
+    instance->convention = convention;
+    manchester_parser_build_table(instance);
+}
+
+void manchester_parser_reset(ManchesterParser* instance) {
+    furi_assert(instance);
+
+    instance->state = ManchesterParserStateReceive;
+    bit_buffer_reset(instance->parsed_frame);
+}
+
+static void manchester_parser_finish(ManchesterParser* instance, ManchesterParserState state) {
+    instance->state = state;
+    instance->callback(ManchesterParserEventDataReceived, instance->context);
+}
+
+static void signal_reader_callback(SignalReaderEvent event, void* context) {
+    furi_assert(context);
+    furi_assert(event.data->data);
+
+    ManchesterParser* instance = context;
+    furi_assert(instance->callback);
+
+    if(instance->state != ManchesterParserStateReceive) return;
+
+    BitBuffer* frame = instance->parsed_frame;
+    const size_t capacity_bits = bit_buffer_get_capacity_bytes(frame) * 8;
+
+    for(size_t i = 0; i < event.data->len; i++) {
+        const uint8_t entry = instance->decode_table[event.data->data[i]];
+        const uint8_t count = entry >> 4;
+
+        if(bit_buffer_get_size(frame) + count > capacity_bits) {
+            manchester_parser_finish(instance, ManchesterParserStateFail);
+            break;
+        }
+
+        for(uint8_t j = 0; j < count; j++) {
+            bit_buffer_append_bit(frame, FURI_BIT(entry, j));
+        }
+
+        if(count < MANCHESTER_PARSER_PAIRS_PER_BYTE) {
+            const bool is_empty = bit_buffer_get_size(frame) == 0;
+            manchester_parser_finish(
+                instance, is_empty ? ManchesterParserStateFail : ManchesterParserStateDone);
+            break;
+        }
+    }
+}
+
+static void manchester_parser_start_signal_reader(ManchesterParser* instance) {
+    manchester_parser_reset(instance);
+    signal_reader_start(instance->signal_reader, signal_reader_callback, instance);
+}
+
+void manchester_parser_start(
+    ManchesterParser* instance,
+    ManchesterParserCallback callback,
+    void* context) {
+    furi_assert(instance);
+    furi_assert(callback);
+
+    instance->callback = callback;
+    instance->context = context;
+    manchester_parser_start_signal_reader(instance);
+}
+
+void manchester_parser_stop(ManchesterParser* instance) {
+    furi_assert(instance);
+
+    signal_reader_stop(instance->signal_reader);
+}
+
+bool manchester_parser_run(ManchesterParser* instance) {
+    furi_assert(instance);
+
+    if(instance->state == ManchesterParserStateFail) {
+        manchester_parser_stop(instance);
+        manchester_parser_start_signal_reader(instance);
+        FURI_LOG_D(TAG, "Frame parse failed");
+    }
+
+    return instance->state == ManchesterParserStateDone;
+}
+
+size_t manchester_parser_get_data_size_bytes(ManchesterParser* instance) {
+    furi_assert(instance);
+
+    return bit_buffer_get_size_bytes(instance->parsed_frame);
+}
+
+void manchester_parser_get_data(
+    ManchesterParser* instance,
+    uint8_t* buff,
+    size_t buff_size,
+    size_t* data_bits) {
+    furi_assert(instance);
+    furi_assert(buff);
+    furi_assert(data_bits);
+
+    bit_buffer_write_bytes(instance->parsed_frame, buff, buff_size);
+    *data_bits = bit_buffer_get_size(instance->parsed_frame);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../../signal_reader.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Manchester frame parser on top of SignalReader.
+ *
+ * Line is sampled twice per bit and sample pairs are decoded with a lookup table in
+ * the DMA interrupt, so no per edge interrupts are needed. Sampling starts on the first
+ * edge, which must be the beginning of a half bit. Frame ends on the first invalid pair,
+ * i.e. when the line stays idle for a full bit.
+ */
+typedef struct ManchesterParser ManchesterParser;
+
+typedef enum {
+    ManchesterParserEventDataReceived,
+} ManchesterParserEvent;
+
+typedef enum {
+    ManchesterParserConventionIeee, /**< 0 is high to low, 1 is low to high */
+    ManchesterParserConventionThomas, /**< 0 is low to high, 1 is high to low */
+} ManchesterParserConvention;
+
+typedef void (*ManchesterParserCallback)(ManchesterParserEvent event, void* context);
+
+/**
+ * @param pin             input pin
+ * @param half_bit_period half bit duration in 64MHz ticks
+ * @param max_frame_size  maximum frame size in bytes
+ */
+ManchesterParser*
+    manchester_parser_alloc(const GpioPin* pin, uint32_t half_bit_period, size_t max_frame_size);
+
+void manchester_parser_free(ManchesterParser* instance);
+
+void manchester_parser_set_convention(
+    ManchesterParser* instance,
+    ManchesterParserConvention convention);
+
+void manchester_parser_reset(ManchesterParser* instance);
+
+void manchester_parser_start(
+    ManchesterParser* instance,
+    ManchesterParserCallback callback,
+    void* context);
+
+void manchester_parser_stop(ManchesterParser* instance);
+
+/** Check reception state, restarts reception after a failed frame
+ *
+ * @return true if frame is received
+ */
+bool manchester_parser_run(ManchesterParser* instance);
+
+size_t manchester_parser_get_data_size_bytes(ManchesterParser* instance);
+
+void manchester_parser_get_data(
+    ManchesterParser* instance,
+    uint8_t* buff,
+    size_t buff_size,
+    size_t* data_bits);
+
+#ifdef __cplusplus
+}
+#endif
@@ -40,6 +40,9 @@ struct SignalReader {
     uint8_t* bitstream_buffer;
     uint32_t cnt_en;
 
+    uint8_t pin_pos;
+    uint8_t invert;
+
     uint32_t tim_cnt_compensation;
     uint32_t tim_arr;
 
@@ -123,65 +126,52 @@ void signal_reader_set_trigger(SignalReader* instance, SignalReaderTrigger trigg
     instance->trigger = trigger;
 }
 
+/* Packs 8 GPIO samples per byte, LSB is the earliest sample */
+static void signal_reader_pack_samples(
+    SignalReader* instance,
+    const uint16_t* gpio_buff,
+    uint8_t* bitstream_buff) {
+    const uint8_t pin_pos = instance->pin_pos;
+    const uint8_t invert = instance->invert;
+
+    for(size_t i = 0; i < instance->buffer_size / 2; i++) {
+        uint8_t byte = 0;
+        for(size_t j = 0; j < 8; j++) {
+            byte |= ((gpio_buff[j] >> pin_pos) & 1U) << j;
+        }
+        bitstream_buff[i] = byte ^ invert;
+        gpio_buff += 8;
+    }
+}
+
+static void signal_reader_process_half_buffer(
+    SignalReader* instance,
+    SignalReaderEventType type,
+    size_t offset) {
+    instance->event.type = type;
+
+    if(instance->callback) {
+        uint8_t* bitstream_buff_start = &instance->bitstream_buffer[offset];
+        signal_reader_pack_samples(
+            instance, &instance->gpio_buffer[offset * 8], bitstream_buff_start);
+
+        instance->event_data.data = bitstream_buff_start;
+        instance->event_data.len = instance->buffer_size / 2;
+        instance->callback(instance->event, instance->context);
+    }
+}
+
 static void furi_hal_sw_digital_pin_dma_rx_isr(void* context) {
     SignalReader* instance = context;
 
-    uint16_t* gpio_buff_start = NULL;
-    uint8_t* bitstream_buff_start = NULL;
-
     if(LL_DMA_IsActiveFlag_HT2(SIGNAL_READER_DMA)) {
         LL_DMA_ClearFlag_HT2(SIGNAL_READER_DMA);
-        instance->event.type = SignalReaderEventTypeHalfBufferFilled;
-        gpio_buff_start = instance->gpio_buffer;
-        bitstream_buff_start = instance->bitstream_buffer;
-
-        if(instance->callback) {
-            furi_assert(gpio_buff_start);
-            furi_assert(bitstream_buff_start);
-
-            for(size_t i = 0; i < instance->buffer_size * 4; i++) {
-                if((i % 8) == 0) {
-                    bitstream_buff_start[i / 8] = 0;
-                }
-                uint8_t bit = 0;
-                if(instance->polarity == SignalReaderPolarityNormal) {
-                    bit = (gpio_buff_start[i] & instance->pin->pin) == instance->pin->pin;
-                } else {
-                    bit = (gpio_buff_start[i] & instance->pin->pin) == 0;
-                }
-                bitstream_buff_start[i / 8] |= bit << (i % 8);
-            }
-            instance->event_data.data = bitstream_buff_start;
-            instance->event_data.len = instance->buffer_size / 2;
-            instance->callback(instance->event, instance->context);
-        }
+        signal_reader_process_half_buffer(instance, SignalReaderEventTypeHalfBufferFilled, 0);
     }
     if(LL_DMA_IsActiveFlag_TC2(SIGNAL_READER_DMA)) {
         LL_DMA_ClearFlag_TC2(SIGNAL_READER_DMA);
-        instance->event.type = SignalReaderEventTypeFullBufferFilled;
-        gpio_buff_start = &instance->gpio_buffer[instance->buffer_size * 4];
-        bitstream_buff_start = &instance->bitstream_buffer[instance->buffer_size / 2];
-
-        if(instance->callback) {
-            furi_assert(gpio_buff_start);
-            furi_assert(bitstream_buff_start);
-
-            for(size_t i = 0; i < instance->buffer_size * 4; i++) {
-                if((i % 8) == 0) {
-                    bitstream_buff_start[i / 8] = 0;
-                }
-                uint8_t bit = 0;
-                if(instance->polarity == SignalReaderPolarityNormal) {
-                    bit = (gpio_buff_start[i] & instance->pin->pin) == instance->pin->pin;
-                } else {
-                    bit = (gpio_buff_start[i] & instance->pin->pin) == 0;
-                }
-                bitstream_buff_start[i / 8] |= bit << (i % 8);
-            }
-            instance->event_data.data = bitstream_buff_start;
-            instance->event_data.len = instance->buffer_size / 2;
-            instance->callback(instance->event, instance->context);
-        }
+        signal_reader_process_half_buffer(
+            instance, SignalReaderEventTypeFullBufferFilled, instance->buffer_size / 2);
     }
 }
 
@@ -192,6 +182,9 @@ void signal_reader_start(SignalReader* instance, SignalReaderCallback callback,
     instance->callback = callback;
     instance->context = context;
 
+    instance->pin_pos = __builtin_ctz(instance->pin->pin);
+    instance->invert = (instance->polarity == SignalReaderPolarityInverted) ? 0xff : 0x00;
+
     // EXTI delay compensation
     instance->tim_cnt_compensation = 9;
     instance->cnt_en = SIGNAL_READER_CAPTURE_TIM->CR1;
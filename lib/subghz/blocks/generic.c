@@ -168,4 +168,18 @@ SubGhzProtocolStatus subghz_block_generic_deserialize_check_count_bit(
         }
     } while(false);
     return ret;
-}
\ No newline at end of file
+}
+
+void subghz_block_generic_get_compact(
+    const SubGhzBlockGeneric* instance,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(instance);
+    furi_assert(output);
+
+    output->key = instance->data;
+    output->serial = instance->serial;
+    output->counter = instance->cnt;
+    output->bit_count = instance->data_count_bit;
+    output->button = instance->btn;
+    output->manufacture = NULL;
+}
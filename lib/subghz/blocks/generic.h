@@ -69,6 +69,15 @@ SubGhzProtocolStatus subghz_block_generic_deserialize_check_count_bit(
     FlipperFormat* flipper_format,
     uint16_t count_bit);
 
+/**
+ * Fill compact representation from SubGhzBlockGeneric.
+ * @param instance Pointer to a SubGhzBlockGeneric instance
+ * @param output Resulting summary, manufacture is reset
+ */
+void subghz_block_generic_get_compact(
+    const SubGhzBlockGeneric* instance,
+    SubGhzProtocolDecoderCompact* output);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "preset_scheduler.h"
+
+#include <furi.h>
+
+#define TAG "SubGhzPresetScheduler"
+
+#define SUBGHZ_PRESET_SCHEDULER_EVENT_STOP (1 << 0)
+
+typedef struct {
+    uint8_t* preset_data;
+    SubGhzProtocolFlag modulation;
+} SubGhzPresetSchedulerSlot;
+
+struct SubGhzPresetScheduler {
+    const SubGhzDevice* device;
+    FuriThread* thread;
+
+    SubGhzPresetSchedulerSlot slots[SUBGHZ_PRESET_SCHEDULER_SLOTS_MAX];
+    size_t slots_count;
+    size_t slot_index;
+    uint32_t frequency;
+    uint32_t slot_ms;
+    bool running;
+
+    volatile SubGhzProtocolFlag modulation;
+    volatile uint32_t generation;
+};
+
+static void subghz_preset_scheduler_switch(SubGhzPresetScheduler* instance, size_t slot_index) {
+    SubGhzPresetSchedulerSlot* slot = &instance->slots[slot_index];
+
+    // Preset load resets the chip, frequency has to be restored
+    subghz_devices_idle(instance->device);
+    subghz_devices_load_preset(instance->device, FuriHalSubGhzPresetCustom, slot->preset_data);
+    subghz_devices_set_frequency(instance->device, instance->frequency);
+    subghz_devices_set_rx(instance->device);
+
+    instance->slot_index = slot_index;
+    instance->modulation = slot->modulation;
+    __atomic_add_fetch(&instance->generation, 1, __ATOMIC_RELEASE);
+}
+
+static int32_t subghz_preset_scheduler_thread(void* context) {
+    SubGhzPresetScheduler* instance = context;
+
+    while(true) {
+        uint32_t flags = furi_thread_flags_wait(
+            SUBGHZ_PRESET_SCHEDULER_EVENT_STOP,
+            FuriFlagWaitAny,
+            furi_ms_to_ticks(instance->slot_ms));
+        if(!(flags & FuriFlagError) && (flags & SUBGHZ_PRESET_SCHEDULER_EVENT_STOP)) break;
+
+        subghz_preset_scheduler_switch(
+            instance, (instance->slot_index + 1) % instance->slots_count);
+    }
+
+    return 0;
+}
+
+SubGhzPresetScheduler* subghz_preset_scheduler_alloc(void) {
+    SubGhzPresetScheduler* instance = malloc(sizeof(SubGhzPresetScheduler));
+    instance->thread = furi_thread_alloc_ex(
+        "SubGhzPresetScheduler", 1024, subghz_preset_scheduler_thread, instance);
+    return instance;
+}
+
+void subghz_preset_scheduler_free(SubGhzPresetScheduler* instance) {
+    furi_assert(instance);
+    if(subghz_preset_scheduler_is_running(instance)) subghz_preset_scheduler_stop(instance);
+    furi_thread_free(instance->thread);
+    free(instance);
+}
+
+bool subghz_preset_scheduler_add(
+    SubGhzPresetScheduler* instance,
+    uint8_t* preset_data,
+    SubGhzProtocolFlag modulation) {
+    furi_assert(instance);
+    furi_assert(preset_data);
+    furi_assert(!subghz_preset_scheduler_is_running(instance));
+
+    if(instance->slots_count >= SUBGHZ_PRESET_SCHEDULER_SLOTS_MAX) return false;
+
+    SubGhzPresetSchedulerSlot* slot = &instance->slots[instance->slots_count++];
+    slot->preset_data = preset_data;
+    slot->modulation = modulation & (SubGhzProtocolFlag_AM | SubGhzProtocolFlag_FM);
+    return true;
+}
+
+void subghz_preset_scheduler_clear(SubGhzPresetScheduler* instance) {
+    furi_assert(instance);
+    furi_assert(!subghz_preset_scheduler_is_running(instance));
+    instance->slots_count = 0;
+}
+
+size_t subghz_preset_scheduler_get_count(SubGhzPresetScheduler* instance) {
+    furi_assert(instance);
+    return instance->slots_count;
+}
+
+void subghz_preset_scheduler_start(
+    SubGhzPresetScheduler* instance,
+    const SubGhzDevice* device,
+    uint32_t frequency,
+    uint32_t slot_ms) {
+    furi_assert(instance);
+    furi_assert(device);
+    furi_assert(instance->slots_count > 0);
+    furi_assert(!subghz_preset_scheduler_is_running(instance));
+
+    instance->device = device;
+    instance->frequency = frequency;
+    instance->slot_ms = slot_ms;
+    subghz_preset_scheduler_switch(instance, 0);
+    if(instance->slots_count > 1) {
+        furi_thread_start(instance->thread);
+    }
+    instance->running = true;
+    FURI_LOG_D(TAG, "Start %zu slots at %lu", instance->slots_count, frequency);
+}
+
+void subghz_preset_scheduler_stop(SubGhzPresetScheduler* instance) {
+    furi_assert(instance);
+    furi_assert(subghz_preset_scheduler_is_running(instance));
+
+    // Device is not touched once thread is joined
+    if(instance->slots_count > 1) {
+        furi_thread_flags_set(
+            furi_thread_get_id(instance->thread), SUBGHZ_PRESET_SCHEDULER_EVENT_STOP);
+        furi_thread_join(instance->thread);
+    }
+    instance->running = false;
+    instance->modulation = 0;
+    __atomic_add_fetch(&instance->generation, 1, __ATOMIC_RELEASE);
+}
+
+bool subghz_preset_scheduler_is_running(SubGhzPresetScheduler* instance) {
+    furi_assert(instance);
+    return instance->running;
+}
+
+SubGhzProtocolFlag
+    subghz_preset_scheduler_get_modulation(SubGhzPresetScheduler* instance, uint32_t* generation) {
+    furi_assert(instance);
+    furi_assert(generation);
+    *generation = __atomic_load_n(&instance->generation, __ATOMIC_ACQUIRE);
+    return instance->modulation;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "devices.h"
+#include "../types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SUBGHZ_PRESET_SCHEDULER_SLOTS_MAX 4
+
+/** Alternates presets on one device and frequency while async RX is running.
+ *
+ * Pulses keep flowing through the async RX callback across switches. The
+ * pulse consumer polls subghz_preset_scheduler_get_modulation() per batch,
+ * resets its decoders when the generation changes and feeds the batch only
+ * to decoders of the returned modulation.
+ */
+typedef struct SubGhzPresetScheduler SubGhzPresetScheduler;
+
+/**
+ * Allocate SubGhzPresetScheduler.
+ * @return SubGhzPresetScheduler* pointer to a SubGhzPresetScheduler instance
+ */
+SubGhzPresetScheduler* subghz_preset_scheduler_alloc(void);
+
+/**
+ * Free SubGhzPresetScheduler.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ */
+void subghz_preset_scheduler_free(SubGhzPresetScheduler* instance);
+
+/**
+ * Add preset slot, scheduler must be stopped.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ * @param preset_data Custom preset registers, must stay valid while scheduler is used
+ * @param modulation SubGhzProtocolFlag_AM or SubGhzProtocolFlag_FM
+ * @return true if slot was added, false if there are no free slots
+ */
+bool subghz_preset_scheduler_add(
+    SubGhzPresetScheduler* instance,
+    uint8_t* preset_data,
+    SubGhzProtocolFlag modulation);
+
+/**
+ * Remove all preset slots, scheduler must be stopped.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ */
+void subghz_preset_scheduler_clear(SubGhzPresetScheduler* instance);
+
+/**
+ * Get number of preset slots.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ * @return slots count
+ */
+size_t subghz_preset_scheduler_get_count(SubGhzPresetScheduler* instance);
+
+/**
+ * Start switching presets. Device must already be receiving on the frequency.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ * @param device Pointer to a SubGhzDevice instance
+ * @param frequency Frequency to restore after each preset load, Hz
+ * @param slot_ms Time to stay on each preset, ms
+ */
+void subghz_preset_scheduler_start(
+    SubGhzPresetScheduler* instance,
+    const SubGhzDevice* device,
+    uint32_t frequency,
+    uint32_t slot_ms);
+
+/**
+ * Stop switching presets. Device stays on the preset of the last slot.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ */
+void subghz_preset_scheduler_stop(SubGhzPresetScheduler* instance);
+
+/**
+ * Check if scheduler is running.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ * @return true if running
+ */
+bool subghz_preset_scheduler_is_running(SubGhzPresetScheduler* instance);
+
+/**
+ * Get modulation of the active slot, safe to call from any thread.
+ * @param instance Pointer to a SubGhzPresetScheduler instance
+ * @param generation Output, incremented on every preset switch
+ * @return modulation of the active slot, 0 while not running
+ */
+SubGhzProtocolFlag
+    subghz_preset_scheduler_get_modulation(SubGhzPresetScheduler* instance, uint32_t* generation);
+
+#ifdef __cplusplus
+}
+#endif
@@ -93,6 +93,7 @@ const SubGhzProtocol ws_protocol_acurite_592txr = {
     .encoder = &ws_protocol_acurite_592txr_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_acurite_592txr_const,
 };
 
 void* ws_protocol_decoder_acurite_592txr_alloc(SubGhzEnvironment* environment) {
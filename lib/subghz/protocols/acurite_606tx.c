@@ -76,6 +76,7 @@ const SubGhzProtocol ws_protocol_acurite_606tx = {
     .encoder = &ws_protocol_acurite_606tx_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_acurite_606tx_const,
 };
 
 void* ws_protocol_decoder_acurite_606tx_alloc(SubGhzEnvironment* environment) {
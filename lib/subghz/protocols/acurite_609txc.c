@@ -77,6 +77,7 @@ const SubGhzProtocol ws_protocol_acurite_609txc = {
     .encoder = &ws_protocol_acurite_609txc_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_acurite_609txc_const,
 };
 
 void* ws_protocol_decoder_acurite_609txc_alloc(SubGhzEnvironment* environment) {
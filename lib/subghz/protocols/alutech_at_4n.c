@@ -58,6 +58,7 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
     .deserialize = subghz_protocol_decoder_alutech_at_4n_deserialize,
     .get_string = subghz_protocol_decoder_alutech_at_4n_get_string,
+    .get_compact = subghz_protocol_decoder_alutech_at_4n_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder = {
@@ -77,6 +78,7 @@ const SubGhzProtocol subghz_protocol_alutech_at_4n = {
 
     .decoder = &subghz_protocol_alutech_at_4n_decoder,
     .encoder = &subghz_protocol_alutech_at_4n_encoder,
+    .timing = &subghz_protocol_alutech_at_4n_const,
 };
 
 static void subghz_protocol_alutech_at_4n_remote_controller(
@@ -799,6 +801,15 @@ static uint8_t subghz_protocol_alutech_at_4n_get_btn_code() {
     return btn;
 }
 
+bool subghz_protocol_decoder_alutech_at_4n_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAlutech_at_4n* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_alutech_at_4n_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderAlutech_at_4n* instance = context;
@@ -100,6 +100,16 @@ SubGhzProtocolStatus subghz_protocol_decoder_alutech_at_4n_serialize(
 SubGhzProtocolStatus
     subghz_protocol_decoder_alutech_at_4n_deserialize(void* context, FlipperFormat* flipper_format);
 
+/**
+ * Getting a compact representation of the received data, no allocations.
+ * @param context Pointer to a SubGhzProtocolDecoderAlutech_at_4n instance
+ * @param output Resulting summary
+ * @return true On success
+ */
+bool subghz_protocol_decoder_alutech_at_4n_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output);
+
 /**
  * Getting a textual representation of the received data.
  * @param context Pointer to a SubGhzProtocolDecoderAlutech_at_4n instance
@@ -91,6 +91,7 @@ const SubGhzProtocol ws_protocol_ambient_weather = {
     .encoder = &ws_protocol_ambient_weather_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_ambient_weather_const,
 };
 
 void* ws_protocol_decoder_ambient_weather_alloc(SubGhzEnvironment* environment) {
@@ -53,6 +53,7 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .serialize = subghz_protocol_decoder_ansonic_serialize,
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
+    .get_compact = subghz_protocol_decoder_ansonic_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
@@ -73,6 +74,7 @@ const SubGhzProtocol subghz_protocol_ansonic = {
 
     .decoder = &subghz_protocol_ansonic_decoder,
     .encoder = &subghz_protocol_ansonic_encoder,
+    .timing = &subghz_protocol_ansonic_const,
 };
 
 void* subghz_protocol_encoder_ansonic_alloc(SubGhzEnvironment* environment) {
@@ -319,6 +321,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_ansonic_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_ansonic_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_ansonic_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderAnsonic* instance = context;
@@ -88,6 +88,7 @@ const SubGhzProtocol ws_protocol_auriol_ahfl = {
     .encoder = &ws_protocol_auriol_ahfl_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_auriol_ahfl_const,
 };
 
 void* ws_protocol_decoder_auriol_ahfl_alloc(SubGhzEnvironment* environment) {
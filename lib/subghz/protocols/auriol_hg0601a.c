@@ -87,6 +87,7 @@ const SubGhzProtocol ws_protocol_auriol_th = {
     .encoder = &ws_protocol_auriol_th_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_auriol_th_const,
 };
 
 void* ws_protocol_decoder_auriol_th_alloc(SubGhzEnvironment* environment) {
@@ -23,6 +23,19 @@ bool subghz_protocol_decoder_base_get_string(
     return status;
 }
 
+bool subghz_protocol_decoder_base_get_compact(
+    SubGhzProtocolDecoderBase* decoder_base,
+    SubGhzProtocolDecoderCompact* output) {
+    bool status = false;
+
+    if(decoder_base->protocol && decoder_base->protocol->decoder &&
+       decoder_base->protocol->decoder->get_compact) {
+        status = decoder_base->protocol->decoder->get_compact(decoder_base, output);
+    }
+
+    return status;
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_base_serialize(
     SubGhzProtocolDecoderBase* decoder_base,
     FlipperFormat* flipper_format,
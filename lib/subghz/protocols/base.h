@@ -44,6 +44,16 @@ bool subghz_protocol_decoder_base_get_string(
     SubGhzProtocolDecoderBase* decoder_base,
     FuriString* output);
 
+/**
+ * Getting a compact representation of the received data, without heap allocations.
+ * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
+ * @param output Resulting summary
+ * @return true if protocol supports compact representation
+ */
+bool subghz_protocol_decoder_base_get_compact(
+    SubGhzProtocolDecoderBase* decoder_base,
+    SubGhzProtocolDecoderCompact* output);
+
 /**
  * Serialize data SubGhzProtocolDecoderBase.
  * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
@@ -63,6 +63,7 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .serialize = subghz_protocol_decoder_bett_serialize,
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
+    .get_compact = subghz_protocol_decoder_bett_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
@@ -82,6 +83,7 @@ const SubGhzProtocol subghz_protocol_bett = {
 
     .decoder = &subghz_protocol_bett_decoder,
     .encoder = &subghz_protocol_bett_encoder,
+    .timing = &subghz_protocol_bett_const,
 };
 
 void* subghz_protocol_encoder_bett_alloc(SubGhzEnvironment* environment) {
@@ -313,6 +315,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_bett_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_bett_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_bett_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderBETT* instance = context;
@@ -59,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .serialize = subghz_protocol_decoder_came_serialize,
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
+    .get_compact = subghz_protocol_decoder_came_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
@@ -79,6 +80,7 @@ const SubGhzProtocol subghz_protocol_came = {
 
     .decoder = &subghz_protocol_came_decoder,
     .encoder = &subghz_protocol_came_encoder,
+    .timing = &subghz_protocol_came_const,
 };
 
 void* subghz_protocol_encoder_came_alloc(SubGhzEnvironment* environment) {
@@ -345,6 +347,15 @@ SubGhzProtocolStatus
     return ret;
 }
 
+bool subghz_protocol_decoder_came_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_came_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
@@ -50,6 +50,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
     .deserialize = subghz_protocol_decoder_came_atomo_deserialize,
     .get_string = subghz_protocol_decoder_came_atomo_get_string,
+    .get_compact = subghz_protocol_decoder_came_atomo_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_atomo_encoder = {
@@ -69,6 +70,7 @@ const SubGhzProtocol subghz_protocol_came_atomo = {
 
     .decoder = &subghz_protocol_came_atomo_decoder,
     .encoder = &subghz_protocol_came_atomo_encoder,
+    .timing = &subghz_protocol_came_atomo_const,
 };
 
 static void subghz_protocol_came_atomo_remote_controller(SubGhzBlockGeneric* instance);
@@ -708,6 +710,15 @@ SubGhzProtocolStatus
         subghz_protocol_came_atomo_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_came_atomo_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameAtomo* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_came_atomo_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderCameAtomo* instance = context;
@@ -81,6 +81,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .serialize = subghz_protocol_decoder_came_twee_serialize,
     .deserialize = subghz_protocol_decoder_came_twee_deserialize,
     .get_string = subghz_protocol_decoder_came_twee_get_string,
+    .get_compact = subghz_protocol_decoder_came_twee_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder = {
@@ -100,6 +101,7 @@ const SubGhzProtocol subghz_protocol_came_twee = {
 
     .decoder = &subghz_protocol_came_twee_decoder,
     .encoder = &subghz_protocol_came_twee_encoder,
+    .timing = &subghz_protocol_came_twee_const,
 };
 
 void* subghz_protocol_encoder_came_twee_alloc(SubGhzEnvironment* environment) {
@@ -435,6 +437,15 @@ SubGhzProtocolStatus
         subghz_protocol_came_twee_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_came_twee_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameTwee* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_came_twee_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderCameTwee* instance = context;
@@ -77,6 +77,7 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
     .deserialize = subghz_protocol_decoder_chamb_code_deserialize,
     .get_string = subghz_protocol_decoder_chamb_code_get_string,
+    .get_compact = subghz_protocol_decoder_chamb_code_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_chamb_code_encoder = {
@@ -96,6 +97,7 @@ const SubGhzProtocol subghz_protocol_chamb_code = {
 
     .decoder = &subghz_protocol_chamb_code_decoder,
     .encoder = &subghz_protocol_chamb_code_encoder,
+    .timing = &subghz_protocol_chamb_code_const,
 };
 
 void* subghz_protocol_encoder_chamb_code_alloc(SubGhzEnvironment* environment) {
@@ -458,6 +460,15 @@ SubGhzProtocolStatus
     return ret;
 }
 
+bool subghz_protocol_decoder_chamb_code_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderChamb_Code* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_chamb_code_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderChamb_Code* instance = context;
@@ -62,6 +62,7 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .serialize = subghz_protocol_decoder_clemsa_serialize,
     .deserialize = subghz_protocol_decoder_clemsa_deserialize,
     .get_string = subghz_protocol_decoder_clemsa_get_string,
+    .get_compact = subghz_protocol_decoder_clemsa_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder = {
@@ -81,6 +82,7 @@ const SubGhzProtocol subghz_protocol_clemsa = {
 
     .decoder = &subghz_protocol_clemsa_decoder,
     .encoder = &subghz_protocol_clemsa_encoder,
+    .timing = &subghz_protocol_clemsa_const,
 };
 
 void* subghz_protocol_encoder_clemsa_alloc(SubGhzEnvironment* environment) {
@@ -334,6 +336,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_clemsa_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_clemsa_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderClemsa* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_clemsa_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderClemsa* instance = context;
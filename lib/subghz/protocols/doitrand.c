@@ -54,6 +54,7 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .serialize = subghz_protocol_decoder_doitrand_serialize,
     .deserialize = subghz_protocol_decoder_doitrand_deserialize,
     .get_string = subghz_protocol_decoder_doitrand_get_string,
+    .get_compact = subghz_protocol_decoder_doitrand_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder = {
@@ -73,6 +74,7 @@ const SubGhzProtocol subghz_protocol_doitrand = {
 
     .decoder = &subghz_protocol_doitrand_decoder,
     .encoder = &subghz_protocol_doitrand_encoder,
+    .timing = &subghz_protocol_doitrand_const,
 };
 
 void* subghz_protocol_encoder_doitrand_alloc(SubGhzEnvironment* environment) {
@@ -329,6 +331,15 @@ SubGhzProtocolStatus
         subghz_protocol_doitrand_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_doitrand_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDoitrand* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_doitrand_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderDoitrand* instance = context;
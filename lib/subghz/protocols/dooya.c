@@ -48,6 +48,7 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .serialize = subghz_protocol_decoder_dooya_serialize,
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
+    .get_compact = subghz_protocol_decoder_dooya_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
@@ -68,6 +69,7 @@ const SubGhzProtocol subghz_protocol_dooya = {
 
     .decoder = &subghz_protocol_dooya_decoder,
     .encoder = &subghz_protocol_dooya_encoder,
+    .timing = &subghz_protocol_dooya_const,
 };
 
 void* subghz_protocol_encoder_dooya_alloc(SubGhzEnvironment* environment) {
@@ -412,6 +414,15 @@ static const char* subghz_protocol_dooya_get_name_button(uint8_t btn) {
     return btn_name;
 }
 
+bool subghz_protocol_decoder_dooya_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_dooya_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderDooya* instance = context;
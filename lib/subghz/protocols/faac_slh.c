@@ -69,6 +69,7 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
     .deserialize = subghz_protocol_decoder_faac_slh_deserialize,
     .get_string = subghz_protocol_decoder_faac_slh_get_string,
+    .get_compact = subghz_protocol_decoder_faac_slh_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder = {
@@ -89,6 +90,7 @@ const SubGhzProtocol subghz_protocol_faac_slh = {
 
     .decoder = &subghz_protocol_faac_slh_decoder,
     .encoder = &subghz_protocol_faac_slh_encoder,
+    .timing = &subghz_protocol_faac_slh_const,
 };
 
 /** 
@@ -219,7 +221,7 @@ static bool subghz_protocol_faac_slh_gen_data(SubGhzProtocolEncoderFaacSLH* inst
     }
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+            res = strcmp(manufacture_code->name, instance->manufacture_name);
             if(res == 0) {
                 switch(manufacture_code->type) {
                 case KEELOQ_LEARNING_FAAC:
@@ -559,7 +561,7 @@ static void subghz_protocol_faac_slh_check_remote_controller(
                 man = subghz_protocol_keeloq_common_faac_learning(
                     instance->seed, manufacture_code->key);
                 decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
-                *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                *manufacture_name = manufacture_code->name;
                 break;
             }
         }
@@ -653,6 +655,15 @@ SubGhzProtocolStatus
     return res;
 }
 
+bool subghz_protocol_decoder_faac_slh_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderFaacSLH* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_faac_slh_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderFaacSLH* instance = context;
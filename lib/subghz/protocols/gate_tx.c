@@ -47,6 +47,7 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
     .deserialize = subghz_protocol_decoder_gate_tx_deserialize,
     .get_string = subghz_protocol_decoder_gate_tx_get_string,
+    .get_compact = subghz_protocol_decoder_gate_tx_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_gate_tx_encoder = {
@@ -66,6 +67,7 @@ const SubGhzProtocol subghz_protocol_gate_tx = {
 
     .decoder = &subghz_protocol_gate_tx_decoder,
     .encoder = &subghz_protocol_gate_tx_encoder,
+    .timing = &subghz_protocol_gate_tx_const,
 };
 
 void* subghz_protocol_encoder_gate_tx_alloc(SubGhzEnvironment* environment) {
@@ -307,6 +309,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_gate_tx_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_gate_tx_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderGateTx* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_gate_tx_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderGateTx* instance = context;
@@ -90,6 +90,7 @@ const SubGhzProtocol ws_protocol_gt_wt_02 = {
     .encoder = &ws_protocol_gt_wt_02_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_gt_wt_02_const,
 };
 
 void* ws_protocol_decoder_gt_wt_02_alloc(SubGhzEnvironment* environment) {
@@ -116,6 +116,7 @@ const SubGhzProtocol ws_protocol_gt_wt_03 = {
     .encoder = &ws_protocol_gt_wt_03_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_gt_wt_03_const,
 };
 
 void* ws_protocol_decoder_gt_wt_03_alloc(SubGhzEnvironment* environment) {
@@ -57,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .serialize = subghz_protocol_decoder_holtek_serialize,
     .deserialize = subghz_protocol_decoder_holtek_deserialize,
     .get_string = subghz_protocol_decoder_holtek_get_string,
+    .get_compact = subghz_protocol_decoder_holtek_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_encoder = {
@@ -77,6 +78,7 @@ const SubGhzProtocol subghz_protocol_holtek = {
 
     .decoder = &subghz_protocol_holtek_decoder,
     .encoder = &subghz_protocol_holtek_encoder,
+    .timing = &subghz_protocol_holtek_const,
 };
 
 void* subghz_protocol_encoder_holtek_alloc(SubGhzEnvironment* environment) {
@@ -339,6 +341,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_holtek_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_holtek_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_holtek_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderHoltek* instance = context;
@@ -64,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
     .deserialize = subghz_protocol_decoder_holtek_th12x_deserialize,
     .get_string = subghz_protocol_decoder_holtek_th12x_get_string,
+    .get_compact = subghz_protocol_decoder_holtek_th12x_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder = {
@@ -84,6 +85,7 @@ const SubGhzProtocol subghz_protocol_holtek_th12x = {
 
     .decoder = &subghz_protocol_holtek_th12x_decoder,
     .encoder = &subghz_protocol_holtek_th12x_encoder,
+    .timing = &subghz_protocol_holtek_th12x_const,
 };
 
 void* subghz_protocol_encoder_holtek_th12x_alloc(SubGhzEnvironment* environment) {
@@ -382,6 +384,15 @@ static void subghz_protocol_holtek_th12x_event_serialize(uint8_t event, FuriStri
         (((event >> 0) & 0x1) == 0x0 ? "B4 " : ""));
 }
 
+bool subghz_protocol_decoder_holtek_th12x_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek_HT12X* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_holtek_th12x_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderHoltek_HT12X* instance = context;
@@ -162,6 +162,15 @@ SubGhzProtocolStatus
         subghz_protocol_honeywell_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_honeywell_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoneywell* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_honeywell_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderHoneywell* instance = context;
@@ -335,6 +344,7 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_decoder = {
     .serialize = subghz_protocol_decoder_honeywell_serialize,
     .deserialize = subghz_protocol_decoder_honeywell_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_get_string,
+    .get_compact = subghz_protocol_decoder_honeywell_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_encoder = {
@@ -38,6 +38,10 @@ SubGhzProtocolStatus subghz_protocol_decoder_honeywell_serialize(
 SubGhzProtocolStatus
     subghz_protocol_decoder_honeywell_deserialize(void* context, FlipperFormat* flipper_format);
 
+bool subghz_protocol_decoder_honeywell_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output);
+
 void subghz_protocol_decoder_honeywell_get_string(void* context, FuriString* output);
 
 static const SubGhzBlockConst subghz_protocol_honeywell_const = {
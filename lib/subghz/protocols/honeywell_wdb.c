@@ -58,6 +58,7 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
     .deserialize = subghz_protocol_decoder_honeywell_wdb_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_wdb_get_string,
+    .get_compact = subghz_protocol_decoder_honeywell_wdb_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_wdb_encoder = {
@@ -78,6 +79,7 @@ const SubGhzProtocol subghz_protocol_honeywell_wdb = {
 
     .decoder = &subghz_protocol_honeywell_wdb_decoder,
     .encoder = &subghz_protocol_honeywell_wdb_encoder,
+    .timing = &subghz_protocol_honeywell_wdb_const,
 };
 
 void* subghz_protocol_encoder_honeywell_wdb_alloc(SubGhzEnvironment* environment) {
@@ -364,6 +366,15 @@ SubGhzProtocolStatus subghz_protocol_decoder_honeywell_wdb_deserialize(
         subghz_protocol_honeywell_wdb_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_honeywell_wdb_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoneywell_WDB* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_honeywell_wdb_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderHoneywell_WDB* instance = context;
@@ -51,6 +51,7 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .serialize = subghz_protocol_decoder_hormann_serialize,
     .deserialize = subghz_protocol_decoder_hormann_deserialize,
     .get_string = subghz_protocol_decoder_hormann_get_string,
+    .get_compact = subghz_protocol_decoder_hormann_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_hormann_encoder = {
@@ -71,6 +72,7 @@ const SubGhzProtocol subghz_protocol_hormann = {
 
     .decoder = &subghz_protocol_hormann_decoder,
     .encoder = &subghz_protocol_hormann_encoder,
+    .timing = &subghz_protocol_hormann_const,
 };
 
 void* subghz_protocol_encoder_hormann_alloc(SubGhzEnvironment* environment) {
@@ -312,6 +314,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_hormann_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_hormann_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHormann* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_hormann_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderHormann* instance = context;
@@ -47,6 +47,7 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .deserialize = subghz_protocol_decoder_ido_deserialize,
     .serialize = subghz_protocol_decoder_ido_serialize,
     .get_string = subghz_protocol_decoder_ido_get_string,
+    .get_compact = subghz_protocol_decoder_ido_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ido_encoder = {
@@ -66,6 +67,7 @@ const SubGhzProtocol subghz_protocol_ido = {
 
     .decoder = &subghz_protocol_ido_decoder,
     .encoder = &subghz_protocol_ido_encoder,
+    .timing = &subghz_protocol_ido_const,
 };
 
 void* subghz_protocol_decoder_ido_alloc(SubGhzEnvironment* environment) {
@@ -197,6 +199,13 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_ido_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_ido_get_compact(void* context, SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIDo* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_ido_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderIDo* instance = context;
@@ -101,6 +101,7 @@ const SubGhzProtocol ws_protocol_infactory = {
     .encoder = &ws_protocol_infactory_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_infactory_const,
 };
 
 void* ws_protocol_decoder_infactory_alloc(SubGhzEnvironment* environment) {
@@ -56,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
     .deserialize = subghz_protocol_decoder_intertechno_v3_deserialize,
     .get_string = subghz_protocol_decoder_intertechno_v3_get_string,
+    .get_compact = subghz_protocol_decoder_intertechno_v3_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_intertechno_v3_encoder = {
@@ -76,6 +77,7 @@ const SubGhzProtocol subghz_protocol_intertechno_v3 = {
 
     .decoder = &subghz_protocol_intertechno_v3_decoder,
     .encoder = &subghz_protocol_intertechno_v3_encoder,
+    .timing = &subghz_protocol_intertechno_v3_const,
 };
 
 void* subghz_protocol_encoder_intertechno_v3_alloc(SubGhzEnvironment* environment) {
@@ -437,6 +439,15 @@ SubGhzProtocolStatus subghz_protocol_decoder_intertechno_v3_deserialize(
     return ret;
 }
 
+bool subghz_protocol_decoder_intertechno_v3_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIntertechno_V3* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_intertechno_v3_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderIntertechno_V3* instance = context;
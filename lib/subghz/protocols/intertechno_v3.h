@@ -103,6 +103,16 @@ SubGhzProtocolStatus subghz_protocol_decoder_intertechno_v3_deserialize(
     void* context,
     FlipperFormat* flipper_format);
 
+/**
+ * Getting a compact representation of the received data, no allocations.
+ * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
+ * @param output Resulting summary
+ * @return true On success
+ */
+bool subghz_protocol_decoder_intertechno_v3_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output);
+
 /**
  * Getting a textual representation of the received data.
  * @param context Pointer to a SubGhzProtocolDecoderIntertechno_V3 instance
@@ -65,6 +65,7 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .serialize = subghz_protocol_decoder_keeloq_serialize,
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
+    .get_compact = subghz_protocol_decoder_keeloq_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -85,6 +86,7 @@ const SubGhzProtocol subghz_protocol_keeloq = {
 
     .decoder = &subghz_protocol_keeloq_decoder,
     .encoder = &subghz_protocol_keeloq_encoder,
+    .timing = &subghz_protocol_keeloq_const,
 };
 
 /** 
@@ -241,8 +243,7 @@ static bool subghz_protocol_keeloq_gen_data(
                     manufacture_code,
                     *subghz_keystore_get_data(instance->keystore),
                     SubGhzKeyArray_t) {
-                    res = strcmp(
-                        furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+                    res = strcmp(manufacture_code->name, instance->manufacture_name);
                     if(res == 0) {
                         switch(manufacture_code->type) {
                         case KEELOQ_LEARNING_SIMPLE:
@@ -728,19 +729,210 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
+// Bit-sliced validation of decrypt data, returns lanes with matching button
+static inline uint32_t
+    subghz_protocol_keeloq_check_btn_bitsliced(const uint32_t* decrypt, uint8_t btn) {
+    uint32_t match = UINT32_MAX;
+    for(size_t i = 0; i < 4; i++) {
+        match &= ~(decrypt[28 + i] ^ (0 - (uint32_t)((btn >> i) & 1)));
+    }
+    return match;
+}
+
+/**
+ * Bit-sliced validation of decrypt data, same rules as subghz_protocol_keeloq_check_decrypt
+ * @param decrypt Bit-sliced decrypted data, 32 words
+ * @param btn Button number, 4 bit
+ * @param end_serial decrement the last 10 bits of the serial number
+ * @return Mask of lanes that passed the check
+ */
+static inline uint32_t subghz_protocol_keeloq_check_decrypt_bitsliced(
+    const uint32_t* decrypt,
+    uint8_t btn,
+    uint32_t end_serial) {
+    uint32_t serial_match = UINT32_MAX;
+    uint32_t zero_match = UINT32_MAX;
+    for(size_t i = 0; i < 8; i++) {
+        serial_match &= ~(decrypt[16 + i] ^ (0 - ((end_serial >> i) & 1)));
+        zero_match &= ~decrypt[16 + i];
+    }
+    return subghz_protocol_keeloq_check_btn_bitsliced(decrypt, btn) & (serial_match | zero_match);
+}
+
+// Bit-sliced Centurion specific check
+static inline uint32_t subghz_protocol_keeloq_check_decrypt_centurion_bitsliced(
+    const uint32_t* decrypt,
+    uint8_t btn) {
+    uint32_t match = subghz_protocol_keeloq_check_btn_bitsliced(decrypt, btn);
+    for(size_t i = 0; i < 10; i++) {
+        match &= ~(decrypt[16 + i] ^ (0 - (uint32_t)((0x1CE >> i) & 1)));
+    }
+    return match;
+}
+
+typedef uint64_t (*SubGhzProtocolKeeloqMagicLearning)(uint32_t data, uint64_t man);
+
+/**
+ * Bit-sliced magic learning. Every bit of magic learning result is either the same bit
+ * of man or depends on data only, so running the learning on all-zero and all-one man
+ * is enough to get it for 32 keys at once.
+ * @param learning Scalar learning function
+ * @param data Learning data
+ * @param key Bit-sliced manufacture keys, 64 words
+ * @param man Bit-sliced learning result, 64 words
+ */
+static void subghz_protocol_keeloq_magic_learning_bitsliced(
+    SubGhzProtocolKeeloqMagicLearning learning,
+    uint32_t data,
+    const uint32_t* key,
+    uint32_t* man) {
+    uint64_t value = learning(data, 0);
+    uint64_t keep = learning(data, UINT64_MAX) ^ value;
+    for(size_t i = 0; i < 64; i++) {
+        man[i] = (key[i] & (0 - (uint32_t)((keep >> i) & 1))) ^
+                 (0 - (uint32_t)((value >> i) & 1));
+    }
+}
+
+typedef struct {
+    uint32_t key_rev[64];
+    uint32_t man[64];
+    uint32_t decrypt[32];
+} SubGhzProtocolKeeloqBitslicedScratch;
+
+/**
+ * Run all learning types over a block of keys at once
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param block Bit-sliced block of keys
+ * @param scratch Work buffers
+ * @return Mask of keys that may match, to be verified with scalar check
+ */
+static uint32_t subghz_protocol_keeloq_check_block_bitsliced(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    const SubGhzKeystoreKlBlock* block,
+    SubGhzProtocolKeeloqBitslicedScratch* scratch) {
+    uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint8_t btn = (uint8_t)(fix >> 28);
+    const uint32_t* type = block->type;
+    uint32_t unknown = type[KEELOQ_LEARNING_UNKNOWN];
+    uint32_t* man = scratch->man;
+    uint32_t* decrypt = scratch->decrypt;
+    uint32_t candidates = 0;
+    uint32_t lanes;
+
+    // Mirrored man is the same key in another byte order
+    if(unknown) {
+        for(size_t i = 0; i < 64; i++) scratch->key_rev[i] = block->key[i ^ 56];
+    }
+
+    // Simple Learning
+    lanes = type[KEELOQ_LEARNING_SIMPLE] | unknown;
+    if(lanes) {
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, block->key, decrypt);
+        candidates |= lanes &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+    if(unknown) {
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, scratch->key_rev, decrypt);
+        candidates |= unknown &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+
+    // Normal Learning, Centurion keys are told apart by scalar check
+    lanes = type[KEELOQ_LEARNING_NORMAL] | unknown;
+    if(lanes) {
+        subghz_protocol_keeloq_common_normal_learning_bitsliced(fix, block->key, man);
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+        candidates |= lanes &
+                      (subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial) |
+                       subghz_protocol_keeloq_check_decrypt_centurion_bitsliced(decrypt, btn));
+    }
+    if(unknown) {
+        subghz_protocol_keeloq_common_normal_learning_bitsliced(fix, scratch->key_rev, man);
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+        candidates |= unknown &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+
+    // Secure Learning
+    lanes = type[KEELOQ_LEARNING_SECURE] | unknown;
+    if(lanes) {
+        subghz_protocol_keeloq_common_secure_learning_bitsliced(
+            fix, instance->seed, block->key, man);
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+        candidates |= lanes &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+    if(unknown) {
+        subghz_protocol_keeloq_common_secure_learning_bitsliced(
+            fix, instance->seed, scratch->key_rev, man);
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+        candidates |= unknown &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+
+    // Magic xor type1 learning
+    lanes = type[KEELOQ_LEARNING_MAGIC_XOR_TYPE_1] | unknown;
+    if(lanes) {
+        subghz_protocol_keeloq_magic_learning_bitsliced(
+            subghz_protocol_keeloq_common_magic_xor_type1_learning, fix, block->key, man);
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+        candidates |= lanes &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+    if(unknown) {
+        subghz_protocol_keeloq_magic_learning_bitsliced(
+            subghz_protocol_keeloq_common_magic_xor_type1_learning, fix, scratch->key_rev, man);
+        subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+        candidates |= unknown &
+                      subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+    }
+
+    // Magic serial learning
+    static const struct {
+        uint8_t type;
+        SubGhzProtocolKeeloqMagicLearning learning;
+    } magic_serial[] = {
+        {KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1,
+         subghz_protocol_keeloq_common_magic_serial_type1_learning},
+        {KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2,
+         subghz_protocol_keeloq_common_magic_serial_type2_learning},
+        {KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3,
+         subghz_protocol_keeloq_common_magic_serial_type3_learning},
+    };
+    for(size_t i = 0; i < COUNT_OF(magic_serial); i++) {
+        lanes = type[magic_serial[i].type];
+        if(lanes) {
+            subghz_protocol_keeloq_magic_learning_bitsliced(
+                magic_serial[i].learning, fix, block->key, man);
+            subghz_protocol_keeloq_common_decrypt_bitsliced(hop, man, decrypt);
+            candidates |=
+                lanes & subghz_protocol_keeloq_check_decrypt_bitsliced(decrypt, btn, end_serial);
+        }
+    }
+
+    return candidates;
+}
+
 /** 
- * Checking the accepted code against the database manafacture key
+ * Checking the accepted code against one manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
+ * @param manufacture_code Key to check
  * @param keystore Pointer to a SubGhzKeystore* instance
  * @param manufacture_name 
- * @return true on successful search
+ * @return true if key matches
  */
-static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+static bool subghz_protocol_keeloq_check_manufacture_code(
     SubGhzBlockGeneric* instance,
     uint32_t fix,
     uint32_t hop,
+    SubGhzKey* manufacture_code,
     SubGhzKeystore* keystore,
     const char** manufacture_name) {
     // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
@@ -751,6 +943,195 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     uint8_t btn = (uint8_t)(fix >> 28);
     uint32_t decrypt = 0;
     uint64_t man;
+
+    switch(manufacture_code->type) {
+    case KEELOQ_LEARNING_SIMPLE:
+        // Simple Learning
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            return true;
+        }
+        break;
+    case KEELOQ_LEARNING_NORMAL:
+        // Normal Learning
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if((strcmp(manufacture_code->name, "Centurion") == 0)) {
+            if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                return true;
+            }
+        } else {
+            if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                return true;
+            }
+        }
+        break;
+    case KEELOQ_LEARNING_SECURE:
+        man = subghz_protocol_keeloq_common_secure_learning(
+            fix, instance->seed, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            return true;
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+        man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            return true;
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+        man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
+            fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            return true;
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+        man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
+            fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            return true;
+        }
+        break;
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
+            fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            return true;
+        }
+        break;
+    case KEELOQ_LEARNING_UNKNOWN:
+        // Simple Learning
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 1;
+            return true;
+        }
+
+        // Check for mirrored man
+        uint64_t man_rev = 0;
+        uint64_t man_rev_byte = 0;
+        for(uint8_t i = 0; i < 64; i += 8) {
+            man_rev_byte = (uint8_t)(manufacture_code->key >> i);
+            man_rev = man_rev | man_rev_byte << (56 - i);
+        }
+
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 1;
+            return true;
+        }
+
+        //###########################
+        // Normal Learning
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 2;
+            return true;
+        }
+
+        // Check for mirrored man
+        man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 2;
+            return true;
+        }
+
+        // Secure Learning
+        man = subghz_protocol_keeloq_common_secure_learning(
+            fix, instance->seed, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 3;
+            return true;
+        }
+
+        // Check for mirrored man
+        man = subghz_protocol_keeloq_common_secure_learning(fix, instance->seed, man_rev);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 3;
+            return true;
+        }
+
+        // Magic xor type1 learning
+        man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 4;
+            return true;
+        }
+
+        // Check for mirrored man
+        man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            *manufacture_name = manufacture_code->name;
+            keystore->mfname = *manufacture_name;
+            keystore->kl_type = 4;
+            return true;
+        }
+
+        break;
+    }
+
+    return false;
+}
+
+/** 
+ * Checking the accepted code against the database manafacture key
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param manufacture_name 
+ * @return true on successful search
+ */
+static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    const char** manufacture_name) {
     bool mf_not_set = false;
     // TODO:
     // if(mfname == 0x0) {
@@ -764,186 +1145,46 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     } else if(strcmp(mfname, "") == 0) {
         mf_not_set = true;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if((strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0)) {
-                        if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    } else {
-                        if(subghz_protocol_keeloq_check_decrypt(
-                               instance, decrypt, btn, end_serial)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    }
-                    break;
-                case KEELOQ_LEARNING_SECURE:
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                    man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                    man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
 
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Secure Learning
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
-
-                    // Magic xor type1 learning
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
+    if(mf_not_set) {
+        // Bit-sliced pass rejects almost all keys, the rest is verified in keystore order
+        size_t keys_count = 0;
+        const SubGhzKeystoreKlBlock* blocks = subghz_keystore_get_kl_blocks(keystore, &keys_count);
+        SubGhzKeyArray_t* data = subghz_keystore_get_data(keystore);
+        SubGhzProtocolKeeloqBitslicedScratch* scratch =
+            malloc(sizeof(SubGhzProtocolKeeloqBitslicedScratch));
+        bool found = false;
+
+        for(size_t i = 0; !found && i < SUBGHZ_KEYSTORE_KL_BLOCKS(keys_count); i++) {
+            uint32_t candidates = subghz_protocol_keeloq_check_block_bitsliced(
+                instance, fix, hop, &blocks[i], scratch);
+            while(!found && candidates) {
+                size_t lane = __builtin_ctz(candidates);
+                candidates &= candidates - 1;
+                found = subghz_protocol_keeloq_check_manufacture_code(
+                    instance,
+                    fix,
+                    hop,
+                    SubGhzKeyArray_get(*data, i * SUBGHZ_KEYSTORE_KL_BLOCK_KEYS + lane),
+                    keystore,
+                    manufacture_name);
+            }
+        }
 
-                    break;
+        free(scratch);
+        if(found) return 1;
+    } else {
+        // Names are interned, so keys of this manufacture are matched by pointer
+        const char* name = subghz_keystore_find_name(keystore, mfname);
+        for
+            M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
+                if(name && (manufacture_code->name == name) &&
+                   subghz_protocol_keeloq_check_manufacture_code(
+                       instance, fix, hop, manufacture_code, keystore, manufacture_name)) {
+                    return 1;
                 }
             }
-        }
+    }
 
     *manufacture_name = "Unknown";
     keystore->mfname = "Unknown";
@@ -1216,6 +1457,16 @@ static uint8_t subghz_protocol_keeloq_get_btn_code(uint8_t last_btn_code) {
     return btn;
 }
 
+bool subghz_protocol_decoder_keeloq_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    output->manufacture = instance->manufacture_name;
+    return true;
+}
+
 void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
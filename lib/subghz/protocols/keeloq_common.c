@@ -35,6 +35,42 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+/** Bit-sliced Simple Learning Decrypt
+ * Same rounds as subghz_protocol_keeloq_common_decrypt, but every state bit is a word
+ * holding that bit for 32 keys. Shift register is rotated by moving offset, NLF is
+ * evaluated as boolean expression of its 5 inputs.
+ * @param data - keeloq encrypt data
+ * @param key - 64 words of bit-sliced manufacture keys
+ * @param result - 32 words of bit-sliced decrypted data
+ */
+void subghz_protocol_keeloq_common_decrypt_bitsliced(
+    const uint32_t data,
+    const uint32_t* key,
+    uint32_t* result) {
+    uint32_t x[32];
+    uint32_t offset = 0;
+    for(size_t i = 0; i < 32; i++) x[i] = 0 - bit(data, i);
+
+#define KEELOQ_BITSLICED_X(n) x[(offset + (n)) & 31]
+    for(uint32_t r = 0; r < 528; r++) {
+        uint32_t a = KEELOQ_BITSLICED_X(0);
+        uint32_t b = KEELOQ_BITSLICED_X(8);
+        uint32_t c = KEELOQ_BITSLICED_X(19);
+        uint32_t d = KEELOQ_BITSLICED_X(25);
+        uint32_t e = KEELOQ_BITSLICED_X(30);
+        // KEELOQ_NLF in algebraic normal form
+        uint32_t nlf = ((a | b) ^ (b & c) ^ (d & (a ^ c))) ^
+                       (e & ((a & ~b) ^ (c & ~a) ^ (d & (b ^ c))));
+        uint32_t next = KEELOQ_BITSLICED_X(31) ^ KEELOQ_BITSLICED_X(15) ^
+                        key[(15 - r) & 63] ^ nlf;
+        offset = (offset - 1) & 31;
+        x[offset] = next;
+    }
+
+    for(size_t i = 0; i < 32; i++) result[i] = KEELOQ_BITSLICED_X(i);
+#undef KEELOQ_BITSLICED_X
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
@@ -74,6 +110,36 @@ inline uint64_t subghz_protocol_keeloq_common_secure_learning(
     return ((uint64_t)k1 << 32) | k2;
 }
 
+/** Bit-sliced Normal Learning
+ * @param data - serial number (28bit)
+ * @param key - 64 words of bit-sliced manufacture keys
+ * @param man - 64 words of bit-sliced manufacture for this serial number
+ */
+void subghz_protocol_keeloq_common_normal_learning_bitsliced(
+    uint32_t data,
+    const uint32_t* key,
+    uint32_t* man) {
+    data &= 0x0FFFFFFF;
+    subghz_protocol_keeloq_common_decrypt_bitsliced(data | 0x20000000, key, &man[0]);
+    subghz_protocol_keeloq_common_decrypt_bitsliced(data | 0x60000000, key, &man[32]);
+}
+
+/** Bit-sliced Secure Learning
+ * @param data - serial number (28bit)
+ * @param seed - seed number (32bit)
+ * @param key - 64 words of bit-sliced manufacture keys
+ * @param man - 64 words of bit-sliced manufacture for this serial number
+ */
+void subghz_protocol_keeloq_common_secure_learning_bitsliced(
+    uint32_t data,
+    uint32_t seed,
+    const uint32_t* key,
+    uint32_t* man) {
+    data &= 0x0FFFFFFF;
+    subghz_protocol_keeloq_common_decrypt_bitsliced(data, key, &man[32]);
+    subghz_protocol_keeloq_common_decrypt_bitsliced(seed, key, &man[0]);
+}
+
 /** Magic_xor_type1 Learning
  * @param data - serial number (28bit)
  * @param xor - magic xor (64bit)
@@ -42,6 +42,42 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/** 
+ * Bit-sliced Simple Learning Decrypt, decrypts same data with 32 keys at once
+ * Lane N of every word belongs to key N
+ * @param data - keeloq encrypt data
+ * @param key - 64 words, bit N of key[i] is bit i of key N
+ * @param result - 32 words, bit N of result[i] is bit i of data decrypted with key N
+ */
+void subghz_protocol_keeloq_common_decrypt_bitsliced(
+    const uint32_t data,
+    const uint32_t* key,
+    uint32_t* result);
+
+/** 
+ * Bit-sliced Normal Learning, see subghz_protocol_keeloq_common_decrypt_bitsliced
+ * @param data - serial number (28bit)
+ * @param key - 64 words of bit-sliced manufacture keys
+ * @param man - 64 words of bit-sliced manufacture for this serial number
+ */
+void subghz_protocol_keeloq_common_normal_learning_bitsliced(
+    uint32_t data,
+    const uint32_t* key,
+    uint32_t* man);
+
+/** 
+ * Bit-sliced Secure Learning, see subghz_protocol_keeloq_common_decrypt_bitsliced
+ * @param data - serial number (28bit)
+ * @param seed - seed number (32bit)
+ * @param key - 64 words of bit-sliced manufacture keys
+ * @param man - 64 words of bit-sliced manufacture for this serial number
+ */
+void subghz_protocol_keeloq_common_secure_learning_bitsliced(
+    uint32_t data,
+    uint32_t seed,
+    const uint32_t* key,
+    uint32_t* man);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .serialize = subghz_protocol_decoder_kia_serialize,
     .deserialize = subghz_protocol_decoder_kia_deserialize,
     .get_string = subghz_protocol_decoder_kia_get_string,
+    .get_compact = subghz_protocol_decoder_kia_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kia_encoder = {
@@ -69,6 +70,7 @@ const SubGhzProtocol subghz_protocol_kia = {
     .encoder = &subghz_protocol_kia_encoder,
 
     .filter = SubGhzProtocolFilter_AutoAlarms,
+    .timing = &subghz_protocol_kia_const,
 };
 
 void* subghz_protocol_decoder_kia_alloc(SubGhzEnvironment* environment) {
@@ -249,6 +251,13 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_kia_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_kia_get_compact(void* context, SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKIA* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_kia_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderKIA* instance = context;
@@ -54,6 +54,7 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .serialize = subghz_protocol_decoder_kinggates_stylo_4k_serialize,
     .deserialize = subghz_protocol_decoder_kinggates_stylo_4k_deserialize,
     .get_string = subghz_protocol_decoder_kinggates_stylo_4k_get_string,
+    .get_compact = subghz_protocol_decoder_kinggates_stylo_4k_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kinggates_stylo_4k_encoder = {
@@ -73,6 +74,7 @@ const SubGhzProtocol subghz_protocol_kinggates_stylo_4k = {
 
     .decoder = &subghz_protocol_kinggates_stylo_4k_decoder,
     .encoder = &subghz_protocol_kinggates_stylo_4k_encoder,
+    .timing = &subghz_protocol_kinggates_stylo_4k_const,
 };
 
 //
@@ -146,7 +148,7 @@ static bool subghz_protocol_kinggates_stylo_4k_gen_data(
 
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), "Kingates_Stylo4k");
+            res = strcmp(manufacture_code->name, "Kingates_Stylo4k");
             if(res == 0) {
                 //Simple Learning
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
@@ -173,7 +175,7 @@ static bool subghz_protocol_kinggates_stylo_4k_gen_data(
     uint64_t encrypt = 0;
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), "Kingates_Stylo4k");
+            res = strcmp(manufacture_code->name, "Kingates_Stylo4k");
             if(res == 0) {
                 //Simple Learning
                 encrypt = subghz_protocol_keeloq_common_encrypt(data, manufacture_code->key);
@@ -563,6 +565,15 @@ SubGhzProtocolStatus subghz_protocol_decoder_kinggates_stylo_4k_deserialize(
     return ret;
 }
 
+bool subghz_protocol_decoder_kinggates_stylo_4k_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKingGates_stylo_4k* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_kinggates_stylo_4k_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderKingGates_stylo_4k* instance = context;
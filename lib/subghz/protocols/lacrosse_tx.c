@@ -104,6 +104,7 @@ const SubGhzProtocol ws_protocol_lacrosse_tx = {
     .encoder = &ws_protocol_lacrosse_tx_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_lacrosse_tx_const,
 };
 
 void* ws_protocol_decoder_lacrosse_tx_alloc(SubGhzEnvironment* environment) {
@@ -83,6 +83,7 @@ const SubGhzProtocol ws_protocol_lacrosse_tx141thbv2 = {
     .encoder = &ws_protocol_lacrosse_tx141thbv2_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_lacrosse_tx141thbv2_const,
 };
 
 void* ws_protocol_decoder_lacrosse_tx141thbv2_alloc(SubGhzEnvironment* environment) {
@@ -53,6 +53,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .serialize = subghz_protocol_decoder_linear_serialize,
     .deserialize = subghz_protocol_decoder_linear_deserialize,
     .get_string = subghz_protocol_decoder_linear_get_string,
+    .get_compact = subghz_protocol_decoder_linear_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_encoder = {
@@ -72,6 +73,7 @@ const SubGhzProtocol subghz_protocol_linear = {
 
     .decoder = &subghz_protocol_linear_decoder,
     .encoder = &subghz_protocol_linear_encoder,
+    .timing = &subghz_protocol_linear_const,
 };
 
 void* subghz_protocol_encoder_linear_alloc(SubGhzEnvironment* environment) {
@@ -317,6 +319,15 @@ SubGhzProtocolStatus
         &instance->generic, flipper_format, subghz_protocol_linear_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_linear_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinear* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_linear_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
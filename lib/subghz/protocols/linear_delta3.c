@@ -54,6 +54,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
     .deserialize = subghz_protocol_decoder_linear_delta3_deserialize,
     .get_string = subghz_protocol_decoder_linear_delta3_get_string,
+    .get_compact = subghz_protocol_decoder_linear_delta3_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_delta3_encoder = {
@@ -73,6 +74,7 @@ const SubGhzProtocol subghz_protocol_linear_delta3 = {
 
     .decoder = &subghz_protocol_linear_delta3_decoder,
     .encoder = &subghz_protocol_linear_delta3_encoder,
+    .timing = &subghz_protocol_linear_delta3_const,
 };
 
 void* subghz_protocol_encoder_linear_delta3_alloc(SubGhzEnvironment* environment) {
@@ -331,6 +333,15 @@ SubGhzProtocolStatus subghz_protocol_decoder_linear_delta3_deserialize(
         subghz_protocol_linear_delta3_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_linear_delta3_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinearDelta3* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_linear_delta3_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderLinearDelta3* instance = context;
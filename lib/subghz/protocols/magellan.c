@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .serialize = subghz_protocol_decoder_magellan_serialize,
     .deserialize = subghz_protocol_decoder_magellan_deserialize,
     .get_string = subghz_protocol_decoder_magellan_get_string,
+    .get_compact = subghz_protocol_decoder_magellan_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_magellan_encoder = {
@@ -70,6 +71,7 @@ const SubGhzProtocol subghz_protocol_magellan = {
     .encoder = &subghz_protocol_magellan_encoder,
 
     .filter = SubGhzProtocolFilter_Magellan,
+    .timing = &subghz_protocol_magellan_const,
 };
 
 void* subghz_protocol_encoder_magellan_alloc(SubGhzEnvironment* environment) {
@@ -418,6 +420,15 @@ SubGhzProtocolStatus
         subghz_protocol_magellan_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_magellan_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMagellan* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_magellan_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderMagellan* instance = context;
@@ -101,6 +101,16 @@ SubGhzProtocolStatus subghz_protocol_decoder_magellan_serialize(
 SubGhzProtocolStatus
     subghz_protocol_decoder_magellan_deserialize(void* context, FlipperFormat* flipper_format);
 
+/**
+ * Getting a compact representation of the received data, no allocations.
+ * @param context Pointer to a SubGhzProtocolDecoderMagellan instance
+ * @param output Resulting summary
+ * @return true On success
+ */
+bool subghz_protocol_decoder_magellan_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output);
+
 /**
  * Getting a textual representation of the received data.
  * @param context Pointer to a SubGhzProtocolDecoderMagellan instance
@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
     .serialize = subghz_protocol_decoder_marantec_serialize,
     .deserialize = subghz_protocol_decoder_marantec_deserialize,
     .get_string = subghz_protocol_decoder_marantec_get_string,
+    .get_compact = subghz_protocol_decoder_marantec_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_marantec_encoder = {
@@ -68,6 +69,7 @@ const SubGhzProtocol subghz_protocol_marantec = {
 
     .decoder = &subghz_protocol_marantec_decoder,
     .encoder = &subghz_protocol_marantec_encoder,
+    .timing = &subghz_protocol_marantec_const,
 };
 
 void* subghz_protocol_encoder_marantec_alloc(SubGhzEnvironment* environment) {
@@ -362,6 +364,15 @@ SubGhzProtocolStatus
         subghz_protocol_marantec_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_marantec_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMarantec* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_marantec_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderMarantec* instance = context;
@@ -61,6 +61,7 @@ const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
     .serialize = subghz_protocol_decoder_mastercode_serialize,
     .deserialize = subghz_protocol_decoder_mastercode_deserialize,
     .get_string = subghz_protocol_decoder_mastercode_get_string,
+    .get_compact = subghz_protocol_decoder_mastercode_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_mastercode_encoder = {
@@ -80,6 +81,7 @@ const SubGhzProtocol subghz_protocol_mastercode = {
 
     .decoder = &subghz_protocol_mastercode_decoder,
     .encoder = &subghz_protocol_mastercode_encoder,
+    .timing = &subghz_protocol_mastercode_const,
 };
 
 void* subghz_protocol_encoder_mastercode_alloc(SubGhzEnvironment* environment) {
@@ -339,6 +341,15 @@ SubGhzProtocolStatus
         subghz_protocol_mastercode_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_mastercode_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMastercode* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_mastercode_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderMastercode* instance = context;
@@ -59,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .serialize = subghz_protocol_decoder_megacode_serialize,
     .deserialize = subghz_protocol_decoder_megacode_deserialize,
     .get_string = subghz_protocol_decoder_megacode_get_string,
+    .get_compact = subghz_protocol_decoder_megacode_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_megacode_encoder = {
@@ -78,6 +79,7 @@ const SubGhzProtocol subghz_protocol_megacode = {
 
     .decoder = &subghz_protocol_megacode_decoder,
     .encoder = &subghz_protocol_megacode_encoder,
+    .timing = &subghz_protocol_megacode_const,
 };
 
 void* subghz_protocol_encoder_megacode_alloc(SubGhzEnvironment* environment) {
@@ -400,6 +402,15 @@ SubGhzProtocolStatus
         subghz_protocol_megacode_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_megacode_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMegaCode* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_megacode_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderMegaCode* instance = context;
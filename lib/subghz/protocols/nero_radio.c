@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
     .deserialize = subghz_protocol_decoder_nero_radio_deserialize,
     .get_string = subghz_protocol_decoder_nero_radio_get_string,
+    .get_compact = subghz_protocol_decoder_nero_radio_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_radio_encoder = {
@@ -68,6 +69,7 @@ const SubGhzProtocol subghz_protocol_nero_radio = {
 
     .decoder = &subghz_protocol_nero_radio_decoder,
     .encoder = &subghz_protocol_nero_radio_encoder,
+    .timing = &subghz_protocol_nero_radio_const,
 };
 
 void* subghz_protocol_encoder_nero_radio_alloc(SubGhzEnvironment* environment) {
@@ -385,6 +387,15 @@ SubGhzProtocolStatus
     }
 }
 
+bool subghz_protocol_decoder_nero_radio_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroRadio* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_nero_radio_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroRadio* instance = context;
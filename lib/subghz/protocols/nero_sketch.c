@@ -48,6 +48,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
     .deserialize = subghz_protocol_decoder_nero_sketch_deserialize,
     .get_string = subghz_protocol_decoder_nero_sketch_get_string,
+    .get_compact = subghz_protocol_decoder_nero_sketch_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_sketch_encoder = {
@@ -67,6 +68,7 @@ const SubGhzProtocol subghz_protocol_nero_sketch = {
 
     .decoder = &subghz_protocol_nero_sketch_decoder,
     .encoder = &subghz_protocol_nero_sketch_encoder,
+    .timing = &subghz_protocol_nero_sketch_const,
 };
 
 void* subghz_protocol_encoder_nero_sketch_alloc(SubGhzEnvironment* environment) {
@@ -347,6 +349,15 @@ SubGhzProtocolStatus
         subghz_protocol_nero_sketch_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_nero_sketch_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroSketch* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_nero_sketch_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroSketch* instance = context;
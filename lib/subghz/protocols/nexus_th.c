@@ -363,4 +363,5 @@ const SubGhzProtocol ws_protocol_nexus_th = {
     .encoder = &ws_protocol_nexus_th_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_nexus_th_const,
 };
@@ -46,6 +46,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
     .deserialize = subghz_protocol_decoder_nice_flo_deserialize,
     .get_string = subghz_protocol_decoder_nice_flo_get_string,
+    .get_compact = subghz_protocol_decoder_nice_flo_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder = {
@@ -66,6 +67,7 @@ const SubGhzProtocol subghz_protocol_nice_flo = {
 
     .decoder = &subghz_protocol_nice_flo_decoder,
     .encoder = &subghz_protocol_nice_flo_encoder,
+    .timing = &subghz_protocol_nice_flo_const,
 };
 
 void* subghz_protocol_encoder_nice_flo_alloc(SubGhzEnvironment* environment) {
@@ -314,6 +316,15 @@ SubGhzProtocolStatus
     return ret;
 }
 
+bool subghz_protocol_decoder_nice_flo_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_nice_flo_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
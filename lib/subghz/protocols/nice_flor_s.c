@@ -64,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
+    .get_compact = subghz_protocol_decoder_nice_flor_s_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
@@ -86,6 +87,7 @@ const SubGhzProtocol subghz_protocol_nice_flor_s = {
     .encoder = &subghz_protocol_nice_flor_s_encoder,
 
     .filter = SubGhzProtocolFilter_NiceFlorS,
+    .timing = &subghz_protocol_nice_flor_s_const,
 };
 
 static void subghz_protocol_nice_flor_s_remote_controller(
@@ -851,6 +853,15 @@ static uint8_t subghz_protocol_nice_flor_s_get_btn_code() {
     return btn;
 }
 
+bool subghz_protocol_decoder_nice_flor_s_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlorS* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_nice_flor_s_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlorS* instance = context;
@@ -429,4 +429,5 @@ const SubGhzProtocol ws_protocol_oregon2 = {
     .decoder = &ws_protocol_oregon2_decoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_oregon2_const,
 };
@@ -365,4 +365,5 @@ const SubGhzProtocol ws_protocol_oregon3 = {
     .decoder = &ws_protocol_oregon3_decoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_oregon3_const,
 };
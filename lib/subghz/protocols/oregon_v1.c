@@ -102,6 +102,7 @@ const SubGhzProtocol ws_protocol_oregon_v1 = {
     .encoder = &ws_protocol_oregon_v1_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_oregon_v1_const,
 };
 
 void* ws_protocol_decoder_oregon_v1_alloc(SubGhzEnvironment* environment) {
@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
     .deserialize = subghz_protocol_decoder_phoenix_v2_deserialize,
     .get_string = subghz_protocol_decoder_phoenix_v2_get_string,
+    .get_compact = subghz_protocol_decoder_phoenix_v2_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder = {
@@ -68,6 +69,7 @@ const SubGhzProtocol subghz_protocol_phoenix_v2 = {
 
     .decoder = &subghz_protocol_phoenix_v2_decoder,
     .encoder = &subghz_protocol_phoenix_v2_encoder,
+    .timing = &subghz_protocol_phoenix_v2_const,
 };
 
 void* subghz_protocol_encoder_phoenix_v2_alloc(SubGhzEnvironment* environment) {
@@ -312,6 +314,15 @@ SubGhzProtocolStatus
         subghz_protocol_phoenix_v2_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_phoenix_v2_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPhoenix_V2* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_phoenix_v2_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderPhoenix_V2* instance = context;
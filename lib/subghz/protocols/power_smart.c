@@ -56,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_power_smart_decoder = {
     .serialize = subghz_protocol_decoder_power_smart_serialize,
     .deserialize = subghz_protocol_decoder_power_smart_deserialize,
     .get_string = subghz_protocol_decoder_power_smart_get_string,
+    .get_compact = subghz_protocol_decoder_power_smart_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_power_smart_encoder = {
@@ -75,6 +76,7 @@ const SubGhzProtocol subghz_protocol_power_smart = {
 
     .decoder = &subghz_protocol_power_smart_decoder,
     .encoder = &subghz_protocol_power_smart_encoder,
+    .timing = &subghz_protocol_power_smart_const,
 };
 
 void* subghz_protocol_encoder_power_smart_alloc(SubGhzEnvironment* environment) {
@@ -361,6 +363,15 @@ SubGhzProtocolStatus
         subghz_protocol_power_smart_const.min_count_bit_for_found);
 }
 
+bool subghz_protocol_decoder_power_smart_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPowerSmart* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_power_smart_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderPowerSmart* instance = context;
@@ -57,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .serialize = subghz_protocol_decoder_princeton_serialize,
     .deserialize = subghz_protocol_decoder_princeton_deserialize,
     .get_string = subghz_protocol_decoder_princeton_get_string,
+    .get_compact = subghz_protocol_decoder_princeton_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_princeton_encoder = {
@@ -79,6 +80,7 @@ const SubGhzProtocol subghz_protocol_princeton = {
     .encoder = &subghz_protocol_princeton_encoder,
 
     .filter = SubGhzProtocolFilter_Princeton,
+    .timing = &subghz_protocol_princeton_const,
 };
 
 void* subghz_protocol_encoder_princeton_alloc(SubGhzEnvironment* environment) {
@@ -356,6 +358,15 @@ SubGhzProtocolStatus
     return ret;
 }
 
+bool subghz_protocol_decoder_princeton_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_princeton_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderPrinceton* instance = context;
@@ -10,9 +10,13 @@
 
 #include <flipper_format/flipper_format_i.h>
 #include <lib/toolbox/stream/stream.h>
+#include <lib/toolbox/stream/file_stream.h>
+#include <lib/toolbox/varint.h>
 
 #define TAG "SubGhzProtocolRaw"
 #define SUBGHZ_DOWNLOAD_MAX_SIZE 512
+#define SUBGHZ_RAW_VARINT_CHUNK_SIZE 256
+#define SUBGHZ_RAW_VARINT_MAX_SIZE 5
 
 static const SubGhzBlockConst subghz_protocol_raw_const = {
     .te_short = 50,
@@ -33,6 +37,7 @@ struct SubGhzProtocolDecoderRAW {
     size_t sample_write;
     bool last_level;
     bool pause;
+    SubGhzProtocolRawFormat format;
 };
 
 struct SubGhzProtocolEncoderRAW {
@@ -157,8 +162,18 @@ bool subghz_protocol_raw_save_to_file_init(
             FURI_LOG_E(TAG, "Unable to add Protocol");
             break;
         }
+        if(instance->format == SubGhzProtocolRawFormatVarint) {
+            // Binary payload follows this key up to the end of file
+            if(!flipper_format_write_string_cstr(
+                   instance->flipper_file,
+                   SUBGHZ_RAW_FILE_ENCODING_KEY,
+                   SUBGHZ_RAW_FILE_ENCODING_VARINT)) {
+                FURI_LOG_E(TAG, "Unable to add " SUBGHZ_RAW_FILE_ENCODING_KEY);
+                break;
+            }
+        }
 
-        instance->upload_raw = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
+        instance->upload_raw = memmgr_alloc_transient(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
         instance->file_is_open = RAWFileIsOpenWrite;
         instance->sample_write = 0;
         instance->last_level = false;
@@ -171,11 +186,38 @@ bool subghz_protocol_raw_save_to_file_init(
     return init;
 }
 
+static bool subghz_protocol_raw_write_varint(Stream* stream, const int32_t* data, size_t count) {
+    uint8_t buffer[SUBGHZ_RAW_VARINT_CHUNK_SIZE];
+    size_t size = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        size += varint_int32_pack(data[i], &buffer[size]);
+        if((size > sizeof(buffer) - SUBGHZ_RAW_VARINT_MAX_SIZE) || (i == count - 1)) {
+            if(stream_write(stream, buffer, size) != size) return false;
+            size = 0;
+        }
+    }
+
+    return true;
+}
+
 static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* instance) {
     furi_assert(instance);
 
     bool is_write = false;
-    if(instance->file_is_open == RAWFileIsOpenWrite) {
+    if(instance->file_is_open == RAWFileIsOpenWrite &&
+       instance->format == SubGhzProtocolRawFormatVarint) {
+        if(!subghz_protocol_raw_write_varint(
+               flipper_format_get_raw_stream(instance->flipper_file),
+               instance->upload_raw,
+               instance->ind_write)) {
+            FURI_LOG_E(TAG, "Unable to add RAW data");
+        } else {
+            instance->sample_write += instance->ind_write;
+            instance->ind_write = 0;
+            is_write = true;
+        }
+    } else if(instance->file_is_open == RAWFileIsOpenWrite) {
         if(!flipper_format_write_int32(
                instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
             FURI_LOG_E(TAG, "Unable to add RAW_Data");
@@ -216,6 +258,107 @@ size_t subghz_protocol_raw_get_sample_write(SubGhzProtocolDecoderRAW* instance)
     return instance->sample_write + instance->ind_write;
 }
 
+void subghz_protocol_raw_save_to_file_set_format(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzProtocolRawFormat format) {
+    furi_assert(instance);
+    furi_assert(instance->file_is_open == RAWFileIsOpenClose);
+
+    instance->format = format;
+}
+
+bool subghz_protocol_raw_file_convert_to_varint(
+    Storage* storage,
+    const char* source_path,
+    const char* destination_path) {
+    furi_assert(storage);
+    furi_assert(source_path);
+    furi_assert(destination_path);
+
+    Stream* source = file_stream_alloc(storage);
+    Stream* destination = file_stream_alloc(storage);
+    FuriString* line = furi_string_alloc();
+    int32_t* values = memmgr_alloc_transient(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
+
+    bool is_raw = false;
+    bool is_data = false;
+    bool success = false;
+
+    do {
+        if(!file_stream_open(source, source_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            FURI_LOG_E(TAG, "Unable to open %s", source_path);
+            break;
+        }
+        if(!file_stream_open(destination, destination_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Unable to open %s", destination_path);
+            break;
+        }
+
+        success = true;
+        while(success && stream_read_line(source, line)) {
+            if(!furi_string_start_with_str(line, "RAW_Data:")) {
+                if(furi_string_start_with_str(line, SUBGHZ_RAW_FILE_ENCODING_KEY ":")) {
+                    FURI_LOG_E(TAG, "File is already binary");
+                    success = false;
+                } else if(!is_data) {
+                    // Header is copied as is
+                    if(furi_string_equal_str(line, "Protocol: RAW\n")) is_raw = true;
+                    if(stream_write_string(destination, line) != furi_string_size(line)) {
+                        success = false;
+                    }
+                }
+                continue;
+            }
+
+            if(!is_data) {
+                if(!is_raw) {
+                    FURI_LOG_E(TAG, "Not a RAW file");
+                    success = false;
+                    break;
+                }
+                if(!stream_write_cstring(
+                       destination,
+                       SUBGHZ_RAW_FILE_ENCODING_KEY ": " SUBGHZ_RAW_FILE_ENCODING_VARINT "\n")) {
+                    success = false;
+                }
+                is_data = true;
+            }
+
+            const char* cursor = furi_string_get_cstr(line) + strlen("RAW_Data:");
+            size_t count = 0;
+            while(true) {
+                char* end = NULL;
+                long value = strtol(cursor, &end, 10);
+                if(end == cursor) break;
+                cursor = end;
+                while(*cursor == ',' || *cursor == ' ') cursor++;
+                if(value != 0) values[count++] = value;
+
+                if(count == SUBGHZ_DOWNLOAD_MAX_SIZE) {
+                    if(!subghz_protocol_raw_write_varint(destination, values, count)) {
+                        success = false;
+                    }
+                    count = 0;
+                }
+            }
+            if(count && !subghz_protocol_raw_write_varint(destination, values, count)) {
+                success = false;
+            }
+        }
+
+        success = success && is_data;
+    } while(false);
+
+    free(values);
+    furi_string_free(line);
+    file_stream_close(destination);
+    file_stream_close(source);
+    stream_free(destination);
+    stream_free(source);
+
+    return success;
+}
+
 void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     UNUSED(environment);
     SubGhzProtocolDecoderRAW* instance = malloc(sizeof(SubGhzProtocolDecoderRAW));
@@ -224,6 +367,7 @@ void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     instance->ind_write = 0;
     instance->last_level = false;
     instance->file_is_open = RAWFileIsOpenClose;
+    instance->format = SubGhzProtocolRawFormatText;
     instance->file_name = furi_string_alloc();
 
     return instance;
@@ -10,6 +10,11 @@ extern "C" {
 
 typedef void (*SubGhzProtocolEncoderRAWCallbackEnd)(void* context);
 
+typedef enum {
+    SubGhzProtocolRawFormatText, ///< `RAW_Data: -1, 2, -2...` lines
+    SubGhzProtocolRawFormatVarint, ///< Binary zigzag varint payload after `RAW_Encoding: Varint`
+} SubGhzProtocolRawFormat;
+
 typedef struct SubGhzProtocolDecoderRAW SubGhzProtocolDecoderRAW;
 typedef struct SubGhzProtocolEncoderRAW SubGhzProtocolEncoderRAW;
 
@@ -42,6 +47,28 @@ void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance);
  */
 size_t subghz_protocol_raw_get_sample_write(SubGhzProtocolDecoderRAW* instance);
 
+/**
+ * Set format of RAW data for the next file.
+ * Must be called before subghz_protocol_raw_save_to_file_init, text is the default.
+ * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
+ * @param format SubGhzProtocolRawFormat
+ */
+void subghz_protocol_raw_save_to_file_set_format(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzProtocolRawFormat format);
+
+/**
+ * Convert text RAW file to binary varint RAW file.
+ * @param storage Pointer to a Storage instance
+ * @param source_path Text RAW file path
+ * @param destination_path Binary RAW file path, overwritten if exists
+ * @return true On success
+ */
+bool subghz_protocol_raw_file_convert_to_varint(
+    Storage* storage,
+    const char* source_path,
+    const char* destination_path);
+
 /**
  * Allocate SubGhzProtocolDecoderRAW.
  * @param environment Pointer to a SubGhzEnvironment instance
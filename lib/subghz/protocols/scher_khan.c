@@ -55,6 +55,7 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
     .deserialize = subghz_protocol_decoder_scher_khan_deserialize,
     .get_string = subghz_protocol_decoder_scher_khan_get_string,
+    .get_compact = subghz_protocol_decoder_scher_khan_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_scher_khan_encoder = {
@@ -76,6 +77,7 @@ const SubGhzProtocol subghz_protocol_scher_khan = {
     .encoder = &subghz_protocol_scher_khan_encoder,
 
     .filter = SubGhzProtocolFilter_AutoAlarms,
+    .timing = &subghz_protocol_scher_khan_const,
 };
 
 void* subghz_protocol_decoder_scher_khan_alloc(SubGhzEnvironment* environment) {
@@ -297,6 +299,15 @@ SubGhzProtocolStatus
     return subghz_block_generic_deserialize(&instance->generic, flipper_format);
 }
 
+bool subghz_protocol_decoder_scher_khan_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderScherKhan* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_scher_khan_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderScherKhan* instance = context;
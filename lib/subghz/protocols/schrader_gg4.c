@@ -107,6 +107,7 @@ const SubGhzProtocol tpms_protocol_schrader_gg4 = {
     .encoder = &tpms_protocol_schrader_gg4_encoder,
 
     .filter = SubGhzProtocolFilter_TPMS,
+    .timing = &tpms_protocol_schrader_gg4_const,
 };
 
 void* tpms_protocol_decoder_schrader_gg4_alloc(SubGhzEnvironment* environment) {
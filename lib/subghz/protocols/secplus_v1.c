@@ -70,6 +70,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v1_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v1_get_string,
+    .get_compact = subghz_protocol_decoder_secplus_v1_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v1_encoder = {
@@ -89,6 +90,7 @@ const SubGhzProtocol subghz_protocol_secplus_v1 = {
 
     .decoder = &subghz_protocol_secplus_v1_decoder,
     .encoder = &subghz_protocol_secplus_v1_encoder,
+    .timing = &subghz_protocol_secplus_v1_const,
 };
 
 void* subghz_protocol_encoder_secplus_v1_alloc(SubGhzEnvironment* environment) {
@@ -548,6 +550,15 @@ bool subghz_protocol_secplus_v1_check_fixed(uint32_t fixed) {
     return true;
 }
 
+bool subghz_protocol_decoder_secplus_v1_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSecPlus_v1* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_secplus_v1_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderSecPlus_v1* instance = context;
@@ -64,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v2_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v2_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v2_get_string,
+    .get_compact = subghz_protocol_decoder_secplus_v2_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v2_encoder = {
@@ -83,6 +84,7 @@ const SubGhzProtocol subghz_protocol_secplus_v2 = {
 
     .decoder = &subghz_protocol_secplus_v2_decoder,
     .encoder = &subghz_protocol_secplus_v2_encoder,
+    .timing = &subghz_protocol_secplus_v2_const,
 };
 
 void* subghz_protocol_encoder_secplus_v2_alloc(SubGhzEnvironment* environment) {
@@ -931,6 +933,15 @@ static uint8_t subghz_protocol_secplus_v2_get_btn_code() {
     return btn;
 }
 
+bool subghz_protocol_decoder_secplus_v2_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSecPlus_v2* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_secplus_v2_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderSecPlus_v2* instance = context;
@@ -72,6 +72,7 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .serialize = subghz_protocol_decoder_smc5326_serialize,
     .deserialize = subghz_protocol_decoder_smc5326_deserialize,
     .get_string = subghz_protocol_decoder_smc5326_get_string,
+    .get_compact = subghz_protocol_decoder_smc5326_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder = {
@@ -92,6 +93,7 @@ const SubGhzProtocol subghz_protocol_smc5326 = {
 
     .decoder = &subghz_protocol_smc5326_decoder,
     .encoder = &subghz_protocol_smc5326_encoder,
+    .timing = &subghz_protocol_smc5326_const,
 };
 
 void* subghz_protocol_encoder_smc5326_alloc(SubGhzEnvironment* environment) {
@@ -369,6 +371,15 @@ static void subghz_protocol_smc5326_get_event_serialize(uint8_t event, FuriStrin
         (((event >> 0) & 0x3) == 0x3 ? "B4 " : ""));
 }
 
+bool subghz_protocol_decoder_smc5326_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSMC5326* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_smc5326_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderSMC5326* instance = context;
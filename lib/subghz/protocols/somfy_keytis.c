@@ -53,6 +53,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_keytis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_keytis_get_string,
+    .get_compact = subghz_protocol_decoder_somfy_keytis_get_compact,
 };
 
 const SubGhzProtocol subghz_protocol_somfy_keytis = {
@@ -63,6 +64,7 @@ const SubGhzProtocol subghz_protocol_somfy_keytis = {
 
     .decoder = &subghz_protocol_somfy_keytis_decoder,
     .encoder = &subghz_protocol_somfy_keytis_encoder,
+    .timing = &subghz_protocol_somfy_keytis_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_keytis_encoder = {
@@ -779,6 +781,15 @@ SubGhzProtocolStatus
     return ret;
 }
 
+bool subghz_protocol_decoder_somfy_keytis_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyKeytis* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    return true;
+}
+
 void subghz_protocol_decoder_somfy_keytis_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderSomfyKeytis* instance = context;
@@ -64,6 +64,7 @@ const SubGhzProtocolDecoder subghz_protocol_star_line_decoder = {
     .serialize = subghz_protocol_decoder_star_line_serialize,
     .deserialize = subghz_protocol_decoder_star_line_deserialize,
     .get_string = subghz_protocol_decoder_star_line_get_string,
+    .get_compact = subghz_protocol_decoder_star_line_get_compact,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_star_line_encoder = {
@@ -85,6 +86,7 @@ const SubGhzProtocol subghz_protocol_star_line = {
     .encoder = &subghz_protocol_star_line_encoder,
 
     .filter = SubGhzProtocolFilter_StarLine,
+    .timing = &subghz_protocol_star_line_const,
 };
 
 /** 
@@ -161,8 +163,7 @@ static bool
                 manufacture_code,
                 *subghz_keystore_get_data(instance->keystore),
                 SubGhzKeyArray_t) {
-                res = strcmp(
-                    furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+                res = strcmp(manufacture_code->name, instance->manufacture_name);
                 if(res == 0) {
                     switch(manufacture_code->type) {
                     case KEELOQ_LEARNING_SIMPLE:
@@ -529,16 +530,18 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     } else if(strcmp(mfname, "") == 0) {
         mf_not_set = true;
     }
+    // Names are interned, so keys of this manufacture are matched by pointer
+    const char* name = mf_not_set ? NULL : subghz_keystore_find_name(keystore, mfname);
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
+            if(mf_not_set || (name && manufacture_code->name == name)) {
                 switch(manufacture_code->type) {
                 case KEELOQ_LEARNING_SIMPLE:
                     // Simple Learning
                     decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
                     if(subghz_protocol_star_line_check_decrypt(
                            instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                        *manufacture_name = manufacture_code->name;
                         keystore->mfname = *manufacture_name;
                         return 1;
                     }
@@ -551,7 +554,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
                     if(subghz_protocol_star_line_check_decrypt(
                            instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                        *manufacture_name = manufacture_code->name;
                         keystore->mfname = *manufacture_name;
                         return 1;
                     }
@@ -561,7 +564,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
                     if(subghz_protocol_star_line_check_decrypt(
                            instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                        *manufacture_name = manufacture_code->name;
                         keystore->mfname = *manufacture_name;
                         keystore->kl_type = 1;
                         return 1;
@@ -576,7 +579,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
                     if(subghz_protocol_star_line_check_decrypt(
                            instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                        *manufacture_name = manufacture_code->name;
                         keystore->mfname = *manufacture_name;
                         keystore->kl_type = 1;
                         return 1;
@@ -589,7 +592,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
                     if(subghz_protocol_star_line_check_decrypt(
                            instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                        *manufacture_name = manufacture_code->name;
                         keystore->mfname = *manufacture_name;
                         keystore->kl_type = 2;
                         return 1;
@@ -600,7 +603,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
                     if(subghz_protocol_star_line_check_decrypt(
                            instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                        *manufacture_name = manufacture_code->name;
                         keystore->mfname = *manufacture_name;
                         keystore->kl_type = 2;
                         return 1;
@@ -698,6 +701,16 @@ SubGhzProtocolStatus
     return res;
 }
 
+bool subghz_protocol_decoder_star_line_get_compact(
+    void* context,
+    SubGhzProtocolDecoderCompact* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderStarLine* instance = context;
+    subghz_block_generic_get_compact(&instance->generic, output);
+    output->manufacture = instance->manufacture_name;
+    return true;
+}
+
 void subghz_protocol_decoder_star_line_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderStarLine* instance = context;
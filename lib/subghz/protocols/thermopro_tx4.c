@@ -86,6 +86,7 @@ const SubGhzProtocol ws_protocol_thermopro_tx4 = {
     .encoder = &ws_protocol_thermopro_tx4_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_thermopro_tx4_const,
 };
 
 void* ws_protocol_decoder_thermopro_tx4_alloc(SubGhzEnvironment* environment) {
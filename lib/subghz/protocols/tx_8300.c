@@ -97,6 +97,7 @@ const SubGhzProtocol ws_protocol_tx_8300 = {
     .encoder = &ws_protocol_tx_8300_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_tx_8300_const,
 };
 
 void* ws_protocol_decoder_tx_8300_alloc(SubGhzEnvironment* environment) {
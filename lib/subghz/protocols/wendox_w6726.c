@@ -91,6 +91,7 @@ const SubGhzProtocol ws_protocol_wendox_w6726 = {
     .encoder = &ws_protocol_wendox_w6726_encoder,
 
     .filter = SubGhzProtocolFilter_Weather,
+    .timing = &ws_protocol_wendox_w6726_const,
 };
 
 void* ws_protocol_decoder_wendox_w6726_alloc(SubGhzEnvironment* environment) {
@@ -5,8 +5,14 @@
 
 #include <m-array.h>
 
+/* Number of consecutive out-of-window pulses delivered to a decoder
+ * before it is considered idle and stops receiving them */
+#define SUBGHZ_RECEIVER_PREFILTER_IDLE_COUNT 2
+
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+    uint32_t duration_min;
+    uint8_t short_count;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -15,6 +21,8 @@ ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
 struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
+    SubGhzProtocolFlag modulation;
+    bool prefilter;
 
     SubGhzReceiverCallback callback;
     void* context;
@@ -33,9 +41,19 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         if(protocol->decoder && protocol->decoder->alloc) {
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+            slot->duration_min = 0;
+            if(protocol->timing) {
+                uint32_t te_min = MIN(protocol->timing->te_short, protocol->timing->te_long);
+                if(te_min > protocol->timing->te_delta) {
+                    slot->duration_min = te_min - protocol->timing->te_delta;
+                }
+            }
+            slot->short_count = SUBGHZ_RECEIVER_PREFILTER_IDLE_COUNT;
         }
     }
 
+    instance->prefilter = false;
+    instance->modulation = 0;
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -58,18 +76,53 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
     free(instance);
 }
 
-void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
-    furi_assert(instance);
-    furi_assert(instance->slots);
-
+static inline void
+    subghz_receiver_decode_pulse(SubGhzReceiver* instance, bool level, uint32_t duration) {
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+            if((slot->base->protocol->flag & instance->filter) == 0) continue;
+            if(instance->modulation) {
+                // Protocols that don't declare modulation are fed regardless
+                SubGhzProtocolFlag modulation = slot->base->protocol->flag &
+                                                (SubGhzProtocolFlag_AM | SubGhzProtocolFlag_FM);
+                if(modulation && (modulation & instance->modulation) == 0) continue;
+            }
+
+            if(instance->prefilter && (duration < slot->duration_min)) {
+                // Pulse is shorter than anything this protocol can produce:
+                // deliver it only while decoder may be mid-frame, so it can reset itself
+                if(slot->short_count >= SUBGHZ_RECEIVER_PREFILTER_IDLE_COUNT) continue;
+                slot->short_count++;
+            } else {
+                slot->short_count = 0;
             }
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
         }
 }
 
+void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
+    furi_assert(instance);
+    furi_assert(instance->slots);
+
+    subghz_receiver_decode_pulse(instance, level, duration);
+}
+
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(instance);
+    furi_assert(instance->slots);
+    furi_assert(level_duration || !count);
+
+    for(size_t i = 0; i < count; i++) {
+        subghz_receiver_decode_pulse(
+            instance,
+            level_duration_get_level(level_duration[i]),
+            level_duration_get_duration(level_duration[i]));
+    }
+}
+
 void subghz_receiver_reset(SubGhzReceiver* instance) {
     furi_assert(instance);
     furi_assert(instance->slots);
@@ -77,6 +130,7 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
+            slot->short_count = SUBGHZ_RECEIVER_PREFILTER_IDLE_COUNT;
         }
 }
 
@@ -108,6 +162,20 @@ void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag fil
     instance->filter = filter;
 }
 
+void subghz_receiver_set_modulation(SubGhzReceiver* instance, SubGhzProtocolFlag modulation) {
+    furi_assert(instance);
+    instance->modulation = modulation & (SubGhzProtocolFlag_AM | SubGhzProtocolFlag_FM);
+}
+
+void subghz_receiver_set_prefilter(SubGhzReceiver* instance, bool enable) {
+    furi_assert(instance);
+    if(instance->prefilter == enable) return;
+
+    // Decoders are reset so that pre-filter state matches decoder state
+    subghz_receiver_reset(instance);
+    instance->prefilter = enable;
+}
+
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
     SubGhzReceiver* instance,
     const char* decoder_name) {
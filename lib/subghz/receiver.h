@@ -35,6 +35,18 @@ void subghz_receiver_free(SubGhzReceiver* instance);
  */
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration);
 
+/**
+ * Parse a batch of levels and durations received from the air.
+ * Equivalent to calling subghz_receiver_decode for each element, but with a single call.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param level_duration Array of LevelDuration, must not contain reset or wait markers
+ * @param count Number of elements in array
+ */
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* level_duration,
+    size_t count);
+
 /**
  * Reset decoder SubGhzReceiver.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -59,6 +71,24 @@ void subghz_receiver_set_rx_callback(
  */
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter);
 
+/**
+ * Set modulation of the pulses that are fed to the receiver.
+ * Protocols flagged only with the other modulation are skipped.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param modulation SubGhzProtocolFlag_AM and/or SubGhzProtocolFlag_FM, 0 to feed all protocols
+ */
+void subghz_receiver_set_modulation(SubGhzReceiver* instance, SubGhzProtocolFlag modulation);
+
+/**
+ * Enable or disable the pulse pre-filter.
+ * When enabled, pulses shorter than the shortest element of a protocol
+ * (te_short - te_delta) are not passed to its decoder, unless the decoder
+ * may be in the middle of a frame. Protocols without timing info always get all pulses.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param enable true to enable pre-filter
+ */
+void subghz_receiver_set_prefilter(SubGhzReceiver* instance, bool enable);
+
 /**
  * Search for a cattery by his name.
  * @param instance Pointer to a SubGhzReceiver instance
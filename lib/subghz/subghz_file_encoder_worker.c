@@ -4,6 +4,7 @@
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
+#include <toolbox/varint.h>
 
 #define TAG "SubGhzFileEncoderWorker"
 
@@ -20,6 +21,9 @@ struct SubGhzFileEncoderWorker {
     volatile bool worker_stopping;
     bool level;
     bool is_storage_slow;
+    bool is_varint;
+    uint8_t varint_buffer[SUBGHZ_FILE_ENCODER_LOAD];
+    size_t varint_size;
     FuriString* str_data;
     FuriString* file_path;
     const SubGhzDevice* device;
@@ -56,6 +60,20 @@ void subghz_file_encoder_worker_add_level_duration(
     }
 }
 
+static void subghz_file_encoder_worker_add_raw_value(
+    SubGhzFileEncoderWorker* instance,
+    int32_t duration) {
+    if((duration < -1000000) || (duration > 1000000)) {
+        if(duration > 0) {
+            subghz_file_encoder_worker_add_level_duration(instance, (int32_t)100);
+        } else {
+            subghz_file_encoder_worker_add_level_duration(instance, (int32_t)-100);
+        }
+    } else {
+        subghz_file_encoder_worker_add_level_duration(instance, duration);
+    }
+}
+
 bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
     char* str1;
     int32_t temp_ds = 0;
@@ -77,22 +95,61 @@ bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, co
             str1 += 1;
             //
             temp_ds = atoi(str1);
-            if((temp_ds < -1000000) || (temp_ds > 1000000)) {
-                if(temp_ds > 0) {
-                    subghz_file_encoder_worker_add_level_duration(instance, (int32_t)100);
-                } else {
-                    subghz_file_encoder_worker_add_level_duration(instance, (int32_t)-100);
-                }
-                //FURI_LOG_I("PARSE", "Number overflow - %d", atoi(str1));
-            } else {
-                subghz_file_encoder_worker_add_level_duration(instance, temp_ds);
-            }
+            subghz_file_encoder_worker_add_raw_value(instance, temp_ds);
         }
         res = true;
     }
     return res;
 }
 
+/** Parse next chunk of varint encoded RAW data
+ *
+ * Produces at most SUBGHZ_FILE_ENCODER_LOAD durations per call.
+ *
+ * @param instance 
+ * @param stream file stream positioned in binary payload 
+ * @return false on end of file or corrupted data 
+ */
+static bool
+    subghz_file_encoder_worker_varint_parse(SubGhzFileEncoderWorker* instance, Stream* stream) {
+    size_t read = stream_read(
+        stream,
+        &instance->varint_buffer[instance->varint_size],
+        SUBGHZ_FILE_ENCODER_LOAD - instance->varint_size);
+    instance->varint_size += read;
+
+    size_t offset = 0;
+    while(offset < instance->varint_size) {
+        // Make sure the whole value is in the buffer
+        size_t length = 0;
+        while((offset + length < instance->varint_size) &&
+              (instance->varint_buffer[offset + length] & 0x80)) {
+            length++;
+        }
+        if(offset + length == instance->varint_size) break;
+        if(length >= 5) {
+            FURI_LOG_E(TAG, "Invalid varint in the stream");
+            return false;
+        }
+
+        int32_t duration = 0;
+        offset += varint_int32_unpack(
+            &duration, &instance->varint_buffer[offset], instance->varint_size - offset);
+        if(duration != 0) {
+            subghz_file_encoder_worker_add_raw_value(instance, duration);
+        }
+    }
+
+    if((offset == 0) && (read == 0)) {
+        return false;
+    }
+
+    instance->varint_size -= offset;
+    memmove(instance->varint_buffer, &instance->varint_buffer[offset], instance->varint_size);
+
+    return true;
+}
+
 void subghz_file_encoder_worker_get_text_progress(
     SubGhzFileEncoderWorker* instance,
     FuriString* output) {
@@ -155,6 +212,20 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
 
         //skip the end of the previous line "\n"
         stream_seek(stream, 1, StreamOffsetFromCurrent);
+
+        // Binary payload is announced by encoding key right after protocol
+        size_t data_offset = stream_tell(stream);
+        instance->is_varint = false;
+        instance->varint_size = 0;
+        if(stream_read_line(stream, instance->str_data)) {
+            furi_string_trim(instance->str_data);
+            instance->is_varint = furi_string_equal(
+                instance->str_data,
+                SUBGHZ_RAW_FILE_ENCODING_KEY ": " SUBGHZ_RAW_FILE_ENCODING_VARINT);
+        }
+        if(!instance->is_varint) {
+            stream_seek(stream, data_offset, StreamOffsetFromStart);
+        }
         res = true;
         instance->worker_stopping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -163,7 +234,12 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
+            if(instance->is_varint) {
+                if(!subghz_file_encoder_worker_varint_parse(instance, stream)) {
+                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+                    break;
+                }
+            } else if(stream_read_line(stream, instance->str_data)) {
                 furi_string_trim(instance->str_data);
                 if(!subghz_file_encoder_worker_data_parse(
                        instance, furi_string_get_cstr(instance->str_data))) {
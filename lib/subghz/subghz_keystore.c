@@ -13,6 +13,7 @@
 #define TAG "SubGhzKeystore"
 
 #define FILE_BUFFER_SIZE 64
+#define FILE_READ_CHUNK_SIZE 512
 
 #define SUBGHZ_KEYSTORE_FILE_TYPE "Flipper SubGhz Keystore File"
 #define SUBGHZ_KEYSTORE_FILE_RAW_TYPE "Flipper SubGhz Keystore RAW File"
@@ -22,15 +23,36 @@
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_NAME_CHUNK_SIZE 1024
+#define SUBGHZ_KEYSTORE_NAME_TABLE_MIN_SIZE 32
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
 } SubGhzKeystoreEncryption;
 
+static void subghz_keystore_kl_index_clear(SubGhzKeystore* instance) {
+    if(instance->kl_blocks) {
+        memset(
+            instance->kl_blocks,
+            0,
+            sizeof(SubGhzKeystoreKlBlock) * SUBGHZ_KEYSTORE_KL_BLOCKS(instance->kl_keys_count));
+        free(instance->kl_blocks);
+        instance->kl_blocks = NULL;
+    }
+    instance->kl_keys_count = 0;
+}
+
 SubGhzKeystore* subghz_keystore_alloc() {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    instance->names = NULL;
+    instance->names_table = NULL;
+    instance->names_table_size = 0;
+    instance->names_count = 0;
+    instance->kl_blocks = NULL;
+    instance->kl_keys_count = 0;
 
     subghz_keystore_reset_kl(instance);
 
@@ -49,21 +71,138 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
 
     for
         M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
-            furi_string_free(manufacture_code->name);
             manufacture_code->key = 0;
         }
     SubGhzKeyArray_clear(instance->data);
+    subghz_keystore_kl_index_clear(instance);
+
+    while(instance->names) {
+        SubGhzKeystoreNameChunk* next = instance->names->next;
+        free(instance->names);
+        instance->names = next;
+    }
+    free(instance->names_table);
 
     free(instance);
 }
 
+static void subghz_keystore_kl_index_update(SubGhzKeystore* instance) {
+    subghz_keystore_kl_index_clear(instance);
+
+    size_t keys_count = SubGhzKeyArray_size(instance->data);
+    size_t blocks_count = SUBGHZ_KEYSTORE_KL_BLOCKS(keys_count);
+    instance->kl_keys_count = keys_count;
+    if(!blocks_count) return;
+    instance->kl_blocks = malloc(sizeof(SubGhzKeystoreKlBlock) * blocks_count);
+    memset(instance->kl_blocks, 0, sizeof(SubGhzKeystoreKlBlock) * blocks_count);
+
+    size_t index = 0;
+    for
+        M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
+            SubGhzKeystoreKlBlock* block =
+                &instance->kl_blocks[index / SUBGHZ_KEYSTORE_KL_BLOCK_KEYS];
+            uint32_t lane = 1UL << (index % SUBGHZ_KEYSTORE_KL_BLOCK_KEYS);
+            for(size_t i = 0; i < 64; i++) {
+                if((manufacture_code->key >> i) & 1) block->key[i] |= lane;
+            }
+            // Keys with types unknown to the index are never matched by KeeLoq
+            if(manufacture_code->type < SUBGHZ_KEYSTORE_KL_TYPE_COUNT) {
+                block->type[manufacture_code->type] |= lane;
+            }
+            index++;
+        }
+}
+
+const SubGhzKeystoreKlBlock*
+    subghz_keystore_get_kl_blocks(SubGhzKeystore* instance, size_t* keys_count) {
+    furi_assert(instance);
+    furi_assert(keys_count);
+
+    if(instance->kl_keys_count != SubGhzKeyArray_size(instance->data)) {
+        subghz_keystore_kl_index_update(instance);
+    }
+    *keys_count = instance->kl_keys_count;
+    return instance->kl_blocks;
+}
+
+static uint32_t subghz_keystore_name_hash(const char* name) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    while(*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static const char** subghz_keystore_name_slot(SubGhzKeystore* instance, const char* name) {
+    size_t mask = instance->names_table_size - 1;
+    size_t index = subghz_keystore_name_hash(name) & mask;
+    while(instance->names_table[index] && strcmp(instance->names_table[index], name) != 0) {
+        index = (index + 1) & mask;
+    }
+    return &instance->names_table[index];
+}
+
+static void subghz_keystore_names_table_grow(SubGhzKeystore* instance) {
+    const char** old_table = instance->names_table;
+    size_t old_size = instance->names_table_size;
+
+    instance->names_table_size = old_size ? old_size * 2 : SUBGHZ_KEYSTORE_NAME_TABLE_MIN_SIZE;
+    instance->names_table = malloc(sizeof(const char*) * instance->names_table_size);
+    memset(instance->names_table, 0, sizeof(const char*) * instance->names_table_size);
+
+    for(size_t i = 0; i < old_size; i++) {
+        if(old_table[i]) *subghz_keystore_name_slot(instance, old_table[i]) = old_table[i];
+    }
+    free(old_table);
+}
+
+static const char* subghz_keystore_intern_name(SubGhzKeystore* instance, const char* name) {
+    // Keep load factor under 1/2
+    if((instance->names_count + 1) * 2 > instance->names_table_size) {
+        subghz_keystore_names_table_grow(instance);
+    }
+
+    const char** slot = subghz_keystore_name_slot(instance, name);
+    if(*slot) return *slot;
+
+    size_t size = strlen(name) + 1;
+    SubGhzKeystoreNameChunk* chunk = instance->names;
+    if(!chunk || (chunk->size - chunk->used) < size) {
+        size_t chunk_size = MAX((size_t)SUBGHZ_KEYSTORE_NAME_CHUNK_SIZE, size);
+        chunk = malloc(sizeof(SubGhzKeystoreNameChunk) + chunk_size);
+        chunk->next = instance->names;
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        instance->names = chunk;
+    }
+
+    char* interned = &chunk->data[chunk->used];
+    memcpy(interned, name, size);
+    chunk->used += size;
+
+    *slot = interned;
+    instance->names_count++;
+
+    return interned;
+}
+
+const char* subghz_keystore_find_name(SubGhzKeystore* instance, const char* name) {
+    furi_assert(instance);
+    furi_assert(name);
+
+    if(!instance->names_table_size) return NULL;
+    return *subghz_keystore_name_slot(instance, name);
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
     const char* name,
     uint64_t key,
     uint16_t type) {
     SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
-    manufacture_code->name = furi_string_alloc_set(name);
+    manufacture_code->name = subghz_keystore_intern_name(instance, name);
     manufacture_code->key = key;
     manufacture_code->type = type;
 }
@@ -114,10 +253,11 @@ static void subghz_keystore_mess_with_iv(uint8_t* iv) {
 
 static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream, uint8_t* iv) {
     bool result = true;
-    uint8_t buffer[FILE_BUFFER_SIZE];
+    uint8_t* buffer = malloc(FILE_READ_CHUNK_SIZE);
 
-    char* decrypted_line = malloc(SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
-    char* encrypted_line = malloc(SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE);
+    // Line buffers are terminated by cursor, one extra byte for the terminator
+    char* decrypted_line = malloc(SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE + 1);
+    char* encrypted_line = malloc(SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE + 1);
     size_t encrypted_line_cursor = 0;
 
     do {
@@ -130,13 +270,14 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
 
         size_t ret = 0;
         do {
-            ret = stream_read(stream, buffer, FILE_BUFFER_SIZE);
+            ret = stream_read(stream, buffer, FILE_READ_CHUNK_SIZE);
             for(uint16_t i = 0; i < ret; i++) {
                 if(buffer[i] == '\n' && encrypted_line_cursor > 0) {
+                    encrypted_line[encrypted_line_cursor] = '\0';
                     // Process line
                     if(iv) {
                         // Data alignment check, 32 instead of 16 because of hex encoding
-                        size_t len = strlen(encrypted_line);
+                        size_t len = encrypted_line_cursor;
                         if(len % 32 == 0) {
                             // Inplace hex to bin conversion
                             for(size_t i = 0; i < len; i += 2) {
@@ -150,6 +291,7 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
 
                             if(furi_hal_crypto_decrypt(
                                    (uint8_t*)encrypted_line, (uint8_t*)decrypted_line, len)) {
+                                decrypted_line[len] = '\0';
                                 subghz_keystore_process_line(instance, decrypted_line);
                             } else {
                                 FURI_LOG_E(TAG, "Decryption failed");
@@ -162,9 +304,7 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
                     } else {
                         subghz_keystore_process_line(instance, encrypted_line);
                     }
-                    // reset line buffer
-                    memset(decrypted_line, 0, SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
-                    memset(encrypted_line, 0, SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE);
+                    // reset line buffer, contents are wiped once when done
                     encrypted_line_cursor = 0;
                 } else if(buffer[i] == '\r' || buffer[i] == '\n') {
                     // do not add line endings to the buffer
@@ -184,6 +324,10 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
         if(iv) furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
     } while(false);
 
+    memset(buffer, 0, FILE_READ_CHUNK_SIZE);
+    memset(decrypted_line, 0, SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE + 1);
+    memset(encrypted_line, 0, SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE + 1);
+    free(buffer);
     free(encrypted_line);
     free(decrypted_line);
 
@@ -246,6 +390,9 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
 
     furi_string_free(filetype);
 
+    // Build KeeLoq search index now, not on first received packet
+    if(result) subghz_keystore_kl_index_update(instance);
+
     return result;
 }
 
@@ -300,7 +447,7 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
                     (uint32_t)(key->key >> 32),
                     (uint32_t)key->key,
                     key->type,
-                    furi_string_get_cstr(key->name));
+                    key->name);
                 // Verify length and align
                 furi_assert(len > 0);
                 if(len % 16 != 0) {
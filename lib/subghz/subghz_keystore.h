@@ -9,8 +9,9 @@ extern "C" {
 #endif
 
 typedef struct {
-    FuriString* name;
     uint64_t key;
+    // Interned in keystore, keys with same manufacture share the pointer
+    const char* name;
     uint16_t type;
 } SubGhzKey;
 
@@ -54,6 +55,16 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* filename, uint8_
  */
 SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance);
 
+/** 
+ * Find manufacture name in keystore
+ * Keys of this manufacture have SubGhzKey::name equal to the returned pointer,
+ * so they can be matched without string comparison
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param name Manufacture name
+ * @return Interned name, valid while keystore exists, or NULL if there is no such manufacture
+ */
+const char* subghz_keystore_find_name(SubGhzKeystore* instance, const char* name);
+
 /** 
  * Save RAW encrypted to file
  * @param input_file_name Full path to the input file
@@ -2,8 +2,50 @@
 
 #include <m-array.h>
 
+/** Number of keys in one bit-sliced block, one key per bit of uint32_t */
+#define SUBGHZ_KEYSTORE_KL_BLOCK_KEYS 32
+/** Number of blocks needed for keys_count keys */
+#define SUBGHZ_KEYSTORE_KL_BLOCKS(keys_count) \
+    (((keys_count) + SUBGHZ_KEYSTORE_KL_BLOCK_KEYS - 1) / SUBGHZ_KEYSTORE_KL_BLOCK_KEYS)
+/** Learning types tracked by the index, see KEELOQ_LEARNING_* */
+#define SUBGHZ_KEYSTORE_KL_TYPE_COUNT 9
+
+/** Bit-sliced view of SUBGHZ_KEYSTORE_KL_BLOCK_KEYS consecutive keys, lane N is key N */
+typedef struct {
+    // bit N of key[i] is bit i of key N
+    uint32_t key[64];
+    // bit N of type[t] is set if key N has learning type t
+    uint32_t type[SUBGHZ_KEYSTORE_KL_TYPE_COUNT];
+} SubGhzKeystoreKlBlock;
+
+/** Chunk of manufacture names storage, chunks are never moved or resized */
+typedef struct SubGhzKeystoreNameChunk SubGhzKeystoreNameChunk;
+
+struct SubGhzKeystoreNameChunk {
+    SubGhzKeystoreNameChunk* next;
+    size_t size;
+    size_t used;
+    char data[];
+};
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
+    // Deduplicated manufacture names and open addressing hash index over them
+    SubGhzKeystoreNameChunk* names;
+    const char** names_table;
+    size_t names_table_size;
+    size_t names_count;
+    SubGhzKeystoreKlBlock* kl_blocks;
+    size_t kl_keys_count;
     const char* mfname;
     uint8_t kl_type;
 };
+
+/** 
+ * Get bit-sliced index of keys, rebuilt if keys were changed since last call
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param keys_count Number of keys covered by the index
+ * @return Array of SUBGHZ_KEYSTORE_KL_BLOCKS(keys_count) blocks
+ */
+const SubGhzKeystoreKlBlock*
+    subghz_keystore_get_kl_blocks(SubGhzKeystore* instance, size_t* keys_count);
@@ -100,10 +100,17 @@ typedef struct {
     SubGhzSettingCustomPresetItemArray_t data;
 } SubGhzSettingCustomPresetStruct;
 
+// Same layout as custom preset, but data is owned and items are never removed
+ARRAY_DEF(SubGhzSettingPresetDescriptorArray, SubGhzSettingCustomPresetItem, M_POD_OPLIST)
+
+#define M_OPL_SubGhzSettingPresetDescriptorArray_t() \
+    ARRAY_OPLIST(SubGhzSettingPresetDescriptorArray, M_POD_OPLIST)
+
 struct SubGhzSetting {
     FrequencyList_t frequencies;
     FrequencyList_t hopper_frequencies;
     SubGhzSettingCustomPresetStruct* preset;
+    SubGhzSettingPresetDescriptorArray_t interned_presets;
 };
 
 SubGhzSetting* subghz_setting_alloc(void) {
@@ -112,6 +119,7 @@ SubGhzSetting* subghz_setting_alloc(void) {
     FrequencyList_init(instance->hopper_frequencies);
     instance->preset = malloc(sizeof(SubGhzSettingCustomPresetStruct));
     SubGhzSettingCustomPresetItemArray_init(instance->preset->data);
+    SubGhzSettingPresetDescriptorArray_init(instance->interned_presets);
     return instance;
 }
 
@@ -135,6 +143,12 @@ void subghz_setting_free(SubGhzSetting* instance) {
         }
     SubGhzSettingCustomPresetItemArray_clear(instance->preset->data);
     free(instance->preset);
+    for
+        M_EACH(item, instance->interned_presets, SubGhzSettingPresetDescriptorArray_t) {
+            furi_string_free(item->custom_preset_name);
+            free(item->custom_preset_data);
+        }
+    SubGhzSettingPresetDescriptorArray_clear(instance->interned_presets);
     free(instance);
 }
 
@@ -492,3 +506,57 @@ uint8_t subghz_setting_customs_presets_to_log(SubGhzSetting* instance) {
 #endif
     return 0;
 }
+
+size_t subghz_setting_intern_preset(
+    SubGhzSetting* instance,
+    const char* preset_name,
+    const uint8_t* preset_data,
+    size_t preset_data_size) {
+    furi_assert(instance);
+    furi_assert(preset_name);
+    if(!preset_data) preset_data_size = 0;
+
+    size_t idx = 0;
+    for
+        M_EACH(item, instance->interned_presets, SubGhzSettingPresetDescriptorArray_t) {
+            if((item->custom_preset_data_size == preset_data_size) &&
+               (strcmp(furi_string_get_cstr(item->custom_preset_name), preset_name) == 0) &&
+               (!preset_data_size ||
+                memcmp(item->custom_preset_data, preset_data, preset_data_size) == 0)) {
+                return idx;
+            }
+            idx++;
+        }
+
+    SubGhzSettingCustomPresetItem* item =
+        SubGhzSettingPresetDescriptorArray_push_raw(instance->interned_presets);
+    item->custom_preset_name = furi_string_alloc_set(preset_name);
+    item->custom_preset_data_size = preset_data_size;
+    item->custom_preset_data = NULL;
+    if(preset_data_size) {
+        item->custom_preset_data = malloc(preset_data_size);
+        memcpy(item->custom_preset_data, preset_data, preset_data_size);
+    }
+    return idx;
+}
+
+const char* subghz_setting_get_interned_preset_name(SubGhzSetting* instance, size_t idx) {
+    furi_assert(instance);
+    SubGhzSettingCustomPresetItem* item =
+        SubGhzSettingPresetDescriptorArray_get(instance->interned_presets, idx);
+    return furi_string_get_cstr(item->custom_preset_name);
+}
+
+uint8_t* subghz_setting_get_interned_preset_data(SubGhzSetting* instance, size_t idx) {
+    furi_assert(instance);
+    SubGhzSettingCustomPresetItem* item =
+        SubGhzSettingPresetDescriptorArray_get(instance->interned_presets, idx);
+    return item->custom_preset_data;
+}
+
+size_t subghz_setting_get_interned_preset_data_size(SubGhzSetting* instance, size_t idx) {
+    furi_assert(instance);
+    SubGhzSettingCustomPresetItem* item =
+        SubGhzSettingPresetDescriptorArray_get(instance->interned_presets, idx);
+    return item->custom_preset_data_size;
+}
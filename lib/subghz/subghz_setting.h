@@ -63,6 +63,28 @@ void subghz_setting_set_default_frequency(SubGhzSetting* instance, uint32_t freq
 
 uint8_t subghz_setting_customs_presets_to_log(SubGhzSetting* instance);
 
+/** Intern preset descriptor, shared by everything that only needs to refer to a preset
+ * Descriptors are never removed or changed, so index and data stay valid
+ * for the setting lifetime, even if custom preset with this name is deleted.
+ *
+ * @param instance SubGhzSetting instance
+ * @param preset_name Preset name
+ * @param preset_data Preset data, may be NULL
+ * @param preset_data_size Preset data size
+ * @return Index of descriptor with same name and data, added if missing
+ */
+size_t subghz_setting_intern_preset(
+    SubGhzSetting* instance,
+    const char* preset_name,
+    const uint8_t* preset_data,
+    size_t preset_data_size);
+
+const char* subghz_setting_get_interned_preset_name(SubGhzSetting* instance, size_t idx);
+
+uint8_t* subghz_setting_get_interned_preset_data(SubGhzSetting* instance, size_t idx);
+
+size_t subghz_setting_get_interned_preset_data_size(SubGhzSetting* instance, size_t idx);
+
 #ifdef __cplusplus
 }
 #endif
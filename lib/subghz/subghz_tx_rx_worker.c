@@ -9,6 +9,8 @@
 #define SUBGHZ_TXRX_WORKER_MAX_TXRX_SIZE 60
 
 #define SUBGHZ_TXRX_WORKER_TIMEOUT_READ_WRITE_BUF 40
+//listen for other side between messages, in worker loop iterations
+#define SUBGHZ_TXRX_WORKER_TX_GAP 10
 
 struct SubGhzTxRxWorker {
     FuriThread* thread;
@@ -156,20 +158,17 @@ static int32_t subghz_tx_rx_worker_thread(void* context) {
         //transmit
         size_tx = furi_stream_buffer_bytes_available(instance->stream_tx);
         if(size_tx > 0 && !timeout_tx) {
-            timeout_tx = 10; //20ms
-            if(size_tx > SUBGHZ_TXRX_WORKER_MAX_TXRX_SIZE) {
-                furi_stream_buffer_receive(
-                    instance->stream_tx,
-                    &data,
-                    SUBGHZ_TXRX_WORKER_MAX_TXRX_SIZE,
-                    SUBGHZ_TXRX_WORKER_TIMEOUT_READ_WRITE_BUF);
-                subghz_tx_rx_worker_tx(instance, data, SUBGHZ_TXRX_WORKER_MAX_TXRX_SIZE);
-            } else {
-                //TODO FL-3554: checking that it managed to write all the data to the TX buffer
-                furi_stream_buffer_receive(
-                    instance->stream_tx, &data, size_tx, SUBGHZ_TXRX_WORKER_TIMEOUT_READ_WRITE_BUF);
-                subghz_tx_rx_worker_tx(instance, data, size_tx);
-            }
+            size_t size_packet = MIN(size_tx, (size_t)SUBGHZ_TXRX_WORKER_MAX_TXRX_SIZE);
+            //TODO FL-3554: checking that it managed to write all the data to the TX buffer
+            furi_stream_buffer_receive(
+                instance->stream_tx,
+                &data,
+                size_packet,
+                SUBGHZ_TXRX_WORKER_TIMEOUT_READ_WRITE_BUF);
+            subghz_tx_rx_worker_tx(instance, data, size_packet);
+            // Rest of a long message goes out in full packets back to back, receiver is in RX
+            // again long before the next preamble ends. Gap only after the message
+            timeout_tx = (size_tx > size_packet) ? 0 : SUBGHZ_TXRX_WORKER_TX_GAP;
         } else {
             //receive
             if(subghz_tx_rx_worker_rx(instance, data, size_rx)) {
@@ -4,9 +4,11 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_BATCH_SIZE 64
+
 struct SubGhzWorker {
     FuriThread* thread;
-    FuriStreamBuffer* stream;
+    FuriSpscRing* ring;
 
     volatile bool running;
     volatile bool overrun;
@@ -16,7 +18,12 @@ struct SubGhzWorker {
 
     SubGhzWorkerOverrunCallback overrun_callback;
     SubGhzWorkerPairCallback pair_callback;
+    SubGhzWorkerPairBatchCallback pair_batch_callback;
     void* context;
+
+    LevelDuration rx_buffer[SUBGHZ_WORKER_BATCH_SIZE];
+    LevelDuration pair_buffer[SUBGHZ_WORKER_BATCH_SIZE];
+    size_t pair_count;
 };
 
 /** Rx callback timer
@@ -33,9 +40,49 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
         instance->overrun = false;
         level_duration = level_duration_reset();
     }
-    size_t ret =
-        furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
-    if(sizeof(LevelDuration) != ret) instance->overrun = true;
+    if(!furi_spsc_ring_push(instance->ring, &level_duration)) instance->overrun = true;
+}
+
+static void subghz_worker_flush_pairs(SubGhzWorker* instance) {
+    if(instance->pair_count) {
+        instance->pair_batch_callback(
+            instance->context, instance->pair_buffer, instance->pair_count);
+        instance->pair_count = 0;
+    }
+}
+
+static void subghz_worker_process(SubGhzWorker* instance, LevelDuration level_duration) {
+    if(level_duration_is_reset(level_duration)) {
+        FURI_LOG_E(TAG, "Overrun buffer");
+        if(instance->pair_batch_callback) subghz_worker_flush_pairs(instance);
+        if(instance->overrun_callback) instance->overrun_callback(instance->context);
+    } else {
+        bool level = level_duration_get_level(level_duration);
+        uint32_t duration = level_duration_get_duration(level_duration);
+
+        if((duration < instance->filter_duration) ||
+           (instance->filter_level_duration.level == level)) {
+            instance->filter_level_duration.duration += duration;
+
+        } else if(instance->filter_level_duration.level != level) {
+            if(instance->pair_batch_callback) {
+                instance->pair_buffer[instance->pair_count++] = level_duration_make(
+                    instance->filter_level_duration.level,
+                    instance->filter_level_duration.duration);
+                if(instance->pair_count == SUBGHZ_WORKER_BATCH_SIZE) {
+                    subghz_worker_flush_pairs(instance);
+                }
+            } else if(instance->pair_callback) {
+                instance->pair_callback(
+                    instance->context,
+                    instance->filter_level_duration.level,
+                    instance->filter_level_duration.duration);
+            }
+
+            instance->filter_level_duration.duration = duration;
+            instance->filter_level_duration.level = level;
+        }
+    }
 }
 
 /** Worker callback thread
@@ -46,34 +93,13 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
 static int32_t subghz_worker_thread_callback(void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration;
     while(instance->running) {
-        int ret = furi_stream_buffer_receive(
-            instance->stream, &level_duration, sizeof(LevelDuration), 10);
-        if(ret == sizeof(LevelDuration)) {
-            if(level_duration_is_reset(level_duration)) {
-                FURI_LOG_E(TAG, "Overrun buffer");
-                if(instance->overrun_callback) instance->overrun_callback(instance->context);
-            } else {
-                bool level = level_duration_get_level(level_duration);
-                uint32_t duration = level_duration_get_duration(level_duration);
-
-                if((duration < instance->filter_duration) ||
-                   (instance->filter_level_duration.level == level)) {
-                    instance->filter_level_duration.duration += duration;
-
-                } else if(instance->filter_level_duration.level != level) {
-                    if(instance->pair_callback)
-                        instance->pair_callback(
-                            instance->context,
-                            instance->filter_level_duration.level,
-                            instance->filter_level_duration.duration);
-
-                    instance->filter_level_duration.duration = duration;
-                    instance->filter_level_duration.level = level;
-                }
-            }
+        size_t count =
+            furi_spsc_ring_pop(instance->ring, instance->rx_buffer, SUBGHZ_WORKER_BATCH_SIZE, 10);
+        for(size_t i = 0; i < count; i++) {
+            subghz_worker_process(instance, instance->rx_buffer[i]);
         }
+        if(instance->pair_batch_callback) subghz_worker_flush_pairs(instance);
     }
 
     return 0;
@@ -85,8 +111,7 @@ SubGhzWorker* subghz_worker_alloc() {
     instance->thread =
         furi_thread_alloc_ex("SubGhzWorker", 2048, subghz_worker_thread_callback, instance);
 
-    instance->stream =
-        furi_stream_buffer_alloc(sizeof(LevelDuration) * 4096, sizeof(LevelDuration));
+    instance->ring = furi_spsc_ring_alloc(sizeof(LevelDuration), 4096);
 
     //setting default filter in us
     instance->filter_duration = 30;
@@ -97,7 +122,7 @@ SubGhzWorker* subghz_worker_alloc() {
 void subghz_worker_free(SubGhzWorker* instance) {
     furi_assert(instance);
 
-    furi_stream_buffer_free(instance->stream);
+    furi_spsc_ring_free(instance->ring);
     furi_thread_free(instance->thread);
 
     free(instance);
@@ -115,6 +140,14 @@ void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCal
     instance->pair_callback = callback;
 }
 
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback) {
+    furi_assert(instance);
+    furi_assert(!instance->running);
+    instance->pair_batch_callback = callback;
+}
+
 void subghz_worker_set_context(SubGhzWorker* instance, void* context) {
     furi_assert(instance);
     instance->context = context;
@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -21,6 +22,8 @@
 
 #define SUBGHZ_RAW_FILE_VERSION 1
 #define SUBGHZ_RAW_FILE_TYPE "Flipper SubGhz RAW File"
+#define SUBGHZ_RAW_FILE_ENCODING_KEY "RAW_Encoding"
+#define SUBGHZ_RAW_FILE_ENCODING_VARINT "Varint"
 
 #define SUBGHZ_KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
 #define SUBGHZ_KEYSTORE_DIR_USER_NAME EXT_PATH("subghz/assets/keeloq_mfcodes_user")
@@ -81,6 +84,18 @@ typedef void (*SubGhzDecoderReset)(void* decoder);
 typedef uint8_t (*SubGhzGetHashData)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 
+/** Compact summary of the received data, filled without heap allocations */
+typedef struct {
+    uint64_t key; ///< Key as stored in `Key` field
+    uint32_t serial;
+    uint32_t counter;
+    uint16_t bit_count;
+    uint8_t button;
+    const char* manufacture; ///< Keystore interned or static name, NULL if not applicable
+} SubGhzProtocolDecoderCompact;
+
+typedef bool (*SubGhzGetCompact)(void* decoder, SubGhzProtocolDecoderCompact* output);
+
 // Encoder specific
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
@@ -96,6 +111,7 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+    SubGhzGetCompact get_compact; ///< Optional
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -150,4 +166,6 @@ struct SubGhzProtocol {
     const SubGhzProtocolDecoder* decoder;
 
     SubGhzProtocolFilter filter;
+
+    const SubGhzBlockConst* timing; ///< Optional pulse timings, used by receiver pre-filter
 };
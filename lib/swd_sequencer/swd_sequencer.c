@@ -0,0 +1,291 @@
+#include "swd_sequencer.h"
+
+#include <furi.h>
+#include <furi_hal.h>
+#include <furi_hal_bus.h>
+
+#include <stm32wbxx_ll_dma.h>
+#include <stm32wbxx_ll_dmamux.h>
+#include <stm32wbxx_ll_tim.h>
+
+#define SWD_SEQUENCER_TIM TIM2
+#define SWD_SEQUENCER_DMA DMA1
+#define SWD_SEQUENCER_DMA_OUT_DEF SWD_SEQUENCER_DMA, LL_DMA_CHANNEL_1
+#define SWD_SEQUENCER_DMA_IN_DEF SWD_SEQUENCER_DMA, LL_DMA_CHANNEL_2
+
+/** Clocks per burst, enough for read data phase with parity and turnaround */
+#define SWD_SEQUENCER_BURST_BITS 64
+/** Two timer periods per clock, extra one marks the end of the last period */
+#define SWD_SEQUENCER_BURST_SLOTS (SWD_SEQUENCER_BURST_BITS * 2 + 1)
+#define SWD_SEQUENCER_DATA_BITS 33
+
+struct SwdSequencer {
+    GPIO_TypeDef* port;
+    uint16_t swdio_pin;
+
+    uint32_t clock_low;
+    uint32_t clock_high;
+    uint32_t data_low;
+    uint32_t data_high;
+
+    uint32_t frequency;
+    uint8_t turnaround;
+    uint8_t idle_cycles;
+    bool data_phase;
+
+    uint32_t out[SWD_SEQUENCER_BURST_SLOTS];
+    uint16_t in[SWD_SEQUENCER_BURST_SLOTS];
+};
+
+bool swd_sequencer_is_supported(const GpioPin* swclk, const GpioPin* swdio) {
+    furi_assert(swclk);
+    furi_assert(swdio);
+    return swclk->port == swdio->port && swclk->pin != swdio->pin;
+}
+
+SwdSequencer* swd_sequencer_alloc(const GpioPin* swclk, const GpioPin* swdio) {
+    furi_check(swd_sequencer_is_supported(swclk, swdio));
+
+    SwdSequencer* sequencer = malloc(sizeof(SwdSequencer));
+    sequencer->port = swclk->port;
+    sequencer->swdio_pin = swdio->pin;
+    sequencer->clock_low = (uint32_t)swclk->pin << 16;
+    sequencer->clock_high = swclk->pin;
+    sequencer->data_low = (uint32_t)swdio->pin << 16;
+    sequencer->data_high = swdio->pin;
+    sequencer->turnaround = 1;
+
+    LL_DMA_InitTypeDef dma_config = {0};
+    dma_config.PeriphOrM2MSrcAddress = (uint32_t) & (sequencer->port->BSRR);
+    dma_config.MemoryOrM2MDstAddress = (uint32_t)sequencer->out;
+    dma_config.Direction = LL_DMA_DIRECTION_MEMORY_TO_PERIPH;
+    dma_config.Mode = LL_DMA_MODE_NORMAL;
+    dma_config.PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT;
+    dma_config.MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT;
+    dma_config.PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_WORD;
+    dma_config.MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_WORD;
+    dma_config.PeriphRequest = LL_DMAMUX_REQ_TIM2_UP;
+    dma_config.Priority = LL_DMA_PRIORITY_VERYHIGH;
+    LL_DMA_Init(SWD_SEQUENCER_DMA_OUT_DEF, &dma_config);
+
+    dma_config.PeriphOrM2MSrcAddress = (uint32_t) & (sequencer->port->IDR);
+    dma_config.MemoryOrM2MDstAddress = (uint32_t)sequencer->in;
+    dma_config.Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+    dma_config.PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_HALFWORD;
+    dma_config.MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_HALFWORD;
+    dma_config.PeriphRequest = LL_DMAMUX_REQ_TIM2_CH1;
+    dma_config.Priority = LL_DMA_PRIORITY_HIGH;
+    LL_DMA_Init(SWD_SEQUENCER_DMA_IN_DEF, &dma_config);
+
+    furi_hal_bus_enable(FuriHalBusTIM2);
+    LL_TIM_SetCounterMode(SWD_SEQUENCER_TIM, LL_TIM_COUNTERMODE_UP);
+    LL_TIM_SetClockDivision(SWD_SEQUENCER_TIM, LL_TIM_CLOCKDIVISION_DIV1);
+    LL_TIM_SetPrescaler(SWD_SEQUENCER_TIM, 0);
+    LL_TIM_OC_SetMode(SWD_SEQUENCER_TIM, LL_TIM_CHANNEL_CH1, LL_TIM_OCMODE_FROZEN);
+    swd_sequencer_set_clock(sequencer, SWD_SEQUENCER_CLOCK_MAX);
+
+    return sequencer;
+}
+
+void swd_sequencer_free(SwdSequencer* sequencer) {
+    furi_assert(sequencer);
+
+    LL_TIM_DisableCounter(SWD_SEQUENCER_TIM);
+    LL_DMA_DisableChannel(SWD_SEQUENCER_DMA_OUT_DEF);
+    LL_DMA_DisableChannel(SWD_SEQUENCER_DMA_IN_DEF);
+    furi_hal_bus_disable(FuriHalBusTIM2);
+
+    free(sequencer);
+}
+
+uint32_t swd_sequencer_set_clock(SwdSequencer* sequencer, uint32_t frequency) {
+    furi_assert(sequencer);
+
+    frequency = CLAMP(frequency, (uint32_t)SWD_SEQUENCER_CLOCK_MAX, 1UL);
+    uint32_t period = SystemCoreClock / (frequency * 2);
+
+    LL_TIM_SetAutoReload(SWD_SEQUENCER_TIM, period - 1);
+    // Sample late in the low half of the clock, right before the rising edge
+    LL_TIM_OC_SetCompareCH1(SWD_SEQUENCER_TIM, period * 3 / 4);
+
+    sequencer->frequency = SystemCoreClock / (period * 2);
+    return sequencer->frequency;
+}
+
+void swd_sequencer_configure(
+    SwdSequencer* sequencer,
+    uint8_t turnaround,
+    uint8_t idle_cycles,
+    bool data_phase) {
+    furi_assert(sequencer);
+    furi_assert(turnaround >= 1 && turnaround <= 4);
+
+    sequencer->turnaround = turnaround;
+    sequencer->idle_cycles = idle_cycles;
+    sequencer->data_phase = data_phase;
+}
+
+static inline void swd_sequencer_set_swdio_output(SwdSequencer* sequencer, bool output) {
+    LL_GPIO_SetPinMode(
+        sequencer->port,
+        sequencer->swdio_pin,
+        output ? LL_GPIO_MODE_OUTPUT : LL_GPIO_MODE_INPUT);
+}
+
+static void swd_sequencer_run(SwdSequencer* sequencer, size_t bits) {
+    const size_t slots = bits * 2 + 1;
+    sequencer->out[slots - 1] = sequencer->out[slots - 2];
+
+    LL_TIM_DisableCounter(SWD_SEQUENCER_TIM);
+    LL_TIM_DisableDMAReq_UPDATE(SWD_SEQUENCER_TIM);
+    LL_TIM_DisableDMAReq_CC1(SWD_SEQUENCER_TIM);
+
+    LL_DMA_DisableChannel(SWD_SEQUENCER_DMA_OUT_DEF);
+    LL_DMA_DisableChannel(SWD_SEQUENCER_DMA_IN_DEF);
+    LL_DMA_ClearFlag_TC1(SWD_SEQUENCER_DMA);
+    LL_DMA_ClearFlag_TC2(SWD_SEQUENCER_DMA);
+    LL_DMA_SetDataLength(SWD_SEQUENCER_DMA_OUT_DEF, slots);
+    LL_DMA_SetDataLength(SWD_SEQUENCER_DMA_IN_DEF, slots - 1);
+    LL_DMA_EnableChannel(SWD_SEQUENCER_DMA_OUT_DEF);
+    LL_DMA_EnableChannel(SWD_SEQUENCER_DMA_IN_DEF);
+
+    // Update event writes the first word right away, the rest follow on counter reload
+    LL_TIM_SetCounter(SWD_SEQUENCER_TIM, 0);
+    LL_TIM_EnableDMAReq_UPDATE(SWD_SEQUENCER_TIM);
+    LL_TIM_EnableDMAReq_CC1(SWD_SEQUENCER_TIM);
+    LL_TIM_GenerateEvent_UPDATE(SWD_SEQUENCER_TIM);
+    LL_TIM_EnableCounter(SWD_SEQUENCER_TIM);
+
+    // Bursts are microseconds long at usual clocks, not worth a context switch
+    const uint32_t timeout_us = (uint64_t)bits * 1000000 / sequencer->frequency + 1000;
+    FuriHalCortexTimer timer = furi_hal_cortex_timer_get(timeout_us);
+    while(!LL_DMA_IsActiveFlag_TC1(SWD_SEQUENCER_DMA) ||
+          !LL_DMA_IsActiveFlag_TC2(SWD_SEQUENCER_DMA)) {
+        furi_check(!furi_hal_cortex_timer_is_expired(timer));
+    }
+
+    LL_TIM_DisableCounter(SWD_SEQUENCER_TIM);
+}
+
+/* Clock bits LSB first, value is only seen on the line when SWDIO is output */
+static uint64_t swd_sequencer_shift(SwdSequencer* sequencer, uint64_t value, size_t bits) {
+    furi_assert(bits > 0 && bits <= SWD_SEQUENCER_BURST_BITS);
+
+    for(size_t i = 0; i < bits; i++) {
+        const bool bit = (value >> i) & 1;
+        sequencer->out[i * 2] = sequencer->clock_low |
+                                (bit ? sequencer->data_high : sequencer->data_low);
+        sequencer->out[i * 2 + 1] = sequencer->clock_high;
+    }
+
+    swd_sequencer_run(sequencer, bits);
+
+    uint64_t result = 0;
+    for(size_t i = 0; i < bits; i++) {
+        if(sequencer->in[i * 2] & sequencer->swdio_pin) result |= 1ULL << i;
+    }
+    return result;
+}
+
+static void swd_sequencer_idle(SwdSequencer* sequencer, size_t cycles) {
+    while(cycles) {
+        const size_t bits = MIN(cycles, (size_t)SWD_SEQUENCER_BURST_BITS);
+        swd_sequencer_shift(sequencer, 0, bits);
+        cycles -= bits;
+    }
+}
+
+void swd_sequencer_write(SwdSequencer* sequencer, const uint8_t* data, size_t bits) {
+    furi_assert(sequencer);
+    furi_assert(data);
+
+    for(size_t offset = 0; offset < bits;) {
+        const size_t count = MIN(bits - offset, (size_t)SWD_SEQUENCER_BURST_BITS);
+        uint64_t value = 0;
+        for(size_t i = 0; i < count; i++) {
+            const size_t pos = offset + i;
+            if(data[pos / 8] & (1 << (pos % 8))) value |= 1ULL << i;
+        }
+        swd_sequencer_shift(sequencer, value, count);
+        offset += count;
+    }
+}
+
+void swd_sequencer_read(SwdSequencer* sequencer, uint8_t* data, size_t bits) {
+    furi_assert(sequencer);
+    furi_assert(data);
+
+    memset(data, 0, (bits + 7) / 8);
+    swd_sequencer_set_swdio_output(sequencer, false);
+    for(size_t offset = 0; offset < bits;) {
+        const size_t count = MIN(bits - offset, (size_t)SWD_SEQUENCER_BURST_BITS);
+        const uint64_t value = swd_sequencer_shift(sequencer, 0, count);
+        for(size_t i = 0; i < count; i++) {
+            const size_t pos = offset + i;
+            if((value >> i) & 1) data[pos / 8] |= 1 << (pos % 8);
+        }
+        offset += count;
+    }
+    swd_sequencer_set_swdio_output(sequencer, true);
+}
+
+uint8_t swd_sequencer_transfer(SwdSequencer* sequencer, uint8_t request, uint32_t* data) {
+    furi_assert(sequencer);
+
+    request &= SWD_SEQUENCER_REQUEST_APnDP | SWD_SEQUENCER_REQUEST_RnW |
+               SWD_SEQUENCER_REQUEST_A2 | SWD_SEQUENCER_REQUEST_A3;
+    const bool read = request & SWD_SEQUENCER_REQUEST_RnW;
+    const size_t turnaround = sequencer->turnaround;
+
+    const uint8_t header = 0x81 | (request << 1) | (__builtin_parity(request) << 5);
+    swd_sequencer_shift(sequencer, header, 8);
+
+    // Writes turn the line around right after ACK, it goes in the same burst
+    swd_sequencer_set_swdio_output(sequencer, false);
+    const size_t ack_bits = turnaround + 3 + (read ? 0 : turnaround);
+    uint8_t ack = (swd_sequencer_shift(sequencer, 0, ack_bits) >> turnaround) & 0x07;
+
+    if(ack == SWD_SEQUENCER_ACK_OK) {
+        if(read) {
+            const uint64_t value =
+                swd_sequencer_shift(sequencer, 0, SWD_SEQUENCER_DATA_BITS + turnaround);
+            swd_sequencer_set_swdio_output(sequencer, true);
+
+            if((uint32_t)__builtin_parity((uint32_t)value) != ((value >> 32) & 1)) {
+                ack = SWD_SEQUENCER_PARITY_ERROR;
+            }
+            if(data) *data = value;
+            swd_sequencer_idle(sequencer, sequencer->idle_cycles);
+        } else {
+            furi_assert(data);
+            swd_sequencer_set_swdio_output(sequencer, true);
+
+            // Idle cycles are data low, they share the burst when they fit
+            const uint64_t value = *data | ((uint64_t)__builtin_parity(*data) << 32);
+            const size_t idle = MIN(
+                (size_t)sequencer->idle_cycles,
+                (size_t)(SWD_SEQUENCER_BURST_BITS - SWD_SEQUENCER_DATA_BITS));
+            swd_sequencer_shift(sequencer, value, SWD_SEQUENCER_DATA_BITS + idle);
+            swd_sequencer_idle(sequencer, sequencer->idle_cycles - idle);
+        }
+    } else if(ack == SWD_SEQUENCER_ACK_WAIT || ack == SWD_SEQUENCER_ACK_FAULT) {
+        if(read) {
+            const size_t bits = (sequencer->data_phase ? SWD_SEQUENCER_DATA_BITS : 0) +
+                                turnaround;
+            swd_sequencer_shift(sequencer, 0, bits);
+            swd_sequencer_set_swdio_output(sequencer, true);
+        } else {
+            swd_sequencer_set_swdio_output(sequencer, true);
+            if(sequencer->data_phase) swd_sequencer_shift(sequencer, 0, SWD_SEQUENCER_DATA_BITS);
+        }
+    } else {
+        // No valid response, clock out whatever the target may still be sending
+        const size_t bits = SWD_SEQUENCER_DATA_BITS + (read ? turnaround : 0);
+        swd_sequencer_shift(sequencer, 0, bits);
+        swd_sequencer_set_swdio_output(sequencer, true);
+    }
+
+    LL_GPIO_SetOutputPin(sequencer->port, sequencer->swdio_pin);
+
+    return ack;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file swd_sequencer.h
+ * Timer and DMA driven SWD waveform engine
+ *
+ * Each SWD clock is two timer periods. Precomputed BSRR words are written to
+ * the port by DMA on timer update, SWDIO is sampled from IDR by a second DMA
+ * channel on timer compare, so clock timing doesn't depend on CPU load.
+ * A transfer is split in bursts at direction changes (turnaround), SWCLK is
+ * parked high between them as SWD allows the clock to stall.
+ *
+ * SWCLK and SWDIO must be on the same GPIO port and configured as outputs by
+ * the caller. Uses TIM2 and DMA1 channels 1 and 2 while allocated, same as
+ * digital_sequence, so they can't be used at the same time.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <furi_hal_gpio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWD_SEQUENCER_CLOCK_MAX 4000000
+
+/** Transfer request bits, same as CMSIS-DAP */
+#define SWD_SEQUENCER_REQUEST_APnDP (1 << 0)
+#define SWD_SEQUENCER_REQUEST_RnW (1 << 1)
+#define SWD_SEQUENCER_REQUEST_A2 (1 << 2)
+#define SWD_SEQUENCER_REQUEST_A3 (1 << 3)
+
+/** Transfer results, same as CMSIS-DAP */
+#define SWD_SEQUENCER_ACK_OK (1 << 0)
+#define SWD_SEQUENCER_ACK_WAIT (1 << 1)
+#define SWD_SEQUENCER_ACK_FAULT (1 << 2)
+#define SWD_SEQUENCER_PARITY_ERROR (1 << 3)
+
+typedef struct SwdSequencer SwdSequencer;
+
+/** Check if pins can be driven by sequencer */
+bool swd_sequencer_is_supported(const GpioPin* swclk, const GpioPin* swdio);
+
+/** Allocate sequencer and take TIM2 and DMA channels */
+SwdSequencer* swd_sequencer_alloc(const GpioPin* swclk, const GpioPin* swdio);
+
+/** Release TIM2 and DMA channels, pins are left as they are */
+void swd_sequencer_free(SwdSequencer* sequencer);
+
+/** Set SWCLK frequency
+ *
+ * @param      sequencer  SwdSequencer instance
+ * @param      frequency  frequency in Hz, clamped to SWD_SEQUENCER_CLOCK_MAX
+ *
+ * @return     frequency in Hz that is actually used
+ */
+uint32_t swd_sequencer_set_clock(SwdSequencer* sequencer, uint32_t frequency);
+
+/** Set transfer parameters
+ *
+ * @param      sequencer    SwdSequencer instance
+ * @param      turnaround   turnaround period in clocks, 1..4
+ * @param      idle_cycles  idle clocks after each successful transfer
+ * @param      data_phase   clock data phase on WAIT and FAULT
+ */
+void swd_sequencer_configure(
+    SwdSequencer* sequencer,
+    uint8_t turnaround,
+    uint8_t idle_cycles,
+    bool data_phase);
+
+/** Clock bits out on SWDIO, LSB first
+ *
+ * @param      sequencer  SwdSequencer instance
+ * @param      data       bits to send
+ * @param      bits       bits count
+ */
+void swd_sequencer_write(SwdSequencer* sequencer, const uint8_t* data, size_t bits);
+
+/** Clock bits in from SWDIO, LSB first, SWDIO is released for the time of reading
+ *
+ * @param      sequencer  SwdSequencer instance
+ * @param      data       buffer for bits, at least (bits + 7) / 8 bytes
+ * @param      bits       bits count
+ */
+void swd_sequencer_read(SwdSequencer* sequencer, uint8_t* data, size_t bits);
+
+/** Perform SWD transfer
+ *
+ * @param      sequencer  SwdSequencer instance
+ * @param      request    SWD_SEQUENCER_REQUEST_* bits
+ * @param      data       data to write or buffer for read data
+ *
+ * @return     ACK bits as received, or SWD_SEQUENCER_PARITY_ERROR
+ */
+uint8_t swd_sequencer_transfer(SwdSequencer* sequencer, uint8_t request, uint32_t* data);
+
+#ifdef __cplusplus
+}
+#endif
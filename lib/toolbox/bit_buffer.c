@@ -5,10 +5,14 @@
 #define BITS_IN_BYTE (8)
 
 struct BitBuffer {
+    // Start of the current window, may be moved forward by bit_buffer_trim_left
     uint8_t* data;
     uint8_t* parity;
     size_t capacity_bytes;
     size_t size_bits;
+    // Whole allocated storage
+    uint8_t* storage;
+    size_t storage_capacity_bytes;
 };
 
 BitBuffer* bit_buffer_alloc(size_t capacity_bytes) {
@@ -16,7 +20,9 @@ BitBuffer* bit_buffer_alloc(size_t capacity_bytes) {
 
     BitBuffer* buf = malloc(sizeof(BitBuffer));
 
-    buf->data = malloc(capacity_bytes);
+    buf->storage = malloc(capacity_bytes);
+    buf->storage_capacity_bytes = capacity_bytes;
+    buf->data = buf->storage;
     size_t parity_buf_size = (capacity_bytes + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
     buf->parity = malloc(parity_buf_size);
     buf->capacity_bytes = capacity_bytes;
@@ -28,14 +34,21 @@ BitBuffer* bit_buffer_alloc(size_t capacity_bytes) {
 void bit_buffer_free(BitBuffer* buf) {
     furi_assert(buf);
 
-    free(buf->data);
+    free(buf->storage);
     free(buf->parity);
     free(buf);
 }
 
+// Operations that replace all data start over from the beginning of the storage
+static inline void bit_buffer_restore_window(BitBuffer* buf) {
+    buf->data = buf->storage;
+    buf->capacity_bytes = buf->storage_capacity_bytes;
+}
+
 void bit_buffer_reset(BitBuffer* buf) {
     furi_assert(buf);
 
+    bit_buffer_restore_window(buf);
     memset(buf->data, 0, buf->capacity_bytes);
     size_t parity_buf_size = (buf->capacity_bytes + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
     memset(buf->parity, 0, parity_buf_size);
@@ -48,6 +61,7 @@ void bit_buffer_copy(BitBuffer* buf, const BitBuffer* other) {
 
     if(buf == other) return;
 
+    bit_buffer_restore_window(buf);
     furi_assert(buf->capacity_bytes * BITS_IN_BYTE >= other->size_bits);
 
     memcpy(buf->data, other->data, bit_buffer_get_size_bytes(other));
@@ -58,25 +72,38 @@ void bit_buffer_copy_right(BitBuffer* buf, const BitBuffer* other, size_t start_
     furi_assert(buf);
     furi_assert(other);
     furi_assert(bit_buffer_get_size_bytes(other) > start_index);
-    furi_assert(buf->capacity_bytes >= bit_buffer_get_size_bytes(other) - start_index);
 
-    memcpy(buf->data, other->data + start_index, bit_buffer_get_size_bytes(other) - start_index);
-    buf->size_bits = other->size_bits - start_index * BITS_IN_BYTE;
+    const uint8_t* src = other->data + start_index;
+    const size_t size_bytes = bit_buffer_get_size_bytes(other) - start_index;
+    const size_t size_bits = other->size_bits - start_index * BITS_IN_BYTE;
+
+    bit_buffer_restore_window(buf);
+    furi_assert(buf->capacity_bytes >= size_bytes);
+
+    // Source may be a window into this very buffer
+    memmove(buf->data, src, size_bytes);
+    buf->size_bits = size_bits;
 }
 
 void bit_buffer_copy_left(BitBuffer* buf, const BitBuffer* other, size_t end_index) {
     furi_assert(buf);
     furi_assert(other);
-    furi_assert(bit_buffer_get_capacity_bytes(buf) >= end_index);
     furi_assert(bit_buffer_get_size_bytes(other) >= end_index);
 
-    memcpy(buf->data, other->data, end_index);
+    const uint8_t* src = other->data;
+
+    bit_buffer_restore_window(buf);
+    furi_assert(bit_buffer_get_capacity_bytes(buf) >= end_index);
+
+    memmove(buf->data, src, end_index);
     buf->size_bits = end_index * BITS_IN_BYTE;
 }
 
 void bit_buffer_copy_bytes(BitBuffer* buf, const uint8_t* data, size_t size_bytes) {
     furi_assert(buf);
     furi_assert(data);
+
+    bit_buffer_restore_window(buf);
     furi_assert(buf->capacity_bytes >= size_bytes);
 
     memcpy(buf->data, data, size_bytes);
@@ -86,6 +113,8 @@ void bit_buffer_copy_bytes(BitBuffer* buf, const uint8_t* data, size_t size_byte
 void bit_buffer_copy_bits(BitBuffer* buf, const uint8_t* data, size_t size_bits) {
     furi_assert(buf);
     furi_assert(data);
+
+    bit_buffer_restore_window(buf);
     furi_assert(buf->capacity_bytes * BITS_IN_BYTE >= size_bits);
 
     size_t size_bytes = (size_bits + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
@@ -97,6 +126,7 @@ void bit_buffer_copy_bytes_with_parity(BitBuffer* buf, const uint8_t* data, size
     furi_assert(buf);
     furi_assert(data);
 
+    bit_buffer_restore_window(buf);
     size_t bits_processed = 0;
     size_t curr_byte = 0;
 
@@ -281,6 +311,15 @@ void bit_buffer_set_size_bytes(BitBuffer* buf, size_t new_size_bytes) {
     buf->size_bits = new_size_bytes * BITS_IN_BYTE;
 }
 
+void bit_buffer_trim_left(BitBuffer* buf, size_t size_bytes) {
+    furi_assert(buf);
+    furi_assert(bit_buffer_get_size_bytes(buf) >= size_bytes);
+
+    buf->data += size_bytes;
+    buf->capacity_bytes -= size_bytes;
+    buf->size_bits -= size_bytes * BITS_IN_BYTE;
+}
+
 void bit_buffer_append(BitBuffer* buf, const BitBuffer* other) {
     bit_buffer_append_right(buf, other, 0);
 }
@@ -320,6 +320,18 @@ void bit_buffer_append_bytes(BitBuffer* buf, const uint8_t* data, size_t size_by
  */
 void bit_buffer_append_bit(BitBuffer* buf, bool bit);
 
+/**
+ * Remove a number of bytes from the beginning of a BitBuffer instance without
+ * copying any data. The number of bytes must not exceed the instance's data size.
+ * The capacity is decreased by the same amount until the next operation that replaces
+ * all of the data (e.g. reset or copy).
+ * Parity bits are not preserved.
+ *
+ * @param [in,out] buf pointer to a BitBuffer instance to be trimmed
+ * @param [in] size_bytes number of bytes to be removed
+ */
+void bit_buffer_trim_left(BitBuffer* buf, size_t size_bytes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,11 @@
 #define COMPRESS_ICON_ENCODED_BUFF_SIZE (1024u)
 #define COMPRESS_ICON_DECODED_BUFF_SIZE (1024u)
 
+/** Decoded icon cache limits, byte budget is also capped by share of free heap */
+#define COMPRESS_ICON_CACHE_ENTRIES (16u)
+#define COMPRESS_ICON_CACHE_SIZE_MAX (8192u)
+#define COMPRESS_ICON_CACHE_HEAP_SHARE (16u)
+
 typedef struct {
     uint8_t is_compressed;
     uint8_t reserved;
@@ -22,11 +27,90 @@ typedef struct {
 
 _Static_assert(sizeof(CompressHeader) == 4, "Incorrect CompressHeader size");
 
+typedef struct {
+    const uint8_t* icon_data;
+    uint32_t hash;
+    uint8_t* decoded;
+    size_t size;
+    uint32_t last_use;
+} CompressIconCacheEntry;
+
 struct CompressIcon {
     heatshrink_decoder* decoder;
     uint8_t decoded_buff[COMPRESS_ICON_DECODED_BUFF_SIZE];
+
+    CompressIconCacheEntry cache[COMPRESS_ICON_CACHE_ENTRIES];
+    size_t cache_size;
+    uint32_t use_counter;
 };
 
+/* Icons loaded from files can be freed and another one loaded at the same address,
+ * so the cache key also includes hash of compressed data. It is still far cheaper to
+ * compute than decompression. */
+static uint32_t compress_icon_hash(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static void compress_icon_cache_evict(CompressIcon* instance, CompressIconCacheEntry* entry) {
+    instance->cache_size -= entry->size;
+    free(entry->decoded);
+    memset(entry, 0, sizeof(CompressIconCacheEntry));
+}
+
+static CompressIconCacheEntry*
+    compress_icon_cache_find(CompressIcon* instance, const uint8_t* icon_data, uint32_t hash) {
+    for(size_t i = 0; i < COMPRESS_ICON_CACHE_ENTRIES; i++) {
+        CompressIconCacheEntry* entry = &instance->cache[i];
+        if(entry->decoded && entry->icon_data == icon_data && entry->hash == hash) {
+            entry->last_use = ++instance->use_counter;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void compress_icon_cache_put(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    uint32_t hash,
+    size_t size) {
+    size_t budget = MIN(
+        COMPRESS_ICON_CACHE_SIZE_MAX, memmgr_get_free_heap() / COMPRESS_ICON_CACHE_HEAP_SHARE);
+
+    // Drop least recently used entries until there is a free slot and enough budget
+    while(true) {
+        CompressIconCacheEntry* free_entry = NULL;
+        CompressIconCacheEntry* lru = NULL;
+        for(size_t i = 0; i < COMPRESS_ICON_CACHE_ENTRIES; i++) {
+            CompressIconCacheEntry* entry = &instance->cache[i];
+            if(!entry->decoded) {
+                free_entry = entry;
+            } else if(!lru || entry->last_use < lru->last_use) {
+                lru = entry;
+            }
+        }
+
+        if(free_entry && instance->cache_size + size <= budget) {
+            free_entry->icon_data = icon_data;
+            free_entry->hash = hash;
+            free_entry->decoded = malloc(size);
+            memcpy(free_entry->decoded, instance->decoded_buff, size);
+            free_entry->size = size;
+            free_entry->last_use = ++instance->use_counter;
+            instance->cache_size += size;
+            break;
+        }
+
+        if(!lru) break;
+        compress_icon_cache_evict(instance, lru);
+    }
+}
+
 CompressIcon* compress_icon_alloc() {
     CompressIcon* instance = malloc(sizeof(CompressIcon));
     instance->decoder = heatshrink_decoder_alloc(
@@ -41,6 +125,9 @@ CompressIcon* compress_icon_alloc() {
 
 void compress_icon_free(CompressIcon* instance) {
     furi_assert(instance);
+    for(size_t i = 0; i < COMPRESS_ICON_CACHE_ENTRIES; i++) {
+        if(instance->cache[i].decoded) compress_icon_cache_evict(instance, &instance->cache[i]);
+    }
     heatshrink_decoder_free(instance->decoder);
     free(instance);
 }
@@ -52,7 +139,16 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
 
     CompressHeader* header = (CompressHeader*)icon_data;
     if(header->is_compressed) {
+        const uint8_t* compressed = &icon_data[sizeof(CompressHeader)];
+        uint32_t hash = compress_icon_hash(compressed, header->compressed_buff_size);
+        CompressIconCacheEntry* entry = compress_icon_cache_find(instance, icon_data, hash);
+        if(entry) {
+            *decoded_buff = entry->decoded;
+            return;
+        }
+
         size_t data_processed = 0;
+        size_t decoded_size = 0;
         heatshrink_decoder_sink(
             instance->decoder,
             (uint8_t*)&icon_data[sizeof(CompressHeader)],
@@ -65,12 +161,18 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
                 sizeof(instance->decoded_buff),
                 &data_processed);
             furi_assert((res == HSDR_POLL_EMPTY) || (res == HSDR_POLL_MORE));
+            // Last poll of a full buffer gives nothing
+            if(data_processed) decoded_size = data_processed;
             if(res != HSDR_POLL_MORE) {
                 break;
             }
         }
         heatshrink_decoder_reset(instance->decoder);
         *decoded_buff = instance->decoded_buff;
+
+        if(decoded_size) {
+            compress_icon_cache_put(instance, icon_data, hash, decoded_size);
+        }
     } else {
         *decoded_buff = (uint8_t*)&icon_data[1];
     }
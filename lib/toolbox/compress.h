@@ -28,6 +28,9 @@ CompressIcon* compress_icon_alloc();
 void compress_icon_free(CompressIcon* instance);
 
 /** Decompress icon
+ *
+ * Recently decoded icons are kept in a small LRU cache, so drawing the same
+ * frame again does not decompress it.
  *
  * @warning    decoded_buff pointer set by this function is valid till next
  *             `compress_icon_decode` or `compress_icon_free` call
@@ -0,0 +1,181 @@
+#include "file_view.h"
+
+/* Pages start on sector boundary when the region fits, to keep reads aligned */
+#define FILE_VIEW_PAGE_ALIGN 512U
+
+typedef struct {
+    uint8_t* data;
+    uint64_t offset;
+    size_t size;
+    uint32_t pins;
+    uint32_t last_use;
+} FileViewPage;
+
+struct FileView {
+    File* file;
+    uint64_t file_size;
+    uint8_t* buffer;
+    FileViewPage* pages;
+    size_t page_size;
+    size_t page_count;
+    uint32_t use_counter;
+};
+
+FileView* file_view_alloc(Storage* storage, size_t page_size, size_t page_count) {
+    furi_check(page_size);
+    furi_check(page_count);
+
+    FileView* view = malloc(sizeof(FileView));
+    view->file = storage_file_alloc(storage);
+    view->buffer = malloc(page_size * page_count);
+    view->pages = malloc(sizeof(FileViewPage) * page_count);
+    view->page_size = page_size;
+    view->page_count = page_count;
+
+    for(size_t i = 0; i < page_count; i++) {
+        view->pages[i].data = view->buffer + i * page_size;
+    }
+
+    return view;
+}
+
+void file_view_free(FileView* view) {
+    file_view_close(view);
+    storage_file_free(view->file);
+    free(view->pages);
+    free(view->buffer);
+    free(view);
+}
+
+bool file_view_open(FileView* view, const char* path) {
+    file_view_close(view);
+
+    bool result = storage_file_open(view->file, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(result) {
+        view->file_size = storage_file_size(view->file);
+    }
+
+    return result;
+}
+
+void file_view_close(FileView* view) {
+    for(size_t i = 0; i < view->page_count; i++) {
+        furi_assert(view->pages[i].pins == 0);
+        view->pages[i].size = 0;
+        view->pages[i].pins = 0;
+    }
+
+    view->file_size = 0;
+    if(storage_file_is_open(view->file)) {
+        storage_file_close(view->file);
+    }
+}
+
+uint64_t file_view_size(FileView* view) {
+    return view->file_size;
+}
+
+FS_Error file_view_get_error(FileView* view) {
+    return storage_file_get_error(view->file);
+}
+
+static FileViewPage* file_view_page_find(FileView* view, uint64_t offset, size_t size) {
+    for(size_t i = 0; i < view->page_count; i++) {
+        FileViewPage* page = &view->pages[i];
+        if(page->size && offset >= page->offset && offset + size <= page->offset + page->size) {
+            return page;
+        }
+    }
+
+    return NULL;
+}
+
+static FileViewPage* file_view_page_load(FileView* view, uint64_t offset, size_t size) {
+    FileViewPage* page = NULL;
+
+    // Reuse least recently used page without pins
+    for(size_t i = 0; i < view->page_count; i++) {
+        FileViewPage* candidate = &view->pages[i];
+        if(candidate->pins) continue;
+        if(!page || !candidate->size || candidate->last_use < page->last_use) {
+            page = candidate;
+            if(!page->size) break;
+        }
+    }
+
+    if(page) {
+        uint64_t page_offset = offset - offset % FILE_VIEW_PAGE_ALIGN;
+        if(offset - page_offset + size > view->page_size) {
+            page_offset = offset;
+        }
+        size_t page_size = MIN(view->page_size, view->file_size - page_offset);
+
+        page->size = 0;
+        if(!storage_file_seek(view->file, page_offset, true) ||
+           storage_file_read(view->file, page->data, page_size) != page_size) {
+            return NULL;
+        }
+
+        page->offset = page_offset;
+        page->size = page_size;
+    }
+
+    return page;
+}
+
+const void* file_view_pin(FileView* view, uint64_t offset, size_t size) {
+    if(!size || size > view->page_size || offset > view->file_size ||
+       size > view->file_size - offset) {
+        return NULL;
+    }
+
+    FileViewPage* page = file_view_page_find(view, offset, size);
+    if(!page) {
+        page = file_view_page_load(view, offset, size);
+        if(!page) return NULL;
+    }
+
+    page->pins++;
+    page->last_use = ++view->use_counter;
+    return page->data + (offset - page->offset);
+}
+
+void file_view_unpin(FileView* view, const void* data) {
+    const uint8_t* pointer = data;
+
+    for(size_t i = 0; i < view->page_count; i++) {
+        FileViewPage* page = &view->pages[i];
+        if(page->pins && pointer >= page->data && pointer < page->data + page->size) {
+            page->pins--;
+            return;
+        }
+    }
+
+    furi_crash("FileView: region is not pinned");
+}
+
+size_t file_view_read(FileView* view, uint64_t offset, void* buff, size_t size) {
+    uint8_t* out = buff;
+    size_t was_read = 0;
+
+    if(offset > view->file_size) return 0;
+    size = MIN(size, view->file_size - offset);
+
+    while(was_read < size) {
+        // Split on page boundaries so that sequential reads reuse aligned pages
+        uint64_t position = offset + was_read;
+        size_t chunk_size = view->page_size;
+        if(chunk_size >= FILE_VIEW_PAGE_ALIGN) {
+            chunk_size -= position % FILE_VIEW_PAGE_ALIGN;
+        }
+        chunk_size = MIN(size - was_read, chunk_size);
+        const uint8_t* data = file_view_pin(view, position, chunk_size);
+        if(!data) break;
+
+        memcpy(out + was_read, data, chunk_size);
+        file_view_unpin(view, data);
+        was_read += chunk_size;
+    }
+
+    return was_read;
+}
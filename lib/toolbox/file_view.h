@@ -0,0 +1,98 @@
+/**
+ * @file file_view.h
+ * Read-only file view
+ *
+ * Gives indexed access to file data without reading the whole file to heap.
+ * Data is paged in on demand through a small cache of pages, and regions of
+ * up to one page can be pinned to get a pointer right into the cache. Page
+ * with pinned regions stays in place until all of them are unpinned, other
+ * pages are reused least recently used first.
+ *
+ * View is not thread safe, use it from one thread or guard it externally.
+ */
+#pragma once
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FileView FileView;
+
+/**
+ * Allocate FileView
+ * @param storage Storage instance
+ * @param page_size size of a cache page, also the largest region to pin
+ * @param page_count number of cache pages, also the most pages to pin at once
+ * @return FileView*
+ */
+FileView* file_view_alloc(Storage* storage, size_t page_size, size_t page_count);
+
+/**
+ * Free FileView, closes the file if it is open
+ * @param view
+ */
+void file_view_free(FileView* view);
+
+/**
+ * Open file for viewing
+ * @param view
+ * @param path
+ * @return true on success
+ */
+bool file_view_open(FileView* view, const char* path);
+
+/**
+ * Close file and drop cached pages, pinned pointers become invalid
+ * @param view
+ */
+void file_view_close(FileView* view);
+
+/**
+ * Get size of viewed file
+ * @param view
+ * @return uint64_t
+ */
+uint64_t file_view_size(FileView* view);
+
+/**
+ * Get error of the last operation on the file
+ * @param view
+ * @return FS_Error
+ */
+FS_Error file_view_get_error(FileView* view);
+
+/**
+ * Pin file region and get pointer to its data
+ *
+ * Pointer stays valid until the region is unpinned with file_view_unpin().
+ * The same region can be pinned several times, each pin has to be unpinned.
+ *
+ * @param view
+ * @param offset region offset in file
+ * @param size region size, no larger than page size
+ * @return const void* region data or NULL if region is out of file, too large,
+ * can't be read or all pages are pinned
+ */
+const void* file_view_pin(FileView* view, uint64_t offset, size_t size);
+
+/**
+ * Unpin region pinned with file_view_pin()
+ * @param view
+ * @param data pointer returned by file_view_pin()
+ */
+void file_view_unpin(FileView* view, const void* data);
+
+/**
+ * Copy file data through the page cache
+ * @param view
+ * @param offset data offset in file
+ * @param buff buffer to copy to
+ * @param size data size
+ * @return size_t number of bytes copied, less than size at the end of file or on error
+ */
+size_t file_view_read(FileView* view, uint64_t offset, void* buff, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
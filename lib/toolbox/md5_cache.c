@@ -0,0 +1,204 @@
+#include "md5_cache.h"
+#include "md5_calc.h"
+
+#define TAG "Md5Cache"
+
+#define MD5_CACHE_PATH CFG_PATH(".md5.cache")
+#define MD5_CACHE_MAGIC 0x35444D52
+#define MD5_CACHE_VERSION 1
+
+/** Open addressing hash table, file is preallocated so lookup is one seek and read */
+#define MD5_CACHE_SLOTS 4096
+#define MD5_CACHE_PROBES 8
+#define MD5_CACHE_BUFFER_SIZE 512
+
+/** Smaller files are read as fast as cache lookup */
+#define MD5_CACHE_MIN_FILE_SIZE 4096
+
+#define MD5_CACHE_HASH_SIZE 16
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slots;
+} Md5CacheHeader;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t check;
+    uint32_t timestamp;
+    uint32_t size;
+} Md5CacheKey;
+
+typedef struct {
+    Md5CacheKey key;
+    uint8_t used;
+    uint8_t md5[MD5_CACHE_HASH_SIZE];
+} Md5CacheRecord;
+
+#pragma pack(pop)
+
+#define MD5_CACHE_FILE_SIZE (sizeof(Md5CacheHeader) + MD5_CACHE_SLOTS * sizeof(Md5CacheRecord))
+
+struct Md5Cache {
+    Storage* storage;
+    File* file;
+    bool valid;
+};
+
+static const Md5CacheHeader md5_cache_header = {
+    .magic = MD5_CACHE_MAGIC,
+    .version = MD5_CACHE_VERSION,
+    .slots = MD5_CACHE_SLOTS,
+};
+
+static uint32_t md5_cache_hash(const char* str, uint32_t hash) {
+    // FNV-1a
+    while(*str) {
+        hash = (hash ^ (uint8_t)*str++) * 16777619UL;
+    }
+    return hash;
+}
+
+static size_t md5_cache_slot_offset(uint32_t slot) {
+    return sizeof(Md5CacheHeader) + (slot % MD5_CACHE_SLOTS) * sizeof(Md5CacheRecord);
+}
+
+static bool md5_cache_header_check(File* file) {
+    Md5CacheHeader header;
+    if(!storage_file_seek(file, 0, true)) return false;
+    if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) return false;
+    return memcmp(&header, &md5_cache_header, sizeof(header)) == 0 &&
+           storage_file_size(file) == MD5_CACHE_FILE_SIZE;
+}
+
+static bool md5_cache_create(File* file) {
+    bool success = false;
+    uint8_t* zeroes = malloc(MD5_CACHE_BUFFER_SIZE);
+
+    do {
+        if(!storage_file_seek(file, 0, true)) break;
+        if(!storage_file_truncate(file)) break;
+        if(storage_file_write(file, &md5_cache_header, sizeof(md5_cache_header)) !=
+           sizeof(md5_cache_header))
+            break;
+
+        // All slots start empty
+        size_t left = MD5_CACHE_FILE_SIZE - sizeof(Md5CacheHeader);
+        while(left) {
+            size_t to_write = MIN(left, (size_t)MD5_CACHE_BUFFER_SIZE);
+            if(storage_file_write(file, zeroes, to_write) != to_write) break;
+            left -= to_write;
+        }
+        success = left == 0;
+    } while(false);
+
+    free(zeroes);
+    if(!success) FURI_LOG_E(TAG, "Failed to create cache");
+    return success;
+}
+
+static bool md5_cache_read_slot(Md5Cache* cache, uint32_t slot, Md5CacheRecord* record) {
+    return storage_file_seek(cache->file, md5_cache_slot_offset(slot), true) &&
+           storage_file_read(cache->file, record, sizeof(*record)) == sizeof(*record);
+}
+
+static bool md5_cache_key(Md5Cache* cache, const char* path, Md5CacheKey* key) {
+    FileInfo file_info;
+    if(storage_common_stat(cache->storage, path, &file_info) != FSE_OK) return false;
+    if(file_info_is_dir(&file_info) || file_info.size < MD5_CACHE_MIN_FILE_SIZE)
+        return false;
+    if(storage_common_timestamp(cache->storage, path, &key->timestamp) != FSE_OK) return false;
+
+    key->hash = md5_cache_hash(path, 2166136261UL);
+    // Second hash with different seed, lowers the chance of mixing up two paths
+    key->check = md5_cache_hash(path, key->hash ^ strlen(path));
+    key->size = file_info.size;
+    return true;
+}
+
+// Finds slot of the same file or first free one, home slot is evicted when all are taken
+static bool md5_cache_find(
+    Md5Cache* cache,
+    const Md5CacheKey* key,
+    Md5CacheRecord* record,
+    uint32_t* slot) {
+    *slot = key->hash;
+    for(uint32_t i = 0; i < MD5_CACHE_PROBES; i++) {
+        if(!md5_cache_read_slot(cache, key->hash + i, record)) break;
+        if(!record->used) {
+            *slot = key->hash + i;
+            break;
+        }
+        if(record->key.hash != key->hash || record->key.check != key->check) continue;
+
+        *slot = key->hash + i;
+        // Same file, but it was changed since
+        return memcmp(&record->key, key, sizeof(*key)) == 0;
+    }
+    return false;
+}
+
+Md5Cache* md5_cache_open(Storage* storage) {
+    furi_assert(storage);
+
+    Md5Cache* cache = malloc(sizeof(Md5Cache));
+    cache->storage = storage;
+    cache->file = storage_file_alloc(storage);
+
+    // Cache may be in use by another thread, work without it then
+    if(storage_file_open(cache->file, MD5_CACHE_PATH, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS)) {
+        cache->valid = md5_cache_header_check(cache->file) || md5_cache_create(cache->file);
+    }
+
+    return cache;
+}
+
+void md5_cache_close(Md5Cache* cache) {
+    furi_assert(cache);
+
+    storage_file_free(cache->file);
+    free(cache);
+}
+
+bool md5_cache_calc(
+    Md5Cache* cache,
+    File* file,
+    const char* path,
+    FuriString* output,
+    FS_Error* file_error) {
+    furi_assert(cache);
+    furi_assert(file);
+    furi_assert(path);
+    furi_assert(output);
+
+    Md5CacheKey key;
+    Md5CacheRecord record;
+    uint32_t slot = 0;
+    bool cacheable = cache->valid && md5_cache_key(cache, path, &key);
+    bool found = cacheable && md5_cache_find(cache, &key, &record, &slot);
+
+    if(!found) {
+        if(!md5_calc_file(file, path, record.md5, file_error)) return false;
+
+        if(cacheable) {
+            record.key = key;
+            record.used = 1;
+            if(!storage_file_seek(cache->file, md5_cache_slot_offset(slot), true) ||
+               storage_file_write(cache->file, &record, sizeof(record)) != sizeof(record)) {
+                FURI_LOG_E(TAG, "Failed to store entry");
+            }
+        }
+    } else if(file_error) {
+        *file_error = FSE_OK;
+    }
+
+    furi_string_reset(output);
+    for(size_t i = 0; i < MD5_CACHE_HASH_SIZE; i++) {
+        furi_string_cat_printf(output, "%02x", record.md5[i]);
+    }
+
+    return true;
+}
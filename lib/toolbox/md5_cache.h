@@ -0,0 +1,53 @@
+/**
+ * @file md5_cache.h
+ * Cache of file md5 sums
+ *
+ * Sync tools ask for md5 of every file on each run, while most files don't
+ * change in between. Sums of larger files are kept on SD card and validated
+ * with file size and modification time. Cache is opened once per operation, so
+ * directory listings don't reopen it for every entry.
+ */
+#pragma once
+
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Md5Cache Md5Cache;
+
+/** Open md5 cache
+ *
+ * @param      storage  Storage instance
+ *
+ * @return     Md5Cache instance, works without caching if cache file can't be used
+ */
+Md5Cache* md5_cache_open(Storage* storage);
+
+/** Close md5 cache
+ *
+ * @param      cache    Md5Cache instance
+ */
+void md5_cache_close(Md5Cache* cache);
+
+/** Get md5 sum of file, calculated sum is stored in cache
+ *
+ * @param      cache       Md5Cache instance
+ * @param      file        File instance used for calculation
+ * @param      path        file path
+ * @param[out] output      md5 sum as hex string
+ * @param[out] file_error  file error on failure, can be NULL
+ *
+ * @return     true on success
+ */
+bool md5_cache_calc(
+    Md5Cache* cache,
+    File* file,
+    const char* path,
+    FuriString* output,
+    FS_Error* file_error);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,87 +1,291 @@
 #include "profiler.h"
 #include <stdlib.h>
-#include <m-dict.h>
 #include <furi.h>
+#include <furi_hal_cortex.h>
 #include <furi_hal_gpio.h>
 
+#define PROFILER_CALIBRATION_ROUNDS 8
+
 typedef struct {
+    const char* key;
     uint32_t start;
-    uint32_t length;
+    uint32_t nested; // Cycles spent in nested regions of current run
     uint32_t count;
+    uint64_t total;
+    uint64_t self;
+    uint32_t min;
+    uint32_t max;
+    uint32_t histogram[PROFILER_HISTOGRAM_BINS];
 } ProfilerRecord;
 
-DICT_DEF2(ProfilerRecordDict, const char*, M_CSTR_OPLIST, ProfilerRecord, M_POD_OPLIST)
-#define M_OPL_ProfilerRecord_t() DICT_OPLIST(ProfilerRecord, M_CSTR_OPLIST, M_POD_OPLIST)
-
 struct Profiler {
-    ProfilerRecordDict_t records;
+    const char* name;
+    Profiler* next;
+
+    uint32_t overhead; // Cycles of empty start/stop pair, taken out of every region
+    size_t depth;
+    ProfilerSlot stack[PROFILER_NESTING_MAX];
+
+    size_t slots;
+    size_t used;
+    ProfilerRecord* records;
 };
 
-Profiler* profiler_alloc() {
+static Profiler* profiler_list = NULL;
+static FuriMutex* profiler_list_mutex = NULL;
+
+static void profiler_list_lock(void) {
+    FuriMutex* mutex = __atomic_load_n(&profiler_list_mutex, __ATOMIC_ACQUIRE);
+    if(!mutex) {
+        FuriMutex* new_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        if(__atomic_compare_exchange_n(
+               &profiler_list_mutex,
+               &mutex,
+               new_mutex,
+               false,
+               __ATOMIC_ACQ_REL,
+               __ATOMIC_ACQUIRE)) {
+            mutex = new_mutex;
+        } else {
+            furi_mutex_free(new_mutex);
+        }
+    }
+    furi_check(furi_mutex_acquire(mutex, FuriWaitForever) == FuriStatusOk);
+}
+
+static void profiler_list_unlock(void) {
+    furi_check(furi_mutex_release(profiler_list_mutex) == FuriStatusOk);
+}
+
+static void profiler_record_reset(ProfilerRecord* record) {
+    const char* key = record->key;
+    memset(record, 0, sizeof(ProfilerRecord));
+    record->key = key;
+    record->min = UINT32_MAX;
+}
+
+static inline size_t profiler_histogram_bin(uint32_t cycles) {
+    size_t bin = cycles ? (31 - __builtin_clz(cycles)) / 2 : 0;
+    return MIN(bin, (size_t)(PROFILER_HISTOGRAM_BINS - 1));
+}
+
+static void profiler_record_add(ProfilerRecord* record, uint32_t length, uint32_t self) {
+    record->count++;
+    record->total += length;
+    record->self += self;
+    if(length < record->min) record->min = length;
+    if(length > record->max) record->max = length;
+    record->histogram[profiler_histogram_bin(length)]++;
+}
+
+static void profiler_calibrate(Profiler* profiler) {
+    // Empty region on temporary slot 0, minimum is used as interrupts may hit
+    profiler->used = 1;
+    profiler_record_reset(&profiler->records[0]);
+    for(size_t i = 0; i < PROFILER_CALIBRATION_ROUNDS; i++) {
+        profiler_start(profiler, 0);
+        profiler_stop(profiler, 0);
+    }
+    profiler->overhead = profiler->records[0].min;
+    profiler->used = 0;
+}
+
+Profiler* profiler_alloc(const char* name, size_t slots) {
+    furi_assert(name);
+    furi_assert(slots);
+
     Profiler* profiler = malloc(sizeof(Profiler));
-    ProfilerRecordDict_init(profiler->records);
+    profiler->name = name;
+    profiler->slots = slots;
+    profiler->records = malloc(sizeof(ProfilerRecord) * slots);
+    profiler_calibrate(profiler);
+
+    profiler_list_lock();
+    profiler->next = profiler_list;
+    profiler_list = profiler;
+    profiler_list_unlock();
+
     return profiler;
 }
 
 void profiler_free(Profiler* profiler) {
-    ProfilerRecordDict_clear(profiler->records);
+    furi_assert(profiler);
+
+    profiler_list_lock();
+    for(Profiler** it = &profiler_list; *it; it = &(*it)->next) {
+        if(*it == profiler) {
+            *it = profiler->next;
+            break;
+        }
+    }
+    profiler_list_unlock();
+
+    free(profiler->records);
     free(profiler);
 }
 
-void profiler_prealloc(Profiler* profiler, const char* key) {
-    ProfilerRecord record = {
-        .start = 0,
-        .length = 0,
-        .count = 0,
-    };
+ProfilerSlot profiler_register(Profiler* profiler, const char* key) {
+    furi_assert(profiler);
+    furi_assert(key);
 
-    ProfilerRecordDict_set_at(profiler->records, key, record);
+    for(size_t i = 0; i < profiler->used; i++) {
+        if(!strcmp(profiler->records[i].key, key)) return i;
+    }
+
+    furi_check(profiler->used < profiler->slots);
+    ProfilerRecord* record = &profiler->records[profiler->used];
+    record->key = key;
+    profiler_record_reset(record);
+    return profiler->used++;
 }
 
-void profiler_start(Profiler* profiler, const char* key) {
-    ProfilerRecord* record = ProfilerRecordDict_get(profiler->records, key);
-    if(record == NULL) {
-        profiler_prealloc(profiler, key);
-        record = ProfilerRecordDict_get(profiler->records, key);
-    }
+void profiler_start(Profiler* profiler, ProfilerSlot slot) {
+    furi_assert(profiler);
+    furi_assert(slot < profiler->used);
+    furi_check(profiler->depth < PROFILER_NESTING_MAX);
 
-    furi_check(record->start == 0);
+    ProfilerRecord* record = &profiler->records[slot];
+    profiler->stack[profiler->depth++] = slot;
+    record->nested = 0;
     record->start = DWT->CYCCNT;
 }
 
-void profiler_stop(Profiler* profiler, const char* key) {
-    ProfilerRecord* record = ProfilerRecordDict_get(profiler->records, key);
-    furi_check(record != NULL);
+void profiler_stop(Profiler* profiler, ProfilerSlot slot) {
+    uint32_t now = DWT->CYCCNT;
+    furi_assert(profiler);
+    furi_check(profiler->depth && profiler->stack[profiler->depth - 1] == slot);
 
-    record->length += DWT->CYCCNT - record->start;
-    record->start = 0;
-    record->count++;
+    profiler->depth--;
+    ProfilerRecord* record = &profiler->records[slot];
+    uint32_t elapsed = now - record->start;
+    uint32_t length = (elapsed > profiler->overhead) ? elapsed - profiler->overhead : 0;
+    uint32_t self = (length > record->nested) ? length - record->nested : 0;
+
+    profiler_record_add(record, length, self);
+
+    if(profiler->depth) {
+        // Whole nested region including its instrumentation is not parent's own time
+        profiler->records[profiler->stack[profiler->depth - 1]].nested += DWT->CYCCNT -
+                                                                           record->start;
+    }
+}
+
+void profiler_add_sample(Profiler* profiler, ProfilerSlot slot, uint32_t cycles) {
+    furi_assert(profiler);
+    furi_assert(slot < profiler->used);
+
+    profiler_record_add(&profiler->records[slot], cycles, cycles);
+}
+
+void profiler_reset(Profiler* profiler) {
+    furi_assert(profiler);
+
+    for(size_t i = 0; i < profiler->used; i++) {
+        profiler_record_reset(&profiler->records[i]);
+    }
 }
 
 void profiler_dump(Profiler* profiler) {
-    printf("Profiler:\r\n");
+    furi_assert(profiler);
 
-    ProfilerRecordDict_it_t it;
-    for(ProfilerRecordDict_it(it, profiler->records); !ProfilerRecordDict_end_p(it);
-        ProfilerRecordDict_next(it)) {
-        const ProfilerRecordDict_itref_t* itref = ProfilerRecordDict_cref(it);
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    printf("Profiler %s, overhead %lu clk:\r\n", profiler->name, profiler->overhead);
 
-        uint32_t count = itref->value.count;
+    for(size_t i = 0; i < profiler->used; i++) {
+        const ProfilerRecord* record = &profiler->records[i];
+        printf("\t%s[%lu]", record->key, record->count);
+        if(!record->count) {
+            printf("\r\n");
+            continue;
+        }
+
+        printf(
+            ": total %lu us, self %lu us, avg %lu clk, min %lu clk, max %lu clk\r\n",
+            (uint32_t)(record->total / cycles_per_us),
+            (uint32_t)(record->self / cycles_per_us),
+            (uint32_t)(record->total / record->count),
+            record->min,
+            record->max);
+
+        printf("\t\tclk");
+        for(size_t bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++) {
+            if(!record->histogram[bin]) continue;
+            if(bin < PROFILER_HISTOGRAM_BINS - 1) {
+                printf(" <%lu:%lu", 1UL << (2 * (bin + 1)), record->histogram[bin]);
+            } else {
+                printf(" >=%lu:%lu", 1UL << (2 * bin), record->histogram[bin]);
+            }
+        }
+        printf("\r\n");
+    }
+}
+
+void profiler_dump_all(void) {
+    profiler_list_lock();
+    for(Profiler* profiler = profiler_list; profiler; profiler = profiler->next) {
+        profiler_dump(profiler);
+    }
+    profiler_list_unlock();
+}
 
-        uint32_t clocks = itref->value.length;
-        double us = (double)clocks / (double)64.0;
-        double ms = (double)clocks / (double)64000.0;
-        double s = (double)clocks / (double)64000000.0;
+void profiler_reset_all(void) {
+    profiler_list_lock();
+    for(Profiler* profiler = profiler_list; profiler; profiler = profiler->next) {
+        profiler_reset(profiler);
+    }
+    profiler_list_unlock();
+}
 
-        printf("\t%s[%lu]: %f s, %f ms, %f us, %lu clk\r\n", itref->key, count, s, ms, us, clocks);
+void profiler_info_get(PropertyValueCallback out, char sep, void* context) {
+    FuriString* value = furi_string_alloc();
+    FuriString* key = furi_string_alloc();
+    char name[8];
 
-        if(count > 1) {
-            us /= (double)count;
-            ms /= (double)count;
-            s /= (double)count;
-            clocks /= count;
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = sep, .last = false, .context = context};
 
-            printf("\t%s[1]: %f s, %f ms, %f us, %lu clk\r\n", itref->key, s, ms, us, clocks);
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    size_t count = 0;
+
+    profiler_list_lock();
+    for(Profiler* profiler = profiler_list; profiler; profiler = profiler->next) {
+        for(size_t i = 0; i < profiler->used; i++) {
+            const ProfilerRecord* record = &profiler->records[i];
+            const char* p = profiler->name;
+            const char* k = record->key;
+            property_value_out(&property_context, "%lu", 3, p, k, "count", record->count);
+            property_value_out(
+                &property_context,
+                "%lu",
+                3,
+                p,
+                k,
+                "total_us",
+                (uint32_t)(record->total / cycles_per_us));
+            property_value_out(
+                &property_context,
+                "%lu",
+                3,
+                p,
+                k,
+                "self_us",
+                (uint32_t)(record->self / cycles_per_us));
+            property_value_out(
+                &property_context, "%lu", 3, p, k, "min", record->count ? record->min : 0);
+            property_value_out(&property_context, "%lu", 3, p, k, "max", record->max);
+            for(size_t bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++) {
+                snprintf(name, sizeof(name), "%zu", bin);
+                property_value_out(
+                    &property_context, "%lu", 4, p, k, "hist", name, record->histogram[bin]);
+            }
         }
+        count++;
     }
+    profiler_list_unlock();
+
+    property_context.last = true;
+    property_value_out(&property_context, "%zu", 1, "count", count);
+
+    furi_string_free(key);
+    furi_string_free(value);
 }
@@ -1,23 +1,94 @@
+/**
+ * @file profiler.h
+ * Cycle accurate region profiler
+ *
+ * Keys are registered once to slot ids, so start and stop are an array access
+ * and a cycle counter read, cheap enough for decoders and interrupt handlers.
+ * Regions may be nested, time spent in nested regions is reported separately
+ * as self time of the outer one. All profilers are listed by `profiler` CLI
+ * command and exported as `profiler` RPC property.
+ *
+ * Profiler instance must be used from one execution context at a time: one
+ * thread, or interrupts that don't preempt each other. Slot that is only fed by
+ * profiler_add_sample may have its own context.
+ */
 #pragma once
 
+#include <stdint.h>
+#include <stddef.h>
+#include <toolbox/property.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Max depth of nested regions */
+#define PROFILER_NESTING_MAX 8
+/** Histogram bins, bin N counts regions of [4^N, 4^(N+1)) cycles */
+#define PROFILER_HISTOGRAM_BINS 16
+
 typedef struct Profiler Profiler;
 
-Profiler* profiler_alloc();
+typedef uint32_t ProfilerSlot;
+
+/** Allocate profiler and add it to global list
+ *
+ * @param      name   profiler name, must stay valid while profiler exists
+ * @param      slots  max number of keys
+ *
+ * @return     Profiler instance
+ */
+Profiler* profiler_alloc(const char* name, size_t slots);
 
+/** Remove profiler from global list and free it */
 void profiler_free(Profiler* profiler);
 
-void profiler_prealloc(Profiler* profiler, const char* key);
+/** Register key, do it once outside of measured code
+ *
+ * @param      profiler  Profiler instance
+ * @param      key       region name, must stay valid while profiler exists
+ *
+ * @return     slot to use with profiler_start and profiler_stop
+ */
+ProfilerSlot profiler_register(Profiler* profiler, const char* key);
+
+/** Start measured region */
+void profiler_start(Profiler* profiler, ProfilerSlot slot);
+
+/** Stop measured region, must be the last one started */
+void profiler_stop(Profiler* profiler, ProfilerSlot slot);
 
-void profiler_start(Profiler* profiler, const char* key);
+/** Add externally measured length, for spans that start and end in different contexts
+ *
+ * @param      profiler  Profiler instance
+ * @param      slot      slot to add sample to
+ * @param      cycles    measured length in cycles
+ */
+void profiler_add_sample(Profiler* profiler, ProfilerSlot slot, uint32_t cycles);
 
-void profiler_stop(Profiler* profiler, const char* key);
+/** Clear collected statistics, keys stay registered */
+void profiler_reset(Profiler* profiler);
 
+/** Print statistics to stdout */
 void profiler_dump(Profiler* profiler);
 
+/** Print statistics of all profilers to stdout */
+void profiler_dump_all(void);
+
+/** Clear statistics of all profilers */
+void profiler_reset_all(void);
+
+/** Output statistics of all profilers as key-value pairs
+ *
+ * Keys are `<profiler>.<key>.<field>`, fields are count, total, self, min,
+ * max and hist.N in cycles.
+ *
+ * @param      out      output callback
+ * @param      sep      key parts separator
+ * @param      context  callback context
+ */
+void profiler_info_get(PropertyValueCallback out, char sep, void* context);
+
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -11,6 +11,7 @@ typedef uint8_t* (*ProtocolGetData)(void* protocol);
 
 typedef void (*ProtocolDecoderStart)(void* protocol);
 typedef bool (*ProtocolDecoderFeed)(void* protocol, bool level, uint32_t duration);
+typedef bool (*ProtocolDecoderIsSynced)(void* protocol);
 
 typedef bool (*ProtocolEncoderStart)(void* protocol);
 typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
@@ -21,6 +22,11 @@ typedef bool (*ProtocolWriteData)(void* protocol, void* data);
 typedef struct {
     ProtocolDecoderStart start;
     ProtocolDecoderFeed feed;
+    // Optional, true while decoder tracks a repeating frame stream. Once decoder
+    // has produced a frame and is still synced, dict feeds only this decoder
+    ProtocolDecoderIsSynced is_synced;
+    // Optional, pulses shorter than this can't be part of a frame, 0 to disable
+    uint32_t duration_min;
 } ProtocolDecoder;
 
 typedef struct {
@@ -1,10 +1,19 @@
 #include <furi.h>
 #include "protocol_dict.h"
 
+// Feature mask that matches every protocol, regardless of its features
+#define PROTOCOL_DICT_FEATURE_ANY UINT32_MAX
+
+// Short pulses delivered to a decoder before prefilter starts skipping them
+#define PROTOCOL_DICT_PREFILTER_IDLE_COUNT 2
+
 struct ProtocolDict {
     const ProtocolBase** base;
     size_t count;
     void** data;
+    uint8_t* short_count;
+    // Decoder locked on the frame stream, PROTOCOL_NO if none
+    ProtocolId synced;
 };
 
 ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count) {
@@ -12,6 +21,8 @@ ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count)
     dict->base = protocols;
     dict->count = count;
     dict->data = malloc(sizeof(void*) * dict->count);
+    dict->short_count = malloc(sizeof(uint8_t) * dict->count);
+    dict->synced = PROTOCOL_NO;
 
     for(size_t i = 0; i < dict->count; i++) {
         dict->data[i] = dict->base[i]->alloc();
@@ -25,6 +36,7 @@ void protocol_dict_free(ProtocolDict* dict) {
         dict->base[i]->free(dict->data[i]);
     }
 
+    free(dict->short_count);
     free(dict->data);
     free(dict);
 }
@@ -89,7 +101,9 @@ void protocol_dict_decoders_start(ProtocolDict* dict) {
         if(fn) {
             fn(dict->data[i]);
         }
+        dict->short_count[i] = PROTOCOL_DICT_PREFILTER_IDLE_COUNT;
     }
+    dict->synced = PROTOCOL_NO;
 }
 
 uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
@@ -97,46 +111,72 @@ uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
     return dict->base[protocol_index]->features;
 }
 
-ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration) {
-    bool done = false;
-    ProtocolId ready_protocol_id = PROTOCOL_NO;
+static bool protocol_dict_decoder_feed(
+    ProtocolDict* dict,
+    size_t protocol_index,
+    bool level,
+    uint32_t duration) {
+    const ProtocolDecoder* decoder = &dict->base[protocol_index]->decoder;
+    if(!decoder->feed) return false;
+
+    if(duration < decoder->duration_min) {
+        // Pulse is shorter than anything this protocol can produce:
+        // deliver it only while decoder may be mid-frame, so it can reset itself
+        if(dict->short_count[protocol_index] >= PROTOCOL_DICT_PREFILTER_IDLE_COUNT) return false;
+        dict->short_count[protocol_index]++;
+    } else {
+        dict->short_count[protocol_index] = 0;
+    }
 
-    for(size_t i = 0; i < dict->count; i++) {
-        ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
+    return decoder->feed(dict->data[protocol_index], level, duration);
+}
 
-        if(fn) {
-            if(fn(dict->data[i], level, duration)) {
-                if(!done) {
-                    ready_protocol_id = i;
-                    done = true;
-                }
-            }
-        }
-    }
+static bool
+    protocol_dict_decoder_matches(ProtocolDict* dict, size_t protocol_index, uint32_t feature) {
+    return (feature == PROTOCOL_DICT_FEATURE_ANY) ||
+           (dict->base[protocol_index]->features & feature);
+}
 
-    return ready_protocol_id;
+static bool protocol_dict_decoder_is_synced(ProtocolDict* dict, size_t protocol_index) {
+    ProtocolDecoderIsSynced fn = dict->base[protocol_index]->decoder.is_synced;
+    return fn && fn(dict->data[protocol_index]);
 }
 
-ProtocolId protocol_dict_decoders_feed_by_feature(
+static ProtocolId protocol_dict_decoders_feed_candidates(
     ProtocolDict* dict,
     uint32_t feature,
     bool level,
     uint32_t duration) {
-    bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
+    ProtocolId skip_protocol_id = PROTOCOL_NO;
+
+    if(dict->synced != PROTOCOL_NO) {
+        ProtocolId synced = dict->synced;
+
+        if(protocol_dict_decoder_matches(dict, synced, feature)) {
+            bool ready = protocol_dict_decoder_feed(dict, synced, level, duration);
+            bool still_synced = protocol_dict_decoder_is_synced(dict, synced);
+            if(ready || still_synced) {
+                if(!still_synced) dict->synced = PROTOCOL_NO;
+                return ready ? synced : PROTOCOL_NO;
+            }
+            // Lock is lost on this pulse, it may start a frame for someone else
+            skip_protocol_id = synced;
+        }
+
+        dict->synced = PROTOCOL_NO;
+    }
 
     for(size_t i = 0; i < dict->count; i++) {
-        uint32_t features = dict->base[i]->features;
-        if(features & feature) {
-            ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
-
-            if(fn) {
-                if(fn(dict->data[i], level, duration)) {
-                    if(!done) {
-                        ready_protocol_id = i;
-                        done = true;
-                    }
-                }
+        if(!protocol_dict_decoder_matches(dict, i, feature)) continue;
+        if((ProtocolId)i == skip_protocol_id) continue;
+
+        if(protocol_dict_decoder_feed(dict, i, level, duration)) {
+            if(ready_protocol_id == PROTOCOL_NO) {
+                ready_protocol_id = i;
+                // Only a decoded frame can narrow candidates, so a preamble look-alike
+                // in other protocol's data never starves its decoder
+                if(protocol_dict_decoder_is_synced(dict, i)) dict->synced = i;
             }
         }
     }
@@ -144,6 +184,19 @@ ProtocolId protocol_dict_decoders_feed_by_feature(
     return ready_protocol_id;
 }
 
+ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration) {
+    return protocol_dict_decoders_feed_candidates(
+        dict, PROTOCOL_DICT_FEATURE_ANY, level, duration);
+}
+
+ProtocolId protocol_dict_decoders_feed_by_feature(
+    ProtocolDict* dict,
+    uint32_t feature,
+    bool level,
+    uint32_t duration) {
+    return protocol_dict_decoders_feed_candidates(dict, feature, level, duration);
+}
+
 ProtocolId protocol_dict_decoders_feed_by_id(
     ProtocolDict* dict,
     size_t protocol_index,
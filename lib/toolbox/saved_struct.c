@@ -5,6 +5,9 @@
 
 #define TAG "SavedStruct"
 
+#define SAVED_STRUCT_TMP_SUFFIX ".tmp"
+#define SAVED_STRUCT_DEFER_MS 2000
+
 typedef struct {
     uint8_t magic;
     uint8_t version;
@@ -13,19 +16,101 @@ typedef struct {
     uint32_t timestamp;
 } SavedStructHeader;
 
-bool saved_struct_save(const char* path, void* data, size_t size, uint8_t magic, uint8_t version) {
-    furi_assert(path);
-    furi_assert(data);
-    furi_assert(size);
+typedef struct SavedStructPending SavedStructPending;
+
+struct SavedStructPending {
+    SavedStructPending* next;
+    FuriString* path;
+    void* data;
+    size_t size;
+    uint8_t magic;
+    uint8_t version;
+};
+
+typedef struct {
+    FuriMutex* mutex; // Guards pending list
+    FuriMutex* write_mutex; // Serializes file writes, held while entry is written
+    FuriTimer* timer;
+    FuriWork* work;
+    SavedStructPending* pending;
+} SavedStructWriter;
+
+static SavedStructWriter* saved_struct_writer = NULL;
+
+static void saved_struct_writer_timer_callback(void* context);
+static void saved_struct_writer_work_callback(void* context);
+static void saved_struct_writer_complete_callback(bool cancelled, void* context);
+
+static SavedStructWriter* saved_struct_writer_get() {
+    if(!saved_struct_writer) {
+        SavedStructWriter* writer = malloc(sizeof(SavedStructWriter));
+        writer->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        writer->write_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        writer->timer =
+            furi_timer_alloc(saved_struct_writer_timer_callback, FuriTimerTypeOnce, writer);
+        writer->work = furi_work_alloc(saved_struct_writer_work_callback, writer);
+        furi_work_set_complete_callback(
+            writer->work, saved_struct_writer_complete_callback, writer);
+
+        bool used = false;
+        FURI_CRITICAL_ENTER();
+        if(!saved_struct_writer) {
+            saved_struct_writer = writer;
+            used = true;
+        }
+        FURI_CRITICAL_EXIT();
+
+        if(!used) {
+            furi_work_free(writer->work);
+            furi_timer_free(writer->timer);
+            furi_mutex_free(writer->write_mutex);
+            furi_mutex_free(writer->mutex);
+            free(writer);
+        }
+    }
+    return saved_struct_writer;
+}
+
+static void saved_struct_pending_free(SavedStructPending* entry) {
+    furi_string_free(entry->path);
+    free(entry->data);
+    free(entry);
+}
+
+// Unlinks pending entry, writer mutex must be held
+static SavedStructPending* saved_struct_writer_take(SavedStructWriter* writer, const char* path) {
+    SavedStructPending* prev = NULL;
+    for(SavedStructPending* entry = writer->pending; entry; prev = entry, entry = entry->next) {
+        if(path && furi_string_cmp_str(entry->path, path) != 0) continue;
+
+        if(prev) {
+            prev->next = entry->next;
+        } else {
+            writer->pending = entry->next;
+        }
+        entry->next = NULL;
+        return entry;
+    }
+    return NULL;
+}
+
+static bool saved_struct_write(
+    Storage* storage,
+    const char* path,
+    const void* data,
+    size_t size,
+    uint8_t magic,
+    uint8_t version) {
     SavedStructHeader header;
 
     FURI_LOG_I(TAG, "Saving \"%s\"", path);
 
-    // Store
-    Storage* storage = furi_record_open(RECORD_STORAGE);
+    // Write to temporary file first, so interrupted save doesn't destroy previous data
+    FuriString* tmp_path = furi_string_alloc_printf("%s" SAVED_STRUCT_TMP_SUFFIX, path);
     File* file = storage_file_alloc(storage);
     bool result = true;
-    bool saved = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+    bool saved =
+        storage_file_open(file, furi_string_get_cstr(tmp_path), FSAM_WRITE, FSOM_CREATE_ALWAYS);
     if(!saved) {
         FURI_LOG_E(
             TAG, "Open failed \"%s\". Error: \'%s\'", path, storage_file_get_error_desc(file));
@@ -35,7 +120,7 @@ bool saved_struct_save(const char* path, void* data, size_t size, uint8_t magic,
     if(result) {
         // Calculate checksum
         uint8_t checksum = 0;
-        uint8_t* source = data;
+        const uint8_t* source = data;
         for(size_t i = 0; i < size; i++) {
             checksum += source[i];
         }
@@ -58,10 +143,143 @@ bool saved_struct_save(const char* path, void* data, size_t size, uint8_t magic,
 
     storage_file_close(file);
     storage_file_free(file);
+
+    if(result) {
+        FS_Error error = storage_common_remove(storage, path);
+        if(error == FSE_OK || error == FSE_NOT_EXIST) {
+            error = storage_common_rename(storage, furi_string_get_cstr(tmp_path), path);
+        }
+        if(error != FSE_OK) {
+            FURI_LOG_E(
+                TAG, "Replace failed \"%s\". Error: \'%s\'", path, storage_error_get_desc(error));
+            result = false;
+        }
+    }
+
+    furi_string_free(tmp_path);
+    return result;
+}
+
+// Writes all pending entries, returns when none is being written
+static void saved_struct_writer_flush(SavedStructWriter* writer) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    while(true) {
+        furi_check(furi_mutex_acquire(writer->write_mutex, FuriWaitForever) == FuriStatusOk);
+        furi_check(furi_mutex_acquire(writer->mutex, FuriWaitForever) == FuriStatusOk);
+        SavedStructPending* entry = saved_struct_writer_take(writer, NULL);
+        furi_check(furi_mutex_release(writer->mutex) == FuriStatusOk);
+
+        if(entry) {
+            saved_struct_write(
+                storage,
+                furi_string_get_cstr(entry->path),
+                entry->data,
+                entry->size,
+                entry->magic,
+                entry->version);
+        }
+        furi_check(furi_mutex_release(writer->write_mutex) == FuriStatusOk);
+
+        if(!entry) break;
+        saved_struct_pending_free(entry);
+    }
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void saved_struct_writer_timer_callback(void* context) {
+    SavedStructWriter* writer = context;
+    // Running flush is submitted again by completion callback if needed
+    if(!furi_work_is_busy(writer->work)) {
+        furi_work_submit(writer->work, FuriWorkQueuePriorityLow);
+    }
+}
+
+static void saved_struct_writer_work_callback(void* context) {
+    saved_struct_writer_flush(context);
+}
+
+static void saved_struct_writer_complete_callback(bool cancelled, void* context) {
+    UNUSED(cancelled);
+    SavedStructWriter* writer = context;
+
+    // Entries added after flush has checked the list, timer may have fired while it was busy
+    furi_check(furi_mutex_acquire(writer->mutex, FuriWaitForever) == FuriStatusOk);
+    bool pending = writer->pending != NULL;
+    furi_check(furi_mutex_release(writer->mutex) == FuriStatusOk);
+
+    if(pending) {
+        furi_work_submit(writer->work, FuriWorkQueuePriorityLow);
+    }
+}
+
+bool saved_struct_save(const char* path, void* data, size_t size, uint8_t magic, uint8_t version) {
+    furi_assert(path);
+    furi_assert(data);
+    furi_assert(size);
+
+    SavedStructWriter* writer = saved_struct_writer_get();
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    furi_check(furi_mutex_acquire(writer->write_mutex, FuriWaitForever) == FuriStatusOk);
+    // Deferred save of older data must not overwrite this one
+    furi_check(furi_mutex_acquire(writer->mutex, FuriWaitForever) == FuriStatusOk);
+    SavedStructPending* entry = saved_struct_writer_take(writer, path);
+    furi_check(furi_mutex_release(writer->mutex) == FuriStatusOk);
+    if(entry) saved_struct_pending_free(entry);
+
+    bool result = saved_struct_write(storage, path, data, size, magic, version);
+    furi_check(furi_mutex_release(writer->write_mutex) == FuriStatusOk);
+
     furi_record_close(RECORD_STORAGE);
     return result;
 }
 
+void saved_struct_save_deferred(
+    const char* path,
+    const void* data,
+    size_t size,
+    uint8_t magic,
+    uint8_t version) {
+    furi_assert(path);
+    furi_assert(data);
+    furi_assert(size);
+
+    SavedStructWriter* writer = saved_struct_writer_get();
+
+    furi_check(furi_mutex_acquire(writer->mutex, FuriWaitForever) == FuriStatusOk);
+    SavedStructPending* entry = saved_struct_writer_take(writer, path);
+    if(!entry) {
+        entry = malloc(sizeof(SavedStructPending));
+        entry->path = furi_string_alloc_set(path);
+    }
+    if(entry->size != size) {
+        free(entry->data);
+        entry->data = malloc(size);
+        entry->size = size;
+    }
+    memcpy(entry->data, data, size);
+    entry->magic = magic;
+    entry->version = version;
+
+    SavedStructPending** tail = &writer->pending;
+    while(*tail) tail = &(*tail)->next;
+    *tail = entry;
+    furi_check(furi_mutex_release(writer->mutex) == FuriStatusOk);
+
+    // Every save restarts the quiet period
+    furi_timer_start(writer->timer, furi_ms_to_ticks(SAVED_STRUCT_DEFER_MS));
+}
+
+void saved_struct_flush() {
+    // Nothing was ever saved
+    if(!saved_struct_writer) return;
+
+    furi_timer_stop(saved_struct_writer->timer);
+    saved_struct_writer_flush(saved_struct_writer);
+}
+
 bool saved_struct_load(const char* path, void* data, size_t size, uint8_t magic, uint8_t version) {
     FURI_LOG_I(TAG, "Loading \"%s\"", path);
 
@@ -69,6 +287,16 @@ bool saved_struct_load(const char* path, void* data, size_t size, uint8_t magic,
 
     uint8_t* data_read = malloc(size);
     Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    // Save was interrupted after old file was removed, temporary file is complete
+    FuriString* tmp_path = furi_string_alloc_printf("%s" SAVED_STRUCT_TMP_SUFFIX, path);
+    if(!storage_file_exists(storage, path) &&
+       storage_file_exists(storage, furi_string_get_cstr(tmp_path))) {
+        FURI_LOG_W(TAG, "Recovering \"%s\"", path);
+        storage_common_rename(storage, furi_string_get_cstr(tmp_path), path);
+    }
+    furi_string_free(tmp_path);
+
     File* file = storage_file_alloc(storage);
     bool result = true;
     bool loaded = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
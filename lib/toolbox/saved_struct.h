@@ -10,8 +10,40 @@ extern "C" {
 
 bool saved_struct_load(const char* path, void* data, size_t size, uint8_t magic, uint8_t version);
 
+/** Save struct, replaces file only after new data is completely written
+ *
+ * @param      path     file path
+ * @param      data     struct data
+ * @param      size     struct size
+ * @param      magic    header magic
+ * @param      version  header version
+ *
+ * @return     true on success
+ */
 bool saved_struct_save(const char* path, void* data, size_t size, uint8_t magic, uint8_t version);
 
+/** Schedule struct save in background
+ *
+ * Data is copied, so it can be changed right away. File is written after no
+ * deferred save was requested for a short quiet period, repeated saves of the
+ * same path in the meantime are coalesced into one write.
+ *
+ * @param      path     file path
+ * @param      data     struct data
+ * @param      size     struct size
+ * @param      magic    header magic
+ * @param      version  header version
+ */
+void saved_struct_save_deferred(
+    const char* path,
+    const void* data,
+    size_t size,
+    uint8_t magic,
+    uint8_t version);
+
+/** Write all deferred saves now, call before power off or reboot */
+void saved_struct_flush();
+
 bool saved_struct_get_payload_size(
     const char* path,
     uint8_t magic,
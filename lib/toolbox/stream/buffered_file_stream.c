@@ -4,6 +4,9 @@
 #include "file_stream.h"
 #include "stream_cache.h"
 
+#define BUFFERED_FILE_STREAM_CACHE_SIZE 1024U
+#define BUFFERED_FILE_STREAM_CACHE_MAX_SIZE 4096U
+
 typedef struct {
     Stream stream_base;
     Stream* file_stream;
@@ -21,6 +24,7 @@ static size_t buffered_file_stream_size(BufferedFileStream* stream);
 static size_t
     buffered_file_stream_write(BufferedFileStream* stream, const uint8_t* data, size_t size);
 static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* data, size_t size);
+static size_t buffered_file_stream_peek(BufferedFileStream* stream, const uint8_t** data);
 static bool buffered_file_stream_delete_and_insert(
     BufferedFileStream* stream,
     size_t delete_size,
@@ -40,13 +44,19 @@ const StreamVTable buffered_file_stream_vtable = {
     .write = (StreamWriteFn)buffered_file_stream_write,
     .read = (StreamReadFn)buffered_file_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)buffered_file_stream_delete_and_insert,
+    .peek = (StreamPeekFn)buffered_file_stream_peek,
 };
 
 Stream* buffered_file_stream_alloc(Storage* storage) {
+    return buffered_file_stream_alloc_ex(
+        storage, BUFFERED_FILE_STREAM_CACHE_SIZE, BUFFERED_FILE_STREAM_CACHE_MAX_SIZE);
+}
+
+Stream* buffered_file_stream_alloc_ex(Storage* storage, size_t cache_size, size_t cache_max_size) {
     BufferedFileStream* stream = malloc(sizeof(BufferedFileStream));
 
     stream->file_stream = file_stream_alloc(storage);
-    stream->cache = stream_cache_alloc();
+    stream->cache = stream_cache_alloc(cache_size, cache_max_size);
     stream->sync_pending = false;
 
     stream->stream_base.vtable = &buffered_file_stream_vtable;
@@ -206,6 +216,16 @@ static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* dat
     return size - need_to_read;
 }
 
+static size_t buffered_file_stream_peek(BufferedFileStream* stream, const uint8_t** data) {
+    if(stream_cache_at_end(stream->cache)) {
+        if(stream->sync_pending) {
+            if(!buffered_file_stream_flush(stream)) return 0;
+        }
+        stream_cache_fill(stream->cache, stream->file_stream);
+    }
+    return stream_cache_peek(stream->cache, data);
+}
+
 static bool buffered_file_stream_delete_and_insert(
     BufferedFileStream* stream,
     size_t delete_size,
@@ -13,6 +13,20 @@ extern "C" {
  */
 Stream* buffered_file_stream_alloc(Storage* storage);
 
+/**
+ * Allocate a file stream with buffered read operations and given buffer size
+ *
+ * Buffer is filled with cache_size bytes at first. While the file is read
+ * sequentially, every next fill reads twice as much, up to cache_max_size.
+ * Random access returns to cache_size.
+ *
+ * @param storage pointer to Storage instance
+ * @param cache_size initial buffer size in bytes
+ * @param cache_max_size maximum buffer size in bytes, no less than cache_size
+ * @return Stream*
+ */
+Stream* buffered_file_stream_alloc_ex(Storage* storage, size_t cache_size, size_t cache_max_size);
+
 /**
  * Opens an existing file or creates a new one.
  * @param stream pointer to file stream object.
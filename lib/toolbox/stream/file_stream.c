@@ -1,6 +1,9 @@
 #include "stream.h"
 #include "stream_i.h"
 #include "file_stream.h"
+#include "string_stream.h"
+
+#define FILE_STREAM_MOVE_BUFFER_SIZE 1024U
 
 typedef struct {
     Stream stream_base;
@@ -141,6 +144,28 @@ static size_t file_stream_read(FileStream* stream, uint8_t* data, size_t size) {
     return storage_file_read(stream->file, data, size);
 }
 
+// Move file data between overlapping ranges, starting from the side that is not overwritten
+static bool file_stream_move(FileStream* stream, size_t from, size_t to, size_t size) {
+    uint8_t* buffer = malloc(FILE_STREAM_MOVE_BUFFER_SIZE);
+    size_t moved = 0;
+
+    while(moved < size) {
+        const size_t chunk_size = MIN(size - moved, FILE_STREAM_MOVE_BUFFER_SIZE);
+        // Forward move goes from the end, backward move goes from the start
+        const size_t offset = (to > from) ? (size - moved - chunk_size) : moved;
+
+        if(!storage_file_seek(stream->file, from + offset, true)) break;
+        if(storage_file_read(stream->file, buffer, chunk_size) != chunk_size) break;
+        if(!storage_file_seek(stream->file, to + offset, true)) break;
+        if(storage_file_write(stream->file, buffer, chunk_size) != chunk_size) break;
+
+        moved += chunk_size;
+    }
+
+    free(buffer);
+    return moved == size;
+}
+
 static bool file_stream_delete_and_insert(
     FileStream* _stream,
     size_t delete_size,
@@ -149,67 +174,44 @@ static bool file_stream_delete_and_insert(
     bool result = false;
     Stream* stream = (Stream*)_stream;
 
-    // open scratchpad
-    Stream* scratch_stream = file_stream_alloc(_stream->storage);
-
-    // TODO FL-3546: we need something like "storage_open_tmpfile and storage_close_tmpfile"
-    FuriString* scratch_name;
-    FuriString* tmp_name;
-    tmp_name = furi_string_alloc();
-    storage_get_next_filename(
-        _stream->storage, STORAGE_ANY_PATH_PREFIX, ".scratch", ".pad", tmp_name, 255);
-    scratch_name = furi_string_alloc_printf(ANY_PATH("%s.pad"), furi_string_get_cstr(tmp_name));
-    furi_string_free(tmp_name);
+    // Data to insert is collected in RAM, so that only the tail of the file is
+    // moved in place, and only if its position changes
+    Stream* insert_stream = string_stream_alloc();
 
     do {
-        if(!file_stream_open(
-               scratch_stream,
-               furi_string_get_cstr(scratch_name),
-               FSAM_READ_WRITE,
-               FSOM_CREATE_NEW))
-            break;
+        if(write_callback) {
+            if(!write_callback(insert_stream, ctx)) break;
+        }
 
-        size_t current_position = stream_tell(stream);
-        size_t file_size = stream_size(stream);
+        const size_t insert_size = stream_size(insert_stream);
+        const size_t current_position = stream_tell(stream);
+        const size_t file_size = stream_size(stream);
 
         size_t size_to_delete = file_size - current_position;
         size_to_delete = MIN(delete_size, size_to_delete);
 
-        size_t size_to_copy_before = current_position;
-        size_t size_to_copy_after = file_size - current_position - size_to_delete;
+        const size_t tail_position = current_position + size_to_delete;
+        const size_t tail_size = file_size - tail_position;
+        const size_t new_tail_position = current_position + insert_size;
 
-        // copy file from 0 to insert position to scratchpad
-        if(!stream_rewind(stream)) break;
-        if(stream_copy(stream, scratch_stream, size_to_copy_before) != size_to_copy_before) break;
-
-        if(write_callback) {
-            if(!write_callback(scratch_stream, ctx)) break;
+        if(new_tail_position != tail_position) {
+            if(!file_stream_move(_stream, tail_position, new_tail_position, tail_size)) break;
         }
-        size_t new_position = stream_tell(scratch_stream);
 
-        // copy key file after insert position + size_to_delete to scratchpad
-        if(!stream_seek(stream, size_to_delete, StreamOffsetFromCurrent)) break;
-        if(stream_copy(stream, scratch_stream, size_to_copy_after) != size_to_copy_after) break;
-
-        size_t new_file_size = stream_size(scratch_stream);
-
-        // copy whole scratchpad file to the original file
-        if(!stream_rewind(stream)) break;
-        if(!stream_rewind(scratch_stream)) break;
-        if(stream_copy(scratch_stream, stream, new_file_size) != new_file_size) break;
-
-        // and truncate original file
-        if(!storage_file_truncate(_stream->file)) break;
+        if(new_tail_position < tail_position) {
+            if(!storage_file_seek(_stream->file, new_tail_position + tail_size, true)) break;
+            if(!storage_file_truncate(_stream->file)) break;
+        }
 
-        // move seek pointer at insert end
-        if(!stream_seek(stream, new_position, StreamOffsetFromStart)) break;
+        // write inserted data, seek pointer ends up at insert end
+        if(!stream_seek(stream, current_position, StreamOffsetFromStart)) break;
+        if(!stream_rewind(insert_stream)) break;
+        if(stream_copy(insert_stream, stream, insert_size) != insert_size) break;
 
         result = true;
     } while(false);
 
-    stream_free(scratch_stream);
-    storage_common_remove(_stream->storage, furi_string_get_cstr(scratch_name));
-    furi_string_free(scratch_name);
+    stream_free(insert_stream);
 
     return result;
 }
@@ -145,40 +145,76 @@ static bool stream_write_struct(Stream* stream, const void* context) {
     return (stream_write(stream, write_data->data, write_data->size) == write_data->size);
 }
 
+static size_t stream_peek(Stream* stream, const uint8_t** data) {
+    return stream->vtable->peek ? stream->vtable->peek(stream, data) : 0;
+}
+
+// Append line data to the string, leaving out carriage returns
+static void stream_line_append(FuriString* str_result, const uint8_t* data, size_t size) {
+    const uint8_t* end = data + size;
+
+    while(data < end) {
+        const uint8_t* cr = memchr(data, '\r', end - data);
+        const uint8_t* span_end = cr ? cr : end;
+        furi_string_cat_strn(str_result, (const char*)data, span_end - data);
+        data = cr ? cr + 1 : end;
+    }
+}
+
 bool stream_read_line(Stream* stream, FuriString* str_result) {
     furi_string_reset(str_result);
+    const bool peekable = (stream->vtable->peek != NULL);
     uint8_t buffer[STREAM_BUFFER_SIZE];
 
-    do {
-        uint16_t bytes_were_read = stream_read(stream, buffer, STREAM_BUFFER_SIZE);
-        if(bytes_were_read == 0) break;
-
-        bool result = false;
-        bool error = false;
-        for(uint16_t i = 0; i < bytes_were_read; i++) {
-            if(buffer[i] == '\n') {
-                if(!stream_seek(stream, i - bytes_were_read + 1, StreamOffsetFromCurrent)) {
-                    error = true;
-                    break;
-                }
-                furi_string_push_back(str_result, buffer[i]);
-                result = true;
-                break;
-            } else if(buffer[i] == '\r') {
-                // Ignore
-            } else {
-                furi_string_push_back(str_result, buffer[i]);
-            }
-        }
-
-        if(result || error) {
+    while(true) {
+        const uint8_t* data = buffer;
+        const size_t size = peekable ? stream_peek(stream, &data) :
+                                       stream_read(stream, buffer, STREAM_BUFFER_SIZE);
+        if(size == 0) break;
+
+        const uint8_t* newline = memchr(data, '\n', size);
+        const size_t line_size = newline ? (size_t)(newline - data) + 1 : size;
+
+        // Consume line from peeked data or give back data read past the line
+        const int32_t offset = peekable ? (int32_t)line_size : (int32_t)line_size - (int32_t)size;
+        if(offset != 0 && !stream_seek(stream, offset, StreamOffsetFromCurrent)) {
+            stream_line_append(str_result, data, newline ? line_size - 1 : line_size);
             break;
         }
-    } while(true);
+
+        stream_line_append(str_result, data, line_size);
+        if(newline) break;
+    }
 
     return furi_string_size(str_result) != 0;
 }
 
+bool stream_read_line_view(Stream* stream, const char** line, size_t* length) {
+    furi_assert(line);
+    furi_assert(length);
+
+    const uint8_t* data;
+    const size_t size = stream_peek(stream, &data);
+    if(size == 0) return false;
+
+    const uint8_t* newline = memchr(data, '\n', size);
+    size_t line_size;
+    if(newline) {
+        line_size = (size_t)(newline - data) + 1;
+    } else if(stream_tell(stream) + size == stream_size(stream)) {
+        // Last line without line ending
+        line_size = size;
+    } else {
+        return false;
+    }
+
+    if(!stream_seek(stream, line_size, StreamOffsetFromCurrent)) return false;
+
+    *line = (const char*)data;
+    *length = line_size;
+    return true;
+}
+
 bool stream_rewind(Stream* stream) {
     furi_assert(stream);
     return stream_seek(stream, 0, StreamOffsetFromStart);
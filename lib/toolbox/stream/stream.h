@@ -121,6 +121,22 @@ bool stream_delete_and_insert(
  */
 bool stream_read_line(Stream* stream, FuriString* str_result);
 
+/**
+ * Read line from a stream without copying it, if the stream buffers it whole
+ *
+ * Line is returned as is, with its line ending, and is valid until the next
+ * operation on the stream. Returns false without moving the RW pointer when
+ * the stream doesn't buffer data or the line doesn't fit the buffer, so read
+ * the line with stream_read_line() then.
+ *
+ * @param stream
+ * @param line pointer to line data
+ * @param length line length, including line ending
+ * @return true if line is read
+ * @return false otherwise
+ */
+bool stream_read_line_view(Stream* stream, const char** line, size_t* length);
+
 /**
  * Moves the RW pointer to the start
  * @param stream Stream instance
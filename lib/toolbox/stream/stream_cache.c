@@ -1,27 +1,42 @@
 #include "stream_cache.h"
 
-#define STREAM_CACHE_MAX_SIZE 1024U
-
 struct StreamCache {
-    uint8_t data[STREAM_CACHE_MAX_SIZE];
+    uint8_t* data;
     size_t data_size;
     size_t position;
+    size_t capacity;
+    size_t fill_size;
+    size_t min_size;
+    size_t max_size;
 };
 
-StreamCache* stream_cache_alloc() {
+StreamCache* stream_cache_alloc(size_t size, size_t max_size) {
+    furi_check(size);
+    furi_check(max_size >= size);
+
     StreamCache* cache = malloc(sizeof(StreamCache));
+    cache->data = malloc(size);
     cache->data_size = 0;
     cache->position = 0;
+    cache->capacity = size;
+    cache->fill_size = size;
+    cache->min_size = size;
+    cache->max_size = max_size;
     return cache;
 }
 void stream_cache_free(StreamCache* cache) {
     furi_assert(cache);
     cache->data_size = 0;
     cache->position = 0;
+    free(cache->data);
     free(cache);
 }
 
 void stream_cache_drop(StreamCache* cache) {
+    // Cached data left unread means access is not sequential, stop reading ahead
+    if(cache->position < cache->data_size) {
+        cache->fill_size = cache->min_size;
+    }
     cache->data_size = 0;
     cache->position = 0;
 }
@@ -39,8 +54,25 @@ size_t stream_cache_pos(StreamCache* cache) {
     return cache->position;
 }
 
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data) {
+    furi_assert(cache->data_size >= cache->position);
+    *data = cache->data + cache->position;
+    return cache->data_size - cache->position;
+}
+
 size_t stream_cache_fill(StreamCache* cache, Stream* stream) {
-    const size_t size_read = stream_read(stream, cache->data, STREAM_CACHE_MAX_SIZE);
+    // Previous fill was read through to the end, read further ahead this time
+    if(cache->data_size == cache->fill_size && cache->position == cache->data_size &&
+       cache->fill_size < cache->max_size) {
+        cache->fill_size = MIN(cache->fill_size * 2, cache->max_size);
+        if(cache->fill_size > cache->capacity) {
+            free(cache->data);
+            cache->data = malloc(cache->fill_size);
+            cache->capacity = cache->fill_size;
+        }
+    }
+
+    const size_t size_read = stream_read(stream, cache->data, cache->fill_size);
     cache->data_size = size_read;
     cache->position = 0;
     return size_read;
@@ -66,7 +98,7 @@ size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size) {
 
 size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size) {
     furi_assert(cache->data_size >= cache->position);
-    const size_t size_written = MIN(size, STREAM_CACHE_MAX_SIZE - cache->position);
+    const size_t size_written = MIN(size, cache->capacity - cache->position);
     if(size_written > 0) {
         memcpy(cache->data + cache->position, data, size_written);
         cache->position += size_written;
@@ -10,9 +10,16 @@ typedef struct StreamCache StreamCache;
 
 /**
  * Allocate stream cache.
+ *
+ * Cache is filled with size bytes at first. While the stream is read
+ * sequentially, every next fill reads twice as much, up to max_size.
+ * Dropping the cache before its data is read through returns to size.
+ *
+ * @param size Initial cache size in bytes
+ * @param max_size Maximum cache size in bytes, no less than size
  * @return StreamCache* pointer to a StreamCache instance
  */
-StreamCache* stream_cache_alloc();
+StreamCache* stream_cache_alloc(size_t size, size_t max_size);
 
 /**
  * Free stream cache.
@@ -47,6 +54,14 @@ size_t stream_cache_size(StreamCache* cache);
  */
 size_t stream_cache_pos(StreamCache* cache);
 
+/**
+ * Get cached data at the internal cursor without advancing it.
+ * @param cache Pointer to a StreamCache instance
+ * @param data Pointer to cached data
+ * @return Size of cached data after the cursor.
+ */
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data);
+
 /**
  * Load the cache with new data from a stream.
  * @param cache Pointer to a StreamCache instance
@@ -19,6 +19,7 @@ typedef size_t (*StreamTellFn)(Stream* stream);
 typedef size_t (*StreamSizeFn)(Stream* stream);
 typedef size_t (*StreamWriteFn)(Stream* stream, const uint8_t* data, size_t size);
 typedef size_t (*StreamReadFn)(Stream* stream, uint8_t* data, size_t count);
+typedef size_t (*StreamPeekFn)(Stream* stream, const uint8_t** data);
 typedef bool (*StreamDeleteAndInsertFn)(
     Stream* stream,
     size_t delete_size,
@@ -35,6 +36,9 @@ struct StreamVTable {
     const StreamWriteFn write;
     const StreamReadFn read;
     const StreamDeleteAndInsertFn delete_and_insert;
+    /** Optional. Get data buffered at RW pointer without copying it, buffering
+     * more if there is none. Data is valid until the next stream operation. */
+    const StreamPeekFn peek;
 };
 
 struct Stream {
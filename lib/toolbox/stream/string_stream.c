@@ -19,6 +19,7 @@ static size_t string_stream_tell(StringStream* stream);
 static size_t string_stream_size(StringStream* stream);
 static size_t string_stream_write(StringStream* stream, const char* data, size_t size);
 static size_t string_stream_read(StringStream* stream, char* data, size_t size);
+static size_t string_stream_peek(StringStream* stream, const uint8_t** data);
 static bool string_stream_delete_and_insert(
     StringStream* stream,
     size_t delete_size,
@@ -35,6 +36,7 @@ const StreamVTable string_stream_vtable = {
     .write = (StreamWriteFn)string_stream_write,
     .read = (StreamReadFn)string_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)string_stream_delete_and_insert,
+    .peek = (StreamPeekFn)string_stream_peek,
 };
 
 Stream* string_stream_alloc() {
@@ -133,6 +135,14 @@ static size_t string_stream_read(StringStream* stream, char* data, size_t size)
     return write_index;
 }
 
+static size_t string_stream_peek(StringStream* stream, const uint8_t** data) {
+    const size_t size = string_stream_size(stream);
+    if(stream->index >= size) return 0;
+
+    *data = (const uint8_t*)furi_string_get_cstr(stream->string) + stream->index;
+    return size - stream->index;
+}
+
 static bool string_stream_delete_and_insert(
     StringStream* stream,
     size_t delete_size,
@@ -7,7 +7,8 @@
 
 #define TAG "TarArch"
 #define MAX_NAME_LEN 254
-#define FILE_BLOCK_SIZE 512
+/* Multiple of tar block size, so data stays sector aligned on both ends */
+#define FILE_BLOCK_SIZE (8 * 512)
 
 #define FILE_OPEN_NTRIES 10
 #define FILE_OPEN_RETRY_DELAY 25
@@ -17,6 +18,7 @@ typedef struct TarArchive {
     mtar_t tar;
     tar_unpack_file_cb unpack_cb;
     void* unpack_cb_context;
+    bool skip_unchanged;
 } TarArchive;
 
 /* API WRAPPER */
@@ -55,6 +57,7 @@ TarArchive* tar_archive_alloc(Storage* storage) {
     TarArchive* archive = malloc(sizeof(TarArchive));
     archive->storage = storage;
     archive->unpack_cb = NULL;
+    archive->skip_unchanged = false;
     return archive;
 }
 
@@ -103,6 +106,11 @@ void tar_archive_set_file_callback(TarArchive* archive, tar_unpack_file_cb callb
     archive->unpack_cb_context = context;
 }
 
+void tar_archive_set_skip_unchanged(TarArchive* archive, bool skip_unchanged) {
+    furi_assert(archive);
+    archive->skip_unchanged = skip_unchanged;
+}
+
 static int tar_archive_entry_counter(mtar_t* tar, const mtar_header_t* header, void* param) {
     UNUSED(tar);
     UNUSED(header);
@@ -169,37 +177,83 @@ typedef struct {
     Storage_name_converter converter;
 } TarArchiveDirectoryOpParams;
 
-static bool archive_extract_current_file(TarArchive* archive, const char* dst_path) {
+/* Size is used for preallocation and comparison only, 0 if unknown */
+static bool
+    archive_extract_current_file(TarArchive* archive, const char* dst_path, uint32_t size) {
     mtar_t* tar = &archive->tar;
     File* out_file = storage_file_alloc(archive->storage);
     uint8_t* readbuf = malloc(FILE_BLOCK_SIZE);
+    uint8_t* cmpbuf = NULL;
 
     bool success = true;
+    bool expanded = false;
     uint8_t n_tries = FILE_OPEN_NTRIES;
     do {
-        while(n_tries-- > 0) {
-            if(storage_file_open(out_file, dst_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
-                break;
+        // Existing file of the same size is only written from the first difference on
+        if(archive->skip_unchanged && size) {
+            if(storage_file_open(out_file, dst_path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING) &&
+               storage_file_size(out_file) == size) {
+                cmpbuf = malloc(FILE_BLOCK_SIZE);
+            } else {
+                storage_file_close(out_file);
             }
-            FURI_LOG_W(TAG, "Failed to open '%s', reties: %d", dst_path, n_tries);
-            storage_file_close(out_file);
-            furi_delay_ms(FILE_OPEN_RETRY_DELAY);
         }
 
-        if(!storage_file_is_open(out_file)) {
-            success = false;
-            break;
+        if(!cmpbuf) {
+            while(n_tries-- > 0) {
+                if(storage_file_open(out_file, dst_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+                    break;
+                }
+                FURI_LOG_W(TAG, "Failed to open '%s', reties: %d", dst_path, n_tries);
+                storage_file_close(out_file);
+                furi_delay_ms(FILE_OPEN_RETRY_DELAY);
+            }
+
+            if(!storage_file_is_open(out_file)) {
+                success = false;
+                break;
+            }
+
+            // Contiguous preallocation is optional, plain writes will allocate otherwise
+            expanded = size && storage_file_expand(out_file, size);
         }
 
         while(!mtar_eof_data(tar)) {
             int32_t readcnt = mtar_read_data(tar, readbuf, FILE_BLOCK_SIZE);
-            if(!readcnt || !storage_file_write(out_file, readbuf, readcnt)) {
+            if(readcnt <= 0) {
                 success = false;
                 break;
             }
+
+            if(cmpbuf) {
+                const uint64_t offset = storage_file_tell(out_file);
+                if(storage_file_read(out_file, cmpbuf, readcnt) == (size_t)readcnt &&
+                   memcmp(readbuf, cmpbuf, readcnt) == 0) {
+                    continue;
+                }
+
+                // Rest of the file is written without comparing
+                free(cmpbuf);
+                cmpbuf = NULL;
+                if(!storage_file_seek(out_file, offset, true)) {
+                    success = false;
+                    break;
+                }
+            }
+
+            if(storage_file_write(out_file, readbuf, readcnt) != (size_t)readcnt) {
+                success = false;
+                break;
+            }
+        }
+
+        // Cut preallocated space that was not written
+        if(expanded && !success) {
+            storage_file_truncate(out_file);
         }
     } while(false);
     storage_file_free(out_file);
+    free(cmpbuf);
     free(readbuf);
 
     return success;
@@ -247,8 +301,8 @@ static int archive_extract_foreach_cb(mtar_t* tar, const mtar_header_t* header,
     full_extracted_fname = furi_string_alloc();
     path_concat(op_params->work_dir, furi_string_get_cstr(converted_fname), full_extracted_fname);
 
-    bool success =
-        archive_extract_current_file(archive, furi_string_get_cstr(full_extracted_fname));
+    bool success = archive_extract_current_file(
+        archive, furi_string_get_cstr(full_extracted_fname), header->size);
 
     furi_string_free(converted_fname);
     furi_string_free(full_extracted_fname);
@@ -382,5 +436,5 @@ bool tar_archive_unpack_file(
     if(mtar_find(&archive->tar, archive_fname) != MTAR_ESUCCESS) {
         return false;
     }
-    return archive_extract_current_file(archive, destination);
+    return archive_extract_current_file(archive, destination, 0);
 }
@@ -50,6 +50,9 @@ typedef bool (*tar_unpack_file_cb)(const char* name, bool is_directory, void* co
 
 void tar_archive_set_file_callback(TarArchive* archive, tar_unpack_file_cb callback, void* context);
 
+/* Compare files with existing ones on unpacking, writes only start at the first difference */
+void tar_archive_set_skip_unchanged(TarArchive* archive, bool skip_unchanged);
+
 /* Low-level API */
 bool tar_archive_dir_add_element(TarArchive* archive, const char* dirpath);
 
@@ -9,8 +9,45 @@
 
 #define ICONS_FMT XTREME_ASSETS_PATH "/%s/Icons/%s"
 
-void load_icon_animated(const Icon* replace, const char* name, FuriString* path, File* file) {
+/* Replacements are loaded on first use, idle static ones are dropped when heap runs low */
+#define ICONS_MIN_FREE_HEAP (32 * 1024)
+#define ICONS_EVICT_IDLE_MS (30 * 1000)
+
+typedef enum {
+    IconSlotPending,
+    IconSlotLoaded,
+    IconSlotFailed,
+} IconSlotState;
+
+/* Replaced icon points to its slot with original field, until assets are freed */
+typedef struct {
+    const IconPath* path;
+    Icon original;
+    uint32_t last_used;
+    IconSlotState state;
+} IconSlot;
+
+typedef struct {
+    FuriMutex* mutex;
+    size_t count;
+    IconSlot slots[];
+} IconIndex;
+
+static IconIndex* icon_index = NULL;
+
+static uint32_t icon_path_hash(const char* str) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    while(*str) {
+        hash = (hash ^ (uint8_t)*str++) * 16777619UL;
+    }
+    return hash;
+}
+
+static bool
+    load_icon_animated(const Icon* replace, const char* name, FuriString* path, File* file) {
     const char* pack = xtreme_settings.asset_pack;
+    bool loaded = false;
     furi_string_printf(path, ICONS_FMT "/meta", pack, name);
     if(storage_file_open(file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
         int32_t icon_width, icon_height, frame_rate, frame_count;
@@ -41,14 +78,12 @@ void load_icon_animated(const Icon* replace, const char* name, FuriString* path,
             }
 
             if(i == frame_count) {
-                Icon* original = malloc(sizeof(Icon));
-                memcpy(original, replace, sizeof(Icon));
-                FURI_CONST_ASSIGN_PTR(replace->original, original);
                 FURI_CONST_ASSIGN(replace->width, icon_width);
                 FURI_CONST_ASSIGN(replace->height, icon_height);
                 FURI_CONST_ASSIGN(replace->frame_rate, frame_rate);
                 FURI_CONST_ASSIGN(replace->frame_count, frame_count);
                 FURI_CONST_ASSIGN_PTR(replace->frames, frames);
+                loaded = true;
             } else {
                 for(; i >= 0; i--) {
                     free(frames[i]);
@@ -58,9 +93,12 @@ void load_icon_animated(const Icon* replace, const char* name, FuriString* path,
         }
     }
     storage_file_close(file);
+    return loaded;
 }
 
-void load_icon_static(const Icon* replace, const char* name, FuriString* path, File* file) {
+static bool
+    load_icon_static(const Icon* replace, const char* name, FuriString* path, File* file) {
+    bool loaded = false;
     furi_string_printf(path, ICONS_FMT ".bmx", xtreme_settings.asset_pack, name);
     if(storage_file_open(file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
         uint64_t size = storage_file_size(file) - 8;
@@ -70,9 +108,6 @@ void load_icon_static(const Icon* replace, const char* name, FuriString* path, F
         if(storage_file_read(file, &icon_width, 4) == 4 &&
            storage_file_read(file, &icon_height, 4) == 4 &&
            storage_file_read(file, frame, size) == size) {
-            Icon* original = malloc(sizeof(Icon));
-            memcpy(original, replace, sizeof(Icon));
-            FURI_CONST_ASSIGN_PTR(replace->original, original);
             uint8_t** frames = malloc(sizeof(const uint8_t*));
             frames[0] = frame;
             FURI_CONST_ASSIGN(replace->frame_rate, 0);
@@ -80,60 +115,190 @@ void load_icon_static(const Icon* replace, const char* name, FuriString* path, F
             FURI_CONST_ASSIGN(replace->width, icon_width);
             FURI_CONST_ASSIGN(replace->height, icon_height);
             FURI_CONST_ASSIGN_PTR(replace->frames, frames);
+            loaded = true;
         } else {
             free(frame);
         }
     }
     storage_file_close(file);
+    return loaded;
 }
 
-void free_icon(const Icon* icon) {
+static void free_icon(const Icon* icon) {
     uint8_t** frames = (void*)icon->frames;
     int32_t frame_count = icon->frame_count;
 
-    Icon* original = icon->original;
-    memcpy((void*)icon, original, sizeof(Icon));
+    IconSlot* slot = (IconSlot*)icon->original;
+    memcpy((void*)icon, &slot->original, sizeof(Icon));
 
-    free(original);
     for(int32_t i = 0; i < frame_count; i++) {
         free(frames[i]);
     }
     free(frames);
 }
 
+static void icon_index_evict(IconIndex* index) {
+    uint32_t now = furi_get_tick();
+    uint32_t idle = furi_ms_to_ticks(ICONS_EVICT_IDLE_MS);
+
+    while(memmgr_get_free_heap() < ICONS_MIN_FREE_HEAP) {
+        /* Animated icons stay, running IconAnimation relies on their frame count */
+        IconSlot* oldest = NULL;
+        for(size_t i = 0; i < index->count; i++) {
+            IconSlot* slot = &index->slots[i];
+            if(slot->state != IconSlotLoaded || slot->path->animated) continue;
+            if(now - slot->last_used < idle) continue;
+            if(!oldest || slot->last_used < oldest->last_used) oldest = slot;
+        }
+        if(!oldest) break;
+
+        const Icon* icon = oldest->path->icon;
+        free_icon(icon);
+        FURI_CONST_ASSIGN_PTR(icon->original, (Icon*)oldest);
+        oldest->state = IconSlotPending;
+    }
+}
+
+void XTREME_ASSETS_USE(const Icon* icon) {
+    IconIndex* index = icon_index;
+    if(!index || !icon->original) return;
+
+    IconSlot* slot = (IconSlot*)icon->original;
+    if(slot < index->slots || slot >= index->slots + index->count) return;
+
+    slot->last_used = furi_get_tick();
+    if(slot->state != IconSlotPending) return;
+
+    furi_check(furi_mutex_acquire(index->mutex, FuriWaitForever) == FuriStatusOk);
+    if(slot->state == IconSlotPending) {
+        icon_index_evict(index);
+
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        File* file = storage_file_alloc(storage);
+        FuriString* path = furi_string_alloc();
+
+        bool loaded;
+        if(slot->path->animated) {
+            loaded = load_icon_animated(icon, slot->path->path, path, file);
+        } else {
+            loaded = load_icon_static(icon, slot->path->path, path, file);
+        }
+        slot->state = loaded ? IconSlotLoaded : IconSlotFailed;
+        if(!loaded) FURI_LOG_W(TAG, "Failed to load %s", slot->path->path);
+
+        furi_string_free(path);
+        storage_file_free(file);
+        furi_record_close(RECORD_STORAGE);
+    }
+    furi_mutex_release(index->mutex);
+}
+
+static void icon_index_mark_dir(
+    File* dir,
+    const char* path,
+    const char* category,
+    const uint32_t* hashes,
+    bool* marks) {
+    FileInfo info;
+    char name[64];
+    char key[128];
+
+    if(storage_dir_open(dir, path)) {
+        while(storage_dir_read(dir, &info, name, sizeof(name))) {
+            bool animated = info.flags & FSF_DIRECTORY;
+            if(!animated) {
+                /* Static replacements are Name.bmx, animated ones Name/ folders */
+                char* ext = strrchr(name, '.');
+                if(!ext || strcmp(ext, ".bmx")) continue;
+                *ext = '\0';
+            }
+            snprintf(key, sizeof(key), "%s/%s", category, name);
+
+            uint32_t hash = icon_path_hash(key);
+            for(size_t i = 0; i < ICON_PATHS_COUNT; i++) {
+                if(hashes[i] == hash && ICON_PATHS[i].animated == animated &&
+                   !strcmp(ICON_PATHS[i].path, key)) {
+                    marks[i] = true;
+                    break;
+                }
+            }
+        }
+    }
+    storage_dir_close(dir);
+}
+
 void XTREME_ASSETS_LOAD() {
     const char* pack = xtreme_settings.asset_pack;
     xtreme_settings.is_nsfw = !strncmp(pack, "NSFW", strlen("NSFW"));
     if(pack[0] == '\0') return;
+    furi_check(!icon_index);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FuriString* p = furi_string_alloc();
+    FuriString* sub = furi_string_alloc();
     FileInfo info;
-    furi_string_printf(p, XTREME_ASSETS_PATH "/%s", pack);
+    char category[64];
+    furi_string_printf(p, XTREME_ASSETS_PATH "/%s/Icons", pack);
     if(storage_common_stat(storage, furi_string_get_cstr(p), &info) == FSE_OK &&
        info.flags & FSF_DIRECTORY) {
-        File* f = storage_file_alloc(storage);
-
+        File* dir = storage_file_alloc(storage);
+        File* sub_dir = storage_file_alloc(storage);
+        uint32_t* hashes = malloc(sizeof(uint32_t) * ICON_PATHS_COUNT);
+        bool* marks = malloc(sizeof(bool) * ICON_PATHS_COUNT);
         for(size_t i = 0; i < ICON_PATHS_COUNT; i++) {
-            if(ICON_PATHS[i].icon->original == NULL) {
-                if(ICON_PATHS[i].animated) {
-                    load_icon_animated(ICON_PATHS[i].icon, ICON_PATHS[i].path, p, f);
-                } else {
-                    load_icon_static(ICON_PATHS[i].icon, ICON_PATHS[i].path, p, f);
-                }
+            hashes[i] = icon_path_hash(ICON_PATHS[i].path);
+        }
+
+        /* Only list directories at boot, files are read when icon is used */
+        if(storage_dir_open(dir, furi_string_get_cstr(p))) {
+            while(storage_dir_read(dir, &info, category, sizeof(category))) {
+                if(!(info.flags & FSF_DIRECTORY)) continue;
+                furi_string_printf(sub, "%s/%s", furi_string_get_cstr(p), category);
+                icon_index_mark_dir(sub_dir, furi_string_get_cstr(sub), category, hashes, marks);
             }
         }
+        storage_dir_close(dir);
 
-        storage_file_free(f);
+        size_t count = 0;
+        for(size_t i = 0; i < ICON_PATHS_COUNT; i++) {
+            if(marks[i] && ICON_PATHS[i].icon->original == NULL) count++;
+        }
+        IconIndex* index = malloc(sizeof(IconIndex) + sizeof(IconSlot) * count);
+        index->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        for(size_t i = 0; i < ICON_PATHS_COUNT; i++) {
+            if(!marks[i] || ICON_PATHS[i].icon->original != NULL) continue;
+            IconSlot* slot = &index->slots[index->count++];
+            slot->path = &ICON_PATHS[i];
+            slot->state = IconSlotPending;
+            memcpy(&slot->original, ICON_PATHS[i].icon, sizeof(Icon));
+            FURI_CONST_ASSIGN_PTR(ICON_PATHS[i].icon->original, (Icon*)slot);
+        }
+        icon_index = index;
+        FURI_LOG_I(TAG, "%zu icons replaced", count);
+
+        free(marks);
+        free(hashes);
+        storage_file_free(sub_dir);
+        storage_file_free(dir);
     }
+    furi_string_free(sub);
     furi_string_free(p);
     furi_record_close(RECORD_STORAGE);
 }
 
 void XTREME_ASSETS_FREE() {
-    for(size_t i = 0; i < ICON_PATHS_COUNT; i++) {
-        if(ICON_PATHS[i].icon->original != NULL) {
-            free_icon(ICON_PATHS[i].icon);
+    IconIndex* index = icon_index;
+    if(!index) return;
+    icon_index = NULL;
+
+    for(size_t i = 0; i < index->count; i++) {
+        IconSlot* slot = &index->slots[i];
+        if(slot->state == IconSlotLoaded) {
+            free_icon(slot->path->icon);
+        } else {
+            memcpy((void*)slot->path->icon, &slot->original, sizeof(Icon));
         }
     }
+    furi_mutex_free(index->mutex);
+    free(index);
 }
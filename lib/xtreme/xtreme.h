@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <gui/icon.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -96,6 +97,8 @@ extern XtremeSettings xtreme_settings;
 
 void XTREME_ASSETS_LOAD();
 void XTREME_ASSETS_FREE();
+/** Load asset pack replacement of icon if it wasn't loaded yet, called by GUI on icon use */
+void XTREME_ASSETS_USE(const Icon* icon);
 
 #ifdef __cplusplus
 }
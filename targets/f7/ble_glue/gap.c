@@ -13,6 +13,10 @@
 
 #define GAP_INTERVAL_TO_MS(x) (uint16_t)((x)*1.25)
 
+// LE Data Length Extension maximum, so full MTU packet takes a few link layer PDUs instead of many
+#define GAP_DATA_LENGTH_TX_OCTETS 251
+#define GAP_DATA_LENGTH_TX_TIME 2120
+
 typedef struct {
     uint16_t gap_svc_handle;
     uint16_t dev_name_char_handle;
@@ -149,6 +153,14 @@ SVCCTL_UserEvtFlowStatus_t SVCCTL_App_Notification(void* pckt) {
             break;
         }
 
+        case HCI_LE_DATA_LENGTH_CHANGE_SUBEVT_CODE: {
+            hci_le_data_length_change_event_rp0* event =
+                (hci_le_data_length_change_event_rp0*)meta_evt->data;
+            FURI_LOG_I(
+                TAG, "Data length TX = %d, RX = %d", event->MaxTxOctets, event->MaxRxOctets);
+            break;
+        }
+
         case HCI_LE_PHY_UPDATE_COMPLETE_SUBEVT_CODE:
             evt_le_phy_update_complete = (hci_le_phy_update_complete_event_rp0*)meta_evt->data;
             if(evt_le_phy_update_complete->Status) {
@@ -181,6 +193,17 @@ SVCCTL_UserEvtFlowStatus_t SVCCTL_App_Notification(void* pckt) {
 
             gap_verify_connection_parameters(gap);
 
+            // Use longest link layer packets and largest MTU peer supports
+            ret = hci_le_set_data_length(
+                event->Connection_Handle, GAP_DATA_LENGTH_TX_OCTETS, GAP_DATA_LENGTH_TX_TIME);
+            if(ret) {
+                FURI_LOG_W(TAG, "Set data length failed, status: %d", ret);
+            }
+            ret = aci_gatt_exchange_config(event->Connection_Handle);
+            if(ret) {
+                FURI_LOG_W(TAG, "MTU exchange failed, status: %d", ret);
+            }
+
             // Save rssi for current connection
             fetch_rssi();
             // Start pairing by sending security request
@@ -368,6 +391,8 @@ static void gap_init_svc(Gap* gap) {
     }
     // Set default PHY
     hci_le_set_default_phy(ALL_PHYS_PREFERENCE, TX_2M_PREFERRED, RX_2M_PREFERRED);
+    // Set default data length for new connections
+    hci_le_write_suggested_default_data_length(GAP_DATA_LENGTH_TX_OCTETS, GAP_DATA_LENGTH_TX_TIME);
     // Set I/O capability
     bool keypress_supported = false;
     // New things below
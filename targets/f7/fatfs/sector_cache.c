@@ -7,17 +7,118 @@
 #include <furi_hal_memory.h>
 
 #define SECTOR_SIZE 512
-#define N_SECTORS 8
+
+/* Sectors are mapped to sets by number, so consecutive FAT and directory sectors spread out */
+#ifndef SECTOR_CACHE_SETS
+#define SECTOR_CACHE_SETS 2
+#endif
+
+/* Sectors of a set are replaced in least recently used order */
+#ifndef SECTOR_CACHE_WAYS
+#define SECTOR_CACHE_WAYS 4
+#endif
+
+/* Keep single sector writes in cache until sync or eviction */
+#ifndef SECTOR_CACHE_WRITE_BACK
+#define SECTOR_CACHE_WRITE_BACK 1
+#endif
 
 typedef struct {
-    uint32_t itr;
-    uint32_t sectors[N_SECTORS];
-    uint8_t sector_data[N_SECTORS][SECTOR_SIZE];
+    uint32_t sector; /* 0 if line is empty, sector 0 is never cached */
+    uint32_t last_used;
+    bool dirty;
+} SectorCacheLine;
+
+typedef struct {
+    uint32_t clock;
+    SectorCacheLine lines[SECTOR_CACHE_SETS][SECTOR_CACHE_WAYS];
+    uint8_t sector_data[SECTOR_CACHE_SETS][SECTOR_CACHE_WAYS][SECTOR_SIZE];
 } SectorCache;
 
 static SectorCache* cache = NULL;
+static SectorCacheWriteCallback cache_write_callback = NULL;
+
+static inline size_t sector_cache_get_set(uint32_t n_sector) {
+    return n_sector % SECTOR_CACHE_SETS;
+}
+
+static int sector_cache_find(size_t set, uint32_t n_sector) {
+    for(int way = 0; way < SECTOR_CACHE_WAYS; ++way) {
+        if(cache->lines[set][way].sector == n_sector) {
+            return way;
+        }
+    }
+    return -1;
+}
+
+static inline void sector_cache_touch(SectorCacheLine* line) {
+    line->last_used = cache->clock++;
+}
+
+static bool sector_cache_write_line(size_t set, size_t way) {
+    SectorCacheLine* line = &cache->lines[set][way];
+
+    if(line->dirty) {
+        if(!cache_write_callback(line->sector, cache->sector_data[set][way])) {
+            return false;
+        }
+        line->dirty = false;
+    }
+
+    return true;
+}
+
+/* Find a line to reuse, dirty one is written first. Returns -1 if writing it has failed. */
+static int sector_cache_evict(size_t set) {
+    int victim = 0;
+    uint32_t victim_age = 0;
+
+    for(int way = 0; way < SECTOR_CACHE_WAYS; ++way) {
+        const SectorCacheLine* line = &cache->lines[set][way];
+        if(line->sector == 0) {
+            return way;
+        }
+
+        const uint32_t age = cache->clock - line->last_used;
+        if(age >= victim_age) {
+            victim = way;
+            victim_age = age;
+        }
+    }
 
-void sector_cache_init() {
+    if(!sector_cache_write_line(set, victim)) {
+        return -1;
+    }
+
+    cache->lines[set][victim].sector = 0;
+    return victim;
+}
+
+static bool sector_cache_store(uint32_t n_sector, const uint8_t* data, bool dirty) {
+    const size_t set = sector_cache_get_set(n_sector);
+
+    int way = sector_cache_find(set, n_sector);
+    if(way >= 0 && !dirty) {
+        // Cached copy is as new as the card, or newer
+        sector_cache_touch(&cache->lines[set][way]);
+        return true;
+    } else if(way < 0) {
+        way = sector_cache_evict(set);
+        if(way < 0) {
+            return false;
+        }
+    }
+
+    SectorCacheLine* line = &cache->lines[set][way];
+    memcpy(cache->sector_data[set][way], data, SECTOR_SIZE);
+    line->sector = n_sector;
+    line->dirty |= dirty;
+    sector_cache_touch(line);
+
+    return true;
+}
+
+void sector_cache_init(SectorCacheWriteCallback write_callback) {
     if(cache == NULL) {
         cache = memmgr_alloc_from_pool(sizeof(SectorCache));
     }
@@ -25,32 +126,58 @@ void sector_cache_init() {
     if(cache != NULL) {
         memset(cache, 0, sizeof(SectorCache));
     }
+
+    cache_write_callback = write_callback;
 }
 
 uint8_t* sector_cache_get(uint32_t n_sector) {
     if(cache != NULL && n_sector != 0) {
-        for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-            if(cache->sectors[sector_i] == n_sector) {
-                return cache->sector_data[sector_i];
-            }
+        const size_t set = sector_cache_get_set(n_sector);
+        const int way = sector_cache_find(set, n_sector);
+        if(way >= 0) {
+            sector_cache_touch(&cache->lines[set][way]);
+            return cache->sector_data[set][way];
         }
     }
     return NULL;
 }
 
-void sector_cache_put(uint32_t n_sector, uint8_t* data) {
-    if(cache == NULL) return;
-    cache->sectors[cache->itr % N_SECTORS] = n_sector;
-    memcpy(cache->sector_data[cache->itr % N_SECTORS], data, SECTOR_SIZE);
-    cache->itr++;
+void sector_cache_put(uint32_t n_sector, const uint8_t* data) {
+    if(cache == NULL || n_sector == 0) return;
+    sector_cache_store(n_sector, data, false);
+}
+
+bool sector_cache_write(uint32_t n_sector, const uint8_t* data) {
+    if(!SECTOR_CACHE_WRITE_BACK || cache == NULL || cache_write_callback == NULL ||
+       n_sector == 0) {
+        return false;
+    }
+    return sector_cache_store(n_sector, data, true);
+}
+
+bool sector_cache_flush() {
+    if(cache == NULL) return true;
+
+    bool result = true;
+    for(size_t set = 0; set < SECTOR_CACHE_SETS; ++set) {
+        for(size_t way = 0; way < SECTOR_CACHE_WAYS; ++way) {
+            // Keep going, so one bad sector doesn't hold back the rest
+            result &= sector_cache_write_line(set, way);
+        }
+    }
+
+    return result;
 }
 
 void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
     if(cache == NULL) return;
-    for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-        if((cache->sectors[sector_i] >= start_sector) &&
-           (cache->sectors[sector_i] <= end_sector)) {
-            cache->sectors[sector_i] = 0;
+    for(size_t set = 0; set < SECTOR_CACHE_SETS; ++set) {
+        for(size_t way = 0; way < SECTOR_CACHE_WAYS; ++way) {
+            SectorCacheLine* line = &cache->lines[set][way];
+            if((line->sector >= start_sector) && (line->sector <= end_sector)) {
+                line->sector = 0;
+                line->dirty = false;
+            }
         }
     }
-}
\ No newline at end of file
+}
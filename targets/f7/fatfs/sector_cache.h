@@ -1,14 +1,24 @@
 #pragma once
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /**
- * @brief Init sector cache system
+ * @brief Sector write callback, used to write back modified sectors
+ * @param n_sector Sector number
+ * @param data Pointer to sector data
+ * @return true on success
+ */
+typedef bool (*SectorCacheWriteCallback)(uint32_t n_sector, const uint8_t* data);
+
+/**
+ * @brief Init sector cache system, drops all cached sectors including modified ones
+ * @param write_callback Callback to write back modified sectors, NULL to disable write-back
  */
-void sector_cache_init();
+void sector_cache_init(SectorCacheWriteCallback write_callback);
 
 /**
  * @brief Get sector data from cache
@@ -20,12 +30,26 @@ uint8_t* sector_cache_get(uint32_t n_sector);
 /**
  * @brief Put sector data to cache
  * @param n_sector Sector number
+ * @param data Pointer to sector data, same as on the card
+ */
+void sector_cache_put(uint32_t n_sector, const uint8_t* data);
+
+/**
+ * @brief Write sector data to cache, to be written back later
+ * @param n_sector Sector number
  * @param data Pointer to sector data
+ * @return true if sector is cached, false if it has to be written to the card right away
+ */
+bool sector_cache_write(uint32_t n_sector, const uint8_t* data);
+
+/**
+ * @brief Write back all modified sectors
+ * @return true on success, false if some sectors failed to be written and are kept
  */
-void sector_cache_put(uint32_t n_sector, uint8_t* data);
+bool sector_cache_flush();
 
 /**
- * @brief Invalidate sector cache for given range
+ * @brief Invalidate sector cache for given range, modified sectors are dropped
  * @param start_sector Start sector number
  * @param end_sector End sector number
  */
@@ -2,6 +2,7 @@
 #include <furi_hal_version.h>
 #include <furi_hal_power.h>
 #include <furi_hal_cortex.h>
+#include <furi_hal_interrupt.h>
 
 #include <stm32wbxx_ll_i2c.h>
 #include <stm32wbxx_ll_gpio.h>
@@ -9,6 +10,186 @@
 
 #define TAG "FuriHalI2c"
 
+#define FURI_HAL_I2C_CHUNK_MAX 255U
+
+#define FURI_HAL_I2C_QUEUE_IT \
+    (I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_NACKIE | I2C_CR1_STOPIE | I2C_CR1_TCIE | I2C_CR1_ERRIE)
+
+/** Interrupt driven transaction queue of the bus */
+typedef struct {
+    FuriHalI2cBus* bus;
+    FuriHalInterruptId irq_event;
+    FuriHalInterruptId irq_error;
+    FuriSemaphore* drained;
+
+    FuriHalI2cTransaction* head;
+    FuriHalI2cTransaction* tail;
+
+    uint8_t* data;
+    size_t remaining;
+    bool rx;
+    bool failed;
+} FuriHalI2cQueue;
+
+static FuriHalI2cQueue furi_hal_i2c_queue[] = {
+    {
+        .bus = &furi_hal_i2c_bus_power,
+        .irq_event = FuriHalInterruptIdI2c1Ev,
+        .irq_error = FuriHalInterruptIdI2c1Er,
+    },
+    {
+        .bus = &furi_hal_i2c_bus_external,
+        .irq_event = FuriHalInterruptIdI2c3Ev,
+        .irq_error = FuriHalInterruptIdI2c3Er,
+    },
+};
+
+static FuriHalI2cQueue* furi_hal_i2c_get_queue(FuriHalI2cBus* bus) {
+    for(size_t i = 0; i < COUNT_OF(furi_hal_i2c_queue); i++) {
+        if(furi_hal_i2c_queue[i].bus == bus) return &furi_hal_i2c_queue[i];
+    }
+    furi_crash("Unknown I2C bus");
+}
+
+static void furi_hal_i2c_queue_start_chunk(FuriHalI2cQueue* queue, uint32_t start_signal) {
+    uint32_t chunk = MIN(queue->remaining, (size_t)FURI_HAL_I2C_CHUNK_MAX);
+    uint32_t end_signal = queue->remaining > FURI_HAL_I2C_CHUNK_MAX ? LL_I2C_MODE_RELOAD :
+                                                                      LL_I2C_MODE_AUTOEND;
+
+    LL_I2C_HandleTransfer(
+        queue->bus->i2c,
+        queue->head->address,
+        LL_I2C_ADDRSLAVE_7BIT,
+        chunk,
+        end_signal,
+        start_signal);
+}
+
+static void furi_hal_i2c_queue_start_phase(FuriHalI2cQueue* queue, bool rx) {
+    FuriHalI2cTransaction* transaction = queue->head;
+
+    queue->rx = rx;
+    queue->failed = false;
+    queue->data = rx ? transaction->rx_data : (uint8_t*)transaction->tx_data;
+    queue->remaining = rx ? transaction->rx_size : transaction->tx_size;
+
+    furi_hal_i2c_queue_start_chunk(
+        queue, rx ? LL_I2C_GENERATE_START_READ : LL_I2C_GENERATE_START_WRITE);
+}
+
+static void furi_hal_i2c_queue_start_next(FuriHalI2cQueue* queue) {
+    FuriHalI2cTransaction* transaction = queue->head;
+
+    if(transaction) {
+        bool rx = transaction->tx_size == 0 && transaction->rx_size > 0;
+        furi_hal_i2c_queue_start_phase(queue, rx);
+    } else {
+        CLEAR_BIT(queue->bus->i2c->CR1, FURI_HAL_I2C_QUEUE_IT);
+        furi_semaphore_release(queue->drained);
+    }
+}
+
+static void furi_hal_i2c_queue_complete(FuriHalI2cQueue* queue, bool result) {
+    FuriHalI2cTransaction* transaction = queue->head;
+
+    queue->head = transaction->next;
+    if(!queue->head) queue->tail = NULL;
+
+    transaction->result = result;
+    if(transaction->callback) transaction->callback(transaction, transaction->context);
+
+    furi_hal_i2c_queue_start_next(queue);
+}
+
+static void furi_hal_i2c_reset_controller(I2C_TypeDef* i2c) {
+    // PE must stay low for at least 3 APB cycles
+    LL_I2C_Disable(i2c);
+    while(LL_I2C_IsEnabled(i2c))
+        ;
+    for(size_t i = 0; i < 3; i++) {
+        (void)i2c->CR1;
+    }
+    LL_I2C_Enable(i2c);
+}
+
+static void furi_hal_i2c_queue_event_isr(void* context) {
+    FuriHalI2cQueue* queue = context;
+    I2C_TypeDef* i2c = queue->bus->i2c;
+    uint32_t isr = i2c->ISR;
+
+    if(isr & I2C_ISR_NACKF) {
+        LL_I2C_ClearFlag_NACK(i2c);
+        queue->failed = true;
+        // STOP is only automatic in autoend mode
+        if(!(i2c->CR2 & I2C_CR2_AUTOEND)) LL_I2C_GenerateStopCondition(i2c);
+    }
+
+    if(isr & I2C_ISR_RXNE) {
+        uint8_t data = LL_I2C_ReceiveData8(i2c);
+        if(queue->remaining) {
+            *queue->data++ = data;
+            queue->remaining--;
+        }
+    }
+
+    if((isr & I2C_ISR_TXIS) && queue->remaining) {
+        LL_I2C_TransmitData8(i2c, *queue->data++);
+        queue->remaining--;
+    }
+
+    if((isr & I2C_ISR_TCR) && !queue->failed) {
+        furi_hal_i2c_queue_start_chunk(queue, LL_I2C_GENERATE_NOSTARTSTOP);
+    }
+
+    if(isr & I2C_ISR_STOPF) {
+        LL_I2C_ClearFlag_STOP(i2c);
+        // Drop byte left in TXDR after NACK
+        LL_I2C_ClearFlag_TXE(i2c);
+
+        bool result = !queue->failed && queue->remaining == 0;
+        if(result && !queue->rx && queue->head->rx_size > 0) {
+            furi_hal_i2c_queue_start_phase(queue, true);
+        } else {
+            furi_hal_i2c_queue_complete(queue, result);
+        }
+    }
+}
+
+static void furi_hal_i2c_queue_error_isr(void* context) {
+    FuriHalI2cQueue* queue = context;
+    I2C_TypeDef* i2c = queue->bus->i2c;
+
+    LL_I2C_ClearFlag_BERR(i2c);
+    LL_I2C_ClearFlag_ARLO(i2c);
+    LL_I2C_ClearFlag_OVR(i2c);
+
+    // Bus error or lost arbitration, no STOP will follow
+    furi_hal_i2c_reset_controller(i2c);
+    if(queue->head) furi_hal_i2c_queue_complete(queue, false);
+}
+
+static void furi_hal_i2c_queue_abort(FuriHalI2cQueue* queue) {
+    FURI_CRITICAL_ENTER();
+    FuriHalI2cTransaction* transaction = queue->head;
+    queue->head = NULL;
+    queue->tail = NULL;
+    CLEAR_BIT(queue->bus->i2c->CR1, FURI_HAL_I2C_QUEUE_IT);
+    furi_hal_i2c_reset_controller(queue->bus->i2c);
+    FURI_CRITICAL_EXIT();
+
+    while(transaction) {
+        FuriHalI2cTransaction* next = transaction->next;
+        transaction->result = false;
+        if(transaction->callback) transaction->callback(transaction, transaction->context);
+        transaction = next;
+    }
+}
+
+/** Blocking transfers can sleep on queue only with scheduler running and interrupts enabled */
+static bool furi_hal_i2c_queue_can_wait(FuriHalI2cQueue* queue) {
+    return queue->drained && furi_kernel_is_running() && !furi_kernel_is_irq_or_masked();
+}
+
 void furi_hal_i2c_init_early() {
     furi_hal_i2c_bus_power.callback(&furi_hal_i2c_bus_power, FuriHalI2cBusEventInit);
 }
@@ -19,6 +200,9 @@ void furi_hal_i2c_deinit_early() {
 
 void furi_hal_i2c_init() {
     furi_hal_i2c_bus_external.callback(&furi_hal_i2c_bus_external, FuriHalI2cBusEventInit);
+    for(size_t i = 0; i < COUNT_OF(furi_hal_i2c_queue); i++) {
+        furi_hal_i2c_queue[i].drained = furi_semaphore_alloc(1, 0);
+    }
     FURI_LOG_I(TAG, "Init OK");
 }
 
@@ -34,11 +218,27 @@ void furi_hal_i2c_acquire(FuriHalI2cBusHandle* handle) {
     handle->bus->callback(handle->bus, FuriHalI2cBusEventActivate);
     // Activate handle
     handle->callback(handle, FuriHalI2cBusHandleEventActivate);
+    // Queue interrupts, only enabled in controller while transactions are pending
+    FuriHalI2cQueue* queue = furi_hal_i2c_get_queue(handle->bus);
+    if(queue->drained) {
+        furi_hal_interrupt_set_isr(queue->irq_event, furi_hal_i2c_queue_event_isr, queue);
+        furi_hal_interrupt_set_isr(queue->irq_error, furi_hal_i2c_queue_error_isr, queue);
+    }
 }
 
 void furi_hal_i2c_release(FuriHalI2cBusHandle* handle) {
     // Ensure that current handle is our handle
     furi_check(handle->bus->current_handle == handle);
+    // Drop what is left in queue
+    FuriHalI2cQueue* queue = furi_hal_i2c_get_queue(handle->bus);
+    if(queue->head) {
+        FURI_LOG_W(TAG, "Released with pending transactions");
+        furi_hal_i2c_queue_abort(queue);
+    }
+    if(queue->drained) {
+        furi_hal_interrupt_set_isr(queue->irq_event, NULL, NULL);
+        furi_hal_interrupt_set_isr(queue->irq_error, NULL, NULL);
+    }
     // Deactivate handle
     handle->callback(handle, FuriHalI2cBusHandleEventDeactivate);
     // Deactivate bus
@@ -50,6 +250,59 @@ void furi_hal_i2c_release(FuriHalI2cBusHandle* handle) {
     furi_hal_power_insomnia_exit();
 }
 
+void furi_hal_i2c_transaction_submit(
+    FuriHalI2cBusHandle* handle,
+    FuriHalI2cTransaction* transaction) {
+    furi_check(handle->bus->current_handle == handle);
+    furi_check(transaction);
+    FuriHalI2cQueue* queue = furi_hal_i2c_get_queue(handle->bus);
+    furi_check(queue->drained);
+
+    transaction->next = NULL;
+    transaction->result = false;
+
+    FURI_CRITICAL_ENTER();
+    if(queue->head) {
+        queue->tail->next = transaction;
+        queue->tail = transaction;
+    } else {
+        queue->head = transaction;
+        queue->tail = transaction;
+        SET_BIT(queue->bus->i2c->CR1, FURI_HAL_I2C_QUEUE_IT);
+        furi_hal_i2c_queue_start_next(queue);
+    }
+    FURI_CRITICAL_EXIT();
+}
+
+bool furi_hal_i2c_transaction_flush(FuriHalI2cBusHandle* handle, uint32_t timeout) {
+    furi_check(handle->bus->current_handle == handle);
+    FuriHalI2cQueue* queue = furi_hal_i2c_get_queue(handle->bus);
+
+    uint32_t timeout_ticks = furi_ms_to_ticks(timeout);
+    uint32_t start = furi_get_tick();
+    // Semaphore may hold stale token from earlier drain, so check queue itself
+    while(queue->head) {
+        uint32_t elapsed = furi_get_tick() - start;
+        if(elapsed >= timeout_ticks ||
+           furi_semaphore_acquire(queue->drained, timeout_ticks - elapsed) != FuriStatusOk) {
+            if(!queue->head) break;
+            FURI_LOG_E(TAG, "Transaction timeout");
+            furi_hal_i2c_queue_abort(queue);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool furi_hal_i2c_transaction_wait(
+    FuriHalI2cBusHandle* handle,
+    FuriHalI2cTransaction* transaction,
+    uint32_t timeout) {
+    furi_hal_i2c_transaction_submit(handle, transaction);
+    return furi_hal_i2c_transaction_flush(handle, timeout) && transaction->result;
+}
+
 static bool
     furi_hal_i2c_wait_for_idle(I2C_TypeDef* i2c, FuriHalI2cBegin begin, FuriHalCortexTimer timer) {
     do {
@@ -205,6 +458,7 @@ bool furi_hal_i2c_rx_ext(
     FuriHalI2cEnd end,
     uint32_t timeout) {
     furi_check(handle->bus->current_handle == handle);
+    furi_check(!furi_hal_i2c_get_queue(handle->bus)->head);
 
     FuriHalCortexTimer timer = furi_hal_cortex_timer_get(timeout * 1000);
 
@@ -222,6 +476,7 @@ bool furi_hal_i2c_tx_ext(
     FuriHalI2cEnd end,
     uint32_t timeout) {
     furi_check(handle->bus->current_handle == handle);
+    furi_check(!furi_hal_i2c_get_queue(handle->bus)->head);
 
     FuriHalCortexTimer timer = furi_hal_cortex_timer_get(timeout * 1000);
 
@@ -237,6 +492,15 @@ bool furi_hal_i2c_tx(
     uint32_t timeout) {
     furi_assert(timeout > 0);
 
+    if(furi_hal_i2c_queue_can_wait(furi_hal_i2c_get_queue(handle->bus))) {
+        FuriHalI2cTransaction transaction = {
+            .address = address,
+            .tx_data = data,
+            .tx_size = size,
+        };
+        return furi_hal_i2c_transaction_wait(handle, &transaction, timeout);
+    }
+
     return furi_hal_i2c_tx_ext(
         handle, address, false, data, size, FuriHalI2cBeginStart, FuriHalI2cEndStop, timeout);
 }
@@ -249,6 +513,15 @@ bool furi_hal_i2c_rx(
     uint32_t timeout) {
     furi_assert(timeout > 0);
 
+    if(furi_hal_i2c_queue_can_wait(furi_hal_i2c_get_queue(handle->bus))) {
+        FuriHalI2cTransaction transaction = {
+            .address = address,
+            .rx_data = data,
+            .rx_size = size,
+        };
+        return furi_hal_i2c_transaction_wait(handle, &transaction, timeout);
+    }
+
     return furi_hal_i2c_rx_ext(
         handle, address, false, data, size, FuriHalI2cBeginStart, FuriHalI2cEndStop, timeout);
 }
@@ -261,6 +534,18 @@ bool furi_hal_i2c_trx(
     uint8_t* rx_data,
     size_t rx_size,
     uint32_t timeout) {
+    if(furi_hal_i2c_queue_can_wait(furi_hal_i2c_get_queue(handle->bus))) {
+        FuriHalI2cTransaction transaction = {
+            .address = address,
+            .tx_data = tx_data,
+            .tx_size = tx_size,
+            .rx_data = rx_data,
+            .rx_size = rx_size,
+        };
+        // Same budget as two separate transfers
+        return furi_hal_i2c_transaction_wait(handle, &transaction, timeout * 2);
+    }
+
     return furi_hal_i2c_tx_ext(
                handle,
                address,
@@ -284,6 +569,7 @@ bool furi_hal_i2c_trx(
 bool furi_hal_i2c_is_device_ready(FuriHalI2cBusHandle* handle, uint8_t i2c_addr, uint32_t timeout) {
     furi_check(handle);
     furi_check(handle->bus->current_handle == handle);
+    furi_check(!furi_hal_i2c_get_queue(handle->bus)->head);
     furi_assert(timeout > 0);
 
     bool ret = true;
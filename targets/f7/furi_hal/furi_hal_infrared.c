@@ -10,7 +10,11 @@
 #include <math.h>
 
 #define INFRARED_TIM_TX_DMA_BUFFER_SIZE 200
+/* Captures of an edge pair (period, space) per record, must be even */
+#define INFRARED_TIM_RX_DMA_BUFFER_SIZE 256
 #define INFRARED_POLARITY_SHIFT 1
+/* Pre-rendered signal limit, fits the longest raw signal with its long timings split */
+#define INFRARED_TIM_TX_TABLE_MAX_SIZE 2048
 
 #define INFRARED_TX_CCMR_HIGH \
     (TIM_CCMR2_OC3PE | LL_TIM_OCMODE_PWM2) /* Mark time - enable PWM2 mode */
@@ -36,11 +40,21 @@
 #define INFRARED_RX_GPIO_ALT GpioAltFn1TIM2
 #define INFRARED_RX_IRQ FuriHalInterruptIdTIM2
 
+typedef struct {
+    uint32_t period; /** CCR1: rising edge to rising edge */
+    uint32_t space; /** CCR2: rising edge to falling edge */
+} InfraredRxDmaRecord;
+
 typedef struct {
     FuriHalInfraredRxCaptureCallback capture_callback;
     void* capture_context;
     FuriHalInfraredRxTimeoutCallback timeout_callback;
     void* timeout_context;
+    FuriHalInfraredRxDmaCallback dma_callback;
+    void* dma_context;
+    InfraredRxDmaRecord* dma_buffer; /** NULL in per-edge mode */
+    volatile uint32_t dma_laps; /** Completed passes over the circular buffer */
+    uint32_t dma_read_pos; /** Records read, counted from the start */
 } InfraredTimRx;
 
 typedef struct {
@@ -51,6 +65,22 @@ typedef struct {
     bool last_packet_end;
 } InfraredTxBuf;
 
+typedef struct {
+    size_t offset;
+    size_t size;
+    bool packet_end;
+    bool last_packet_end;
+} InfraredTxTableSegment;
+
+typedef struct {
+    uint8_t* polarity; /** Polarity shift, then one entry per data entry */
+    uint16_t* data; /** NULL if signal is not pre-rendered */
+    size_t size;
+    InfraredTxTableSegment* segments; /** Last one is the terminating buffer */
+    size_t segments_count;
+    size_t position; /** Next segment to pass to DMA */
+} InfraredTxTable;
+
 typedef struct {
     float cycle_duration;
     FuriHalInfraredTxGetDataISRCallback data_callback;
@@ -58,6 +88,7 @@ typedef struct {
     void* data_context;
     void* signal_sent_context;
     InfraredTxBuf buffer[2];
+    InfraredTxTable table;
     FuriSemaphore* stop_semaphore;
     uint32_t
         tx_timing_rest_duration; /** if timing is too long (> 0xFFFF), send it in few iterations */
@@ -80,11 +111,13 @@ static InfraredTimTx infrared_tim_tx;
 static InfraredTimRx infrared_tim_rx;
 static bool infrared_external_output;
 
-static void furi_hal_infrared_tx_fill_buffer(uint8_t buf_num, uint8_t polarity_shift);
+static void furi_hal_infrared_tx_fill_buffer(InfraredTxBuf* buffer, uint8_t polarity_shift);
 static void furi_hal_infrared_async_tx_free_resources(void);
 static void furi_hal_infrared_tx_dma_set_polarity(uint8_t buf_num, uint8_t polarity_shift);
 static void furi_hal_infrared_tx_dma_set_buffer(uint8_t buf_num);
-static void furi_hal_infrared_tx_fill_buffer_last(uint8_t buf_num);
+static void furi_hal_infrared_tx_fill_buffer_last(InfraredTxBuf* buffer);
+static void furi_hal_infrared_tx_next_buffer(uint8_t buf_num);
+static void furi_hal_infrared_tx_last_buffer(uint8_t buf_num);
 static uint8_t furi_hal_infrared_get_current_dma_tx_buffer(void);
 static void furi_hal_infrared_tx_dma_polarity_isr();
 static void furi_hal_infrared_tx_dma_isr();
@@ -112,11 +145,25 @@ static void furi_hal_infrared_tim_rx_isr() {
          * receiving new signal few microseconds ago, because CNT register
          * is reseted once per period, not per sample. */
         if(LL_GPIO_IsInputPinSet(gpio_infrared_rx.port, gpio_infrared_rx.pin) != 0) {
+            /* Arm first edge notification for the next signal */
+            if(infrared_tim_rx.dma_buffer) LL_TIM_EnableIT_CC2(INFRARED_RX_TIMER);
             if(infrared_tim_rx.timeout_callback)
                 infrared_tim_rx.timeout_callback(infrared_tim_rx.timeout_context);
         }
     }
 
+    /* First edge of a signal in DMA mode, captures are collected by DMA */
+    if(infrared_tim_rx.dma_buffer) {
+        if(LL_TIM_IsActiveFlag_CC2(INFRARED_RX_TIMER) &&
+           LL_TIM_IsEnabledIT_CC2(INFRARED_RX_TIMER)) {
+            LL_TIM_ClearFlag_CC2(INFRARED_RX_TIMER);
+            LL_TIM_DisableIT_CC2(INFRARED_RX_TIMER);
+            if(infrared_tim_rx.dma_callback)
+                infrared_tim_rx.dma_callback(infrared_tim_rx.dma_context);
+        }
+        return;
+    }
+
     /* Rising Edge */
     if(LL_TIM_IsActiveFlag_CC1(INFRARED_RX_TIMER)) {
         LL_TIM_ClearFlag_CC1(INFRARED_RX_TIMER);
@@ -149,9 +196,7 @@ static void furi_hal_infrared_tim_rx_isr() {
     }
 }
 
-void furi_hal_infrared_async_rx_start(void) {
-    furi_assert(furi_hal_infrared_state == InfraredStateIdle);
-
+static void furi_hal_infrared_async_rx_init(void) {
     furi_hal_gpio_init_ex(
         &gpio_infrared_rx,
         GpioModeAltFunctionPushPull,
@@ -188,6 +233,12 @@ void furi_hal_infrared_async_rx_start(void) {
 
     furi_hal_interrupt_set_isr(INFRARED_RX_IRQ, furi_hal_infrared_tim_rx_isr, NULL);
     furi_hal_infrared_state = InfraredStateAsyncRx;
+}
+
+void furi_hal_infrared_async_rx_start(void) {
+    furi_assert(furi_hal_infrared_state == InfraredStateIdle);
+
+    furi_hal_infrared_async_rx_init();
 
     LL_TIM_EnableIT_CC1(INFRARED_RX_TIMER);
     LL_TIM_EnableIT_CC2(INFRARED_RX_TIMER);
@@ -198,14 +249,138 @@ void furi_hal_infrared_async_rx_start(void) {
     LL_TIM_EnableCounter(INFRARED_RX_TIMER);
 }
 
+static void furi_hal_infrared_rx_dma_isr() {
+#if INFRARED_DMA_CH1_CHANNEL == LL_DMA_CHANNEL_1
+    if(LL_DMA_IsActiveFlag_TE1(INFRARED_DMA)) {
+        LL_DMA_ClearFlag_TE1(INFRARED_DMA);
+        furi_crash();
+    }
+    if(LL_DMA_IsActiveFlag_HT1(INFRARED_DMA)) {
+        LL_DMA_ClearFlag_HT1(INFRARED_DMA);
+    }
+    if(LL_DMA_IsActiveFlag_TC1(INFRARED_DMA)) {
+        LL_DMA_ClearFlag_TC1(INFRARED_DMA);
+        infrared_tim_rx.dma_laps++;
+    }
+#else
+#error Update this code. Would you kindly?
+#endif
+    if(infrared_tim_rx.dma_callback) infrared_tim_rx.dma_callback(infrared_tim_rx.dma_context);
+}
+
+void furi_hal_infrared_async_rx_dma_start(FuriHalInfraredRxDmaCallback callback, void* ctx) {
+    furi_assert(furi_hal_infrared_state == InfraredStateIdle);
+
+    infrared_tim_rx.dma_callback = callback;
+    infrared_tim_rx.dma_context = ctx;
+    infrared_tim_rx.dma_buffer =
+        malloc(sizeof(InfraredRxDmaRecord) * INFRARED_TIM_RX_DMA_BUFFER_SIZE);
+    infrared_tim_rx.dma_laps = 0;
+    infrared_tim_rx.dma_read_pos = 0;
+
+    furi_hal_infrared_async_rx_init();
+
+    /* Every rising edge bursts CCR1 and CCR2 into one record */
+    LL_DMA_InitTypeDef dma_config = {0};
+    dma_config.PeriphOrM2MSrcAddress = (uint32_t) & (INFRARED_RX_TIMER->DMAR);
+    dma_config.MemoryOrM2MDstAddress = (uint32_t)infrared_tim_rx.dma_buffer;
+    dma_config.Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY;
+    dma_config.Mode = LL_DMA_MODE_CIRCULAR;
+    dma_config.PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT;
+    dma_config.MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT;
+    dma_config.PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_WORD;
+    dma_config.MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_WORD;
+    dma_config.NbData = INFRARED_TIM_RX_DMA_BUFFER_SIZE * 2;
+    dma_config.PeriphRequest = LL_DMAMUX_REQ_TIM2_CH1;
+    dma_config.Priority = LL_DMA_PRIORITY_HIGH;
+    LL_DMA_Init(INFRARED_DMA_CH1_DEF, &dma_config);
+
+#if INFRARED_DMA_CH1_CHANNEL == LL_DMA_CHANNEL_1
+    LL_DMA_ClearFlag_TE1(INFRARED_DMA);
+    LL_DMA_ClearFlag_HT1(INFRARED_DMA);
+    LL_DMA_ClearFlag_TC1(INFRARED_DMA);
+#else
+#error Update this code. Would you kindly?
+#endif
+
+    LL_DMA_EnableIT_TE(INFRARED_DMA_CH1_DEF);
+    LL_DMA_EnableIT_HT(INFRARED_DMA_CH1_DEF);
+    LL_DMA_EnableIT_TC(INFRARED_DMA_CH1_DEF);
+    furi_hal_interrupt_set_isr_ex(INFRARED_DMA_CH1_IRQ, 5, furi_hal_infrared_rx_dma_isr, NULL);
+    LL_DMA_EnableChannel(INFRARED_DMA_CH1_DEF);
+
+    LL_TIM_ConfigDMABurst(
+        INFRARED_RX_TIMER, LL_TIM_DMABURST_BASEADDR_CCR1, LL_TIM_DMABURST_LENGTH_2TRANSFERS);
+    LL_TIM_EnableDMAReq_CC1(INFRARED_RX_TIMER);
+    LL_TIM_EnableIT_CC2(INFRARED_RX_TIMER);
+    LL_TIM_CC_EnableChannel(INFRARED_RX_TIMER, LL_TIM_CHANNEL_CH1);
+    LL_TIM_CC_EnableChannel(INFRARED_RX_TIMER, LL_TIM_CHANNEL_CH2);
+
+    LL_TIM_SetCounter(INFRARED_RX_TIMER, 0);
+    LL_TIM_EnableCounter(INFRARED_RX_TIMER);
+}
+
+size_t furi_hal_infrared_async_rx_dma_read(uint32_t* durations, size_t max_count, bool* overrun) {
+    furi_assert(furi_hal_infrared_state == InfraredStateAsyncRx);
+    furi_assert(infrared_tim_rx.dma_buffer);
+    furi_assert(durations);
+    furi_assert(overrun);
+
+    uint32_t laps, remaining;
+    FURI_CRITICAL_ENTER();
+    /* Pending transfer complete means laps counter is one behind the DMA */
+    bool tc_pending;
+    do {
+        tc_pending = LL_DMA_IsActiveFlag_TC1(INFRARED_DMA);
+        remaining = LL_DMA_GetDataLength(INFRARED_DMA_CH1_DEF);
+    } while(tc_pending != LL_DMA_IsActiveFlag_TC1(INFRARED_DMA));
+    laps = infrared_tim_rx.dma_laps + (tc_pending ? 1 : 0);
+    FURI_CRITICAL_EXIT();
+
+    /* Half-written record is left for the next read */
+    uint32_t write_pos = laps * INFRARED_TIM_RX_DMA_BUFFER_SIZE +
+                         (INFRARED_TIM_RX_DMA_BUFFER_SIZE * 2 - remaining) / 2;
+    uint32_t available = write_pos - infrared_tim_rx.dma_read_pos;
+
+    *overrun = (available > INFRARED_TIM_RX_DMA_BUFFER_SIZE);
+    if(*overrun) {
+        infrared_tim_rx.dma_read_pos = write_pos;
+        return 0;
+    }
+
+    size_t count = MIN(available, max_count / 2);
+    for(size_t i = 0; i < count; ++i) {
+        const InfraredRxDmaRecord* record =
+            &infrared_tim_rx
+                 .dma_buffer[(infrared_tim_rx.dma_read_pos + i) % INFRARED_TIM_RX_DMA_BUFFER_SIZE];
+        /* High pin level is a Space state, low is a Mark state of INFRARED signal */
+        durations[i * 2] = record->space;
+        durations[i * 2 + 1] = record->period - record->space;
+    }
+    infrared_tim_rx.dma_read_pos += count;
+
+    return count * 2;
+}
+
 void furi_hal_infrared_async_rx_stop(void) {
     furi_assert(furi_hal_infrared_state == InfraredStateAsyncRx);
 
     FURI_CRITICAL_ENTER();
     furi_hal_bus_disable(INFRARED_RX_TIMER_BUS);
     furi_hal_interrupt_set_isr(INFRARED_RX_IRQ, NULL, NULL);
+    if(infrared_tim_rx.dma_buffer) {
+        LL_DMA_DisableChannel(INFRARED_DMA_CH1_DEF);
+        furi_hal_interrupt_set_isr(INFRARED_DMA_CH1_IRQ, NULL, NULL);
+    }
     furi_hal_infrared_state = InfraredStateIdle;
     FURI_CRITICAL_EXIT();
+
+    if(infrared_tim_rx.dma_buffer) {
+        free(infrared_tim_rx.dma_buffer);
+        infrared_tim_rx.dma_buffer = NULL;
+        infrared_tim_rx.dma_callback = NULL;
+        infrared_tim_rx.dma_context = NULL;
+    }
 }
 
 void furi_hal_infrared_async_rx_set_timeout(uint32_t timeout_us) {
@@ -299,7 +474,7 @@ static void furi_hal_infrared_tx_dma_isr() {
         } else if(
             !infrared_tim_tx.buffer[buf_num].packet_end ||
             (furi_hal_infrared_state == InfraredStateAsyncTx)) {
-            furi_hal_infrared_tx_fill_buffer(next_buf_num, 0);
+            furi_hal_infrared_tx_next_buffer(next_buf_num);
             if(infrared_tim_tx.buffer[next_buf_num].last_packet_end) {
                 LL_DMA_DisableIT_HT(INFRARED_DMA_CH2_DEF);
             }
@@ -325,7 +500,7 @@ static void furi_hal_infrared_tx_dma_isr() {
             (infrared_tim_tx.buffer[buf_num].packet_end &&
              (furi_hal_infrared_state == InfraredStateAsyncTxStopReq))) {
             furi_hal_infrared_state = InfraredStateAsyncTxStopInProgress;
-            furi_hal_infrared_tx_fill_buffer_last(next_buf_num);
+            furi_hal_infrared_tx_last_buffer(next_buf_num);
             furi_hal_infrared_tx_dma_set_buffer(next_buf_num);
         } else {
             /* if it's not end of the packet - continue receiving */
@@ -444,32 +619,26 @@ static void furi_hal_infrared_configure_tim_rcr_dma_tx(void) {
     furi_hal_interrupt_set_isr_ex(INFRARED_DMA_CH2_IRQ, 5, furi_hal_infrared_tx_dma_isr, NULL);
 }
 
-static void furi_hal_infrared_tx_fill_buffer_last(uint8_t buf_num) {
-    furi_assert(buf_num < 2);
+static void furi_hal_infrared_tx_fill_buffer_last(InfraredTxBuf* buffer) {
     furi_assert(furi_hal_infrared_state != InfraredStateAsyncRx);
     furi_assert(furi_hal_infrared_state < InfraredStateMAX);
     furi_assert(infrared_tim_tx.data_callback);
-    InfraredTxBuf* buffer = &infrared_tim_tx.buffer[buf_num];
     furi_assert(buffer->data != NULL);
-    (void)buffer->data;
     furi_assert(buffer->polarity != NULL);
-    (void)buffer->polarity;
 
-    infrared_tim_tx.buffer[buf_num].data[0] = 0; // 1 pulse
-    infrared_tim_tx.buffer[buf_num].polarity[0] = INFRARED_TX_CCMR_LOW;
-    infrared_tim_tx.buffer[buf_num].data[1] = 0; // 1 pulse
-    infrared_tim_tx.buffer[buf_num].polarity[1] = INFRARED_TX_CCMR_LOW;
-    infrared_tim_tx.buffer[buf_num].size = 2;
-    infrared_tim_tx.buffer[buf_num].last_packet_end = true;
-    infrared_tim_tx.buffer[buf_num].packet_end = true;
+    buffer->data[0] = 0; // 1 pulse
+    buffer->polarity[0] = INFRARED_TX_CCMR_LOW;
+    buffer->data[1] = 0; // 1 pulse
+    buffer->polarity[1] = INFRARED_TX_CCMR_LOW;
+    buffer->size = 2;
+    buffer->last_packet_end = true;
+    buffer->packet_end = true;
 }
 
-static void furi_hal_infrared_tx_fill_buffer(uint8_t buf_num, uint8_t polarity_shift) {
-    furi_assert(buf_num < 2);
+static void furi_hal_infrared_tx_fill_buffer(InfraredTxBuf* buffer, uint8_t polarity_shift) {
     furi_assert(furi_hal_infrared_state != InfraredStateAsyncRx);
     furi_assert(furi_hal_infrared_state < InfraredStateMAX);
     furi_assert(infrared_tim_tx.data_callback);
-    InfraredTxBuf* buffer = &infrared_tim_tx.buffer[buf_num];
     furi_assert(buffer->data != NULL);
     furi_assert(buffer->polarity != NULL);
 
@@ -536,6 +705,100 @@ static void furi_hal_infrared_tx_fill_buffer(uint8_t buf_num, uint8_t polarity_s
     }
 }
 
+static bool furi_hal_infrared_tx_table_append(const InfraredTxBuf* buffer) {
+    InfraredTxTable* table = &infrared_tim_tx.table;
+    size_t size = table->size + buffer->size;
+    if(size > INFRARED_TIM_TX_TABLE_MAX_SIZE) return false;
+
+    table->data = realloc(table->data, size * sizeof(uint16_t)); //-V701
+    table->polarity = realloc(table->polarity, INFRARED_POLARITY_SHIFT + size); //-V701
+    size_t segments_size = (table->segments_count + 1) * sizeof(InfraredTxTableSegment);
+    table->segments = realloc(table->segments, segments_size); //-V701
+
+    memcpy(&table->data[table->size], buffer->data, buffer->size * sizeof(uint16_t));
+    memcpy(
+        &table->polarity[INFRARED_POLARITY_SHIFT + table->size], buffer->polarity, buffer->size);
+
+    InfraredTxTableSegment* segment = &table->segments[table->segments_count++];
+    segment->offset = table->size;
+    segment->size = buffer->size;
+    segment->packet_end = buffer->packet_end;
+    segment->last_packet_end = buffer->last_packet_end;
+    table->size = size;
+
+    return true;
+}
+
+static void furi_hal_infrared_tx_table_free(void) {
+    InfraredTxTable* table = &infrared_tim_tx.table;
+    free(table->data);
+    free(table->polarity);
+    free(table->segments);
+    memset(table, 0, sizeof(InfraredTxTable));
+}
+
+/* Converts the whole signal the same way DMA ISR does, buffer by buffer */
+static bool furi_hal_infrared_tx_table_render(void) {
+    InfraredTxBuf buffer = {
+        .data = malloc(INFRARED_TIM_TX_DMA_BUFFER_SIZE * sizeof(uint16_t)),
+        .polarity = malloc(INFRARED_TIM_TX_DMA_BUFFER_SIZE * sizeof(uint8_t)),
+    };
+
+    InfraredTxTable* table = &infrared_tim_tx.table;
+    table->polarity = malloc(INFRARED_POLARITY_SHIFT);
+    memset(table->polarity, INFRARED_TX_CCMR_LOW, INFRARED_POLARITY_SHIFT);
+
+    bool success;
+    do {
+        furi_hal_infrared_tx_fill_buffer(&buffer, 0);
+        success = furi_hal_infrared_tx_table_append(&buffer);
+    } while(success && !buffer.last_packet_end);
+
+    if(success) {
+        furi_hal_infrared_tx_fill_buffer_last(&buffer);
+        success = furi_hal_infrared_tx_table_append(&buffer);
+    }
+
+    free(buffer.data);
+    free(buffer.polarity);
+
+    if(!success) {
+        furi_hal_infrared_tx_table_free();
+    }
+
+    return success;
+}
+
+static void furi_hal_infrared_tx_table_set_buffer(uint8_t buf_num, size_t position) {
+    InfraredTxTable* table = &infrared_tim_tx.table;
+    furi_check(position < table->segments_count);
+    const InfraredTxTableSegment* segment = &table->segments[position];
+    InfraredTxBuf* buffer = &infrared_tim_tx.buffer[buf_num];
+
+    buffer->data = &table->data[segment->offset];
+    buffer->polarity = &table->polarity[INFRARED_POLARITY_SHIFT + segment->offset];
+    buffer->size = segment->size;
+    buffer->packet_end = segment->packet_end;
+    buffer->last_packet_end = segment->last_packet_end;
+    table->position = position + 1;
+}
+
+static void furi_hal_infrared_tx_next_buffer(uint8_t buf_num) {
+    if(infrared_tim_tx.table.data) {
+        furi_hal_infrared_tx_table_set_buffer(buf_num, infrared_tim_tx.table.position);
+    } else {
+        furi_hal_infrared_tx_fill_buffer(&infrared_tim_tx.buffer[buf_num], 0);
+    }
+}
+
+static void furi_hal_infrared_tx_last_buffer(uint8_t buf_num) {
+    if(infrared_tim_tx.table.data) {
+        furi_hal_infrared_tx_table_set_buffer(buf_num, infrared_tim_tx.table.segments_count - 1);
+    } else {
+        furi_hal_infrared_tx_fill_buffer_last(&infrared_tim_tx.buffer[buf_num]);
+    }
+}
+
 static void furi_hal_infrared_tx_dma_set_polarity(uint8_t buf_num, uint8_t polarity_shift) {
     furi_assert(buf_num < 2);
     furi_assert(furi_hal_infrared_state < InfraredStateMAX);
@@ -591,10 +854,15 @@ static void furi_hal_infrared_async_tx_free_resources(void) {
     furi_hal_bus_disable(INFRARED_DMA_TIMER_BUS);
 
     furi_semaphore_free(infrared_tim_tx.stop_semaphore);
-    free(infrared_tim_tx.buffer[0].data);
-    free(infrared_tim_tx.buffer[1].data);
-    free(infrared_tim_tx.buffer[0].polarity);
-    free(infrared_tim_tx.buffer[1].polarity);
+    if(infrared_tim_tx.table.data) {
+        /* Buffers point into the table */
+        furi_hal_infrared_tx_table_free();
+    } else {
+        free(infrared_tim_tx.buffer[0].data);
+        free(infrared_tim_tx.buffer[1].data);
+        free(infrared_tim_tx.buffer[0].polarity);
+        free(infrared_tim_tx.buffer[1].polarity);
+    }
 
     infrared_tim_tx.buffer[0].data = NULL;
     infrared_tim_tx.buffer[1].data = NULL;
@@ -602,7 +870,7 @@ static void furi_hal_infrared_async_tx_free_resources(void) {
     infrared_tim_tx.buffer[1].polarity = NULL;
 }
 
-void furi_hal_infrared_async_tx_start(uint32_t freq, float duty_cycle) {
+static void furi_hal_infrared_async_tx_check_start(uint32_t freq, float duty_cycle) {
     if((duty_cycle > 1) || (duty_cycle <= 0) || (freq > INFRARED_MAX_FREQUENCY) ||
        (freq < INFRARED_MIN_FREQUENCY) || (infrared_tim_tx.data_callback == NULL)) {
         furi_crash();
@@ -613,21 +881,14 @@ void furi_hal_infrared_async_tx_start(uint32_t freq, float duty_cycle) {
     furi_assert(infrared_tim_tx.buffer[1].data == NULL);
     furi_assert(infrared_tim_tx.buffer[0].polarity == NULL);
     furi_assert(infrared_tim_tx.buffer[1].polarity == NULL);
+    furi_assert(infrared_tim_tx.table.data == NULL);
 
-    size_t alloc_size_data = INFRARED_TIM_TX_DMA_BUFFER_SIZE * sizeof(uint16_t);
-    infrared_tim_tx.buffer[0].data = malloc(alloc_size_data);
-    infrared_tim_tx.buffer[1].data = malloc(alloc_size_data);
-
-    size_t alloc_size_polarity =
-        (INFRARED_TIM_TX_DMA_BUFFER_SIZE + INFRARED_POLARITY_SHIFT) * sizeof(uint8_t);
-    infrared_tim_tx.buffer[0].polarity = malloc(alloc_size_polarity);
-    infrared_tim_tx.buffer[1].polarity = malloc(alloc_size_polarity);
-
-    infrared_tim_tx.stop_semaphore = furi_semaphore_alloc(1, 0);
     infrared_tim_tx.cycle_duration = 1000000.0 / freq;
     infrared_tim_tx.tx_timing_rest_duration = 0;
+}
 
-    furi_hal_infrared_tx_fill_buffer(0, INFRARED_POLARITY_SHIFT);
+static void furi_hal_infrared_async_tx_run(uint32_t freq, float duty_cycle) {
+    infrared_tim_tx.stop_semaphore = furi_semaphore_alloc(1, 0);
 
     furi_hal_bus_enable(INFRARED_DMA_TIMER_BUS);
 
@@ -668,6 +929,35 @@ void furi_hal_infrared_async_tx_start(uint32_t freq, float duty_cycle) {
     FURI_CRITICAL_EXIT();
 }
 
+void furi_hal_infrared_async_tx_start(uint32_t freq, float duty_cycle) {
+    furi_hal_infrared_async_tx_check_start(freq, duty_cycle);
+
+    size_t alloc_size_data = INFRARED_TIM_TX_DMA_BUFFER_SIZE * sizeof(uint16_t);
+    infrared_tim_tx.buffer[0].data = malloc(alloc_size_data);
+    infrared_tim_tx.buffer[1].data = malloc(alloc_size_data);
+
+    size_t alloc_size_polarity =
+        (INFRARED_TIM_TX_DMA_BUFFER_SIZE + INFRARED_POLARITY_SHIFT) * sizeof(uint8_t);
+    infrared_tim_tx.buffer[0].polarity = malloc(alloc_size_polarity);
+    infrared_tim_tx.buffer[1].polarity = malloc(alloc_size_polarity);
+
+    furi_hal_infrared_tx_fill_buffer(&infrared_tim_tx.buffer[0], INFRARED_POLARITY_SHIFT);
+    furi_hal_infrared_async_tx_run(freq, duty_cycle);
+}
+
+bool furi_hal_infrared_async_tx_start_prerendered(uint32_t freq, float duty_cycle) {
+    furi_hal_infrared_async_tx_check_start(freq, duty_cycle);
+
+    if(!furi_hal_infrared_tx_table_render()) return false;
+
+    furi_hal_infrared_tx_table_set_buffer(0, 0);
+    /* First buffer is sent with polarity shift, which precedes it in the table */
+    infrared_tim_tx.buffer[0].polarity = infrared_tim_tx.table.polarity;
+    furi_hal_infrared_async_tx_run(freq, duty_cycle);
+
+    return true;
+}
+
 void furi_hal_infrared_async_tx_wait_termination(void) {
     furi_assert(furi_hal_infrared_state >= InfraredStateAsyncTx);
     furi_assert(furi_hal_infrared_state < InfraredStateMAX);
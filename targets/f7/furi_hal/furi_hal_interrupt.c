@@ -58,12 +58,20 @@ const IRQn_Type furi_hal_interrupt_irqn[FuriHalInterruptIdMax] = {
     // LPTIMx
     [FuriHalInterruptIdLpTim1] = LPTIM1_IRQn,
     [FuriHalInterruptIdLpTim2] = LPTIM2_IRQn,
+
+    // I2Cx
+    [FuriHalInterruptIdI2c1Ev] = I2C1_EV_IRQn,
+    [FuriHalInterruptIdI2c1Er] = I2C1_ER_IRQn,
+    [FuriHalInterruptIdI2c3Ev] = I2C3_EV_IRQn,
+    [FuriHalInterruptIdI2c3Er] = I2C3_ER_IRQn,
 };
 
 __attribute__((always_inline)) static inline void
     furi_hal_interrupt_call(FuriHalInterruptId index) {
     furi_check(furi_hal_interrupt_isr[index].isr);
+    furi_thread_stats_isr_enter();
     furi_hal_interrupt_isr[index].isr(furi_hal_interrupt_isr[index].context);
+    furi_thread_stats_isr_exit();
 }
 
 __attribute__((always_inline)) static inline void
@@ -328,3 +336,19 @@ void LPTIM1_IRQHandler() {
 void LPTIM2_IRQHandler() {
     furi_hal_interrupt_call(FuriHalInterruptIdLpTim2);
 }
+
+void I2C1_EV_IRQHandler() {
+    furi_hal_interrupt_call(FuriHalInterruptIdI2c1Ev);
+}
+
+void I2C1_ER_IRQHandler() {
+    furi_hal_interrupt_call(FuriHalInterruptIdI2c1Er);
+}
+
+void I2C3_EV_IRQHandler() {
+    furi_hal_interrupt_call(FuriHalInterruptIdI2c3Ev);
+}
+
+void I2C3_ER_IRQHandler() {
+    furi_hal_interrupt_call(FuriHalInterruptIdI2c3Er);
+}
@@ -49,6 +49,12 @@ typedef enum {
     FuriHalInterruptIdLpTim1,
     FuriHalInterruptIdLpTim2,
 
+    // I2Cx
+    FuriHalInterruptIdI2c1Ev,
+    FuriHalInterruptIdI2c1Er,
+    FuriHalInterruptIdI2c3Ev,
+    FuriHalInterruptIdI2c3Er,
+
     // Service value
     FuriHalInterruptIdMax,
 } FuriHalInterruptId;
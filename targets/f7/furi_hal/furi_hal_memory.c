@@ -4,19 +4,32 @@
 
 #define TAG "FuriHalMemory"
 
+#define FURI_HAL_MEMORY_TRANSIENT_ALIGNMENT 8U
+
 typedef enum {
     SRAM_A,
     SRAM_B,
     SRAM_MAX,
 } SRAM;
 
+/* Transient blocks tile the region end, down from transient_end to transient_start */
+typedef struct {
+    uint32_t size; // header included
+    uint32_t used;
+} FuriHalMemoryBlock;
+
+/* Permanent allocations grow up from start, transient area grows down to meet them */
 typedef struct {
     void* start;
     uint32_t size;
+    uint8_t* transient_start;
+    uint8_t* transient_end;
 } FuriHalMemoryRegion;
 
 typedef struct {
     FuriHalMemoryRegion region[SRAM_MAX];
+    size_t transient_used;
+    size_t transient_peak;
 } FuriHalMemory;
 
 static FuriHalMemory* furi_hal_memory = NULL;
@@ -59,6 +72,16 @@ void furi_hal_memory_init() {
     }
     memory->region[SRAM_B].size = sram2b_unprotected_size;
 
+    for(int i = 0; i < SRAM_MAX; i++) {
+        FuriHalMemoryRegion* region = &memory->region[i];
+        uintptr_t end = (uintptr_t)region->start + region->size;
+        end -= end % FURI_HAL_MEMORY_TRANSIENT_ALIGNMENT;
+        if(end < (uintptr_t)region->start) end = (uintptr_t)region->start;
+        region->size = end - (uintptr_t)region->start;
+        region->transient_start = (uint8_t*)end;
+        region->transient_end = (uint8_t*)end;
+    }
+
     FURI_LOG_I(
         TAG, "SRAM2A: 0x%p, %lu", memory->region[SRAM_A].start, memory->region[SRAM_A].size);
     FURI_LOG_I(
@@ -106,6 +129,118 @@ void* furi_hal_memory_alloc(size_t size) {
     return allocated_memory;
 }
 
+static void* furi_hal_memory_region_alloc_transient(FuriHalMemoryRegion* region, uint32_t size) {
+    // First fit among free blocks, merging free neighbours on the way
+    for(uint8_t* pointer = region->transient_start; pointer < region->transient_end;) {
+        FuriHalMemoryBlock* block = (FuriHalMemoryBlock*)pointer;
+        if(!block->used) {
+            for(uint8_t* next = pointer + block->size; next < region->transient_end;) {
+                FuriHalMemoryBlock* next_block = (FuriHalMemoryBlock*)next;
+                if(next_block->used) break;
+                block->size += next_block->size;
+                next += next_block->size;
+            }
+
+            if(block->size >= size) {
+                if(block->size - size >= sizeof(FuriHalMemoryBlock) * 2) {
+                    FuriHalMemoryBlock* rest = (FuriHalMemoryBlock*)(pointer + size);
+                    rest->size = block->size - size;
+                    rest->used = 0;
+                    block->size = size;
+                }
+                block->used = 1;
+                return block;
+            }
+        }
+        pointer += block->size;
+    }
+
+    // Grow transient area down into the free space
+    if(region->size >= size) {
+        region->transient_start -= size;
+        region->size -= size;
+        FuriHalMemoryBlock* block = (FuriHalMemoryBlock*)region->transient_start;
+        block->size = size;
+        block->used = 1;
+        return block;
+    }
+
+    return NULL;
+}
+
+void* furi_hal_memory_alloc_transient(size_t size) {
+    if(FURI_IS_IRQ_MODE()) {
+        furi_crash("memmgt in ISR");
+    }
+
+    if(furi_hal_memory == NULL || size == 0 || size >= UINT32_MAX / 2) {
+        return NULL;
+    }
+
+    size += sizeof(FuriHalMemoryBlock);
+    size += (FURI_HAL_MEMORY_TRANSIENT_ALIGNMENT - size % FURI_HAL_MEMORY_TRANSIENT_ALIGNMENT) %
+            FURI_HAL_MEMORY_TRANSIENT_ALIGNMENT;
+
+    FuriHalMemoryBlock* block = NULL;
+    FURI_CRITICAL_ENTER();
+    for(int i = 0; i < SRAM_MAX && !block; i++) {
+        block = furi_hal_memory_region_alloc_transient(&furi_hal_memory->region[i], size);
+    }
+    if(block) {
+        furi_hal_memory->transient_used += block->size;
+        if(furi_hal_memory->transient_used > furi_hal_memory->transient_peak) {
+            furi_hal_memory->transient_peak = furi_hal_memory->transient_used;
+        }
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(!block) return NULL;
+
+    void* data = (uint8_t*)block + sizeof(FuriHalMemoryBlock);
+    memset(data, 0, block->size - sizeof(FuriHalMemoryBlock));
+    return data;
+}
+
+bool furi_hal_memory_free_transient(void* data) {
+    if(furi_hal_memory == NULL || data == NULL) return false;
+
+    FuriHalMemoryRegion* region = NULL;
+    for(int i = 0; i < SRAM_MAX; i++) {
+        FuriHalMemoryRegion* candidate = &furi_hal_memory->region[i];
+        if((uint8_t*)data > candidate->transient_start &&
+           (uint8_t*)data < candidate->transient_end) {
+            region = candidate;
+            break;
+        }
+    }
+    if(!region) return false;
+
+    FURI_CRITICAL_ENTER();
+    FuriHalMemoryBlock* block = (FuriHalMemoryBlock*)((uint8_t*)data - sizeof(FuriHalMemoryBlock));
+    furi_check(block->used);
+    block->used = 0;
+    furi_hal_memory->transient_used -= block->size;
+
+    // Give free blocks at the bottom of transient area back to the free space
+    while(region->transient_start < region->transient_end) {
+        FuriHalMemoryBlock* bottom = (FuriHalMemoryBlock*)region->transient_start;
+        if(bottom->used) break;
+        region->transient_start += bottom->size;
+        region->size += bottom->size;
+    }
+    FURI_CRITICAL_EXIT();
+
+    return true;
+}
+
+size_t furi_hal_memory_get_transient_used() {
+    return furi_hal_memory ? furi_hal_memory->transient_used : 0;
+}
+
+size_t furi_hal_memory_get_transient_peak() {
+    return furi_hal_memory ? furi_hal_memory->transient_peak : 0;
+}
+
 size_t furi_hal_memory_get_free() {
     if(furi_hal_memory == NULL) return 0;
 
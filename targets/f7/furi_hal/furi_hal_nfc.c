@@ -503,6 +503,7 @@ FuriHalNfcError furi_hal_nfc_poller_tx_common(
 
     st25r3916_write_fifo(handle, tx_data, tx_bits);
     st25r3916_direct_cmd(handle, ST25R3916_CMD_TRANSMIT_WITHOUT_CRC);
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointTxStart, tx_bits);
 
     return err;
 }
@@ -516,6 +517,7 @@ FuriHalNfcError furi_hal_nfc_common_fifo_tx(
     st25r3916_direct_cmd(handle, ST25R3916_CMD_CLEAR_FIFO);
     st25r3916_write_fifo(handle, tx_data, tx_bits);
     st25r3916_direct_cmd(handle, ST25R3916_CMD_TRANSMIT_WITHOUT_CRC);
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointTxStart, tx_bits);
 
     return err;
 }
@@ -570,6 +572,7 @@ FuriHalNfcError furi_hal_nfc_common_fifo_rx(
     if(!st25r3916_read_fifo(handle, rx_data, rx_data_size, rx_bits)) {
         error = FuriHalNfcErrorBufferOverflow;
     }
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointFifoRead, *rx_bits);
 
     return error;
 }
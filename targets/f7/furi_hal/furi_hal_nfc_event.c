@@ -50,6 +50,7 @@ FuriHalNfcEvent furi_hal_nfc_wait_event_common(uint32_t timeout_ms) {
             furi_thread_flags_clear(FuriHalNfcEventInternalTypeIrq);
             FuriHalSpiBusHandle* handle = &furi_hal_spi_bus_handle_nfc;
             uint32_t irq = furi_hal_nfc_get_irq(handle);
+            FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointIrqRead, irq);
             if(irq & ST25R3916_IRQ_MASK_OSC) {
                 event |= FuriHalNfcEventOscOn;
             }
@@ -109,6 +110,7 @@ bool furi_hal_nfc_event_wait_for_specific_irq(
         furi_thread_flags_wait(FuriHalNfcEventInternalTypeIrq, FuriFlagWaitAny, timeout_ms);
     if(event_flag == FuriHalNfcEventInternalTypeIrq) {
         uint32_t irq = furi_hal_nfc_get_irq(handle);
+        FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointIrqRead, irq);
         irq_received = ((irq & mask) == mask);
         furi_thread_flags_clear(FuriHalNfcEventInternalTypeIrq);
     }
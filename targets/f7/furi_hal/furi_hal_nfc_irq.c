@@ -4,6 +4,7 @@
 #include <furi_hal_resources.h>
 
 static void furi_hal_nfc_int_callback() {
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointIrq, 0);
     furi_hal_nfc_event_set(FuriHalNfcEventInternalTypeIrq);
 }
 
@@ -292,6 +292,7 @@ FuriHalNfcError furi_hal_nfc_iso14443a_listener_tx_custom_parity(
     furi_hal_spi_bus_handle_deinit(&furi_hal_spi_bus_handle_nfc);
 
     // Send signal
+    FURI_HAL_NFC_TRACE_POINT(FuriHalNfcTracePointTxStart, tx_bits);
     iso14443_3a_signal_tx(iso14443_3a_signal, tx_data, tx_parity, tx_bits);
 
     // Exit transparent mode
@@ -400,6 +400,19 @@ static FuriHalNfcError furi_hal_nfc_iso15693_listener_tx(
     return error;
 }
 
+FuriHalNfcError
+    furi_hal_nfc_iso15693_listener_cache_frame(const uint8_t* tx_data, size_t tx_bits) {
+    furi_check(furi_hal_nfc_iso15693_listener);
+
+    iso15693_signal_cache_frame(
+        furi_hal_nfc_iso15693_listener->signal,
+        Iso15693SignalDataRateHi,
+        tx_data,
+        tx_bits / BITS_IN_BYTE);
+
+    return FuriHalNfcErrorNone;
+}
+
 FuriHalNfcError furi_hal_nfc_iso15693_listener_tx_sof() {
     iso15693_signal_tx_sof(furi_hal_nfc_iso15693_listener->signal, Iso15693SignalDataRateHi);
 
@@ -28,6 +28,8 @@ typedef struct {
     uint32_t prescaler;
     uint32_t freq_khz;
     FuriHalNfcEventInternalType event;
+    FuriHalNfcTracePoint trace_armed;
+    FuriHalNfcTracePoint trace_expired;
     FuriHalInterruptId irq_id;
     IRQn_Type irq_type;
 #ifdef FURI_HAL_NFC_TIMER_DEBUG
@@ -41,6 +43,8 @@ static const FuriHalNfcTimerConfig furi_hal_nfc_timers[FuriHalNfcTimerCount] = {
             .timer = TIM1,
             .bus = FuriHalBusTIM1,
             .event = FuriHalNfcEventInternalTypeTimerFwtExpired,
+            .trace_armed = FuriHalNfcTracePointFwtArmed,
+            .trace_expired = FuriHalNfcTracePointFwtExpired,
             .irq_id = FuriHalInterruptIdTim1UpTim16,
             .irq_type = TIM1_UP_TIM16_IRQn,
 #ifdef FURI_HAL_NFC_TIMER_DEBUG
@@ -52,6 +56,8 @@ static const FuriHalNfcTimerConfig furi_hal_nfc_timers[FuriHalNfcTimerCount] = {
             .timer = TIM17,
             .bus = FuriHalBusTIM17,
             .event = FuriHalNfcEventInternalTypeTimerBlockTxExpired,
+            .trace_armed = FuriHalNfcTracePointBlockTxArmed,
+            .trace_expired = FuriHalNfcTracePointBlockTxExpired,
             .irq_id = FuriHalInterruptIdTim1TrgComTim17,
             .irq_type = TIM1_TRG_COM_TIM17_IRQn,
 #ifdef FURI_HAL_NFC_TIMER_DEBUG
@@ -65,6 +71,7 @@ static void furi_hal_nfc_timer_irq_callback(void* context) {
     const FuriHalNfcTimerConfig* config = context;
     if(LL_TIM_IsActiveFlag_UPDATE(config->timer)) {
         LL_TIM_ClearFlag_UPDATE(config->timer);
+        FURI_HAL_NFC_TRACE_POINT(config->trace_expired, 0);
         furi_hal_nfc_event_set(config->event);
 #ifdef FURI_HAL_NFC_TIMER_DEBUG
         furi_hal_gpio_write(timer_config->pin, false);
@@ -172,6 +179,8 @@ static void furi_hal_nfc_timer_start_fc(FuriHalNfcTimer timer, uint32_t time_fc)
     // Not starting the timer if the compensation value is greater than the requested delay
     if(comp_fc >= (int32_t)time_fc) return;
 
+    FURI_HAL_NFC_TRACE_POINT(furi_hal_nfc_timers[timer].trace_armed, time_fc);
+
     furi_hal_nfc_timer_start_core_ticks(
         timer, ((uint64_t)SystemCoreClock * (time_fc - comp_fc)) / FURI_HAL_NFC_CARRIER_HZ);
 }
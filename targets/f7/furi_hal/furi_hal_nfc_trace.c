@@ -0,0 +1,80 @@
+#include "furi_hal_nfc_i.h"
+
+#include <stm32wbxx.h>
+
+/**
+ * To enable timing trace, define the FURI_HAL_NFC_TRACE macro
+ * Example: ./fbt --extra-define=FURI_HAL_NFC_TRACE
+ *
+ * Trace is dumped with `nfc trace` CLI command.
+ */
+
+#ifdef FURI_HAL_NFC_TRACE
+
+// Must be a power of 2
+#define FURI_HAL_NFC_TRACE_SIZE (256U)
+
+typedef struct {
+    FuriHalNfcTraceRecord records[FURI_HAL_NFC_TRACE_SIZE];
+    uint32_t head;
+} FuriHalNfcTrace;
+
+static FuriHalNfcTrace furi_hal_nfc_trace;
+
+void furi_hal_nfc_trace_point(FuriHalNfcTracePoint point, uint32_t value) {
+    // Called from both ISR and NFC worker thread, the slot is claimed atomically
+    uint32_t index = __atomic_fetch_add(&furi_hal_nfc_trace.head, 1, __ATOMIC_RELAXED);
+    FuriHalNfcTraceRecord* record =
+        &furi_hal_nfc_trace.records[index & (FURI_HAL_NFC_TRACE_SIZE - 1)];
+
+    record->cycles = DWT->CYCCNT;
+    record->value = value;
+    record->point = point;
+}
+
+size_t furi_hal_nfc_trace_read(FuriHalNfcTraceRecord* records, size_t max_count) {
+    furi_assert(records);
+
+    FURI_CRITICAL_ENTER();
+    uint32_t head = furi_hal_nfc_trace.head;
+    size_t count = MIN(MIN(head, FURI_HAL_NFC_TRACE_SIZE), max_count);
+    for(size_t i = 0; i < count; i++) {
+        uint32_t index = (head - count + i) & (FURI_HAL_NFC_TRACE_SIZE - 1);
+        records[i] = furi_hal_nfc_trace.records[index];
+    }
+    FURI_CRITICAL_EXIT();
+
+    return count;
+}
+
+void furi_hal_nfc_trace_reset() {
+    FURI_CRITICAL_ENTER();
+    furi_hal_nfc_trace.head = 0;
+    FURI_CRITICAL_EXIT();
+}
+
+bool furi_hal_nfc_trace_is_enabled() {
+    return true;
+}
+
+#else
+
+void furi_hal_nfc_trace_point(FuriHalNfcTracePoint point, uint32_t value) {
+    UNUSED(point);
+    UNUSED(value);
+}
+
+size_t furi_hal_nfc_trace_read(FuriHalNfcTraceRecord* records, size_t max_count) {
+    UNUSED(records);
+    UNUSED(max_count);
+    return 0;
+}
+
+void furi_hal_nfc_trace_reset() {
+}
+
+bool furi_hal_nfc_trace_is_enabled() {
+    return false;
+}
+
+#endif
@@ -17,11 +17,25 @@
 #define SD_IDLE_RETRY_COUNT (100)
 #define SD_TIMEOUT_MS (1000)
 #define SD_BLOCK_SIZE (512)
+#define SD_WAIT_SPIN_COUNT (64) /* Bytes polled before waiting starts to yield the CPU */
+#define SD_READ_AHEAD_SECTORS (8) /* Sectors read at once for sequential streams */
+#define SD_READ_AHEAD_STREAK (2) /* Sequential reads in a row to start reading ahead */
+#define SD_BUS_CHUNK_SECTORS (8) /* Sectors per command, bus may be given away in between */
 
 #define FLAG_SET(x, y) (((x) & (y)) == (y))
 
 static bool sd_high_capacity = false;
 
+typedef struct {
+    uint32_t* data; /* SD_READ_AHEAD_SECTORS blocks, allocated on first use */
+    uint32_t sector; /* First sector in data */
+    uint32_t count; /* Sectors in data, 0 if empty */
+    uint32_t next_sector; /* Sector following the last read */
+    uint32_t streak; /* Sequential reads in a row */
+} SdReadAhead;
+
+static SdReadAhead sd_read_ahead = {0};
+
 typedef enum {
     SdSpiDataResponceOK = 0x05,
     SdSpiDataResponceCRCError = 0x0B,
@@ -315,8 +329,15 @@ static uint8_t sd_spi_wait_for_data_and_read(void) {
     return responce;
 }
 
+static inline void sd_spi_wait_yield(void) {
+    if(furi_kernel_is_running()) {
+        furi_thread_yield();
+    }
+}
+
 static FuriStatus sd_spi_wait_for_data(uint8_t data, uint32_t timeout_ms) {
     FuriHalCortexTimer timer = furi_hal_cortex_timer_get(timeout_ms * 1000);
+    uint32_t spin_count = SD_WAIT_SPIN_COUNT;
     uint8_t byte;
 
     do {
@@ -324,6 +345,13 @@ static FuriStatus sd_spi_wait_for_data(uint8_t data, uint32_t timeout_ms) {
         if(furi_hal_cortex_timer_is_expired(timer)) {
             return FuriStatusErrorTimeout;
         }
+
+        // Short waits are common, long ones let other threads run
+        if(spin_count) {
+            spin_count--;
+        } else {
+            sd_spi_wait_yield();
+        }
     } while((byte != data));
 
     return FuriStatusOk;
@@ -685,10 +713,42 @@ static FuriStatus sd_spi_get_cid(SD_CID* Cid) {
     return ret;
 }
 
+static FuriStatus sd_spi_stop_transmission(uint32_t timeout_ms) {
+    uint8_t frame[SD_CMD_LENGTH] = {(uint8_t)SD_CMD12_STOP_TRANSMISSION | 0x40, 0, 0, 0, 0, 0x01};
+    uint8_t retry_count = SD_ANSWER_RETRY_COUNT;
+    uint8_t responce;
+
+    // CMD12 (STOP_TRANSMISSION) is sent while card is still streaming data
+    sd_spi_write_bytes(frame, sizeof(frame));
+    // One stuff byte, then R1b response which is told apart from data by its MSB
+    sd_spi_read_byte();
+    do {
+        responce = sd_spi_read_byte();
+        retry_count--;
+    } while((responce & 0x80) && retry_count);
+
+    FuriStatus status = sd_spi_wait_for_data(0xFF, timeout_ms);
+    sd_spi_deselect_card_and_purge();
+
+    return status;
+}
+
+static FuriStatus sd_spi_read_data_block(uint8_t* data, uint8_t token, uint32_t timeout_ms) {
+    // Wait for the data start token
+    if(sd_spi_wait_for_data(token, timeout_ms) != FuriStatusOk) {
+        return FuriStatusError;
+    }
+
+    // Read the data block
+    sd_spi_read_bytes_dma(data, SD_BLOCK_SIZE);
+    sd_spi_purge_crc();
+
+    return FuriStatusOk;
+}
+
 static FuriStatus
     sd_spi_cmd_read_blocks(uint32_t* data, uint32_t address, uint32_t blocks, uint32_t timeout_ms) {
     uint32_t block_address = address;
-    uint32_t offset = 0;
 
     // CMD16 (SET_BLOCKLEN): R1 response (0x00: no errors)
     SdSpiCmdAnswer response =
@@ -703,40 +763,41 @@ static FuriStatus
         block_address = address * SD_BLOCK_SIZE;
     }
 
-    while(blocks--) {
+    if(blocks == 1) {
         // CMD17 (READ_SINGLE_BLOCK): R1 response (0x00: no errors)
         response =
             sd_spi_send_cmd(SD_CMD17_READ_SINGLE_BLOCK, block_address, 0xFF, SdSpiCmdAnswerTypeR1);
-        if(response.r1 != SdSpi_R1_NO_ERROR) {
-            sd_spi_deselect_card_and_purge();
-            return FuriStatusError;
+        FuriStatus status = FuriStatusError;
+        if(response.r1 == SdSpi_R1_NO_ERROR) {
+            status = sd_spi_read_data_block(
+                (uint8_t*)data, SD_TOKEN_START_DATA_SINGLE_BLOCK_READ, timeout_ms);
         }
 
-        // Wait for the data start token
-        if(sd_spi_wait_for_data(SD_TOKEN_START_DATA_SINGLE_BLOCK_READ, timeout_ms) ==
-           FuriStatusOk) {
-            // Read the data block
-            sd_spi_read_bytes_dma((uint8_t*)data + offset, SD_BLOCK_SIZE);
-            sd_spi_purge_crc();
+        sd_spi_deselect_card_and_purge();
+        return status;
+    }
 
-            // increase offset
-            offset += SD_BLOCK_SIZE;
+    // CMD18 (READ_MULT_BLOCK): R1 response (0x00: no errors)
+    // Card streams blocks back to back, with no command and deselect between them
+    response =
+        sd_spi_send_cmd(SD_CMD18_READ_MULT_BLOCK, block_address, 0xFF, SdSpiCmdAnswerTypeR1);
+    if(response.r1 != SdSpi_R1_NO_ERROR) {
+        sd_spi_deselect_card_and_purge();
+        return FuriStatusError;
+    }
 
-            // increase block address
-            if(sd_high_capacity) {
-                block_address += 1;
-            } else {
-                block_address += SD_BLOCK_SIZE;
-            }
-        } else {
-            sd_spi_deselect_card_and_purge();
-            return FuriStatusError;
-        }
+    FuriStatus status = FuriStatusOk;
+    for(uint32_t offset = 0; blocks--; offset += SD_BLOCK_SIZE) {
+        status = sd_spi_read_data_block(
+            (uint8_t*)data + offset, SD_TOKEN_START_DATA_MULTIPLE_BLOCK_READ, timeout_ms);
+        if(status != FuriStatusOk) break;
+    }
 
-        sd_spi_deselect_card_and_purge();
+    if(sd_spi_stop_transmission(timeout_ms) != FuriStatusOk) {
+        status = FuriStatusError;
     }
 
-    return FuriStatusOk;
+    return status;
 }
 
 static FuriStatus sd_spi_cmd_write_blocks(
@@ -825,23 +886,34 @@ static inline bool sd_cache_get(uint32_t address, uint32_t* data) {
     return false;
 }
 
-static inline void sd_cache_put(uint32_t address, uint32_t* data) {
-    sector_cache_put(address, (uint8_t*)data);
+static inline void sd_cache_put(uint32_t address, const uint32_t* data) {
+    sector_cache_put(address, (const uint8_t*)data);
 }
 
-static inline void sd_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
-    sector_cache_invalidate_range(start_sector, end_sector);
+static inline bool sd_cache_write(uint32_t address, const uint32_t* data) {
+    return sector_cache_write(address, (const uint8_t*)data);
 }
 
-static inline void sd_cache_invalidate_all() {
-    sector_cache_init();
+/* Cached sectors may be newer than the card, if not written back yet */
+static inline void sd_cache_overlay(uint32_t* buff, uint32_t sector, uint32_t count) {
+    for(uint32_t i = 0; i < count; i++) {
+        sd_cache_get(sector + i, buff + i * (SD_BLOCK_SIZE / sizeof(uint32_t)));
+    }
 }
 
-static FuriStatus sd_device_read(uint32_t* buff, uint32_t sector, uint32_t count) {
-    FuriStatus status = FuriStatusError;
+static inline void sd_read_ahead_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
+    if(sd_read_ahead.count && start_sector < sd_read_ahead.sector + sd_read_ahead.count &&
+       end_sector >= sd_read_ahead.sector) {
+        sd_read_ahead.count = 0;
+    }
+}
 
-    furi_hal_spi_acquire(&furi_hal_spi_bus_handle_sd_fast);
-    furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_fast;
+static inline void sd_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
+    sector_cache_invalidate_range(start_sector, end_sector);
+}
+
+static FuriStatus sd_device_read_chunk(uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = FuriStatusError;
 
     if(sd_spi_cmd_read_blocks(buff, sector, count, SD_TIMEOUT_MS) == FuriStatusOk) {
         FuriHalCortexTimer timer = furi_hal_cortex_timer_get(SD_TIMEOUT_MS * 1000);
@@ -853,22 +925,18 @@ static FuriStatus sd_device_read(uint32_t* buff, uint32_t sector, uint32_t count
             if(furi_hal_cortex_timer_is_expired(timer)) {
                 status = FuriStatusErrorTimeout;
                 break;
+            } else if(status != FuriStatusOk) {
+                sd_spi_wait_yield();
             }
         } while(status != FuriStatusOk);
     }
 
-    furi_hal_sd_spi_handle = NULL;
-    furi_hal_spi_release(&furi_hal_spi_bus_handle_sd_fast);
-
     return status;
 }
 
-static FuriStatus sd_device_write(const uint32_t* buff, uint32_t sector, uint32_t count) {
+static FuriStatus sd_device_write_chunk(const uint32_t* buff, uint32_t sector, uint32_t count) {
     FuriStatus status = FuriStatusError;
 
-    furi_hal_spi_acquire(&furi_hal_spi_bus_handle_sd_fast);
-    furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_fast;
-
     if(sd_spi_cmd_write_blocks(buff, sector, count, SD_TIMEOUT_MS) == FuriStatusOk) {
         FuriHalCortexTimer timer = furi_hal_cortex_timer_get(SD_TIMEOUT_MS * 1000);
 
@@ -877,14 +945,58 @@ static FuriStatus sd_device_write(const uint32_t* buff, uint32_t sector, uint32_
             status = sd_spi_get_card_state();
 
             if(furi_hal_cortex_timer_is_expired(timer)) {
-                sd_cache_invalidate_all();
-
                 status = FuriStatusErrorTimeout;
                 break;
             }
         } while(status != FuriStatusOk);
     }
 
+    return status;
+}
+
+/* Card is deselected between commands, so display and other handles on the bus can get in */
+static void sd_device_yield(void) {
+    if(furi_hal_spi_yield(&furi_hal_spi_bus_handle_sd_fast)) {
+        furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_fast;
+    }
+}
+
+static FuriStatus sd_device_read(uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = FuriStatusOk;
+
+    furi_hal_spi_acquire(&furi_hal_spi_bus_handle_sd_fast);
+    furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_fast;
+
+    while(count && status == FuriStatusOk) {
+        uint32_t chunk = MIN(count, (uint32_t)SD_BUS_CHUNK_SECTORS);
+        status = sd_device_read_chunk(buff, sector, chunk);
+        buff += chunk * SD_BLOCK_SIZE / sizeof(uint32_t);
+        sector += chunk;
+        count -= chunk;
+        if(count) sd_device_yield();
+    }
+
+    furi_hal_sd_spi_handle = NULL;
+    furi_hal_spi_release(&furi_hal_spi_bus_handle_sd_fast);
+
+    return status;
+}
+
+static FuriStatus sd_device_write(const uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = FuriStatusOk;
+
+    furi_hal_spi_acquire(&furi_hal_spi_bus_handle_sd_fast);
+    furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_fast;
+
+    while(count && status == FuriStatusOk) {
+        uint32_t chunk = MIN(count, (uint32_t)SD_BUS_CHUNK_SECTORS);
+        status = sd_device_write_chunk(buff, sector, chunk);
+        buff += chunk * SD_BLOCK_SIZE / sizeof(uint32_t);
+        sector += chunk;
+        count -= chunk;
+        if(count) sd_device_yield();
+    }
+
     furi_hal_sd_spi_handle = NULL;
     furi_hal_spi_release(&furi_hal_spi_bus_handle_sd_fast);
 
@@ -911,7 +1023,7 @@ uint8_t furi_hal_sd_max_mount_retry_count() {
     return 10;
 }
 
-FuriStatus furi_hal_sd_init(bool power_reset) {
+static FuriStatus sd_init(bool power_reset) {
     // Slow speed init
     furi_hal_spi_acquire(&furi_hal_spi_bus_handle_sd_slow);
     furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_slow;
@@ -953,8 +1065,44 @@ FuriStatus furi_hal_sd_init(bool power_reset) {
     furi_hal_sd_spi_handle = NULL;
     furi_hal_spi_release(&furi_hal_spi_bus_handle_sd_slow);
 
-    // Init sector cache
-    sector_cache_init();
+    return status;
+}
+
+static FuriStatus sd_write_blocks(const uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = sd_device_write(buff, sector, count);
+
+    if(status != FuriStatusOk) {
+        uint8_t counter = furi_hal_sd_max_mount_retry_count();
+
+        while(status != FuriStatusOk && counter > 0 && furi_hal_sd_is_present()) {
+            if((counter % 2) == 0) {
+                // power reset sd card
+                status = sd_init(true);
+            } else {
+                status = sd_init(false);
+            }
+
+            if(status == FuriStatusOk) {
+                status = sd_device_write(buff, sector, count);
+            }
+            counter--;
+        }
+    }
+
+    return status;
+}
+
+static bool sd_cache_write_back(uint32_t n_sector, const uint8_t* data) {
+    return sd_write_blocks((const uint32_t*)data, n_sector, 1) == FuriStatusOk;
+}
+
+FuriStatus furi_hal_sd_init(bool power_reset) {
+    FuriStatus status = sd_init(power_reset);
+
+    // Card may have been changed, so sectors not written back yet are dropped too
+    sector_cache_init(sd_cache_write_back);
+    sd_read_ahead.count = 0;
+    sd_read_ahead.streak = 0;
 
     return status;
 }
@@ -971,17 +1119,8 @@ FuriStatus furi_hal_sd_get_card_state(void) {
     return status;
 }
 
-FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t count) {
-    FuriStatus status;
-    bool single_sector = count == 1;
-
-    if(single_sector) {
-        if(sd_cache_get(sector, buff)) {
-            return FuriStatusOk;
-        }
-    }
-
-    status = sd_device_read(buff, sector, count);
+static FuriStatus sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = sd_device_read(buff, sector, count);
 
     if(status != FuriStatusOk) {
         uint8_t counter = furi_hal_sd_max_mount_retry_count();
@@ -989,9 +1128,9 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
         while(status != FuriStatusOk && counter > 0 && furi_hal_sd_is_present()) {
             if((counter % 2) == 0) {
                 // power reset sd card
-                status = furi_hal_sd_init(true);
+                status = sd_init(true);
             } else {
-                status = furi_hal_sd_init(false);
+                status = sd_init(false);
             }
 
             if(status == FuriStatusOk) {
@@ -1001,8 +1140,75 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
         }
     }
 
-    if(single_sector && status == FuriStatusOk) {
-        sd_cache_put(sector, buff);
+    return status;
+}
+
+/* Serve sequential reads from one multi-block read, sectors it brings aren't put to the
+ * sector cache, so a stream doesn't push FAT and directory sectors out of there */
+static bool sd_read_ahead_get(uint32_t* buff, uint32_t sector, uint32_t count) {
+    SdReadAhead* ahead = &sd_read_ahead;
+
+    bool in_buffer = ahead->count && sector >= ahead->sector &&
+                     sector + count <= ahead->sector + ahead->count;
+
+    if(!in_buffer) {
+        if(ahead->streak < SD_READ_AHEAD_STREAK || count >= SD_READ_AHEAD_SECTORS) {
+            return false;
+        }
+
+        if(ahead->data == NULL) {
+            ahead->data = memmgr_alloc_from_pool(SD_READ_AHEAD_SECTORS * SD_BLOCK_SIZE);
+        }
+
+        // No retries, reading past the end of the card is expected to fail
+        ahead->count = 0;
+        if(sd_device_read(ahead->data, sector, SD_READ_AHEAD_SECTORS) != FuriStatusOk) {
+            return false;
+        }
+
+        ahead->sector = sector;
+        ahead->count = SD_READ_AHEAD_SECTORS;
+    }
+
+    const size_t words_per_block = SD_BLOCK_SIZE / sizeof(uint32_t);
+    memcpy(
+        buff,
+        ahead->data + (sector - ahead->sector) * words_per_block,
+        count * SD_BLOCK_SIZE);
+    sd_cache_overlay(buff, sector, count);
+
+    return true;
+}
+
+FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status;
+    bool single_sector = count == 1;
+
+    if(sector == sd_read_ahead.next_sector) {
+        sd_read_ahead.streak++;
+    } else {
+        sd_read_ahead.streak = 0;
+    }
+    sd_read_ahead.next_sector = sector + count;
+
+    if(single_sector) {
+        if(sd_cache_get(sector, buff)) {
+            return FuriStatusOk;
+        }
+    }
+
+    if(sd_read_ahead_get(buff, sector, count)) {
+        return FuriStatusOk;
+    }
+
+    status = sd_read_blocks(buff, sector, count);
+
+    if(status == FuriStatusOk) {
+        if(single_sector) {
+            sd_cache_put(sector, buff);
+        } else {
+            sd_cache_overlay(buff, sector, count);
+        }
     }
 
     return status;
@@ -1010,27 +1216,22 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
 
 FuriStatus furi_hal_sd_write_blocks(const uint32_t* buff, uint32_t sector, uint32_t count) {
     FuriStatus status;
+    bool single_sector = count == 1;
 
-    sd_cache_invalidate_range(sector, sector + count);
+    sd_read_ahead_invalidate_range(sector, sector + count);
 
-    status = sd_device_write(buff, sector, count);
+    if(single_sector) {
+        if(sd_cache_write(sector, buff)) {
+            return FuriStatusOk;
+        }
+    }
 
-    if(status != FuriStatusOk) {
-        uint8_t counter = furi_hal_sd_max_mount_retry_count();
+    sd_cache_invalidate_range(sector, sector + count);
 
-        while(status != FuriStatusOk && counter > 0 && furi_hal_sd_is_present()) {
-            if((counter % 2) == 0) {
-                // power reset sd card
-                status = furi_hal_sd_init(true);
-            } else {
-                status = furi_hal_sd_init(false);
-            }
+    status = sd_write_blocks(buff, sector, count);
 
-            if(status == FuriStatusOk) {
-                status = sd_device_write(buff, sector, count);
-            }
-            counter--;
-        }
+    if(single_sector && status == FuriStatusOk) {
+        sd_cache_put(sector, buff);
     }
 
     return status;
@@ -48,12 +48,36 @@ void furi_hal_spi_bus_handle_deinit(FuriHalSpiBusHandle* handle) {
     handle->callback(handle, FuriHalSpiBusHandleEventDeinit);
 }
 
+static bool furi_hal_spi_is_outranked(FuriHalSpiBusHandle* handle) {
+    for(size_t i = handle->priority + 1; i < FuriHalSpiPriorityCount; i++) {
+        if(__atomic_load_n(&handle->bus->waiting[i], __ATOMIC_RELAXED)) return true;
+    }
+    return false;
+}
+
 void furi_hal_spi_acquire(FuriHalSpiBusHandle* handle) {
     furi_assert(handle);
+    furi_assert(handle->priority < FuriHalSpiPriorityCount);
 
     furi_hal_power_insomnia_enter();
 
-    handle->bus->callback(handle->bus, FuriHalSpiBusEventLock);
+    FuriHalSpiBus* bus = handle->bus;
+    uint8_t* waiting = &bus->waiting[handle->priority];
+    while(true) {
+        // Stay out of the mutex while higher priority is waiting for it
+        while(furi_kernel_is_running() && furi_hal_spi_is_outranked(handle)) {
+            furi_delay_tick(1);
+        }
+
+        __atomic_add_fetch(waiting, 1, __ATOMIC_RELAXED);
+        bus->callback(bus, FuriHalSpiBusEventLock);
+        __atomic_sub_fetch(waiting, 1, __ATOMIC_RELAXED);
+
+        // Mutex goes to the waiter with the highest task priority, hand it over if it was us
+        if(!furi_kernel_is_running() || !furi_hal_spi_is_outranked(handle)) break;
+        bus->callback(bus, FuriHalSpiBusEventUnlock);
+    }
+
     handle->bus->callback(handle->bus, FuriHalSpiBusEventActivate);
 
     furi_assert(handle->bus->current_handle == NULL);
@@ -77,6 +101,18 @@ void furi_hal_spi_release(FuriHalSpiBusHandle* handle) {
     furi_hal_power_insomnia_exit();
 }
 
+bool furi_hal_spi_yield(FuriHalSpiBusHandle* handle) {
+    furi_assert(handle);
+    furi_assert(handle->bus->current_handle == handle);
+
+    if(!furi_hal_spi_is_outranked(handle)) return false;
+
+    furi_hal_spi_release(handle);
+    furi_hal_spi_acquire(handle);
+
+    return true;
+}
+
 static void furi_hal_spi_bus_end_txrx(FuriHalSpiBusHandle* handle, uint32_t timeout) {
     UNUSED(timeout); // FIXME
     while(LL_SPI_GetTxFIFOLevel(handle->bus->spi) != LL_SPI_TX_FIFO_EMPTY)
@@ -200,7 +236,7 @@ bool furi_hal_spi_bus_trx_dma(
     furi_assert(size > 0);
 
     // If scheduler is not running, use blocking mode
-    if(furi_kernel_is_running()) {
+    if(!furi_kernel_is_running()) {
         return furi_hal_spi_bus_trx(handle, tx_buffer, rx_buffer, size, timeout_ms);
     }
 
@@ -369,6 +405,8 @@ bool furi_hal_spi_bus_trx_dma(
     }
 
     furi_hal_spi_bus_end_txrx(handle, timeout_ms);
+    // RX FIFO overflows in TX only mode, same as in furi_hal_spi_bus_tx
+    LL_SPI_ClearFlag_OVR(spi);
 
     furi_check(furi_semaphore_release(spi_dma_lock) == FuriStatusOk);
 
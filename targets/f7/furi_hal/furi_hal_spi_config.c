@@ -317,6 +317,7 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_subghz = {
     .mosi = &gpio_spi_r_mosi,
     .sck = &gpio_spi_r_sck,
     .cs = &gpio_subghz_cs,
+    .priority = FuriHalSpiPriorityHigh,
 };
 
 static void furi_hal_spi_bus_handle_nfc_event_callback(
@@ -332,6 +333,7 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_nfc = {
     .mosi = &gpio_spi_r_mosi,
     .sck = &gpio_spi_r_sck,
     .cs = &gpio_nfc_cs,
+    .priority = FuriHalSpiPriorityHigh,
 };
 
 static void furi_hal_spi_bus_handle_external_event_callback(
@@ -348,6 +350,7 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_external = {
     .mosi = &gpio_ext_pa7,
     .sck = &gpio_ext_pb3,
     .cs = &gpio_ext_pa4,
+    .priority = FuriHalSpiPriorityNormal,
 };
 
 FuriHalSpiBusHandle furi_hal_spi_bus_handle_external_extra = {
@@ -357,6 +360,7 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_external_extra = {
     .mosi = &gpio_ext_pa7,
     .sck = &gpio_ext_pb3,
     .cs = &gpio_ext_pc3,
+    .priority = FuriHalSpiPriorityNormal,
 };
 
 inline static void furi_hal_spi_bus_d_handle_event_callback(
@@ -413,6 +417,7 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_display = {
     .mosi = &gpio_spi_d_mosi,
     .sck = &gpio_spi_d_sck,
     .cs = &gpio_display_cs,
+    .priority = FuriHalSpiPriorityNormal,
 };
 
 static void furi_hal_spi_bus_handle_sd_fast_event_callback(
@@ -428,6 +433,7 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_sd_fast = {
     .mosi = &gpio_spi_d_mosi,
     .sck = &gpio_spi_d_sck,
     .cs = &gpio_sdcard_cs,
+    .priority = FuriHalSpiPriorityLow,
 };
 
 static void furi_hal_spi_bus_handle_sd_slow_event_callback(
@@ -443,4 +449,5 @@ FuriHalSpiBusHandle furi_hal_spi_bus_handle_sd_slow = {
     .mosi = &gpio_spi_d_mosi,
     .sck = &gpio_spi_d_sck,
     .cs = &gpio_sdcard_cs,
+    .priority = FuriHalSpiPriorityLow,
 };
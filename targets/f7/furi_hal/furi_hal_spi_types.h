@@ -14,6 +14,15 @@ extern "C" {
 typedef struct FuriHalSpiBus FuriHalSpiBus;
 typedef struct FuriHalSpiBusHandle FuriHalSpiBusHandle;
 
+/** FuriHal spi handle priority, bus is handed to the highest waiting one first */
+typedef enum {
+    FuriHalSpiPriorityLow, /**< Bulk transfers, yield to everyone else */
+    FuriHalSpiPriorityNormal, /**< Default */
+    FuriHalSpiPriorityHigh, /**< Latency sensitive radio transactions */
+
+    FuriHalSpiPriorityCount,
+} FuriHalSpiPriority;
+
 /** FuriHal spi bus states */
 typedef enum {
     FuriHalSpiBusEventInit, /**< Bus initialization event, called on system start */
@@ -32,6 +41,7 @@ struct FuriHalSpiBus {
     SPI_TypeDef* spi;
     FuriHalSpiBusEventCallback callback;
     FuriHalSpiBusHandle* current_handle;
+    uint8_t waiting[FuriHalSpiPriorityCount]; /**< Acquirers waiting, per priority */
 };
 
 /** FuriHal spi handle states */
@@ -55,6 +65,7 @@ struct FuriHalSpiBusHandle {
     const GpioPin* mosi;
     const GpioPin* sck;
     const GpioPin* cs;
+    FuriHalSpiPriority priority;
 };
 
 #ifdef __cplusplus
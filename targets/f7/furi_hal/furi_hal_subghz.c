@@ -576,6 +576,12 @@ void furi_hal_subghz_stop_async_rx() {
     furi_hal_gpio_init(&gpio_cc1101_g0, GpioModeAnalog, GpioPullNo, GpioSpeedLow);
 }
 
+/** One low and one high timer period, DMA buffer always starts with low one */
+typedef struct {
+    uint32_t low;
+    uint32_t high;
+} FuriHalSubGhzAsyncTxPair;
+
 typedef struct {
     uint32_t* buffer;
     LevelDuration carry_ld;
@@ -583,66 +589,108 @@ typedef struct {
     void* callback_context;
     uint64_t duty_high;
     uint64_t duty_low;
+
+    // Timer periods converted ahead of DMA, owned by prefetch thread
+    FuriSpscRing* prefetch;
+    FuriThread* prefetch_thread;
+    volatile bool prefetch_stop;
+    FuriHalSubGhzAsyncTxPair pair;
+    bool pair_high;
+    bool pair_ready;
+    bool is_end;
 } FuriHalSubGhzAsyncTx;
 
 static FuriHalSubGhzAsyncTx furi_hal_subghz_async_tx = {0};
 
-static void furi_hal_subghz_async_tx_refill(uint32_t* buffer, size_t samples) {
-    furi_assert(furi_hal_subghz.state == SubGhzStateAsyncTx);
-    while(samples > 0) {
-        bool is_odd = samples % 2;
+static void furi_hal_subghz_async_tx_put(uint32_t duration) {
+    FuriHalSubGhzAsyncTx* tx = &furi_hal_subghz_async_tx;
+    if(tx->pair_high) {
+        tx->pair.high = duration;
+        tx->duty_high += duration;
+        tx->pair_ready = true;
+    } else {
+        tx->pair.low = duration;
+        tx->duty_low += duration;
+    }
+    tx->pair_high = !tx->pair_high;
+}
+
+/** Convert LevelDurations to timer periods until ring is full or encoder has no data
+ *
+ * @return     true if there is more to convert
+ */
+static bool furi_hal_subghz_async_tx_prefetch() {
+    FuriHalSubGhzAsyncTx* tx = &furi_hal_subghz_async_tx;
+
+    while(true) {
+        if(tx->pair_ready) {
+            if(!furi_spsc_ring_push(tx->prefetch, &tx->pair)) return true;
+            tx->pair_ready = false;
+        }
+        if(tx->is_end) return false;
+
         LevelDuration ld;
-        if(level_duration_is_reset(furi_hal_subghz_async_tx.carry_ld)) {
-            ld = furi_hal_subghz_async_tx.callback(furi_hal_subghz_async_tx.callback_context);
+        if(level_duration_is_reset(tx->carry_ld)) {
+            ld = tx->callback(tx->callback_context);
         } else {
-            ld = furi_hal_subghz_async_tx.carry_ld;
-            furi_hal_subghz_async_tx.carry_ld = level_duration_reset();
+            ld = tx->carry_ld;
+            tx->carry_ld = level_duration_reset();
         }
 
         if(level_duration_is_wait(ld)) {
-            *buffer = API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME;
-            buffer++;
-            samples--;
+            // Ring still holds timings, retry later instead of injecting guard time
+            return true;
         } else if(level_duration_is_reset(ld)) {
-            *buffer = 0;
-            buffer++;
-            samples--;
-            LL_DMA_DisableIT_HT(SUBGHZ_DMA_CH1_DEF);
-            LL_DMA_DisableIT_TC(SUBGHZ_DMA_CH1_DEF);
-            LL_TIM_EnableIT_UPDATE(TIM2);
-            break;
+            // Zero period stops the timer, always lands in high half of the last pair
+            if(!tx->pair_high) tx->pair.low = 0;
+            tx->pair.high = 0;
+            tx->pair_high = false;
+            tx->pair_ready = true;
+            tx->is_end = true;
         } else {
             bool level = level_duration_get_level(ld);
 
             // Inject guard time if level is incorrect
-            if(is_odd != level) {
-                *buffer = API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME;
-                buffer++;
-                samples--;
-                if(is_odd) {
-                    furi_hal_subghz_async_tx.duty_high += API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME;
-                } else {
-                    furi_hal_subghz_async_tx.duty_low += API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME;
-                }
-
-                // Special case: prevent buffer overflow if sample is last
-                if(samples == 0) {
-                    furi_hal_subghz_async_tx.carry_ld = ld;
-                    break;
+            if(level != tx->pair_high) {
+                furi_hal_subghz_async_tx_put(API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME);
+                if(tx->pair_ready) {
+                    tx->carry_ld = ld;
+                    continue;
                 }
             }
 
             uint32_t duration = level_duration_get_duration(ld);
             furi_assert(duration > 0);
-            *buffer = duration;
-            buffer++;
-            samples--;
+            furi_hal_subghz_async_tx_put(duration);
+        }
+    }
+}
 
-            if(is_odd) {
-                furi_hal_subghz_async_tx.duty_high += duration;
-            } else {
-                furi_hal_subghz_async_tx.duty_low += duration;
-            }
+static int32_t furi_hal_subghz_async_tx_prefetch_thread(void* context) {
+    UNUSED(context);
+    while(!furi_hal_subghz_async_tx.prefetch_stop) {
+        if(!furi_hal_subghz_async_tx_prefetch()) break;
+        furi_delay_tick(1);
+    }
+    return 0;
+}
+
+static void furi_hal_subghz_async_tx_refill(uint32_t* buffer, size_t samples) {
+    furi_assert(furi_hal_subghz.state == SubGhzStateAsyncTx);
+
+    // Periods are already converted, only copy them
+    size_t pairs = samples / 2;
+    size_t count = furi_spsc_ring_pop(furi_hal_subghz_async_tx.prefetch, buffer, pairs, 0);
+
+    if(count && buffer[count * 2 - 1] == 0) {
+        // Last pair of the transmission
+        LL_DMA_DisableIT_HT(SUBGHZ_DMA_CH1_DEF);
+        LL_DMA_DisableIT_TC(SUBGHZ_DMA_CH1_DEF);
+        LL_TIM_EnableIT_UPDATE(TIM2);
+    } else {
+        // Encoder is late, keep low/high order with guard time periods
+        for(size_t i = count * 2; i < samples; i++) {
+            buffer[i] = API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME;
         }
     }
 }
@@ -700,10 +748,23 @@ bool furi_hal_subghz_start_async_tx(FuriHalSubGhzAsyncTxCallback callback, void*
 
     furi_hal_subghz_async_tx.duty_low = 0;
     furi_hal_subghz_async_tx.duty_high = 0;
+    furi_hal_subghz_async_tx.carry_ld = level_duration_reset();
+    furi_hal_subghz_async_tx.pair_high = false;
+    furi_hal_subghz_async_tx.pair_ready = false;
+    furi_hal_subghz_async_tx.is_end = false;
+    furi_hal_subghz_async_tx.prefetch_stop = false;
 
     furi_hal_subghz_async_tx.buffer =
         malloc(API_HAL_SUBGHZ_ASYNC_TX_BUFFER_FULL * sizeof(uint32_t));
 
+    // Convert as much as fits before the first period goes out
+    furi_hal_subghz_async_tx.prefetch = furi_spsc_ring_alloc(
+        sizeof(FuriHalSubGhzAsyncTxPair), API_HAL_SUBGHZ_ASYNC_TX_PREFETCH_PAIRS);
+    bool is_prefetch_needed = furi_hal_subghz_async_tx_prefetch();
+    furi_hal_subghz_async_tx.prefetch_thread = furi_thread_alloc_ex(
+        "SubGhzTxPrefetch", 1024, furi_hal_subghz_async_tx_prefetch_thread, NULL);
+    furi_thread_set_priority(furi_hal_subghz_async_tx.prefetch_thread, FuriThreadPriorityHighest);
+
     // Connect CC1101_GD0 to TIM2 as output
     furi_hal_gpio_init_ex(
         &gpio_cc1101_g0, GpioModeAltFunctionPushPull, GpioPullDown, GpioSpeedLow, GpioAltFn1TIM2);
@@ -795,6 +856,10 @@ bool furi_hal_subghz_start_async_tx(FuriHalSubGhzAsyncTxCallback callback, void*
         LL_DMA_EnableChannel(SUBGHZ_DMA_CH2_DEF);
     }
 
+    if(is_prefetch_needed) {
+        furi_thread_start(furi_hal_subghz_async_tx.prefetch_thread);
+    }
+
     return true;
 }
 
@@ -814,6 +879,11 @@ void furi_hal_subghz_stop_async_tx() {
     furi_hal_gpio_write(&FURI_HAL_SUBGHZ_TX_GPIO, false);
 #endif
 
+    // Join never started thread returns immediately
+    furi_hal_subghz_async_tx.prefetch_stop = true;
+    furi_thread_join(furi_hal_subghz_async_tx.prefetch_thread);
+    furi_thread_free(furi_hal_subghz_async_tx.prefetch_thread);
+
     // Deinitialize Timer
     FURI_CRITICAL_ENTER();
     furi_hal_bus_disable(FuriHalBusTIM2);
@@ -835,6 +905,7 @@ void furi_hal_subghz_stop_async_tx() {
     FURI_CRITICAL_EXIT();
 
     free(furi_hal_subghz_async_tx.buffer);
+    furi_spsc_ring_free(furi_hal_subghz_async_tx.prefetch);
 
     float duty_cycle =
         100.0f * (float)furi_hal_subghz_async_tx.duty_high /
@@ -22,6 +22,7 @@ extern "C" {
 #define API_HAL_SUBGHZ_ASYNC_TX_BUFFER_FULL (256)
 #define API_HAL_SUBGHZ_ASYNC_TX_BUFFER_HALF (API_HAL_SUBGHZ_ASYNC_TX_BUFFER_FULL / 2)
 #define API_HAL_SUBGHZ_ASYNC_TX_GUARD_TIME 999
+#define API_HAL_SUBGHZ_ASYNC_TX_PREFETCH_PAIRS (512)
 
 /** Switchable Radio Paths */
 typedef enum {
@@ -220,6 +221,11 @@ void furi_hal_subghz_stop_async_rx();
 typedef LevelDuration (*FuriHalSubGhzAsyncTxCallback)(void* context);
 
 /** Start async TX Initializes GPIO, TIM2 and DMA1 for signal output
+ *
+ * Callback is called from prefetch thread, which keeps up to
+ * API_HAL_SUBGHZ_ASYNC_TX_PREFETCH_PAIRS low/high timer periods converted
+ * ahead of DMA. Returning level_duration_wait() only delays prefetch,
+ * guard time goes out only when all prefetched periods have been sent.
  *
  * @param      callback  FuriHalSubGhzAsyncTxCallback
  * @param      context   callback context
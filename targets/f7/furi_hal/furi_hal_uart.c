@@ -3,7 +3,9 @@
 #include <stm32wbxx_ll_lpuart.h>
 #include <stm32wbxx_ll_usart.h>
 #include <stm32wbxx_ll_rcc.h>
+#include <stm32wbxx_ll_dma.h>
 #include <furi_hal_resources.h>
+#include <furi_hal_interrupt.h>
 #include <furi_hal_bus.h>
 
 #include <furi.h>
@@ -13,6 +15,65 @@ static bool furi_hal_usart_prev_enabled[2];
 static void (*irq_cb[2])(uint8_t ev, uint8_t data, void* context);
 static void* irq_ctx[2];
 
+#define FURI_HAL_UART_DMA_RX_BUFFER_SIZE 512
+
+typedef struct {
+    DMA_TypeDef* dma;
+    uint32_t channel;
+    uint32_t request;
+    FuriHalInterruptId irq;
+} FuriHalUartDma;
+
+static const FuriHalUartDma furi_hal_uart_dma_rx_def[2] = {
+    [FuriHalUartIdUSART1] =
+        {
+            .dma = DMA1,
+            .channel = LL_DMA_CHANNEL_6,
+            .request = LL_DMAMUX_REQ_USART1_RX,
+            .irq = FuriHalInterruptIdDma1Ch6,
+        },
+    [FuriHalUartIdLPUART1] =
+        {
+            .dma = DMA1,
+            .channel = LL_DMA_CHANNEL_3,
+            .request = LL_DMAMUX_REQ_LPUART1_RX,
+            .irq = FuriHalInterruptIdDma1Ch3,
+        },
+};
+
+static const FuriHalUartDma furi_hal_uart_dma_tx_def[2] = {
+    [FuriHalUartIdUSART1] =
+        {
+            .dma = DMA1,
+            .channel = LL_DMA_CHANNEL_7,
+            .request = LL_DMAMUX_REQ_USART1_TX,
+            .irq = FuriHalInterruptIdDma1Ch7,
+        },
+    [FuriHalUartIdLPUART1] =
+        {
+            .dma = DMA2,
+            .channel = LL_DMA_CHANNEL_4,
+            .request = LL_DMAMUX_REQ_LPUART1_TX,
+            .irq = FuriHalInterruptIdDma2Ch4,
+        },
+};
+
+typedef struct {
+    uint8_t* buffer;
+    size_t pos;
+    FuriHalUartDmaRxCallback callback;
+    void* context;
+} FuriHalUartDmaRx;
+
+typedef struct {
+    volatile bool busy;
+    FuriHalUartDmaTxCallback callback;
+    void* context;
+} FuriHalUartDmaTx;
+
+static FuriHalUartDmaRx furi_hal_uart_dma_rx[2];
+static FuriHalUartDmaTx furi_hal_uart_dma_tx_state[2];
+
 static void furi_hal_usart_init(uint32_t baud) {
     furi_hal_bus_enable(FuriHalBusUSART1);
     LL_RCC_SetUSARTClockSource(LL_RCC_USART1_CLKSOURCE_PCLK2);
@@ -132,6 +193,7 @@ void furi_hal_uart_set_br(FuriHalUartId ch, uint32_t baud) {
 }
 
 void furi_hal_uart_deinit(FuriHalUartId ch) {
+    furi_hal_uart_dma_rx_stop(ch);
     furi_hal_uart_set_irq_cb(ch, NULL, NULL);
     if(ch == FuriHalUartIdUSART1) {
         if(furi_hal_bus_is_enabled(FuriHalBusUSART1)) {
@@ -225,8 +287,191 @@ void furi_hal_uart_set_irq_cb(
     }
 }
 
+/* DMA flags of channel n are at bits 4n..4n+3 of ISR and IFCR */
+static inline bool furi_hal_uart_dma_flag_get(const FuriHalUartDma* def, uint32_t flag) {
+    const uint32_t mask = flag << (def->channel * 4);
+    if(READ_BIT(def->dma->ISR, mask)) {
+        WRITE_REG(def->dma->IFCR, mask);
+        return true;
+    }
+    return false;
+}
+
+/* Delivers everything DMA has written since the previous call */
+static void furi_hal_uart_dma_rx_process(FuriHalUartId ch) {
+    FuriHalUartDmaRx* rx = &furi_hal_uart_dma_rx[ch];
+    const FuriHalUartDma* def = &furi_hal_uart_dma_rx_def[ch];
+    if(!rx->buffer) return;
+
+    const size_t dma_pos =
+        FURI_HAL_UART_DMA_RX_BUFFER_SIZE - LL_DMA_GetDataLength(def->dma, def->channel);
+
+    if(dma_pos == rx->pos) return;
+
+    if(dma_pos > rx->pos) {
+        rx->callback(ch, &rx->buffer[rx->pos], dma_pos - rx->pos, rx->context);
+    } else {
+        rx->callback(
+            ch, &rx->buffer[rx->pos], FURI_HAL_UART_DMA_RX_BUFFER_SIZE - rx->pos, rx->context);
+        if(dma_pos) {
+            rx->callback(ch, rx->buffer, dma_pos, rx->context);
+        }
+    }
+
+    rx->pos = (dma_pos == FURI_HAL_UART_DMA_RX_BUFFER_SIZE) ? 0 : dma_pos;
+}
+
+static void furi_hal_uart_dma_rx_isr(void* context) {
+    FuriHalUartId ch = (FuriHalUartId)(uint32_t)context;
+    const FuriHalUartDma* def = &furi_hal_uart_dma_rx_def[ch];
+
+    bool half = furi_hal_uart_dma_flag_get(def, DMA_ISR_HTIF1);
+    bool full = furi_hal_uart_dma_flag_get(def, DMA_ISR_TCIF1);
+    if(half || full) {
+        furi_hal_uart_dma_rx_process(ch);
+    }
+}
+
+static void furi_hal_uart_dma_tx_isr(void* context) {
+    FuriHalUartId ch = (FuriHalUartId)(uint32_t)context;
+    const FuriHalUartDma* def = &furi_hal_uart_dma_tx_def[ch];
+    FuriHalUartDmaTx* tx = &furi_hal_uart_dma_tx_state[ch];
+
+    if(furi_hal_uart_dma_flag_get(def, DMA_ISR_TCIF1)) {
+        LL_DMA_DisableChannel(def->dma, def->channel);
+        tx->busy = false;
+        if(tx->callback) {
+            tx->callback(ch, tx->context);
+        }
+    }
+}
+
+void furi_hal_uart_dma_rx_start(
+    FuriHalUartId ch,
+    FuriHalUartDmaRxCallback callback,
+    void* context) {
+    furi_check(callback);
+    furi_check(!furi_hal_uart_dma_rx[ch].buffer);
+
+    const FuriHalUartDma* def = &furi_hal_uart_dma_rx_def[ch];
+    FuriHalUartDmaRx* rx = &furi_hal_uart_dma_rx[ch];
+
+    // Byte interrupts are replaced by DMA
+    furi_hal_uart_set_irq_cb(ch, NULL, NULL);
+
+    rx->buffer = malloc(FURI_HAL_UART_DMA_RX_BUFFER_SIZE);
+    rx->pos = 0;
+    rx->callback = callback;
+    rx->context = context;
+
+    const uint32_t rdr = (ch == FuriHalUartIdUSART1) ? (uint32_t) & (USART1->RDR) :
+                                                       (uint32_t) & (LPUART1->RDR);
+
+    LL_DMA_SetMemoryAddress(def->dma, def->channel, (uint32_t)rx->buffer);
+    LL_DMA_SetPeriphAddress(def->dma, def->channel, rdr);
+    LL_DMA_ConfigTransfer(
+        def->dma,
+        def->channel,
+        LL_DMA_DIRECTION_PERIPH_TO_MEMORY | LL_DMA_MODE_CIRCULAR | LL_DMA_PERIPH_NOINCREMENT |
+            LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE |
+            LL_DMA_PRIORITY_HIGH);
+    LL_DMA_SetDataLength(def->dma, def->channel, FURI_HAL_UART_DMA_RX_BUFFER_SIZE);
+    LL_DMA_SetPeriphRequest(def->dma, def->channel, def->request);
+
+    furi_hal_interrupt_set_isr(def->irq, furi_hal_uart_dma_rx_isr, (void*)(uint32_t)ch);
+    LL_DMA_EnableIT_HT(def->dma, def->channel);
+    LL_DMA_EnableIT_TC(def->dma, def->channel);
+    LL_DMA_EnableChannel(def->dma, def->channel);
+
+    if(ch == FuriHalUartIdUSART1) {
+        LL_USART_EnableDMAReq_RX(USART1);
+        LL_USART_ClearFlag_IDLE(USART1);
+        LL_USART_EnableIT_IDLE(USART1);
+        NVIC_EnableIRQ(USART1_IRQn);
+    } else if(ch == FuriHalUartIdLPUART1) {
+        LL_LPUART_EnableDMAReq_RX(LPUART1);
+        LL_LPUART_ClearFlag_IDLE(LPUART1);
+        LL_LPUART_EnableIT_IDLE(LPUART1);
+        NVIC_EnableIRQ(LPUART1_IRQn);
+    }
+}
+
+void furi_hal_uart_dma_rx_stop(FuriHalUartId ch) {
+    FuriHalUartDmaRx* rx = &furi_hal_uart_dma_rx[ch];
+    if(!rx->buffer) return;
+
+    const FuriHalUartDma* def = &furi_hal_uart_dma_rx_def[ch];
+
+    if(ch == FuriHalUartIdUSART1) {
+        NVIC_DisableIRQ(USART1_IRQn);
+        LL_USART_DisableIT_IDLE(USART1);
+        LL_USART_DisableDMAReq_RX(USART1);
+    } else if(ch == FuriHalUartIdLPUART1) {
+        NVIC_DisableIRQ(LPUART1_IRQn);
+        LL_LPUART_DisableIT_IDLE(LPUART1);
+        LL_LPUART_DisableDMAReq_RX(LPUART1);
+    }
+
+    LL_DMA_DisableChannel(def->dma, def->channel);
+    LL_DMA_DisableIT_HT(def->dma, def->channel);
+    LL_DMA_DisableIT_TC(def->dma, def->channel);
+    furi_hal_interrupt_set_isr(def->irq, NULL, NULL);
+
+    free(rx->buffer);
+    rx->buffer = NULL;
+}
+
+bool furi_hal_uart_dma_tx(
+    FuriHalUartId ch,
+    const uint8_t* buffer,
+    size_t buffer_size,
+    FuriHalUartDmaTxCallback callback,
+    void* context) {
+    furi_check(buffer_size <= UINT16_MAX);
+
+    const FuriHalUartDma* def = &furi_hal_uart_dma_tx_def[ch];
+    FuriHalUartDmaTx* tx = &furi_hal_uart_dma_tx_state[ch];
+
+    if(tx->busy) return false;
+
+    tx->busy = true;
+    tx->callback = callback;
+    tx->context = context;
+
+    const uint32_t tdr = (ch == FuriHalUartIdUSART1) ? (uint32_t) & (USART1->TDR) :
+                                                       (uint32_t) & (LPUART1->TDR);
+
+    LL_DMA_SetMemoryAddress(def->dma, def->channel, (uint32_t)buffer);
+    LL_DMA_SetPeriphAddress(def->dma, def->channel, tdr);
+    LL_DMA_ConfigTransfer(
+        def->dma,
+        def->channel,
+        LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT |
+            LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE |
+            LL_DMA_PRIORITY_MEDIUM);
+    LL_DMA_SetDataLength(def->dma, def->channel, buffer_size);
+    LL_DMA_SetPeriphRequest(def->dma, def->channel, def->request);
+
+    furi_hal_interrupt_set_isr(def->irq, furi_hal_uart_dma_tx_isr, (void*)(uint32_t)ch);
+    LL_DMA_EnableIT_TC(def->dma, def->channel);
+
+    if(ch == FuriHalUartIdUSART1) {
+        LL_USART_EnableDMAReq_TX(USART1);
+    } else if(ch == FuriHalUartIdLPUART1) {
+        LL_LPUART_EnableDMAReq_TX(LPUART1);
+    }
+
+    LL_DMA_EnableChannel(def->dma, def->channel);
+
+    return true;
+}
+
 void LPUART1_IRQHandler(void) {
-    if(LL_LPUART_IsActiveFlag_RXNE_RXFNE(LPUART1)) {
+    if(LL_LPUART_IsEnabledIT_IDLE(LPUART1) && LL_LPUART_IsActiveFlag_IDLE(LPUART1)) {
+        LL_LPUART_ClearFlag_IDLE(LPUART1);
+        LL_LPUART_ClearFlag_ORE(LPUART1);
+        furi_hal_uart_dma_rx_process(FuriHalUartIdLPUART1);
+    } else if(LL_LPUART_IsActiveFlag_RXNE_RXFNE(LPUART1)) {
         uint8_t data = LL_LPUART_ReceiveData8(LPUART1);
         irq_cb[FuriHalUartIdLPUART1](UartIrqEventRXNE, data, irq_ctx[FuriHalUartIdLPUART1]);
     } else if(LL_LPUART_IsActiveFlag_ORE(LPUART1)) {
@@ -235,7 +480,11 @@ void LPUART1_IRQHandler(void) {
 }
 
 void USART1_IRQHandler(void) {
-    if(LL_USART_IsActiveFlag_RXNE_RXFNE(USART1)) {
+    if(LL_USART_IsEnabledIT_IDLE(USART1) && LL_USART_IsActiveFlag_IDLE(USART1)) {
+        LL_USART_ClearFlag_IDLE(USART1);
+        LL_USART_ClearFlag_ORE(USART1);
+        furi_hal_uart_dma_rx_process(FuriHalUartIdUSART1);
+    } else if(LL_USART_IsActiveFlag_RXNE_RXFNE(USART1)) {
         uint8_t data = LL_USART_ReceiveData8(USART1);
         irq_cb[FuriHalUartIdUSART1](UartIrqEventRXNE, data, irq_ctx[FuriHalUartIdUSART1]);
     } else if(LL_USART_IsActiveFlag_ORE(USART1)) {
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -84,6 +85,62 @@ void furi_hal_uart_set_irq_cb(
     void (*callback)(UartIrqEvent event, uint8_t data, void* context),
     void* context);
 
+/**
+ * UART DMA receive callback, called from interrupt
+ * @param channel UART channel
+ * @param data received chunk
+ * @param size chunk size (in bytes)
+ * @param context callback context
+ */
+typedef void (*FuriHalUartDmaRxCallback)(
+    FuriHalUartId channel,
+    const uint8_t* data,
+    size_t size,
+    void* context);
+
+/**
+ * UART DMA transmit complete callback, called from interrupt
+ * @param channel UART channel
+ * @param context callback context
+ */
+typedef void (*FuriHalUartDmaTxCallback)(FuriHalUartId channel, void* context);
+
+/**
+ * Starts DMA reception
+ * Data is received into a circular buffer and delivered in chunks: when the line
+ * gets idle and when half of the buffer is filled. Replaces the event callback.
+ * @param channel UART channel
+ * @param callback callback pointer
+ * @param context callback context
+ */
+void furi_hal_uart_dma_rx_start(
+    FuriHalUartId channel,
+    FuriHalUartDmaRxCallback callback,
+    void* context);
+
+/**
+ * Stops DMA reception
+ * @param channel UART channel
+ */
+void furi_hal_uart_dma_rx_stop(FuriHalUartId channel);
+
+/**
+ * Transmits data with DMA, returns immediately
+ * Buffer must stay valid until the callback is called
+ * @param channel UART channel
+ * @param buffer data
+ * @param buffer_size data size (in bytes), up to 65535
+ * @param callback transfer complete callback, can be NULL
+ * @param context callback context
+ * @return false if previous transfer is not complete yet
+ */
+bool furi_hal_uart_dma_tx(
+    FuriHalUartId channel,
+    const uint8_t* buffer,
+    size_t buffer_size,
+    FuriHalUartDmaTxCallback callback,
+    void* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,7 @@
 // #define configTOTAL_HEAP_SIZE                    ((size_t)0)
 #define configMAX_TASK_NAME_LEN (32)
 #define configGENERATE_RUN_TIME_STATS 0
+/* Also gives task number field, used by furi_thread_stats */
 #define configUSE_TRACE_FACILITY 1
 #define configUSE_16_BIT_TICKS 0
 #define configUSE_MUTEXES 1
@@ -137,9 +138,22 @@ standard names. */
 #define configOVERRIDE_DEFAULT_TICK_CONFIGURATION \
     1 /* required only for Keil but does not hurt otherwise */
 
-#define traceTASK_SWITCHED_IN()                                     \
-    extern void furi_hal_mpu_set_stack_protection(uint32_t* stack); \
-    furi_hal_mpu_set_stack_protection((uint32_t*)pxCurrentTCB->pxStack)
+/* Thread statistics hooks, see furi/core/thread_stats.h */
+extern void furi_thread_stats_task_create(void* task);
+extern void furi_thread_stats_task_delete(void* task);
+extern void furi_thread_stats_task_ready(void* task);
+extern void furi_thread_stats_switched_out(void* task);
+extern void furi_thread_stats_switched_in(void* task);
+
+#define traceTASK_CREATE(pxNewTCB) furi_thread_stats_task_create(pxNewTCB)
+#define traceTASK_DELETE(pxTCB) furi_thread_stats_task_delete(pxTCB)
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB) furi_thread_stats_task_ready(pxTCB)
+#define traceTASK_SWITCHED_OUT() furi_thread_stats_switched_out(pxCurrentTCB)
+
+#define traceTASK_SWITCHED_IN()                                          \
+    extern void furi_hal_mpu_set_stack_protection(uint32_t* stack);      \
+    furi_hal_mpu_set_stack_protection((uint32_t*)pxCurrentTCB->pxStack); \
+    furi_thread_stats_switched_in(pxCurrentTCB)
 
 #define portCLEAN_UP_TCB(pxTCB)                                   \
     extern void furi_thread_cleanup_tcb_event(TaskHandle_t task); \
@@ -42,6 +42,33 @@ typedef enum {
     FuriHalI2cEndPause,
 } FuriHalI2cEnd;
 
+typedef struct FuriHalI2cTransaction FuriHalI2cTransaction;
+
+/** Transaction completion callback, called from interrupt
+ *
+ * @warning    Called from thread context if transaction was aborted by
+ *             `furi_hal_i2c_transaction_flush` timeout or bus release
+ */
+typedef void (*FuriHalI2cTransactionCallback)(FuriHalI2cTransaction* transaction, void* context);
+
+/** Queued transaction: optional write, then optional read, each ended with STOP
+ *
+ * Both sizes set to 0 only probes the address.
+ * Must stay valid until the callback is called.
+ */
+struct FuriHalI2cTransaction {
+    uint8_t address;
+    const uint8_t* tx_data;
+    size_t tx_size;
+    uint8_t* rx_data;
+    size_t rx_size;
+    FuriHalI2cTransactionCallback callback;
+    void* context;
+
+    bool result; /**< Set before callback is called */
+    FuriHalI2cTransaction* next; /**< Internal, used by bus queue */
+};
+
 /** Early Init I2C */
 void furi_hal_i2c_init_early();
 
@@ -64,6 +91,31 @@ void furi_hal_i2c_acquire(FuriHalI2cBusHandle* handle);
  */
 void furi_hal_i2c_release(FuriHalI2cBusHandle* handle);
 
+/** Queue transaction on acquired bus and return immediately
+ *
+ * Queued transactions are executed back to back from interrupt, calling
+ * thread is free to do other work until completion. Pending transactions
+ * are aborted on release.
+ *
+ * @warning    Transfers with begin/end settings (`_ext`) can't be mixed with
+ *             pending transactions
+ *
+ * @param      handle       Pointer to FuriHalI2cBusHandle instance
+ * @param      transaction  Pointer to FuriHalI2cTransaction instance
+ */
+void furi_hal_i2c_transaction_submit(
+    FuriHalI2cBusHandle* handle,
+    FuriHalI2cTransaction* transaction);
+
+/** Wait for all queued transactions to complete, abort them on timeout
+ *
+ * @param      handle   Pointer to FuriHalI2cBusHandle instance
+ * @param      timeout  Timeout in milliseconds
+ *
+ * @return     true if queue was drained, false on timeout
+ */
+bool furi_hal_i2c_transaction_flush(FuriHalI2cBusHandle* handle, uint32_t timeout);
+
 /** Perform I2C TX transfer
  *
  * @param      handle   Pointer to FuriHalI2cBusHandle instance
@@ -48,6 +48,12 @@ typedef void (*FuriHalInfraredRxCaptureCallback)(void* ctx, bool level, uint32_t
  */
 typedef void (*FuriHalInfraredRxTimeoutCallback)(void* ctx);
 
+/** Signature of callback function for captured edges waiting to be read in DMA mode.
+ *
+ * @param      ctx[in]  context to pass to callback
+ */
+typedef void (*FuriHalInfraredRxDmaCallback)(void* ctx);
+
 // Debug TX pin set
 void furi_hal_infrared_set_debug_out(bool enable);
 
@@ -60,6 +66,31 @@ bool furi_hal_infrared_get_debug_out_status(void);
  */
 void furi_hal_infrared_async_rx_start(void);
 
+/** Initialize INFRARED RX timer to capture edges with DMA.
+ *
+ * Edge durations are collected into a circular buffer without per-edge interrupts
+ * and read in batches with 'furi_hal_infrared_async_rx_dma_read()'. Callback is
+ * called on the first edge of a signal and every time half of the buffer is filled.
+ * Timeout works the same way as in per-edge mode. Stopped with
+ * 'furi_hal_infrared_async_rx_stop()'.
+ *
+ * @param[in]  callback  callback to call when captured edges are waiting
+ * @param[in]  ctx       context for callback
+ */
+void furi_hal_infrared_async_rx_dma_start(FuriHalInfraredRxDmaCallback callback, void* ctx);
+
+/** Read edge durations captured in DMA mode.
+ *
+ * Durations are in us and levels alternate, starting from space (false).
+ *
+ * @param[out] durations  array to store durations to
+ * @param[in]  max_count  size of durations array, must be even
+ * @param[out] overrun    set to true if captured edges were lost since the last read
+ *
+ * @return     number of durations read, always even
+ */
+size_t furi_hal_infrared_async_rx_dma_read(uint32_t* durations, size_t max_count, bool* overrun);
+
 /** Deinitialize INFRARED RX interrupt.
  */
 void furi_hal_infrared_async_rx_stop(void);
@@ -126,6 +157,24 @@ void furi_hal_infrared_async_tx_set_data_isr_callback(
  */
 void furi_hal_infrared_async_tx_start(uint32_t freq, float duty_cycle);
 
+/** Start IR asynchronous transmission of a pre-rendered signal.
+ *
+ * Data callback is called from the current thread until it provides
+ * FuriHalInfraredTxGetDataStateLastDone, and the whole signal is converted to
+ * timer periods before the timer is started. DMA interrupts then only switch
+ * buffers, so transmission timing doesn't depend on data callback latency.
+ *
+ * Stop and wait the same way as for furi_hal_infrared_async_tx_start().
+ *
+ * @param[in]  freq        frequency for PWM
+ * @param[in]  duty_cycle  duty cycle for PWM
+ *
+ * @return     true if transmission is started, false if signal is too long to
+ *             be pre-rendered. Data callback is drained in both cases, so its
+ *             source has to be rewound before it is sent another way.
+ */
+bool furi_hal_infrared_async_tx_start_prerendered(uint32_t freq, float duty_cycle);
+
 /** Stop IR asynchronous transmission and free resources.
  *
  * Transmission will stop as soon as transmission reaches end of package
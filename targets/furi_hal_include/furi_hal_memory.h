@@ -7,6 +7,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,6 +26,39 @@ void furi_hal_memory_init();
  */
 void* furi_hal_memory_alloc(size_t size);
 
+/**
+ * @brief Allocate zeroed transient buffer from the memory pool
+ *
+ * Buffer can be freed with furi_hal_memory_free_transient() or free(). Transient buffers
+ * are taken from the end of pool regions, so they share free space with permanent ones.
+ *
+ * @param size buffer size
+ * @return void* buffer aligned to 8 bytes or NULL if pool has no space
+ */
+void* furi_hal_memory_alloc_transient(size_t size);
+
+/**
+ * @brief Free transient buffer
+ *
+ * @param data buffer
+ * @return true if buffer was allocated with furi_hal_memory_alloc_transient() and is freed
+ */
+bool furi_hal_memory_free_transient(void* data);
+
+/**
+ * @brief Get size of transient buffers in the pool, headers included
+ *
+ * @return size_t
+ */
+size_t furi_hal_memory_get_transient_used();
+
+/**
+ * @brief Get the largest size of transient buffers in the pool since boot
+ *
+ * @return size_t
+ */
+size_t furi_hal_memory_get_transient_peak();
+
 /**
  * @brief Get free memory pool size
  * 
@@ -452,6 +452,81 @@ FuriHalNfcError furi_hal_nfc_iso14443a_listener_tx_custom_parity(
 */
 FuriHalNfcError furi_hal_nfc_iso15693_listener_tx_sof();
 
+/** Precompile ISO15693 listener response, sending it again only takes DMA setup
+ *
+ * @param[in] tx_data pointer to the response data, CRC included.
+ * @param[in] tx_bits response data size, in bits.
+ * @return FuriHalNfcError
+*/
+FuriHalNfcError furi_hal_nfc_iso15693_listener_cache_frame(const uint8_t* tx_data, size_t tx_bits);
+
+/**
+ * @brief Enumeration of NFC timing trace points.
+ *
+ * Trace is only recorded if the firmware is built with FURI_HAL_NFC_TRACE defined.
+ */
+typedef enum {
+    FuriHalNfcTracePointIrq, /**< NFC interrupt line has risen. */
+    FuriHalNfcTracePointIrqRead, /**< Interrupt status was read, value is IRQ mask. */
+    FuriHalNfcTracePointTxStart, /**< Transmission has started, value is size in bits. */
+    FuriHalNfcTracePointFifoRead, /**< Received data was drained, value is size in bits. */
+    FuriHalNfcTracePointFwtArmed, /**< FWT timer was started, value is time in fc. */
+    FuriHalNfcTracePointFwtExpired, /**< FWT timer has expired. */
+    FuriHalNfcTracePointBlockTxArmed, /**< Block TX timer was started, value is time in fc. */
+    FuriHalNfcTracePointBlockTxExpired, /**< Block TX timer has expired. */
+    FuriHalNfcTracePointCallbackStart, /**< Protocol callback was called, value is event type. */
+    FuriHalNfcTracePointCallbackEnd, /**< Protocol callback has returned, value is command. */
+
+    FuriHalNfcTracePointNum,
+} FuriHalNfcTracePoint;
+
+/**
+ * @brief NFC timing trace record structure.
+ */
+typedef struct {
+    uint32_t cycles; /**< CPU cycle counter value at the moment of recording. */
+    uint32_t value; /**< Trace point specific value. */
+    FuriHalNfcTracePoint point; /**< Trace point identifier. */
+} FuriHalNfcTraceRecord;
+
+/**
+ * @brief Record a timing trace point. Safe to call from ISR.
+ *
+ * Does nothing if the firmware is built without FURI_HAL_NFC_TRACE.
+ * Use FURI_HAL_NFC_TRACE_POINT() macro to avoid the call overhead in this case.
+ *
+ * @param[in] point trace point identifier.
+ * @param[in] value trace point specific value.
+ */
+void furi_hal_nfc_trace_point(FuriHalNfcTracePoint point, uint32_t value);
+
+/**
+ * @brief Copy the most recent timing trace records, oldest first.
+ *
+ * @param[out] records pointer to the array to be filled with records.
+ * @param[in] max_count maximum number of records to be copied.
+ * @returns number of records copied.
+ */
+size_t furi_hal_nfc_trace_read(FuriHalNfcTraceRecord* records, size_t max_count);
+
+/**
+ * @brief Drop all recorded timing trace records.
+ */
+void furi_hal_nfc_trace_reset();
+
+/**
+ * @brief Check whether the firmware is built with timing trace support.
+ *
+ * @returns true if trace is recorded, false otherwise.
+ */
+bool furi_hal_nfc_trace_is_enabled();
+
+#ifdef FURI_HAL_NFC_TRACE
+#define FURI_HAL_NFC_TRACE_POINT(point, value) furi_hal_nfc_trace_point(point, value)
+#else
+#define FURI_HAL_NFC_TRACE_POINT(point, value)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,7 @@ typedef enum {
     FuriHalRtcRegisterPinFails, /**< Failed pins count */
     /* Index of FS directory entry corresponding to FW update to be applied */
     FuriHalRtcRegisterUpdateFolderFSIndex,
+    FuriHalRtcRegisterLfsAllocHint, /**< LFS block to continue allocation from */
 
     FuriHalRtcRegisterMAX, /**< Service value, do not use */
 } FuriHalRtcRegister;
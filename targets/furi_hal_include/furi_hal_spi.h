@@ -59,6 +59,19 @@ void furi_hal_spi_acquire(FuriHalSpiBusHandle* handle);
  */
 void furi_hal_spi_release(FuriHalSpiBusHandle* handle);
 
+/** Hand SPI bus over to higher priority handles waiting for it
+ *
+ * Call between self-contained transactions of long transfers, bus is released
+ * and acquired back only if someone with higher priority is waiting.
+ *
+ * @warning CS is deasserted while bus is given away
+ *
+ * @param      handle  pointer to FuriHalSpiBusHandle instance, must be acquired
+ *
+ * @return     true if bus was given away and acquired again
+ */
+bool furi_hal_spi_yield(FuriHalSpiBusHandle* handle);
+
 /** SPI Receive
  *
  * @param      handle   pointer to FuriHalSpiBusHandle instance